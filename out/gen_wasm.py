@@ -0,0 +1,48 @@
+
+# gen_wasm.py
+# This file is automatically generated. Do not edit.
+# pylint: disable=W,C,R
+_tabversion = '3.10'
+
+_lr_method = 'LALR'
+
+_lr_signature = 'BYTE F32 F64 FLOAT FUNC INT LBRACE LBRACKET LEB_I32 LEB_I64 LEB_U32 LPAREN NAME NAMED_VALUE RBRACE RBRACKET RPAREN SECTION STR STRINGdata : data BYTEdata : data NAME LBRACKET data RBRACKET\n          | data FUNC LBRACKET data RBRACKETdata : data NAMED_VALUEdata : data SECTION LPAREN NAMED_VALUE RPAREN LBRACE data RBRACEdata : data SECTION LPAREN STRING RPAREN LBRACE data RBRACEdata : data FUNC LBRACE data RBRACEdata : data STR LPAREN STRING RPARENdata : data LEB_I32 LPAREN INT RPAREN\n          | data LEB_I32 LPAREN BYTE RPARENdata : data LEB_I64 LPAREN INT RPAREN\n          | data LEB_I64 LPAREN BYTE RPARENdata : data LEB_U32 LPAREN INT RPAREN\n          | data LEB_U32 LPAREN BYTE RPARENdata : data F32 LPAREN FLOAT RPARENdata : data F64 LPAREN FLOAT RPARENdata : data STRINGdata :'
+    
+_lr_action_items = {'BYTE':([0,1,2,5,7,14,15,16,19,20,21,24,25,26,38,39,40,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,],[-18,2,-1,-4,-17,-18,-18,-18,31,33,35,2,2,2,-2,-3,-7,-8,-9,-10,-11,-12,-13,-14,-15,-16,-18,-18,2,2,-5,-6,]),'NAME':([0,1,2,5,7,14,15,16,24,25,26,38,39,40,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,],[-18,3,-1,-4,-17,-18,-18,-18,3,3,3,-2,-3,-7,-8,-9,-10,-11,-12,-13,-14,-15,-16,-18,-18,3,3,-5,-6,]),'FUNC':([0,1,2,5,7,14,15,16,24,25,26,38,39,40,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,],[-18,4,-1,-4,-17,-18,-18,-18,4,4,4,-2,-3,-7,-8,-9,-10,-11,-12,-13,-14,-15,-16,-18,-18,4,4,-5,-6,]),'NAMED_VALUE':([0,1,2,5,7,14,15,16,17,24,25,26,38,39,40,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,],[-18,5,-1,-4,-17,-18,-18,-18,27,5,5,5,-2,-3,-7,-8,-9,-10,-11,-12,-13,-14,-15,-16,-18,-18,5,5,-5,-6,]),'SECTION':([0,1,2,5,7,14,15,16,24,25,26,38,39,40,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,],[-18,6,-1,-4,-17,-18,-18,-18,6,6,6,-2,-3,-7,-8,-9,-10,-11,-12,-13,-14,-15,-16,-18,-18,6,6,-5,-6,]),'STR':([0,1,2,5,7,14,15,16,24,25,26,38,39,40,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,],[-18,8,-1,-4,-17,-18,-18,-18,8,8,8,-2,-3,-7,-8,-9,-10,-11,-12,-13,-14,-15,-16,-18,-18,8,8,-5,-6,]),'LEB_I32':([0,1,2,5,7,14,15,16,24,25,26,38,39,40,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,],[-18,9,-1,-4,-17,-18,-18,-18,9,9,9,-2,-3,-7,-8,-9,-10,-11,-12,-13,-14,-15,-16,-18,-18,9,9,-5,-6,]),'LEB_I64':([0,1,2,5,7,14,15,16,24,25,26,38,39,40,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,],[-18,10,-1,-4,-17,-18,-18,-18,10,10,10,-2,-3,-7,-8,-9,-10,-11,-12,-13,-14,-15,-16,-18,-18,10,10,-5,-6,]),'LEB_U32':([0,1,2,5,7,14,15,16,24,25,26,38,39,40,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,],[-18,11,-1,-4,-17,-18,-18,-18,11,11,11,-2,-3,-7,-8,-9,-10,-11,-12,-13,-14,-15,-16,-18,-18,11,11,-5,-6,]),'F32':([0,1,2,5,7,14,15,16,24,25,26,38,39,40,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,],[-18,12,-1,-4,-17,-18,-18,-18,12,12,12,-2,-3,-7,-8,-9,-10,-11,-12,-13,-14,-15,-16,-18,-18,12,12,-5,-6,]),'F64':([0,1,2,5,7,14,15,16,24,25,26,38,39,40,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,],[-18,13,-1,-4,-17,-18,-18,-18,13,13,13,-2,-3,-7,-8,-9,-10,-11,-12,-13,-14,-15,-16,-18,-18,13,13,-5,-6,]),'STRING':([0,1,2,5,7,14,15,16,17,18,24,25,26,38,39,40,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,],[-18,7,-1,-4,-17,-18,-18,-18,28,29,7,7,7,-2,-3,-7,-8,-9,-10,-11,-12,-13,-14,-15,-16,-18,-18,7,7,-5,-6,]),'$end':([0,1,2,5,7,38,39,40,43,44,45,46,47,48,49,50,51,56,57,],[-18,0,-1,-4,-17,-2,-3,-7,-8,-9,-10,-11,-12,-13,-14,-15,-16,-5,-6,]),'RBRACKET':([2,5,7,14,15,24,25,38,39,40,43,44,45,46,47,48,49,50,51,56,57,],[-1,-4,-17,-18,-18,38,39,-2,-3,-7,-8,-9,-10,-11,-12,-13,-14,-15,-16,-5,-6,]),'RBRACE':([2,5,7,16,26,38,39,40,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,],[-1,-4,-17,-18,40,-2,-3,-7,-8,-9,-10,-11,-12,-13,-14,-15,-16,-18,-18,56,57,-5,-6,]),'LBRACKET':([3,4,],[14,15,]),'LBRACE':([4,41,42,],[16,52,53,]),'LPAREN':([6,8,9,10,11,12,13,],[17,18,19,20,21,22,23,]),'INT':([19,20,21,],[30,32,34,]),'FLOAT':([22,23,],[36,37,]),'RPAREN':([27,28,29,30,31,32,33,34,35,36,37,],[41,42,43,44,45,46,47,48,49,50,51,]),}
+
+_lr_action = {}
+for _k, _v in _lr_action_items.items():
+   for _x,_y in zip(_v[0],_v[1]):
+      if not _x in _lr_action:  _lr_action[_x] = {}
+      _lr_action[_x][_k] = _y
+del _lr_action_items
+
+_lr_goto_items = {'data':([0,14,15,16,52,53,],[1,24,25,26,54,55,]),}
+
+_lr_goto = {}
+for _k, _v in _lr_goto_items.items():
+   for _x, _y in zip(_v[0], _v[1]):
+       if not _x in _lr_goto: _lr_goto[_x] = {}
+       _lr_goto[_x][_k] = _y
+del _lr_goto_items
+_lr_productions = [
+  ("S' -> data","S'",1,None,None,None),
+  ('data -> data BYTE','data',2,'p_data_byte','gen-wasm.py',387),
+  ('data -> data NAME LBRACKET data RBRACKET','data',5,'p_data_name','gen-wasm.py',393),
+  ('data -> data FUNC LBRACKET data RBRACKET','data',5,'p_data_name','gen-wasm.py',394),
+  ('data -> data NAMED_VALUE','data',2,'p_data_named_value','gen-wasm.py',401),
+  ('data -> data SECTION LPAREN NAMED_VALUE RPAREN LBRACE data RBRACE','data',8,'p_data_section','gen-wasm.py',410),
+  ('data -> data SECTION LPAREN STRING RPAREN LBRACE data RBRACE','data',8,'p_data_user_section','gen-wasm.py',419),
+  ('data -> data FUNC LBRACE data RBRACE','data',5,'p_data_func','gen-wasm.py',433),
+  ('data -> data STR LPAREN STRING RPAREN','data',5,'p_data_str','gen-wasm.py',442),
+  ('data -> data LEB_I32 LPAREN INT RPAREN','data',5,'p_data_leb_i32','gen-wasm.py',450),
+  ('data -> data LEB_I32 LPAREN BYTE RPAREN','data',5,'p_data_leb_i32','gen-wasm.py',451),
+  ('data -> data LEB_I64 LPAREN INT RPAREN','data',5,'p_data_leb_i64','gen-wasm.py',457),
+  ('data -> data LEB_I64 LPAREN BYTE RPAREN','data',5,'p_data_leb_i64','gen-wasm.py',458),
+  ('data -> data LEB_U32 LPAREN INT RPAREN','data',5,'p_data_leb_u32','gen-wasm.py',464),
+  ('data -> data LEB_U32 LPAREN BYTE RPAREN','data',5,'p_data_leb_u32','gen-wasm.py',465),
+  ('data -> data F32 LPAREN FLOAT RPAREN','data',5,'p_data_f32','gen-wasm.py',471),
+  ('data -> data F64 LPAREN FLOAT RPAREN','data',5,'p_data_f64','gen-wasm.py',477),
+  ('data -> data STRING','data',2,'p_data_string','gen-wasm.py',483),
+  ('data -> <empty>','data',0,'p_data_empty','gen-wasm.py',489),
+]
@@ -0,0 +1 @@
+(module))
\ No newline at end of file
@@ -0,0 +1,63 @@
+(module
+  (type (;0;) (func))
+  (type (;1;) (func (result i32)))
+  (type (;2;) (func (param i32 i32) (result i32)))
+  (type (;3;) (func (param i64 i64) (result i64)))
+  (type (;4;) (func (param f32 f32) (result f32)))
+  (type (;5;) (func (param f64 f64) (result f64)))
+  (type (;6;) (func (result f32)))
+  (func (;0;) (type 0))
+  (func (;1;) (type 1) (result i32)
+    i32.const 42)
+  (func (;2;) (type 2) (param i32 i32) (result i32)
+    get_local 0
+    get_local 1
+    i32.add)
+  (func (;3;) (type 3) (param i64 i64) (result i64)
+    get_local 0
+    get_local 1
+    i64.add)
+  (func (;4;) (type 4) (param f32 f32) (result f32)
+    get_local 0
+    get_local 1
+    f32.add)
+  (func (;5;) (type 5) (param f64 f64) (result f64)
+    get_local 0
+    get_local 1
+    f64.add)
+  (func (;6;) (type 6) (result f32)
+    f32.const nan:0x2 (;=nan;))
+  (export "no_result" (func 0))
+  (export "42" (func 1))
+  (export "i32.add" (func 2))
+  (export "i64.add" (func 3))
+  (export "f32.add" (func 4))
+  (export "f64.add" (func 5))
+  (export "nan" (func 6))
+
+(func (export "assert_0")
+block
+i64.const 1
+i64.const 2
+call 3
+i64.const 3
+i64.eq
+i32.eqz
+br_if 0
+return
+end
+unreachable
+)
+(func (export "assert_1")
+block
+call 6
+i32.reinterpret/f32
+f32.const nan:0x2
+i32.reinterpret/f32
+i32.eq
+i32.eqz
+br_if 0
+return
+end
+unreachable
+))
\ No newline at end of file
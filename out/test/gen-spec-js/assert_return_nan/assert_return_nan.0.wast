@@ -0,0 +1,84 @@
+(module
+  (type (;0;) (func (result f32)))
+  (type (;1;) (func (param f32) (result f32)))
+  (type (;2;) (func (result f64)))
+  (type (;3;) (func (param f64) (result f64)))
+  (func (;0;) (type 0) (result f32)
+    f32.const nan (;=nan;))
+  (func (;1;) (type 0) (result f32)
+    f32.const nan:0x1234 (;=nan;))
+  (func (;2;) (type 1) (param f32) (result f32)
+    get_local 0)
+  (func (;3;) (type 2) (result f64)
+    f64.const nan (;=nan;))
+  (func (;4;) (type 2) (result f64)
+    f64.const nan:0x1234 (;=nan;))
+  (func (;5;) (type 3) (param f64) (result f64)
+    get_local 0)
+  (export "f32_nan" (func 0))
+  (export "f32_nan_with_tag" (func 1))
+  (export "f32_passthru" (func 2))
+  (export "f64_nan" (func 3))
+  (export "f64_nan_with_tag" (func 4))
+  (export "f64_passthru" (func 5))
+
+(func (export "assert_0")
+block
+f32.const -nan
+call 2
+i32.reinterpret/f32
+i32.const 0x7fffffff
+i32.and
+i32.const 0x7fc00000
+i32.eq
+i32.eqz
+br_if 0
+return
+end
+unreachable
+)
+(func (export "assert_1")
+block
+f32.const nan:0x1234
+call 2
+i32.reinterpret/f32
+i32.const 0x7fc00000
+i32.and
+i32.const 0x7fc00000
+i32.eq
+i32.eqz
+br_if 0
+return
+end
+unreachable
+)
+(func (export "assert_2")
+block
+f64.const -nan
+call 5
+i64.reinterpret/f64
+i64.const 0x7fffffffffffffff
+i64.and
+i64.const 0x7ff8000000000000
+i64.eq
+i32.eqz
+br_if 0
+return
+end
+unreachable
+)
+(func (export "assert_3")
+block
+f64.const nan:0x1234
+call 5
+i64.reinterpret/f64
+i64.const 0x7ff8000000000000
+i64.and
+i64.const 0x7ff8000000000000
+i64.eq
+i32.eqz
+br_if 0
+return
+end
+unreachable
+))
\ No newline at end of file
@@ -0,0 +1,16 @@
+(module
+  (type (;0;) (func))
+  (type (;1;) (func (param f32) (result i32)))
+  (func (;0;) (type 0)
+    unreachable)
+  (func (;1;) (type 1) (param f32) (result i32)
+    get_local 0
+    i32.trunc_s/f32)
+  (export "unreachable" (func 0))
+  (export "i32.trunc_s" (func 1))
+
+(func (export "assert_0")
+f32.const -nan
+call 1
+br 0
+))
\ No newline at end of file
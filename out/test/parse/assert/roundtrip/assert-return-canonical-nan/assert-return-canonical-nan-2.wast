@@ -0,0 +1,7 @@
+(module
+  (type (;0;) (func (param f32) (result f32)))
+  (func (;0;) (type 0) (param f32) (result f32)
+    get_local 0
+    f32.const 0x0p+0 (;=0;)
+    f32.div)
+  (export "foo" (func 0)))
@@ -0,0 +1,7 @@
+(module
+  (type (;0;) (func (param i32) (result i32)))
+  (func (;0;) (type 0) (param i32) (result i32)
+    get_local 0
+    i32.const 100
+    i32.add)
+  (export "test" (func 0)))
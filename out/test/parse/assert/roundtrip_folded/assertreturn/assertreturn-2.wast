@@ -0,0 +1,9 @@
+(module
+  (type (;0;) (func (result i32)))
+  (type (;1;) (func (param f32) (result f32)))
+  (func (;0;) (type 0) (result i32)
+    (i32.const 0))
+  (func (;1;) (type 1) (param f32) (result f32)
+    (get_local 0))
+  (export "foo" (func 0))
+  (export "bar" (func 1)))
@@ -0,0 +1,13 @@
+(module
+  (type (;0;) (func))
+  (func (;0;) (type 0)
+    block  ;; label = @1
+      block  ;; label = @2
+        block  ;; label = @3
+          i32.const 0
+          br_table 0 (;@3;) 1 (;@2;) 2 (;@1;)
+        end
+        nop
+      end
+      nop
+    end))
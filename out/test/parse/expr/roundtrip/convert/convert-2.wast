@@ -0,0 +1,66 @@
+(module
+  (type (;0;) (func))
+  (func (;0;) (type 0)
+    i64.const 0
+    i32.wrap/i64
+    drop
+    i32.const 0
+    i64.extend_u/i32
+    drop
+    i32.const 0
+    i64.extend_s/i32
+    drop
+    f32.const 0x0p+0 (;=0;)
+    i32.trunc_s/f32
+    drop
+    f32.const 0x0p+0 (;=0;)
+    i32.trunc_u/f32
+    drop
+    f64.const 0x0p+0 (;=0;)
+    i32.trunc_s/f64
+    drop
+    f64.const 0x0p+0 (;=0;)
+    i32.trunc_u/f64
+    drop
+    f32.const 0x0p+0 (;=0;)
+    i64.trunc_s/f32
+    drop
+    f32.const 0x0p+0 (;=0;)
+    i64.trunc_u/f32
+    drop
+    f64.const 0x0p+0 (;=0;)
+    i64.trunc_s/f64
+    drop
+    f64.const 0x0p+0 (;=0;)
+    i64.trunc_u/f64
+    drop
+    i32.const 0
+    f32.convert_s/i32
+    drop
+    i32.const 0
+    f32.convert_u/i32
+    drop
+    i64.const 0
+    f32.convert_s/i64
+    drop
+    i64.const 0
+    f32.convert_u/i64
+    drop
+    i32.const 0
+    f64.convert_s/i32
+    drop
+    i32.const 0
+    f64.convert_u/i32
+    drop
+    i64.const 0
+    f64.convert_s/i64
+    drop
+    i64.const 0
+    f64.convert_u/i64
+    drop
+    f64.const 0x0p+0 (;=0;)
+    f32.demote/f64
+    drop
+    f32.const 0x0p+0 (;=0;)
+    f64.promote/f32
+    drop))
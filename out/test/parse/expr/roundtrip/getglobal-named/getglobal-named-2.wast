@@ -0,0 +1,5 @@
+(module
+  (type (;0;) (func (result i32)))
+  (func (;0;) (type 0) (result i32)
+    get_global 0)
+  (global (;0;) i32 (i32.const 1)))
@@ -0,0 +1,18 @@
+(module
+  (type (;0;) (func (param i32 f32)))
+  (func (;0;) (type 0) (param i32 f32)
+    (local i32 i64 f64)
+    get_local 0
+    drop
+    get_local 1
+    drop
+    get_local 1
+    drop
+    get_local 2
+    drop
+    get_local 3
+    drop
+    get_local 4
+    drop
+    get_local 4
+    drop))
@@ -0,0 +1,6 @@
+(module
+  (type (;0;) (func))
+  (func (;0;) (type 0)
+    (local i32)
+    get_local 0
+    drop))
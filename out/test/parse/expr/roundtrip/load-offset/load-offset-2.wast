@@ -0,0 +1,88 @@
+(module
+  (type (;0;) (func))
+  (func (;0;) (type 0)
+    i32.const 0
+    i32.load
+    drop
+    i32.const 0
+    i64.load offset=1
+    drop
+    i32.const 0
+    i64.load8_s offset=2
+    drop
+    i32.const 0
+    i64.load16_s offset=3
+    drop
+    i32.const 0
+    i64.load32_s offset=4
+    drop
+    i32.const 0
+    i64.load8_u offset=5
+    drop
+    i32.const 0
+    i64.load16_u offset=6
+    drop
+    i32.const 0
+    i64.load32_u offset=7
+    drop
+    i32.const 0
+    i32.load8_s offset=8
+    drop
+    i32.const 0
+    i32.load16_s offset=9
+    drop
+    i32.const 0
+    i32.load8_u offset=10
+    drop
+    i32.const 0
+    i32.load16_u offset=11
+    drop
+    i32.const 0
+    f32.load offset=12
+    drop
+    i32.const 0
+    f64.load offset=13
+    drop
+    i32.const 0
+    i32.load align=1
+    drop
+    i32.const 0
+    i64.load offset=1 align=2
+    drop
+    i32.const 0
+    i64.load8_s offset=2
+    drop
+    i32.const 0
+    i64.load16_s offset=3 align=1
+    drop
+    i32.const 0
+    i64.load32_s offset=4 align=1
+    drop
+    i32.const 0
+    i64.load8_u offset=5
+    drop
+    i32.const 0
+    i64.load16_u offset=6
+    drop
+    i32.const 0
+    i64.load32_u offset=7 align=2
+    drop
+    i32.const 0
+    i32.load8_s offset=8
+    drop
+    i32.const 0
+    i32.load16_s offset=9
+    drop
+    i32.const 0
+    i32.load8_u offset=10
+    drop
+    i32.const 0
+    i32.load16_u offset=11
+    drop
+    i32.const 0
+    f32.load offset=12
+    drop
+    i32.const 0
+    f64.load offset=13 align=2
+    drop)
+  (memory (;0;) 1))
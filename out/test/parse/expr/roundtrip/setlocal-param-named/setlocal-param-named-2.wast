@@ -0,0 +1,5 @@
+(module
+  (type (;0;) (func (param i32)))
+  (func (;0;) (type 0) (param i32)
+    i32.const 0
+    set_local 0))
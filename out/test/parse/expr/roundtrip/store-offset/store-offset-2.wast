@@ -0,0 +1,58 @@
+(module
+  (type (;0;) (func))
+  (func (;0;) (type 0)
+    i32.const 0
+    i32.const 0
+    i32.store8
+    i32.const 0
+    i32.const 0
+    i32.store16 offset=1
+    i32.const 0
+    i32.const 0
+    i32.store offset=2
+    i32.const 0
+    i64.const 0
+    i64.store offset=3
+    i32.const 0
+    i64.const 0
+    i64.store8 offset=4
+    i32.const 0
+    i64.const 0
+    i64.store16 offset=5
+    i32.const 0
+    i64.const 0
+    i64.store32 offset=6
+    i32.const 0
+    f32.const 0x0p+0 (;=0;)
+    f32.store offset=7
+    i32.const 0
+    f64.const 0x0p+0 (;=0;)
+    f64.store offset=8
+    i32.const 0
+    i32.const 0
+    i32.store8
+    i32.const 0
+    i32.const 0
+    i32.store16 offset=1
+    i32.const 0
+    i32.const 0
+    i32.store offset=2
+    i32.const 0
+    i64.const 0
+    i64.store offset=3
+    i32.const 0
+    i64.const 0
+    i64.store8 offset=4
+    i32.const 0
+    i64.const 0
+    i64.store16 offset=5 align=1
+    i32.const 0
+    i64.const 0
+    i64.store32 offset=6
+    i32.const 0
+    f32.const 0x0p+0 (;=0;)
+    f32.store offset=7 align=2
+    i32.const 0
+    f64.const 0x0p+0 (;=0;)
+    f64.store offset=8 align=1)
+  (memory (;0;) 1))
@@ -0,0 +1,7 @@
+(module
+  (type (;0;) (func))
+  (func (;0;) (type 0)
+    (local i32)
+    i32.const 0
+    tee_local 0
+    drop))
@@ -0,0 +1,7 @@
+(module
+  (type (;0;) (func (result i32)))
+  (func (;0;) (type 0) (result i32)
+    (block (result i32)  ;; label = @1
+      (nop)
+      (return
+        (i32.const 1)))))
@@ -0,0 +1,8 @@
+(module
+  (type (;0;) (func))
+  (func (;0;) (type 0)
+    (block  ;; label = @1
+      (nop)
+      (block  ;; label = @2
+        (nop)
+        (nop)))))
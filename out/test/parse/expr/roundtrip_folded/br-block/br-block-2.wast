@@ -0,0 +1,7 @@
+(module
+  (type (;0;) (func))
+  (func (;0;) (type 0)
+    (block  ;; label = @1
+      (br 0 (;@1;)))
+    (block  ;; label = @2
+      (br 0 (;@2;)))))
@@ -0,0 +1,9 @@
+(module
+  (type (;0;) (func (param i32)))
+  (type (;1;) (func))
+  (func (;0;) (type 1)
+    (call_indirect 0
+      (i32.const 0)
+      (i32.const 0)))
+  (table (;0;) 1 1 anyfunc)
+  (elem (i32.const 0) 0))
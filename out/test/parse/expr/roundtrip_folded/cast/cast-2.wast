@@ -0,0 +1,15 @@
+(module
+  (type (;0;) (func))
+  (func (;0;) (type 0)
+    (drop
+      (f32.reinterpret/i32
+        (i32.const 0)))
+    (drop
+      (i32.reinterpret/f32
+        (f32.const 0x0p+0 (;=0;))))
+    (drop
+      (f64.reinterpret/i64
+        (i64.const 0)))
+    (drop
+      (i64.reinterpret/f64
+        (f64.const 0x0p+0 (;=0;))))))
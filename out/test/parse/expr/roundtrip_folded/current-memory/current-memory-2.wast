@@ -0,0 +1,6 @@
+(module
+  (type (;0;) (func))
+  (func (;0;) (type 0)
+    (drop
+      (current_memory)))
+  (memory (;0;) 1))
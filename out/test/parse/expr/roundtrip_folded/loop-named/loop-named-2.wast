@@ -0,0 +1,7 @@
+(module
+  (type (;0;) (func))
+  (func (;0;) (type 0)
+    (loop  ;; label = @1
+      (nop))
+    (loop  ;; label = @2
+      (nop))))
@@ -0,0 +1,69 @@
+(module
+  (type (;0;) (func))
+  (func (;0;) (type 0)
+    (drop
+      (f32.neg
+        (f32.const 0x0p+0 (;=0;))))
+    (drop
+      (f64.neg
+        (f64.const 0x0p+0 (;=0;))))
+    (drop
+      (f32.abs
+        (f32.const 0x0p+0 (;=0;))))
+    (drop
+      (f64.abs
+        (f64.const 0x0p+0 (;=0;))))
+    (drop
+      (f32.sqrt
+        (f32.const 0x0p+0 (;=0;))))
+    (drop
+      (f64.sqrt
+        (f64.const 0x0p+0 (;=0;))))
+    (drop
+      (i32.eqz
+        (i32.const 0)))
+    (drop
+      (i64.eqz
+        (i64.const 0)))
+    (drop
+      (i32.clz
+        (i32.const 0)))
+    (drop
+      (i64.clz
+        (i64.const 0)))
+    (drop
+      (i32.ctz
+        (i32.const 0)))
+    (drop
+      (i64.ctz
+        (i64.const 0)))
+    (drop
+      (i32.popcnt
+        (i32.const 0)))
+    (drop
+      (i64.popcnt
+        (i64.const 0)))
+    (drop
+      (f32.ceil
+        (f32.const 0x0p+0 (;=0;))))
+    (drop
+      (f64.ceil
+        (f64.const 0x0p+0 (;=0;))))
+    (drop
+      (f32.floor
+        (f32.const 0x0p+0 (;=0;))))
+    (drop
+      (f64.floor
+        (f64.const 0x0p+0 (;=0;))))
+    (drop
+      (f32.trunc
+        (f32.const 0x0p+0 (;=0;))))
+    (drop
+      (f64.trunc
+        (f64.const 0x0p+0 (;=0;))))
+    (drop
+      (f32.nearest
+        (f32.const 0x0p+0 (;=0;))))
+    (drop
+      (f64.nearest
+        (f64.const 0x0p+0 (;=0;))))))
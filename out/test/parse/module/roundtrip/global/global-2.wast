@@ -0,0 +1,13 @@
+(module
+  (import "foo" "i32_global" (global (;0;) i32))
+  (import "foo" "i64_global" (global (;1;) i64))
+  (import "foo" "f32_global" (global (;2;) f32))
+  (import "foo" "f64_global" (global (;3;) f64))
+  (global (;4;) i32 (i32.const 1))
+  (global (;5;) i64 (i64.const 2))
+  (global (;6;) f32 (f32.const 0x1.8p+1 (;=3;)))
+  (global (;7;) f64 (f64.const 0x1p+2 (;=4;)))
+  (global (;8;) i32 (get_global 0))
+  (global (;9;) i64 (get_global 1))
+  (global (;10;) f32 (get_global 2))
+  (global (;11;) f64 (get_global 3)))
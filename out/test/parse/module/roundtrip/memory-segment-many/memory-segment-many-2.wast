@@ -0,0 +1,6 @@
+(module
+  (memory (;0;) 1)
+  (data (i32.const 0) "hi")
+  (data (i32.const 4) "hello")
+  (data (i32.const 10) "goodbye")
+  (data (i32.const 20) "adios"))
@@ -0,0 +1,4 @@
+(module
+  (memory (;0;) 1)
+  (export "mem1" (memory 0))
+  (export "mem2" (memory 0)))
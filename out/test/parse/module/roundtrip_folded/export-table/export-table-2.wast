@@ -0,0 +1,3 @@
+(module
+  (table (;0;) 0 anyfunc)
+  (export "my_table" (table 0)))
@@ -0,0 +1,3 @@
+(module
+  (import "a" "global" (global (;0;) i32))
+  (global (;1;) i32 (get_global 0)))
@@ -0,0 +1,2 @@
+(module
+  (import "foo" "2" (table (;0;) 0 10 anyfunc)))
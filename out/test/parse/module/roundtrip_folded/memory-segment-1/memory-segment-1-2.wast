@@ -0,0 +1,3 @@
+(module
+  (memory (;0;) 1 1)
+  (data (i32.const 0) "hello, world!"))
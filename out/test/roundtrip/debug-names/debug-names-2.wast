@@ -0,0 +1,6 @@
+(module
+  (type (;0;) (func))
+  (type (;1;) (func (param i32 i64)))
+  (func $f1 (type 0))
+  (func $f2 (type 1) (param $p1 i32) (param $p2 i64)
+    (local $l1 f32) (local $l2 f64)))
@@ -0,0 +1,9 @@
+(module
+  (type (;0;) (func))
+  (func (;0;) (type 0)
+    block  ;; label = @1
+      i32.const 0
+      if  ;; label = @2
+        br 0 (;@2;)
+      end
+    end))
@@ -0,0 +1,18 @@
+(module
+  (type (;0;) (func (result i32)))
+  (func (;0;) (type 0) (result i32)
+    block  ;; label = @1
+      block  ;; label = @2
+        loop  ;; label = @3
+          i32.const 1
+          if  ;; label = @4
+            br 3 (;@1;)
+          end
+          br 1 (;@2;)
+        end
+      end
+      i32.const 2
+      return
+    end
+    i32.const 3
+    return))
@@ -0,0 +1,8 @@
+(module
+  (type (;0;) (func))
+  (func (;0;) (type 0)
+    (block  ;; label = @1
+      (if  ;; label = @2
+        (i32.const 0)
+        (then
+          (br 0 (;@2;)))))))
@@ -0,0 +1,59 @@
+/*
+ * Copyright 2017 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arena.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+
+namespace wabt {
+
+// The blocks start small, so that a small module doesn't reserve much, and
+// double in size up to the maximum.
+static const size_t kMinBlockSize = 4 * 1024;
+static const size_t kMaxBlockSize = 1024 * 1024;
+
+Arena::Arena() : next_block_size_(kMinBlockSize) {}
+
+Arena::~Arena() {}
+
+void* Arena::Allocate(size_t size, size_t alignment) {
+  assert(alignment != 0 && (alignment & (alignment - 1)) == 0);
+  assert(alignment <= alignof(std::max_align_t));
+  uintptr_t next = reinterpret_cast<uintptr_t>(next_);
+  size_t padding = (alignment - (next & (alignment - 1))) & (alignment - 1);
+  if (!next_ || size + padding > static_cast<size_t>(end_ - next_)) {
+    // A new block is aligned to alignof(std::max_align_t), so needs no
+    // padding.
+    AddBlock(size);
+    padding = 0;
+  }
+  char* result = next_ + padding;
+  next_ = result + size;
+  return result;
+}
+
+void Arena::AddBlock(size_t min_size) {
+  size_t size = std::max(next_block_size_, min_size);
+  blocks_.emplace_back(new char[size]);
+  next_ = blocks_.back().get();
+  end_ = next_ + size;
+  reserved_size_ += size;
+  next_block_size_ = std::min(next_block_size_ * 2, kMaxBlockSize);
+}
+
+}  // namespace wabt
@@ -0,0 +1,57 @@
+/*
+ * Copyright 2017 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef WABT_ARENA_H_
+#define WABT_ARENA_H_
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "common.h"
+
+namespace wabt {
+
+// A bump allocator: Allocate() hands out pieces of a few large blocks, and
+// the blocks are only freed, all at once, when the Arena is destroyed. This
+// suits many small objects that are all freed together, e.g. the Exprs of a
+// Module: they cost a pointer bump each to allocate, and nothing to free.
+class Arena {
+ public:
+  WABT_DISALLOW_COPY_AND_ASSIGN(Arena);
+  Arena();
+  ~Arena();
+
+  // Returns |size| bytes, aligned to |alignment|; it must be a power of two,
+  // no larger than alignof(std::max_align_t).
+  void* Allocate(size_t size, size_t alignment);
+
+  // The total size of the blocks allocated so far.
+  size_t reserved_size() const { return reserved_size_; }
+
+ private:
+  void AddBlock(size_t min_size);
+
+  std::vector<std::unique_ptr<char[]>> blocks_;
+  char* next_ = nullptr;  // The free part of the last block.
+  char* end_ = nullptr;
+  size_t next_block_size_;
+  size_t reserved_size_ = 0;
+};
+
+}  // namespace wabt
+
+#endif /* WABT_ARENA_H_ */
@@ -0,0 +1,147 @@
+/*
+ * Copyright 2017 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "binary-checker.h"
+
+#include <cinttypes>
+
+namespace wabt {
+
+BinaryChecker::BinaryChecker(const ErrorCallback& error_callback)
+    : error_callback_(error_callback) {}
+
+void BinaryChecker::PrintError(const char* fmt, ...) {
+  if (error_callback_) {
+    WABT_SNPRINTF_ALLOCA(buffer, length, fmt);
+    error_callback_(buffer);
+  }
+}
+
+Result BinaryChecker::CheckTable(bool has_table) {
+  if (has_table) {
+    PrintError("only one table allowed");
+    return Result::Error;
+  }
+  return Result::Ok;
+}
+
+Result BinaryChecker::CheckMemory(bool has_memory) {
+  if (has_memory) {
+    PrintError("only one memory allowed");
+    return Result::Error;
+  }
+  return Result::Ok;
+}
+
+Result BinaryChecker::CheckExportGlobal(bool mutable_) {
+  if (mutable_) {
+    PrintError("mutable globals cannot be exported");
+    return Result::Error;
+  }
+  return Result::Ok;
+}
+
+Result BinaryChecker::CheckStartFunction(const TypeVector& param_types,
+                                         const TypeVector& result_types) {
+  if (param_types.size() != 0) {
+    PrintError("start function must be nullary");
+    return Result::Error;
+  }
+  if (result_types.size() != 0) {
+    PrintError("start function must not return anything");
+    return Result::Error;
+  }
+  return Result::Ok;
+}
+
+Result BinaryChecker::CheckInitExprGlobal(Index global_index,
+                                          Index num_global_imports,
+                                          bool mutable_) {
+  if (global_index >= num_global_imports) {
+    PrintError("initializer expression can only reference an imported global");
+    return Result::Error;
+  }
+  if (mutable_) {
+    PrintError("initializer expression cannot reference a mutable global");
+    return Result::Error;
+  }
+  return Result::Ok;
+}
+
+Result BinaryChecker::CheckLocal(Index local_index, Index num_locals) {
+  if (local_index >= num_locals) {
+    PrintError("invalid local_index: %" PRIindex " (max %" PRIindex ")",
+               local_index, num_locals);
+    return Result::Error;
+  }
+  return Result::Ok;
+}
+
+Result BinaryChecker::CheckGlobal(Index global_index, Index num_globals) {
+  if (global_index >= num_globals) {
+    PrintError("invalid global_index: %" PRIindex " (max %" PRIindex ")",
+               global_index, num_globals);
+    return Result::Error;
+  }
+  return Result::Ok;
+}
+
+Result BinaryChecker::CheckSetGlobal(Index global_index, bool mutable_) {
+  if (!mutable_) {
+    PrintError("can't set_global on immutable global at index %" PRIindex ".",
+               global_index);
+    return Result::Error;
+  }
+  return Result::Ok;
+}
+
+Result BinaryChecker::CheckHasTable(Opcode opcode, bool has_table) {
+  if (!has_table) {
+    PrintError("found %s operator, but no table", opcode.GetName());
+    return Result::Error;
+  }
+  return Result::Ok;
+}
+
+Result BinaryChecker::CheckHasMemory(Opcode opcode, bool has_memory) {
+  if (!has_memory) {
+    PrintError("%s requires an imported or defined memory.", opcode.GetName());
+    return Result::Error;
+  }
+  return Result::Ok;
+}
+
+Result BinaryChecker::CheckAlign(uint32_t alignment_log2,
+                                 Address natural_alignment) {
+  if (alignment_log2 >= 32 || (1U << alignment_log2) > natural_alignment) {
+    PrintError("alignment must not be larger than natural alignment (%u)",
+               natural_alignment);
+    return Result::Error;
+  }
+  return Result::Ok;
+}
+
+Result BinaryChecker::CheckAtomicAlign(uint32_t alignment_log2,
+                                       Address natural_alignment) {
+  if (alignment_log2 >= 32 || (1U << alignment_log2) != natural_alignment) {
+    PrintError("alignment must be equal to natural alignment (%u)",
+               natural_alignment);
+    return Result::Error;
+  }
+  return Result::Ok;
+}
+
+}  // namespace wabt
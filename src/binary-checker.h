@@ -0,0 +1,68 @@
+/*
+ * Copyright 2017 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef WABT_BINARY_CHECKER_H_
+#define WABT_BINARY_CHECKER_H_
+
+#include <functional>
+
+#include "common.h"
+#include "opcode.h"
+
+namespace wabt {
+
+// The checks on a binary module, other than those of the TypeChecker, that
+// both the interpreter and wasm-validate make while reading it. The caller
+// keeps the module state, and passes in what each check needs.
+class BinaryChecker {
+ public:
+  typedef std::function<void(const char* msg)> ErrorCallback;
+
+  BinaryChecker() = default;
+  explicit BinaryChecker(const ErrorCallback&);
+
+  void set_error_callback(const ErrorCallback& error_callback) {
+    error_callback_ = error_callback;
+  }
+
+  // |has_table| and |has_memory| tell whether the module already had one
+  // before the one being added.
+  Result CheckTable(bool has_table);
+  Result CheckMemory(bool has_memory);
+  Result CheckExportGlobal(bool mutable_);
+  Result CheckStartFunction(const TypeVector& param_types,
+                            const TypeVector& result_types);
+  Result CheckInitExprGlobal(Index global_index,
+                             Index num_global_imports,
+                             bool mutable_);
+
+  Result CheckLocal(Index local_index, Index num_locals);
+  Result CheckGlobal(Index global_index, Index num_globals);
+  Result CheckSetGlobal(Index global_index, bool mutable_);
+  Result CheckHasTable(Opcode opcode, bool has_table);
+  Result CheckHasMemory(Opcode opcode, bool has_memory);
+  Result CheckAlign(uint32_t alignment_log2, Address natural_alignment);
+  Result CheckAtomicAlign(uint32_t alignment_log2, Address natural_alignment);
+
+ private:
+  void WABT_PRINTF_FORMAT(2, 3) PrintError(const char* fmt, ...);
+
+  ErrorCallback error_callback_;
+};
+
+}  // namespace wabt
+
+#endif /* WABT_BINARY_CHECKER_H_ */
@@ -0,0 +1,2448 @@
+/*
+ * Copyright 2017 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef WABT_BINARY_READER_IMPL_H_
+#define WABT_BINARY_READER_IMPL_H_
+
+#include <algorithm>
+#include <cassert>
+#include <cinttypes>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "binary.h"
+#include "binary-reader.h"
+#include "config.h"
+#include "utf8.h"
+
+#if HAVE_ALLOCA
+#include <alloca.h>
+#endif
+
+#define CHECK_RESULT(expr)  \
+  do {                      \
+    if (Failed(expr))       \
+      return Result::Error; \
+  } while (0)
+
+#define ERROR_UNLESS(expr, ...) \
+  do {                          \
+    if (!(expr)) {              \
+      PrintError(__VA_ARGS__);  \
+      return Result::Error;     \
+    }                           \
+  } while (0)
+
+#define ERROR_UNLESS_FUTURE_EXCEPTIONS_OPCODE(opcode) \
+  do {                                                \
+    if (!options_->allow_future_exceptions)            \
+      return ReportUnexpectedOpcode(opcode);          \
+  } while (0)
+
+#define CALLBACK0(member)                              \
+  ERROR_UNLESS(Succeeded(delegate_->member()), #member \
+               " callback failed")
+
+#define CALLBACK(member, ...)                             \
+  ERROR_UNLESS(Succeeded(delegate_->member(__VA_ARGS__)), \
+               #member " callback failed")
+
+namespace wabt {
+
+// Reads a module, calling |Delegate|'s callbacks directly rather than through
+// BinaryReaderDelegate's vtable. If |Delegate| is a final class, the callbacks
+// are inlined, and the ones it inherits from BinaryReaderNop compile away.
+// read_binary uses BinaryReaderT<BinaryReaderDelegate>.
+template <typename Delegate>
+class BinaryReaderT {
+ public:
+  BinaryReaderT(const void* data,
+                size_t size,
+                Delegate* delegate,
+                const ReadBinaryOptions* options);
+
+  Result ReadModule();
+  Result IndexModule(BinaryIndex* out_index);
+  Result ReadSectionAt(const BinaryIndex& index, Index section_index);
+  Result ReadFunctionBodiesAt(const BinaryIndex& index,
+                              Index begin,
+                              Index end);
+
+ private:
+  template <typename>
+  friend class StreamingBinaryReader;
+
+  void WABT_PRINTF_FORMAT(2, 3) PrintError(const char* format, ...);
+  Result ReadOpcode(Opcode* out_value, const char* desc) WABT_WARN_UNUSED;
+  Result ReadU8(uint8_t* out_value, const char* desc) WABT_WARN_UNUSED;
+  Result ReadU32(uint32_t* out_value, const char* desc) WABT_WARN_UNUSED;
+  Result ReadF32(uint32_t* out_value, const char* desc) WABT_WARN_UNUSED;
+  Result ReadF64(uint64_t* out_value, const char* desc) WABT_WARN_UNUSED;
+  Result ReadV128(v128* out_value, const char* desc) WABT_WARN_UNUSED;
+  Result ReadU32Leb128(uint32_t* out_value, const char* desc) WABT_WARN_UNUSED;
+  Result ReadI32Leb128(uint32_t* out_value, const char* desc) WABT_WARN_UNUSED;
+  Result ReadI64Leb128(uint64_t* out_value, const char* desc) WABT_WARN_UNUSED;
+  Result ReadType(Type* out_value, const char* desc) WABT_WARN_UNUSED;
+  Result ReadBlockSignature(TypeVector* out_sig_types,
+                            const char* desc) WABT_WARN_UNUSED;
+  Result ReadStr(string_view* out_str, const char* desc) WABT_WARN_UNUSED;
+  Result ReadBytes(const void** out_data,
+                   Address* out_data_size,
+                   const char* desc) WABT_WARN_UNUSED;
+  Result ReadIndex(Index* index, const char* desc) WABT_WARN_UNUSED;
+  Result ReadOffset(Offset* offset, const char* desc) WABT_WARN_UNUSED;
+
+  bool IsConcreteType(Type);
+  bool IsInlineSigType(Type);
+
+  Index NumTotalFuncs();
+  Index NumTotalTables();
+  Index NumTotalMemories();
+  Index NumTotalGlobals();
+
+  Result ReadInitExpr(Index index) WABT_WARN_UNUSED;
+  Result ReadTable(Type* out_elem_type,
+                   Limits* out_elem_limits) WABT_WARN_UNUSED;
+  Result ReadMemory(Limits* out_page_limits) WABT_WARN_UNUSED;
+  Result ReadGlobalHeader(Type* out_type, bool* out_mutable) WABT_WARN_UNUSED;
+  Result ReadExceptionType(TypeVector& sig) WABT_WARN_UNUSED;
+  Result ReadFunctionBody(Offset end_offset) WABT_WARN_UNUSED;
+  Result ReadNamesSection(Offset section_size) WABT_WARN_UNUSED;
+  Result ReadRelocSection(Offset section_size) WABT_WARN_UNUSED;
+  Result ReadLinkingSection(Offset section_size) WABT_WARN_UNUSED;
+  Result ReadCustomSection(Offset section_size) WABT_WARN_UNUSED;
+  Result ReadTypeSection(Offset section_size) WABT_WARN_UNUSED;
+  Result ReadImportSection(Offset section_size) WABT_WARN_UNUSED;
+  Result ReadFunctionSection(Offset section_size) WABT_WARN_UNUSED;
+  Result ReadTableSection(Offset section_size) WABT_WARN_UNUSED;
+  Result ReadMemorySection(Offset section_size) WABT_WARN_UNUSED;
+  Result ReadGlobalSection(Offset section_size) WABT_WARN_UNUSED;
+  Result ReadExportSection(Offset section_size) WABT_WARN_UNUSED;
+  Result ReadStartSection(Offset section_size) WABT_WARN_UNUSED;
+  Result ReadElemSection(Offset section_size) WABT_WARN_UNUSED;
+  Result ReadCodeSection(Offset section_size) WABT_WARN_UNUSED;
+  Result ReadDataSection(Offset section_size) WABT_WARN_UNUSED;
+  Result ReadExceptionSection(Offset section_size) WABT_WARN_UNUSED;
+  Result ReadCodeSectionHeader(Offset section_size) WABT_WARN_UNUSED;
+  Result ReadFunction(Index defined_index) WABT_WARN_UNUSED;
+  Result FinishCodeSection() WABT_WARN_UNUSED;
+  Result ReadSectionHeader(BinarySection* out_section,
+                           Offset* out_section_size) WABT_WARN_UNUSED;
+  Result StartSection(BinarySection section,
+                      Offset section_size) WABT_WARN_UNUSED;
+  Result FinishSection(BinarySection section) WABT_WARN_UNUSED;
+  Result ReadSection(BinarySection section,
+                     Offset section_size) WABT_WARN_UNUSED;
+  Result ReadSections() WABT_WARN_UNUSED;
+  Result ReadHeader() WABT_WARN_UNUSED;
+  Result FinishModule() WABT_WARN_UNUSED;
+  Result SkipSection(BinarySection section,
+                     Offset section_size) WABT_WARN_UNUSED;
+  Result IndexCodeSection(Offset section_size,
+                          BinaryIndex* out_index) WABT_WARN_UNUSED;
+  void SaveContext(BinaryIndex* out_index) const;
+  void LoadContext(const BinaryIndex& index);
+  Result ReportUnexpectedOpcode(Opcode opcode, const char* message = nullptr);
+
+  size_t read_end_ = 0; /* Either the section end or data_size. */
+  bool suppress_errors_ = false;
+  BinaryReaderDelegate::State state_;
+  Delegate* delegate_ = nullptr;
+  TypeVector param_types_;
+  TypeVector result_types_;
+  TypeVector block_sig_types_;
+  typedef BinaryIndex::Signature Signature;
+  std::vector<Signature> signatures_;
+  std::vector<Index> target_depths_;
+  const ReadBinaryOptions* options_ = nullptr;
+  BinarySection last_known_section_ = BinarySection::Invalid;
+  Index num_signatures_ = 0;
+  Index num_imports_ = 0;
+  Index num_func_imports_ = 0;
+  Index num_table_imports_ = 0;
+  Index num_memory_imports_ = 0;
+  Index num_global_imports_ = 0;
+  Index num_exception_imports_ = 0;
+  Index num_function_signatures_ = 0;
+  Index num_tables_ = 0;
+  Index num_memories_ = 0;
+  Index num_globals_ = 0;
+  Index num_exports_ = 0;
+  Index num_function_bodies_ = 0;
+  Index num_exceptions_ = 0;
+};
+
+template <typename Delegate>
+BinaryReaderT<Delegate>::BinaryReaderT(const void* data,
+                                       size_t size,
+                                       Delegate* delegate,
+                                       const ReadBinaryOptions* options)
+    : read_end_(size),
+      state_(static_cast<const uint8_t*>(data), size),
+      delegate_(delegate),
+      options_(options),
+      last_known_section_(BinarySection::Invalid) {
+  delegate->OnSetState(&state_);
+}
+
+template <typename Delegate>
+void WABT_PRINTF_FORMAT(2, 3)
+    BinaryReaderT<Delegate>::PrintError(const char* format, ...) {
+  if (suppress_errors_)
+    return;
+  WABT_SNPRINTF_ALLOCA(buffer, length, format);
+  bool handled = delegate_->OnError(buffer);
+
+  if (!handled) {
+    /* Not great to just print, but we don't want to eat the error either. */
+    fprintf(stderr, "*ERROR*: @0x%08zx: %s\n", state_.offset, buffer);
+  }
+}
+
+#define IN_SIZE(type)                                           \
+  if (state_.offset + sizeof(type) > read_end_) {               \
+    PrintError("unable to read " #type ": %s", desc);           \
+    return Result::Error;                                       \
+  }                                                             \
+  memcpy(out_value, state_.data + state_.offset, sizeof(type)); \
+  state_.offset += sizeof(type);                                \
+  return Result::Ok
+
+template <typename Delegate>
+Result BinaryReaderT<Delegate>::ReportUnexpectedOpcode(Opcode opcode,
+                                                       const char* message) {
+  const char* maybe_space = " ";
+  if (!message)
+    message = maybe_space = "";
+  if (opcode.HasPrefix()) {
+    PrintError("unexpected opcode%s%s: %d %d (0x%x 0x%x)", maybe_space,
+               message, opcode.GetPrefix(), opcode.GetCode(),
+               opcode.GetPrefix(), opcode.GetCode());
+  } else {
+    PrintError("unexpected opcode%s%s: %d (0x%x)", maybe_space, message,
+               opcode.GetCode(), opcode.GetCode());
+  }
+  return Result::Error;
+}
+
+template <typename Delegate>
+Result BinaryReaderT<Delegate>::ReadOpcode(Opcode* out_value,
+                                           const char* desc) {
+  uint8_t value = 0;
+  if (Failed(ReadU8(&value, desc))) {
+    return Result::Error;
+  }
+
+  if (Opcode::IsPrefixByte(value)) {
+    uint32_t code;
+    CHECK_RESULT(ReadU32Leb128(&code, desc));
+    *out_value = Opcode::FromCode(value, code);
+  } else {
+    *out_value = Opcode::FromCode(value);
+  }
+  return Result::Ok;
+}
+
+template <typename Delegate>
+Result BinaryReaderT<Delegate>::ReadU8(uint8_t* out_value, const char* desc) {
+  IN_SIZE(uint8_t);
+}
+
+template <typename Delegate>
+Result BinaryReaderT<Delegate>::ReadU32(uint32_t* out_value, const char* desc) {
+  IN_SIZE(uint32_t);
+}
+
+template <typename Delegate>
+Result BinaryReaderT<Delegate>::ReadF32(uint32_t* out_value, const char* desc) {
+  IN_SIZE(float);
+}
+
+template <typename Delegate>
+Result BinaryReaderT<Delegate>::ReadF64(uint64_t* out_value, const char* desc) {
+  IN_SIZE(double);
+}
+
+template <typename Delegate>
+Result BinaryReaderT<Delegate>::ReadV128(v128* out_value, const char* desc) {
+  IN_SIZE(v128);
+}
+
+#undef IN_SIZE
+
+template <typename Delegate>
+Result BinaryReaderT<Delegate>::ReadU32Leb128(uint32_t* out_value,
+                                              const char* desc) {
+  const uint8_t* p = state_.data + state_.offset;
+  const uint8_t* end = state_.data + read_end_;
+  size_t bytes_read = read_u32_leb128(p, end, out_value);
+  ERROR_UNLESS(bytes_read > 0, "unable to read u32 leb128: %s", desc);
+  state_.offset += bytes_read;
+  return Result::Ok;
+}
+
+template <typename Delegate>
+Result BinaryReaderT<Delegate>::ReadI32Leb128(uint32_t* out_value,
+                                              const char* desc) {
+  const uint8_t* p = state_.data + state_.offset;
+  const uint8_t* end = state_.data + read_end_;
+  size_t bytes_read = read_i32_leb128(p, end, out_value);
+  ERROR_UNLESS(bytes_read > 0, "unable to read i32 leb128: %s", desc);
+  state_.offset += bytes_read;
+  return Result::Ok;
+}
+
+template <typename Delegate>
+Result BinaryReaderT<Delegate>::ReadI64Leb128(uint64_t* out_value,
+                                              const char* desc) {
+  const uint8_t* p = state_.data + state_.offset;
+  const uint8_t* end = state_.data + read_end_;
+  size_t bytes_read = read_i64_leb128(p, end, out_value);
+  if (bytes_read == 0) {
+    /* a complete 10-byte encoding fails only if its top bits are bad */
+    if (p + 9 < end && (p[9] & 0x80) == 0) {
+      PrintError("invalid i64 leb128: %s", desc);
+      return Result::Error;
+    }
+    PrintError("unable to read i64 leb128: %s", desc);
+    return Result::Error;
+  }
+  state_.offset += bytes_read;
+  return Result::Ok;
+}
+
+template <typename Delegate>
+Result BinaryReaderT<Delegate>::ReadType(Type* out_value, const char* desc) {
+  uint32_t type = 0;
+  CHECK_RESULT(ReadI32Leb128(&type, desc));
+  /* Must be in the vs7 range: [-128, 127). */
+  ERROR_UNLESS(
+      static_cast<int32_t>(type) >= -128 && static_cast<int32_t>(type) <= 127,
+      "invalid type: %d", type);
+  *out_value = static_cast<Type>(type);
+  return Result::Ok;
+}
+
+template <typename Delegate>
+Result BinaryReaderT<Delegate>::ReadStr(string_view* out_str,
+                                        const char* desc) {
+  uint32_t str_len = 0;
+  CHECK_RESULT(ReadU32Leb128(&str_len, "string length"));
+
+  ERROR_UNLESS(state_.offset + str_len <= read_end_,
+               "unable to read string: %s", desc);
+
+  *out_str = string_view(
+      reinterpret_cast<const char*>(state_.data) + state_.offset, str_len);
+  state_.offset += str_len;
+
+  ERROR_UNLESS(is_valid_utf8(out_str->data(), out_str->length()),
+               "invalid utf-8 encoding: %s", desc);
+  return Result::Ok;
+}
+
+template <typename Delegate>
+Result BinaryReaderT<Delegate>::ReadBytes(const void** out_data,
+                                          Address* out_data_size,
+                                          const char* desc) {
+  uint32_t data_size = 0;
+  CHECK_RESULT(ReadU32Leb128(&data_size, "data size"));
+
+  ERROR_UNLESS(state_.offset + data_size <= read_end_,
+               "unable to read data: %s", desc);
+
+  *out_data = static_cast<const uint8_t*>(state_.data) + state_.offset;
+  *out_data_size = data_size;
+  state_.offset += data_size;
+  return Result::Ok;
+}
+
+template <typename Delegate>
+Result BinaryReaderT<Delegate>::ReadIndex(Index* index, const char* desc) {
+  uint32_t value;
+  CHECK_RESULT(ReadU32Leb128(&value, desc));
+  *index = value;
+  return Result::Ok;
+}
+
+template <typename Delegate>
+Result BinaryReaderT<Delegate>::ReadOffset(Offset* offset, const char* desc) {
+  uint32_t value;
+  CHECK_RESULT(ReadU32Leb128(&value, desc));
+  *offset = value;
+  return Result::Ok;
+}
+
+inline bool is_valid_external_kind(uint8_t kind) {
+  return kind < kExternalKindCount;
+}
+
+template <typename Delegate>
+bool BinaryReaderT<Delegate>::IsConcreteType(Type type) {
+  switch (type) {
+    case Type::I32:
+    case Type::I64:
+    case Type::F32:
+    case Type::F64:
+      return true;
+
+    case Type::V128:
+      return options_->allow_future_simd;
+
+    default:
+      return false;
+  }
+}
+
+template <typename Delegate>
+bool BinaryReaderT<Delegate>::IsInlineSigType(Type type) {
+  return IsConcreteType(type) || type == Type::Void;
+}
+
+// A block signature is either a single value type, void, or the index of a
+// signature without params.
+template <typename Delegate>
+Result BinaryReaderT<Delegate>::ReadBlockSignature(TypeVector* out_sig_types,
+                                                   const char* desc) {
+  uint32_t value = 0;
+  CHECK_RESULT(ReadI32Leb128(&value, desc));
+  int32_t sig_index = static_cast<int32_t>(value);
+  out_sig_types->clear();
+  if (sig_index >= 0) {
+    ERROR_UNLESS(options_->allow_future_multi_value,
+                 "expected valid block signature type");
+    ERROR_UNLESS(static_cast<Index>(sig_index) < signatures_.size(),
+                 "invalid block signature index: %d", sig_index);
+    const Signature& sig = signatures_[sig_index];
+    ERROR_UNLESS(sig.num_params == 0, "block signature must not have params");
+    *out_sig_types = sig.result_types;
+  } else {
+    Type sig_type = static_cast<Type>(sig_index);
+    ERROR_UNLESS(sig_index >= -128 && IsInlineSigType(sig_type),
+                 "expected valid block signature type");
+    if (sig_type != Type::Void)
+      out_sig_types->push_back(sig_type);
+  }
+  return Result::Ok;
+}
+
+template <typename Delegate>
+Index BinaryReaderT<Delegate>::NumTotalFuncs() {
+  return num_func_imports_ + num_function_signatures_;
+}
+
+template <typename Delegate>
+Index BinaryReaderT<Delegate>::NumTotalTables() {
+  return num_table_imports_ + num_tables_;
+}
+
+template <typename Delegate>
+Index BinaryReaderT<Delegate>::NumTotalMemories() {
+  return num_memory_imports_ + num_memories_;
+}
+
+template <typename Delegate>
+Index BinaryReaderT<Delegate>::NumTotalGlobals() {
+  return num_global_imports_ + num_globals_;
+}
+
+template <typename Delegate>
+Result BinaryReaderT<Delegate>::ReadInitExpr(Index index) {
+  Opcode opcode;
+  CHECK_RESULT(ReadOpcode(&opcode, "opcode"));
+  if (!IsOpcodeAllowed(*options_, opcode))
+    return ReportUnexpectedOpcode(opcode);
+  switch (opcode) {
+    case Opcode::I32Const: {
+      uint32_t value = 0;
+      CHECK_RESULT(ReadI32Leb128(&value, "init_expr i32.const value"));
+      CALLBACK(OnInitExprI32ConstExpr, index, value);
+      break;
+    }
+
+    case Opcode::I64Const: {
+      uint64_t value = 0;
+      CHECK_RESULT(ReadI64Leb128(&value, "init_expr i64.const value"));
+      CALLBACK(OnInitExprI64ConstExpr, index, value);
+      break;
+    }
+
+    case Opcode::F32Const: {
+      uint32_t value_bits = 0;
+      CHECK_RESULT(ReadF32(&value_bits, "init_expr f32.const value"));
+      CALLBACK(OnInitExprF32ConstExpr, index, value_bits);
+      break;
+    }
+
+    case Opcode::F64Const: {
+      uint64_t value_bits = 0;
+      CHECK_RESULT(ReadF64(&value_bits, "init_expr f64.const value"));
+      CALLBACK(OnInitExprF64ConstExpr, index, value_bits);
+      break;
+    }
+
+    case Opcode::GetGlobal: {
+      Index global_index;
+      CHECK_RESULT(ReadIndex(&global_index, "init_expr get_global index"));
+      CALLBACK(OnInitExprGetGlobalExpr, index, global_index);
+      break;
+    }
+
+    case Opcode::End:
+      return Result::Ok;
+
+    default:
+      return ReportUnexpectedOpcode(opcode, "in initializer expression");
+  }
+
+  CHECK_RESULT(ReadOpcode(&opcode, "opcode"));
+  ERROR_UNLESS(opcode == Opcode::End,
+               "expected END opcode after initializer expression");
+  return Result::Ok;
+}
+
+template <typename Delegate>
+Result BinaryReaderT<Delegate>::ReadTable(Type* out_elem_type,
+                                          Limits* out_elem_limits) {
+  CHECK_RESULT(ReadType(out_elem_type, "table elem type"));
+  ERROR_UNLESS(*out_elem_type == Type::Anyfunc,
+               "table elem type must by anyfunc");
+
+  uint32_t flags;
+  uint32_t initial;
+  uint32_t max = 0;
+  CHECK_RESULT(ReadU32Leb128(&flags, "table flags"));
+  CHECK_RESULT(ReadU32Leb128(&initial, "table initial elem count"));
+  bool has_max = flags & WABT_BINARY_LIMITS_HAS_MAX_FLAG;
+  if (has_max) {
+    CHECK_RESULT(ReadU32Leb128(&max, "table max elem count"));
+    ERROR_UNLESS(initial <= max,
+                 "table initial elem count must be <= max elem count");
+  }
+
+  out_elem_limits->has_max = has_max;
+  out_elem_limits->is_shared = false;
+  out_elem_limits->initial = initial;
+  out_elem_limits->max = max;
+  return Result::Ok;
+}
+
+template <typename Delegate>
+Result BinaryReaderT<Delegate>::ReadMemory(Limits* out_page_limits) {
+  uint32_t flags;
+  uint32_t initial;
+  uint32_t max = 0;
+  CHECK_RESULT(ReadU32Leb128(&flags, "memory flags"));
+  CHECK_RESULT(ReadU32Leb128(&initial, "memory initial page count"));
+  bool has_max = flags & WABT_BINARY_LIMITS_HAS_MAX_FLAG;
+  bool is_shared = flags & WABT_BINARY_LIMITS_IS_SHARED_FLAG;
+  ERROR_UNLESS(initial <= WABT_MAX_PAGES, "invalid memory initial size");
+  if (has_max) {
+    CHECK_RESULT(ReadU32Leb128(&max, "memory max page count"));
+    ERROR_UNLESS(max <= WABT_MAX_PAGES, "invalid memory max size");
+    ERROR_UNLESS(initial <= max, "memory initial size must be <= max size");
+  }
+  ERROR_UNLESS(!is_shared || options_->allow_future_threads,
+               "shared memory not allowed");
+  ERROR_UNLESS(!is_shared || has_max, "shared memory must have a max size");
+
+  out_page_limits->has_max = has_max;
+  out_page_limits->is_shared = is_shared;
+  out_page_limits->initial = initial;
+  out_page_limits->max = max;
+  return Result::Ok;
+}
+
+template <typename Delegate>
+Result BinaryReaderT<Delegate>::ReadGlobalHeader(Type* out_type,
+                                                 bool* out_mutable) {
+  Type global_type = Type::Void;
+  uint8_t mutable_ = 0;
+  CHECK_RESULT(ReadType(&global_type, "global type"));
+  ERROR_UNLESS(IsConcreteType(global_type), "invalid global type: %#x",
+               static_cast<int>(global_type));
+
+  CHECK_RESULT(ReadU8(&mutable_, "global mutability"));
+  ERROR_UNLESS(mutable_ <= 1, "global mutability must be 0 or 1");
+
+  *out_type = global_type;
+  *out_mutable = mutable_;
+  return Result::Ok;
+}
+
+template <typename Delegate>
+Result BinaryReaderT<Delegate>::ReadFunctionBody(Offset end_offset) {
+  bool seen_end_opcode = false;
+  while (state_.offset < end_offset) {
+    Opcode opcode;
+    CHECK_RESULT(ReadOpcode(&opcode, "opcode"));
+    if (!IsOpcodeAllowed(*options_, opcode))
+      return ReportUnexpectedOpcode(opcode);
+    CALLBACK(OnOpcode, opcode);
+    switch (opcode) {
+      case Opcode::Unreachable:
+        CALLBACK0(OnUnreachableExpr);
+        CALLBACK0(OnOpcodeBare);
+        break;
+
+      case Opcode::Block: {
+        CHECK_RESULT(
+            ReadBlockSignature(&block_sig_types_, "block signature type"));
+        Index num_types = block_sig_types_.size();
+        Type* sig_types = DataOrNull(block_sig_types_);
+        CALLBACK(OnBlockExpr, num_types, sig_types);
+        CALLBACK(OnOpcodeBlockSig, num_types, sig_types);
+        break;
+      }
+
+      case Opcode::Loop: {
+        CHECK_RESULT(
+            ReadBlockSignature(&block_sig_types_, "loop signature type"));
+        Index num_types = block_sig_types_.size();
+        Type* sig_types = DataOrNull(block_sig_types_);
+        CALLBACK(OnLoopExpr, num_types, sig_types);
+        CALLBACK(OnOpcodeBlockSig, num_types, sig_types);
+        break;
+      }
+
+      case Opcode::If: {
+        CHECK_RESULT(
+            ReadBlockSignature(&block_sig_types_, "if signature type"));
+        Index num_types = block_sig_types_.size();
+        Type* sig_types = DataOrNull(block_sig_types_);
+        CALLBACK(OnIfExpr, num_types, sig_types);
+        CALLBACK(OnOpcodeBlockSig, num_types, sig_types);
+        break;
+      }
+
+      case Opcode::Else:
+        CALLBACK0(OnElseExpr);
+        CALLBACK0(OnOpcodeBare);
+        break;
+
+      case Opcode::Select:
+        CALLBACK0(OnSelectExpr);
+        CALLBACK0(OnOpcodeBare);
+        break;
+
+      case Opcode::Br: {
+        Index depth;
+        CHECK_RESULT(ReadIndex(&depth, "br depth"));
+        CALLBACK(OnBrExpr, depth);
+        CALLBACK(OnOpcodeIndex, depth);
+        break;
+      }
+
+      case Opcode::BrIf: {
+        Index depth;
+        CHECK_RESULT(ReadIndex(&depth, "br_if depth"));
+        CALLBACK(OnBrIfExpr, depth);
+        CALLBACK(OnOpcodeIndex, depth);
+        break;
+      }
+
+      case Opcode::BrTable: {
+        Index num_targets;
+        CHECK_RESULT(ReadIndex(&num_targets, "br_table target count"));
+        target_depths_.resize(num_targets);
+
+        for (Index i = 0; i < num_targets; ++i) {
+          Index target_depth;
+          CHECK_RESULT(ReadIndex(&target_depth, "br_table target depth"));
+          target_depths_[i] = target_depth;
+        }
+
+        Index default_target_depth;
+        CHECK_RESULT(
+            ReadIndex(&default_target_depth, "br_table default target depth"));
+
+        Index* target_depths = num_targets ? target_depths_.data() : nullptr;
+
+        CALLBACK(OnBrTableExpr, num_targets, target_depths,
+                 default_target_depth);
+        break;
+      }
+
+      case Opcode::Return:
+        CALLBACK0(OnReturnExpr);
+        CALLBACK0(OnOpcodeBare);
+        break;
+
+      case Opcode::Nop:
+        CALLBACK0(OnNopExpr);
+        CALLBACK0(OnOpcodeBare);
+        break;
+
+      case Opcode::Drop:
+        CALLBACK0(OnDropExpr);
+        CALLBACK0(OnOpcodeBare);
+        break;
+
+      case Opcode::End:
+        if (state_.offset == end_offset) {
+          seen_end_opcode = true;
+          CALLBACK0(OnEndFunc);
+        } else {
+          CALLBACK0(OnEndExpr);
+        }
+        break;
+
+      case Opcode::I32Const: {
+        uint32_t value;
+        CHECK_RESULT(ReadI32Leb128(&value, "i32.const value"));
+        CALLBACK(OnI32ConstExpr, value);
+        CALLBACK(OnOpcodeUint32, value);
+        break;
+      }
+
+      case Opcode::I64Const: {
+        uint64_t value;
+        CHECK_RESULT(ReadI64Leb128(&value, "i64.const value"));
+        CALLBACK(OnI64ConstExpr, value);
+        CALLBACK(OnOpcodeUint64, value);
+        break;
+      }
+
+      case Opcode::F32Const: {
+        uint32_t value_bits = 0;
+        CHECK_RESULT(ReadF32(&value_bits, "f32.const value"));
+        CALLBACK(OnF32ConstExpr, value_bits);
+        CALLBACK(OnOpcodeF32, value_bits);
+        break;
+      }
+
+      case Opcode::F64Const: {
+        uint64_t value_bits = 0;
+        CHECK_RESULT(ReadF64(&value_bits, "f64.const value"));
+        CALLBACK(OnF64ConstExpr, value_bits);
+        CALLBACK(OnOpcodeF64, value_bits);
+        break;
+      }
+
+      case Opcode::V128Const: {
+        v128 value_bits;
+        CHECK_RESULT(ReadV128(&value_bits, "v128.const value"));
+        CALLBACK(OnV128ConstExpr, value_bits);
+        CALLBACK(OnOpcodeV128, value_bits);
+        break;
+      }
+
+      case Opcode::GetGlobal: {
+        Index global_index;
+        CHECK_RESULT(ReadIndex(&global_index, "get_global global index"));
+        CALLBACK(OnGetGlobalExpr, global_index);
+        CALLBACK(OnOpcodeIndex, global_index);
+        break;
+      }
+
+      case Opcode::GetLocal: {
+        Index local_index;
+        CHECK_RESULT(ReadIndex(&local_index, "get_local local index"));
+        CALLBACK(OnGetLocalExpr, local_index);
+        CALLBACK(OnOpcodeIndex, local_index);
+        break;
+      }
+
+      case Opcode::SetGlobal: {
+        Index global_index;
+        CHECK_RESULT(ReadIndex(&global_index, "set_global global index"));
+        CALLBACK(OnSetGlobalExpr, global_index);
+        CALLBACK(OnOpcodeIndex, global_index);
+        break;
+      }
+
+      case Opcode::SetLocal: {
+        Index local_index;
+        CHECK_RESULT(ReadIndex(&local_index, "set_local local index"));
+        CALLBACK(OnSetLocalExpr, local_index);
+        CALLBACK(OnOpcodeIndex, local_index);
+        break;
+      }
+
+      case Opcode::Call: {
+        Index func_index;
+        CHECK_RESULT(ReadIndex(&func_index, "call function index"));
+        ERROR_UNLESS(func_index < NumTotalFuncs(),
+                     "invalid call function index: %" PRIindex, func_index);
+        CALLBACK(OnCallExpr, func_index);
+        CALLBACK(OnOpcodeIndex, func_index);
+        break;
+      }
+
+      case Opcode::CallIndirect: {
+        Index sig_index;
+        CHECK_RESULT(ReadIndex(&sig_index, "call_indirect signature index"));
+        ERROR_UNLESS(sig_index < num_signatures_,
+                     "invalid call_indirect signature index");
+        uint32_t reserved;
+        CHECK_RESULT(ReadU32Leb128(&reserved, "call_indirect reserved"));
+        ERROR_UNLESS(reserved == 0, "call_indirect reserved value must be 0");
+        CALLBACK(OnCallIndirectExpr, sig_index);
+        CALLBACK(OnOpcodeUint32Uint32, sig_index, reserved);
+        break;
+      }
+
+      case Opcode::ReturnCall: {
+        Index func_index;
+        CHECK_RESULT(ReadIndex(&func_index, "return_call function index"));
+        ERROR_UNLESS(func_index < NumTotalFuncs(),
+                     "invalid return_call function index: %" PRIindex,
+                     func_index);
+        CALLBACK(OnReturnCallExpr, func_index);
+        CALLBACK(OnOpcodeIndex, func_index);
+        break;
+      }
+
+      case Opcode::ReturnCallIndirect: {
+        Index sig_index;
+        CHECK_RESULT(
+            ReadIndex(&sig_index, "return_call_indirect signature index"));
+        ERROR_UNLESS(sig_index < num_signatures_,
+                     "invalid return_call_indirect signature index");
+        uint32_t reserved;
+        CHECK_RESULT(
+            ReadU32Leb128(&reserved, "return_call_indirect reserved"));
+        ERROR_UNLESS(reserved == 0,
+                     "return_call_indirect reserved value must be 0");
+        CALLBACK(OnReturnCallIndirectExpr, sig_index);
+        CALLBACK(OnOpcodeUint32Uint32, sig_index, reserved);
+        break;
+      }
+
+      case Opcode::TeeLocal: {
+        Index local_index;
+        CHECK_RESULT(ReadIndex(&local_index, "tee_local local index"));
+        CALLBACK(OnTeeLocalExpr, local_index);
+        CALLBACK(OnOpcodeIndex, local_index);
+        break;
+      }
+
+      case Opcode::I32Load8S:
+      case Opcode::I32Load8U:
+      case Opcode::I32Load16S:
+      case Opcode::I32Load16U:
+      case Opcode::I64Load8S:
+      case Opcode::I64Load8U:
+      case Opcode::I64Load16S:
+      case Opcode::I64Load16U:
+      case Opcode::I64Load32S:
+      case Opcode::I64Load32U:
+      case Opcode::I32Load:
+      case Opcode::I64Load:
+      case Opcode::F32Load:
+      case Opcode::F64Load:
+      case Opcode::V128Load: {
+        uint32_t alignment_log2;
+        CHECK_RESULT(ReadU32Leb128(&alignment_log2, "load alignment"));
+        Address offset;
+        CHECK_RESULT(ReadU32Leb128(&offset, "load offset"));
+
+        CALLBACK(OnLoadExpr, opcode, alignment_log2, offset);
+        CALLBACK(OnOpcodeUint32Uint32, alignment_log2, offset);
+        break;
+      }
+
+      case Opcode::I32Store8:
+      case Opcode::I32Store16:
+      case Opcode::I64Store8:
+      case Opcode::I64Store16:
+      case Opcode::I64Store32:
+      case Opcode::I32Store:
+      case Opcode::I64Store:
+      case Opcode::F32Store:
+      case Opcode::F64Store:
+      case Opcode::V128Store: {
+        uint32_t alignment_log2;
+        CHECK_RESULT(ReadU32Leb128(&alignment_log2, "store alignment"));
+        Address offset;
+        CHECK_RESULT(ReadU32Leb128(&offset, "store offset"));
+
+        CALLBACK(OnStoreExpr, opcode, alignment_log2, offset);
+        CALLBACK(OnOpcodeUint32Uint32, alignment_log2, offset);
+        break;
+      }
+
+      case Opcode::I32AtomicLoad:
+      case Opcode::I64AtomicLoad:
+      case Opcode::I32AtomicLoad8U:
+      case Opcode::I32AtomicLoad16U:
+      case Opcode::I64AtomicLoad8U:
+      case Opcode::I64AtomicLoad16U:
+      case Opcode::I64AtomicLoad32U: {
+        uint32_t alignment_log2;
+        CHECK_RESULT(ReadU32Leb128(&alignment_log2, "load alignment"));
+        Address offset;
+        CHECK_RESULT(ReadU32Leb128(&offset, "load offset"));
+
+        CALLBACK(OnAtomicLoadExpr, opcode, alignment_log2, offset);
+        CALLBACK(OnOpcodeUint32Uint32, alignment_log2, offset);
+        break;
+      }
+
+      case Opcode::I32AtomicStore:
+      case Opcode::I64AtomicStore:
+      case Opcode::I32AtomicStore8:
+      case Opcode::I32AtomicStore16:
+      case Opcode::I64AtomicStore8:
+      case Opcode::I64AtomicStore16:
+      case Opcode::I64AtomicStore32: {
+        uint32_t alignment_log2;
+        CHECK_RESULT(ReadU32Leb128(&alignment_log2, "store alignment"));
+        Address offset;
+        CHECK_RESULT(ReadU32Leb128(&offset, "store offset"));
+
+        CALLBACK(OnAtomicStoreExpr, opcode, alignment_log2, offset);
+        CALLBACK(OnOpcodeUint32Uint32, alignment_log2, offset);
+        break;
+      }
+
+      case Opcode::I32AtomicRmwAdd:
+      case Opcode::I64AtomicRmwAdd:
+      case Opcode::I32AtomicRmw8UAdd:
+      case Opcode::I32AtomicRmw16UAdd:
+      case Opcode::I64AtomicRmw8UAdd:
+      case Opcode::I64AtomicRmw16UAdd:
+      case Opcode::I64AtomicRmw32UAdd:
+      case Opcode::I32AtomicRmwSub:
+      case Opcode::I64AtomicRmwSub:
+      case Opcode::I32AtomicRmw8USub:
+      case Opcode::I32AtomicRmw16USub:
+      case Opcode::I64AtomicRmw8USub:
+      case Opcode::I64AtomicRmw16USub:
+      case Opcode::I64AtomicRmw32USub:
+      case Opcode::I32AtomicRmwAnd:
+      case Opcode::I64AtomicRmwAnd:
+      case Opcode::I32AtomicRmw8UAnd:
+      case Opcode::I32AtomicRmw16UAnd:
+      case Opcode::I64AtomicRmw8UAnd:
+      case Opcode::I64AtomicRmw16UAnd:
+      case Opcode::I64AtomicRmw32UAnd:
+      case Opcode::I32AtomicRmwOr:
+      case Opcode::I64AtomicRmwOr:
+      case Opcode::I32AtomicRmw8UOr:
+      case Opcode::I32AtomicRmw16UOr:
+      case Opcode::I64AtomicRmw8UOr:
+      case Opcode::I64AtomicRmw16UOr:
+      case Opcode::I64AtomicRmw32UOr:
+      case Opcode::I32AtomicRmwXor:
+      case Opcode::I64AtomicRmwXor:
+      case Opcode::I32AtomicRmw8UXor:
+      case Opcode::I32AtomicRmw16UXor:
+      case Opcode::I64AtomicRmw8UXor:
+      case Opcode::I64AtomicRmw16UXor:
+      case Opcode::I64AtomicRmw32UXor:
+      case Opcode::I32AtomicRmwXchg:
+      case Opcode::I64AtomicRmwXchg:
+      case Opcode::I32AtomicRmw8UXchg:
+      case Opcode::I32AtomicRmw16UXchg:
+      case Opcode::I64AtomicRmw8UXchg:
+      case Opcode::I64AtomicRmw16UXchg:
+      case Opcode::I64AtomicRmw32UXchg: {
+        uint32_t alignment_log2;
+        CHECK_RESULT(ReadU32Leb128(&alignment_log2, "memory alignment"));
+        Address offset;
+        CHECK_RESULT(ReadU32Leb128(&offset, "memory offset"));
+
+        CALLBACK(OnAtomicRmwExpr, opcode, alignment_log2, offset);
+        CALLBACK(OnOpcodeUint32Uint32, alignment_log2, offset);
+        break;
+      }
+
+      case Opcode::I32AtomicRmwCmpxchg:
+      case Opcode::I64AtomicRmwCmpxchg:
+      case Opcode::I32AtomicRmw8UCmpxchg:
+      case Opcode::I32AtomicRmw16UCmpxchg:
+      case Opcode::I64AtomicRmw8UCmpxchg:
+      case Opcode::I64AtomicRmw16UCmpxchg:
+      case Opcode::I64AtomicRmw32UCmpxchg: {
+        uint32_t alignment_log2;
+        CHECK_RESULT(ReadU32Leb128(&alignment_log2, "memory alignment"));
+        Address offset;
+        CHECK_RESULT(ReadU32Leb128(&offset, "memory offset"));
+
+        CALLBACK(OnAtomicRmwCmpxchgExpr, opcode, alignment_log2, offset);
+        CALLBACK(OnOpcodeUint32Uint32, alignment_log2, offset);
+        break;
+      }
+
+      case Opcode::MemoryAtomicWait32:
+      case Opcode::MemoryAtomicWait64: {
+        uint32_t alignment_log2;
+        CHECK_RESULT(ReadU32Leb128(&alignment_log2, "memory alignment"));
+        Address offset;
+        CHECK_RESULT(ReadU32Leb128(&offset, "memory offset"));
+
+        CALLBACK(OnAtomicWaitExpr, opcode, alignment_log2, offset);
+        CALLBACK(OnOpcodeUint32Uint32, alignment_log2, offset);
+        break;
+      }
+
+      case Opcode::MemoryAtomicNotify: {
+        uint32_t alignment_log2;
+        CHECK_RESULT(ReadU32Leb128(&alignment_log2, "memory alignment"));
+        Address offset;
+        CHECK_RESULT(ReadU32Leb128(&offset, "memory offset"));
+
+        CALLBACK(OnAtomicNotifyExpr, opcode, alignment_log2, offset);
+        CALLBACK(OnOpcodeUint32Uint32, alignment_log2, offset);
+        break;
+      }
+
+      case Opcode::CurrentMemory: {
+        uint32_t reserved;
+        CHECK_RESULT(ReadU32Leb128(&reserved, "current_memory reserved"));
+        ERROR_UNLESS(reserved == 0, "current_memory reserved value must be 0");
+        CALLBACK0(OnCurrentMemoryExpr);
+        CALLBACK(OnOpcodeUint32, reserved);
+        break;
+      }
+
+      case Opcode::GrowMemory: {
+        uint32_t reserved;
+        CHECK_RESULT(ReadU32Leb128(&reserved, "grow_memory reserved"));
+        ERROR_UNLESS(reserved == 0, "grow_memory reserved value must be 0");
+        CALLBACK0(OnGrowMemoryExpr);
+        CALLBACK(OnOpcodeUint32, reserved);
+        break;
+      }
+
+      case Opcode::MemoryCopy: {
+        uint32_t reserved;
+        CHECK_RESULT(ReadU32Leb128(&reserved, "memory.copy dst reserved"));
+        ERROR_UNLESS(reserved == 0, "memory.copy reserved value must be 0");
+        CHECK_RESULT(ReadU32Leb128(&reserved, "memory.copy src reserved"));
+        ERROR_UNLESS(reserved == 0, "memory.copy reserved value must be 0");
+        CALLBACK0(OnMemoryCopyExpr);
+        CALLBACK(OnOpcodeUint32Uint32, 0, 0);
+        break;
+      }
+
+      case Opcode::MemoryFill: {
+        uint32_t reserved;
+        CHECK_RESULT(ReadU32Leb128(&reserved, "memory.fill reserved"));
+        ERROR_UNLESS(reserved == 0, "memory.fill reserved value must be 0");
+        CALLBACK0(OnMemoryFillExpr);
+        CALLBACK(OnOpcodeUint32, reserved);
+        break;
+      }
+
+      case Opcode::I32Add:
+      case Opcode::I32Sub:
+      case Opcode::I32Mul:
+      case Opcode::I32DivS:
+      case Opcode::I32DivU:
+      case Opcode::I32RemS:
+      case Opcode::I32RemU:
+      case Opcode::I32And:
+      case Opcode::I32Or:
+      case Opcode::I32Xor:
+      case Opcode::I32Shl:
+      case Opcode::I32ShrU:
+      case Opcode::I32ShrS:
+      case Opcode::I32Rotr:
+      case Opcode::I32Rotl:
+      case Opcode::I64Add:
+      case Opcode::I64Sub:
+      case Opcode::I64Mul:
+      case Opcode::I64DivS:
+      case Opcode::I64DivU:
+      case Opcode::I64RemS:
+      case Opcode::I64RemU:
+      case Opcode::I64And:
+      case Opcode::I64Or:
+      case Opcode::I64Xor:
+      case Opcode::I64Shl:
+      case Opcode::I64ShrU:
+      case Opcode::I64ShrS:
+      case Opcode::I64Rotr:
+      case Opcode::I64Rotl:
+      case Opcode::F32Add:
+      case Opcode::F32Sub:
+      case Opcode::F32Mul:
+      case Opcode::F32Div:
+      case Opcode::F32Min:
+      case Opcode::F32Max:
+      case Opcode::F32Copysign:
+      case Opcode::F64Add:
+      case Opcode::F64Sub:
+      case Opcode::F64Mul:
+      case Opcode::F64Div:
+      case Opcode::F64Min:
+      case Opcode::F64Max:
+      case Opcode::F64Copysign:
+      case Opcode::V128And:
+      case Opcode::V128Andnot:
+      case Opcode::V128Or:
+      case Opcode::V128Xor:
+      case Opcode::I8X16Add:
+      case Opcode::I8X16Sub:
+      case Opcode::I16X8Add:
+      case Opcode::I16X8Sub:
+      case Opcode::I16X8Mul:
+      case Opcode::I32X4Add:
+      case Opcode::I32X4Sub:
+      case Opcode::I32X4Mul:
+      case Opcode::I64X2Add:
+      case Opcode::I64X2Sub:
+      case Opcode::I64X2Mul:
+      case Opcode::F32X4Add:
+      case Opcode::F32X4Sub:
+      case Opcode::F32X4Mul:
+      case Opcode::F32X4Div:
+      case Opcode::F64X2Add:
+      case Opcode::F64X2Sub:
+      case Opcode::F64X2Mul:
+      case Opcode::F64X2Div:
+        CALLBACK(OnBinaryExpr, opcode);
+        CALLBACK0(OnOpcodeBare);
+        break;
+
+      case Opcode::I32Eq:
+      case Opcode::I32Ne:
+      case Opcode::I32LtS:
+      case Opcode::I32LeS:
+      case Opcode::I32LtU:
+      case Opcode::I32LeU:
+      case Opcode::I32GtS:
+      case Opcode::I32GeS:
+      case Opcode::I32GtU:
+      case Opcode::I32GeU:
+      case Opcode::I64Eq:
+      case Opcode::I64Ne:
+      case Opcode::I64LtS:
+      case Opcode::I64LeS:
+      case Opcode::I64LtU:
+      case Opcode::I64LeU:
+      case Opcode::I64GtS:
+      case Opcode::I64GeS:
+      case Opcode::I64GtU:
+      case Opcode::I64GeU:
+      case Opcode::F32Eq:
+      case Opcode::F32Ne:
+      case Opcode::F32Lt:
+      case Opcode::F32Le:
+      case Opcode::F32Gt:
+      case Opcode::F32Ge:
+      case Opcode::F64Eq:
+      case Opcode::F64Ne:
+      case Opcode::F64Lt:
+      case Opcode::F64Le:
+      case Opcode::F64Gt:
+      case Opcode::F64Ge:
+        CALLBACK(OnCompareExpr, opcode);
+        CALLBACK0(OnOpcodeBare);
+        break;
+
+      case Opcode::I32Clz:
+      case Opcode::I32Ctz:
+      case Opcode::I32Popcnt:
+      case Opcode::I64Clz:
+      case Opcode::I64Ctz:
+      case Opcode::I64Popcnt:
+      case Opcode::F32Abs:
+      case Opcode::F32Neg:
+      case Opcode::F32Ceil:
+      case Opcode::F32Floor:
+      case Opcode::F32Trunc:
+      case Opcode::F32Nearest:
+      case Opcode::F32Sqrt:
+      case Opcode::F64Abs:
+      case Opcode::F64Neg:
+      case Opcode::F64Ceil:
+      case Opcode::F64Floor:
+      case Opcode::F64Trunc:
+      case Opcode::F64Nearest:
+      case Opcode::F64Sqrt:
+      case Opcode::V128Not:
+      case Opcode::I8X16Splat:
+      case Opcode::I16X8Splat:
+      case Opcode::I32X4Splat:
+      case Opcode::I64X2Splat:
+      case Opcode::F32X4Splat:
+      case Opcode::F64X2Splat:
+        CALLBACK(OnUnaryExpr, opcode);
+        CALLBACK0(OnOpcodeBare);
+        break;
+
+      case Opcode::I32X4ExtractLane:
+      case Opcode::I32X4ReplaceLane:
+      case Opcode::I64X2ExtractLane:
+      case Opcode::I64X2ReplaceLane:
+      case Opcode::F32X4ExtractLane:
+      case Opcode::F32X4ReplaceLane:
+      case Opcode::F64X2ExtractLane:
+      case Opcode::F64X2ReplaceLane: {
+        uint8_t lane;
+        CHECK_RESULT(ReadU8(&lane, "lane index"));
+        CALLBACK(OnSimdLaneOpExpr, opcode, lane);
+        CALLBACK(OnOpcodeUint32, lane);
+        break;
+      }
+
+      case Opcode::I32TruncSF32:
+      case Opcode::I32TruncSF64:
+      case Opcode::I32TruncUF32:
+      case Opcode::I32TruncUF64:
+      case Opcode::I32WrapI64:
+      case Opcode::I64TruncSF32:
+      case Opcode::I64TruncSF64:
+      case Opcode::I64TruncUF32:
+      case Opcode::I64TruncUF64:
+      case Opcode::I64ExtendSI32:
+      case Opcode::I64ExtendUI32:
+      case Opcode::F32ConvertSI32:
+      case Opcode::F32ConvertUI32:
+      case Opcode::F32ConvertSI64:
+      case Opcode::F32ConvertUI64:
+      case Opcode::F32DemoteF64:
+      case Opcode::F32ReinterpretI32:
+      case Opcode::F64ConvertSI32:
+      case Opcode::F64ConvertUI32:
+      case Opcode::F64ConvertSI64:
+      case Opcode::F64ConvertUI64:
+      case Opcode::F64PromoteF32:
+      case Opcode::F64ReinterpretI64:
+      case Opcode::I32ReinterpretF32:
+      case Opcode::I64ReinterpretF64:
+      case Opcode::I32Eqz:
+      case Opcode::I64Eqz:
+        CALLBACK(OnConvertExpr, opcode);
+        CALLBACK0(OnOpcodeBare);
+        break;
+
+      case Opcode::Try: {
+        ERROR_UNLESS_FUTURE_EXCEPTIONS_OPCODE(opcode);
+        CHECK_RESULT(
+            ReadBlockSignature(&block_sig_types_, "try signature type"));
+        Index num_types = block_sig_types_.size();
+        Type* sig_types = DataOrNull(block_sig_types_);
+        CALLBACK(OnTryExpr, num_types, sig_types);
+        CALLBACK(OnOpcodeBlockSig, num_types, sig_types);
+        break;
+      }
+
+      case Opcode::Catch: {
+        ERROR_UNLESS_FUTURE_EXCEPTIONS_OPCODE(opcode);
+        Index index;
+        CHECK_RESULT(ReadIndex(&index, "exception index"));
+        CALLBACK(OnCatchExpr, index);
+        CALLBACK(OnOpcodeIndex, index);
+        break;
+      }
+
+      case Opcode::CatchAll: {
+        ERROR_UNLESS_FUTURE_EXCEPTIONS_OPCODE(opcode);
+        CALLBACK(OnCatchAllExpr);
+        CALLBACK0(OnOpcodeBare);
+        break;
+      }
+
+      case Opcode::Rethrow: {
+        ERROR_UNLESS_FUTURE_EXCEPTIONS_OPCODE(opcode);
+        Index depth;
+        CHECK_RESULT(ReadIndex(&depth, "catch depth"));
+        CALLBACK(OnRethrowExpr, depth);
+        CALLBACK(OnOpcodeIndex, depth);
+        break;
+      }
+
+      case Opcode::Throw: {
+        ERROR_UNLESS_FUTURE_EXCEPTIONS_OPCODE(opcode);
+        Index index;
+        CHECK_RESULT(ReadIndex(&index, "exception index"));
+        CALLBACK(OnThrowExpr, index);
+        CALLBACK(OnOpcodeIndex, index);
+        break;
+      }
+
+      default:
+        return ReportUnexpectedOpcode(opcode);
+    }
+  }
+  ERROR_UNLESS(state_.offset == end_offset,
+               "function body longer than given size");
+  ERROR_UNLESS(seen_end_opcode, "function body must end with END opcode");
+  return Result::Ok;
+}
+
+template <typename Delegate>
+Result BinaryReaderT<Delegate>::ReadNamesSection(Offset section_size) {
+  CALLBACK(BeginNamesSection, section_size);
+  Index i = 0;
+  Offset previous_read_end = read_end_;
+  uint32_t previous_subsection_type = 0;
+  while (state_.offset < read_end_) {
+    uint32_t name_type;
+    Offset subsection_size;
+    CHECK_RESULT(ReadU32Leb128(&name_type, "name type"));
+    if (i != 0) {
+      ERROR_UNLESS(name_type != previous_subsection_type,
+                   "duplicate sub-section");
+      ERROR_UNLESS(name_type >= previous_subsection_type,
+                   "out-of-order sub-section");
+    }
+    previous_subsection_type = name_type;
+    CHECK_RESULT(ReadOffset(&subsection_size, "subsection size"));
+    size_t subsection_end = state_.offset + subsection_size;
+    ERROR_UNLESS(subsection_end <= read_end_,
+                 "invalid sub-section size: extends past end");
+    read_end_ = subsection_end;
+
+    switch (static_cast<NameSectionSubsection>(name_type)) {
+      case NameSectionSubsection::Function:
+        CALLBACK(OnFunctionNameSubsection, i, name_type, subsection_size);
+        if (subsection_size) {
+          Index num_names;
+          CHECK_RESULT(ReadIndex(&num_names, "name count"));
+          CALLBACK(OnFunctionNamesCount, num_names);
+          Index last_function_index = kInvalidIndex;
+
+          for (Index j = 0; j < num_names; ++j) {
+            Index function_index;
+            string_view function_name;
+
+            CHECK_RESULT(ReadIndex(&function_index, "function index"));
+            ERROR_UNLESS(function_index != last_function_index,
+                         "duplicate function name: %u", function_index);
+            ERROR_UNLESS(last_function_index == kInvalidIndex ||
+                             function_index > last_function_index,
+                         "function index out of order: %u", function_index);
+            last_function_index = function_index;
+            ERROR_UNLESS(function_index < NumTotalFuncs(),
+                         "invalid function index: %" PRIindex, function_index);
+            CHECK_RESULT(ReadStr(&function_name, "function name"));
+            CALLBACK(OnFunctionName, function_index, function_name);
+          }
+        }
+        break;
+      case NameSectionSubsection::Local:
+        CALLBACK(OnLocalNameSubsection, i, name_type, subsection_size);
+        if (subsection_size) {
+          Index num_funcs;
+          CHECK_RESULT(ReadIndex(&num_funcs, "function count"));
+          CALLBACK(OnLocalNameFunctionCount, num_funcs);
+          Index last_function_index = kInvalidIndex;
+          for (Index j = 0; j < num_funcs; ++j) {
+            Index function_index;
+            CHECK_RESULT(ReadIndex(&function_index, "function index"));
+            ERROR_UNLESS(function_index < NumTotalFuncs(),
+                         "invalid function index: %u", function_index);
+            ERROR_UNLESS(last_function_index == kInvalidIndex ||
+                             function_index > last_function_index,
+                         "locals function index out of order: %u",
+                         function_index);
+            last_function_index = function_index;
+            Index num_locals;
+            CHECK_RESULT(ReadIndex(&num_locals, "local count"));
+            CALLBACK(OnLocalNameLocalCount, function_index, num_locals);
+            Index last_local_index = kInvalidIndex;
+            for (Index k = 0; k < num_locals; ++k) {
+              Index local_index;
+              string_view local_name;
+
+              CHECK_RESULT(ReadIndex(&local_index, "named index"));
+              ERROR_UNLESS(local_index != last_local_index,
+                           "duplicate local index: %u", local_index);
+              ERROR_UNLESS(last_local_index == kInvalidIndex ||
+                               local_index > last_local_index,
+                           "local index out of order: %u", local_index);
+              last_local_index = local_index;
+              CHECK_RESULT(ReadStr(&local_name, "name"));
+              CALLBACK(OnLocalName, function_index, local_index, local_name);
+            }
+          }
+        }
+        break;
+      default:
+        /* unknown subsection, skip it */
+        state_.offset = subsection_end;
+        break;
+    }
+    ++i;
+    ERROR_UNLESS(state_.offset == subsection_end,
+                 "unfinished sub-section (expected end: 0x%" PRIzx ")",
+                 subsection_end);
+    read_end_ = previous_read_end;
+  }
+  CALLBACK0(EndNamesSection);
+  return Result::Ok;
+}
+
+template <typename Delegate>
+Result BinaryReaderT<Delegate>::ReadRelocSection(Offset section_size) {
+  CALLBACK(BeginRelocSection, section_size);
+  uint32_t section;
+  CHECK_RESULT(ReadU32Leb128(&section, "section"));
+  string_view section_name;
+  if (static_cast<BinarySection>(section) == BinarySection::Custom)
+    CHECK_RESULT(ReadStr(&section_name, "section name"));
+  Index num_relocs;
+  CHECK_RESULT(ReadIndex(&num_relocs, "relocation count"));
+  CALLBACK(OnRelocCount, num_relocs, static_cast<BinarySection>(section),
+           section_name);
+  for (Index i = 0; i < num_relocs; ++i) {
+    Offset offset;
+    Index index;
+    uint32_t reloc_type, addend = 0;
+    CHECK_RESULT(ReadU32Leb128(&reloc_type, "relocation type"));
+    CHECK_RESULT(ReadOffset(&offset, "offset"));
+    CHECK_RESULT(ReadIndex(&index, "index"));
+    RelocType type = static_cast<RelocType>(reloc_type);
+    switch (type) {
+      case RelocType::GlobalAddressLEB:
+      case RelocType::GlobalAddressSLEB:
+      case RelocType::GlobalAddressI32:
+        CHECK_RESULT(ReadI32Leb128(&addend, "addend"));
+        break;
+      default:
+        break;
+    }
+    CALLBACK(OnReloc, type, offset, index, addend);
+  }
+  CALLBACK0(EndRelocSection);
+  return Result::Ok;
+}
+
+template <typename Delegate>
+Result BinaryReaderT<Delegate>::ReadLinkingSection(Offset section_size) {
+  CALLBACK(BeginLinkingSection, section_size);
+  Offset previous_read_end = read_end_;
+  while (state_.offset < read_end_) {
+    uint32_t linking_type;
+    Offset subsection_size;
+    CHECK_RESULT(ReadU32Leb128(&linking_type, "type"));
+    CHECK_RESULT(ReadOffset(&subsection_size, "subsection size"));
+    size_t subsection_end = state_.offset + subsection_size;
+    ERROR_UNLESS(subsection_end <= read_end_,
+                 "invalid sub-section size: extends past end");
+    read_end_ = subsection_end;
+
+    switch (static_cast<LinkingEntryType>(linking_type)) {
+      case LinkingEntryType::StackPointer: {
+        uint32_t stack_ptr;
+        CHECK_RESULT(ReadU32Leb128(&stack_ptr, "stack pointer index"));
+        CALLBACK(OnStackGlobal, stack_ptr);
+        break;
+      }
+      case LinkingEntryType::SymbolInfo: {
+        uint32_t info_count;
+        CHECK_RESULT(ReadU32Leb128(&info_count, "info count"));
+        CALLBACK(OnSymbolInfoCount, info_count);
+        while (info_count--) {
+          string_view name;
+          uint32_t info;
+          CHECK_RESULT(ReadStr(&name, "symbol name"));
+          CHECK_RESULT(ReadU32Leb128(&info, "sym flags"));
+          CALLBACK(OnSymbolInfo, name, info);
+        }
+        break;
+      }
+      default:
+        /* unknown subsection, skip it */
+        state_.offset = subsection_end;
+        break;
+    }
+    ERROR_UNLESS(state_.offset == subsection_end,
+                 "unfinished sub-section (expected end: 0x%" PRIzx ")",
+                 subsection_end);
+    read_end_ = previous_read_end;
+  }
+  CALLBACK0(EndLinkingSection);
+  return Result::Ok;
+}
+
+template <typename Delegate>
+Result BinaryReaderT<Delegate>::ReadExceptionType(TypeVector& sig) {
+  Index num_values;
+  CHECK_RESULT(ReadIndex(&num_values, "exception type count"));
+  sig.resize(num_values);
+  for (Index j = 0; j < num_values; ++j) {
+    Type value_type;
+    CHECK_RESULT(ReadType(&value_type, "exception value type"));
+    ERROR_UNLESS(IsConcreteType(value_type),
+                 "excepted valid exception value type (got %d)",
+                 static_cast<int>(value_type));
+    sig[j] = value_type;
+  }
+  return Result::Ok;
+}
+
+template <typename Delegate>
+Result BinaryReaderT<Delegate>::ReadExceptionSection(Offset section_size) {
+  CALLBACK(BeginExceptionSection, section_size);
+  CHECK_RESULT(ReadIndex(&num_exceptions_, "exception count"));
+  CALLBACK(OnExceptionCount, num_exceptions_);
+
+  for (Index i = 0; i < num_exceptions_; ++i) {
+    TypeVector sig;
+    CHECK_RESULT(ReadExceptionType(sig));
+    CALLBACK(OnExceptionType, i, sig);
+  }
+
+  CALLBACK(EndExceptionSection);
+  return Result::Ok;
+}
+
+template <typename Delegate>
+Result BinaryReaderT<Delegate>::ReadCustomSection(Offset section_size) {
+  string_view section_name;
+  CHECK_RESULT(ReadStr(&section_name, "section name"));
+  CALLBACK(BeginCustomSection, section_size, section_name);
+
+  bool name_section_ok = last_known_section_ >= BinarySection::Import;
+  if (options_->read_debug_names && name_section_ok &&
+      section_name == WABT_BINARY_SECTION_NAME) {
+    if (options_->skip_bad_names) {
+      Offset section_end = read_end_;
+      suppress_errors_ = true;
+      Result result = ReadNamesSection(section_size);
+      suppress_errors_ = false;
+      if (Failed(result)) {
+        read_end_ = section_end;
+        state_.offset = section_end;
+      }
+    } else {
+      CHECK_RESULT(ReadNamesSection(section_size));
+    }
+  } else if (section_name.rfind(WABT_BINARY_SECTION_RELOC, 0) == 0) {
+    // Reloc sections always begin with "reloc."
+    CHECK_RESULT(ReadRelocSection(section_size));
+  } else if (section_name == WABT_BINARY_SECTION_LINKING) {
+    CHECK_RESULT(ReadLinkingSection(section_size));
+  } else if (options_->allow_future_exceptions &&
+             section_name == WABT_BINARY_SECTION_EXCEPTION) {
+    CHECK_RESULT(ReadExceptionSection(section_size));
+  } else {
+    /* This is an unknown custom section, skip it. */
+    state_.offset = read_end_;
+  }
+  CALLBACK0(EndCustomSection);
+  return Result::Ok;
+}
+
+template <typename Delegate>
+Result BinaryReaderT<Delegate>::ReadTypeSection(Offset section_size) {
+  CALLBACK(BeginTypeSection, section_size);
+  CHECK_RESULT(ReadIndex(&num_signatures_, "type count"));
+  CALLBACK(OnTypeCount, num_signatures_);
+
+  for (Index i = 0; i < num_signatures_; ++i) {
+    Type form;
+    CHECK_RESULT(ReadType(&form, "type form"));
+    ERROR_UNLESS(form == Type::Func, "unexpected type form: %d",
+                 static_cast<int>(form));
+
+    Index num_params;
+    CHECK_RESULT(ReadIndex(&num_params, "function param count"));
+
+    param_types_.resize(num_params);
+
+    for (Index j = 0; j < num_params; ++j) {
+      Type param_type;
+      CHECK_RESULT(ReadType(&param_type, "function param type"));
+      ERROR_UNLESS(IsConcreteType(param_type),
+                   "expected valid param type (got %d)",
+                   static_cast<int>(param_type));
+      param_types_[j] = param_type;
+    }
+
+    Index num_results;
+    CHECK_RESULT(ReadIndex(&num_results, "function result count"));
+    ERROR_UNLESS(num_results <= 1 || options_->allow_future_multi_value,
+                 "result count must be 0 or 1");
+
+    result_types_.resize(num_results);
+    for (Index j = 0; j < num_results; ++j) {
+      Type result_type;
+      CHECK_RESULT(ReadType(&result_type, "function result type"));
+      ERROR_UNLESS(IsConcreteType(result_type),
+                   "expected valid result type: %d",
+                   static_cast<int>(result_type));
+      result_types_[j] = result_type;
+    }
+
+    Type* param_types = num_params ? param_types_.data() : nullptr;
+    Type* result_types = num_results ? result_types_.data() : nullptr;
+    signatures_.push_back(Signature{num_params, result_types_});
+
+    CALLBACK(OnType, i, num_params, param_types, num_results, result_types);
+  }
+  CALLBACK0(EndTypeSection);
+  return Result::Ok;
+}
+
+template <typename Delegate>
+Result BinaryReaderT<Delegate>::ReadImportSection(Offset section_size) {
+  CALLBACK(BeginImportSection, section_size);
+  CHECK_RESULT(ReadIndex(&num_imports_, "import count"));
+  CALLBACK(OnImportCount, num_imports_);
+  for (Index i = 0; i < num_imports_; ++i) {
+    string_view module_name;
+    CHECK_RESULT(ReadStr(&module_name, "import module name"));
+    string_view field_name;
+    CHECK_RESULT(ReadStr(&field_name, "import field name"));
+
+    uint32_t kind;
+    CHECK_RESULT(ReadU32Leb128(&kind, "import kind"));
+    switch (static_cast<ExternalKind>(kind)) {
+      case ExternalKind::Func: {
+        Index sig_index;
+        CHECK_RESULT(ReadIndex(&sig_index, "import signature index"));
+        ERROR_UNLESS(sig_index < num_signatures_,
+                     "invalid import signature index");
+        CALLBACK(OnImport, i, module_name, field_name);
+        CALLBACK(OnImportFunc, i, module_name, field_name, num_func_imports_,
+                 sig_index);
+        num_func_imports_++;
+        break;
+      }
+
+      case ExternalKind::Table: {
+        Type elem_type;
+        Limits elem_limits;
+        CHECK_RESULT(ReadTable(&elem_type, &elem_limits));
+        CALLBACK(OnImport, i, module_name, field_name);
+        CALLBACK(OnImportTable, i, module_name, field_name, num_table_imports_,
+                 elem_type, &elem_limits);
+        num_table_imports_++;
+        break;
+      }
+
+      case ExternalKind::Memory: {
+        Limits page_limits;
+        CHECK_RESULT(ReadMemory(&page_limits));
+        CALLBACK(OnImport, i, module_name, field_name);
+        CALLBACK(OnImportMemory, i, module_name, field_name,
+                 num_memory_imports_, &page_limits);
+        num_memory_imports_++;
+        break;
+      }
+
+      case ExternalKind::Global: {
+        Type type;
+        bool mutable_;
+        CHECK_RESULT(ReadGlobalHeader(&type, &mutable_));
+        CALLBACK(OnImport, i, module_name, field_name);
+        CALLBACK(OnImportGlobal, i, module_name, field_name,
+                 num_global_imports_, type, mutable_);
+        num_global_imports_++;
+        break;
+      }
+
+      case ExternalKind::Except: {
+        if (!options_->allow_future_exceptions)
+          PrintError("invalid import exception kind: exceptions not allowed");
+        TypeVector sig;
+        CHECK_RESULT(ReadExceptionType(sig));
+        CALLBACK(OnImport, i, module_name, field_name);
+        CALLBACK(OnImportException, i, module_name, field_name,
+                 num_exception_imports_, sig);
+        num_exception_imports_++;
+        break;
+      }
+
+      default:
+        PrintError("invalid import kind: %d", kind);
+        return Result::Error;
+    }
+  }
+  CALLBACK0(EndImportSection);
+  return Result::Ok;
+}
+
+template <typename Delegate>
+Result BinaryReaderT<Delegate>::ReadFunctionSection(Offset section_size) {
+  CALLBACK(BeginFunctionSection, section_size);
+  CHECK_RESULT(
+      ReadIndex(&num_function_signatures_, "function signature count"));
+  CALLBACK(OnFunctionCount, num_function_signatures_);
+  for (Index i = 0; i < num_function_signatures_; ++i) {
+    Index func_index = num_func_imports_ + i;
+    Index sig_index;
+    CHECK_RESULT(ReadIndex(&sig_index, "function signature index"));
+    ERROR_UNLESS(sig_index < num_signatures_,
+                 "invalid function signature index: %" PRIindex, sig_index);
+    CALLBACK(OnFunction, func_index, sig_index);
+  }
+  CALLBACK0(EndFunctionSection);
+  return Result::Ok;
+}
+
+template <typename Delegate>
+Result BinaryReaderT<Delegate>::ReadTableSection(Offset section_size) {
+  CALLBACK(BeginTableSection, section_size);
+  CHECK_RESULT(ReadIndex(&num_tables_, "table count"));
+  ERROR_UNLESS(num_tables_ <= 1, "table count (%" PRIindex ") must be 0 or 1",
+               num_tables_);
+  CALLBACK(OnTableCount, num_tables_);
+  for (Index i = 0; i < num_tables_; ++i) {
+    Index table_index = num_table_imports_ + i;
+    Type elem_type;
+    Limits elem_limits;
+    CHECK_RESULT(ReadTable(&elem_type, &elem_limits));
+    CALLBACK(OnTable, table_index, elem_type, &elem_limits);
+  }
+  CALLBACK0(EndTableSection);
+  return Result::Ok;
+}
+
+template <typename Delegate>
+Result BinaryReaderT<Delegate>::ReadMemorySection(Offset section_size) {
+  CALLBACK(BeginMemorySection, section_size);
+  CHECK_RESULT(ReadIndex(&num_memories_, "memory count"));
+  ERROR_UNLESS(num_memories_ <= 1, "memory count must be 0 or 1");
+  CALLBACK(OnMemoryCount, num_memories_);
+  for (Index i = 0; i < num_memories_; ++i) {
+    Index memory_index = num_memory_imports_ + i;
+    Limits page_limits;
+    CHECK_RESULT(ReadMemory(&page_limits));
+    CALLBACK(OnMemory, memory_index, &page_limits);
+  }
+  CALLBACK0(EndMemorySection);
+  return Result::Ok;
+}
+
+template <typename Delegate>
+Result BinaryReaderT<Delegate>::ReadGlobalSection(Offset section_size) {
+  CALLBACK(BeginGlobalSection, section_size);
+  CHECK_RESULT(ReadIndex(&num_globals_, "global count"));
+  CALLBACK(OnGlobalCount, num_globals_);
+  for (Index i = 0; i < num_globals_; ++i) {
+    Index global_index = num_global_imports_ + i;
+    Type global_type;
+    bool mutable_;
+    CHECK_RESULT(ReadGlobalHeader(&global_type, &mutable_));
+    CALLBACK(BeginGlobal, global_index, global_type, mutable_);
+    CALLBACK(BeginGlobalInitExpr, global_index);
+    CHECK_RESULT(ReadInitExpr(global_index));
+    CALLBACK(EndGlobalInitExpr, global_index);
+    CALLBACK(EndGlobal, global_index);
+  }
+  CALLBACK0(EndGlobalSection);
+  return Result::Ok;
+}
+
+template <typename Delegate>
+Result BinaryReaderT<Delegate>::ReadExportSection(Offset section_size) {
+  CALLBACK(BeginExportSection, section_size);
+  CHECK_RESULT(ReadIndex(&num_exports_, "export count"));
+  CALLBACK(OnExportCount, num_exports_);
+  for (Index i = 0; i < num_exports_; ++i) {
+    string_view name;
+    CHECK_RESULT(ReadStr(&name, "export item name"));
+
+    uint8_t external_kind = 0;
+    CHECK_RESULT(ReadU8(&external_kind, "export external kind"));
+    ERROR_UNLESS(is_valid_external_kind(external_kind),
+                 "invalid export external kind: %d", external_kind);
+
+    Index item_index;
+    CHECK_RESULT(ReadIndex(&item_index, "export item index"));
+    switch (static_cast<ExternalKind>(external_kind)) {
+      case ExternalKind::Func:
+        ERROR_UNLESS(item_index < NumTotalFuncs(),
+                     "invalid export func index: %" PRIindex, item_index);
+        break;
+      case ExternalKind::Table:
+        ERROR_UNLESS(item_index < NumTotalTables(),
+                     "invalid export table index: %" PRIindex, item_index);
+        break;
+      case ExternalKind::Memory:
+        ERROR_UNLESS(item_index < NumTotalMemories(),
+                     "invalid export memory index: %" PRIindex, item_index);
+        break;
+      case ExternalKind::Global:
+        ERROR_UNLESS(item_index < NumTotalGlobals(),
+                     "invalid export global index: %" PRIindex, item_index);
+        break;
+      case ExternalKind::Except:
+        // Note: Can't check if index valid, exceptions section comes later.
+        if (!options_->allow_future_exceptions)
+          PrintError("invalid export exception kind: exceptions not allowed");
+        break;
+    }
+
+    CALLBACK(OnExport, i, static_cast<ExternalKind>(external_kind), item_index,
+             name);
+  }
+  CALLBACK0(EndExportSection);
+  return Result::Ok;
+}
+
+template <typename Delegate>
+Result BinaryReaderT<Delegate>::ReadStartSection(Offset section_size) {
+  CALLBACK(BeginStartSection, section_size);
+  Index func_index;
+  CHECK_RESULT(ReadIndex(&func_index, "start function index"));
+  ERROR_UNLESS(func_index < NumTotalFuncs(),
+               "invalid start function index: %" PRIindex, func_index);
+  CALLBACK(OnStartFunction, func_index);
+  CALLBACK0(EndStartSection);
+  return Result::Ok;
+}
+
+template <typename Delegate>
+Result BinaryReaderT<Delegate>::ReadElemSection(Offset section_size) {
+  CALLBACK(BeginElemSection, section_size);
+  Index num_elem_segments;
+  CHECK_RESULT(ReadIndex(&num_elem_segments, "elem segment count"));
+  CALLBACK(OnElemSegmentCount, num_elem_segments);
+  ERROR_UNLESS(num_elem_segments == 0 || NumTotalTables() > 0,
+               "elem section without table section");
+  for (Index i = 0; i < num_elem_segments; ++i) {
+    Index table_index;
+    CHECK_RESULT(ReadIndex(&table_index, "elem segment table index"));
+    CALLBACK(BeginElemSegment, i, table_index);
+    CALLBACK(BeginElemSegmentInitExpr, i);
+    CHECK_RESULT(ReadInitExpr(i));
+    CALLBACK(EndElemSegmentInitExpr, i);
+
+    Index num_function_indexes;
+    CHECK_RESULT(
+        ReadIndex(&num_function_indexes, "elem segment function index count"));
+    CALLBACK(OnElemSegmentFunctionIndexCount, i, num_function_indexes);
+    for (Index j = 0; j < num_function_indexes; ++j) {
+      Index func_index;
+      CHECK_RESULT(ReadIndex(&func_index, "elem segment function index"));
+      CALLBACK(OnElemSegmentFunctionIndex, i, func_index);
+    }
+    CALLBACK(EndElemSegment, i);
+  }
+  CALLBACK0(EndElemSection);
+  return Result::Ok;
+}
+
+template <typename Delegate>
+Result BinaryReaderT<Delegate>::ReadCodeSectionHeader(Offset section_size) {
+  CALLBACK(BeginCodeSection, section_size);
+  CHECK_RESULT(ReadIndex(&num_function_bodies_, "function body count"));
+  ERROR_UNLESS(num_function_signatures_ == num_function_bodies_,
+               "function signature count != function body count");
+  CALLBACK(OnFunctionBodyCount, num_function_bodies_);
+  return Result::Ok;
+}
+
+template <typename Delegate>
+Result BinaryReaderT<Delegate>::ReadFunction(Index defined_index) {
+  Index func_index = num_func_imports_ + defined_index;
+  CALLBACK(BeginFunctionBody, func_index);
+  uint32_t body_size;
+  CHECK_RESULT(ReadU32Leb128(&body_size, "function body size"));
+  Offset body_start_offset = state_.offset;
+  Offset end_offset = body_start_offset + body_size;
+
+  Index num_local_decls;
+  CHECK_RESULT(ReadIndex(&num_local_decls, "local declaration count"));
+  CALLBACK(OnLocalDeclCount, num_local_decls);
+  for (Index k = 0; k < num_local_decls; ++k) {
+    Index num_local_types;
+    CHECK_RESULT(ReadIndex(&num_local_types, "local type count"));
+    Type local_type;
+    CHECK_RESULT(ReadType(&local_type, "local type"));
+    ERROR_UNLESS(IsConcreteType(local_type), "expected valid local type");
+    CALLBACK(OnLocalDecl, k, num_local_types, local_type);
+  }
+
+  CHECK_RESULT(ReadFunctionBody(end_offset));
+
+  CALLBACK(EndFunctionBody, func_index);
+  return Result::Ok;
+}
+
+template <typename Delegate>
+Result BinaryReaderT<Delegate>::FinishCodeSection() {
+  CALLBACK0(EndCodeSection);
+  return Result::Ok;
+}
+
+template <typename Delegate>
+Result BinaryReaderT<Delegate>::ReadCodeSection(Offset section_size) {
+  CHECK_RESULT(ReadCodeSectionHeader(section_size));
+  for (Index i = 0; i < num_function_bodies_; ++i)
+    CHECK_RESULT(ReadFunction(i));
+  return FinishCodeSection();
+}
+
+template <typename Delegate>
+Result BinaryReaderT<Delegate>::ReadDataSection(Offset section_size) {
+  CALLBACK(BeginDataSection, section_size);
+  Index num_data_segments;
+  CHECK_RESULT(ReadIndex(&num_data_segments, "data segment count"));
+  CALLBACK(OnDataSegmentCount, num_data_segments);
+  ERROR_UNLESS(num_data_segments == 0 || NumTotalMemories() > 0,
+               "data section without memory section");
+  for (Index i = 0; i < num_data_segments; ++i) {
+    Index memory_index;
+    CHECK_RESULT(ReadIndex(&memory_index, "data segment memory index"));
+    CALLBACK(BeginDataSegment, i, memory_index);
+    CALLBACK(BeginDataSegmentInitExpr, i);
+    CHECK_RESULT(ReadInitExpr(i));
+    CALLBACK(EndDataSegmentInitExpr, i);
+
+    Address data_size;
+    const void* data;
+    CHECK_RESULT(ReadBytes(&data, &data_size, "data segment data"));
+    CALLBACK(OnDataSegmentData, i, data, data_size);
+    CALLBACK(EndDataSegment, i);
+  }
+  CALLBACK0(EndDataSection);
+  return Result::Ok;
+}
+
+template <typename Delegate>
+Result BinaryReaderT<Delegate>::ReadSectionHeader(BinarySection* out_section,
+                                                  Offset* out_section_size) {
+  uint32_t section_code;
+  CHECK_RESULT(ReadU32Leb128(&section_code, "section code"));
+  CHECK_RESULT(ReadOffset(out_section_size, "section size"));
+  if (section_code >= kBinarySectionCount) {
+    PrintError("invalid section code: %u; max is %u", section_code,
+               kBinarySectionCount - 1);
+    return Result::Error;
+  }
+  *out_section = static_cast<BinarySection>(section_code);
+  return Result::Ok;
+}
+
+template <typename Delegate>
+Result BinaryReaderT<Delegate>::StartSection(BinarySection section,
+                                             Offset section_size) {
+  ERROR_UNLESS(last_known_section_ == BinarySection::Invalid ||
+                   section == BinarySection::Custom ||
+                   section > last_known_section_,
+               "section %s out of order", get_section_name(section));
+
+  CALLBACK(BeginSection, section, section_size);
+  return Result::Ok;
+}
+
+template <typename Delegate>
+Result BinaryReaderT<Delegate>::FinishSection(BinarySection section) {
+  ERROR_UNLESS(state_.offset == read_end_,
+               "unfinished section (expected end: 0x%" PRIzx ")", read_end_);
+
+  if (section != BinarySection::Custom)
+    last_known_section_ = section;
+  return Result::Ok;
+}
+
+template <typename Delegate>
+Result BinaryReaderT<Delegate>::ReadSection(BinarySection section,
+                                            Offset section_size) {
+  read_end_ = state_.offset + section_size;
+  ERROR_UNLESS(read_end_ <= state_.size,
+               "invalid section size: extends past end");
+
+  CHECK_RESULT(StartSection(section, section_size));
+
+#define V(Name, name, code)                          \
+  case BinarySection::Name:                          \
+    CHECK_RESULT(Read##Name##Section(section_size)); \
+    break;
+
+  switch (section) {
+    WABT_FOREACH_BINARY_SECTION(V)
+
+    default:
+      assert(0);
+      break;
+  }
+
+#undef V
+
+  return FinishSection(section);
+}
+
+template <typename Delegate>
+Result BinaryReaderT<Delegate>::ReadSections() {
+  while (state_.offset < state_.size) {
+    BinarySection section;
+    Offset section_size;
+    /* Temporarily reset read_end_ to the full data size so the next section
+     * can be read. */
+    read_end_ = state_.size;
+    CHECK_RESULT(ReadSectionHeader(&section, &section_size));
+    CHECK_RESULT(ReadSection(section, section_size));
+  }
+  return Result::Ok;
+}
+
+template <typename Delegate>
+Result BinaryReaderT<Delegate>::ReadHeader() {
+  uint32_t magic = 0;
+  CHECK_RESULT(ReadU32(&magic, "magic"));
+  ERROR_UNLESS(magic == WABT_BINARY_MAGIC, "bad magic value");
+  uint32_t version = 0;
+  CHECK_RESULT(ReadU32(&version, "version"));
+  ERROR_UNLESS(version == WABT_BINARY_VERSION,
+               "bad wasm file version: %#x (expected %#x)", version,
+               WABT_BINARY_VERSION);
+
+  CALLBACK(BeginModule, version);
+  return Result::Ok;
+}
+
+template <typename Delegate>
+Result BinaryReaderT<Delegate>::FinishModule() {
+  CALLBACK0(EndModule);
+  return Result::Ok;
+}
+
+template <typename Delegate>
+Result BinaryReaderT<Delegate>::ReadModule() {
+  CHECK_RESULT(ReadHeader());
+  CHECK_RESULT(ReadSections());
+  return FinishModule();
+}
+
+template <typename Delegate>
+Result BinaryReaderT<Delegate>::SkipSection(BinarySection section,
+                                            Offset section_size) {
+  CHECK_RESULT(StartSection(section, section_size));
+  state_.offset = read_end_;
+  return FinishSection(section);
+}
+
+template <typename Delegate>
+Result BinaryReaderT<Delegate>::IndexCodeSection(Offset section_size,
+                                                 BinaryIndex* out_index) {
+  CHECK_RESULT(StartSection(BinarySection::Code, section_size));
+  CHECK_RESULT(ReadCodeSectionHeader(section_size));
+  for (Index i = 0; i < num_function_bodies_; ++i) {
+    Offset body_offset = state_.offset;
+    uint32_t body_size;
+    CHECK_RESULT(ReadU32Leb128(&body_size, "function body size"));
+    ERROR_UNLESS(body_size <= read_end_ - state_.offset,
+                 "function body extends past end of section");
+    state_.offset += body_size;
+    out_index->function_bodies.push_back(
+        BinaryIndex::FunctionBodyEntry{body_offset,
+                                       state_.offset - body_offset});
+  }
+  CHECK_RESULT(FinishCodeSection());
+  return FinishSection(BinarySection::Code);
+}
+
+template <typename Delegate>
+void BinaryReaderT<Delegate>::SaveContext(BinaryIndex* out_index) const {
+  out_index->signatures = signatures_;
+  out_index->num_imports = num_imports_;
+  out_index->num_func_imports = num_func_imports_;
+  out_index->num_table_imports = num_table_imports_;
+  out_index->num_memory_imports = num_memory_imports_;
+  out_index->num_global_imports = num_global_imports_;
+  out_index->num_exception_imports = num_exception_imports_;
+  out_index->num_function_signatures = num_function_signatures_;
+  out_index->num_tables = num_tables_;
+  out_index->num_memories = num_memories_;
+  out_index->num_globals = num_globals_;
+  out_index->num_exceptions = num_exceptions_;
+}
+
+template <typename Delegate>
+void BinaryReaderT<Delegate>::LoadContext(const BinaryIndex& index) {
+  signatures_ = index.signatures;
+  num_signatures_ = index.signatures.size();
+  num_imports_ = index.num_imports;
+  num_func_imports_ = index.num_func_imports;
+  num_table_imports_ = index.num_table_imports;
+  num_memory_imports_ = index.num_memory_imports;
+  num_global_imports_ = index.num_global_imports;
+  num_exception_imports_ = index.num_exception_imports;
+  num_function_signatures_ = index.num_function_signatures;
+  num_tables_ = index.num_tables;
+  num_memories_ = index.num_memories;
+  num_globals_ = index.num_globals;
+  num_exceptions_ = index.num_exceptions;
+  num_function_bodies_ = index.function_bodies.size();
+}
+
+template <typename Delegate>
+Result BinaryReaderT<Delegate>::IndexModule(BinaryIndex* out_index) {
+  CHECK_RESULT(ReadHeader());
+  memcpy(&out_index->version, state_.data + 4, sizeof(uint32_t));
+
+  while (state_.offset < state_.size) {
+    BinaryIndex::SectionEntry entry;
+    read_end_ = state_.size;
+    CHECK_RESULT(ReadSectionHeader(&entry.section, &entry.size));
+    entry.offset = state_.offset;
+    entry.count = 0;
+    read_end_ = state_.offset + entry.size;
+    ERROR_UNLESS(read_end_ <= state_.size,
+                 "invalid section size: extends past end");
+
+    // An invalid count is reported when the section is read.
+    if (entry.section != BinarySection::Custom) {
+      read_u32_leb128(state_.data + state_.offset, state_.data + read_end_,
+                      &entry.count);
+    }
+
+    switch (entry.section) {
+      case BinarySection::Custom: {
+        string_view name;
+        CHECK_RESULT(ReadStr(&name, "section name"));
+        entry.name = name.to_string();
+        state_.offset = entry.offset;
+        if (options_->allow_future_exceptions &&
+            name == WABT_BINARY_SECTION_EXCEPTION) {
+          CHECK_RESULT(ReadSection(entry.section, entry.size));
+          entry.count = num_exceptions_;
+        } else {
+          CHECK_RESULT(SkipSection(entry.section, entry.size));
+        }
+        break;
+      }
+
+      case BinarySection::Type:
+      case BinarySection::Import:
+      case BinarySection::Function:
+      case BinarySection::Table:
+      case BinarySection::Memory:
+      case BinarySection::Global:
+        CHECK_RESULT(ReadSection(entry.section, entry.size));
+        break;
+
+      case BinarySection::Code:
+        CHECK_RESULT(IndexCodeSection(entry.size, out_index));
+        break;
+
+      default:
+        CHECK_RESULT(SkipSection(entry.section, entry.size));
+        break;
+    }
+    out_index->sections.push_back(entry);
+  }
+
+  SaveContext(out_index);
+  return FinishModule();
+}
+
+template <typename Delegate>
+Result BinaryReaderT<Delegate>::ReadSectionAt(const BinaryIndex& index,
+                                              Index section_index) {
+  LoadContext(index);
+  for (Index i = 0; i < section_index; ++i) {
+    if (index.sections[i].section != BinarySection::Custom)
+      last_known_section_ = index.sections[i].section;
+  }
+  const BinaryIndex::SectionEntry& entry = index.sections[section_index];
+  if (entry.section == BinarySection::Import) {
+    // The import section counts the imports of each kind as it reads them.
+    num_func_imports_ = 0;
+    num_table_imports_ = 0;
+    num_memory_imports_ = 0;
+    num_global_imports_ = 0;
+    num_exception_imports_ = 0;
+  }
+  state_.offset = entry.offset;
+  return ReadSection(entry.section, entry.size);
+}
+
+template <typename Delegate>
+Result BinaryReaderT<Delegate>::ReadFunctionBodiesAt(const BinaryIndex& index,
+                                                     Index begin,
+                                                     Index end) {
+  LoadContext(index);
+  const BinaryIndex::SectionEntry& code =
+      index.sections[index.FindSection(BinarySection::Code)];
+  read_end_ = code.offset + code.size;
+  for (Index i = begin; i < end; ++i) {
+    state_.offset = index.function_bodies[i].offset;
+    CHECK_RESULT(ReadFunction(i));
+  }
+  return Result::Ok;
+}
+
+// Like read_binary, but with the callbacks bound at compile time; see
+// BinaryReaderT. Logging still goes through BinaryReaderLogging.
+template <typename Delegate>
+Result read_binary_static(const void* data,
+                          size_t size,
+                          Delegate* delegate,
+                          const ReadBinaryOptions* options) {
+  if (options->log_stream)
+    return read_binary(data, size, delegate, options);
+  BinaryReaderT<Delegate> reader(data, size, delegate, options);
+  return reader.ReadModule();
+}
+
+// Like read_binary_section, but with the callbacks bound at compile time.
+template <typename Delegate>
+Result read_binary_section_static(const void* data,
+                                  size_t size,
+                                  const BinaryIndex& index,
+                                  Index section_index,
+                                  Delegate* delegate,
+                                  const ReadBinaryOptions* options) {
+  if (options->log_stream) {
+    return read_binary_section(data, size, index, section_index, delegate,
+                               options);
+  }
+  BinaryReaderT<Delegate> reader(data, size, delegate, options);
+  return reader.ReadSectionAt(index, section_index);
+}
+
+// Like read_binary_function_body, but with the callbacks bound at compile
+// time.
+template <typename Delegate>
+Result read_binary_function_body_static(const void* data,
+                                        size_t size,
+                                        const BinaryIndex& index,
+                                        Index defined_index,
+                                        Delegate* delegate,
+                                        const ReadBinaryOptions* options) {
+  if (options->log_stream) {
+    return read_binary_function_body(data, size, index, defined_index,
+                                     delegate, options);
+  }
+  BinaryReaderT<Delegate> reader(data, size, delegate, options);
+  return reader.ReadFunctionBodiesAt(index, defined_index, defined_index + 1);
+}
+
+// Like read_binary_function_bodies, but with the callbacks bound at compile
+// time.
+template <typename Delegate>
+Result read_binary_function_bodies_static(const void* data,
+                                          size_t size,
+                                          const BinaryIndex& index,
+                                          Index begin,
+                                          Index end,
+                                          Delegate* delegate,
+                                          const ReadBinaryOptions* options) {
+  if (options->log_stream) {
+    return read_binary_function_bodies(data, size, index, begin, end,
+                                       delegate, options);
+  }
+  BinaryReaderT<Delegate> reader(data, size, delegate, options);
+  return reader.ReadFunctionBodiesAt(index, begin, end);
+}
+
+// Reads a module that arrives in pieces, e.g. from a pipe or a socket. Push()
+// takes the bytes as they arrive, in chunks of any size, and calls the
+// delegate for each section as soon as all of it has been pushed; the code
+// section is read a function body at a time. Finish() reports an error if the
+// module is incomplete.
+//
+// The delegate sees the same callbacks, with the same offsets, as it would
+// from BinaryReaderT. The data passed to the callbacks is only valid until the
+// next Push(), since the buffer may move as it grows; a delegate that needs it
+// later must copy it.
+template <typename Delegate>
+class StreamingBinaryReader {
+ public:
+  WABT_DISALLOW_COPY_AND_ASSIGN(StreamingBinaryReader);
+  StreamingBinaryReader(Delegate* delegate, const ReadBinaryOptions* options);
+
+  Result Push(const void* data, size_t size);
+  Result Finish();
+
+ private:
+  enum class Stage {
+    Header,
+    SectionHeader,
+    Section,
+    CodeSectionHeader,
+    FunctionBody,
+    Done,
+    Error,
+  };
+
+  void Append(const void* data, size_t size);
+  size_t GetLeb128Length(Offset offset) const;
+  void ClampReadEnd();
+  Result Decode();
+
+  BinaryReaderT<Delegate> reader_;
+  std::vector<uint8_t> buffer_;  // The module read so far.
+  Stage stage_ = Stage::Header;
+  bool at_end_ = false;
+  BinarySection section_ = BinarySection::Invalid;
+  Offset section_size_ = 0;
+  Offset section_end_ = 0;
+  Index function_body_ = 0;
+};
+
+template <typename Delegate>
+StreamingBinaryReader<Delegate>::StreamingBinaryReader(
+    Delegate* delegate,
+    const ReadBinaryOptions* options)
+    : reader_(nullptr, 0, delegate, options) {}
+
+template <typename Delegate>
+void StreamingBinaryReader<Delegate>::Append(const void* data, size_t size) {
+  const uint8_t* bytes = static_cast<const uint8_t*>(data);
+  buffer_.insert(buffer_.end(), bytes, bytes + size);
+  reader_.state_.data = buffer_.data();
+  reader_.state_.size = buffer_.size();
+}
+
+// Returns the length of the u32 LEB128 at |offset|, or 0 if it hasn't all
+// been pushed yet. A LEB128 that is too long counts as complete, so that
+// BinaryReaderT reports it.
+template <typename Delegate>
+size_t StreamingBinaryReader<Delegate>::GetLeb128Length(Offset offset) const {
+  const size_t kMaxLength = 5;
+  for (size_t i = 0; i < kMaxLength && offset + i < buffer_.size(); ++i) {
+    if (!(buffer_[offset + i] & 0x80))
+      return i + 1;
+  }
+  return offset + kMaxLength <= buffer_.size() ? kMaxLength : 0;
+}
+
+// Reads within the current section, but never past the data pushed so far.
+template <typename Delegate>
+void StreamingBinaryReader<Delegate>::ClampReadEnd() {
+  reader_.read_end_ = std::min<size_t>(section_end_, buffer_.size());
+}
+
+// Reads everything that has been pushed completely. Until Finish() is called,
+// an incomplete piece is left for the next Push(); after it, the piece is read
+// anyway so that BinaryReaderT reports the error.
+template <typename Delegate>
+Result StreamingBinaryReader<Delegate>::Decode() {
+  BinaryReaderDelegate::State& state = reader_.state_;
+  for (;;) {
+    switch (stage_) {
+      case Stage::Header:
+        if (buffer_.size() < 8 && !at_end_)
+          return Result::Ok;
+        reader_.read_end_ = buffer_.size();
+        CHECK_RESULT(reader_.ReadHeader());
+        stage_ = Stage::SectionHeader;
+        break;
+
+      case Stage::SectionHeader: {
+        if (state.offset == buffer_.size()) {
+          if (!at_end_)
+            return Result::Ok;
+          CHECK_RESULT(reader_.FinishModule());
+          stage_ = Stage::Done;
+          return Result::Ok;
+        }
+        size_t code_length = GetLeb128Length(state.offset);
+        if (!at_end_ &&
+            (code_length == 0 ||
+             GetLeb128Length(state.offset + code_length) == 0)) {
+          return Result::Ok;
+        }
+        reader_.read_end_ = buffer_.size();
+        CHECK_RESULT(reader_.ReadSectionHeader(&section_, &section_size_));
+        section_end_ = state.offset + section_size_;
+        stage_ = section_ == BinarySection::Code ? Stage::CodeSectionHeader
+                                                 : Stage::Section;
+        break;
+      }
+
+      case Stage::Section:
+        if (section_end_ > buffer_.size() && !at_end_)
+          return Result::Ok;
+        CHECK_RESULT(reader_.ReadSection(section_, section_size_));
+        stage_ = Stage::SectionHeader;
+        break;
+
+      case Stage::CodeSectionHeader:
+        if (section_end_ <= buffer_.size() || at_end_) {
+          // Nothing to gain by reading it a function body at a time.
+          CHECK_RESULT(reader_.ReadSection(section_, section_size_));
+          stage_ = Stage::SectionHeader;
+          break;
+        }
+        if (GetLeb128Length(state.offset) == 0)
+          return Result::Ok;
+        ClampReadEnd();
+        CHECK_RESULT(reader_.StartSection(section_, section_size_));
+        CHECK_RESULT(reader_.ReadCodeSectionHeader(section_size_));
+        function_body_ = 0;
+        stage_ = Stage::FunctionBody;
+        break;
+
+      case Stage::FunctionBody: {
+        if (function_body_ == reader_.num_function_bodies_) {
+          CHECK_RESULT(reader_.FinishCodeSection());
+          reader_.read_end_ = section_end_;
+          CHECK_RESULT(reader_.FinishSection(section_));
+          stage_ = Stage::SectionHeader;
+          break;
+        }
+        if (section_end_ > buffer_.size()) {
+          if (at_end_) {
+            reader_.PrintError("invalid section size: extends past end");
+            return Result::Error;
+          }
+          size_t length = GetLeb128Length(state.offset);
+          if (length == 0)
+            return Result::Ok;
+          // An invalid size is left for ReadFunction to report.
+          uint32_t body_size = 0;
+          if (read_u32_leb128(buffer_.data() + state.offset,
+                              buffer_.data() + state.offset + length,
+                              &body_size) != 0 &&
+              state.offset + length + body_size > buffer_.size()) {
+            return Result::Ok;
+          }
+        }
+        ClampReadEnd();
+        CHECK_RESULT(reader_.ReadFunction(function_body_++));
+        break;
+      }
+
+      case Stage::Done:
+      case Stage::Error:
+        return Result::Ok;
+    }
+  }
+}
+
+template <typename Delegate>
+Result StreamingBinaryReader<Delegate>::Push(const void* data, size_t size) {
+  assert(!at_end_);
+  if (stage_ == Stage::Error)
+    return Result::Error;
+  Append(data, size);
+  if (Failed(Decode())) {
+    stage_ = Stage::Error;
+    return Result::Error;
+  }
+  return Result::Ok;
+}
+
+template <typename Delegate>
+Result StreamingBinaryReader<Delegate>::Finish() {
+  assert(!at_end_);
+  at_end_ = true;
+  if (stage_ == Stage::Error)
+    return Result::Error;
+  if (Failed(Decode())) {
+    stage_ = Stage::Error;
+    return Result::Error;
+  }
+  assert(stage_ == Stage::Done);
+  return Result::Ok;
+}
+
+}  // namespace wabt
+
+#undef CHECK_RESULT
+#undef ERROR_UNLESS
+#undef ERROR_UNLESS_FUTURE_EXCEPTIONS_OPCODE
+#undef CALLBACK0
+#undef CALLBACK
+
+#endif /* WABT_BINARY_READER_IMPL_H_ */
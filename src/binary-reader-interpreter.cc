@@ -19,9 +19,15 @@
 #include <cassert>
 #include <cinttypes>
 #include <cstdarg>
+#include <algorithm>
 #include <cstdio>
+#include <string>
+#include <utility>
 #include <vector>
 
+#include "binary-checker.h"
+#include "binary-reader-impl.h"
+#include "binary-reader-logging.h"
 #include "binary-reader-nop.h"
 #include "error-handler.h"
 #include "interpreter.h"
@@ -49,10 +55,33 @@ struct Label {
 
   IstreamOffset offset;
   IstreamOffset fixup_offset;
+  // Set for an if whose condition is a constant. Its dead arm, which starts
+  // at dead_arm_offset, is removed from the istream at the next else or end.
+  bool is_constant_if;
+  IstreamOffset dead_arm_offset;
 };
 
 Label::Label(IstreamOffset offset, IstreamOffset fixup_offset)
-    : offset(offset), fixup_offset(fixup_offset) {}
+    : offset(offset),
+      fixup_offset(fixup_offset),
+      is_constant_if(false),
+      dead_arm_offset(kInvalidIstreamOffset) {}
+
+// A constant instruction at [offset, end) in the istream.
+struct EmittedConstant {
+  EmittedConstant(IstreamOffset offset,
+                  IstreamOffset end,
+                  const TypedValue& value);
+
+  IstreamOffset offset;
+  IstreamOffset end;
+  TypedValue value;
+};
+
+EmittedConstant::EmittedConstant(IstreamOffset offset,
+                                 IstreamOffset end,
+                                 const TypedValue& value)
+    : offset(offset), end(end), value(value) {}
 
 struct ElemSegmentInfo {
   ElemSegmentInfo(Index* dst, Index func_index)
@@ -62,16 +91,19 @@ struct ElemSegmentInfo {
   Index func_index;
 };
 
+// The data is copied, since a streamed module's buffer may have moved by the
+// time it is written to memory at the end of the module.
 struct DataSegmentInfo {
   DataSegmentInfo(void* dst_data, const void* src_data, IstreamOffset size)
-      : dst_data(dst_data), src_data(src_data), size(size) {}
+      : dst_data(dst_data),
+        data(static_cast<const uint8_t*>(src_data),
+             static_cast<const uint8_t*>(src_data) + size) {}
 
-  void* dst_data;        // Not owned.
-  const void* src_data;  // Not owned.
-  IstreamOffset size;
+  void* dst_data;  // Not owned.
+  std::vector<uint8_t> data;
 };
 
-class BinaryReaderInterpreter : public BinaryReaderNop {
+class BinaryReaderInterpreter final : public BinaryReaderNop {
  public:
   BinaryReaderInterpreter(Environment* env,
                           DefinedModule* module,
@@ -145,6 +177,25 @@ class BinaryReaderInterpreter : public BinaryReaderNop {
   wabt::Result OnLocalDeclCount(Index count) override;
   wabt::Result OnLocalDecl(Index decl_index, Index count, Type type) override;
 
+  wabt::Result OnOpcode(wabt::Opcode opcode) override;
+  wabt::Result OnAtomicLoadExpr(wabt::Opcode opcode,
+                                uint32_t alignment_log2,
+                                Address offset) override;
+  wabt::Result OnAtomicNotifyExpr(wabt::Opcode opcode,
+                                  uint32_t alignment_log2,
+                                  Address offset) override;
+  wabt::Result OnAtomicRmwExpr(wabt::Opcode opcode,
+                               uint32_t alignment_log2,
+                               Address offset) override;
+  wabt::Result OnAtomicRmwCmpxchgExpr(wabt::Opcode opcode,
+                                      uint32_t alignment_log2,
+                                      Address offset) override;
+  wabt::Result OnAtomicStoreExpr(wabt::Opcode opcode,
+                                 uint32_t alignment_log2,
+                                 Address offset) override;
+  wabt::Result OnAtomicWaitExpr(wabt::Opcode opcode,
+                                uint32_t alignment_log2,
+                                Address offset) override;
   wabt::Result OnBinaryExpr(wabt::Opcode opcode) override;
   wabt::Result OnBlockExpr(Index num_types, Type* sig_types) override;
   wabt::Result OnBrExpr(Index depth) override;
@@ -172,23 +223,33 @@ class BinaryReaderInterpreter : public BinaryReaderNop {
                           uint32_t alignment_log2,
                           Address offset) override;
   wabt::Result OnLoopExpr(Index num_types, Type* sig_types) override;
+  wabt::Result OnMemoryCopyExpr() override;
+  wabt::Result OnMemoryFillExpr() override;
   wabt::Result OnNopExpr() override;
   wabt::Result OnReturnExpr() override;
+  wabt::Result OnReturnCallExpr(Index func_index) override;
+  wabt::Result OnReturnCallIndirectExpr(Index sig_index) override;
   wabt::Result OnSelectExpr() override;
   wabt::Result OnSetGlobalExpr(Index global_index) override;
   wabt::Result OnSetLocalExpr(Index local_index) override;
+  wabt::Result OnSimdLaneOpExpr(wabt::Opcode opcode, uint32_t lane) override;
   wabt::Result OnStoreExpr(wabt::Opcode opcode,
                            uint32_t alignment_log2,
                            Address offset) override;
   wabt::Result OnTeeLocalExpr(Index local_index) override;
   wabt::Result OnUnaryExpr(wabt::Opcode opcode) override;
   wabt::Result OnUnreachableExpr() override;
+  wabt::Result OnV128ConstExpr(v128 value_bits) override;
   wabt::Result EndFunctionBody(Index index) override;
 
   wabt::Result EndElemSegmentInitExpr(Index index) override;
   wabt::Result OnElemSegmentFunctionIndex(Index index,
                                           Index func_index) override;
 
+  wabt::Result OnFunctionName(Index function_index,
+                              string_view function_name) override;
+  wabt::Result EndNamesSection() override;
+
   wabt::Result OnDataSegmentData(Index index,
                                  const void* data,
                                  Address size) override;
@@ -217,7 +278,6 @@ class BinaryReaderInterpreter : public BinaryReaderNop {
   Index TranslateGlobalIndexToEnv(Index global_index);
   Global* GetGlobalByModuleIndex(Index global_index);
   Type GetGlobalTypeByModuleIndex(Index global_index);
-  Index TranslateLocalIndex(Index local_index);
   Type GetLocalTypeByIndex(Func* func, Index local_index);
 
   IstreamOffset GetIstreamOffset();
@@ -232,7 +292,13 @@ class BinaryReaderInterpreter : public BinaryReaderNop {
   wabt::Result EmitI32(uint32_t value);
   wabt::Result EmitI64(uint64_t value);
   wabt::Result EmitI32At(IstreamOffset offset, uint32_t value);
-  wabt::Result EmitDropKeep(uint32_t drop, uint8_t keep);
+  void TruncateIstream(IstreamOffset offset);
+  wabt::Result EmitConstant(const TypedValue& value);
+  bool PopConstants(Index count, TypedValue* out_values);
+  bool FoldConstantExpr(wabt::Opcode opcode,
+                        Index num_args,
+                        TypedValue* out_result);
+  wabt::Result EmitDropKeep(uint32_t drop, uint32_t keep);
   wabt::Result AppendFixup(IstreamOffsetVectorVector* fixups_vector,
                            Index index);
   wabt::Result EmitBrOffset(Index depth, IstreamOffset offset);
@@ -241,10 +307,12 @@ class BinaryReaderInterpreter : public BinaryReaderNop {
                                   Index* out_keep_count);
   wabt::Result GetReturnDropKeepCount(Index* out_drop_count,
                                       Index* out_keep_count);
+  wabt::Result GetReturnCallDropKeepCount(Index keep_count,
+                                          Index* out_drop_count);
   wabt::Result EmitBr(Index depth, Index drop_count, Index keep_count);
-  wabt::Result EmitBrTableOffset(Index depth);
   wabt::Result FixupTopLabel();
   wabt::Result EmitFuncOffset(DefinedFunc* func, Index func_index);
+  wabt::Result EmitFuncMemoryIndex(DefinedFunc* func, Index func_index);
 
   wabt::Result CheckLocal(Index local_index);
   wabt::Result CheckGlobal(Index global_index);
@@ -252,7 +320,9 @@ class BinaryReaderInterpreter : public BinaryReaderNop {
   wabt::Result CheckImportLimits(const Limits* declared_limits,
                                  const Limits* actual_limits);
   wabt::Result CheckHasMemory(wabt::Opcode opcode);
-  wabt::Result CheckAlign(uint32_t alignment_log2, Address natural_alignment);
+  wabt::Result EmitAtomicExpr(wabt::Opcode opcode,
+                              uint32_t alignment_log2,
+                              Address offset);
 
   wabt::Result AppendExport(Module* module,
                             ExternalKind kind,
@@ -266,11 +336,17 @@ class BinaryReaderInterpreter : public BinaryReaderNop {
   DefinedModule* module = nullptr;
   DefinedFunc* current_func = nullptr;
   TypeChecker typechecker;
+  BinaryChecker checker;
   std::vector<Label> label_stack;
   IstreamOffsetVectorVector func_fixups;
   IstreamOffsetVectorVector depth_fixups;
   MemoryWriter istream_writer;
   IstreamOffset istream_offset = 0;
+  // The constants emitted since the last label, which are contiguous in the
+  // istream; see PopConstants.
+  std::vector<EmittedConstant> emitted_constants;
+  // Only used to evaluate constant expressions; never runs the istream.
+  Thread folding_thread;
   /* mappings from module index space to env index space; this won't just be a
    * translation, because imported values will be resolved as well */
   IndexVector sig_index_mapping;
@@ -285,6 +361,9 @@ class BinaryReaderInterpreter : public BinaryReaderNop {
   // that there are no validation errors.
   std::vector<ElemSegmentInfo> elem_segment_infos;
   std::vector<DataSegmentInfo> data_segment_infos;
+  // The names of the defined functions, which only apply once the whole name
+  // section has been read; a bad one is skipped, see skip_bad_names.
+  std::vector<std::pair<DefinedFunc*, std::string>> func_names;
 
   /* values cached so they can be shared between callbacks */
   TypedValue init_expr_value;
@@ -303,9 +382,12 @@ BinaryReaderInterpreter::BinaryReaderInterpreter(
       env(env),
       module(module),
       istream_writer(std::move(istream)),
-      istream_offset(istream_writer.output_buffer().size()) {
+      istream_offset(istream_writer.output_buffer().size()),
+      folding_thread(env, Thread::Options(2, 0)) {
   typechecker.set_error_callback(
       [this](const char* msg) { PrintError("%s", msg); });
+  checker.set_error_callback(
+      [this](const char* msg) { PrintError("%s", msg); });
 }
 
 std::unique_ptr<OutputBuffer> BinaryReaderInterpreter::ReleaseOutputBuffer() {
@@ -392,11 +474,16 @@ wabt::Result BinaryReaderInterpreter::EmitData(const void* data,
 }
 
 wabt::Result BinaryReaderInterpreter::EmitOpcode(wabt::Opcode opcode) {
-  return EmitData(&opcode, sizeof(uint8_t));
+  return EmitOpcode(FromWabtOpcode(opcode));
 }
 
 wabt::Result BinaryReaderInterpreter::EmitOpcode(interpreter::Opcode opcode) {
-  return EmitData(&opcode, sizeof(uint8_t));
+  int value = static_cast<int>(opcode);
+  if (value >= kFirstPrefixedOpcode) {
+    CHECK_RESULT(EmitI8(kOpcodePrefix));
+    value -= kFirstPrefixedOpcode;
+  }
+  return EmitI8(static_cast<uint8_t>(value));
 }
 
 wabt::Result BinaryReaderInterpreter::EmitI8(uint8_t value) {
@@ -416,17 +503,125 @@ wabt::Result BinaryReaderInterpreter::EmitI32At(IstreamOffset offset,
   return EmitDataAt(offset, &value, sizeof(value));
 }
 
+static void remove_offsets_from(IstreamOffsetVector* offsets,
+                                IstreamOffset start) {
+  offsets->erase(std::remove_if(offsets->begin(), offsets->end(),
+                                [start](IstreamOffset offset) {
+                                  return offset >= start;
+                                }),
+                 offsets->end());
+}
+
+// Remove everything emitted at or after |offset|, along with the fixups that
+// would write into it.
+void BinaryReaderInterpreter::TruncateIstream(IstreamOffset offset) {
+  assert(offset <= istream_offset);
+  istream_offset = offset;
+  istream_writer.output_buffer().data.resize(offset);
+  for (IstreamOffsetVector& fixups : depth_fixups)
+    remove_offsets_from(&fixups, offset);
+  for (IstreamOffsetVector& fixups : func_fixups)
+    remove_offsets_from(&fixups, offset);
+  while (!emitted_constants.empty() &&
+         emitted_constants.back().offset >= offset) {
+    emitted_constants.pop_back();
+  }
+  // The entry at |offset| itself stays; it is the first instruction that was
+  // folded into whatever is emitted there next.
+  while (!module->offset_map.empty() &&
+         module->offset_map.back().istream_offset > offset) {
+    module->offset_map.pop_back();
+  }
+}
+
+wabt::Result BinaryReaderInterpreter::EmitConstant(const TypedValue& value) {
+  IstreamOffset offset = GetIstreamOffset();
+  switch (value.type) {
+    case Type::I32:
+      CHECK_RESULT(EmitOpcode(interpreter::Opcode::I32Const));
+      CHECK_RESULT(EmitI32(value.value.i32));
+      break;
+
+    case Type::I64:
+      CHECK_RESULT(EmitOpcode(interpreter::Opcode::I64Const));
+      CHECK_RESULT(EmitI64(value.value.i64));
+      break;
+
+    case Type::F32:
+      CHECK_RESULT(EmitOpcode(interpreter::Opcode::F32Const));
+      CHECK_RESULT(EmitI32(value.value.f32_bits));
+      break;
+
+    case Type::F64:
+      CHECK_RESULT(EmitOpcode(interpreter::Opcode::F64Const));
+      CHECK_RESULT(EmitI64(value.value.f64_bits));
+      break;
+
+    default:
+      WABT_UNREACHABLE;
+  }
+  if (!emitted_constants.empty() && emitted_constants.back().end != offset)
+    emitted_constants.clear();
+  emitted_constants.emplace_back(offset, GetIstreamOffset(), value);
+  return wabt::Result::Ok;
+}
+
+// If the last |count| instructions emitted were constants, they are the top
+// |count| values of the stack: remove them from the istream and return their
+// values. Labels clear |emitted_constants|, so a branch target never falls
+// between them.
+bool BinaryReaderInterpreter::PopConstants(Index count,
+                                           TypedValue* out_values) {
+  if (emitted_constants.size() < count ||
+      emitted_constants.back().end != GetIstreamOffset()) {
+    return false;
+  }
+
+  Index first = emitted_constants.size() - count;
+  for (Index i = 0; i < count; ++i)
+    out_values[i] = emitted_constants[first + i].value;
+  TruncateIstream(emitted_constants[first].offset);
+  return true;
+}
+
+// If the operands of the numeric |opcode| were just emitted as constants,
+// remove them and return its result, which the caller emits instead. It isn't
+// folded if it would trap, so that the trap still happens when it is executed.
+bool BinaryReaderInterpreter::FoldConstantExpr(wabt::Opcode opcode,
+                                               Index num_args,
+                                               TypedValue* out_result) {
+  assert(num_args <= 2);
+  if (emitted_constants.size() < num_args ||
+      emitted_constants.back().end != GetIstreamOffset()) {
+    return false;
+  }
+
+  Value args[2];
+  for (Index i = 0; i < num_args; ++i) {
+    args[i] =
+        emitted_constants[emitted_constants.size() - num_args + i].value.value;
+  }
+  interpreter::Opcode interpreter_opcode = FromWabtOpcode(opcode);
+  *out_result = TypedValue(opcode.GetResultType());
+  if (!folding_thread.EvaluateConstantExpr(interpreter_opcode, args, num_args,
+                                           &out_result->value)) {
+    return false;
+  }
+
+  TypedValue operands[2];
+  return PopConstants(num_args, operands);
+}
+
 wabt::Result BinaryReaderInterpreter::EmitDropKeep(uint32_t drop,
-                                                   uint8_t keep) {
+                                                   uint32_t keep) {
   assert(drop != UINT32_MAX);
-  assert(keep <= 1);
   if (drop > 0) {
     if (drop == 1 && keep == 0) {
       CHECK_RESULT(EmitOpcode(interpreter::Opcode::Drop));
     } else {
       CHECK_RESULT(EmitOpcode(interpreter::Opcode::DropKeep));
       CHECK_RESULT(EmitI32(drop));
-      CHECK_RESULT(EmitI8(keep));
+      CHECK_RESULT(EmitI32(keep));
     }
   }
   return wabt::Result::Ok;
@@ -483,6 +678,24 @@ wabt::Result BinaryReaderInterpreter::GetReturnDropKeepCount(
   return wabt::Result::Ok;
 }
 
+// Returns the number of values to drop so that only the top |keep_count|
+// values are left in the current function's frame, i.e. the params and locals
+// are dropped too. This must be called before the call is typechecked.
+wabt::Result BinaryReaderInterpreter::GetReturnCallDropKeepCount(
+    Index keep_count,
+    Index* out_drop_count) {
+  TypeChecker::Label* label;
+  CHECK_RESULT(typechecker.GetLabel(label_stack.size() - 1, &label));
+  if (typechecker.IsUnreachable()) {
+    *out_drop_count = 0;
+  } else {
+    *out_drop_count =
+        (typechecker.type_stack_size() - label->type_stack_limit) - keep_count;
+  }
+  *out_drop_count += current_func->param_and_local_types.size();
+  return wabt::Result::Ok;
+}
+
 wabt::Result BinaryReaderInterpreter::EmitBr(Index depth,
                                              Index drop_count,
                                              Index keep_count) {
@@ -492,15 +705,6 @@ wabt::Result BinaryReaderInterpreter::EmitBr(Index depth,
   return wabt::Result::Ok;
 }
 
-wabt::Result BinaryReaderInterpreter::EmitBrTableOffset(Index depth) {
-  Index drop_count, keep_count;
-  CHECK_RESULT(GetBrDropKeepCount(depth, &drop_count, &keep_count));
-  CHECK_RESULT(EmitBrOffset(depth, GetLabel(depth)->offset));
-  CHECK_RESULT(EmitI32(drop_count));
-  CHECK_RESULT(EmitI8(keep_count));
-  return wabt::Result::Ok;
-}
-
 wabt::Result BinaryReaderInterpreter::FixupTopLabel() {
   IstreamOffset offset = GetIstreamOffset();
   Index top = label_stack.size() - 1;
@@ -526,6 +730,15 @@ wabt::Result BinaryReaderInterpreter::EmitFuncOffset(DefinedFunc* func,
   return wabt::Result::Ok;
 }
 
+// A function body may not have been read yet, so the memory of a function
+// defined by this module comes from the module itself.
+wabt::Result BinaryReaderInterpreter::EmitFuncMemoryIndex(DefinedFunc* func,
+                                                          Index func_index) {
+  if (func_index >= num_func_imports)
+    return EmitI32(module->memory_index);
+  return EmitI32(func->memory_index);
+}
+
 bool BinaryReaderInterpreter::OnError(const char* message) {
   return HandleError(state->offset, message);
 }
@@ -588,23 +801,12 @@ wabt::Result BinaryReaderInterpreter::OnImport(Index index,
 }
 
 wabt::Result BinaryReaderInterpreter::CheckLocal(Index local_index) {
-  Index max_local_index = current_func->param_and_local_types.size();
-  if (local_index >= max_local_index) {
-    PrintError("invalid local_index: %" PRIindex " (max %" PRIindex ")",
-               local_index, max_local_index);
-    return wabt::Result::Error;
-  }
-  return wabt::Result::Ok;
+  return checker.CheckLocal(local_index,
+                            current_func->param_and_local_types.size());
 }
 
 wabt::Result BinaryReaderInterpreter::CheckGlobal(Index global_index) {
-  Index max_global_index = global_index_mapping.size();
-  if (global_index >= max_global_index) {
-    PrintError("invalid global_index: %" PRIindex " (max %" PRIindex ")",
-               global_index, max_global_index);
-    return wabt::Result::Error;
-  }
-  return wabt::Result::Ok;
+  return checker.CheckGlobal(global_index, global_index_mapping.size());
 }
 
 wabt::Result BinaryReaderInterpreter::CheckImportKind(
@@ -642,6 +844,13 @@ wabt::Result BinaryReaderInterpreter::CheckImportLimits(
     }
   }
 
+  if (actual_limits->is_shared != declared_limits->is_shared) {
+    PrintError("%s memory doesn't match declared %s memory",
+               actual_limits->is_shared ? "shared" : "unshared",
+               declared_limits->is_shared ? "shared" : "unshared");
+    return wabt::Result::Error;
+  }
+
   return wabt::Result::Ok;
 }
 
@@ -711,10 +920,7 @@ wabt::Result BinaryReaderInterpreter::OnImportTable(Index import_index,
                                                     Index table_index,
                                                     Type elem_type,
                                                     const Limits* elem_limits) {
-  if (module->table_index != kInvalidIndex) {
-    PrintError("only one table allowed");
-    return wabt::Result::Error;
-  }
+  CHECK_RESULT(checker.CheckTable(module->table_index != kInvalidIndex));
 
   Import* import = &module->imports[import_index];
 
@@ -746,20 +952,18 @@ wabt::Result BinaryReaderInterpreter::OnImportMemory(
     string_view field_name,
     Index memory_index,
     const Limits* page_limits) {
-  if (module->memory_index != kInvalidIndex) {
-    PrintError("only one memory allowed");
-    return wabt::Result::Error;
-  }
+  CHECK_RESULT(checker.CheckMemory(module->memory_index != kInvalidIndex));
 
   Import* import = &module->imports[import_index];
 
   if (is_host_import) {
-    Memory* memory = env->EmplaceBackMemory();
+    Memory* memory = env->EmplaceBackMemory(*page_limits);
 
     CHECK_RESULT(host_import_module->import_delegate->ImportMemory(
         import, memory, MakePrintErrorCallback()));
 
     CHECK_RESULT(CheckImportLimits(page_limits, &memory->page_limits));
+    env->UpdatePeakMemoryPages();
 
     module->memory_index = env->GetMemoryCount() - 1;
     AppendExport(host_import_module, ExternalKind::Memory, module->memory_index,
@@ -806,6 +1010,9 @@ wabt::Result BinaryReaderInterpreter::OnImportGlobal(Index import_index,
 }
 
 wabt::Result BinaryReaderInterpreter::OnFunctionCount(Index count) {
+  module->num_func_imports = num_func_imports;
+  module->defined_func_env_index = env->GetFuncCount();
+  module->num_defined_funcs = count;
   for (Index i = 0; i < count; ++i)
     func_index_mapping.push_back(env->GetFuncCount() + i);
   func_fixups.resize(count);
@@ -820,10 +1027,7 @@ wabt::Result BinaryReaderInterpreter::OnFunction(Index index, Index sig_index) {
 wabt::Result BinaryReaderInterpreter::OnTable(Index index,
                                               Type elem_type,
                                               const Limits* elem_limits) {
-  if (module->table_index != kInvalidIndex) {
-    PrintError("only one table allowed");
-    return wabt::Result::Error;
-  }
+  CHECK_RESULT(checker.CheckTable(module->table_index != kInvalidIndex));
   env->EmplaceBackTable(*elem_limits);
   module->table_index = env->GetTableCount() - 1;
   return wabt::Result::Ok;
@@ -831,11 +1035,17 @@ wabt::Result BinaryReaderInterpreter::OnTable(Index index,
 
 wabt::Result BinaryReaderInterpreter::OnMemory(Index index,
                                                const Limits* page_limits) {
-  if (module->memory_index != kInvalidIndex) {
-    PrintError("only one memory allowed");
+  CHECK_RESULT(checker.CheckMemory(module->memory_index != kInvalidIndex));
+  uint32_t max_pages = env->resource_limits().max_memory_pages;
+  if (max_pages != 0 &&
+      static_cast<uint64_t>(env->GetMemoryPageCount()) + page_limits->initial >
+          max_pages) {
+    PrintError("memory size %" PRIu64 " exceeds the limit of %u pages",
+               page_limits->initial, max_pages);
     return wabt::Result::Error;
   }
   env->EmplaceBackMemory(*page_limits);
+  env->UpdatePeakMemoryPages();
   module->memory_index = env->GetMemoryCount() - 1;
   return wabt::Result::Ok;
 }
@@ -886,15 +1096,10 @@ wabt::Result BinaryReaderInterpreter::OnInitExprF64ConstExpr(
 wabt::Result BinaryReaderInterpreter::OnInitExprGetGlobalExpr(
     Index index,
     Index global_index) {
-  if (global_index >= num_global_imports) {
-    PrintError("initializer expression can only reference an imported global");
-    return wabt::Result::Error;
-  }
+  CHECK_RESULT(CheckGlobal(global_index));
   Global* ref_global = GetGlobalByModuleIndex(global_index);
-  if (ref_global->mutable_) {
-    PrintError("initializer expression cannot reference a mutable global");
-    return wabt::Result::Error;
-  }
+  CHECK_RESULT(checker.CheckInitExprGlobal(global_index, num_global_imports,
+                                           ref_global->mutable_));
   init_expr_value = ref_global->typed_value;
   return wabt::Result::Ok;
 }
@@ -932,11 +1137,8 @@ wabt::Result BinaryReaderInterpreter::OnExport(Index index,
 
     case ExternalKind::Global: {
       item_index = TranslateGlobalIndexToEnv(item_index);
-      Global* global = env->GetGlobal(item_index);
-      if (global->mutable_) {
-        PrintError("mutable globals cannot be exported");
-        return wabt::Result::Error;
-      }
+      CHECK_RESULT(
+          checker.CheckExportGlobal(env->GetGlobal(item_index)->mutable_));
       break;
     }
 
@@ -952,14 +1154,8 @@ wabt::Result BinaryReaderInterpreter::OnStartFunction(Index func_index) {
   Index start_func_index = TranslateFuncIndexToEnv(func_index);
   Func* start_func = env->GetFunc(start_func_index);
   FuncSignature* sig = env->GetFuncSignature(start_func->sig_index);
-  if (sig->param_types.size() != 0) {
-    PrintError("start function must be nullary");
-    return wabt::Result::Error;
-  }
-  if (sig->result_types.size() != 0) {
-    PrintError("start function must not return anything");
-    return wabt::Result::Error;
-  }
+  CHECK_RESULT(
+      checker.CheckStartFunction(sig->param_types, sig->result_types));
   module->start_func_index = start_func_index;
   return wabt::Result::Ok;
 }
@@ -997,6 +1193,23 @@ wabt::Result BinaryReaderInterpreter::OnElemSegmentFunctionIndex(
   return wabt::Result::Ok;
 }
 
+wabt::Result BinaryReaderInterpreter::OnFunctionName(Index function_index,
+                                                     string_view function_name) {
+  if (function_index >= num_func_imports) {
+    func_names.emplace_back(
+        GetFuncByModuleIndex(function_index)->as_defined(),
+        function_name.to_string());
+  }
+  return wabt::Result::Ok;
+}
+
+wabt::Result BinaryReaderInterpreter::EndNamesSection() {
+  for (auto& pair : func_names)
+    pair.first->name = std::move(pair.second);
+  func_names.clear();
+  return wabt::Result::Ok;
+}
+
 wabt::Result BinaryReaderInterpreter::OnDataSegmentData(Index index,
                                                         const void* src_data,
                                                         Address size) {
@@ -1026,10 +1239,12 @@ wabt::Result BinaryReaderInterpreter::OnDataSegmentData(Index index,
 void BinaryReaderInterpreter::PushLabel(IstreamOffset offset,
                                         IstreamOffset fixup_offset) {
   label_stack.emplace_back(offset, fixup_offset);
+  emitted_constants.clear();
 }
 
 void BinaryReaderInterpreter::PopLabel() {
   label_stack.pop_back();
+  emitted_constants.clear();
   /* reduce the depth_fixups stack as well, but it may be smaller than
    * label_stack so only do it conditionally. */
   if (depth_fixups.size() > label_stack.size()) {
@@ -1045,6 +1260,7 @@ wabt::Result BinaryReaderInterpreter::BeginFunctionBody(Index index) {
   func->offset = GetIstreamOffset();
   func->local_decl_count = 0;
   func->local_count = 0;
+  func->memory_index = module->memory_index;
 
   current_func = func;
   depth_fixups.clear();
@@ -1101,31 +1317,24 @@ wabt::Result BinaryReaderInterpreter::OnLocalDecl(Index decl_index,
 }
 
 wabt::Result BinaryReaderInterpreter::CheckHasMemory(wabt::Opcode opcode) {
-  if (module->memory_index == kInvalidIndex) {
-    PrintError("%s requires an imported or defined memory.", opcode.GetName());
-    return wabt::Result::Error;
-  }
-  return wabt::Result::Ok;
-}
-
-wabt::Result BinaryReaderInterpreter::CheckAlign(uint32_t alignment_log2,
-                                                 Address natural_alignment) {
-  if (alignment_log2 >= 32 || (1U << alignment_log2) > natural_alignment) {
-    PrintError("alignment must not be larger than natural alignment (%u)",
-               natural_alignment);
-    return wabt::Result::Error;
-  }
-  return wabt::Result::Ok;
+  return checker.CheckHasMemory(opcode,
+                                module->memory_index != kInvalidIndex);
 }
 
 wabt::Result BinaryReaderInterpreter::OnUnaryExpr(wabt::Opcode opcode) {
   CHECK_RESULT(typechecker.OnUnary(opcode));
+  TypedValue result;
+  if (FoldConstantExpr(opcode, 1, &result))
+    return EmitConstant(result);
   CHECK_RESULT(EmitOpcode(opcode));
   return wabt::Result::Ok;
 }
 
 wabt::Result BinaryReaderInterpreter::OnBinaryExpr(wabt::Opcode opcode) {
   CHECK_RESULT(typechecker.OnBinary(opcode));
+  TypedValue result;
+  if (FoldConstantExpr(opcode, 2, &result))
+    return EmitConstant(result);
   CHECK_RESULT(EmitOpcode(opcode));
   return wabt::Result::Ok;
 }
@@ -1146,10 +1355,21 @@ wabt::Result BinaryReaderInterpreter::OnLoopExpr(Index num_types,
   return wabt::Result::Ok;
 }
 
+// An if whose condition is a constant doesn't emit a branch, and only its live
+// arm is kept.
 wabt::Result BinaryReaderInterpreter::OnIfExpr(Index num_types,
                                                Type* sig_types) {
   TypeVector sig(sig_types, sig_types + num_types);
   CHECK_RESULT(typechecker.OnIf(&sig));
+  TypedValue cond;
+  if (PopConstants(1, &cond)) {
+    PushLabel(kInvalidIstreamOffset, kInvalidIstreamOffset);
+    Label* label = TopLabel();
+    label->is_constant_if = true;
+    if (cond.value.i32 == 0)
+      label->dead_arm_offset = GetIstreamOffset();
+    return wabt::Result::Ok;
+  }
   CHECK_RESULT(EmitOpcode(interpreter::Opcode::BrUnless));
   IstreamOffset fixup_offset = GetIstreamOffset();
   CHECK_RESULT(EmitI32(kInvalidIstreamOffset));
@@ -1160,6 +1380,16 @@ wabt::Result BinaryReaderInterpreter::OnIfExpr(Index num_types,
 wabt::Result BinaryReaderInterpreter::OnElseExpr() {
   CHECK_RESULT(typechecker.OnElse());
   Label* label = TopLabel();
+  emitted_constants.clear();
+  if (label->is_constant_if) {
+    if (label->dead_arm_offset != kInvalidIstreamOffset) {
+      TruncateIstream(label->dead_arm_offset);
+      label->dead_arm_offset = kInvalidIstreamOffset;
+    } else {
+      label->dead_arm_offset = GetIstreamOffset();
+    }
+    return wabt::Result::Ok;
+  }
   IstreamOffset fixup_cond_offset = label->fixup_offset;
   CHECK_RESULT(EmitOpcode(interpreter::Opcode::Br));
   label->fixup_offset = GetIstreamOffset();
@@ -1173,7 +1403,10 @@ wabt::Result BinaryReaderInterpreter::OnEndExpr() {
   CHECK_RESULT(typechecker.GetLabel(0, &label));
   LabelType label_type = label->label_type;
   CHECK_RESULT(typechecker.OnEnd());
-  if (label_type == LabelType::If || label_type == LabelType::Else) {
+  if (TopLabel()->is_constant_if) {
+    if (TopLabel()->dead_arm_offset != kInvalidIstreamOffset)
+      TruncateIstream(TopLabel()->dead_arm_offset);
+  } else if (label_type == LabelType::If || label_type == LabelType::Else) {
     CHECK_RESULT(EmitI32At(TopLabel()->fixup_offset, GetIstreamOffset()));
   }
   FixupTopLabel();
@@ -1193,6 +1426,12 @@ wabt::Result BinaryReaderInterpreter::OnBrIfExpr(Index depth) {
   Index drop_count, keep_count;
   CHECK_RESULT(typechecker.OnBrIf(depth));
   CHECK_RESULT(GetBrDropKeepCount(depth, &drop_count, &keep_count));
+  TypedValue cond;
+  if (PopConstants(1, &cond)) {
+    if (cond.value.i32 != 0)
+      CHECK_RESULT(EmitBr(depth, drop_count, keep_count));
+    return wabt::Result::Ok;
+  }
   /* flip the br_if so if <cond> is true it can drop values from the stack */
   CHECK_RESULT(EmitOpcode(interpreter::Opcode::BrUnless));
   IstreamOffset fixup_br_offset = GetIstreamOffset();
@@ -1207,20 +1446,55 @@ wabt::Result BinaryReaderInterpreter::OnBrTableExpr(
     Index* target_depths,
     Index default_target_depth) {
   CHECK_RESULT(typechecker.BeginBrTable());
+  Index num_entries = num_targets + 1;
+  std::vector<Index> drop_counts(num_entries);
+  std::vector<Index> keep_counts(num_entries);
+  bool has_drop = false;
+  for (Index i = 0; i < num_entries; ++i) {
+    Index depth = i != num_targets ? target_depths[i] : default_target_depth;
+    CHECK_RESULT(typechecker.OnBrTableTarget(depth));
+    CHECK_RESULT(GetBrDropKeepCount(depth, &drop_counts[i], &keep_counts[i]));
+    has_drop |= drop_counts[i] != 0;
+  }
+
+  TypedValue index;
+  if (PopConstants(1, &index)) {
+    Index i = std::min(index.value.i32, num_targets);
+    Index depth = i != num_targets ? target_depths[i] : default_target_depth;
+    CHECK_RESULT(EmitBr(depth, drop_counts[i], keep_counts[i]));
+    return typechecker.EndBrTable();
+  }
+
   CHECK_RESULT(EmitOpcode(interpreter::Opcode::BrTable));
   CHECK_RESULT(EmitI32(num_targets));
   IstreamOffset fixup_table_offset = GetIstreamOffset();
   CHECK_RESULT(EmitI32(kInvalidIstreamOffset));
+  IstreamOffset fixup_drop_keep_offset = GetIstreamOffset();
+  CHECK_RESULT(EmitI32(kInvalidIstreamOffset));
   /* not necessary for the interpreter, but it makes it easier to disassemble.
    * This opcode specifies how many bytes of data follow. */
   CHECK_RESULT(EmitOpcode(interpreter::Opcode::Data));
-  CHECK_RESULT(EmitI32((num_targets + 1) * WABT_TABLE_ENTRY_SIZE));
-  CHECK_RESULT(EmitI32At(fixup_table_offset, GetIstreamOffset()));
+  // Pad so the offset array is aligned.
+  Index padding = (0 - (GetIstreamOffset() + sizeof(uint32_t))) & 3;
+  Index num_bytes = padding + num_entries * sizeof(IstreamOffset);
+  if (has_drop)
+    num_bytes += num_entries * WABT_BR_TABLE_DROP_KEEP_SIZE;
+  CHECK_RESULT(EmitI32(num_bytes));
+  for (Index i = 0; i < padding; ++i)
+    CHECK_RESULT(EmitI8(0));
 
-  for (Index i = 0; i <= num_targets; ++i) {
+  CHECK_RESULT(EmitI32At(fixup_table_offset, GetIstreamOffset()));
+  for (Index i = 0; i < num_entries; ++i) {
     Index depth = i != num_targets ? target_depths[i] : default_target_depth;
-    CHECK_RESULT(typechecker.OnBrTableTarget(depth));
-    CHECK_RESULT(EmitBrTableOffset(depth));
+    CHECK_RESULT(EmitBrOffset(depth, GetLabel(depth)->offset));
+  }
+
+  if (has_drop) {
+    CHECK_RESULT(EmitI32At(fixup_drop_keep_offset, GetIstreamOffset()));
+    for (Index i = 0; i < num_entries; ++i) {
+      CHECK_RESULT(EmitI32(drop_counts[i]));
+      CHECK_RESULT(EmitI32(keep_counts[i]));
+    }
   }
 
   CHECK_RESULT(typechecker.EndBrTable());
@@ -1239,16 +1513,16 @@ wabt::Result BinaryReaderInterpreter::OnCallExpr(Index func_index) {
   } else {
     CHECK_RESULT(EmitOpcode(interpreter::Opcode::Call));
     CHECK_RESULT(EmitFuncOffset(func->as_defined(), func_index));
+    CHECK_RESULT(EmitI32(sig->param_types.size()));
+    CHECK_RESULT(EmitFuncMemoryIndex(func->as_defined(), func_index));
   }
 
   return wabt::Result::Ok;
 }
 
 wabt::Result BinaryReaderInterpreter::OnCallIndirectExpr(Index sig_index) {
-  if (module->table_index == kInvalidIndex) {
-    PrintError("found call_indirect operator, but no table");
-    return wabt::Result::Error;
-  }
+  CHECK_RESULT(checker.CheckHasTable(wabt::Opcode::CallIndirect,
+                                     module->table_index != kInvalidIndex));
   FuncSignature* sig = GetSignatureByModuleIndex(sig_index);
   CHECK_RESULT(typechecker.OnCallIndirect(&sig->param_types,
                                             &sig->result_types));
@@ -1256,6 +1530,8 @@ wabt::Result BinaryReaderInterpreter::OnCallIndirectExpr(Index sig_index) {
   CHECK_RESULT(EmitOpcode(interpreter::Opcode::CallIndirect));
   CHECK_RESULT(EmitI32(module->table_index));
   CHECK_RESULT(EmitI32(TranslateSigIndexToEnv(sig_index)));
+  CHECK_RESULT(EmitI32(sig->param_types.size()));
+  CHECK_RESULT(EmitI32(env->AddCallIndirectSite()));
   return wabt::Result::Ok;
 }
 
@@ -1275,29 +1551,36 @@ wabt::Result BinaryReaderInterpreter::OnDropExpr() {
 
 wabt::Result BinaryReaderInterpreter::OnI32ConstExpr(uint32_t value) {
   CHECK_RESULT(typechecker.OnConst(Type::I32));
-  CHECK_RESULT(EmitOpcode(interpreter::Opcode::I32Const));
-  CHECK_RESULT(EmitI32(value));
-  return wabt::Result::Ok;
+  TypedValue typed_value(Type::I32);
+  typed_value.value.i32 = value;
+  return EmitConstant(typed_value);
 }
 
 wabt::Result BinaryReaderInterpreter::OnI64ConstExpr(uint64_t value) {
   CHECK_RESULT(typechecker.OnConst(Type::I64));
-  CHECK_RESULT(EmitOpcode(interpreter::Opcode::I64Const));
-  CHECK_RESULT(EmitI64(value));
-  return wabt::Result::Ok;
+  TypedValue typed_value(Type::I64);
+  typed_value.value.i64 = value;
+  return EmitConstant(typed_value);
 }
 
 wabt::Result BinaryReaderInterpreter::OnF32ConstExpr(uint32_t value_bits) {
   CHECK_RESULT(typechecker.OnConst(Type::F32));
-  CHECK_RESULT(EmitOpcode(interpreter::Opcode::F32Const));
-  CHECK_RESULT(EmitI32(value_bits));
-  return wabt::Result::Ok;
+  TypedValue typed_value(Type::F32);
+  typed_value.value.f32_bits = value_bits;
+  return EmitConstant(typed_value);
 }
 
 wabt::Result BinaryReaderInterpreter::OnF64ConstExpr(uint64_t value_bits) {
   CHECK_RESULT(typechecker.OnConst(Type::F64));
-  CHECK_RESULT(EmitOpcode(interpreter::Opcode::F64Const));
-  CHECK_RESULT(EmitI64(value_bits));
+  TypedValue typed_value(Type::F64);
+  typed_value.value.f64_bits = value_bits;
+  return EmitConstant(typed_value);
+}
+
+wabt::Result BinaryReaderInterpreter::OnV128ConstExpr(v128 value_bits) {
+  CHECK_RESULT(typechecker.OnConst(Type::V128));
+  CHECK_RESULT(EmitOpcode(interpreter::Opcode::V128Const));
+  CHECK_RESULT(EmitData(&value_bits, sizeof(value_bits)));
   return wabt::Result::Ok;
 }
 
@@ -1313,11 +1596,7 @@ wabt::Result BinaryReaderInterpreter::OnGetGlobalExpr(Index global_index) {
 wabt::Result BinaryReaderInterpreter::OnSetGlobalExpr(Index global_index) {
   CHECK_RESULT(CheckGlobal(global_index));
   Global* global = GetGlobalByModuleIndex(global_index);
-  if (!global->mutable_) {
-    PrintError("can't set_global on immutable global at index %" PRIindex ".",
-               global_index);
-    return wabt::Result::Error;
-  }
+  CHECK_RESULT(checker.CheckSetGlobal(global_index, global->mutable_));
   CHECK_RESULT(
       typechecker.OnSetGlobal(global->typed_value.type));
   CHECK_RESULT(EmitOpcode(interpreter::Opcode::SetGlobal));
@@ -1325,21 +1604,12 @@ wabt::Result BinaryReaderInterpreter::OnSetGlobalExpr(Index global_index) {
   return wabt::Result::Ok;
 }
 
-Index BinaryReaderInterpreter::TranslateLocalIndex(Index local_index) {
-  return typechecker.type_stack_size() +
-         current_func->param_and_local_types.size() - local_index;
-}
-
 wabt::Result BinaryReaderInterpreter::OnGetLocalExpr(Index local_index) {
   CHECK_RESULT(CheckLocal(local_index));
   Type type = GetLocalTypeByIndex(current_func, local_index);
-  // Get the translated index before calling typechecker.OnGetLocal because it
-  // will update the type stack size. We need the index to be relative to the
-  // old stack size.
-  Index translated_local_index = TranslateLocalIndex(local_index);
   CHECK_RESULT(typechecker.OnGetLocal(type));
   CHECK_RESULT(EmitOpcode(interpreter::Opcode::GetLocal));
-  CHECK_RESULT(EmitI32(translated_local_index));
+  CHECK_RESULT(EmitI32(local_index));
   return wabt::Result::Ok;
 }
 
@@ -1348,7 +1618,15 @@ wabt::Result BinaryReaderInterpreter::OnSetLocalExpr(Index local_index) {
   Type type = GetLocalTypeByIndex(current_func, local_index);
   CHECK_RESULT(typechecker.OnSetLocal(type));
   CHECK_RESULT(EmitOpcode(interpreter::Opcode::SetLocal));
-  CHECK_RESULT(EmitI32(TranslateLocalIndex(local_index)));
+  CHECK_RESULT(EmitI32(local_index));
+  return wabt::Result::Ok;
+}
+
+wabt::Result BinaryReaderInterpreter::OnSimdLaneOpExpr(wabt::Opcode opcode,
+                                                       uint32_t lane) {
+  CHECK_RESULT(typechecker.OnSimdLaneOp(opcode, lane));
+  CHECK_RESULT(EmitOpcode(opcode));
+  CHECK_RESULT(EmitI8(lane));
   return wabt::Result::Ok;
 }
 
@@ -1357,7 +1635,7 @@ wabt::Result BinaryReaderInterpreter::OnTeeLocalExpr(Index local_index) {
   Type type = GetLocalTypeByIndex(current_func, local_index);
   CHECK_RESULT(typechecker.OnTeeLocal(type));
   CHECK_RESULT(EmitOpcode(interpreter::Opcode::TeeLocal));
-  CHECK_RESULT(EmitI32(TranslateLocalIndex(local_index)));
+  CHECK_RESULT(EmitI32(local_index));
   return wabt::Result::Ok;
 }
 
@@ -1373,10 +1651,10 @@ wabt::Result BinaryReaderInterpreter::OnLoadExpr(wabt::Opcode opcode,
                                                  uint32_t alignment_log2,
                                                  Address offset) {
   CHECK_RESULT(CheckHasMemory(opcode));
-  CHECK_RESULT(CheckAlign(alignment_log2, opcode.GetMemorySize()));
+  CHECK_RESULT(checker.CheckAlign(alignment_log2, opcode.GetMemorySize()));
   CHECK_RESULT(typechecker.OnLoad(opcode));
+  // Loads and stores use the memory cached by the Thread at function entry.
   CHECK_RESULT(EmitOpcode(opcode));
-  CHECK_RESULT(EmitI32(module->memory_index));
   CHECK_RESULT(EmitI32(offset));
   return wabt::Result::Ok;
 }
@@ -1385,14 +1663,82 @@ wabt::Result BinaryReaderInterpreter::OnStoreExpr(wabt::Opcode opcode,
                                                   uint32_t alignment_log2,
                                                   Address offset) {
   CHECK_RESULT(CheckHasMemory(opcode));
-  CHECK_RESULT(CheckAlign(alignment_log2, opcode.GetMemorySize()));
+  CHECK_RESULT(checker.CheckAlign(alignment_log2, opcode.GetMemorySize()));
   CHECK_RESULT(typechecker.OnStore(opcode));
   CHECK_RESULT(EmitOpcode(opcode));
+  CHECK_RESULT(EmitI32(offset));
+  return wabt::Result::Ok;
+}
+
+wabt::Result BinaryReaderInterpreter::EmitAtomicExpr(wabt::Opcode opcode,
+                                                     uint32_t alignment_log2,
+                                                     Address offset) {
+  CHECK_RESULT(CheckHasMemory(opcode));
+  CHECK_RESULT(
+      checker.CheckAtomicAlign(alignment_log2, opcode.GetMemorySize()));
+  CHECK_RESULT(EmitOpcode(opcode));
   CHECK_RESULT(EmitI32(module->memory_index));
   CHECK_RESULT(EmitI32(offset));
   return wabt::Result::Ok;
 }
 
+// Record where the code for each instruction starts in the binary, for trap
+// stack traces. Instructions that emit nothing share the next one's entry.
+wabt::Result BinaryReaderInterpreter::OnOpcode(wabt::Opcode opcode) {
+  std::vector<OffsetMapEntry>& offset_map = module->offset_map;
+  uint32_t binary_offset = state->offset - opcode.GetLength();
+  if (!offset_map.empty() &&
+      offset_map.back().istream_offset == istream_offset) {
+    offset_map.back().binary_offset = binary_offset;
+  } else {
+    offset_map.emplace_back(istream_offset, binary_offset);
+  }
+  return wabt::Result::Ok;
+}
+
+wabt::Result BinaryReaderInterpreter::OnAtomicLoadExpr(wabt::Opcode opcode,
+                                                       uint32_t alignment_log2,
+                                                       Address offset) {
+  CHECK_RESULT(typechecker.OnAtomicLoad(opcode));
+  return EmitAtomicExpr(opcode, alignment_log2, offset);
+}
+
+wabt::Result BinaryReaderInterpreter::OnAtomicNotifyExpr(wabt::Opcode opcode,
+                                                         uint32_t alignment_log2,
+                                                         Address offset) {
+  CHECK_RESULT(typechecker.OnAtomicNotify(opcode));
+  return EmitAtomicExpr(opcode, alignment_log2, offset);
+}
+
+wabt::Result BinaryReaderInterpreter::OnAtomicRmwExpr(wabt::Opcode opcode,
+                                                      uint32_t alignment_log2,
+                                                      Address offset) {
+  CHECK_RESULT(typechecker.OnAtomicRmw(opcode));
+  return EmitAtomicExpr(opcode, alignment_log2, offset);
+}
+
+wabt::Result BinaryReaderInterpreter::OnAtomicRmwCmpxchgExpr(
+    wabt::Opcode opcode,
+    uint32_t alignment_log2,
+    Address offset) {
+  CHECK_RESULT(typechecker.OnAtomicRmwCmpxchg(opcode));
+  return EmitAtomicExpr(opcode, alignment_log2, offset);
+}
+
+wabt::Result BinaryReaderInterpreter::OnAtomicStoreExpr(wabt::Opcode opcode,
+                                                        uint32_t alignment_log2,
+                                                        Address offset) {
+  CHECK_RESULT(typechecker.OnAtomicStore(opcode));
+  return EmitAtomicExpr(opcode, alignment_log2, offset);
+}
+
+wabt::Result BinaryReaderInterpreter::OnAtomicWaitExpr(wabt::Opcode opcode,
+                                                       uint32_t alignment_log2,
+                                                       Address offset) {
+  CHECK_RESULT(typechecker.OnAtomicWait(opcode));
+  return EmitAtomicExpr(opcode, alignment_log2, offset);
+}
+
 wabt::Result BinaryReaderInterpreter::OnCurrentMemoryExpr() {
   CHECK_RESULT(CheckHasMemory(wabt::Opcode::CurrentMemory));
   CHECK_RESULT(typechecker.OnCurrentMemory());
@@ -1401,6 +1747,22 @@ wabt::Result BinaryReaderInterpreter::OnCurrentMemoryExpr() {
   return wabt::Result::Ok;
 }
 
+wabt::Result BinaryReaderInterpreter::OnMemoryCopyExpr() {
+  CHECK_RESULT(CheckHasMemory(wabt::Opcode::MemoryCopy));
+  CHECK_RESULT(typechecker.OnMemoryCopy());
+  CHECK_RESULT(EmitOpcode(interpreter::Opcode::MemoryCopy));
+  CHECK_RESULT(EmitI32(module->memory_index));
+  return wabt::Result::Ok;
+}
+
+wabt::Result BinaryReaderInterpreter::OnMemoryFillExpr() {
+  CHECK_RESULT(CheckHasMemory(wabt::Opcode::MemoryFill));
+  CHECK_RESULT(typechecker.OnMemoryFill());
+  CHECK_RESULT(EmitOpcode(interpreter::Opcode::MemoryFill));
+  CHECK_RESULT(EmitI32(module->memory_index));
+  return wabt::Result::Ok;
+}
+
 wabt::Result BinaryReaderInterpreter::OnNopExpr() {
   return wabt::Result::Ok;
 }
@@ -1414,6 +1776,57 @@ wabt::Result BinaryReaderInterpreter::OnReturnExpr() {
   return wabt::Result::Ok;
 }
 
+// A return_call of a defined function drops the current frame, leaving only
+// the callee's arguments, and jumps to the callee without pushing a return
+// address, so the callee returns directly to the current function's caller.
+// Host functions don't use the call stack, so they are called as usual and
+// followed by a normal return.
+wabt::Result BinaryReaderInterpreter::OnReturnCallExpr(Index func_index) {
+  Func* func = GetFuncByModuleIndex(func_index);
+  FuncSignature* sig = env->GetFuncSignature(func->sig_index);
+  Index drop_count;
+  CHECK_RESULT(
+      GetReturnCallDropKeepCount(sig->param_types.size(), &drop_count));
+  CHECK_RESULT(
+      typechecker.OnReturnCall(&sig->param_types, &sig->result_types));
+
+  if (func->is_host) {
+    CHECK_RESULT(EmitOpcode(interpreter::Opcode::CallHost));
+    CHECK_RESULT(EmitI32(TranslateFuncIndexToEnv(func_index)));
+    CHECK_RESULT(EmitDropKeep(drop_count, sig->result_types.size()));
+    CHECK_RESULT(EmitOpcode(interpreter::Opcode::Return));
+  } else {
+    CHECK_RESULT(EmitDropKeep(drop_count, sig->param_types.size()));
+    CHECK_RESULT(EmitOpcode(interpreter::Opcode::ReturnCall));
+    CHECK_RESULT(EmitFuncOffset(func->as_defined(), func_index));
+    CHECK_RESULT(EmitFuncMemoryIndex(func->as_defined(), func_index));
+  }
+  return wabt::Result::Ok;
+}
+
+// The callee is only known at run time, so ReturnCallIndirect does the
+// DropKeep itself. When the callee is a host function it falls through to the
+// normal return sequence emitted after it.
+wabt::Result BinaryReaderInterpreter::OnReturnCallIndirectExpr(
+    Index sig_index) {
+  CHECK_RESULT(checker.CheckHasTable(wabt::Opcode::ReturnCallIndirect,
+                                     module->table_index != kInvalidIndex));
+  FuncSignature* sig = GetSignatureByModuleIndex(sig_index);
+  Index drop_count;
+  CHECK_RESULT(
+      GetReturnCallDropKeepCount(sig->param_types.size() + 1, &drop_count));
+  CHECK_RESULT(typechecker.OnReturnCallIndirect(&sig->param_types,
+                                                &sig->result_types));
+
+  CHECK_RESULT(EmitOpcode(interpreter::Opcode::ReturnCallIndirect));
+  CHECK_RESULT(EmitI32(module->table_index));
+  CHECK_RESULT(EmitI32(TranslateSigIndexToEnv(sig_index)));
+  CHECK_RESULT(EmitI32(drop_count));
+  CHECK_RESULT(EmitDropKeep(drop_count, sig->result_types.size()));
+  CHECK_RESULT(EmitOpcode(interpreter::Opcode::Return));
+  return wabt::Result::Ok;
+}
+
 wabt::Result BinaryReaderInterpreter::OnSelectExpr() {
   CHECK_RESULT(typechecker.OnSelect());
   CHECK_RESULT(EmitOpcode(interpreter::Opcode::Select));
@@ -1430,8 +1843,10 @@ wabt::Result BinaryReaderInterpreter::EndModule() {
   for (ElemSegmentInfo& info : elem_segment_infos) {
     *info.dst = info.func_index;
   }
+  if (!elem_segment_infos.empty())
+    env->InvalidateCallIndirectCaches();
   for (DataSegmentInfo& info : data_segment_infos) {
-    memcpy(info.dst_data, info.src_data, info.size);
+    memcpy(info.dst_data, info.data.data(), info.data.size());
   }
   return wabt::Result::Ok;
 }
@@ -1455,7 +1870,7 @@ wabt::Result read_binary_interpreter(Environment* env,
                                  error_handler);
   env->EmplaceBackModule(module);
 
-  wabt::Result result = read_binary(data, size, &reader, options);
+  wabt::Result result = read_binary_static(data, size, &reader, options);
   env->SetIstream(reader.ReleaseOutputBuffer());
 
   if (Succeeded(result)) {
@@ -1469,4 +1884,89 @@ wabt::Result read_binary_interpreter(Environment* env,
   return result;
 }
 
+struct StreamingInterpreterReader::Impl {
+  Impl(Environment* env,
+       const ReadBinaryOptions* options,
+       ErrorHandler* error_handler);
+
+  wabt::Result Push(const void* data, size_t size);
+  wabt::Result Finish();
+
+  Environment* env;
+  // Need to mark before taking ownership of env->istream.
+  Environment::MarkPoint mark;
+  IstreamOffset istream_offset;
+  DefinedModule* module;
+  BinaryReaderInterpreter reader;
+  BinaryReaderLogging logging_reader;
+  // Only one of these is set, depending on whether the reader logs.
+  std::unique_ptr<StreamingBinaryReader<BinaryReaderInterpreter>> stream;
+  std::unique_ptr<StreamingBinaryReader<BinaryReaderDelegate>> logging_stream;
+  bool finished = false;
+};
+
+StreamingInterpreterReader::Impl::Impl(Environment* env,
+                                       const ReadBinaryOptions* options,
+                                       ErrorHandler* error_handler)
+    : env(env),
+      mark(env->Mark()),
+      istream_offset(env->istream().size()),
+      module(new DefinedModule()),
+      reader(env, module, env->ReleaseIstream(), error_handler),
+      logging_reader(options->log_stream, &reader) {
+  env->EmplaceBackModule(module);
+  if (options->log_stream) {
+    logging_stream.reset(new StreamingBinaryReader<BinaryReaderDelegate>(
+        &logging_reader, options));
+  } else {
+    stream.reset(
+        new StreamingBinaryReader<BinaryReaderInterpreter>(&reader, options));
+  }
+}
+
+wabt::Result StreamingInterpreterReader::Impl::Push(const void* data,
+                                                    size_t size) {
+  return stream ? stream->Push(data, size) : logging_stream->Push(data, size);
+}
+
+wabt::Result StreamingInterpreterReader::Impl::Finish() {
+  return stream ? stream->Finish() : logging_stream->Finish();
+}
+
+StreamingInterpreterReader::StreamingInterpreterReader(
+    Environment* env,
+    const ReadBinaryOptions* options,
+    ErrorHandler* error_handler)
+    : impl_(new Impl(env, options, error_handler)) {}
+
+StreamingInterpreterReader::~StreamingInterpreterReader() {
+  if (!impl_->finished) {
+    impl_->env->SetIstream(impl_->reader.ReleaseOutputBuffer());
+    impl_->env->ResetToMarkPoint(impl_->mark);
+  }
+}
+
+wabt::Result StreamingInterpreterReader::Push(const void* data, size_t size) {
+  assert(!impl_->finished);
+  return impl_->Push(data, size);
+}
+
+wabt::Result StreamingInterpreterReader::Finish(DefinedModule** out_module) {
+  assert(!impl_->finished);
+  wabt::Result result = impl_->Finish();
+  impl_->finished = true;
+  Environment* env = impl_->env;
+  env->SetIstream(impl_->reader.ReleaseOutputBuffer());
+
+  if (Succeeded(result)) {
+    impl_->module->istream_start = impl_->istream_offset;
+    impl_->module->istream_end = env->istream().size();
+    *out_module = impl_->module;
+  } else {
+    env->ResetToMarkPoint(impl_->mark);
+    *out_module = nullptr;
+  }
+  return result;
+}
+
 }  // namespace wabt
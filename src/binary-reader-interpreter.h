@@ -17,6 +17,8 @@
 #ifndef WABT_BINARY_READER_INTERPRETER_H_
 #define WABT_BINARY_READER_INTERPRETER_H_
 
+#include <memory>
+
 #include "common.h"
 
 namespace wabt {
@@ -38,6 +40,26 @@ Result read_binary_interpreter(interpreter::Environment* env,
                                ErrorHandler*,
                                interpreter::DefinedModule** out_module);
 
+// Like read_binary_interpreter, but for a module that arrives in pieces, e.g.
+// from a pipe or a socket: each section, and each function body, is compiled
+// as soon as its bytes have been pushed. |env| can't be used until Finish()
+// returns; if the reader is destroyed first, |env| is left unchanged.
+class StreamingInterpreterReader {
+ public:
+  WABT_DISALLOW_COPY_AND_ASSIGN(StreamingInterpreterReader);
+  StreamingInterpreterReader(interpreter::Environment* env,
+                             const ReadBinaryOptions* options,
+                             ErrorHandler*);
+  ~StreamingInterpreterReader();
+
+  Result Push(const void* data, size_t size);
+  Result Finish(interpreter::DefinedModule** out_module);
+
+ private:
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
 }  // namespace wabt
 
 #endif /* WABT_BINARY_READER_INTERPRETER_H_ */
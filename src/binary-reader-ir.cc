@@ -21,8 +21,10 @@
 #include <cstdarg>
 #include <cstdint>
 #include <cstdio>
+#include <utility>
 #include <vector>
 
+#include "binary-reader-impl.h"
 #include "binary-reader-nop.h"
 #include "cast.h"
 #include "common.h"
@@ -51,7 +53,7 @@ LabelNode::LabelNode(LabelType label_type, ExprList* exprs)
     : label_type(label_type), exprs(exprs), context(nullptr) {}
 
 
-class BinaryReaderIR : public BinaryReaderNop {
+class BinaryReaderIR final : public BinaryReaderNop {
  public:
   BinaryReaderIR(Module* out_module,
                  const char* filename,
@@ -126,6 +128,24 @@ class BinaryReaderIR : public BinaryReaderNop {
   Result BeginFunctionBody(Index index) override;
   Result OnLocalDecl(Index decl_index, Index count, Type type) override;
 
+  Result OnAtomicLoadExpr(Opcode opcode,
+                          uint32_t alignment_log2,
+                          Address offset) override;
+  Result OnAtomicNotifyExpr(Opcode opcode,
+                            uint32_t alignment_log2,
+                            Address offset) override;
+  Result OnAtomicRmwExpr(Opcode opcode,
+                         uint32_t alignment_log2,
+                         Address offset) override;
+  Result OnAtomicRmwCmpxchgExpr(Opcode opcode,
+                                uint32_t alignment_log2,
+                                Address offset) override;
+  Result OnAtomicStoreExpr(Opcode opcode,
+                           uint32_t alignment_log2,
+                           Address offset) override;
+  Result OnAtomicWaitExpr(Opcode opcode,
+                          uint32_t alignment_log2,
+                          Address offset) override;
   Result OnBinaryExpr(Opcode opcode) override;
   Result OnBlockExpr(Index num_types, Type* sig_types) override;
   Result OnBrExpr(Index depth) override;
@@ -154,13 +174,18 @@ class BinaryReaderIR : public BinaryReaderNop {
                     uint32_t alignment_log2,
                     Address offset) override;
   Result OnLoopExpr(Index num_types, Type* sig_types) override;
+  Result OnMemoryCopyExpr() override;
+  Result OnMemoryFillExpr() override;
   Result OnCurrentMemoryExpr() override;
   Result OnNopExpr() override;
   Result OnRethrowExpr(Index depth) override;
   Result OnReturnExpr() override;
+  Result OnReturnCallExpr(Index func_index) override;
+  Result OnReturnCallIndirectExpr(Index sig_index) override;
   Result OnSelectExpr() override;
   Result OnSetGlobalExpr(Index global_index) override;
   Result OnSetLocalExpr(Index local_index) override;
+  Result OnSimdLaneOpExpr(Opcode opcode, uint32_t lane) override;
   Result OnStoreExpr(Opcode opcode,
                      uint32_t alignment_log2,
                      Address offset) override;
@@ -169,6 +194,7 @@ class BinaryReaderIR : public BinaryReaderNop {
   Result OnTryExpr(Index num_types, Type* sig_types) override;
   Result OnUnaryExpr(Opcode opcode) override;
   Result OnUnreachableExpr() override;
+  Result OnV128ConstExpr(v128 value_bits) override;
   Result EndFunctionBody(Index index) override;
 
   Result OnElemSegmentCount(Index count) override;
@@ -219,6 +245,13 @@ class BinaryReaderIR : public BinaryReaderNop {
   Result AppendExpr(Expr* expr);
   Result AppendCatch(Catch* catch_);
 
+  // The Exprs are allocated in the module's arena, which saves allocating and
+  // freeing each one on its own.
+  template <typename T, typename... Args>
+  T* MakeExpr(Args&&... args) {
+    return MakeArenaExpr<T>(&module->expr_arena, std::forward<Args>(args)...);
+  }
+
   ErrorHandler* error_handler = nullptr;
   Module* module = nullptr;
 
@@ -541,13 +574,56 @@ Result BinaryReaderIR::OnLocalDecl(Index decl_index, Index count, Type type) {
   return Result::Ok;
 }
 
+Result BinaryReaderIR::OnAtomicLoadExpr(Opcode opcode,
+                                        uint32_t alignment_log2,
+                                        Address offset) {
+  auto expr = MakeExpr<AtomicLoadExpr>(opcode, 1 << alignment_log2, offset);
+  return AppendExpr(expr);
+}
+
+Result BinaryReaderIR::OnAtomicNotifyExpr(Opcode opcode,
+                                          uint32_t alignment_log2,
+                                          Address offset) {
+  auto expr = MakeExpr<AtomicNotifyExpr>(opcode, 1 << alignment_log2, offset);
+  return AppendExpr(expr);
+}
+
+Result BinaryReaderIR::OnAtomicRmwExpr(Opcode opcode,
+                                       uint32_t alignment_log2,
+                                       Address offset) {
+  auto expr = MakeExpr<AtomicRmwExpr>(opcode, 1 << alignment_log2, offset);
+  return AppendExpr(expr);
+}
+
+Result BinaryReaderIR::OnAtomicRmwCmpxchgExpr(Opcode opcode,
+                                              uint32_t alignment_log2,
+                                              Address offset) {
+  auto expr =
+      MakeExpr<AtomicRmwCmpxchgExpr>(opcode, 1 << alignment_log2, offset);
+  return AppendExpr(expr);
+}
+
+Result BinaryReaderIR::OnAtomicStoreExpr(Opcode opcode,
+                                         uint32_t alignment_log2,
+                                         Address offset) {
+  auto expr = MakeExpr<AtomicStoreExpr>(opcode, 1 << alignment_log2, offset);
+  return AppendExpr(expr);
+}
+
+Result BinaryReaderIR::OnAtomicWaitExpr(Opcode opcode,
+                                        uint32_t alignment_log2,
+                                        Address offset) {
+  auto expr = MakeExpr<AtomicWaitExpr>(opcode, 1 << alignment_log2, offset);
+  return AppendExpr(expr);
+}
+
 Result BinaryReaderIR::OnBinaryExpr(Opcode opcode) {
-  auto expr = new BinaryExpr(opcode);
+  auto expr = MakeExpr<BinaryExpr>(opcode);
   return AppendExpr(expr);
 }
 
 Result BinaryReaderIR::OnBlockExpr(Index num_types, Type* sig_types) {
-  auto expr = new BlockExpr(new Block());
+  auto expr = MakeExpr<BlockExpr>(new Block());
   expr->block->sig.assign(sig_types, sig_types + num_types);
   if (Failed(AppendExpr(expr)))
       return Result::Error;
@@ -556,12 +632,12 @@ Result BinaryReaderIR::OnBlockExpr(Index num_types, Type* sig_types) {
 }
 
 Result BinaryReaderIR::OnBrExpr(Index depth) {
-  auto expr = new BrExpr(Var(depth, GetLocation()));
+  auto expr = MakeExpr<BrExpr>(Var(depth, GetLocation()));
   return AppendExpr(expr);
 }
 
 Result BinaryReaderIR::OnBrIfExpr(Index depth) {
-  auto expr = new BrIfExpr(Var(depth, GetLocation()));
+  auto expr = MakeExpr<BrIfExpr>(Var(depth, GetLocation()));
   return AppendExpr(expr);
 }
 
@@ -573,40 +649,40 @@ Result BinaryReaderIR::OnBrTableExpr(Index num_targets,
   for (Index i = 0; i < num_targets; ++i) {
     (*targets)[i] = Var(target_depths[i]);
   }
-  auto expr = new BrTableExpr(targets,
+  auto expr = MakeExpr<BrTableExpr>(targets,
                               Var(default_target_depth, GetLocation()));
   return AppendExpr(expr);
 }
 
 Result BinaryReaderIR::OnCallExpr(Index func_index) {
   assert(func_index < module->funcs.size());
-  auto expr = new CallExpr(Var(func_index, GetLocation()));
+  auto expr = MakeExpr<CallExpr>(Var(func_index, GetLocation()));
   return AppendExpr(expr);
 }
 
 Result BinaryReaderIR::OnCallIndirectExpr(Index sig_index) {
   assert(sig_index < module->func_types.size());
-  auto expr = new CallIndirectExpr(Var(sig_index, GetLocation()));
+  auto expr = MakeExpr<CallIndirectExpr>(Var(sig_index, GetLocation()));
   return AppendExpr(expr);
 }
 
 Result BinaryReaderIR::OnCompareExpr(Opcode opcode) {
-  auto expr = new CompareExpr(opcode);
+  auto expr = MakeExpr<CompareExpr>(opcode);
   return AppendExpr(expr);
 }
 
 Result BinaryReaderIR::OnConvertExpr(Opcode opcode) {
-  auto expr = new ConvertExpr(opcode);
+  auto expr = MakeExpr<ConvertExpr>(opcode);
   return AppendExpr(expr);
 }
 
 Result BinaryReaderIR::OnCurrentMemoryExpr() {
-  auto expr = new CurrentMemoryExpr();
+  auto expr = MakeExpr<CurrentMemoryExpr>();
   return AppendExpr(expr);
 }
 
 Result BinaryReaderIR::OnDropExpr() {
-  auto expr = new DropExpr();
+  auto expr = MakeExpr<DropExpr>();
   return AppendExpr(expr);
 }
 
@@ -631,42 +707,44 @@ Result BinaryReaderIR::OnEndExpr() {
 }
 
 Result BinaryReaderIR::OnF32ConstExpr(uint32_t value_bits) {
-  auto expr = new ConstExpr(Const(Const::F32(), value_bits, GetLocation()));
+  auto expr =
+      MakeExpr<ConstExpr>(Const(Const::F32(), value_bits, GetLocation()));
   return AppendExpr(expr);
 }
 
 Result BinaryReaderIR::OnF64ConstExpr(uint64_t value_bits) {
-  auto expr = new ConstExpr(Const(Const::F64(), value_bits, GetLocation()));
+  auto expr =
+      MakeExpr<ConstExpr>(Const(Const::F64(), value_bits, GetLocation()));
   return AppendExpr(expr);
 }
 
 Result BinaryReaderIR::OnGetGlobalExpr(Index global_index) {
-  auto expr = new GetGlobalExpr(Var(global_index, GetLocation()));
+  auto expr = MakeExpr<GetGlobalExpr>(Var(global_index, GetLocation()));
   return AppendExpr(expr);
 }
 
 Result BinaryReaderIR::OnGetLocalExpr(Index local_index) {
-  auto expr = new GetLocalExpr(Var(local_index, GetLocation()));
+  auto expr = MakeExpr<GetLocalExpr>(Var(local_index, GetLocation()));
   return AppendExpr(expr);
 }
 
 Result BinaryReaderIR::OnGrowMemoryExpr() {
-  auto expr = new GrowMemoryExpr();
+  auto expr = MakeExpr<GrowMemoryExpr>();
   return AppendExpr(expr);
 }
 
 Result BinaryReaderIR::OnI32ConstExpr(uint32_t value) {
-  auto expr = new ConstExpr(Const(Const::I32(), value, GetLocation()));
+  auto expr = MakeExpr<ConstExpr>(Const(Const::I32(), value, GetLocation()));
   return AppendExpr(expr);
 }
 
 Result BinaryReaderIR::OnI64ConstExpr(uint64_t value) {
-  auto expr = new ConstExpr(Const(Const::I64(), value, GetLocation()));
+  auto expr = MakeExpr<ConstExpr>(Const(Const::I64(), value, GetLocation()));
   return AppendExpr(expr);
 }
 
 Result BinaryReaderIR::OnIfExpr(Index num_types, Type* sig_types) {
-  auto expr = new IfExpr(new Block());
+  auto expr = MakeExpr<IfExpr>(new Block());
   expr->true_->sig.assign(sig_types, sig_types + num_types);
   if (Failed(AppendExpr(expr)))
     return Result::Error;
@@ -677,12 +755,12 @@ Result BinaryReaderIR::OnIfExpr(Index num_types, Type* sig_types) {
 Result BinaryReaderIR::OnLoadExpr(Opcode opcode,
                                   uint32_t alignment_log2,
                                   Address offset) {
-  auto expr = new LoadExpr(opcode, 1 << alignment_log2, offset);
+  auto expr = MakeExpr<LoadExpr>(opcode, 1 << alignment_log2, offset);
   return AppendExpr(expr);
 }
 
 Result BinaryReaderIR::OnLoopExpr(Index num_types, Type* sig_types) {
-  auto expr = new LoopExpr(new Block());
+  auto expr = MakeExpr<LoopExpr>(new Block());
   expr->block->sig.assign(sig_types, sig_types + num_types);
   if (Failed(AppendExpr(expr)))
     return Result::Error;
@@ -690,53 +768,80 @@ Result BinaryReaderIR::OnLoopExpr(Index num_types, Type* sig_types) {
   return Result::Ok;
 }
 
+Result BinaryReaderIR::OnMemoryCopyExpr() {
+  auto expr = MakeExpr<MemoryCopyExpr>();
+  return AppendExpr(expr);
+}
+
+Result BinaryReaderIR::OnMemoryFillExpr() {
+  auto expr = MakeExpr<MemoryFillExpr>();
+  return AppendExpr(expr);
+}
+
 Result BinaryReaderIR::OnNopExpr() {
-  auto expr = new NopExpr();
+  auto expr = MakeExpr<NopExpr>();
   return AppendExpr(expr);
 }
 
 Result BinaryReaderIR::OnRethrowExpr(Index depth) {
-  return AppendExpr(new RethrowExpr(Var(depth, GetLocation())));
+  return AppendExpr(MakeExpr<RethrowExpr>(Var(depth, GetLocation())));
 }
 
 Result BinaryReaderIR::OnReturnExpr() {
-  auto expr = new ReturnExpr();
+  auto expr = MakeExpr<ReturnExpr>();
+  return AppendExpr(expr);
+}
+
+Result BinaryReaderIR::OnReturnCallExpr(Index func_index) {
+  assert(func_index < module->funcs.size());
+  auto expr = MakeExpr<ReturnCallExpr>(Var(func_index, GetLocation()));
+  return AppendExpr(expr);
+}
+
+Result BinaryReaderIR::OnReturnCallIndirectExpr(Index sig_index) {
+  assert(sig_index < module->func_types.size());
+  auto expr = MakeExpr<ReturnCallIndirectExpr>(Var(sig_index, GetLocation()));
   return AppendExpr(expr);
 }
 
 Result BinaryReaderIR::OnSelectExpr() {
-  auto expr = new SelectExpr();
+  auto expr = MakeExpr<SelectExpr>();
   return AppendExpr(expr);
 }
 
 Result BinaryReaderIR::OnSetGlobalExpr(Index global_index) {
-  auto expr = new SetGlobalExpr(Var(global_index, GetLocation()));
+  auto expr = MakeExpr<SetGlobalExpr>(Var(global_index, GetLocation()));
   return AppendExpr(expr);
 }
 
 Result BinaryReaderIR::OnSetLocalExpr(Index local_index) {
-  auto expr = new SetLocalExpr(Var(local_index, GetLocation()));
+  auto expr = MakeExpr<SetLocalExpr>(Var(local_index, GetLocation()));
+  return AppendExpr(expr);
+}
+
+Result BinaryReaderIR::OnSimdLaneOpExpr(Opcode opcode, uint32_t lane) {
+  auto expr = MakeExpr<SimdLaneOpExpr>(opcode, lane);
   return AppendExpr(expr);
 }
 
 Result BinaryReaderIR::OnStoreExpr(Opcode opcode,
                                    uint32_t alignment_log2,
                                    Address offset) {
-  auto expr = new StoreExpr(opcode, 1 << alignment_log2, offset);
+  auto expr = MakeExpr<StoreExpr>(opcode, 1 << alignment_log2, offset);
   return AppendExpr(expr);
 }
 
 Result BinaryReaderIR::OnThrowExpr(Index except_index) {
-  return AppendExpr(new ThrowExpr(Var(except_index, GetLocation())));
+  return AppendExpr(MakeExpr<ThrowExpr>(Var(except_index, GetLocation())));
 }
 
 Result BinaryReaderIR::OnTeeLocalExpr(Index local_index) {
-  auto expr = new TeeLocalExpr(Var(local_index, GetLocation()));
+  auto expr = MakeExpr<TeeLocalExpr>(Var(local_index, GetLocation()));
   return AppendExpr(expr);
 }
 
 Result BinaryReaderIR::OnTryExpr(Index num_types, Type* sig_types) {
-  auto expr = new TryExpr();
+  auto expr = MakeExpr<TryExpr>();
   expr->block = new Block();
   expr->block->sig.assign(sig_types, sig_types + num_types);
   if (Failed(AppendExpr(expr)))
@@ -780,12 +885,18 @@ Result BinaryReaderIR::OnCatchAllExpr() {
 }
 
 Result BinaryReaderIR::OnUnaryExpr(Opcode opcode) {
-  auto expr = new UnaryExpr(opcode);
+  auto expr = MakeExpr<UnaryExpr>(opcode);
   return AppendExpr(expr);
 }
 
 Result BinaryReaderIR::OnUnreachableExpr() {
-  auto expr = new UnreachableExpr();
+  auto expr = MakeExpr<UnreachableExpr>();
+  return AppendExpr(expr);
+}
+
+Result BinaryReaderIR::OnV128ConstExpr(v128 value_bits) {
+  auto expr = MakeExpr<ConstExpr>(
+      Const(Const::V128(), value_bits, GetLocation()));
   return AppendExpr(expr);
 }
 
@@ -914,14 +1025,14 @@ Result BinaryReaderIR::OnLocalNameLocalCount(Index index, Index count) {
 }
 
 Result BinaryReaderIR::OnInitExprF32ConstExpr(Index index, uint32_t value) {
-  auto expr = new ConstExpr(Const(Const::F32(), value, GetLocation()));
+  auto expr = MakeExpr<ConstExpr>(Const(Const::F32(), value, GetLocation()));
   expr->loc = GetLocation();
   current_init_expr->push_back(expr);
   return Result::Ok;
 }
 
 Result BinaryReaderIR::OnInitExprF64ConstExpr(Index index, uint64_t value) {
-  auto expr = new ConstExpr(Const(Const::F64(), value, GetLocation()));
+  auto expr = MakeExpr<ConstExpr>(Const(Const::F64(), value, GetLocation()));
   expr->loc = GetLocation();
   current_init_expr->push_back(expr);
   return Result::Ok;
@@ -929,21 +1040,21 @@ Result BinaryReaderIR::OnInitExprF64ConstExpr(Index index, uint64_t value) {
 
 Result BinaryReaderIR::OnInitExprGetGlobalExpr(Index index,
                                                Index global_index) {
-  auto expr = new GetGlobalExpr(Var(global_index, GetLocation()));
+  auto expr = MakeExpr<GetGlobalExpr>(Var(global_index, GetLocation()));
   expr->loc = GetLocation();
   current_init_expr->push_back(expr);
   return Result::Ok;
 }
 
 Result BinaryReaderIR::OnInitExprI32ConstExpr(Index index, uint32_t value) {
-  auto expr = new ConstExpr(Const(Const::I32(), value, GetLocation()));
+  auto expr = MakeExpr<ConstExpr>(Const(Const::I32(), value, GetLocation()));
   expr->loc = GetLocation();
   current_init_expr->push_back(expr);
   return Result::Ok;
 }
 
 Result BinaryReaderIR::OnInitExprI64ConstExpr(Index index, uint64_t value) {
-  auto expr = new ConstExpr(Const(Const::I64(), value, GetLocation()));
+  auto expr = MakeExpr<ConstExpr>(Const(Const::I64(), value, GetLocation()));
   expr->loc = GetLocation();
   current_init_expr->push_back(expr);
   return Result::Ok;
@@ -988,7 +1099,7 @@ Result read_binary_ir(const char* filename,
                       ErrorHandler* error_handler,
                       struct Module* out_module) {
   BinaryReaderIR reader(out_module, filename, error_handler);
-  Result result = read_binary(data, size, &reader, options);
+  Result result = read_binary_static(data, size, &reader, options);
   return result;
 }
 
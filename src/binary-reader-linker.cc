@@ -18,6 +18,7 @@
 
 #include <vector>
 
+#include "binary-reader-impl.h"
 #include "binary-reader-nop.h"
 #include "wasm-link.h"
 
@@ -28,7 +29,7 @@ namespace link {
 
 namespace {
 
-class BinaryReaderLinker : public BinaryReaderNop {
+class BinaryReaderLinker final : public BinaryReaderNop {
  public:
   explicit BinaryReaderLinker(LinkerInputBinary* binary);
 
@@ -185,9 +186,8 @@ Result BinaryReaderLinker::BeginSection(BinarySection section_code,
 
   if (sec->section_code != BinarySection::Custom &&
       sec->section_code != BinarySection::Start) {
-    const uint8_t* start = &binary_->data[sec->offset];
-    // Must point to one-past-the-end, but we can't dereference end().
-    const uint8_t* end = &binary_->data.back() + 1;
+    const uint8_t* start = binary_->file.data() + sec->offset;
+    const uint8_t* end = binary_->file.data() + binary_->file.size();
     size_t bytes_read = read_u32_leb128(start, end, &sec->count);
     if (bytes_read == 0)
       WABT_FATAL("error reading section element count\n");
@@ -289,8 +289,8 @@ Result read_binary_linker(LinkerInputBinary* input_info, LinkOptions* options) {
   ReadBinaryOptions read_options;
   read_options.read_debug_names = true;
   read_options.log_stream = options->log_stream;
-  return read_binary(DataOrNull(input_info->data), input_info->data.size(),
-                     &reader, &read_options);
+  return read_binary_static(input_info->file.data(), input_info->file.size(),
+                            &reader, &read_options);
 }
 
 }  // namespace link
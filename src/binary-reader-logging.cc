@@ -323,15 +323,6 @@ Result BinaryReaderLogging::OnIfExpr(Index num_types, Type* sig_types) {
   return reader->OnIfExpr(num_types, sig_types);
 }
 
-Result BinaryReaderLogging::OnLoadExpr(Opcode opcode,
-                                       uint32_t alignment_log2,
-                                       Address offset) {
-  LOGF("OnLoadExpr(opcode: \"%s\" (%u), align log2: %u, offset: %" PRIaddress
-       ")\n",
-       opcode.GetName(), opcode.GetCode(), alignment_log2, offset);
-  return reader->OnLoadExpr(opcode, alignment_log2, offset);
-}
-
 Result BinaryReaderLogging::OnLoopExpr(Index num_types, Type* sig_types) {
   LOGF("OnLoopExpr(sig: ");
   LogTypes(num_types, sig_types);
@@ -339,13 +330,16 @@ Result BinaryReaderLogging::OnLoopExpr(Index num_types, Type* sig_types) {
   return reader->OnLoopExpr(num_types, sig_types);
 }
 
-Result BinaryReaderLogging::OnStoreExpr(Opcode opcode,
-                                        uint32_t alignment_log2,
-                                        Address offset) {
-  LOGF("OnStoreExpr(opcode: \"%s\" (%u), align log2: %u, offset: %" PRIaddress
-       ")\n",
-       opcode.GetName(), opcode.GetCode(), alignment_log2, offset);
-  return reader->OnStoreExpr(opcode, alignment_log2, offset);
+Result BinaryReaderLogging::OnSimdLaneOpExpr(Opcode opcode, uint32_t lane) {
+  LOGF("OnSimdLaneOpExpr(opcode: \"%s\" (%u), lane: %u)\n", opcode.GetName(),
+       opcode.GetCode(), lane);
+  return reader->OnSimdLaneOpExpr(opcode, lane);
+}
+
+Result BinaryReaderLogging::OnV128ConstExpr(v128 value_bits) {
+  LOGF("OnV128ConstExpr(0x%08x 0x%08x 0x%08x 0x%08x)\n", value_bits.v[0],
+       value_bits.v[1], value_bits.v[2], value_bits.v[3]);
+  return reader->OnV128ConstExpr(value_bits);
 }
 
 Result BinaryReaderLogging::OnTryExpr(Index num_types, Type* sig_types) {
@@ -495,6 +489,15 @@ Result BinaryReaderLogging::OnSymbolInfo(string_view name, uint32_t flags) {
     return reader->name(opcode);                                       \
   }
 
+#define DEFINE_LOAD_STORE_OPCODE(name)                                      \
+  Result BinaryReaderLogging::name(Opcode opcode, uint32_t alignment_log2,  \
+                                   Address offset) {                        \
+    LOGF(#name "(opcode: \"%s\" (%u), align log2: %u, offset: %" PRIaddress \
+               ")\n",                                                       \
+         opcode.GetName(), opcode.GetCode(), alignment_log2, offset);       \
+    return reader->name(opcode, alignment_log2, offset);                    \
+  }
+
 #define DEFINE0(name)                  \
   Result BinaryReaderLogging::name() { \
     LOGF(#name "\n");                  \
@@ -546,6 +549,12 @@ DEFINE_INDEX(OnFunctionBodyCount)
 DEFINE_INDEX(BeginFunctionBody)
 DEFINE_INDEX(EndFunctionBody)
 DEFINE_INDEX(OnLocalDeclCount)
+DEFINE_LOAD_STORE_OPCODE(OnAtomicLoadExpr)
+DEFINE_LOAD_STORE_OPCODE(OnAtomicNotifyExpr)
+DEFINE_LOAD_STORE_OPCODE(OnAtomicRmwExpr)
+DEFINE_LOAD_STORE_OPCODE(OnAtomicRmwCmpxchgExpr)
+DEFINE_LOAD_STORE_OPCODE(OnAtomicStoreExpr)
+DEFINE_LOAD_STORE_OPCODE(OnAtomicWaitExpr)
 DEFINE_OPCODE(OnBinaryExpr)
 DEFINE_INDEX_DESC(OnCallExpr, "func_index")
 DEFINE_INDEX_DESC(OnCallIndirectExpr, "sig_index")
@@ -560,12 +569,18 @@ DEFINE0(OnEndExpr)
 DEFINE_INDEX_DESC(OnGetGlobalExpr, "index")
 DEFINE_INDEX_DESC(OnGetLocalExpr, "index")
 DEFINE0(OnGrowMemoryExpr)
+DEFINE_LOAD_STORE_OPCODE(OnLoadExpr)
+DEFINE0(OnMemoryCopyExpr)
+DEFINE0(OnMemoryFillExpr)
 DEFINE0(OnNopExpr)
 DEFINE_INDEX_DESC(OnRethrowExpr, "depth");
 DEFINE0(OnReturnExpr)
+DEFINE_INDEX_DESC(OnReturnCallExpr, "func_index")
+DEFINE_INDEX_DESC(OnReturnCallIndirectExpr, "sig_index")
 DEFINE0(OnSelectExpr)
 DEFINE_INDEX_DESC(OnSetGlobalExpr, "index")
 DEFINE_INDEX_DESC(OnSetLocalExpr, "index")
+DEFINE_LOAD_STORE_OPCODE(OnStoreExpr)
 DEFINE_INDEX_DESC(OnTeeLocalExpr, "index")
 DEFINE_INDEX_DESC(OnThrowExpr, "except_index")
 DEFINE0(OnUnreachableExpr)
@@ -645,6 +660,10 @@ Result BinaryReaderLogging::OnOpcodeF64(uint64_t value) {
   return reader->OnOpcodeF64(value);
 }
 
+Result BinaryReaderLogging::OnOpcodeV128(v128 value) {
+  return reader->OnOpcodeV128(value);
+}
+
 Result BinaryReaderLogging::OnOpcodeBlockSig(Index num_types, Type* sig_types) {
   return reader->OnOpcodeBlockSig(num_types, sig_types);
 }
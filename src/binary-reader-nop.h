@@ -172,10 +172,41 @@ class BinaryReaderNop : public BinaryReaderDelegate {
   Result OnOpcodeUint64(uint64_t value) override { return Result::Ok; }
   Result OnOpcodeF32(uint32_t value) override { return Result::Ok; }
   Result OnOpcodeF64(uint64_t value) override { return Result::Ok; }
+  Result OnOpcodeV128(v128 value) override { return Result::Ok; }
   Result OnOpcodeBlockSig(Index num_types, Type* sig_types) override {
     return Result::Ok;
   }
   Result OnBinaryExpr(Opcode opcode) override { return Result::Ok; }
+  Result OnAtomicLoadExpr(Opcode opcode,
+                          uint32_t alignment_log2,
+                          Address offset) override {
+    return Result::Ok;
+  }
+  Result OnAtomicNotifyExpr(Opcode opcode,
+                            uint32_t alignment_log2,
+                            Address offset) override {
+    return Result::Ok;
+  }
+  Result OnAtomicRmwExpr(Opcode opcode,
+                         uint32_t alignment_log2,
+                         Address offset) override {
+    return Result::Ok;
+  }
+  Result OnAtomicRmwCmpxchgExpr(Opcode opcode,
+                                uint32_t alignment_log2,
+                                Address offset) override {
+    return Result::Ok;
+  }
+  Result OnAtomicStoreExpr(Opcode opcode,
+                           uint32_t alignment_log2,
+                           Address offset) override {
+    return Result::Ok;
+  }
+  Result OnAtomicWaitExpr(Opcode opcode,
+                          uint32_t alignment_log2,
+                          Address offset) override {
+    return Result::Ok;
+  }
   Result OnBlockExpr(Index num_types, Type* sig_types) override {
     return Result::Ok;
   }
@@ -219,14 +250,23 @@ class BinaryReaderNop : public BinaryReaderDelegate {
   Result OnLoopExpr(Index num_types, Type* sig_types) override {
     return Result::Ok;
   }
+  Result OnMemoryCopyExpr() override { return Result::Ok; }
+  Result OnMemoryFillExpr() override { return Result::Ok; }
   Result OnNopExpr() override { return Result::Ok; }
   Result OnRethrowExpr(Index depth) override {
     return AllowIfFutureExceptions();
   }
   Result OnReturnExpr() override { return Result::Ok; }
+  Result OnReturnCallExpr(Index func_index) override { return Result::Ok; }
+  Result OnReturnCallIndirectExpr(Index sig_index) override {
+    return Result::Ok;
+  }
   Result OnSelectExpr() override { return Result::Ok; }
   Result OnSetGlobalExpr(Index global_index) override { return Result::Ok; }
   Result OnSetLocalExpr(Index local_index) override { return Result::Ok; }
+  Result OnSimdLaneOpExpr(Opcode opcode, uint32_t lane) override {
+    return Result::Ok;
+  }
   Result OnStoreExpr(Opcode opcode,
                      uint32_t alignment_log2,
                      Address offset) override {
@@ -241,6 +281,7 @@ class BinaryReaderNop : public BinaryReaderDelegate {
   }
   Result OnUnaryExpr(Opcode opcode) override { return Result::Ok; }
   Result OnUnreachableExpr() override { return Result::Ok; }
+  Result OnV128ConstExpr(v128 value_bits) override { return Result::Ok; }
   Result EndFunctionBody(Index index) override { return Result::Ok; }
   Result EndCodeSection() override { return Result::Ok; }
 
@@ -21,10 +21,14 @@
 #include <cinttypes>
 #include <cstdio>
 #include <cstring>
+#include <memory>
+#include <string>
 #include <vector>
 
+#include "binary-reader-impl.h"
 #include "binary-reader-nop.h"
 #include "literal.h"
+#include "parallel-for.h"
 
 namespace wabt {
 
@@ -37,16 +41,13 @@ class BinaryReaderObjdumpBase : public BinaryReaderNop {
                           ObjdumpOptions* options,
                           ObjdumpState* state);
 
-  Result BeginModule(uint32_t version) override;
-  Result BeginSection(BinarySection section_type, Offset size) override;
-
   Result OnRelocCount(Index count,
                       BinarySection section_code,
                       string_view section_name) override;
 
  protected:
   const char* GetFunctionName(Index index) const;
-  void PrintRelocation(const Reloc& reloc, Offset offset) const;
+  void PrintRelocation(Stream* out, const Reloc& reloc, Offset offset) const;
   Offset GetSectionStart(BinarySection section_code) const {
     return section_starts[static_cast<size_t>(section_code)];
   }
@@ -58,7 +59,6 @@ class BinaryReaderObjdumpBase : public BinaryReaderNop {
   bool print_details = false;
   BinarySection reloc_section = BinarySection::Invalid;
   Offset section_starts[kBinarySectionCount];
-  bool section_found = false;
 };
 
 BinaryReaderObjdumpBase::BinaryReaderObjdumpBase(const uint8_t* data,
@@ -69,54 +69,14 @@ BinaryReaderObjdumpBase::BinaryReaderObjdumpBase(const uint8_t* data,
       objdump_state(objdump_state),
       data(data),
       size(size) {
+  // Sections are read on their own, so where the others start comes from the
+  // index rather than from BeginSection.
   ZeroMemory(section_starts);
+  for (const BinaryIndex::SectionEntry& entry : objdump_state->index.sections)
+    section_starts[static_cast<size_t>(entry.section)] = entry.offset;
   BinaryReaderNop::allow_future_exceptions = options->allow_future_exceptions;
 }
 
-Result BinaryReaderObjdumpBase::BeginSection(BinarySection section_code,
-                                             Offset size) {
-  section_starts[static_cast<size_t>(section_code)] = state->offset;
-  return Result::Ok;
-}
-
-Result BinaryReaderObjdumpBase::BeginModule(uint32_t version) {
-  switch (options->mode) {
-    case ObjdumpMode::Headers:
-      printf("\n");
-      printf("Sections:\n\n");
-      break;
-    case ObjdumpMode::Details:
-      printf("\n");
-      printf("Section Details:\n\n");
-      break;
-    case ObjdumpMode::Disassemble:
-      printf("\n");
-      printf("Code Disassembly:\n\n");
-      break;
-    case ObjdumpMode::Prepass: {
-      const char* last_slash = strrchr(options->filename, '/');
-      const char* last_backslash = strrchr(options->filename, '\\');
-      const char* basename;
-      if (last_slash && last_backslash) {
-        basename = std::max(last_slash, last_backslash) + 1;
-      } else if (last_slash) {
-        basename = last_slash + 1;
-      } else if (last_backslash) {
-        basename = last_backslash + 1;
-      } else {
-        basename = options->filename;
-      }
-
-      printf("%s:\tfile format wasm %#x\n", basename, version);
-      break;
-    }
-    case ObjdumpMode::RawData:
-      break;
-  }
-
-  return Result::Ok;
-}
-
 const char* BinaryReaderObjdumpBase::GetFunctionName(Index index) const {
   if (index >= objdump_state->function_names.size() ||
       objdump_state->function_names[index].empty())
@@ -125,24 +85,25 @@ const char* BinaryReaderObjdumpBase::GetFunctionName(Index index) const {
   return objdump_state->function_names[index].c_str();
 }
 
-void BinaryReaderObjdumpBase::PrintRelocation(const Reloc& reloc,
+void BinaryReaderObjdumpBase::PrintRelocation(Stream* out,
+                                              const Reloc& reloc,
                                               Offset offset) const {
-  printf("           %06" PRIzx ": %-18s %" PRIindex "", offset,
-         get_reloc_type_name(reloc.type), reloc.index);
+  out->Writef("           %06" PRIzx ": %-18s %" PRIindex "", offset,
+              get_reloc_type_name(reloc.type), reloc.index);
   switch (reloc.type) {
     case RelocType::GlobalAddressLEB:
     case RelocType::GlobalAddressSLEB:
     case RelocType::GlobalAddressI32:
-      printf(" + %d", reloc.addend);
+      out->Writef(" + %d", reloc.addend);
       break;
     case RelocType::FuncIndexLEB:
       if (const char* name = GetFunctionName(reloc.index)) {
-        printf(" <%s>", name);
+        out->Writef(" <%s>", name);
       }
     default:
       break;
   }
-  printf("\n");
+  out->Writef("\n");
 }
 
 Result BinaryReaderObjdumpBase::OnRelocCount(Index count,
@@ -152,7 +113,7 @@ Result BinaryReaderObjdumpBase::OnRelocCount(Index count,
   return Result::Ok;
 }
 
-class BinaryReaderObjdumpPrepass : public BinaryReaderObjdumpBase {
+class BinaryReaderObjdumpPrepass final : public BinaryReaderObjdumpBase {
  public:
   using BinaryReaderObjdumpBase::BinaryReaderObjdumpBase;
 
@@ -184,9 +145,20 @@ Result BinaryReaderObjdumpPrepass::OnReloc(RelocType type,
   return Result::Ok;
 }
 
-class BinaryReaderObjdumpDisassemble : public BinaryReaderObjdumpBase {
+class BinaryReaderObjdumpDisassemble final : public BinaryReaderObjdumpBase {
  public:
-  using BinaryReaderObjdumpBase::BinaryReaderObjdumpBase;
+  // The disassembly is written to |out| and errors to |errors|, so that
+  // function bodies can be disassembled in parallel. |next_reloc| is the first
+  // code relocation that is not before the first function body read.
+  BinaryReaderObjdumpDisassemble(const uint8_t* data,
+                                 size_t size,
+                                 ObjdumpOptions* options,
+                                 ObjdumpState* state,
+                                 Stream* out,
+                                 Stream* errors,
+                                 Index next_reloc);
+
+  bool OnError(const char* message) override;
 
   Result BeginFunctionBody(Index index) override;
 
@@ -198,6 +170,7 @@ class BinaryReaderObjdumpDisassemble : public BinaryReaderObjdumpBase {
   Result OnOpcodeUint64(uint64_t value) override;
   Result OnOpcodeF32(uint32_t value) override;
   Result OnOpcodeF64(uint64_t value) override;
+  Result OnOpcodeV128(v128 value) override;
   Result OnOpcodeBlockSig(Index num_types, Type* sig_types) override;
 
   Result OnBrTableExpr(Index num_targets,
@@ -209,28 +182,48 @@ class BinaryReaderObjdumpDisassemble : public BinaryReaderObjdumpBase {
  private:
   void LogOpcode(const uint8_t* data, size_t data_size, const char* fmt, ...);
 
+  Stream* out;
+  Stream* errors;
+  std::string line;  // Reused by LogOpcode.
   Opcode current_opcode = Opcode::Unreachable;
   Offset current_opcode_offset = 0;
   size_t last_opcode_end = 0;
   int indent_level = 0;
-  Index next_reloc = 0;
+  Index next_reloc;
 };
 
+BinaryReaderObjdumpDisassemble::BinaryReaderObjdumpDisassemble(
+    const uint8_t* data,
+    size_t size,
+    ObjdumpOptions* options,
+    ObjdumpState* objdump_state,
+    Stream* out,
+    Stream* errors,
+    Index next_reloc)
+    : BinaryReaderObjdumpBase(data, size, options, objdump_state),
+      out(out),
+      errors(errors),
+      next_reloc(next_reloc) {}
+
+bool BinaryReaderObjdumpDisassemble::OnError(const char* message) {
+  errors->Writef("*ERROR*: @0x%08zx: %s\n", state->offset, message);
+  return true;
+}
+
 Result BinaryReaderObjdumpDisassemble::OnOpcode(Opcode opcode) {
   if (options->debug) {
     const char* opcode_name = opcode.GetName();
-    printf("on_opcode: %#" PRIzx ": %s\n", state->offset, opcode_name);
+    out->Writef("on_opcode: %#" PRIzx ": %s\n", state->offset, opcode_name);
   }
 
   if (last_opcode_end) {
-    if (state->offset != last_opcode_end + 1) {
+    if (state->offset != last_opcode_end + opcode.GetLength()) {
       Opcode missing_opcode = Opcode::FromCode(data[last_opcode_end]);
       const char* opcode_name = missing_opcode.GetName();
-      fprintf(stderr,
-              "warning: %#" PRIzx " missing opcode callback at %#" PRIzx
-              " (%#02x=%s)\n",
-              state->offset, last_opcode_end + 1, data[last_opcode_end],
-              opcode_name);
+      errors->Writef("warning: %#" PRIzx " missing opcode callback at %#" PRIzx
+                     " (%#02x=%s)\n",
+                     state->offset, last_opcode_end + 1, data[last_opcode_end],
+                     opcode_name);
       return Result::Error;
     }
   }
@@ -246,18 +239,35 @@ void BinaryReaderObjdumpDisassemble::LogOpcode(const uint8_t* data,
                                                size_t data_size,
                                                const char* fmt,
                                                ...) {
+  static const char kHexDigits[] = "0123456789abcdef";
   Offset offset = current_opcode_offset;
+  Offset opcode_length = current_opcode.GetLength();
+
+  // The line is built up and then written at once, since this is called for
+  // every instruction.
+  line.clear();
+  auto append_byte = [this](uint8_t byte) {
+    line += ' ';
+    line += kHexDigits[byte >> 4];
+    line += kHexDigits[byte & 0xf];
+  };
 
   // Print binary data
-  printf(" %06" PRIzx ": %02x", offset - 1, current_opcode.GetCode());
+  char offset_buffer[32];
+  snprintf(offset_buffer, sizeof(offset_buffer), " %06" PRIzx ":",
+           offset - opcode_length);
+  line += offset_buffer;
+  for (Offset i = offset - opcode_length; i < offset; i++) {
+    append_byte(this->data[i]);
+  }
   for (size_t i = 0; i < data_size && i < IMMEDIATE_OCTET_COUNT;
        i++, offset++) {
-    printf(" %02x", data[offset]);
+    append_byte(data[offset]);
   }
-  for (size_t i = data_size + 1; i < IMMEDIATE_OCTET_COUNT; i++) {
-    printf("   ");
+  for (size_t i = data_size + opcode_length; i < IMMEDIATE_OCTET_COUNT; i++) {
+    line += "   ";
   }
-  printf(" | ");
+  line += " | ";
 
   // Print disassemble
   int indent_level = this->indent_level;
@@ -270,20 +280,18 @@ void BinaryReaderObjdumpDisassemble::LogOpcode(const uint8_t* data,
       break;
   }
   for (int j = 0; j < indent_level; j++) {
-    printf("  ");
+    line += "  ";
   }
 
-  const char* opcode_name = current_opcode.GetName();
-  printf("%s", opcode_name);
+  line += current_opcode.GetName();
   if (fmt) {
-    printf(" ");
-    va_list args;
-    va_start(args, fmt);
-    vprintf(fmt, args);
-    va_end(args);
+    WABT_SNPRINTF_ALLOCA(buffer, length, fmt);
+    line += ' ';
+    line.append(buffer, length);
   }
 
-  printf("\n");
+  line += '\n';
+  out->WriteData(line.data(), line.size());
 
   last_opcode_end = current_opcode_offset + data_size;
 
@@ -292,7 +300,7 @@ void BinaryReaderObjdumpDisassemble::LogOpcode(const uint8_t* data,
     Offset code_start = GetSectionStart(BinarySection::Code);
     Offset abs_offset = code_start + reloc.offset;
     if (last_opcode_end > abs_offset) {
-      PrintRelocation(reloc, abs_offset);
+      PrintRelocation(out, reloc, abs_offset);
       next_reloc++;
     }
   }
@@ -306,10 +314,13 @@ Result BinaryReaderObjdumpDisassemble::OnOpcodeBare() {
 Result BinaryReaderObjdumpDisassemble::OnOpcodeIndex(Index value) {
   Offset immediate_len = state->offset - current_opcode_offset;
   const char *name;
-  if (current_opcode == Opcode::Call && (name = GetFunctionName(value)))
+  if ((current_opcode == Opcode::Call ||
+       current_opcode == Opcode::ReturnCall) &&
+      (name = GetFunctionName(value))) {
     LogOpcode(data, immediate_len, "%d <%s>", value, name);
-  else
+  } else {
     LogOpcode(data, immediate_len, "%d", value);
+  }
   return Result::Ok;
 }
 
@@ -348,6 +359,13 @@ Result BinaryReaderObjdumpDisassemble::OnOpcodeF64(uint64_t value) {
   return Result::Ok;
 }
 
+Result BinaryReaderObjdumpDisassemble::OnOpcodeV128(v128 value) {
+  Offset immediate_len = state->offset - current_opcode_offset;
+  LogOpcode(data, immediate_len, "0x%08x 0x%08x 0x%08x 0x%08x", value.v[0],
+            value.v[1], value.v[2], value.v[3]);
+  return Result::Ok;
+}
+
 Result BinaryReaderObjdumpDisassemble::OnBrTableExpr(
     Index num_targets,
     Index* target_depths,
@@ -373,9 +391,9 @@ Result BinaryReaderObjdumpDisassemble::OnEndExpr() {
 Result BinaryReaderObjdumpDisassemble::BeginFunctionBody(Index index) {
   const char* name = GetFunctionName(index);
   if (name)
-    printf("%06" PRIzx " <%s>:\n", state->offset, name);
+    out->Writef("%06" PRIzx " <%s>:\n", state->offset, name);
   else
-    printf("%06" PRIzx " func[%" PRIindex "]:\n", state->offset, index);
+    out->Writef("%06" PRIzx " func[%" PRIindex "]:\n", state->offset, index);
 
   last_opcode_end = 0;
   return Result::Ok;
@@ -395,6 +413,9 @@ const char* type_name(Type type) {
     case Type::F64:
       return "f64";
 
+    case Type::V128:
+      return "v128";
+
     default:
       assert(0);
       return "INVALID TYPE";
@@ -403,10 +424,18 @@ const char* type_name(Type type) {
 
 Result BinaryReaderObjdumpDisassemble::OnOpcodeBlockSig(Index num_types,
                                                         Type* sig_types) {
-  if (num_types)
-    LogOpcode(data, 1, "%s", type_name(*sig_types));
-  else
-    LogOpcode(data, 1, nullptr);
+  Offset immediate_len = state->offset - current_opcode_offset;
+  if (num_types) {
+    std::string types;
+    for (Index i = 0; i < num_types; ++i) {
+      if (i != 0)
+        types += ' ';
+      types += type_name(sig_types[i]);
+    }
+    LogOpcode(data, immediate_len, "%s", types.c_str());
+  } else {
+    LogOpcode(data, immediate_len, nullptr);
+  }
   indent_level++;
   return Result::Ok;
 }
@@ -430,25 +459,22 @@ struct InitExpr {
   } value;
 };
 
-class BinaryReaderObjdump : public BinaryReaderObjdumpBase {
+class BinaryReaderObjdump final : public BinaryReaderObjdumpBase {
  public:
   BinaryReaderObjdump(const uint8_t* data,
                       size_t size,
                       ObjdumpOptions* options,
                       ObjdumpState* state);
 
-  Result EndModule() override;
   Result BeginSection(BinarySection section_type, Offset size) override;
   Result BeginCustomSection(Offset size, string_view section_name) override;
 
-  Result OnTypeCount(Index count) override;
   Result OnType(Index index,
                 Index param_count,
                 Type* param_types,
                 Index result_count,
                 Type* result_types) override;
 
-  Result OnImportCount(Index count) override;
   Result OnImportFunc(Index import_index,
                       string_view module_name,
                       string_view field_name,
@@ -478,21 +504,16 @@ class BinaryReaderObjdump : public BinaryReaderObjdumpBase {
                            TypeVector& sig) override;
 
 
-  Result OnFunctionCount(Index count) override;
   Result OnFunction(Index index, Index sig_index) override;
 
-  Result OnTableCount(Index count) override;
   Result OnTable(Index index,
                  Type elem_type,
                  const Limits* elem_limits) override;
 
-  Result OnMemoryCount(Index count) override;
   Result OnMemory(Index index, const Limits* limits) override;
 
-  Result OnGlobalCount(Index count) override;
   Result BeginGlobal(Index index, Type type, bool mutable_) override;
 
-  Result OnExportCount(Index count) override;
   Result OnExport(Index index,
                   ExternalKind kind,
                   Index item_index,
@@ -500,22 +521,20 @@ class BinaryReaderObjdump : public BinaryReaderObjdumpBase {
 
   Result OnStartFunction(Index func_index) override;
 
-  Result OnFunctionBodyCount(Index count) override;
 
-  Result OnElemSegmentCount(Index count) override;
   Result BeginElemSegment(Index index, Index table_index) override;
   Result OnElemSegmentFunctionIndex(Index segment_index,
                                     Index func_index) override;
 
   Result BeginDataSection(Offset size) override {
     in_data_section_ = true;
+    read_data_section_ = true;
     return Result::Ok;
   }
   Result EndDataSection() override {
     in_data_section_ = false;
     return Result::Ok;
   }
-  Result OnDataSegmentCount(Index count) override;
   Result BeginDataSegment(Index index, Index memory_index) override;
   Result OnDataSegmentData(Index index,
                            const void* data,
@@ -545,19 +564,22 @@ class BinaryReaderObjdump : public BinaryReaderObjdumpBase {
   Result OnSymbolInfoCount(Index count) override;
   Result OnSymbolInfo(string_view name, uint32_t flags) override;
 
-  Result OnExceptionCount(Index count) override;
   Result OnExceptionType(Index index, TypeVector& sig)  override;
 
+  // Fails if the data section was read but some of its relocations were not
+  // printed.
+  Result CheckDataRelocations();
+
  private:
   bool ShouldPrintDetails();
   void PrintDetails(const char* fmt, ...);
   void PrintInitExpr(const InitExpr &expr);
-  Result OnCount(Index count);
 
   std::unique_ptr<FileStream> out_stream_;
   Index elem_index_ = 0;
   Index next_data_reloc_ = 0;
   bool in_data_section_ = false;
+  bool read_data_section_ = false;
   InitExpr data_init_expr_;
 };
 
@@ -572,49 +594,18 @@ Result BinaryReaderObjdump::BeginCustomSection(Offset size,
                                                string_view section_name) {
   PrintDetails(" - name: \"" PRIstringview "\"\n",
                WABT_PRINTF_STRING_VIEW_ARG(section_name));
-  if (options->mode == ObjdumpMode::Headers) {
-    printf("\"" PRIstringview "\"\n",
-           WABT_PRINTF_STRING_VIEW_ARG(section_name));
-  }
   return Result::Ok;
 }
 
 Result BinaryReaderObjdump::BeginSection(BinarySection section_code,
                                          Offset size) {
-  BinaryReaderObjdumpBase::BeginSection(section_code, size);
-
   const char* name = get_section_name(section_code);
-
-  bool section_match =
-      !options->section_name || !strcasecmp(options->section_name, name);
-  if (section_match)
-    section_found = true;
-
-  switch (options->mode) {
-    case ObjdumpMode::Headers:
-      printf("%9s start=%#010" PRIzx " end=%#010" PRIzx
-             " (size=%#010" PRIoffset ") ",
-             name, state->offset, state->offset + size, size);
-      break;
-    case ObjdumpMode::Details:
-      if (section_match) {
-        if (section_code != BinarySection::Code)
-          printf("%s:\n", name);
-        print_details = true;
-      } else {
-        print_details = false;
-      }
-      break;
-    case ObjdumpMode::RawData:
-      if (section_match) {
-        printf("\nContents of section %s:\n", name);
-        out_stream_->WriteMemoryDump(data + state->offset, size, state->offset,
-                                     PrintChars::Yes);
-      }
-      break;
-    case ObjdumpMode::Prepass:
-    case ObjdumpMode::Disassemble:
-      break;
+  if (!options->section_name || !strcasecmp(options->section_name, name)) {
+    if (section_code != BinarySection::Code)
+      printf("%s:\n", name);
+    print_details = true;
+  } else {
+    print_details = false;
   }
   return Result::Ok;
 }
@@ -635,20 +626,8 @@ void WABT_PRINTF_FORMAT(2, 3)
   va_end(args);
 }
 
-Result BinaryReaderObjdump::OnCount(Index count) {
-  if (options->mode == ObjdumpMode::Headers) {
-    printf("count: %" PRIindex "\n", count);
-  }
-  return Result::Ok;
-}
-
-Result BinaryReaderObjdump::EndModule() {
-  if (options->section_name && !section_found) {
-    fprintf(stderr, "Section not found: %s\n", options->section_name);
-    return Result::Error;
-  }
-
-  if (options->relocs) {
+Result BinaryReaderObjdump::CheckDataRelocations() {
+  if (options->relocs && read_data_section_) {
     if (next_data_reloc_ != objdump_state->data_relocations.size()) {
       fprintf(stderr, "Data reloctions outside of segments\n");
       return Result::Error;
@@ -658,10 +637,6 @@ Result BinaryReaderObjdump::EndModule() {
   return Result::Ok;
 }
 
-Result BinaryReaderObjdump::OnTypeCount(Index count) {
-  return OnCount(count);
-}
-
 Result BinaryReaderObjdump::OnType(Index index,
                                    Index param_count,
                                    Type* param_types,
@@ -685,10 +660,6 @@ Result BinaryReaderObjdump::OnType(Index index,
   return Result::Ok;
 }
 
-Result BinaryReaderObjdump::OnFunctionCount(Index count) {
-  return OnCount(count);
-}
-
 Result BinaryReaderObjdump::OnFunction(Index index, Index sig_index) {
   PrintDetails(" - func[%" PRIindex "] sig=%" PRIindex, index, sig_index);
   if (const char* name = GetFunctionName(index))
@@ -697,23 +668,11 @@ Result BinaryReaderObjdump::OnFunction(Index index, Index sig_index) {
   return Result::Ok;
 }
 
-Result BinaryReaderObjdump::OnFunctionBodyCount(Index count) {
-  return OnCount(count);
-}
-
 Result BinaryReaderObjdump::OnStartFunction(Index func_index) {
-  if (options->mode == ObjdumpMode::Headers) {
-    printf("start: %" PRIindex "\n", func_index);
-  } else {
-    PrintDetails(" - start function: %" PRIindex "\n", func_index);
-  }
+  PrintDetails(" - start function: %" PRIindex "\n", func_index);
   return Result::Ok;
 }
 
-Result BinaryReaderObjdump::OnImportCount(Index count) {
-  return OnCount(count);
-}
-
 Result BinaryReaderObjdump::OnImportFunc(Index import_index,
                                          string_view module_name,
                                          string_view field_name,
@@ -786,23 +745,17 @@ Result BinaryReaderObjdump::OnImportException(Index import_index,
   return Result::Ok;
 }
 
-Result BinaryReaderObjdump::OnMemoryCount(Index count) {
-  return OnCount(count);
-}
-
 Result BinaryReaderObjdump::OnMemory(Index index, const Limits* page_limits) {
   PrintDetails(" - memory[%" PRIindex "] pages: initial=%" PRId64, index,
                page_limits->initial);
   if (page_limits->has_max)
     PrintDetails(" max=%" PRId64, page_limits->max);
+  if (page_limits->is_shared)
+    PrintDetails(" shared");
   PrintDetails("\n");
   return Result::Ok;
 }
 
-Result BinaryReaderObjdump::OnTableCount(Index count) {
-  return OnCount(count);
-}
-
 Result BinaryReaderObjdump::OnTable(Index index,
                                     Type elem_type,
                                     const Limits* elem_limits) {
@@ -814,10 +767,6 @@ Result BinaryReaderObjdump::OnTable(Index index,
   return Result::Ok;
 }
 
-Result BinaryReaderObjdump::OnExportCount(Index count) {
-  return OnCount(count);
-}
-
 Result BinaryReaderObjdump::OnExport(Index index,
                                      ExternalKind kind,
                                      Index item_index,
@@ -844,10 +793,6 @@ Result BinaryReaderObjdump::OnElemSegmentFunctionIndex(Index segment_index,
   return Result::Ok;
 }
 
-Result BinaryReaderObjdump::OnElemSegmentCount(Index count) {
-  return OnCount(count);
-}
-
 Result BinaryReaderObjdump::BeginElemSegment(Index index, Index table_index) {
   PrintDetails(" - segment[%" PRIindex "] table=%" PRIindex "\n", index,
                table_index);
@@ -855,10 +800,6 @@ Result BinaryReaderObjdump::BeginElemSegment(Index index, Index table_index) {
   return Result::Ok;
 }
 
-Result BinaryReaderObjdump::OnGlobalCount(Index count) {
-  return OnCount(count);
-}
-
 Result BinaryReaderObjdump::BeginGlobal(Index index, Type type, bool mutable_) {
   PrintDetails(" - global[%" PRIindex "] %s mutable=%d", index,
                get_type_name(type), mutable_);
@@ -973,10 +914,6 @@ Result BinaryReaderObjdump::OnLocalName(Index func_index,
   return Result::Ok;
 }
 
-Result BinaryReaderObjdump::OnDataSegmentCount(Index count) {
-  return OnCount(count);
-}
-
 Result BinaryReaderObjdump::BeginDataSegment(Index index, Index memory_index) {
   // TODO(sbc): Display memory_index once multiple memories become a thing
   //PrintDetails(" - memory[%" PRIindex "]", memory_index);
@@ -1022,7 +959,8 @@ Result BinaryReaderObjdump::OnDataSegmentData(Index index,
     Offset abs_offset = data_start + reloc.offset;
     if (abs_offset > state->offset)
       break;
-    PrintRelocation(reloc, reloc.offset - segment_offset + voffset);
+    PrintRelocation(out_stream_.get(), reloc,
+                    reloc.offset - segment_offset + voffset);
     next_data_reloc_++;
   }
 
@@ -1075,10 +1013,6 @@ Result BinaryReaderObjdump::OnSymbolInfo(string_view name, uint32_t flags) {
   return Result::Ok;
 }
 
-Result BinaryReaderObjdump::OnExceptionCount(Index count) {
-  return OnCount(count);
-}
-
 Result BinaryReaderObjdump::OnExceptionType(
     Index index, TypeVector& sig) {
   if (!ShouldPrintDetails())
@@ -1094,6 +1028,226 @@ Result BinaryReaderObjdump::OnExceptionType(
   return Result::Ok;
 }
 
+static const char* get_basename(const char* filename) {
+  const char* last_slash = strrchr(filename, '/');
+  const char* last_backslash = strrchr(filename, '\\');
+  if (last_slash && last_backslash)
+    return std::max(last_slash, last_backslash) + 1;
+  if (last_slash)
+    return last_slash + 1;
+  if (last_backslash)
+    return last_backslash + 1;
+  return filename;
+}
+
+static bool section_matches(const ObjdumpOptions* options,
+                            BinarySection section) {
+  return !options->section_name ||
+         !strcasecmp(options->section_name, get_section_name(section));
+}
+
+static Result section_not_found(const ObjdumpOptions* options) {
+  fprintf(stderr, "Section not found: %s\n", options->section_name);
+  return Result::Error;
+}
+
+// Indexes the module, then reads only the sections that the other modes need
+// up front: the function names and the relocations.
+Result objdump_prepass(const uint8_t* data,
+                       size_t size,
+                       ObjdumpOptions* options,
+                       ObjdumpState* state,
+                       const ReadBinaryOptions* read_options) {
+  BinaryIndex* index = &state->index;
+  Result result = read_binary_index(data, size, read_options, index);
+  // The version is set once the header has been checked, even if a later
+  // section is invalid.
+  if (index->version != 0) {
+    printf("%s:\tfile format wasm %#x\n", get_basename(options->filename),
+           index->version);
+  }
+  if (Failed(result))
+    return result;
+
+  BinaryReaderObjdumpPrepass reader(data, size, options, state);
+  for (Index i = 0; i < index->sections.size(); ++i) {
+    const BinaryIndex::SectionEntry& entry = index->sections[i];
+    if (entry.section == BinarySection::Custom &&
+        (entry.name == WABT_BINARY_SECTION_NAME ||
+         entry.name.compare(0, strlen(WABT_BINARY_SECTION_RELOC),
+                            WABT_BINARY_SECTION_RELOC) == 0)) {
+      result = read_binary_section_static(data, size, *index, i, &reader,
+                                          read_options);
+      if (Failed(result))
+        return result;
+    }
+  }
+  return Result::Ok;
+}
+
+// Everything the section headers show is in the index.
+Result objdump_headers(ObjdumpOptions* options, const ObjdumpState* state) {
+  printf("\n");
+  printf("Sections:\n\n");
+  bool section_found = false;
+  for (const BinaryIndex::SectionEntry& entry : state->index.sections) {
+    if (section_matches(options, entry.section))
+      section_found = true;
+
+    printf("%9s start=%#010" PRIzx " end=%#010" PRIzx
+           " (size=%#010" PRIoffset ") ",
+           get_section_name(entry.section), entry.offset, entry.offset + entry.size, entry.size);
+    if (entry.section == BinarySection::Custom) {
+      printf("\"%s\"\n", entry.name.c_str());
+      if (options->allow_future_exceptions &&
+          entry.name == WABT_BINARY_SECTION_EXCEPTION) {
+        printf("count: %" PRIindex "\n", entry.count);
+      }
+    } else if (entry.section == BinarySection::Start) {
+      printf("start: %" PRIindex "\n", entry.count);
+    } else {
+      printf("count: %" PRIindex "\n", entry.count);
+    }
+  }
+
+  if (options->section_name && !section_found)
+    return section_not_found(options);
+  return Result::Ok;
+}
+
+// Reads each of the selected sections on its own. The code section has no
+// details, so it is left to the disassembly.
+Result objdump_details(const uint8_t* data,
+                       size_t size,
+                       ObjdumpOptions* options,
+                       ObjdumpState* state,
+                       const ReadBinaryOptions* read_options) {
+  printf("\n");
+  printf("Section Details:\n\n");
+  BinaryReaderObjdump reader(data, size, options, state);
+  bool section_found = false;
+  for (Index i = 0; i < state->index.sections.size(); ++i) {
+    BinarySection section = state->index.sections[i].section;
+    if (!section_matches(options, section))
+      continue;
+    section_found = true;
+    if (section == BinarySection::Code)
+      continue;
+    Result result = read_binary_section_static(data, size, state->index, i,
+                                               &reader, read_options);
+    if (Failed(result))
+      return result;
+  }
+
+  if (options->section_name && !section_found)
+    return section_not_found(options);
+  return reader.CheckDataRelocations();
+}
+
+struct DisassemblyChunk {
+  MemoryStream out;
+  MemoryStream errors;
+};
+
+// The code relocations are sorted by offset, and each is printed after the
+// instruction that contains it, so the first one for a chunk is the first at
+// or after the start of its first function body.
+static Index get_first_reloc(const ObjdumpState* state, Index defined_index) {
+  const std::vector<Reloc>& relocs = state->code_relocations;
+  const BinaryIndex& index = state->index;
+  Offset code_start =
+      index.sections[index.FindSection(BinarySection::Code)].offset;
+  Offset body_offset = index.function_bodies[defined_index].offset;
+  auto iter = std::lower_bound(
+      relocs.begin(), relocs.end(), body_offset,
+      [code_start](const Reloc& reloc, Offset offset) {
+        return code_start + reloc.offset < offset;
+      });
+  return iter - relocs.begin();
+}
+
+// Disassembles the chunks on |options->jobs| threads. They are written out in
+// order as soon as they are done, so at most a few chunks per thread are held
+// in memory at once. As when disassembling serially, nothing after the first
+// function that fails is written.
+static Result disassemble_in_parallel(const uint8_t* data,
+                                      size_t size,
+                                      ObjdumpOptions* options,
+                                      ObjdumpState* state,
+                                      const ReadBinaryOptions* read_options) {
+  std::vector<std::pair<Index, Index>> ranges =
+      state->index.SplitFunctionBodies(options->chunk_size);
+  std::vector<std::unique_ptr<DisassemblyChunk>> chunks(ranges.size());
+  std::unique_ptr<FileStream> out = FileStream::CreateStdout();
+  std::unique_ptr<FileStream> errors = FileStream::CreateStderr();
+
+  auto disassemble = [&](size_t i) {
+    chunks[i].reset(new DisassemblyChunk());
+    BinaryReaderObjdumpDisassemble reader(
+        data, size, options, state, &chunks[i]->out, &chunks[i]->errors,
+        get_first_reloc(state, ranges[i].first));
+    return read_binary_function_bodies_static(
+        data, size, state->index, ranges[i].first, ranges[i].second, &reader,
+        read_options);
+  };
+  auto write = [&](size_t i, Result result) {
+    const OutputBuffer& out_buffer = chunks[i]->out.writer().output_buffer();
+    const OutputBuffer& errors_buffer =
+        chunks[i]->errors.writer().output_buffer();
+    out->WriteData(out_buffer.data.data(), out_buffer.size());
+    errors->WriteData(errors_buffer.data.data(), errors_buffer.size());
+    chunks[i].reset();
+    return result;
+  };
+  return ParallelForInOrder(chunks.size(), options->jobs, 4 * options->jobs,
+                            disassemble, write);
+}
+
+Result objdump_disassemble(const uint8_t* data,
+                           size_t size,
+                           ObjdumpOptions* options,
+                           ObjdumpState* state,
+                           const ReadBinaryOptions* read_options) {
+  printf("\n");
+  printf("Code Disassembly:\n\n");
+  Index code_index = state->index.FindSection(BinarySection::Code);
+  if (code_index == kInvalidIndex)
+    return Result::Ok;
+
+  // The --debug output is interleaved with the reader's log, so it can't be
+  // split up.
+  if (options->jobs > 1 && !options->debug) {
+    return disassemble_in_parallel(data, size, options, state, read_options);
+  }
+
+  std::unique_ptr<FileStream> out = FileStream::CreateStdout();
+  std::unique_ptr<FileStream> errors = FileStream::CreateStderr();
+  BinaryReaderObjdumpDisassemble reader(data, size, options, state, out.get(),
+                                        errors.get(), 0);
+  return read_binary_section_static(data, size, state->index, code_index,
+                                    &reader, read_options);
+}
+
+// The raw contents need no decoding; they are dumped straight from the index.
+Result objdump_raw_data(const uint8_t* data,
+                        ObjdumpOptions* options,
+                        const ObjdumpState* state) {
+  std::unique_ptr<FileStream> out_stream = FileStream::CreateStdout();
+  bool section_found = false;
+  for (const BinaryIndex::SectionEntry& entry : state->index.sections) {
+    if (!section_matches(options, entry.section))
+      continue;
+    section_found = true;
+    printf("\nContents of section %s:\n", get_section_name(entry.section));
+    out_stream->WriteMemoryDump(data + entry.offset, entry.size, entry.offset,
+                                PrintChars::Yes);
+  }
+
+  if (options->section_name && !section_found)
+    return section_not_found(options);
+  return Result::Ok;
+}
+
 }  // end anonymous namespace
 
 Result read_binary_objdump(const uint8_t* data,
@@ -1104,21 +1258,26 @@ Result read_binary_objdump(const uint8_t* data,
   read_options.read_debug_names = true;
   read_options.log_stream = options->log_stream;
   read_options.allow_future_exceptions = options->allow_future_exceptions;
+  read_options.allow_future_bulk_memory = options->allow_future_bulk_memory;
+  read_options.allow_future_simd = options->allow_future_simd;
+  read_options.allow_future_threads = options->allow_future_threads;
+  read_options.allow_future_tail_call = options->allow_future_tail_call;
+  read_options.allow_future_multi_value = options->allow_future_multi_value;
 
   switch (options->mode) {
-    case ObjdumpMode::Prepass: {
-      BinaryReaderObjdumpPrepass reader(data, size, options, state);
-      return read_binary(data, size, &reader, &read_options);
-    }
-    case ObjdumpMode::Disassemble: {
-      BinaryReaderObjdumpDisassemble reader(data, size, options, state);
-      return read_binary(data, size, &reader, &read_options);
-    }
-    default: {
-      BinaryReaderObjdump reader(data, size, options, state);
-      return read_binary(data, size, &reader, &read_options);
-    }
+    case ObjdumpMode::Prepass:
+      return objdump_prepass(data, size, options, state, &read_options);
+    case ObjdumpMode::Headers:
+      return objdump_headers(options, state);
+    case ObjdumpMode::Details:
+      return objdump_details(data, size, options, state, &read_options);
+    case ObjdumpMode::Disassemble:
+      return objdump_disassemble(data, size, options, state, &read_options);
+    case ObjdumpMode::RawData:
+      return objdump_raw_data(data, options, state);
   }
+  assert(0);
+  return Result::Error;
 }
 
 }  // namespace wabt
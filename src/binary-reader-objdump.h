@@ -20,6 +20,7 @@
 #include <string>
 #include <vector>
 
+#include "binary-reader.h"
 #include "common.h"
 #include "stream.h"
 
@@ -45,6 +46,15 @@ struct ObjdumpOptions {
   bool debug;
   bool relocs;
   bool allow_future_exceptions = false;
+  bool allow_future_bulk_memory = false;
+  bool allow_future_simd = false;
+  bool allow_future_threads = false;
+  bool allow_future_tail_call = false;
+  bool allow_future_multi_value = false;
+  int jobs = 1;  // The number of threads to disassemble on.
+  // With more than one job, the function bodies are split into chunks of
+  // about this many bytes, each disassembled on its own.
+  Offset chunk_size = 64 * 1024;
   ObjdumpMode mode;
   const char* filename;
   const char* section_name;
@@ -53,6 +63,7 @@ struct ObjdumpOptions {
 // read_binary_objdump uses this state to store information from previous runs
 // and use it to display more useful information.
 struct ObjdumpState {
+  BinaryIndex index;  // Built by the prepass.
   std::vector<Reloc> code_relocations;
   std::vector<Reloc> data_relocations;
   std::vector<std::string> function_names;
@@ -22,6 +22,7 @@
 #include <cstdint>
 #include <cstdio>
 
+#include "binary-reader-impl.h"
 #include "binary-reader-nop.h"
 #include "common.h"
 
@@ -29,7 +30,7 @@ namespace wabt {
 
 namespace {
 
-class BinaryReaderOpcnt : public BinaryReaderNop {
+class BinaryReaderOpcnt final : public BinaryReaderNop {
  public:
   explicit BinaryReaderOpcnt(OpcntData* data);
 
@@ -128,7 +129,7 @@ Result read_binary_opcnt(const void* data,
                          const struct ReadBinaryOptions* options,
                          OpcntData* opcnt_data) {
   BinaryReaderOpcnt reader(opcnt_data);
-  return read_binary(data, size, &reader, options);
+  return read_binary_static(data, size, &reader, options);
 }
 
 }  // namespace wabt
@@ -18,32 +18,12 @@
 #define WABT_BINARY_READER_OPCNT_H_
 
 #include "common.h"
-
-#include <vector>
+#include "int-counter.h"
 
 namespace wabt {
 
-struct Module;
 struct ReadBinaryOptions;
 
-struct IntCounter {
-  IntCounter(intmax_t value, size_t count) : value(value), count(count) {}
-
-  intmax_t value;
-  size_t count;
-};
-typedef std::vector<IntCounter> IntCounterVector;
-
-struct IntPairCounter {
-  IntPairCounter(intmax_t first, intmax_t second, size_t count)
-      : first(first), second(second), count(count) {}
-
-  intmax_t first;
-  intmax_t second;
-  size_t count;
-};
-typedef std::vector<IntPairCounter> IntPairCounterVector;
-
 struct OpcntData {
   IntCounterVector opcode_vec;
   IntCounterVector i32_const_vec;
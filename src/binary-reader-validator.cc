@@ -0,0 +1,1009 @@
+/*
+ * Copyright 2017 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "binary-reader-validator.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cinttypes>
+#include <cstdarg>
+#include <limits>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "binary-checker.h"
+#include "binary-reader-impl.h"
+#include "binary-reader-logging.h"
+#include "binary-reader-nop.h"
+#include "error-handler.h"
+#include "parallel-for.h"
+#include "type-checker.h"
+
+#define CHECK_RESULT(expr)  \
+  do {                      \
+    if (Failed(expr))       \
+      return Result::Error; \
+  } while (0)
+
+namespace wabt {
+
+namespace {
+
+struct Signature {
+  TypeVector param_types;
+  TypeVector result_types;
+};
+
+struct GlobalType {
+  GlobalType(Type type, bool mutable_) : type(type), mutable_(mutable_) {}
+
+  Type type;
+  bool mutable_;
+};
+
+// Everything the function bodies are checked against. It is filled in by the
+// sections before the code section; checking a function body only reads it,
+// so the threads that check them can share it.
+struct ModuleContext {
+  std::vector<Signature> signatures;
+  std::vector<Index> func_sig_indexes;  // Imported functions first.
+  std::vector<GlobalType> globals;      // Imported globals first.
+  std::vector<TypeVector> exceptions;   // Imported exceptions first.
+  Index num_global_imports = 0;
+  Index num_tables = 0;
+  Index num_memories = 0;
+};
+
+class BinaryReaderValidator final : public BinaryReaderNop {
+ public:
+  BinaryReaderValidator(ModuleContext* context,
+                        ErrorHandler* error_handler,
+                        const ReadBinaryOptions* options);
+
+  // Implement BinaryReader.
+  bool OnError(const char* message) override;
+
+  Result OnType(Index index,
+                Index param_count,
+                Type* param_types,
+                Index result_count,
+                Type* result_types) override;
+
+  Result OnImportFunc(Index import_index,
+                      string_view module_name,
+                      string_view field_name,
+                      Index func_index,
+                      Index sig_index) override;
+  Result OnImportTable(Index import_index,
+                       string_view module_name,
+                       string_view field_name,
+                       Index table_index,
+                       Type elem_type,
+                       const Limits* elem_limits) override;
+  Result OnImportMemory(Index import_index,
+                        string_view module_name,
+                        string_view field_name,
+                        Index memory_index,
+                        const Limits* page_limits) override;
+  Result OnImportGlobal(Index import_index,
+                        string_view module_name,
+                        string_view field_name,
+                        Index global_index,
+                        Type type,
+                        bool mutable_) override;
+  Result OnImportException(Index import_index,
+                           string_view module_name,
+                           string_view field_name,
+                           Index except_index,
+                           TypeVector& sig) override;
+
+  Result OnFunction(Index index, Index sig_index) override;
+  Result OnTable(Index index,
+                 Type elem_type,
+                 const Limits* elem_limits) override;
+  Result OnMemory(Index index, const Limits* page_limits) override;
+
+  Result BeginGlobal(Index index, Type type, bool mutable_) override;
+  Result BeginGlobalInitExpr(Index index) override;
+  Result EndGlobalInitExpr(Index index) override;
+
+  Result OnExport(Index index,
+                  ExternalKind kind,
+                  Index item_index,
+                  string_view name) override;
+
+  Result OnStartFunction(Index func_index) override;
+
+  Result BeginFunctionBody(Index index) override;
+  Result OnLocalDecl(Index decl_index, Index count, Type type) override;
+
+  Result OnAtomicLoadExpr(Opcode opcode,
+                          uint32_t alignment_log2,
+                          Address offset) override;
+  Result OnAtomicNotifyExpr(Opcode opcode,
+                            uint32_t alignment_log2,
+                            Address offset) override;
+  Result OnAtomicRmwExpr(Opcode opcode,
+                         uint32_t alignment_log2,
+                         Address offset) override;
+  Result OnAtomicRmwCmpxchgExpr(Opcode opcode,
+                                uint32_t alignment_log2,
+                                Address offset) override;
+  Result OnAtomicStoreExpr(Opcode opcode,
+                           uint32_t alignment_log2,
+                           Address offset) override;
+  Result OnAtomicWaitExpr(Opcode opcode,
+                          uint32_t alignment_log2,
+                          Address offset) override;
+  Result OnBinaryExpr(Opcode opcode) override;
+  Result OnBlockExpr(Index num_types, Type* sig_types) override;
+  Result OnBrExpr(Index depth) override;
+  Result OnBrIfExpr(Index depth) override;
+  Result OnBrTableExpr(Index num_targets,
+                       Index* target_depths,
+                       Index default_target_depth) override;
+  Result OnCallExpr(Index func_index) override;
+  Result OnCallIndirectExpr(Index sig_index) override;
+  Result OnCatchExpr(Index except_index) override;
+  Result OnCatchAllExpr() override;
+  Result OnCompareExpr(Opcode opcode) override;
+  Result OnConvertExpr(Opcode opcode) override;
+  Result OnCurrentMemoryExpr() override;
+  Result OnDropExpr() override;
+  Result OnElseExpr() override;
+  Result OnEndExpr() override;
+  Result OnF32ConstExpr(uint32_t value_bits) override;
+  Result OnF64ConstExpr(uint64_t value_bits) override;
+  Result OnGetGlobalExpr(Index global_index) override;
+  Result OnGetLocalExpr(Index local_index) override;
+  Result OnGrowMemoryExpr() override;
+  Result OnI32ConstExpr(uint32_t value) override;
+  Result OnI64ConstExpr(uint64_t value) override;
+  Result OnIfExpr(Index num_types, Type* sig_types) override;
+  Result OnLoadExpr(Opcode opcode,
+                    uint32_t alignment_log2,
+                    Address offset) override;
+  Result OnLoopExpr(Index num_types, Type* sig_types) override;
+  Result OnMemoryCopyExpr() override;
+  Result OnMemoryFillExpr() override;
+  Result OnRethrowExpr(Index depth) override;
+  Result OnReturnExpr() override;
+  Result OnReturnCallExpr(Index func_index) override;
+  Result OnReturnCallIndirectExpr(Index sig_index) override;
+  Result OnSelectExpr() override;
+  Result OnSetGlobalExpr(Index global_index) override;
+  Result OnSetLocalExpr(Index local_index) override;
+  Result OnSimdLaneOpExpr(Opcode opcode, uint32_t lane) override;
+  Result OnStoreExpr(Opcode opcode,
+                     uint32_t alignment_log2,
+                     Address offset) override;
+  Result OnTeeLocalExpr(Index local_index) override;
+  Result OnThrowExpr(Index except_index) override;
+  Result OnTryExpr(Index num_types, Type* sig_types) override;
+  Result OnUnaryExpr(Opcode opcode) override;
+  Result OnUnreachableExpr() override;
+  Result OnV128ConstExpr(v128 value_bits) override;
+  Result EndFunctionBody(Index index) override;
+
+  Result BeginElemSegment(Index index, Index table_index) override;
+  Result BeginElemSegmentInitExpr(Index index) override;
+  Result EndElemSegmentInitExpr(Index index) override;
+  Result OnElemSegmentFunctionIndex(Index index, Index func_index) override;
+
+  Result BeginDataSegment(Index index, Index memory_index) override;
+  Result BeginDataSegmentInitExpr(Index index) override;
+  Result EndDataSegmentInitExpr(Index index) override;
+
+  Result OnExceptionType(Index index, TypeVector& sig) override;
+
+  Result OnInitExprF32ConstExpr(Index index, uint32_t value) override;
+  Result OnInitExprF64ConstExpr(Index index, uint64_t value) override;
+  Result OnInitExprGetGlobalExpr(Index index, Index global_index) override;
+  Result OnInitExprI32ConstExpr(Index index, uint32_t value) override;
+  Result OnInitExprI64ConstExpr(Index index, uint64_t value) override;
+
+ private:
+  void WABT_PRINTF_FORMAT(2, 3) PrintError(const char* format, ...);
+
+  Result CheckVar(Index index, Index max_index, const char* desc);
+  Result CheckInitExprType(Type expected, const char* desc);
+  Result CheckTable();
+  Result CheckMemory();
+  Result CheckHasTable(Opcode opcode);
+  Result CheckHasMemory(Opcode opcode);
+  Result CheckException(Index except_index);
+  Result GetLocalType(Index local_index, Type* out_type);
+  Result GetGlobalType(Index global_index, GlobalType* out_type);
+  Result AddLocals(Index count, Type type);
+  const Signature& GetFuncSignature(Index func_index) const;
+
+  ModuleContext* context_;
+  ErrorHandler* error_handler_;
+  TypeChecker typechecker_;
+  BinaryChecker checker_;
+  std::unordered_set<std::string> export_names_;
+  Type init_expr_type_ = Type::Void;
+
+  // The params and locals of the current function, as runs of the same type:
+  // the index after the end of the run, and its type. The locals can be
+  // declared a few at a time, but with counts in the billions.
+  std::vector<std::pair<Index, Type>> local_runs_;
+  Index num_locals_ = 0;
+  TypeVector block_sig_;
+  // Whether each enclosing try block has had a catch_all yet.
+  std::vector<bool> try_has_catch_all_;
+};
+
+BinaryReaderValidator::BinaryReaderValidator(ModuleContext* context,
+                                             ErrorHandler* error_handler,
+                                             const ReadBinaryOptions* options)
+    : context_(context), error_handler_(error_handler) {
+  allow_future_exceptions = options->allow_future_exceptions;
+  typechecker_.set_error_callback(
+      [this](const char* msg) { PrintError("%s", msg); });
+  checker_.set_error_callback(
+      [this](const char* msg) { PrintError("%s", msg); });
+}
+
+bool BinaryReaderValidator::OnError(const char* message) {
+  return error_handler_->OnError(state->offset, message);
+}
+
+void WABT_PRINTF_FORMAT(2, 3)
+    BinaryReaderValidator::PrintError(const char* format, ...) {
+  WABT_SNPRINTF_ALLOCA(buffer, length, format);
+  error_handler_->OnError(state->offset, buffer);
+}
+
+Result BinaryReaderValidator::CheckVar(Index index,
+                                       Index max_index,
+                                       const char* desc) {
+  if (index >= max_index) {
+    PrintError("%s variable out of range (max %" PRIindex ")", desc,
+               max_index);
+    return Result::Error;
+  }
+  return Result::Ok;
+}
+
+Result BinaryReaderValidator::CheckInitExprType(Type expected,
+                                                const char* desc) {
+  if (init_expr_type_ != expected) {
+    PrintError("type mismatch at %s. got %s, expected %s", desc,
+               get_type_name(init_expr_type_), get_type_name(expected));
+    return Result::Error;
+  }
+  return Result::Ok;
+}
+
+Result BinaryReaderValidator::CheckTable() {
+  return checker_.CheckTable(context_->num_tables++ != 0);
+}
+
+Result BinaryReaderValidator::CheckMemory() {
+  return checker_.CheckMemory(context_->num_memories++ != 0);
+}
+
+Result BinaryReaderValidator::CheckHasTable(Opcode opcode) {
+  return checker_.CheckHasTable(opcode, context_->num_tables != 0);
+}
+
+Result BinaryReaderValidator::CheckHasMemory(Opcode opcode) {
+  return checker_.CheckHasMemory(opcode, context_->num_memories != 0);
+}
+
+Result BinaryReaderValidator::CheckException(Index except_index) {
+  return CheckVar(except_index, context_->exceptions.size(), "except");
+}
+
+Result BinaryReaderValidator::GetLocalType(Index local_index,
+                                           Type* out_type) {
+  CHECK_RESULT(checker_.CheckLocal(local_index, num_locals_));
+  auto iter = std::upper_bound(
+      local_runs_.begin(), local_runs_.end(), local_index,
+      [](Index index, const std::pair<Index, Type>& run) {
+        return index < run.first;
+      });
+  assert(iter != local_runs_.end());
+  *out_type = iter->second;
+  return Result::Ok;
+}
+
+Result BinaryReaderValidator::GetGlobalType(Index global_index,
+                                            GlobalType* out_type) {
+  CHECK_RESULT(checker_.CheckGlobal(global_index, context_->globals.size()));
+  *out_type = context_->globals[global_index];
+  return Result::Ok;
+}
+
+Result BinaryReaderValidator::AddLocals(Index count, Type type) {
+  if (count == 0)
+    return Result::Ok;
+  if (count > std::numeric_limits<Index>::max() - num_locals_) {
+    PrintError("too many locals");
+    return Result::Error;
+  }
+  num_locals_ += count;
+  if (!local_runs_.empty() && local_runs_.back().second == type)
+    local_runs_.back().first = num_locals_;
+  else
+    local_runs_.emplace_back(num_locals_, type);
+  return Result::Ok;
+}
+
+const Signature& BinaryReaderValidator::GetFuncSignature(
+    Index func_index) const {
+  assert(func_index < context_->func_sig_indexes.size());
+  return context_->signatures[context_->func_sig_indexes[func_index]];
+}
+
+Result BinaryReaderValidator::OnType(Index index,
+                                     Index param_count,
+                                     Type* param_types,
+                                     Index result_count,
+                                     Type* result_types) {
+  assert(index == context_->signatures.size());
+  context_->signatures.emplace_back();
+  Signature& sig = context_->signatures.back();
+  sig.param_types.assign(param_types, param_types + param_count);
+  sig.result_types.assign(result_types, result_types + result_count);
+  return Result::Ok;
+}
+
+Result BinaryReaderValidator::OnImportFunc(Index import_index,
+                                           string_view module_name,
+                                           string_view field_name,
+                                           Index func_index,
+                                           Index sig_index) {
+  context_->func_sig_indexes.push_back(sig_index);
+  return Result::Ok;
+}
+
+Result BinaryReaderValidator::OnImportTable(Index import_index,
+                                            string_view module_name,
+                                            string_view field_name,
+                                            Index table_index,
+                                            Type elem_type,
+                                            const Limits* elem_limits) {
+  return CheckTable();
+}
+
+Result BinaryReaderValidator::OnImportMemory(Index import_index,
+                                             string_view module_name,
+                                             string_view field_name,
+                                             Index memory_index,
+                                             const Limits* page_limits) {
+  return CheckMemory();
+}
+
+Result BinaryReaderValidator::OnImportGlobal(Index import_index,
+                                             string_view module_name,
+                                             string_view field_name,
+                                             Index global_index,
+                                             Type type,
+                                             bool mutable_) {
+  if (mutable_) {
+    PrintError("mutable globals cannot be imported");
+    return Result::Error;
+  }
+  context_->globals.emplace_back(type, mutable_);
+  context_->num_global_imports++;
+  return Result::Ok;
+}
+
+Result BinaryReaderValidator::OnImportException(Index import_index,
+                                                string_view module_name,
+                                                string_view field_name,
+                                                Index except_index,
+                                                TypeVector& sig) {
+  CHECK_RESULT(BinaryReaderNop::OnImportException(
+      import_index, module_name, field_name, except_index, sig));
+  context_->exceptions.push_back(sig);
+  return Result::Ok;
+}
+
+Result BinaryReaderValidator::OnFunction(Index index, Index sig_index) {
+  context_->func_sig_indexes.push_back(sig_index);
+  return Result::Ok;
+}
+
+Result BinaryReaderValidator::OnTable(Index index,
+                                      Type elem_type,
+                                      const Limits* elem_limits) {
+  return CheckTable();
+}
+
+Result BinaryReaderValidator::OnMemory(Index index, const Limits* page_limits) {
+  return CheckMemory();
+}
+
+Result BinaryReaderValidator::BeginGlobal(Index index,
+                                          Type type,
+                                          bool mutable_) {
+  context_->globals.emplace_back(type, mutable_);
+  return Result::Ok;
+}
+
+Result BinaryReaderValidator::BeginGlobalInitExpr(Index index) {
+  init_expr_type_ = Type::Void;
+  return Result::Ok;
+}
+
+Result BinaryReaderValidator::EndGlobalInitExpr(Index index) {
+  return CheckInitExprType(context_->globals[index].type,
+                           "global initializer expression");
+}
+
+Result BinaryReaderValidator::OnExport(Index index,
+                                       ExternalKind kind,
+                                       Index item_index,
+                                       string_view name) {
+  if (kind == ExternalKind::Global) {
+    CHECK_RESULT(
+        checker_.CheckExportGlobal(context_->globals[item_index].mutable_));
+  }
+  if (!export_names_.insert(name.to_string()).second) {
+    PrintError("redefinition of export \"" PRIstringview "\"",
+               WABT_PRINTF_STRING_VIEW_ARG(name));
+    return Result::Error;
+  }
+  return Result::Ok;
+}
+
+Result BinaryReaderValidator::OnStartFunction(Index func_index) {
+  const Signature& sig = GetFuncSignature(func_index);
+  return checker_.CheckStartFunction(sig.param_types, sig.result_types);
+}
+
+Result BinaryReaderValidator::BeginFunctionBody(Index index) {
+  const Signature& sig = GetFuncSignature(index);
+  local_runs_.clear();
+  num_locals_ = 0;
+  try_has_catch_all_.clear();
+  for (Type param_type : sig.param_types)
+    CHECK_RESULT(AddLocals(1, param_type));
+  return typechecker_.BeginFunction(&sig.result_types);
+}
+
+Result BinaryReaderValidator::OnLocalDecl(Index decl_index,
+                                          Index count,
+                                          Type type) {
+  return AddLocals(count, type);
+}
+
+Result BinaryReaderValidator::OnAtomicLoadExpr(Opcode opcode,
+                                               uint32_t alignment_log2,
+                                               Address offset) {
+  CHECK_RESULT(CheckHasMemory(opcode));
+  CHECK_RESULT(
+      checker_.CheckAtomicAlign(alignment_log2, opcode.GetMemorySize()));
+  return typechecker_.OnAtomicLoad(opcode);
+}
+
+Result BinaryReaderValidator::OnAtomicNotifyExpr(Opcode opcode,
+                                                 uint32_t alignment_log2,
+                                                 Address offset) {
+  CHECK_RESULT(CheckHasMemory(opcode));
+  CHECK_RESULT(
+      checker_.CheckAtomicAlign(alignment_log2, opcode.GetMemorySize()));
+  return typechecker_.OnAtomicNotify(opcode);
+}
+
+Result BinaryReaderValidator::OnAtomicRmwExpr(Opcode opcode,
+                                              uint32_t alignment_log2,
+                                              Address offset) {
+  CHECK_RESULT(CheckHasMemory(opcode));
+  CHECK_RESULT(
+      checker_.CheckAtomicAlign(alignment_log2, opcode.GetMemorySize()));
+  return typechecker_.OnAtomicRmw(opcode);
+}
+
+Result BinaryReaderValidator::OnAtomicRmwCmpxchgExpr(Opcode opcode,
+                                                     uint32_t alignment_log2,
+                                                     Address offset) {
+  CHECK_RESULT(CheckHasMemory(opcode));
+  CHECK_RESULT(
+      checker_.CheckAtomicAlign(alignment_log2, opcode.GetMemorySize()));
+  return typechecker_.OnAtomicRmwCmpxchg(opcode);
+}
+
+Result BinaryReaderValidator::OnAtomicStoreExpr(Opcode opcode,
+                                                uint32_t alignment_log2,
+                                                Address offset) {
+  CHECK_RESULT(CheckHasMemory(opcode));
+  CHECK_RESULT(
+      checker_.CheckAtomicAlign(alignment_log2, opcode.GetMemorySize()));
+  return typechecker_.OnAtomicStore(opcode);
+}
+
+Result BinaryReaderValidator::OnAtomicWaitExpr(Opcode opcode,
+                                               uint32_t alignment_log2,
+                                               Address offset) {
+  CHECK_RESULT(CheckHasMemory(opcode));
+  CHECK_RESULT(
+      checker_.CheckAtomicAlign(alignment_log2, opcode.GetMemorySize()));
+  return typechecker_.OnAtomicWait(opcode);
+}
+
+Result BinaryReaderValidator::OnBinaryExpr(Opcode opcode) {
+  return typechecker_.OnBinary(opcode);
+}
+
+Result BinaryReaderValidator::OnBlockExpr(Index num_types, Type* sig_types) {
+  block_sig_.assign(sig_types, sig_types + num_types);
+  return typechecker_.OnBlock(&block_sig_);
+}
+
+Result BinaryReaderValidator::OnBrExpr(Index depth) {
+  return typechecker_.OnBr(depth);
+}
+
+Result BinaryReaderValidator::OnBrIfExpr(Index depth) {
+  return typechecker_.OnBrIf(depth);
+}
+
+Result BinaryReaderValidator::OnBrTableExpr(Index num_targets,
+                                            Index* target_depths,
+                                            Index default_target_depth) {
+  CHECK_RESULT(typechecker_.BeginBrTable());
+  for (Index i = 0; i < num_targets; ++i)
+    CHECK_RESULT(typechecker_.OnBrTableTarget(target_depths[i]));
+  CHECK_RESULT(typechecker_.OnBrTableTarget(default_target_depth));
+  return typechecker_.EndBrTable();
+}
+
+Result BinaryReaderValidator::OnCallExpr(Index func_index) {
+  const Signature& sig = GetFuncSignature(func_index);
+  return typechecker_.OnCall(&sig.param_types, &sig.result_types);
+}
+
+Result BinaryReaderValidator::OnCallIndirectExpr(Index sig_index) {
+  CHECK_RESULT(CheckHasTable(Opcode::CallIndirect));
+  const Signature& sig = context_->signatures[sig_index];
+  return typechecker_.OnCallIndirect(&sig.param_types, &sig.result_types);
+}
+
+Result BinaryReaderValidator::OnCatchExpr(Index except_index) {
+  CHECK_RESULT(CheckException(except_index));
+  if (!try_has_catch_all_.empty() && try_has_catch_all_.back()) {
+    PrintError("Appears after catch all block");
+    return Result::Error;
+  }
+  TypeChecker::Label* label;
+  CHECK_RESULT(typechecker_.GetLabel(0, &label));
+  CHECK_RESULT(typechecker_.OnCatchBlock(&label->sig));
+  return typechecker_.OnCatch(&context_->exceptions[except_index]);
+}
+
+Result BinaryReaderValidator::OnCatchAllExpr() {
+  TypeChecker::Label* label;
+  CHECK_RESULT(typechecker_.GetLabel(0, &label));
+  CHECK_RESULT(typechecker_.OnCatchBlock(&label->sig));
+  if (!try_has_catch_all_.empty())
+    try_has_catch_all_.back() = true;
+  return Result::Ok;
+}
+
+Result BinaryReaderValidator::OnCompareExpr(Opcode opcode) {
+  return typechecker_.OnCompare(opcode);
+}
+
+Result BinaryReaderValidator::OnConvertExpr(Opcode opcode) {
+  return typechecker_.OnConvert(opcode);
+}
+
+Result BinaryReaderValidator::OnCurrentMemoryExpr() {
+  CHECK_RESULT(CheckHasMemory(Opcode::CurrentMemory));
+  return typechecker_.OnCurrentMemory();
+}
+
+Result BinaryReaderValidator::OnDropExpr() {
+  return typechecker_.OnDrop();
+}
+
+Result BinaryReaderValidator::OnElseExpr() {
+  return typechecker_.OnElse();
+}
+
+Result BinaryReaderValidator::OnEndExpr() {
+  TypeChecker::Label* label;
+  if (Succeeded(typechecker_.GetLabel(0, &label)) &&
+      (label->label_type == LabelType::Try ||
+       label->label_type == LabelType::Catch)) {
+    try_has_catch_all_.pop_back();
+  }
+  return typechecker_.OnEnd();
+}
+
+Result BinaryReaderValidator::OnF32ConstExpr(uint32_t value_bits) {
+  return typechecker_.OnConst(Type::F32);
+}
+
+Result BinaryReaderValidator::OnF64ConstExpr(uint64_t value_bits) {
+  return typechecker_.OnConst(Type::F64);
+}
+
+Result BinaryReaderValidator::OnGetGlobalExpr(Index global_index) {
+  GlobalType global(Type::Void, false);
+  CHECK_RESULT(GetGlobalType(global_index, &global));
+  return typechecker_.OnGetGlobal(global.type);
+}
+
+Result BinaryReaderValidator::OnGetLocalExpr(Index local_index) {
+  Type type;
+  CHECK_RESULT(GetLocalType(local_index, &type));
+  return typechecker_.OnGetLocal(type);
+}
+
+Result BinaryReaderValidator::OnGrowMemoryExpr() {
+  CHECK_RESULT(CheckHasMemory(Opcode::GrowMemory));
+  return typechecker_.OnGrowMemory();
+}
+
+Result BinaryReaderValidator::OnI32ConstExpr(uint32_t value) {
+  return typechecker_.OnConst(Type::I32);
+}
+
+Result BinaryReaderValidator::OnI64ConstExpr(uint64_t value) {
+  return typechecker_.OnConst(Type::I64);
+}
+
+Result BinaryReaderValidator::OnIfExpr(Index num_types, Type* sig_types) {
+  block_sig_.assign(sig_types, sig_types + num_types);
+  return typechecker_.OnIf(&block_sig_);
+}
+
+Result BinaryReaderValidator::OnLoadExpr(Opcode opcode,
+                                         uint32_t alignment_log2,
+                                         Address offset) {
+  CHECK_RESULT(CheckHasMemory(opcode));
+  CHECK_RESULT(
+      checker_.CheckAlign(alignment_log2, opcode.GetMemorySize()));
+  return typechecker_.OnLoad(opcode);
+}
+
+Result BinaryReaderValidator::OnLoopExpr(Index num_types, Type* sig_types) {
+  block_sig_.assign(sig_types, sig_types + num_types);
+  return typechecker_.OnLoop(&block_sig_);
+}
+
+Result BinaryReaderValidator::OnMemoryCopyExpr() {
+  CHECK_RESULT(CheckHasMemory(Opcode::MemoryCopy));
+  return typechecker_.OnMemoryCopy();
+}
+
+Result BinaryReaderValidator::OnMemoryFillExpr() {
+  CHECK_RESULT(CheckHasMemory(Opcode::MemoryFill));
+  return typechecker_.OnMemoryFill();
+}
+
+Result BinaryReaderValidator::OnRethrowExpr(Index depth) {
+  return typechecker_.OnRethrow(depth);
+}
+
+Result BinaryReaderValidator::OnReturnExpr() {
+  return typechecker_.OnReturn();
+}
+
+Result BinaryReaderValidator::OnReturnCallExpr(Index func_index) {
+  const Signature& sig = GetFuncSignature(func_index);
+  return typechecker_.OnReturnCall(&sig.param_types, &sig.result_types);
+}
+
+Result BinaryReaderValidator::OnReturnCallIndirectExpr(Index sig_index) {
+  CHECK_RESULT(CheckHasTable(Opcode::ReturnCallIndirect));
+  const Signature& sig = context_->signatures[sig_index];
+  return typechecker_.OnReturnCallIndirect(&sig.param_types,
+                                           &sig.result_types);
+}
+
+Result BinaryReaderValidator::OnSelectExpr() {
+  return typechecker_.OnSelect();
+}
+
+Result BinaryReaderValidator::OnSetGlobalExpr(Index global_index) {
+  GlobalType global(Type::Void, false);
+  CHECK_RESULT(GetGlobalType(global_index, &global));
+  CHECK_RESULT(checker_.CheckSetGlobal(global_index, global.mutable_));
+  return typechecker_.OnSetGlobal(global.type);
+}
+
+Result BinaryReaderValidator::OnSetLocalExpr(Index local_index) {
+  Type type;
+  CHECK_RESULT(GetLocalType(local_index, &type));
+  return typechecker_.OnSetLocal(type);
+}
+
+Result BinaryReaderValidator::OnSimdLaneOpExpr(Opcode opcode, uint32_t lane) {
+  return typechecker_.OnSimdLaneOp(opcode, lane);
+}
+
+Result BinaryReaderValidator::OnStoreExpr(Opcode opcode,
+                                          uint32_t alignment_log2,
+                                          Address offset) {
+  CHECK_RESULT(CheckHasMemory(opcode));
+  CHECK_RESULT(
+      checker_.CheckAlign(alignment_log2, opcode.GetMemorySize()));
+  return typechecker_.OnStore(opcode);
+}
+
+Result BinaryReaderValidator::OnTeeLocalExpr(Index local_index) {
+  Type type;
+  CHECK_RESULT(GetLocalType(local_index, &type));
+  return typechecker_.OnTeeLocal(type);
+}
+
+Result BinaryReaderValidator::OnThrowExpr(Index except_index) {
+  CHECK_RESULT(CheckException(except_index));
+  return typechecker_.OnThrow(&context_->exceptions[except_index]);
+}
+
+Result BinaryReaderValidator::OnTryExpr(Index num_types, Type* sig_types) {
+  block_sig_.assign(sig_types, sig_types + num_types);
+  try_has_catch_all_.push_back(false);
+  return typechecker_.OnTryBlock(&block_sig_);
+}
+
+Result BinaryReaderValidator::OnUnaryExpr(Opcode opcode) {
+  return typechecker_.OnUnary(opcode);
+}
+
+Result BinaryReaderValidator::OnUnreachableExpr() {
+  return typechecker_.OnUnreachable();
+}
+
+Result BinaryReaderValidator::OnV128ConstExpr(v128 value_bits) {
+  return typechecker_.OnConst(Type::V128);
+}
+
+Result BinaryReaderValidator::EndFunctionBody(Index index) {
+  return typechecker_.EndFunction();
+}
+
+Result BinaryReaderValidator::BeginElemSegment(Index index,
+                                               Index table_index) {
+  return CheckVar(table_index, context_->num_tables, "table");
+}
+
+Result BinaryReaderValidator::BeginElemSegmentInitExpr(Index index) {
+  init_expr_type_ = Type::Void;
+  return Result::Ok;
+}
+
+Result BinaryReaderValidator::EndElemSegmentInitExpr(Index index) {
+  return CheckInitExprType(Type::I32, "elem segment offset");
+}
+
+Result BinaryReaderValidator::OnElemSegmentFunctionIndex(Index index,
+                                                         Index func_index) {
+  return CheckVar(func_index, context_->func_sig_indexes.size(), "function");
+}
+
+Result BinaryReaderValidator::BeginDataSegment(Index index,
+                                               Index memory_index) {
+  return CheckVar(memory_index, context_->num_memories, "memory");
+}
+
+Result BinaryReaderValidator::BeginDataSegmentInitExpr(Index index) {
+  init_expr_type_ = Type::Void;
+  return Result::Ok;
+}
+
+Result BinaryReaderValidator::EndDataSegmentInitExpr(Index index) {
+  return CheckInitExprType(Type::I32, "data segment offset");
+}
+
+Result BinaryReaderValidator::OnExceptionType(Index index, TypeVector& sig) {
+  CHECK_RESULT(BinaryReaderNop::OnExceptionType(index, sig));
+  context_->exceptions.push_back(sig);
+  return Result::Ok;
+}
+
+Result BinaryReaderValidator::OnInitExprF32ConstExpr(Index index,
+                                                     uint32_t value) {
+  init_expr_type_ = Type::F32;
+  return Result::Ok;
+}
+
+Result BinaryReaderValidator::OnInitExprF64ConstExpr(Index index,
+                                                     uint64_t value) {
+  init_expr_type_ = Type::F64;
+  return Result::Ok;
+}
+
+Result BinaryReaderValidator::OnInitExprGetGlobalExpr(Index index,
+                                                      Index global_index) {
+  GlobalType global(Type::Void, false);
+  CHECK_RESULT(GetGlobalType(global_index, &global));
+  CHECK_RESULT(checker_.CheckInitExprGlobal(
+      global_index, context_->num_global_imports, global.mutable_));
+  init_expr_type_ = global.type;
+  return Result::Ok;
+}
+
+Result BinaryReaderValidator::OnInitExprI32ConstExpr(Index index,
+                                                     uint32_t value) {
+  init_expr_type_ = Type::I32;
+  return Result::Ok;
+}
+
+Result BinaryReaderValidator::OnInitExprI64ConstExpr(Index index,
+                                                     uint64_t value) {
+  init_expr_type_ = Type::I64;
+  return Result::Ok;
+}
+
+// Keeps the errors from checking a chunk of function bodies until the chunks
+// before it have been checked, so they are reported in order.
+class ErrorHandlerBuffer : public ErrorHandler {
+ public:
+  explicit ErrorHandlerBuffer(ErrorHandler* target)
+      : ErrorHandler(Location::Type::Binary), target_(target) {}
+
+  bool OnError(const Location& loc,
+               const std::string& error,
+               const std::string& source_line,
+               size_t source_line_column_offset) override {
+    errors_.emplace_back(loc, error);
+    return true;
+  }
+
+  size_t source_line_max_length() const override {
+    return target_->source_line_max_length();
+  }
+
+  void Flush() {
+    for (const std::pair<Location, std::string>& error : errors_)
+      target_->OnError(error.first, error.second, std::string(), 0);
+    errors_.clear();
+  }
+
+ private:
+  ErrorHandler* target_;
+  std::vector<std::pair<Location, std::string>> errors_;
+};
+
+// Used to index the module before checking it in parallel. If that fails the
+// module is read again serially, which reports the error.
+class BinaryReaderQuiet final : public BinaryReaderNop {
+ public:
+  bool OnError(const char* message) override { return true; }
+};
+
+// The function bodies are split into chunks of about this many bytes, each
+// checked on its own.
+static const Offset kValidationChunkSize = 64 * 1024;
+
+static Result validate_function_bodies(const void* data,
+                                       size_t size,
+                                       const BinaryIndex& index,
+                                       ModuleContext* context,
+                                       const ReadBinaryOptions* options,
+                                       ErrorHandler* error_handler,
+                                       int num_threads) {
+  std::vector<std::pair<Index, Index>> ranges =
+      index.SplitFunctionBodies(kValidationChunkSize);
+  // The errors of each chunk that is being checked.
+  std::vector<std::unique_ptr<ErrorHandlerBuffer>> chunk_errors(
+      ranges.size());
+
+  auto validate = [&](size_t i) {
+    chunk_errors[i].reset(new ErrorHandlerBuffer(error_handler));
+    BinaryReaderValidator reader(context, chunk_errors[i].get(), options);
+    return read_binary_function_bodies_static(data, size, index,
+                                              ranges[i].first,
+                                              ranges[i].second, &reader,
+                                              options);
+  };
+  auto report = [&](size_t i, Result result) {
+    chunk_errors[i]->Flush();
+    chunk_errors[i].reset();
+    return result;
+  };
+  return ParallelForInOrder(ranges.size(), num_threads, 4 * num_threads,
+                            validate, report);
+}
+
+}  // end anonymous namespace
+
+Result validate_binary(const void* data,
+                       size_t size,
+                       const ReadBinaryOptions* options,
+                       ErrorHandler* error_handler,
+                       int num_threads) {
+  ModuleContext context;
+  BinaryReaderValidator reader(&context, error_handler, options);
+  // The log is written in the order the module is read, so it can't be split
+  // up.
+  if (num_threads <= 1 || options->log_stream)
+    return read_binary_static(data, size, &reader, options);
+
+  BinaryIndex index;
+  BinaryReaderQuiet quiet;
+  quiet.allow_future_exceptions = options->allow_future_exceptions;
+  BinaryReaderT<BinaryReaderQuiet> index_reader(data, size, &quiet, options);
+  if (Failed(index_reader.IndexModule(&index)))
+    return read_binary_static(data, size, &reader, options);
+
+  // The sections are checked in order, as they are when checking serially, so
+  // the first error is the same.
+  for (Index i = 0; i < index.sections.size(); ++i) {
+    if (index.sections[i].section == BinarySection::Code) {
+      CHECK_RESULT(validate_function_bodies(data, size, index, &context,
+                                            options, error_handler,
+                                            num_threads));
+    } else {
+      CHECK_RESULT(read_binary_section_static(data, size, index, i, &reader,
+                                              options));
+    }
+  }
+  return Result::Ok;
+}
+
+struct StreamingBinaryValidator::Impl {
+  Impl(const ReadBinaryOptions* options, ErrorHandler* error_handler);
+
+  Result Push(const void* data, size_t size);
+  Result Finish();
+
+  ModuleContext context;
+  BinaryReaderValidator reader;
+  BinaryReaderLogging logging_reader;
+  // Only one of these is set, depending on whether the reader logs.
+  std::unique_ptr<StreamingBinaryReader<BinaryReaderValidator>> stream;
+  std::unique_ptr<StreamingBinaryReader<BinaryReaderDelegate>> logging_stream;
+};
+
+StreamingBinaryValidator::Impl::Impl(const ReadBinaryOptions* options,
+                                     ErrorHandler* error_handler)
+    : reader(&context, error_handler, options),
+      logging_reader(options->log_stream, &reader) {
+  if (options->log_stream) {
+    logging_stream.reset(new StreamingBinaryReader<BinaryReaderDelegate>(
+        &logging_reader, options));
+  } else {
+    stream.reset(
+        new StreamingBinaryReader<BinaryReaderValidator>(&reader, options));
+  }
+}
+
+Result StreamingBinaryValidator::Impl::Push(const void* data, size_t size) {
+  return stream ? stream->Push(data, size) : logging_stream->Push(data, size);
+}
+
+Result StreamingBinaryValidator::Impl::Finish() {
+  return stream ? stream->Finish() : logging_stream->Finish();
+}
+
+StreamingBinaryValidator::StreamingBinaryValidator(
+    const ReadBinaryOptions* options,
+    ErrorHandler* error_handler)
+    : impl_(new Impl(options, error_handler)) {}
+
+StreamingBinaryValidator::~StreamingBinaryValidator() {}
+
+Result StreamingBinaryValidator::Push(const void* data, size_t size) {
+  return impl_->Push(data, size);
+}
+
+Result StreamingBinaryValidator::Finish() {
+  return impl_->Finish();
+}
+
+}  // namespace wabt
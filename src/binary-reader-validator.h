@@ -0,0 +1,60 @@
+/*
+ * Copyright 2017 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef WABT_BINARY_READER_VALIDATOR_H_
+#define WABT_BINARY_READER_VALIDATOR_H_
+
+#include <memory>
+
+#include "common.h"
+
+namespace wabt {
+
+class ErrorHandler;
+struct ReadBinaryOptions;
+
+// Checks the module straight from the binary, without building the IR: the
+// function bodies are run through the TypeChecker as they are read, and only
+// the signatures, globals and counts that they are checked against are kept.
+// With |num_threads| > 1 the function bodies are checked on that many
+// threads; the error reported is the same as when checking serially. Stops at
+// the first error.
+Result validate_binary(const void* data,
+                       size_t size,
+                       const ReadBinaryOptions* options,
+                       ErrorHandler*,
+                       int num_threads);
+
+// Like validate_binary on one thread, but for a module that arrives in pieces,
+// e.g. from a pipe or a socket: each section, and each function body, is
+// checked as soon as its bytes have been pushed.
+class StreamingBinaryValidator {
+ public:
+  WABT_DISALLOW_COPY_AND_ASSIGN(StreamingBinaryValidator);
+  StreamingBinaryValidator(const ReadBinaryOptions* options, ErrorHandler*);
+  ~StreamingBinaryValidator();
+
+  Result Push(const void* data, size_t size);
+  Result Finish();
+
+ private:
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace wabt
+
+#endif /* WABT_BINARY_READER_VALIDATOR_H_ */
@@ -20,8 +20,13 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <string>
+#include <utility>
+#include <vector>
+
 #include "binary.h"
 #include "common.h"
+#include "leb128.h"
 #include "opcode.h"
 #include "string-view.h"
 
@@ -36,7 +41,15 @@ struct ReadBinaryOptions {
 
   Stream* log_stream = nullptr;
   bool read_debug_names = false;
+  // Skip a name section that can't be read, without reporting it, rather than
+  // failing. The delegate doesn't get its EndNamesSection callback then.
+  bool skip_bad_names = false;
   bool allow_future_exceptions = false;
+  bool allow_future_bulk_memory = false;
+  bool allow_future_simd = false;
+  bool allow_future_threads = false;
+  bool allow_future_tail_call = false;
+  bool allow_future_multi_value = false;
 };
 
 class BinaryReaderDelegate {
@@ -170,7 +183,26 @@ class BinaryReaderDelegate {
   virtual Result OnOpcodeUint64(uint64_t value) = 0;
   virtual Result OnOpcodeF32(uint32_t value) = 0;
   virtual Result OnOpcodeF64(uint64_t value) = 0;
+  virtual Result OnOpcodeV128(v128 value) = 0;
   virtual Result OnOpcodeBlockSig(Index num_types, Type* sig_types) = 0;
+  virtual Result OnAtomicLoadExpr(Opcode opcode,
+                                  uint32_t alignment_log2,
+                                  Address offset) = 0;
+  virtual Result OnAtomicNotifyExpr(Opcode opcode,
+                                    uint32_t alignment_log2,
+                                    Address offset) = 0;
+  virtual Result OnAtomicRmwExpr(Opcode opcode,
+                                 uint32_t alignment_log2,
+                                 Address offset) = 0;
+  virtual Result OnAtomicRmwCmpxchgExpr(Opcode opcode,
+                                        uint32_t alignment_log2,
+                                        Address offset) = 0;
+  virtual Result OnAtomicStoreExpr(Opcode opcode,
+                                   uint32_t alignment_log2,
+                                   Address offset) = 0;
+  virtual Result OnAtomicWaitExpr(Opcode opcode,
+                                  uint32_t alignment_log2,
+                                  Address offset) = 0;
   virtual Result OnBinaryExpr(Opcode opcode) = 0;
   virtual Result OnBlockExpr(Index num_types, Type* sig_types) = 0;
   virtual Result OnBrExpr(Index depth) = 0;
@@ -201,12 +233,17 @@ class BinaryReaderDelegate {
                             uint32_t alignment_log2,
                             Address offset) = 0;
   virtual Result OnLoopExpr(Index num_types, Type* sig_types) = 0;
+  virtual Result OnMemoryCopyExpr() = 0;
+  virtual Result OnMemoryFillExpr() = 0;
   virtual Result OnNopExpr() = 0;
   virtual Result OnRethrowExpr(Index depth) = 0;
   virtual Result OnReturnExpr() = 0;
+  virtual Result OnReturnCallExpr(Index func_index) = 0;
+  virtual Result OnReturnCallIndirectExpr(Index sig_index) = 0;
   virtual Result OnSelectExpr() = 0;
   virtual Result OnSetGlobalExpr(Index global_index) = 0;
   virtual Result OnSetLocalExpr(Index local_index) = 0;
+  virtual Result OnSimdLaneOpExpr(Opcode opcode, uint32_t lane) = 0;
   virtual Result OnStoreExpr(Opcode opcode,
                              uint32_t alignment_log2,
                              Address offset) = 0;
@@ -216,6 +253,7 @@ class BinaryReaderDelegate {
 
   virtual Result OnUnaryExpr(Opcode opcode) = 0;
   virtual Result OnUnreachableExpr() = 0;
+  virtual Result OnV128ConstExpr(v128 value_bits) = 0;
   virtual Result EndFunctionBody(Index index) = 0;
   virtual Result EndCodeSection() = 0;
 
@@ -297,18 +335,106 @@ class BinaryReaderDelegate {
   const State* state = nullptr;
 };
 
+// Calls |reader|'s callbacks through its vtable; read_binary_static in
+// binary-reader-impl.h binds them at compile time instead.
 Result read_binary(const void* data,
                    size_t size,
                    BinaryReaderDelegate* reader,
                    const ReadBinaryOptions* options);
 
-size_t read_u32_leb128(const uint8_t* ptr,
-                       const uint8_t* end,
-                       uint32_t* out_value);
+// Where each section and function body of a module is, so that one of them can
+// be read without reading everything before it. Reading a section also
+// depends on what the earlier sections declare, so that is kept too.
+struct BinaryIndex {
+  struct SectionEntry {
+    BinarySection section;
+    Offset offset;  // Of the section contents, after the section size.
+    Offset size;
+    // The count at the start of the section; for the start section, the
+    // start function index. Custom sections have none, except the exception
+    // section when it is read.
+    Index count;
+    std::string name;  // Custom sections only.
+  };
+
+  struct FunctionBodyEntry {
+    Offset offset;  // Of the body size.
+    Offset size;    // Including the body size.
+  };
+
+  // Block signatures can reference a signature by index, so the result types
+  // of each signature are kept.
+  struct Signature {
+    Index num_params;
+    TypeVector result_types;
+  };
+
+  // Returns kInvalidIndex if there is no such section.
+  Index FindSection(BinarySection section) const;
+  Index FindCustomSection(string_view name) const;
+
+  // Splits the function bodies into ranges [begin, end) of defined function
+  // indexes, of about |chunk_size| bytes each, e.g. to read them on several
+  // threads.
+  std::vector<std::pair<Index, Index>> SplitFunctionBodies(
+      Offset chunk_size) const;
+
+  uint32_t version = 0;
+  std::vector<SectionEntry> sections;
+  std::vector<FunctionBodyEntry> function_bodies;
+
+  std::vector<Signature> signatures;
+  Index num_imports = 0;
+  Index num_func_imports = 0;
+  Index num_table_imports = 0;
+  Index num_memory_imports = 0;
+  Index num_global_imports = 0;
+  Index num_exception_imports = 0;
+  Index num_function_signatures = 0;
+  Index num_tables = 0;
+  Index num_memories = 0;
+  Index num_globals = 0;
+  Index num_exceptions = 0;
+};
 
-size_t read_i32_leb128(const uint8_t* ptr,
-                       const uint8_t* end,
-                       uint32_t* out_value);
+// Builds |out_index| by skimming the module: the type, import, function,
+// table, memory and global sections (and the exception section, if allowed)
+// are read, since the others depend on them; of the rest, only the section
+// headers and function body sizes are. Errors are reported the same way as
+// for a BinaryReaderNop delegate.
+Result read_binary_index(const void* data,
+                         size_t size,
+                         const ReadBinaryOptions* options,
+                         BinaryIndex* out_index);
+
+// Reads section |section_index| of |index| on its own. |reader| gets the
+// callbacks from BeginSection to the end of the section, but not BeginModule
+// or EndModule.
+Result read_binary_section(const void* data,
+                           size_t size,
+                           const BinaryIndex& index,
+                           Index section_index,
+                           BinaryReaderDelegate* reader,
+                           const ReadBinaryOptions* options);
+
+// Reads the body of the defined function |defined_index| (not counting
+// imports) on its own, from BeginFunctionBody to EndFunctionBody.
+Result read_binary_function_body(const void* data,
+                                 size_t size,
+                                 const BinaryIndex& index,
+                                 Index defined_index,
+                                 BinaryReaderDelegate* reader,
+                                 const ReadBinaryOptions* options);
+
+// Reads the bodies of the defined functions |begin| up to |end| in order,
+// with one reader. Stops at the first error.
+Result read_binary_function_bodies(const void* data,
+                                   size_t size,
+                                   const BinaryIndex& index,
+                                   Index begin,
+                                   Index end,
+                                   BinaryReaderDelegate* reader,
+                                   const ReadBinaryOptions* options);
 
 }  // namespace wabt
 
@@ -119,7 +119,7 @@ void write_i32_leb128(Stream* stream, int32_t value, const char* desc) {
   stream->WriteData(data, length, desc);
 }
 
-static void write_i64_leb128(Stream* stream, int64_t value, const char* desc) {
+void write_i64_leb128(Stream* stream, int64_t value, const char* desc) {
   uint8_t data[MAX_U64_LEB128_BYTES];
   Offset length = 0;
   if (value < 0)
@@ -142,7 +142,12 @@ void write_str(Stream* stream,
 }
 
 void write_opcode(Stream* stream, Opcode opcode) {
-  stream->WriteU8Enum(opcode.GetCode(), opcode.GetName());
+  if (opcode.HasPrefix()) {
+    stream->WriteU8(opcode.GetPrefix(), "prefix");
+    write_u32_leb128(stream, opcode.GetCode(), opcode.GetName());
+  } else {
+    stream->WriteU8Enum(opcode.GetCode(), opcode.GetName());
+  }
 }
 
 void write_type(Stream* stream, Type type) {
@@ -151,6 +156,8 @@ void write_type(Stream* stream, Type type) {
 
 void write_limits(Stream* stream, const Limits* limits) {
   uint32_t flags = limits->has_max ? WABT_BINARY_LIMITS_HAS_MAX_FLAG : 0;
+  if (limits->is_shared)
+    flags |= WABT_BINARY_LIMITS_IS_SHARED_FLAG;
   write_u32_leb128(stream, flags, "limits: flags");
   write_u32_leb128(stream, limits->initial, "limits: initial");
   if (limits->has_max)
@@ -213,6 +220,9 @@ class BinaryWriter {
   void WriteU32Leb128WithReloc(Index index,
                                const char* desc,
                                RelocType reloc_type);
+  void WriteBlockSignature(const Module* module, const BlockSignature& sig);
+  template <typename T>
+  void WriteLoadStoreExpr(const Expr* expr, const char* desc);
   void WriteExpr(const Module* module, const Func* func, const Expr* expr);
   void WriteExprList(const Module* module,
                      const Func* func,
@@ -300,18 +310,6 @@ Offset BinaryWriter::WriteFixupU32Leb128Size(Offset offset,
   }
 }
 
-static void write_inline_signature_type(Stream* stream,
-                                        const BlockSignature& sig) {
-  if (sig.size() == 0) {
-    write_type(stream, Type::Void);
-  } else if (sig.size() == 1) {
-    write_type(stream, sig[0]);
-  } else {
-    /* this is currently unrepresentable */
-    stream->WriteU8(0xff, "INVALID INLINE SIGNATURE");
-  }
-}
-
 void BinaryWriter::BeginKnownSection(BinarySection section_code,
                                      size_t leb_size_guess) {
   assert(last_section_leb_size_guess_ == 0);
@@ -402,6 +400,28 @@ void BinaryWriter::WriteU32Leb128WithReloc(Index index,
   }
 }
 
+// Signatures with more than one result can't be written inline; they are
+// written as the (signed, positive) index of a matching func type instead.
+void BinaryWriter::WriteBlockSignature(const Module* module,
+                                       const BlockSignature& sig) {
+  if (sig.size() == 0) {
+    write_type(&stream_, Type::Void);
+  } else if (sig.size() == 1) {
+    write_type(&stream_, sig[0]);
+  } else {
+    FuncSignature func_sig;
+    func_sig.result_types = sig;
+    Index index = module->GetFuncTypeIndex(func_sig);
+    assert(index != kInvalidIndex);
+    if (options_->relocatable) {
+      AddReloc(RelocType::TypeIndexLEB, index);
+      write_fixed_u32_leb128(&stream_, index, "block signature index");
+    } else {
+      write_i32_leb128(&stream_, index, "block signature index");
+    }
+  }
+}
+
 Index BinaryWriter::GetLocalIndex(const Func* func, const Var& var) {
   // func can be nullptr when using get_local/set_local/tee_local in an
   // init_expr.
@@ -414,16 +434,43 @@ Index BinaryWriter::GetLocalIndex(const Func* func, const Var& var) {
   }
 }
 
+template <typename T>
+void BinaryWriter::WriteLoadStoreExpr(const Expr* expr, const char* desc) {
+  auto typed_expr = cast<T>(expr);
+  write_opcode(&stream_, typed_expr->opcode);
+  Address align = typed_expr->opcode.GetAlignment(typed_expr->align);
+  stream_.WriteU8(log2_u32(align), "alignment");
+  write_u32_leb128(&stream_, typed_expr->offset, desc);
+}
+
 void BinaryWriter::WriteExpr(const Module* module,
                              const Func* func,
                              const Expr* expr) {
   switch (expr->type) {
+    case ExprType::AtomicLoad:
+      WriteLoadStoreExpr<AtomicLoadExpr>(expr, "memory offset");
+      break;
+    case ExprType::AtomicNotify:
+      WriteLoadStoreExpr<AtomicNotifyExpr>(expr, "memory offset");
+      break;
+    case ExprType::AtomicRmw:
+      WriteLoadStoreExpr<AtomicRmwExpr>(expr, "memory offset");
+      break;
+    case ExprType::AtomicRmwCmpxchg:
+      WriteLoadStoreExpr<AtomicRmwCmpxchgExpr>(expr, "memory offset");
+      break;
+    case ExprType::AtomicStore:
+      WriteLoadStoreExpr<AtomicStoreExpr>(expr, "memory offset");
+      break;
+    case ExprType::AtomicWait:
+      WriteLoadStoreExpr<AtomicWaitExpr>(expr, "memory offset");
+      break;
     case ExprType::Binary:
       write_opcode(&stream_, cast<BinaryExpr>(expr)->opcode);
       break;
     case ExprType::Block:
       write_opcode(&stream_, Opcode::Block);
-      write_inline_signature_type(&stream_, cast<BlockExpr>(expr)->block->sig);
+      WriteBlockSignature(module, cast<BlockExpr>(expr)->block->sig);
       WriteExprList(module, func, cast<BlockExpr>(expr)->block->exprs);
       write_opcode(&stream_, Opcode::End);
       break;
@@ -487,6 +534,11 @@ void BinaryWriter::WriteExpr(const Module* module,
           write_opcode(&stream_, Opcode::F64Const);
           stream_.WriteU64(const_.f64_bits, "f64 literal");
           break;
+        case Type::V128:
+          write_opcode(&stream_, Opcode::V128Const);
+          stream_.WriteData(&const_.v128_bits, sizeof(const_.v128_bits),
+                            "v128 literal");
+          break;
         default:
           assert(0);
       }
@@ -518,10 +570,19 @@ void BinaryWriter::WriteExpr(const Module* module,
       write_opcode(&stream_, Opcode::GrowMemory);
       write_u32_leb128(&stream_, 0, "grow_memory reserved");
       break;
+    case ExprType::MemoryCopy:
+      write_opcode(&stream_, Opcode::MemoryCopy);
+      write_u32_leb128(&stream_, 0, "memory.copy dst reserved");
+      write_u32_leb128(&stream_, 0, "memory.copy src reserved");
+      break;
+    case ExprType::MemoryFill:
+      write_opcode(&stream_, Opcode::MemoryFill);
+      write_u32_leb128(&stream_, 0, "memory.fill reserved");
+      break;
     case ExprType::If: {
       auto if_expr = cast<IfExpr>(expr);
       write_opcode(&stream_, Opcode::If);
-      write_inline_signature_type(&stream_, if_expr->true_->sig);
+      WriteBlockSignature(module, if_expr->true_->sig);
       WriteExprList(module, func, if_expr->true_->exprs);
       if (!if_expr->false_.empty()) {
         write_opcode(&stream_, Opcode::Else);
@@ -530,17 +591,12 @@ void BinaryWriter::WriteExpr(const Module* module,
       write_opcode(&stream_, Opcode::End);
       break;
     }
-    case ExprType::Load: {
-      auto load_expr = cast<LoadExpr>(expr);
-      write_opcode(&stream_, load_expr->opcode);
-      Address align = load_expr->opcode.GetAlignment(load_expr->align);
-      stream_.WriteU8(log2_u32(align), "alignment");
-      write_u32_leb128(&stream_, load_expr->offset, "load offset");
+    case ExprType::Load:
+      WriteLoadStoreExpr<LoadExpr>(expr, "load offset");
       break;
-    }
     case ExprType::Loop:
       write_opcode(&stream_, Opcode::Loop);
-      write_inline_signature_type(&stream_, cast<LoopExpr>(expr)->block->sig);
+      WriteBlockSignature(module, cast<LoopExpr>(expr)->block->sig);
       WriteExprList(module, func, cast<LoopExpr>(expr)->block->exprs);
       write_opcode(&stream_, Opcode::End);
       break;
@@ -556,6 +612,21 @@ void BinaryWriter::WriteExpr(const Module* module,
     case ExprType::Return:
       write_opcode(&stream_, Opcode::Return);
       break;
+    case ExprType::ReturnCall: {
+      Index index = module->GetFuncIndex(cast<ReturnCallExpr>(expr)->var);
+      write_opcode(&stream_, Opcode::ReturnCall);
+      WriteU32Leb128WithReloc(index, "function index", RelocType::FuncIndexLEB);
+      break;
+    }
+    case ExprType::ReturnCallIndirect: {
+      Index index =
+          module->GetFuncTypeIndex(cast<ReturnCallIndirectExpr>(expr)->var);
+      write_opcode(&stream_, Opcode::ReturnCallIndirect);
+      WriteU32Leb128WithReloc(index, "signature index",
+                              RelocType::TypeIndexLEB);
+      write_u32_leb128(&stream_, 0, "return_call_indirect reserved");
+      break;
+    }
     case ExprType::Select:
       write_opcode(&stream_, Opcode::Select);
       break;
@@ -571,14 +642,15 @@ void BinaryWriter::WriteExpr(const Module* module,
       write_u32_leb128(&stream_, index, "local index");
       break;
     }
-    case ExprType::Store: {
-      auto store_expr = cast<StoreExpr>(expr);
-      write_opcode(&stream_, store_expr->opcode);
-      Address align = store_expr->opcode.GetAlignment(store_expr->align);
-      stream_.WriteU8(log2_u32(align), "alignment");
-      write_u32_leb128(&stream_, store_expr->offset, "store offset");
+    case ExprType::SimdLaneOp: {
+      auto lane_expr = cast<SimdLaneOpExpr>(expr);
+      write_opcode(&stream_, lane_expr->opcode);
+      stream_.WriteU8(lane_expr->lane, "lane index");
       break;
     }
+    case ExprType::Store:
+      WriteLoadStoreExpr<StoreExpr>(expr, "store offset");
+      break;
     case ExprType::TeeLocal: {
       Index index = GetLocalIndex(func, cast<TeeLocalExpr>(expr)->var);
       write_opcode(&stream_, Opcode::TeeLocal);
@@ -593,7 +665,7 @@ void BinaryWriter::WriteExpr(const Module* module,
     case ExprType::TryBlock: {
       auto try_expr = cast<TryExpr>(expr);
       write_opcode(&stream_, Opcode::Try);
-      write_inline_signature_type(&stream_, try_expr->block->sig);
+      WriteBlockSignature(module, try_expr->block->sig);
       WriteExprList(module, func, try_expr->block->exprs);
       for (Catch* catch_ : try_expr->catches) {
         if (catch_->IsCatchAll()) {
@@ -43,6 +43,8 @@ void write_u32_leb128(Stream* stream, uint32_t value, const char* desc);
 
 void write_i32_leb128(Stream* stream, int32_t value, const char* desc);
 
+void write_i64_leb128(Stream* stream, int64_t value, const char* desc);
+
 void write_fixed_u32_leb128(Stream* stream, uint32_t value, const char* desc);
 
 Offset write_fixed_u32_leb128_at(Stream* stream,
@@ -22,6 +22,13 @@
 #include <cstdio>
 #include <cstring>
 
+#if HAVE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 #if COMPILER_IS_MSVC
 #include <fcntl.h>
 #include <io.h>
@@ -80,44 +87,152 @@ void destroy_string_slice(StringSlice* str) {
   delete [] str->start;
 }
 
-Result ReadFile(const char* filename, std::vector<uint8_t>* out_data) {
-  FILE* infile = fopen(filename, "rb");
-  if (!infile) {
-    const char format[] = "unable to read file %s";
-    char msg[PATH_MAX + sizeof(format)];
-    wabt_snprintf(msg, sizeof(msg), format, filename);
-    perror(msg);
-    return Result::Error;
-  }
+static void print_open_error(const char* filename) {
+  const char format[] = "unable to read file %s";
+  char msg[PATH_MAX + sizeof(format)];
+  wabt_snprintf(msg, sizeof(msg), format, filename);
+  perror(msg);
+}
+
+// Read the rest of |file| in chunks, for files that can't report their size,
+// e.g. pipes.
+static Result read_until_end(FILE* file, std::vector<uint8_t>* out_data) {
+  const size_t kChunkSize = 64 * 1024;
+  size_t size = 0;
+  size_t bytes_read;
+  do {
+    out_data->resize(size + kChunkSize);
+    bytes_read = fread(out_data->data() + size, 1, kChunkSize, file);
+    size += bytes_read;
+  } while (bytes_read == kChunkSize);
+  out_data->resize(size);
 
-  if (fseek(infile, 0, SEEK_END) < 0) {
-    perror("fseek to end failed");
-    fclose(infile);
+  if (ferror(file)) {
+    perror("fread failed");
     return Result::Error;
   }
+  return Result::Ok;
+}
 
-  long size = ftell(infile);
+static Result read_open_file(FILE* file, std::vector<uint8_t>* out_data) {
+  if (fseek(file, 0, SEEK_END) < 0)
+    return read_until_end(file, out_data);
+
+  long size = ftell(file);
   if (size < 0) {
     perror("ftell failed");
-    fclose(infile);
     return Result::Error;
   }
 
-  if (fseek(infile, 0, SEEK_SET) < 0) {
+  if (fseek(file, 0, SEEK_SET) < 0) {
     perror("fseek to beginning failed");
-    fclose(infile);
     return Result::Error;
   }
 
   out_data->resize(size);
-  if (size != 0 && fread(out_data->data(), size, 1, infile) != 1) {
+  if (size != 0 && fread(out_data->data(), size, 1, file) != 1) {
     perror("fread failed");
-    fclose(infile);
     return Result::Error;
   }
+  return Result::Ok;
+}
 
+Result ReadFile(const char* filename, std::vector<uint8_t>* out_data) {
+  FILE* infile = fopen(filename, "rb");
+  if (!infile) {
+    print_open_error(filename);
+    return Result::Error;
+  }
+
+  Result result = read_open_file(infile, out_data);
   fclose(infile);
-  return Result::Ok;
+  return result;
+}
+
+Result ReadFileChunks(const char* filename, const ChunkCallback& on_chunk) {
+  FILE* infile = fopen(filename, "rb");
+  if (!infile) {
+    print_open_error(filename);
+    return Result::Error;
+  }
+
+  const size_t kChunkSize = 64 * 1024;
+  std::vector<uint8_t> chunk(kChunkSize);
+  Result result = Result::Ok;
+  size_t bytes_read;
+  do {
+    bytes_read = fread(chunk.data(), 1, kChunkSize, infile);
+    if (bytes_read != 0)
+      result = on_chunk(chunk.data(), bytes_read);
+  } while (Succeeded(result) && bytes_read == kChunkSize);
+
+  if (Succeeded(result) && ferror(infile)) {
+    perror("fread failed");
+    result = Result::Error;
+  }
+  fclose(infile);
+  return result;
+}
+
+MappedFile::MappedFile() {}
+
+MappedFile::~MappedFile() {
+#if HAVE_MMAP
+  if (mapping_)
+    munmap(mapping_, size_);
+#endif
+}
+
+// static
+bool MappedFile::CanMap(const char* filename) {
+#if HAVE_MMAP
+  struct stat info;
+  return stat(filename, &info) == 0 && S_ISREG(info.st_mode) &&
+         info.st_size > 0;
+#else
+  return false;
+#endif
+}
+
+Result MappedFile::Open(const char* filename, bool writable) {
+  assert(!mapping_ && buffer_.empty());
+  writable_ = writable;
+#if HAVE_MMAP
+  int fd = open(filename, O_RDONLY);
+  if (fd < 0) {
+    print_open_error(filename);
+    return Result::Error;
+  }
+
+  struct stat info;
+  if (fstat(fd, &info) == 0 && S_ISREG(info.st_mode) && info.st_size > 0) {
+    // A private mapping, so that writes are copied rather than written back.
+    int prot = writable ? PROT_READ | PROT_WRITE : PROT_READ;
+    void* mapping = mmap(nullptr, info.st_size, prot, MAP_PRIVATE, fd, 0);
+    if (mapping != MAP_FAILED) {
+      close(fd);
+      mapping_ = mapping;
+      data_ = static_cast<uint8_t*>(mapping);
+      size_ = info.st_size;
+      return Result::Ok;
+    }
+  }
+
+  // Read from the same descriptor, so that a pipe isn't opened twice.
+  FILE* file = fdopen(fd, "rb");
+  if (!file) {
+    perror("fdopen failed");
+    close(fd);
+    return Result::Error;
+  }
+  Result result = read_open_file(file, &buffer_);
+  fclose(file);
+#else
+  Result result = ReadFile(filename, &buffer_);
+#endif
+  data_ = DataOrNull(buffer_);
+  size_ = buffer_.size();
+  return result;
 }
 
 void init_stdio() {
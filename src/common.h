@@ -25,6 +25,7 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <functional>
 #include <string>
 #include <type_traits>
 #include <vector>
@@ -197,6 +198,7 @@ enum class Type {
   I64 = -0x02,
   F32 = -0x03,
   F64 = -0x04,
+  V128 = -0x05,
   Anyfunc = -0x10,
   Func = -0x20,
   Void = -0x40,
@@ -205,6 +207,11 @@ enum class Type {
 };
 typedef std::vector<Type> TypeVector;
 
+/* the bits of a v128 value, lane 0 of an i32x4 is v[0] */
+struct v128 {
+  uint32_t v[4];
+};
+
 enum class RelocType {
   FuncIndexLEB = 0,   /* e.g. immediate of call instruction */
   TableIndexSLEB = 1, /* e.g. loading address of function */
@@ -251,6 +258,7 @@ struct Limits {
   uint64_t initial;
   uint64_t max;
   bool has_max;
+  bool is_shared;
 };
 
 enum { WABT_USE_NATURAL_ALIGNMENT = 0xFFFFFFFF };
@@ -315,6 +323,44 @@ inline StringSlice string_view_to_string_slice(string_view view) {
 
 Result ReadFile(const char* filename, std::vector<uint8_t>* out_data);
 
+typedef std::function<Result(const void* data, size_t size)> ChunkCallback;
+
+// Read |filename| a chunk at a time, calling |on_chunk| with each chunk as soon
+// as it has been read, so that e.g. a pipe's contents can be used before the
+// writer is done. Stops at the first chunk for which |on_chunk| fails.
+Result ReadFileChunks(const char* filename, const ChunkCallback& on_chunk);
+
+// The contents of a file, without copying them where possible: a regular file
+// is mapped into memory, and anything else (e.g. a pipe) is read into a
+// buffer.
+class MappedFile {
+ public:
+  WABT_DISALLOW_COPY_AND_ASSIGN(MappedFile);
+  MappedFile();
+  ~MappedFile();
+
+  // Whether Open() would map |filename|, rather than read it into a buffer.
+  static bool CanMap(const char* filename);
+
+  // If |writable|, the contents can be modified through mutable_data(); the
+  // changes are never written back to the file.
+  Result Open(const char* filename, bool writable = false);
+
+  const uint8_t* data() const { return data_; }
+  uint8_t* mutable_data() {
+    assert(writable_);
+    return data_;
+  }
+  size_t size() const { return size_; }
+
+ private:
+  uint8_t* data_ = nullptr;
+  size_t size_ = 0;
+  bool writable_ = false;
+  void* mapping_ = nullptr;
+  std::vector<uint8_t> buffer_;
+};
+
 void init_stdio();
 
 /* external kind */
@@ -347,6 +393,8 @@ static WABT_INLINE const char* get_type_name(Type type) {
       return "f32";
     case Type::F64:
       return "f64";
+    case Type::V128:
+      return "v128";
     case Type::Anyfunc:
       return "anyfunc";
     case Type::Func:
@@ -108,7 +108,8 @@ wabt::Result wabt_resolve_names_module(
 wabt::Result wabt_validate_script(wabt::WastLexer* lexer,
                                   wabt::Script* script,
                                   wabt::ErrorHandlerBuffer* error_handler) {
-  return validate_script(lexer, script, error_handler);
+  wabt::ValidateOptions options;
+  return validate_script(lexer, script, error_handler, &options);
 }
 
 wabt::Result wabt_apply_names_module(wabt::Module* module) {
@@ -41,6 +41,12 @@ class ExprVisitor::Delegate {
  public:
   virtual ~Delegate() {}
 
+  virtual Result OnAtomicLoadExpr(AtomicLoadExpr*) = 0;
+  virtual Result OnAtomicNotifyExpr(AtomicNotifyExpr*) = 0;
+  virtual Result OnAtomicRmwExpr(AtomicRmwExpr*) = 0;
+  virtual Result OnAtomicRmwCmpxchgExpr(AtomicRmwCmpxchgExpr*) = 0;
+  virtual Result OnAtomicStoreExpr(AtomicStoreExpr*) = 0;
+  virtual Result OnAtomicWaitExpr(AtomicWaitExpr*) = 0;
   virtual Result OnBinaryExpr(BinaryExpr*) = 0;
   virtual Result BeginBlockExpr(BlockExpr*) = 0;
   virtual Result EndBlockExpr(BlockExpr*) = 0;
@@ -63,11 +69,16 @@ class ExprVisitor::Delegate {
   virtual Result OnLoadExpr(LoadExpr*) = 0;
   virtual Result BeginLoopExpr(LoopExpr*) = 0;
   virtual Result EndLoopExpr(LoopExpr*) = 0;
+  virtual Result OnMemoryCopyExpr(MemoryCopyExpr*) = 0;
+  virtual Result OnMemoryFillExpr(MemoryFillExpr*) = 0;
   virtual Result OnNopExpr(NopExpr*) = 0;
   virtual Result OnReturnExpr(ReturnExpr*) = 0;
+  virtual Result OnReturnCallExpr(ReturnCallExpr*) = 0;
+  virtual Result OnReturnCallIndirectExpr(ReturnCallIndirectExpr*) = 0;
   virtual Result OnSelectExpr(SelectExpr*) = 0;
   virtual Result OnSetGlobalExpr(SetGlobalExpr*) = 0;
   virtual Result OnSetLocalExpr(SetLocalExpr*) = 0;
+  virtual Result OnSimdLaneOpExpr(SimdLaneOpExpr*) = 0;
   virtual Result OnStoreExpr(StoreExpr*) = 0;
   virtual Result OnTeeLocalExpr(TeeLocalExpr*) = 0;
   virtual Result OnUnaryExpr(UnaryExpr*) = 0;
@@ -81,6 +92,14 @@ class ExprVisitor::Delegate {
 
 class ExprVisitor::DelegateNop : public ExprVisitor::Delegate {
  public:
+  Result OnAtomicLoadExpr(AtomicLoadExpr*) override { return Result::Ok; }
+  Result OnAtomicNotifyExpr(AtomicNotifyExpr*) override { return Result::Ok; }
+  Result OnAtomicRmwExpr(AtomicRmwExpr*) override { return Result::Ok; }
+  Result OnAtomicRmwCmpxchgExpr(AtomicRmwCmpxchgExpr*) override {
+    return Result::Ok;
+  }
+  Result OnAtomicStoreExpr(AtomicStoreExpr*) override { return Result::Ok; }
+  Result OnAtomicWaitExpr(AtomicWaitExpr*) override { return Result::Ok; }
   Result OnBinaryExpr(BinaryExpr*) override { return Result::Ok; }
   Result BeginBlockExpr(BlockExpr*) override { return Result::Ok; }
   Result EndBlockExpr(BlockExpr*) override { return Result::Ok; }
@@ -103,11 +122,18 @@ class ExprVisitor::DelegateNop : public ExprVisitor::Delegate {
   Result OnLoadExpr(LoadExpr*) override { return Result::Ok; }
   Result BeginLoopExpr(LoopExpr*) override { return Result::Ok; }
   Result EndLoopExpr(LoopExpr*) override { return Result::Ok; }
+  Result OnMemoryCopyExpr(MemoryCopyExpr*) override { return Result::Ok; }
+  Result OnMemoryFillExpr(MemoryFillExpr*) override { return Result::Ok; }
   Result OnNopExpr(NopExpr*) override { return Result::Ok; }
   Result OnReturnExpr(ReturnExpr*) override { return Result::Ok; }
+  Result OnReturnCallExpr(ReturnCallExpr*) override { return Result::Ok; }
+  Result OnReturnCallIndirectExpr(ReturnCallIndirectExpr*) override {
+    return Result::Ok;
+  }
   Result OnSelectExpr(SelectExpr*) override { return Result::Ok; }
   Result OnSetGlobalExpr(SetGlobalExpr*) override { return Result::Ok; }
   Result OnSetLocalExpr(SetLocalExpr*) override { return Result::Ok; }
+  Result OnSimdLaneOpExpr(SimdLaneOpExpr*) override { return Result::Ok; }
   Result OnStoreExpr(StoreExpr*) override { return Result::Ok; }
   Result OnTeeLocalExpr(TeeLocalExpr*) override { return Result::Ok; }
   Result OnUnaryExpr(UnaryExpr*) override { return Result::Ok; }
@@ -0,0 +1,106 @@
+/*
+ * Copyright 2017 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "int-counter.h"
+
+#include <algorithm>
+#include <cinttypes>
+
+#include "common.h"
+
+namespace wabt {
+
+bool int_counter_gt(const IntCounter& counter_1, const IntCounter& counter_2) {
+  if (counter_1.count != counter_2.count)
+    return counter_1.count > counter_2.count;
+  return counter_1.value > counter_2.value;
+}
+
+bool int_pair_counter_gt(const IntPairCounter& counter_1,
+                         const IntPairCounter& counter_2) {
+  if (counter_1.count != counter_2.count)
+    return counter_1.count > counter_2.count;
+  if (counter_1.first != counter_2.first)
+    return counter_1.first > counter_2.first;
+  return counter_1.second > counter_2.second;
+}
+
+void display_intmax(FILE* out, intmax_t value) {
+  fprintf(out, "%" PRIdMAX, value);
+}
+
+void display_sorted_int_counter_vector(FILE* out,
+                                       const char* title,
+                                       const IntCounterVector& vec,
+                                       IntCounterGtFcn gt_fcn,
+                                       DisplayNameFcn display_fcn,
+                                       const char* name,
+                                       const DisplayCounterOptions& options) {
+  if (vec.size() == 0)
+    return;
+
+  /* First filter out values less than cutoff. This speeds up sorting. */
+  IntCounterVector filtered_vec;
+  for (const IntCounter& counter : vec) {
+    if (counter.count == 0 || counter.count < options.cutoff)
+      continue;
+    filtered_vec.push_back(counter);
+  }
+  std::sort(filtered_vec.begin(), filtered_vec.end(), gt_fcn);
+  fprintf(out, "%s\n", title);
+  for (const IntCounter& counter : filtered_vec) {
+    if (name)
+      fprintf(out, "(%s ", name);
+    display_fcn(out, counter.value);
+    if (name)
+      fprintf(out, ")");
+    fprintf(out, "%s%" PRIzd "\n", options.separator, counter.count);
+  }
+}
+
+void display_sorted_int_pair_counter_vector(
+    FILE* out,
+    const char* title,
+    const IntPairCounterVector& vec,
+    IntPairCounterGtFcn gt_fcn,
+    DisplayNameFcn display_first_fcn,
+    DisplayNameFcn display_second_fcn,
+    const char* name,
+    const DisplayCounterOptions& options) {
+  if (vec.size() == 0)
+    return;
+
+  IntPairCounterVector filtered_vec;
+  for (const IntPairCounter& pair : vec) {
+    if (pair.count == 0 || pair.count < options.cutoff)
+      continue;
+    filtered_vec.push_back(pair);
+  }
+  std::sort(filtered_vec.begin(), filtered_vec.end(), gt_fcn);
+  fprintf(out, "%s\n", title);
+  for (const IntPairCounter& pair : filtered_vec) {
+    if (name)
+      fprintf(out, "(%s ", name);
+    display_first_fcn(out, pair.first);
+    fputc(' ', out);
+    display_second_fcn(out, pair.second);
+    if (name)
+      fprintf(out, ")");
+    fprintf(out, "%s%" PRIzd "\n", options.separator, pair.count);
+  }
+}
+
+}  // namespace wabt
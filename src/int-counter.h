@@ -0,0 +1,83 @@
+/*
+ * Copyright 2017 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef WABT_INT_COUNTER_H_
+#define WABT_INT_COUNTER_H_
+
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+namespace wabt {
+
+struct IntCounter {
+  IntCounter(intmax_t value, size_t count) : value(value), count(count) {}
+
+  intmax_t value;
+  size_t count;
+};
+typedef std::vector<IntCounter> IntCounterVector;
+
+struct IntPairCounter {
+  IntPairCounter(intmax_t first, intmax_t second, size_t count)
+      : first(first), second(second), count(count) {}
+
+  intmax_t first;
+  intmax_t second;
+  size_t count;
+};
+typedef std::vector<IntPairCounter> IntPairCounterVector;
+
+typedef bool (*IntCounterGtFcn)(const IntCounter&, const IntCounter&);
+typedef bool (*IntPairCounterGtFcn)(const IntPairCounter&,
+                                    const IntPairCounter&);
+typedef void (*DisplayNameFcn)(FILE* out, intmax_t value);
+
+// Order by descending count, then by descending value.
+bool int_counter_gt(const IntCounter&, const IntCounter&);
+bool int_pair_counter_gt(const IntPairCounter&, const IntPairCounter&);
+
+void display_intmax(FILE* out, intmax_t value);
+
+struct DisplayCounterOptions {
+  size_t cutoff = 0;  // Counts below this are not printed.
+  const char* separator = ": ";
+};
+
+// Prints |title| and then one line per counter, most frequent first. If
+// |name| is given, each value is printed as "(name value)". Nothing is printed
+// for an empty vector.
+void display_sorted_int_counter_vector(FILE* out,
+                                       const char* title,
+                                       const IntCounterVector& vec,
+                                       IntCounterGtFcn gt_fcn,
+                                       DisplayNameFcn display_fcn,
+                                       const char* name,
+                                       const DisplayCounterOptions& options);
+
+void display_sorted_int_pair_counter_vector(
+    FILE* out,
+    const char* title,
+    const IntPairCounterVector& vec,
+    IntPairCounterGtFcn gt_fcn,
+    DisplayNameFcn display_first_fcn,
+    DisplayNameFcn display_second_fcn,
+    const char* name,
+    const DisplayCounterOptions& options);
+
+}  // namespace wabt
+
+#endif /* WABT_INT_COUNTER_H_ */
@@ -18,12 +18,19 @@
 
 #include <algorithm>
 #include <cassert>
+#include <chrono>
 #include <cinttypes>
 #include <cmath>
 #include <limits>
 #include <type_traits>
 #include <vector>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "binary-reader.h"
+#include "binary-writer.h"
 #include "stream.h"
 
 namespace wabt {
@@ -54,7 +61,7 @@ static const char* s_opcode_name[] = {
     }                              \
   } while (0)
 
-static const char* GetOpcodeName(Opcode opcode) {
+const char* GetOpcodeName(Opcode opcode) {
   int value = static_cast<int>(opcode);
   return value < static_cast<int>(WABT_ARRAY_SIZE(s_opcode_name))
              ? s_opcode_name[value]
@@ -95,10 +102,150 @@ Thread::Thread(Environment* env, const Options& options)
       call_stack_(options.call_stack_size),
       value_stack_top_(value_stack_.data()),
       value_stack_end_(value_stack_.data() + value_stack_.size()),
+      frame_pointer_(value_stack_.data()),
       call_stack_top_(call_stack_.data()),
       call_stack_end_(call_stack_.data() + call_stack_.size()),
       pc_(options.pc) {}
 
+ExecutionCounts::ExecutionCounts()
+    : opcode_counts(kOpcodeCount),
+      opcode_pair_counts(kOpcodeCount * kOpcodeCount),
+      call_indirect_cache_hits(0),
+      call_indirect_cache_misses(0),
+      prev_opcode(Opcode::Invalid),
+      at_block_start(false) {}
+
+void Thread::EnableExecutionCounts() {
+  if (!execution_counts_)
+    execution_counts_.reset(new ExecutionCounts());
+}
+
+TraceBuffer::TraceBuffer(Stream* stream, size_t capacity) : stream_(stream) {
+  size_t rounded_capacity = 1;
+  while (rounded_capacity < capacity)
+    rounded_capacity <<= 1;
+  records_.resize(rounded_capacity);
+  mask_ = rounded_capacity - 1;
+
+  if (stream_) {
+    stream_->WriteU32(kMagic);
+    stream_->WriteU32(kVersion);
+    stream_->WriteU32(sizeof(TraceRecord));
+  }
+}
+
+void TraceBuffer::Flush() {
+  if (!stream_)
+    return;
+
+  // At most one buffer's worth of records is pending, but it may wrap around
+  // the end of |records_|.
+  while (flushed_ < count_) {
+    size_t start = flushed_ & mask_;
+    size_t num_records =
+        std::min<uint64_t>(count_ - flushed_, records_.size() - start);
+    stream_->WriteData(&records_[start], num_records * sizeof(TraceRecord));
+    flushed_ += num_records;
+  }
+}
+
+void TraceBuffer::GetRecords(std::vector<TraceRecord>* out_records) const {
+  uint64_t first = count_ > records_.size() ? count_ - records_.size() : 0;
+  out_records->clear();
+  for (uint64_t i = first; i < count_; ++i)
+    out_records->push_back(records_[i & mask_]);
+}
+
+// static
+wabt::Result TraceBuffer::ReadRecords(const void* data,
+                                      size_t size,
+                                      std::vector<TraceRecord>* out_records) {
+  const size_t kHeaderSize = 3 * sizeof(uint32_t);
+  if (size < kHeaderSize)
+    return wabt::Result::Error;
+
+  uint32_t header[3];
+  memcpy(header, data, kHeaderSize);
+  if (header[0] != kMagic || header[1] != kVersion ||
+      header[2] != sizeof(TraceRecord)) {
+    return wabt::Result::Error;
+  }
+
+  size -= kHeaderSize;
+  if (size % sizeof(TraceRecord) != 0)
+    return wabt::Result::Error;
+
+  out_records->resize(size / sizeof(TraceRecord));
+  if (size != 0) {
+    memcpy(out_records->data(), static_cast<const uint8_t*>(data) + kHeaderSize,
+           size);
+  }
+  return wabt::Result::Ok;
+}
+
+MemoryAccessLog::MemoryAccessLog(Stream* stream, uint32_t sample_interval)
+    : stream_(stream),
+      sample_interval_(std::max<uint32_t>(sample_interval, 1)),
+      countdown_(sample_interval_) {
+  stream_->WriteU32(kMagic);
+  stream_->WriteU32(kVersion);
+  stream_->WriteU32(sample_interval_);
+}
+
+void MemoryAccessLog::Write(IstreamOffset pc,
+                            uint64_t address,
+                            uint8_t size,
+                            bool is_store) {
+  stream_->WriteU8(size | (is_store ? 0x80 : 0));
+  write_i32_leb128(stream_, static_cast<int32_t>(pc - last_pc_), nullptr);
+  write_i64_leb128(stream_, static_cast<int64_t>(address - last_address_),
+                   nullptr);
+  last_pc_ = pc;
+  last_address_ = address;
+}
+
+// static
+wabt::Result MemoryAccessLog::ReadAccesses(
+    const void* data,
+    size_t size,
+    uint32_t* out_sample_interval,
+    std::vector<MemoryAccess>* out_accesses) {
+  const size_t kHeaderSize = 3 * sizeof(uint32_t);
+  if (size < kHeaderSize)
+    return wabt::Result::Error;
+
+  uint32_t header[3];
+  memcpy(header, data, kHeaderSize);
+  if (header[0] != kMagic || header[1] != kVersion)
+    return wabt::Result::Error;
+  *out_sample_interval = header[2];
+
+  const uint8_t* p = static_cast<const uint8_t*>(data) + kHeaderSize;
+  const uint8_t* end = static_cast<const uint8_t*>(data) + size;
+  MemoryAccess access = {};
+  out_accesses->clear();
+  while (p < end) {
+    uint8_t tag = *p++;
+    uint32_t pc_delta;
+    uint64_t address_delta;
+    size_t length = read_i32_leb128(p, end, &pc_delta);
+    if (length == 0)
+      return wabt::Result::Error;
+    p += length;
+    length = read_i64_leb128(p, end, &address_delta);
+    if (length == 0)
+      return wabt::Result::Error;
+    p += length;
+
+    access.pc += pc_delta;
+    access.address += address_delta;
+    access.size = tag & 0x7f;
+    access.is_store = (tag & 0x80) != 0;
+    out_accesses->push_back(access);
+  }
+  return wabt::Result::Ok;
+}
+
 FuncSignature::FuncSignature(Index param_count,
                              Type* param_types,
                              Index result_count,
@@ -106,6 +253,52 @@ FuncSignature::FuncSignature(Index param_count,
     : param_types(param_types, param_types + param_count),
       result_types(result_types, result_types + result_count) {}
 
+Memory::Memory(const Limits& limits)
+    : page_limits(limits), data(limits.initial * WABT_PAGE_SIZE) {
+  if (limits.is_shared) {
+    // The pages aren't touched until the memory grows into them.
+    data.reserve(limits.max * WABT_PAGE_SIZE);
+    wait_queue.reset(new WaitQueue());
+  }
+}
+
+uint32_t WaitQueue::Wait(uint64_t address,
+                         int64_t timeout,
+                         const std::function<bool()>& is_expected) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (!is_expected())
+    return 1;
+
+  Waiter waiter = {address, false};
+  waiters_.push_back(&waiter);
+  auto is_woken = [&waiter]() { return waiter.woken; };
+  if (timeout < 0) {
+    cond_.wait(lock, is_woken);
+  } else if (!cond_.wait_for(lock, std::chrono::nanoseconds(timeout),
+                             is_woken)) {
+    waiters_.remove(&waiter);
+    return 2;
+  }
+  return 0;
+}
+
+uint32_t WaitQueue::Notify(uint64_t address, uint32_t count) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  uint32_t woken = 0;
+  for (auto iter = waiters_.begin(); iter != waiters_.end() && woken < count;) {
+    if ((*iter)->address == address) {
+      (*iter)->woken = true;
+      iter = waiters_.erase(iter);
+      woken++;
+    } else {
+      ++iter;
+    }
+  }
+  if (woken != 0)
+    cond_.notify_all();
+  return woken;
+}
+
 Import::Import() : kind(ExternalKind::Func) {
   func.sig_index = kInvalidIndex;
 }
@@ -162,7 +355,16 @@ DefinedModule::DefinedModule()
     : Module(false),
       start_func_index(kInvalidIndex),
       istream_start(kInvalidIstreamOffset),
-      istream_end(kInvalidIstreamOffset) {}
+      istream_end(kInvalidIstreamOffset),
+      num_func_imports(0),
+      defined_func_env_index(kInvalidIndex),
+      num_defined_funcs(0) {}
+
+TrapFrame::TrapFrame()
+    : istream_offset(kInvalidIstreamOffset),
+      module(nullptr),
+      func_index(kInvalidIndex),
+      binary_offset(kInvalidOffset) {}
 
 HostModule::HostModule(string_view name) : Module(name, true) {}
 
@@ -175,6 +377,7 @@ Environment::MarkPoint Environment::Mark() {
   mark.tables_size = tables_.size();
   mark.globals_size = globals_.size();
   mark.istream_size = istream_->data.size();
+  mark.call_indirect_sites_size = num_call_indirect_sites_;
   return mark;
 }
 
@@ -203,6 +406,13 @@ void Environment::ResetToMarkPoint(const MarkPoint& mark) {
   tables_.erase(tables_.begin() + mark.tables_size, tables_.end());
   globals_.erase(globals_.begin() + mark.globals_size, globals_.end());
   istream_->data.resize(mark.istream_size);
+  num_call_indirect_sites_ = mark.call_indirect_sites_size;
+  InvalidateCallIndirectCaches();
+}
+
+void Environment::InvalidateCallIndirectCaches() {
+  if (++table_generation_ == 0)
+    table_generation_ = 1;
 }
 
 HostModule* Environment::AppendHostModule(string_view name) {
@@ -213,6 +423,23 @@ HostModule* Environment::AppendHostModule(string_view name) {
   return module;
 }
 
+void Environment::ResetResourceUsage() {
+  resource_usage_ = ResourceUsage();
+  resource_usage_.peak_memory_pages = GetMemoryPageCount();
+}
+
+uint32_t Environment::GetMemoryPageCount() const {
+  uint32_t page_count = 0;
+  for (const Memory& memory : memories_)
+    page_count += memory.page_limits.initial;
+  return page_count;
+}
+
+void Environment::UpdatePeakMemoryPages() {
+  resource_usage_.peak_memory_pages =
+      std::max(resource_usage_.peak_memory_pages, GetMemoryPageCount());
+}
+
 Result Thread::PushArgs(const FuncSignature* sig,
                         const std::vector<TypedValue>& args) {
   if (sig->param_types.size() != args.size())
@@ -258,6 +485,7 @@ uint32_t ToRep(int32_t x) { return Bitcast<uint32_t>(x); }
 uint64_t ToRep(int64_t x) { return Bitcast<uint64_t>(x); }
 uint32_t ToRep(float x) { return Bitcast<uint32_t>(x); }
 uint64_t ToRep(double x) { return Bitcast<uint64_t>(x); }
+v128 ToRep(v128 x) { return x; }
 
 template <typename Dst, typename Src>
 Dst FromRep(Src x);
@@ -274,6 +502,8 @@ template <>
 float FromRep<float>(uint32_t x) { return Bitcast<float>(x); }
 template <>
 double FromRep<double>(uint64_t x) { return Bitcast<double>(x); }
+template <>
+v128 FromRep<v128>(v128 x) { return x; }
 
 template <typename T>
 struct FloatTraits;
@@ -497,6 +727,7 @@ template<> struct ExtendMemType<uint64_t, uint64_t> { typedef uint64_t type; };
 template<> struct ExtendMemType<uint64_t, int64_t> { typedef int64_t type; };
 template<> struct ExtendMemType<float, float> { typedef float type; };
 template<> struct ExtendMemType<double, double> { typedef double type; };
+template<> struct ExtendMemType<v128, v128> { typedef v128 type; };
 
 template <typename T, typename MemType> struct WrapMemType;
 template<> struct WrapMemType<uint32_t, uint8_t> { typedef uint8_t type; };
@@ -508,13 +739,17 @@ template<> struct WrapMemType<uint64_t, uint32_t> { typedef uint32_t type; };
 template<> struct WrapMemType<uint64_t, uint64_t> { typedef uint64_t type; };
 template<> struct WrapMemType<float, float> { typedef uint32_t type; };
 template<> struct WrapMemType<double, double> { typedef uint64_t type; };
+template<> struct WrapMemType<v128, v128> { typedef v128 type; };
 
 template <typename T>
 Value MakeValue(ValueTypeRep<T>);
 
+// The 32-bit variants clear the whole slot so the raw 64-bit contents of the
+// value stack are deterministic (see TraceRecord::top).
 template <>
 Value MakeValue<uint32_t>(uint32_t v) {
   Value result;
+  result.i64 = 0;
   result.i32 = v;
   return result;
 }
@@ -522,6 +757,7 @@ Value MakeValue<uint32_t>(uint32_t v) {
 template <>
 Value MakeValue<int32_t>(uint32_t v) {
   Value result;
+  result.i64 = 0;
   result.i32 = v;
   return result;
 }
@@ -543,6 +779,7 @@ Value MakeValue<int64_t>(uint64_t v) {
 template <>
 Value MakeValue<float>(uint32_t v) {
   Value result;
+  result.i64 = 0;
   result.f32_bits = v;
   return result;
 }
@@ -554,6 +791,13 @@ Value MakeValue<double>(uint64_t v) {
   return result;
 }
 
+template <>
+Value MakeValue<v128>(v128 v) {
+  Value result;
+  result.v128_bits = v;
+  return result;
+}
+
 template <typename T> ValueTypeRep<T> GetValue(Value);
 template<> uint32_t GetValue<int32_t>(Value v) { return v.i32; }
 template<> uint32_t GetValue<uint32_t>(Value v) { return v.i32; }
@@ -561,6 +805,7 @@ template<> uint64_t GetValue<int64_t>(Value v) { return v.i64; }
 template<> uint64_t GetValue<uint64_t>(Value v) { return v.i64; }
 template<> uint32_t GetValue<float>(Value v) { return v.f32_bits; }
 template<> uint64_t GetValue<double>(Value v) { return v.f64_bits; }
+template<> v128 GetValue<v128>(Value v) { return v.v128_bits; }
 
 #define TRAP(type) return Result::Trap##type
 #define TRAP_UNLESS(cond, type) TRAP_IF(!(cond), type)
@@ -573,14 +818,15 @@ template<> uint64_t GetValue<double>(Value v) { return v.f64_bits; }
 #define CHECK_STACK() \
   TRAP_IF(value_stack_top_ >= value_stack_end_, ValueStackExhausted)
 
-#define PUSH_NEG_1_AND_BREAK_IF(cond) \
-  if (WABT_UNLIKELY(cond)) {          \
-    CHECK_TRAP(Push<int32_t>(-1));  \
-    break;                            \
-  }
-
 #define GOTO(offset) pc = &istream[offset]
 
+static WABT_INLINE Opcode read_opcode(const uint8_t** pc) {
+  int value = *(*pc)++;
+  if (value == kOpcodePrefix)
+    value = kFirstPrefixedOpcode + *(*pc)++;
+  return static_cast<Opcode>(value);
+}
+
 static WABT_INLINE uint32_t read_u32_at(const uint8_t* pc) {
   uint32_t result;
   memcpy(&result, pc, sizeof(uint32_t));
@@ -605,13 +851,22 @@ static WABT_INLINE uint64_t read_u64(const uint8_t** pc) {
   return result;
 }
 
-static WABT_INLINE void read_table_entry_at(const uint8_t* pc,
-                                            IstreamOffset* out_offset,
-                                            uint32_t* out_drop,
-                                            uint8_t* out_keep) {
-  *out_offset = read_u32_at(pc + WABT_TABLE_ENTRY_OFFSET_OFFSET);
-  *out_drop = read_u32_at(pc + WABT_TABLE_ENTRY_DROP_OFFSET);
-  *out_keep = *(pc + WABT_TABLE_ENTRY_KEEP_OFFSET);
+static WABT_INLINE v128 read_v128_at(const uint8_t* pc) {
+  v128 result;
+  memcpy(&result, pc, sizeof(v128));
+  return result;
+}
+
+static WABT_INLINE v128 read_v128(const uint8_t** pc) {
+  v128 result = read_v128_at(*pc);
+  *pc += sizeof(v128);
+  return result;
+}
+
+// |table| is aligned, so this is a single load.
+static WABT_INLINE IstreamOffset read_br_table_offset_at(const uint8_t* table,
+                                                        Index index) {
+  return read_u32_at(table + index * sizeof(IstreamOffset));
 }
 
 Memory* Thread::ReadMemory(const uint8_t** pc) {
@@ -619,6 +874,25 @@ Memory* Thread::ReadMemory(const uint8_t** pc) {
   return &env_->memories_[memory_index];
 }
 
+void Thread::CacheMemory(Index memory_index) {
+  memory_index_ = memory_index;
+  if (memory_index == kInvalidIndex) {
+    memory_base_ = nullptr;
+    memory_size_ = 0;
+  } else {
+    Memory* memory = &env_->memories_[memory_index];
+    memory_base_ = memory->data.data();
+    memory_size_ = memory->data.size();
+  }
+}
+
+// A shared memory may have been grown by another Thread since it was cached.
+// Kept out of line so that it doesn't bloat every Load and Store.
+WABT_NOINLINE bool Thread::RecacheMemoryCovers(uint64_t end) {
+  CacheMemory(memory_index_);
+  return end <= memory_size_;
+}
+
 Value& Thread::Top() {
   return Pick(1);
 }
@@ -657,53 +931,186 @@ ValueTypeRep<T> Thread::PopRep() {
   return GetValue<T>(Pop());
 }
 
-void Thread::DropKeep(uint32_t drop_count, uint8_t keep_count) {
-  assert(keep_count <= 1);
-  if (keep_count == 1)
+void Thread::DropKeep(uint32_t drop_count, uint32_t keep_count) {
+  if (keep_count == 1) {
     Pick(drop_count + 1) = Top();
+  } else if (keep_count > 1) {
+    Value* keep_start = value_stack_top_ - keep_count;
+    memmove(keep_start - drop_count, keep_start, keep_count * sizeof(Value));
+  }
   value_stack_top_ -= drop_count;
 }
 
-Result Thread::PushCall(const uint8_t* pc) {
+Thread::CallIndirectCache* Thread::GetCallIndirectCache(Index site_index) {
+  // Sites are added as modules are loaded, after the Thread was created.
+  if (site_index >= call_indirect_caches_.size())
+    call_indirect_caches_.resize(env_->num_call_indirect_sites_);
+  return &call_indirect_caches_[site_index];
+}
+
+Result Thread::PushCall(const uint8_t* pc,
+                        Index num_params,
+                        Index memory_index) {
   TRAP_IF(call_stack_top_ >= call_stack_end_, CallStackExhausted);
-  *call_stack_top_++ = pc - GetIstream();
+  call_stack_top_->return_offset = pc - GetIstream();
+  call_stack_top_->frame_pointer = frame_pointer_;
+  call_stack_top_->memory_index = memory_index_;
+  ++call_stack_top_;
+  frame_pointer_ = value_stack_top_ - num_params;
+  // Calls within a module keep the same memory, and its cached base and size.
+  if (memory_index != memory_index_)
+    CacheMemory(memory_index);
   return Result::Ok;
 }
 
 IstreamOffset Thread::PopCall() {
-  return *--call_stack_top_;
+  --call_stack_top_;
+  frame_pointer_ = call_stack_top_->frame_pointer;
+  if (call_stack_top_->memory_index != memory_index_)
+    CacheMemory(call_stack_top_->memory_index);
+  return call_stack_top_->return_offset;
 }
 
-template <typename MemType, typename ResultType>
+template <bool kInstrumented, typename MemType, typename ResultType>
 Result Thread::Load(const uint8_t** pc) {
   typedef typename ExtendMemType<ResultType, MemType>::type ExtendedType;
   static_assert(std::is_floating_point<MemType>::value ==
                     std::is_floating_point<ExtendedType>::value,
                 "Extended type should be float iff MemType is float");
 
-  Memory* memory = ReadMemory(pc);
+  IstreamOffset opcode_offset = *pc - 1 - GetIstream();
   uint64_t offset = static_cast<uint64_t>(Pop<uint32_t>()) + read_u32(pc);
   MemType value;
-  TRAP_IF(offset + sizeof(value) > memory->data.size(),
+  TRAP_IF(offset + sizeof(value) > memory_size_ &&
+              !RecacheMemoryCovers(offset + sizeof(value)),
           MemoryAccessOutOfBounds);
-  void* src = memory->data.data() + static_cast<IstreamOffset>(offset);
+  if (kInstrumented && memory_access_log_)
+    memory_access_log_->Record(opcode_offset, offset, sizeof(value), false);
+  void* src = memory_base_ + static_cast<IstreamOffset>(offset);
   memcpy(&value, src, sizeof(value));
   return Push<ResultType>(static_cast<ExtendedType>(value));
 }
 
-template <typename MemType, typename ResultType>
+template <bool kInstrumented, typename MemType, typename ResultType>
 Result Thread::Store(const uint8_t** pc) {
   typedef typename WrapMemType<ResultType, MemType>::type WrappedType;
-  Memory* memory = ReadMemory(pc);
+  IstreamOffset opcode_offset = *pc - 1 - GetIstream();
   WrappedType value = PopRep<ResultType>();
   uint64_t offset = static_cast<uint64_t>(Pop<uint32_t>()) + read_u32(pc);
-  TRAP_IF(offset + sizeof(value) > memory->data.size(),
+  TRAP_IF(offset + sizeof(value) > memory_size_ &&
+              !RecacheMemoryCovers(offset + sizeof(value)),
           MemoryAccessOutOfBounds);
-  void* dst = memory->data.data() + static_cast<IstreamOffset>(offset);
+  if (kInstrumented && memory_access_log_)
+    memory_access_log_->Record(opcode_offset, offset, sizeof(value), true);
+  void* dst = memory_base_ + static_cast<IstreamOffset>(offset);
   memcpy(dst, &value, sizeof(value));
   return Result::Ok;
 }
 
+// Atomic accesses go through std::atomic so that they are sequentially
+// consistent with the accesses of other threads sharing the memory.
+template <typename T>
+static std::atomic<T>* GetAtomic(Memory* memory, uint64_t offset) {
+  static_assert(sizeof(std::atomic<T>) == sizeof(T),
+                "std::atomic<T> must have the same layout as T");
+  return reinterpret_cast<std::atomic<T>*>(memory->data.data() +
+                                           static_cast<IstreamOffset>(offset));
+}
+
+// Reads the memory and offset immediates and pops the address operand, so it
+// must be called after all the other operands are popped.
+template <bool kInstrumented, typename T>
+Result Thread::AtomicAccess(const uint8_t** pc,
+                            bool is_store,
+                            Memory** out_memory,
+                            uint64_t* out_offset) {
+  // The atomic opcodes are all prefixed, so they take two bytes.
+  IstreamOffset opcode_offset = *pc - 2 - GetIstream();
+  Memory* memory = ReadMemory(pc);
+  uint64_t offset = static_cast<uint64_t>(Pop<uint32_t>()) + read_u32(pc);
+  TRAP_IF(offset + sizeof(T) > memory->data.size(), MemoryAccessOutOfBounds);
+  TRAP_IF(offset % sizeof(T) != 0, AtomicMemoryAccessUnaligned);
+  if (kInstrumented && memory_access_log_)
+    memory_access_log_->Record(opcode_offset, offset, sizeof(T), is_store);
+  *out_memory = memory;
+  *out_offset = offset;
+  return Result::Ok;
+}
+
+// The narrow forms access an unsigned MemType, wrapping the operands and
+// zero-extending the result to ResultType.
+template <bool kInstrumented, typename MemType, typename ResultType>
+Result Thread::AtomicLoad(const uint8_t** pc) {
+  Memory* memory;
+  uint64_t offset;
+  CHECK_TRAP(
+      AtomicAccess<kInstrumented, MemType>(pc, false, &memory, &offset));
+  return Push<ResultType>(GetAtomic<MemType>(memory, offset)->load());
+}
+
+template <bool kInstrumented, typename MemType, typename ResultType>
+Result Thread::AtomicStore(const uint8_t** pc) {
+  MemType value = static_cast<MemType>(Pop<ResultType>());
+  Memory* memory;
+  uint64_t offset;
+  CHECK_TRAP(AtomicAccess<kInstrumented, MemType>(pc, true, &memory, &offset));
+  GetAtomic<MemType>(memory, offset)->store(value);
+  return Result::Ok;
+}
+
+template <bool kInstrumented, typename MemType, typename ResultType>
+Result Thread::AtomicRmw(const uint8_t** pc, AtomicRmwFunc<MemType> func) {
+  MemType value = static_cast<MemType>(Pop<ResultType>());
+  Memory* memory;
+  uint64_t offset;
+  CHECK_TRAP(AtomicAccess<kInstrumented, MemType>(pc, true, &memory, &offset));
+  return Push<ResultType>(func(GetAtomic<MemType>(memory, offset), value));
+}
+
+template <bool kInstrumented, typename MemType, typename ResultType>
+Result Thread::AtomicRmwCmpxchg(const uint8_t** pc) {
+  MemType replacement = static_cast<MemType>(Pop<ResultType>());
+  MemType expected = static_cast<MemType>(Pop<ResultType>());
+  Memory* memory;
+  uint64_t offset;
+  CHECK_TRAP(AtomicAccess<kInstrumented, MemType>(pc, true, &memory, &offset));
+  // On failure, |expected| is updated with the current value, so either way
+  // it holds the value that was read.
+  GetAtomic<MemType>(memory, offset)
+      ->compare_exchange_strong(expected, replacement);
+  return Push<ResultType>(expected);
+}
+
+template <typename T>
+Result Thread::AtomicWait(const uint8_t** pc) {
+  int64_t timeout = Pop<int64_t>();
+  T expected = Pop<T>();
+  Memory* memory;
+  uint64_t offset;
+  CHECK_TRAP(AtomicAccess<false, T>(pc, false, &memory, &offset));
+  TRAP_UNLESS(memory->wait_queue, ExpectedSharedMemory);
+  std::atomic<T>* atomic = GetAtomic<T>(memory, offset);
+  uint32_t result = memory->wait_queue->Wait(
+      offset, timeout, [=]() { return atomic->load() == expected; });
+  // Another Thread may have grown the memory while this one waited.
+  CacheMemory(memory_index_);
+  return Push<uint32_t>(result);
+}
+
+Result Thread::AtomicNotify(const uint8_t** pc) {
+  uint32_t count = Pop<uint32_t>();
+  Memory* memory;
+  uint64_t offset;
+  CHECK_TRAP(AtomicAccess<false, uint32_t>(pc, false, &memory, &offset));
+  // An unshared memory can't have any waiters.
+  if (!memory->wait_queue)
+    return Push<uint32_t>(0);
+  uint32_t result = memory->wait_queue->Notify(offset, count);
+  // As after a wait, another Thread may have grown the memory.
+  CacheMemory(memory_index_);
+  return Push<uint32_t>(result);
+}
+
 template <typename R, typename T>
 Result Thread::Unop(UnopFunc<R, T> func) {
   auto value = PopRep<T>();
@@ -834,6 +1241,37 @@ ValueTypeRep<T> FloatDiv(ValueTypeRep<T> lhs_rep, ValueTypeRep<T> rhs_rep) {
   return result;
 }
 
+// i{32,64}.atomic.rmw.{add,sub,and,or,xor,xchg}
+template <typename T>
+T AtomicAdd(std::atomic<T>* atomic, T value) {
+  return atomic->fetch_add(value);
+}
+
+template <typename T>
+T AtomicSub(std::atomic<T>* atomic, T value) {
+  return atomic->fetch_sub(value);
+}
+
+template <typename T>
+T AtomicAnd(std::atomic<T>* atomic, T value) {
+  return atomic->fetch_and(value);
+}
+
+template <typename T>
+T AtomicOr(std::atomic<T>* atomic, T value) {
+  return atomic->fetch_or(value);
+}
+
+template <typename T>
+T AtomicXor(std::atomic<T>* atomic, T value) {
+  return atomic->fetch_xor(value);
+}
+
+template <typename T>
+T AtomicXchg(std::atomic<T>* atomic, T value) {
+  return atomic->exchange(value);
+}
+
 // i{32,64}.and
 template <typename T>
 ValueTypeRep<T> IntAnd(ValueTypeRep<T> lhs_rep, ValueTypeRep<T> rhs_rep) {
@@ -898,6 +1336,48 @@ ValueTypeRep<R> IntEqz(ValueTypeRep<T> v_rep) {
   return ToRep(v_rep == 0);
 }
 
+// i{32,64}.clz
+template <typename T>
+ValueTypeRep<T> IntClz(ValueTypeRep<T> v_rep);
+
+template <>
+uint32_t IntClz<uint32_t>(uint32_t v_rep) {
+  return v_rep != 0 ? wabt_clz_u32(v_rep) : 32;
+}
+
+template <>
+uint64_t IntClz<uint64_t>(uint64_t v_rep) {
+  return v_rep != 0 ? wabt_clz_u64(v_rep) : 64;
+}
+
+// i{32,64}.ctz
+template <typename T>
+ValueTypeRep<T> IntCtz(ValueTypeRep<T> v_rep);
+
+template <>
+uint32_t IntCtz<uint32_t>(uint32_t v_rep) {
+  return v_rep != 0 ? wabt_ctz_u32(v_rep) : 32;
+}
+
+template <>
+uint64_t IntCtz<uint64_t>(uint64_t v_rep) {
+  return v_rep != 0 ? wabt_ctz_u64(v_rep) : 64;
+}
+
+// i{32,64}.popcnt
+template <typename T>
+ValueTypeRep<T> IntPopcnt(ValueTypeRep<T> v_rep);
+
+template <>
+uint32_t IntPopcnt<uint32_t>(uint32_t v_rep) {
+  return wabt_popcount_u32(v_rep);
+}
+
+template <>
+uint64_t IntPopcnt<uint64_t>(uint64_t v_rep) {
+  return wabt_popcount_u64(v_rep);
+}
+
 // f{32,64}.abs
 template <typename T>
 ValueTypeRep<T> FloatAbs(ValueTypeRep<T> v_rep) {
@@ -1053,6 +1533,389 @@ Result IntTrunc(ValueTypeRep<T> v_rep, ValueTypeRep<R>* out_result) {
   return Result::Ok;
 }
 
+// i32.wrap/i64 | i64.extend_{s,u}/i32 | f{32,64}.convert_{s,u}/i{32,64} |
+// f64.promote/f32
+template <typename R, typename T>
+ValueTypeRep<R> Convert(ValueTypeRep<T> v_rep) {
+  return ToRep(static_cast<R>(FromRep<T>(v_rep)));
+}
+
+template <>
+uint32_t Convert<float, uint64_t>(uint64_t v_rep) {
+  return ToRep(wabt_convert_uint64_to_float(v_rep));
+}
+
+template <>
+uint64_t Convert<double, uint64_t>(uint64_t v_rep) {
+  return ToRep(wabt_convert_uint64_to_double(v_rep));
+}
+
+// f32.demote/f64
+ValueTypeRep<float> FloatDemote(ValueTypeRep<double> v_rep) {
+  typedef FloatTraits<float> F32Traits;
+  typedef FloatTraits<double> F64Traits;
+
+  if (WABT_LIKELY((IsConversionInRange<float, double>(v_rep)))) {
+    return ToRep(static_cast<float>(FromRep<double>(v_rep)));
+  } else if (IsInRangeF64DemoteF32RoundToF32Max(v_rep)) {
+    return F32Traits::kMax;
+  } else if (IsInRangeF64DemoteF32RoundToNegF32Max(v_rep)) {
+    return F32Traits::kNegMax;
+  } else {
+    uint32_t sign = (v_rep >> 32) & F32Traits::kSignMask;
+    uint32_t tag = 0;
+    if (F64Traits::IsNan(v_rep)) {
+      tag = F32Traits::kQuietNanBit |
+            ((v_rep >> (F64Traits::kSigBits - F32Traits::kSigBits)) &
+             F32Traits::kSigMask);
+    }
+    return sign | F32Traits::kInf | tag;
+  }
+}
+
+// {i,f}{32,64}.reinterpret/{f,i}{32,64}
+template <typename R, typename T>
+ValueTypeRep<R> Reinterpret(ValueTypeRep<T> v_rep) {
+  static_assert(sizeof(R) == sizeof(T), "Reinterpret sizes must match.");
+  return v_rep;
+}
+
+// The numeric instructions, which take their operands from the value stack
+// and have no immediates. RunImpl executes them and EvaluateConstantExpr folds
+// them, so both share this list of how each one is evaluated.
+#define WABT_FOREACH_NUMERIC_OPCODE(V)                      \
+  V(I32Add, Binop(Add<uint32_t>))                           \
+  V(I32Sub, Binop(Sub<uint32_t>))                           \
+  V(I32Mul, Binop(Mul<uint32_t>))                           \
+  V(I32DivS, BinopTrap(IntDivS<int32_t>))                   \
+  V(I32DivU, BinopTrap(IntDivU<uint32_t>))                  \
+  V(I32RemS, BinopTrap(IntRemS<int32_t>))                   \
+  V(I32RemU, BinopTrap(IntRemU<uint32_t>))                  \
+  V(I32And, Binop(IntAnd<uint32_t>))                        \
+  V(I32Or, Binop(IntOr<uint32_t>))                          \
+  V(I32Xor, Binop(IntXor<uint32_t>))                        \
+  V(I32Shl, Binop(IntShl<uint32_t>))                        \
+  V(I32ShrU, Binop(IntShr<uint32_t>))                       \
+  V(I32ShrS, Binop(IntShr<int32_t>))                        \
+  V(I32Eq, Binop(Eq<uint32_t>))                             \
+  V(I32Ne, Binop(Ne<uint32_t>))                             \
+  V(I32LtS, Binop(Lt<int32_t>))                             \
+  V(I32LeS, Binop(Le<int32_t>))                             \
+  V(I32LtU, Binop(Lt<uint32_t>))                            \
+  V(I32LeU, Binop(Le<uint32_t>))                            \
+  V(I32GtS, Binop(Gt<int32_t>))                             \
+  V(I32GeS, Binop(Ge<int32_t>))                             \
+  V(I32GtU, Binop(Gt<uint32_t>))                            \
+  V(I32GeU, Binop(Ge<uint32_t>))                            \
+  V(I32Clz, Unop(IntClz<uint32_t>))                         \
+  V(I32Ctz, Unop(IntCtz<uint32_t>))                         \
+  V(I32Popcnt, Unop(IntPopcnt<uint32_t>))                   \
+  V(I32Eqz, Unop(IntEqz<uint32_t, uint32_t>))               \
+  V(I64Add, Binop(Add<uint64_t>))                           \
+  V(I64Sub, Binop(Sub<uint64_t>))                           \
+  V(I64Mul, Binop(Mul<uint64_t>))                           \
+  V(I64DivS, BinopTrap(IntDivS<int64_t>))                   \
+  V(I64DivU, BinopTrap(IntDivU<uint64_t>))                  \
+  V(I64RemS, BinopTrap(IntRemS<int64_t>))                   \
+  V(I64RemU, BinopTrap(IntRemU<uint64_t>))                  \
+  V(I64And, Binop(IntAnd<uint64_t>))                        \
+  V(I64Or, Binop(IntOr<uint64_t>))                          \
+  V(I64Xor, Binop(IntXor<uint64_t>))                        \
+  V(I64Shl, Binop(IntShl<uint64_t>))                        \
+  V(I64ShrU, Binop(IntShr<uint64_t>))                       \
+  V(I64ShrS, Binop(IntShr<int64_t>))                        \
+  V(I64Eq, Binop(Eq<uint64_t>))                             \
+  V(I64Ne, Binop(Ne<uint64_t>))                             \
+  V(I64LtS, Binop(Lt<int64_t>))                             \
+  V(I64LeS, Binop(Le<int64_t>))                             \
+  V(I64LtU, Binop(Lt<uint64_t>))                            \
+  V(I64LeU, Binop(Le<uint64_t>))                            \
+  V(I64GtS, Binop(Gt<int64_t>))                             \
+  V(I64GeS, Binop(Ge<int64_t>))                             \
+  V(I64GtU, Binop(Gt<uint64_t>))                            \
+  V(I64GeU, Binop(Ge<uint64_t>))                            \
+  V(I64Clz, Unop(IntClz<uint64_t>))                         \
+  V(I64Ctz, Unop(IntCtz<uint64_t>))                         \
+  V(I64Popcnt, Unop(IntPopcnt<uint64_t>))                   \
+  V(F32Add, Binop(Add<float>))                              \
+  V(F32Sub, Binop(Sub<float>))                              \
+  V(F32Mul, Binop(Mul<float>))                              \
+  V(F32Div, Binop(FloatDiv<float>))                         \
+  V(F32Min, Binop(FloatMin<float>))                         \
+  V(F32Max, Binop(FloatMax<float>))                         \
+  V(F32Abs, Unop(FloatAbs<float>))                          \
+  V(F32Neg, Unop(FloatNeg<float>))                          \
+  V(F32Copysign, Binop(FloatCopySign<float>))               \
+  V(F32Ceil, Unop(FloatCeil<float>))                        \
+  V(F32Floor, Unop(FloatFloor<float>))                      \
+  V(F32Trunc, Unop(FloatTrunc<float>))                      \
+  V(F32Nearest, Unop(FloatNearest<float>))                  \
+  V(F32Sqrt, Unop(FloatSqrt<float>))                        \
+  V(F32Eq, Binop(Eq<float>))                                \
+  V(F32Ne, Binop(Ne<float>))                                \
+  V(F32Lt, Binop(Lt<float>))                                \
+  V(F32Le, Binop(Le<float>))                                \
+  V(F32Gt, Binop(Gt<float>))                                \
+  V(F32Ge, Binop(Ge<float>))                                \
+  V(F64Add, Binop(Add<double>))                             \
+  V(F64Sub, Binop(Sub<double>))                             \
+  V(F64Mul, Binop(Mul<double>))                             \
+  V(F64Div, Binop(FloatDiv<double>))                        \
+  V(F64Min, Binop(FloatMin<double>))                        \
+  V(F64Max, Binop(FloatMax<double>))                        \
+  V(F64Abs, Unop(FloatAbs<double>))                         \
+  V(F64Neg, Unop(FloatNeg<double>))                         \
+  V(F64Copysign, Binop(FloatCopySign<double>))              \
+  V(F64Ceil, Unop(FloatCeil<double>))                       \
+  V(F64Floor, Unop(FloatFloor<double>))                     \
+  V(F64Trunc, Unop(FloatTrunc<double>))                     \
+  V(F64Nearest, Unop(FloatNearest<double>))                 \
+  V(F64Sqrt, Unop(FloatSqrt<double>))                       \
+  V(F64Eq, Binop(Eq<double>))                               \
+  V(F64Ne, Binop(Ne<double>))                               \
+  V(F64Lt, Binop(Lt<double>))                               \
+  V(F64Le, Binop(Le<double>))                               \
+  V(F64Gt, Binop(Gt<double>))                               \
+  V(F64Ge, Binop(Ge<double>))                               \
+  V(I32TruncSF32, UnopTrap(IntTrunc<int32_t, float>))       \
+  V(I32TruncSF64, UnopTrap(IntTrunc<int32_t, double>))      \
+  V(I32TruncUF32, UnopTrap(IntTrunc<uint32_t, float>))      \
+  V(I32TruncUF64, UnopTrap(IntTrunc<uint32_t, double>))     \
+  V(I32WrapI64, Unop(Convert<uint32_t, uint64_t>))          \
+  V(I64TruncSF32, UnopTrap(IntTrunc<int64_t, float>))       \
+  V(I64TruncSF64, UnopTrap(IntTrunc<int64_t, double>))      \
+  V(I64TruncUF32, UnopTrap(IntTrunc<uint64_t, float>))      \
+  V(I64TruncUF64, UnopTrap(IntTrunc<uint64_t, double>))     \
+  V(I64ExtendSI32, Unop(Convert<int64_t, int32_t>))         \
+  V(I64ExtendUI32, Unop(Convert<uint64_t, uint32_t>))       \
+  V(F32ConvertSI32, Unop(Convert<float, int32_t>))          \
+  V(F32ConvertUI32, Unop(Convert<float, uint32_t>))         \
+  V(F32ConvertSI64, Unop(Convert<float, int64_t>))          \
+  V(F32ConvertUI64, Unop(Convert<float, uint64_t>))         \
+  V(F32DemoteF64, Unop(FloatDemote))                        \
+  V(F32ReinterpretI32, Unop(Reinterpret<float, uint32_t>))  \
+  V(F64ConvertSI32, Unop(Convert<double, int32_t>))         \
+  V(F64ConvertUI32, Unop(Convert<double, uint32_t>))        \
+  V(F64ConvertSI64, Unop(Convert<double, int64_t>))         \
+  V(F64ConvertUI64, Unop(Convert<double, uint64_t>))        \
+  V(F64PromoteF32, Unop(Convert<double, float>))            \
+  V(F64ReinterpretI64, Unop(Reinterpret<double, uint64_t>)) \
+  V(I32ReinterpretF32, Unop(Reinterpret<uint32_t, float>))  \
+  V(I64ReinterpretF64, Unop(Reinterpret<uint64_t, double>)) \
+  V(I32Rotr, Binop(IntRotr<uint32_t>))                      \
+  V(I32Rotl, Binop(IntRotl<uint32_t>))                      \
+  V(I64Rotr, Binop(IntRotr<uint64_t>))                      \
+  V(I64Rotl, Binop(IntRotl<uint64_t>))                      \
+  V(I64Eqz, Unop(IntEqz<uint32_t, uint64_t>))
+
+// The SIMD operations below are written once per lane type in terms of
+// scalar lanes, and specialized with SSE2 intrinsics where the host has them.
+// The scalar versions are also the reference for the specializations.
+template <typename Lane>
+struct SimdLanes {
+  static const size_t kCount = sizeof(v128) / sizeof(Lane);
+  Lane lanes[kCount];
+
+  explicit SimdLanes(v128 value) { memcpy(lanes, &value, sizeof(v128)); }
+
+  v128 ToV128() const {
+    v128 result;
+    memcpy(&result, lanes, sizeof(v128));
+    return result;
+  }
+};
+
+template <typename Lane, typename Func>
+v128 SimdLanewise(v128 lhs, v128 rhs, Func func) {
+  SimdLanes<Lane> lhs_lanes(lhs);
+  SimdLanes<Lane> rhs_lanes(rhs);
+  for (size_t i = 0; i < SimdLanes<Lane>::kCount; ++i)
+    lhs_lanes.lanes[i] = func(lhs_lanes.lanes[i], rhs_lanes.lanes[i]);
+  return lhs_lanes.ToV128();
+}
+
+// Integer lanes are multiplied as uint64_t so narrow lanes don't overflow the
+// int they would otherwise be promoted to.
+template <typename Lane>
+using SimdWideLane = typename std::conditional<std::is_floating_point<Lane>::value,
+                                               Lane,
+                                               uint64_t>::type;
+
+// {i8x16,i16x8,i32x4,i64x2,f32x4,f64x2}.add
+template <typename Lane>
+v128 SimdAdd(v128 lhs, v128 rhs) {
+  return SimdLanewise<Lane>(lhs, rhs, [](Lane a, Lane b) -> Lane {
+    return static_cast<SimdWideLane<Lane>>(a) + b;
+  });
+}
+
+// {i8x16,i16x8,i32x4,i64x2,f32x4,f64x2}.sub
+template <typename Lane>
+v128 SimdSub(v128 lhs, v128 rhs) {
+  return SimdLanewise<Lane>(lhs, rhs, [](Lane a, Lane b) -> Lane {
+    return static_cast<SimdWideLane<Lane>>(a) - b;
+  });
+}
+
+// {i16x8,i32x4,i64x2,f32x4,f64x2}.mul
+template <typename Lane>
+v128 SimdMul(v128 lhs, v128 rhs) {
+  return SimdLanewise<Lane>(lhs, rhs, [](Lane a, Lane b) -> Lane {
+    return static_cast<SimdWideLane<Lane>>(a) * b;
+  });
+}
+
+// f{32x4,64x2}.div
+template <typename Lane>
+v128 SimdDiv(v128 lhs, v128 rhs) {
+  return SimdLanewise<Lane>(lhs, rhs, [](Lane a, Lane b) { return a / b; });
+}
+
+// {i8x16,i16x8,i32x4,i64x2,f32x4,f64x2}.splat, where the float lanes are
+// splatted as their integer representation.
+template <typename Lane, typename Rep>
+v128 SimdSplat(Rep value) {
+  SimdLanes<Lane> result(v128{});
+  for (size_t i = 0; i < SimdLanes<Lane>::kCount; ++i)
+    result.lanes[i] = static_cast<Lane>(value);
+  return result.ToV128();
+}
+
+// {i32x4,i64x2,f32x4,f64x2}.extract_lane
+template <typename Lane>
+Lane SimdExtractLane(v128 value, uint8_t lane) {
+  SimdLanes<Lane> lanes(value);
+  assert(lane < SimdLanes<Lane>::kCount);
+  return lanes.lanes[lane];
+}
+
+// {i32x4,i64x2,f32x4,f64x2}.replace_lane
+template <typename Lane>
+v128 SimdReplaceLane(v128 value, uint8_t lane, Lane lane_value) {
+  SimdLanes<Lane> lanes(value);
+  assert(lane < SimdLanes<Lane>::kCount);
+  lanes.lanes[lane] = lane_value;
+  return lanes.ToV128();
+}
+
+#if defined(__SSE2__)
+static WABT_INLINE __m128i ToM128i(v128 value) {
+  return _mm_loadu_si128(reinterpret_cast<const __m128i*>(&value));
+}
+
+static WABT_INLINE v128 FromM128i(__m128i value) {
+  v128 result;
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(&result), value);
+  return result;
+}
+
+static WABT_INLINE __m128 ToM128(v128 value) {
+  return _mm_loadu_ps(reinterpret_cast<const float*>(&value));
+}
+
+static WABT_INLINE v128 FromM128(__m128 value) {
+  v128 result;
+  _mm_storeu_ps(reinterpret_cast<float*>(&result), value);
+  return result;
+}
+
+static WABT_INLINE __m128d ToM128d(v128 value) {
+  return _mm_loadu_pd(reinterpret_cast<const double*>(&value));
+}
+
+static WABT_INLINE v128 FromM128d(__m128d value) {
+  v128 result;
+  _mm_storeu_pd(reinterpret_cast<double*>(&result), value);
+  return result;
+}
+
+#define WABT_SIMD_SSE2_BINOP(name, Lane, To, From, intrinsic) \
+  template <>                                                 \
+  v128 name<Lane>(v128 lhs, v128 rhs) {                       \
+    return From(intrinsic(To(lhs), To(rhs)));                 \
+  }
+
+WABT_SIMD_SSE2_BINOP(SimdAdd, uint8_t, ToM128i, FromM128i, _mm_add_epi8)
+WABT_SIMD_SSE2_BINOP(SimdAdd, uint16_t, ToM128i, FromM128i, _mm_add_epi16)
+WABT_SIMD_SSE2_BINOP(SimdAdd, uint32_t, ToM128i, FromM128i, _mm_add_epi32)
+WABT_SIMD_SSE2_BINOP(SimdAdd, uint64_t, ToM128i, FromM128i, _mm_add_epi64)
+WABT_SIMD_SSE2_BINOP(SimdAdd, float, ToM128, FromM128, _mm_add_ps)
+WABT_SIMD_SSE2_BINOP(SimdAdd, double, ToM128d, FromM128d, _mm_add_pd)
+WABT_SIMD_SSE2_BINOP(SimdSub, uint8_t, ToM128i, FromM128i, _mm_sub_epi8)
+WABT_SIMD_SSE2_BINOP(SimdSub, uint16_t, ToM128i, FromM128i, _mm_sub_epi16)
+WABT_SIMD_SSE2_BINOP(SimdSub, uint32_t, ToM128i, FromM128i, _mm_sub_epi32)
+WABT_SIMD_SSE2_BINOP(SimdSub, uint64_t, ToM128i, FromM128i, _mm_sub_epi64)
+WABT_SIMD_SSE2_BINOP(SimdSub, float, ToM128, FromM128, _mm_sub_ps)
+WABT_SIMD_SSE2_BINOP(SimdSub, double, ToM128d, FromM128d, _mm_sub_pd)
+WABT_SIMD_SSE2_BINOP(SimdMul, uint16_t, ToM128i, FromM128i, _mm_mullo_epi16)
+WABT_SIMD_SSE2_BINOP(SimdMul, float, ToM128, FromM128, _mm_mul_ps)
+WABT_SIMD_SSE2_BINOP(SimdMul, double, ToM128d, FromM128d, _mm_mul_pd)
+WABT_SIMD_SSE2_BINOP(SimdDiv, float, ToM128, FromM128, _mm_div_ps)
+WABT_SIMD_SSE2_BINOP(SimdDiv, double, ToM128d, FromM128d, _mm_div_pd)
+
+#undef WABT_SIMD_SSE2_BINOP
+
+// SSE2 has no 32-bit low multiply (_mm_mullo_epi32 is SSE4.1), so multiply the
+// even and odd lanes separately as 32x32->64 and gather the low halves.
+template <>
+v128 SimdMul<uint32_t>(v128 lhs, v128 rhs) {
+  __m128i a = ToM128i(lhs);
+  __m128i b = ToM128i(rhs);
+  __m128i even = _mm_mul_epu32(a, b);
+  __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+  return FromM128i(
+      _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                         _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0))));
+}
+
+#endif  // __SSE2__
+
+// v128.and
+v128 SimdAnd(v128 lhs, v128 rhs) {
+#if defined(__SSE2__)
+  return FromM128i(_mm_and_si128(ToM128i(lhs), ToM128i(rhs)));
+#else
+  return SimdLanewise<uint32_t>(lhs, rhs,
+                                [](uint32_t a, uint32_t b) { return a & b; });
+#endif
+}
+
+// v128.andnot
+v128 SimdAndnot(v128 lhs, v128 rhs) {
+#if defined(__SSE2__)
+  // _mm_andnot_si128 complements its first operand.
+  return FromM128i(_mm_andnot_si128(ToM128i(rhs), ToM128i(lhs)));
+#else
+  return SimdLanewise<uint32_t>(lhs, rhs,
+                                [](uint32_t a, uint32_t b) { return a & ~b; });
+#endif
+}
+
+// v128.or
+v128 SimdOr(v128 lhs, v128 rhs) {
+#if defined(__SSE2__)
+  return FromM128i(_mm_or_si128(ToM128i(lhs), ToM128i(rhs)));
+#else
+  return SimdLanewise<uint32_t>(lhs, rhs,
+                                [](uint32_t a, uint32_t b) { return a | b; });
+#endif
+}
+
+// v128.xor
+v128 SimdXor(v128 lhs, v128 rhs) {
+#if defined(__SSE2__)
+  return FromM128i(_mm_xor_si128(ToM128i(lhs), ToM128i(rhs)));
+#else
+  return SimdLanewise<uint32_t>(lhs, rhs,
+                                [](uint32_t a, uint32_t b) { return a ^ b; });
+#endif
+}
+
+// v128.not
+v128 SimdNot(v128 value) {
+  return SimdXor(value, SimdSplat<uint32_t>(0xffffffffu));
+}
+
 bool Environment::FuncSignaturesAreEqual(Index sig_index_0,
                                          Index sig_index_1) const {
   if (sig_index_0 == sig_index_1)
@@ -1063,6 +1926,73 @@ bool Environment::FuncSignaturesAreEqual(Index sig_index_0,
          sig_0->result_types == sig_1->result_types;
 }
 
+TrapFrame Environment::GetTrapFrame(IstreamOffset offset) {
+  TrapFrame frame;
+  frame.istream_offset = offset;
+  for (const std::unique_ptr<Module>& module_ptr : modules_) {
+    if (module_ptr->is_host)
+      continue;
+    DefinedModule* module = module_ptr->as_defined();
+    if (offset < module->istream_start || offset >= module->istream_end)
+      continue;
+
+    frame.module = module;
+    // Function bodies are emitted in order, so |offset| is in the last one
+    // that starts at or before it.
+    DefinedFunc* func = nullptr;
+    Index env_index = kInvalidIndex;
+    for (Index i = 0; i < module->num_defined_funcs; ++i) {
+      Index index = module->defined_func_env_index + i;
+      DefinedFunc* defined_func = funcs_[index]->as_defined();
+      if (defined_func->offset > offset)
+        break;
+      func = defined_func;
+      env_index = index;
+      frame.func_index = module->num_func_imports + i;
+    }
+
+    if (func) {
+      frame.func_name = func->name;
+      for (const Export& export_ : module->exports) {
+        if (!frame.func_name.empty())
+          break;
+        if (export_.kind == ExternalKind::Func && export_.index == env_index)
+          frame.func_name = export_.name;
+      }
+    }
+
+    auto iter = std::upper_bound(
+        module->offset_map.begin(), module->offset_map.end(), offset,
+        [](IstreamOffset offset, const OffsetMapEntry& entry) {
+          return offset < entry.istream_offset;
+        });
+    if (iter != module->offset_map.begin())
+      frame.binary_offset = (iter - 1)->binary_offset;
+    break;
+  }
+  return frame;
+}
+
+void Thread::SaveTrapStack(Result result) {
+  trap_stack_.clear();
+  // A trap leaves pc_ inside the trapping instruction, except that running out
+  // of instructions leaves it at the next one. Each return offset is just past
+  // a call.
+  bool at_next = result == Result::TrapInstructionLimitExceeded;
+  trap_stack_.push_back(at_next ? pc_ : pc_ - 1);
+  for (CallFrame* frame = call_stack_top_; frame != call_stack_.data();) {
+    --frame;
+    trap_stack_.push_back(frame->return_offset - 1);
+  }
+}
+
+std::vector<TrapFrame> Thread::GetTrapStackTrace() const {
+  std::vector<TrapFrame> frames;
+  for (IstreamOffset offset : trap_stack_)
+    frames.push_back(env_->GetTrapFrame(offset));
+  return frames;
+}
+
 Result Thread::RunFunction(Index func_index,
                            const std::vector<TypedValue>& args,
                            std::vector<TypedValue>* out_results) {
@@ -1071,10 +2001,16 @@ Result Thread::RunFunction(Index func_index,
 
   Result result = PushArgs(sig, args);
   if (result == Result::Ok) {
-    result = func->is_host ? CallHost(func->as_host())
-                           : RunDefinedFunction(func->as_defined()->offset);
+    result = func->is_host
+                 ? CallHost(func->as_host())
+                 : RunDefinedFunction(func->as_defined(),
+                                      sig->param_types.size());
     if (result == Result::Ok)
       CopyResults(sig, out_results);
+    else if (func->is_host)
+      trap_stack_.clear();
+    else
+      SaveTrapStack(result);
   }
 
   // Always reset the value and call stacks.
@@ -1094,9 +2030,14 @@ Result Thread::TraceFunction(Index func_index,
   if (result == Result::Ok) {
     result = func->is_host
                  ? CallHost(func->as_host())
-                 : TraceDefinedFunction(func->as_defined()->offset, stream);
+                 : TraceDefinedFunction(func->as_defined(),
+                                        sig->param_types.size(), stream);
     if (result == Result::Ok)
       CopyResults(sig, out_results);
+    else if (func->is_host)
+      trap_stack_.clear();
+    else
+      SaveTrapStack(result);
   }
 
   // Always reset the value and call stacks.
@@ -1105,11 +2046,19 @@ Result Thread::TraceFunction(Index func_index,
   return result;
 }
 
-Result Thread::RunDefinedFunction(IstreamOffset function_offset) {
+Result Thread::RunDefinedFunction(const DefinedFunc* func,
+                                  Index num_params) {
   const int kNumInstructions = 1000;
   Result result = Result::Ok;
-  pc_ = function_offset;
-  IstreamOffset* call_stack_return_top = call_stack_top_;
+  pc_ = func->offset;
+  frame_pointer_ = value_stack_top_ - num_params;
+  // The memory may have been grown or replaced since the last run.
+  CacheMemory(func->memory_index);
+  if (execution_counts_) {
+    execution_counts_->prev_opcode = Opcode::Invalid;
+    CountFuncEntry(func->offset);
+  }
+  CallFrame* call_stack_return_top = call_stack_top_;
   while (result == Result::Ok) {
     result = Run(kNumInstructions, call_stack_return_top);
   }
@@ -1119,12 +2068,19 @@ Result Thread::RunDefinedFunction(IstreamOffset function_offset) {
   return Result::Ok;
 }
 
-Result Thread::TraceDefinedFunction(IstreamOffset function_offset,
+Result Thread::TraceDefinedFunction(const DefinedFunc* func,
+                                    Index num_params,
                                     Stream* stream) {
   const int kNumInstructions = 1;
   Result result = Result::Ok;
-  pc_ = function_offset;
-  IstreamOffset* call_stack_return_top = call_stack_top_;
+  pc_ = func->offset;
+  frame_pointer_ = value_stack_top_ - num_params;
+  CacheMemory(func->memory_index);
+  if (execution_counts_) {
+    execution_counts_->prev_opcode = Opcode::Invalid;
+    CountFuncEntry(func->offset);
+  }
+  CallFrame* call_stack_return_top = call_stack_top_;
   while (result == Result::Ok) {
     Trace(stream);
     result = Run(kNumInstructions, call_stack_return_top);
@@ -1136,6 +2092,13 @@ Result Thread::TraceDefinedFunction(IstreamOffset function_offset,
 }
 
 Result Thread::CallHost(HostFunc* func) {
+  const ResourceLimits& limits = env_->resource_limits_;
+  ResourceUsage& usage = env_->resource_usage_;
+  TRAP_IF(limits.max_host_calls != 0 &&
+              usage.host_calls >= limits.max_host_calls,
+          HostCallLimitExceeded);
+  usage.host_calls++;
+
   FuncSignature* sig = &env_->sigs_[func->sig_index];
 
   size_t num_params = sig->param_types.size();
@@ -1163,48 +2126,160 @@ Result Thread::CallHost(HostFunc* func) {
   return Result::Ok;
 }
 
-Result Thread::Run(int num_instructions, IstreamOffset* call_stack_return_top) {
-  Result result = Result::Ok;
-  assert(call_stack_return_top < call_stack_end_);
+void Thread::RecordInstruction(Opcode opcode, IstreamOffset offset) {
+  if (trace_buffer_) {
+    TraceRecord record;
+    record.pc = offset;
+    record.opcode = static_cast<uint32_t>(opcode);
+    record.value_stack_depth = value_stack_top_ - value_stack_.data();
+    record.call_stack_depth = call_stack_top_ - call_stack_.data();
+    record.top = record.value_stack_depth > 0 ? Top().i64 : 0;
+    trace_buffer_->Append(record);
+  }
 
-  const uint8_t* istream = GetIstream();
-  const uint8_t* pc = &istream[pc_];
-  for (int i = 0; i < num_instructions; ++i) {
-    Opcode opcode = static_cast<Opcode>(*pc++);
-    switch (opcode) {
-      case Opcode::Select: {
-        uint32_t cond = Pop<uint32_t>();
-        Value false_ = Pop();
-        Value true_ = Pop();
-        CHECK_TRAP(Push(cond ? true_ : false_));
-        break;
-      }
+  if (execution_counts_)
+    CountOpcode(opcode, offset);
+}
 
-      case Opcode::Br:
-        GOTO(read_u32(&pc));
-        break;
+void Thread::CountFuncEntry(IstreamOffset offset) {
+  ExecutionCounts* counts = execution_counts_.get();
+  if (offset >= counts->func_counts.size())
+    counts->func_counts.resize(env_->istream_->data.size());
+  ++counts->func_counts[offset];
+  counts->at_block_start = true;
+}
 
-      case Opcode::BrIf: {
-        IstreamOffset new_pc = read_u32(&pc);
-        if (Pop<uint32_t>())
-          GOTO(new_pc);
-        break;
-      }
+void Thread::CountOpcode(Opcode opcode, IstreamOffset offset) {
+  ExecutionCounts* counts = execution_counts_.get();
+  int index = static_cast<int>(opcode);
+  ++counts->opcode_counts[index];
+  if (counts->prev_opcode != Opcode::Invalid) {
+    int prev_index = static_cast<int>(counts->prev_opcode);
+    ++counts->opcode_pair_counts[prev_index * kOpcodeCount + index];
+  }
+  counts->prev_opcode = opcode;
 
-      case Opcode::BrTable: {
-        Index num_targets = read_u32(&pc);
-        IstreamOffset table_offset = read_u32(&pc);
-        uint32_t key = Pop<uint32_t>();
-        IstreamOffset key_offset =
-            (key >= num_targets ? num_targets : key) * WABT_TABLE_ENTRY_SIZE;
-        const uint8_t* entry = istream + table_offset + key_offset;
-        IstreamOffset new_pc;
-        uint32_t drop_count;
-        uint8_t keep_count;
-        read_table_entry_at(entry, &new_pc, &drop_count, &keep_count);
-        DropKeep(drop_count, keep_count);
-        GOTO(new_pc);
-        break;
+  if (counts->at_block_start) {
+    if (offset >= counts->block_counts.size())
+      counts->block_counts.resize(env_->istream_->data.size());
+    ++counts->block_counts[offset];
+  }
+
+  switch (opcode) {
+    case Opcode::Br:
+    case Opcode::BrIf:
+    case Opcode::BrUnless:
+    case Opcode::BrTable:
+    case Opcode::Return:
+    case Opcode::Call:
+    case Opcode::CallIndirect:
+    case Opcode::CallHost:
+    case Opcode::ReturnCall:
+    case Opcode::ReturnCallIndirect:
+      counts->at_block_start = true;
+      break;
+
+    default:
+      counts->at_block_start = false;
+      break;
+  }
+}
+
+Result Thread::Run(int num_instructions, CallFrame* call_stack_return_top) {
+  const ResourceLimits& limits = env_->resource_limits_;
+  ResourceUsage& usage = env_->resource_usage_;
+  if (limits.max_instructions != 0) {
+    TRAP_IF(usage.instructions >= limits.max_instructions,
+            InstructionLimitExceeded);
+    num_instructions = std::min<uint64_t>(
+        num_instructions, limits.max_instructions - usage.instructions);
+  }
+  // Charge the whole batch up front, so the loop doesn't have to count. If it
+  // returns or traps early, RunImpl refunds the instructions it didn't run.
+  usage.instructions += num_instructions;
+
+  // Choose the instantiation once per batch of instructions, so the
+  // uninstrumented loop doesn't pay for counting or tracing at all.
+  if (execution_counts_ || trace_buffer_ || memory_access_log_)
+    return RunImpl<true>(num_instructions, call_stack_return_top);
+  return RunImpl<false>(num_instructions, call_stack_return_top);
+}
+
+// In RunImpl, a trap leaves through exit_loop, so that pc_ is left inside the
+// trapping instruction for SaveTrapStack. This costs nothing until it traps.
+#define RUN_TRAP(type)             \
+  do {                             \
+    result = Result::Trap##type;   \
+    goto exit_loop;                \
+  } while (0)
+#define RUN_TRAP_UNLESS(cond, type) RUN_TRAP_IF(!(cond), type)
+#define RUN_TRAP_IF(cond, type) \
+  do {                          \
+    if (WABT_UNLIKELY(cond))    \
+      RUN_TRAP(type);           \
+  } while (0)
+#define RUN_CHECK_TRAP(...)        \
+  do {                             \
+    result = (__VA_ARGS__);        \
+    if (result != Result::Ok)      \
+      goto exit_loop;              \
+  } while (0)
+
+#define PUSH_NEG_1_AND_BREAK_IF(cond)  \
+  if (WABT_UNLIKELY(cond)) {           \
+    RUN_CHECK_TRAP(Push<int32_t>(-1)); \
+    break;                             \
+  }
+
+template <bool kInstrumented>
+Result Thread::RunImpl(int num_instructions,
+                       CallFrame* call_stack_return_top) {
+  Result result = Result::Ok;
+  assert(call_stack_return_top < call_stack_end_);
+
+  const uint8_t* istream = GetIstream();
+  const uint8_t* pc = &istream[pc_];
+  int i = 0;
+  for (; i < num_instructions; ++i) {
+    const uint8_t* opcode_pc = pc;
+    Opcode opcode = read_opcode(&pc);
+    if (kInstrumented)
+      RecordInstruction(opcode, opcode_pc - istream);
+    switch (opcode) {
+      case Opcode::Select: {
+        uint32_t cond = Pop<uint32_t>();
+        Value false_ = Pop();
+        Value true_ = Pop();
+        RUN_CHECK_TRAP(Push(cond ? true_ : false_));
+        break;
+      }
+
+      case Opcode::Br:
+        GOTO(read_u32(&pc));
+        break;
+
+      case Opcode::BrIf: {
+        IstreamOffset new_pc = read_u32(&pc);
+        if (Pop<uint32_t>())
+          GOTO(new_pc);
+        break;
+      }
+
+      case Opcode::BrTable: {
+        Index num_targets = read_u32(&pc);
+        IstreamOffset table_offset = read_u32(&pc);
+        IstreamOffset drop_keep_offset = read_u32(&pc);
+        uint32_t key = Pop<uint32_t>();
+        Index index = key >= num_targets ? num_targets : key;
+        if (drop_keep_offset != kInvalidIstreamOffset) {
+          const uint8_t* entry =
+              istream + drop_keep_offset + index * WABT_BR_TABLE_DROP_KEEP_SIZE;
+          uint32_t drop_count = read_u32_at(entry + WABT_BR_TABLE_DROP_OFFSET);
+          if (drop_count != 0)
+            DropKeep(drop_count, read_u32_at(entry + WABT_BR_TABLE_KEEP_OFFSET));
+        }
+        GOTO(read_br_table_offset_at(istream + table_offset, index));
+        break;
       }
 
       case Opcode::Return:
@@ -1216,29 +2291,29 @@ Result Thread::Run(int num_instructions, IstreamOffset* call_stack_return_top) {
         break;
 
       case Opcode::Unreachable:
-        TRAP(Unreachable);
+        RUN_TRAP(Unreachable);
         break;
 
       case Opcode::I32Const:
-        CHECK_TRAP(Push<uint32_t>(read_u32(&pc)));
+        RUN_CHECK_TRAP(Push<uint32_t>(read_u32(&pc)));
         break;
 
       case Opcode::I64Const:
-        CHECK_TRAP(Push<uint64_t>(read_u64(&pc)));
+        RUN_CHECK_TRAP(Push<uint64_t>(read_u64(&pc)));
         break;
 
       case Opcode::F32Const:
-        CHECK_TRAP(PushRep<float>(read_u32(&pc)));
+        RUN_CHECK_TRAP(PushRep<float>(read_u32(&pc)));
         break;
 
       case Opcode::F64Const:
-        CHECK_TRAP(PushRep<double>(read_u64(&pc)));
+        RUN_CHECK_TRAP(PushRep<double>(read_u64(&pc)));
         break;
 
       case Opcode::GetGlobal: {
         Index index = read_u32(&pc);
         assert(index < env_->globals_.size());
-        CHECK_TRAP(Push(env_->globals_[index].typed_value.value));
+        RUN_CHECK_TRAP(Push(env_->globals_[index].typed_value.value));
         break;
       }
 
@@ -1250,148 +2325,217 @@ Result Thread::Run(int num_instructions, IstreamOffset* call_stack_return_top) {
       }
 
       case Opcode::GetLocal: {
-        Value value = Pick(read_u32(&pc));
-        CHECK_TRAP(Push(value));
+        Value value = frame_pointer_[read_u32(&pc)];
+        RUN_CHECK_TRAP(Push(value));
         break;
       }
 
       case Opcode::SetLocal: {
         Value value = Pop();
-        Pick(read_u32(&pc)) = value;
+        frame_pointer_[read_u32(&pc)] = value;
         break;
       }
 
       case Opcode::TeeLocal:
-        Pick(read_u32(&pc)) = Top();
+        frame_pointer_[read_u32(&pc)] = Top();
         break;
 
       case Opcode::Call: {
         IstreamOffset offset = read_u32(&pc);
-        CHECK_TRAP(PushCall(pc));
+        Index num_params = read_u32(&pc);
+        Index memory_index = read_u32(&pc);
+        RUN_CHECK_TRAP(PushCall(pc, num_params, memory_index));
+        if (kInstrumented && execution_counts_)
+          CountFuncEntry(offset);
         GOTO(offset);
         break;
       }
 
       case Opcode::CallIndirect: {
         Index table_index = read_u32(&pc);
-        Table* table = &env_->tables_[table_index];
         Index sig_index = read_u32(&pc);
+        Index num_params = read_u32(&pc);
+        CallIndirectCache* cache = GetCallIndirectCache(read_u32(&pc));
         Index entry_index = Pop<uint32_t>();
-        TRAP_IF(entry_index >= table->func_indexes.size(), UndefinedTableIndex);
-        Index func_index = table->func_indexes[entry_index];
-        TRAP_IF(func_index == kInvalidIndex, UninitializedTableElement);
-        Func* func = env_->funcs_[func_index].get();
-        TRAP_UNLESS(env_->FuncSignaturesAreEqual(func->sig_index, sig_index),
-                    IndirectCallSignatureMismatch);
-        if (func->is_host) {
-          CallHost(func->as_host());
+        IstreamOffset offset;
+        Index memory_index;
+        if (cache->table_generation == env_->table_generation_ &&
+            cache->entry_index == entry_index) {
+          // The cached callee already passed the checks below.
+          offset = cache->offset;
+          memory_index = cache->memory_index;
+          if (kInstrumented && execution_counts_)
+            ++execution_counts_->call_indirect_cache_hits;
         } else {
-          CHECK_TRAP(PushCall(pc));
-          GOTO(func->as_defined()->offset);
+          if (kInstrumented && execution_counts_)
+            ++execution_counts_->call_indirect_cache_misses;
+          Table* table = &env_->tables_[table_index];
+          RUN_TRAP_IF(entry_index >= table->func_indexes.size(),
+                      UndefinedTableIndex);
+          Index func_index = table->func_indexes[entry_index];
+          RUN_TRAP_IF(func_index == kInvalidIndex, UninitializedTableElement);
+          Func* func = env_->funcs_[func_index].get();
+          RUN_TRAP_UNLESS(
+              env_->FuncSignaturesAreEqual(func->sig_index, sig_index),
+              IndirectCallSignatureMismatch);
+          if (func->is_host) {
+            RUN_CHECK_TRAP(CallHost(func->as_host()));
+            break;
+          }
+          offset = func->as_defined()->offset;
+          memory_index = func->as_defined()->memory_index;
+          cache->table_generation = env_->table_generation_;
+          cache->entry_index = entry_index;
+          cache->offset = offset;
+          cache->memory_index = memory_index;
         }
+        RUN_CHECK_TRAP(PushCall(pc, num_params, memory_index));
+        if (kInstrumented && execution_counts_)
+          CountFuncEntry(offset);
+        GOTO(offset);
         break;
       }
 
       case Opcode::CallHost: {
         Index func_index = read_u32(&pc);
-        CallHost(env_->funcs_[func_index]->as_host());
+        RUN_CHECK_TRAP(CallHost(env_->funcs_[func_index]->as_host()));
+        break;
+      }
+
+      case Opcode::ReturnCall: {
+        IstreamOffset offset = read_u32(&pc);
+        Index memory_index = read_u32(&pc);
+        // The caller's memory is restored from the CallFrame on return.
+        if (memory_index != memory_index_)
+          CacheMemory(memory_index);
+        if (kInstrumented && execution_counts_)
+          CountFuncEntry(offset);
+        GOTO(offset);
+        break;
+      }
+
+      case Opcode::ReturnCallIndirect: {
+        Index table_index = read_u32(&pc);
+        Table* table = &env_->tables_[table_index];
+        Index sig_index = read_u32(&pc);
+        uint32_t drop_count = read_u32(&pc);
+        Index entry_index = Pop<uint32_t>();
+        RUN_TRAP_IF(entry_index >= table->func_indexes.size(),
+                    UndefinedTableIndex);
+        Index func_index = table->func_indexes[entry_index];
+        RUN_TRAP_IF(func_index == kInvalidIndex, UninitializedTableElement);
+        Func* func = env_->funcs_[func_index].get();
+        RUN_TRAP_UNLESS(
+            env_->FuncSignaturesAreEqual(func->sig_index, sig_index),
+            IndirectCallSignatureMismatch);
+        if (func->is_host) {
+          // Falls through to the DropKeep and Return that follow.
+          RUN_CHECK_TRAP(CallHost(func->as_host()));
+        } else {
+          DropKeep(drop_count, env_->sigs_[sig_index].param_types.size());
+          if (func->as_defined()->memory_index != memory_index_)
+            CacheMemory(func->as_defined()->memory_index);
+          if (kInstrumented && execution_counts_)
+            CountFuncEntry(func->as_defined()->offset);
+          GOTO(func->as_defined()->offset);
+        }
         break;
       }
 
       case Opcode::I32Load8S:
-        CHECK_TRAP(Load<int8_t, uint32_t>(&pc));
+        RUN_CHECK_TRAP(Load<kInstrumented, int8_t, uint32_t>(&pc));
         break;
 
       case Opcode::I32Load8U:
-        CHECK_TRAP(Load<uint8_t, uint32_t>(&pc));
+        RUN_CHECK_TRAP(Load<kInstrumented, uint8_t, uint32_t>(&pc));
         break;
 
       case Opcode::I32Load16S:
-        CHECK_TRAP(Load<int16_t, uint32_t>(&pc));
+        RUN_CHECK_TRAP(Load<kInstrumented, int16_t, uint32_t>(&pc));
         break;
 
       case Opcode::I32Load16U:
-        CHECK_TRAP(Load<uint16_t, uint32_t>(&pc));
+        RUN_CHECK_TRAP(Load<kInstrumented, uint16_t, uint32_t>(&pc));
         break;
 
       case Opcode::I64Load8S:
-        CHECK_TRAP(Load<int8_t, uint64_t>(&pc));
+        RUN_CHECK_TRAP(Load<kInstrumented, int8_t, uint64_t>(&pc));
         break;
 
       case Opcode::I64Load8U:
-        CHECK_TRAP(Load<uint8_t, uint64_t>(&pc));
+        RUN_CHECK_TRAP(Load<kInstrumented, uint8_t, uint64_t>(&pc));
         break;
 
       case Opcode::I64Load16S:
-        CHECK_TRAP(Load<int16_t, uint64_t>(&pc));
+        RUN_CHECK_TRAP(Load<kInstrumented, int16_t, uint64_t>(&pc));
         break;
 
       case Opcode::I64Load16U:
-        CHECK_TRAP(Load<uint16_t, uint64_t>(&pc));
+        RUN_CHECK_TRAP(Load<kInstrumented, uint16_t, uint64_t>(&pc));
         break;
 
       case Opcode::I64Load32S:
-        CHECK_TRAP(Load<int32_t, uint64_t>(&pc));
+        RUN_CHECK_TRAP(Load<kInstrumented, int32_t, uint64_t>(&pc));
         break;
 
       case Opcode::I64Load32U:
-        CHECK_TRAP(Load<uint32_t, uint64_t>(&pc));
+        RUN_CHECK_TRAP(Load<kInstrumented, uint32_t, uint64_t>(&pc));
         break;
 
       case Opcode::I32Load:
-        CHECK_TRAP(Load<uint32_t>(&pc));
+        RUN_CHECK_TRAP(Load<kInstrumented, uint32_t>(&pc));
         break;
 
       case Opcode::I64Load:
-        CHECK_TRAP(Load<uint64_t>(&pc));
+        RUN_CHECK_TRAP(Load<kInstrumented, uint64_t>(&pc));
         break;
 
       case Opcode::F32Load:
-        CHECK_TRAP(Load<float>(&pc));
+        RUN_CHECK_TRAP(Load<kInstrumented, float>(&pc));
         break;
 
       case Opcode::F64Load:
-        CHECK_TRAP(Load<double>(&pc));
+        RUN_CHECK_TRAP(Load<kInstrumented, double>(&pc));
         break;
 
       case Opcode::I32Store8:
-        CHECK_TRAP(Store<uint8_t, uint32_t>(&pc));
+        RUN_CHECK_TRAP(Store<kInstrumented, uint8_t, uint32_t>(&pc));
         break;
 
       case Opcode::I32Store16:
-        CHECK_TRAP(Store<uint16_t, uint32_t>(&pc));
+        RUN_CHECK_TRAP(Store<kInstrumented, uint16_t, uint32_t>(&pc));
         break;
 
       case Opcode::I64Store8:
-        CHECK_TRAP(Store<uint8_t, uint64_t>(&pc));
+        RUN_CHECK_TRAP(Store<kInstrumented, uint8_t, uint64_t>(&pc));
         break;
 
       case Opcode::I64Store16:
-        CHECK_TRAP(Store<uint16_t, uint64_t>(&pc));
+        RUN_CHECK_TRAP(Store<kInstrumented, uint16_t, uint64_t>(&pc));
         break;
 
       case Opcode::I64Store32:
-        CHECK_TRAP(Store<uint32_t, uint64_t>(&pc));
+        RUN_CHECK_TRAP(Store<kInstrumented, uint32_t, uint64_t>(&pc));
         break;
 
       case Opcode::I32Store:
-        CHECK_TRAP(Store<uint32_t>(&pc));
+        RUN_CHECK_TRAP(Store<kInstrumented, uint32_t>(&pc));
         break;
 
       case Opcode::I64Store:
-        CHECK_TRAP(Store<uint64_t>(&pc));
+        RUN_CHECK_TRAP(Store<kInstrumented, uint64_t>(&pc));
         break;
 
       case Opcode::F32Store:
-        CHECK_TRAP(Store<float>(&pc));
+        RUN_CHECK_TRAP(Store<kInstrumented, float>(&pc));
         break;
 
       case Opcode::F64Store:
-        CHECK_TRAP(Store<double>(&pc));
+        RUN_CHECK_TRAP(Store<kInstrumented, double>(&pc));
         break;
 
       case Opcode::CurrentMemory:
-        CHECK_TRAP(Push<uint32_t>(ReadMemory(&pc)->page_limits.initial));
+        RUN_CHECK_TRAP(Push<uint32_t>(ReadMemory(&pc)->page_limits.initial));
         break;
 
       case Opcode::GrowMemory: {
@@ -1402,542 +2546,595 @@ Result Thread::Run(int num_instructions, IstreamOffset* call_stack_return_top) {
         uint32_t max_page_size = memory->page_limits.has_max
                                      ? memory->page_limits.max
                                      : WABT_MAX_PAGES;
+        uint32_t max_env_pages = env_->resource_limits_.max_memory_pages;
+        env_->resource_usage_.grow_memory_calls++;
         PUSH_NEG_1_AND_BREAK_IF(new_page_size > max_page_size);
         PUSH_NEG_1_AND_BREAK_IF(
             static_cast<uint64_t>(new_page_size) * WABT_PAGE_SIZE > UINT32_MAX);
+        PUSH_NEG_1_AND_BREAK_IF(
+            max_env_pages != 0 &&
+            static_cast<uint64_t>(env_->GetMemoryPageCount()) + grow_pages >
+                max_env_pages);
+        // A shared memory has its max size reserved, so this doesn't move it.
+        assert(!memory->wait_queue ||
+               new_page_size * WABT_PAGE_SIZE <= memory->data.capacity());
         memory->data.resize(new_page_size * WABT_PAGE_SIZE);
         memory->page_limits.initial = new_page_size;
-        CHECK_TRAP(Push<uint32_t>(old_page_size));
+        CacheMemory(memory_index_);
+        env_->UpdatePeakMemoryPages();
+        RUN_CHECK_TRAP(Push<uint32_t>(old_page_size));
         break;
       }
 
-      case Opcode::I32Add:
-        CHECK_TRAP(Binop(Add<uint32_t>));
-        break;
-
-      case Opcode::I32Sub:
-        CHECK_TRAP(Binop(Sub<uint32_t>));
-        break;
-
-      case Opcode::I32Mul:
-        CHECK_TRAP(Binop(Mul<uint32_t>));
-        break;
-
-      case Opcode::I32DivS:
-        CHECK_TRAP(BinopTrap(IntDivS<int32_t>));
-        break;
-
-      case Opcode::I32DivU:
-        CHECK_TRAP(BinopTrap(IntDivU<uint32_t>));
-        break;
-
-      case Opcode::I32RemS:
-        CHECK_TRAP(BinopTrap(IntRemS<int32_t>));
-        break;
-
-      case Opcode::I32RemU:
-        CHECK_TRAP(BinopTrap(IntRemU<uint32_t>));
-        break;
-
-      case Opcode::I32And:
-        CHECK_TRAP(Binop(IntAnd<uint32_t>));
-        break;
-
-      case Opcode::I32Or:
-        CHECK_TRAP(Binop(IntOr<uint32_t>));
-        break;
-
-      case Opcode::I32Xor:
-        CHECK_TRAP(Binop(IntXor<uint32_t>));
-        break;
-
-      case Opcode::I32Shl:
-        CHECK_TRAP(Binop(IntShl<uint32_t>));
-        break;
-
-      case Opcode::I32ShrU:
-        CHECK_TRAP(Binop(IntShr<uint32_t>));
+      case Opcode::MemoryCopy: {
+        Memory* memory = ReadMemory(&pc);
+        uint32_t size = Pop<uint32_t>();
+        uint32_t src = Pop<uint32_t>();
+        uint32_t dst = Pop<uint32_t>();
+        // Both ranges are checked before anything is written, so a trapping
+        // copy leaves memory unchanged.
+        RUN_TRAP_IF(static_cast<uint64_t>(src) + size > memory->data.size() ||
+                    static_cast<uint64_t>(dst) + size > memory->data.size(),
+                    MemoryAccessOutOfBounds);
+        if (size != 0)
+          memmove(memory->data.data() + dst, memory->data.data() + src, size);
         break;
+      }
 
-      case Opcode::I32ShrS:
-        CHECK_TRAP(Binop(IntShr<int32_t>));
+      case Opcode::MemoryFill: {
+        Memory* memory = ReadMemory(&pc);
+        uint32_t size = Pop<uint32_t>();
+        uint8_t value = static_cast<uint8_t>(Pop<uint32_t>());
+        uint32_t dst = Pop<uint32_t>();
+        RUN_TRAP_IF(static_cast<uint64_t>(dst) + size > memory->data.size(),
+                    MemoryAccessOutOfBounds);
+        if (size != 0)
+          memset(memory->data.data() + dst, value, size);
         break;
+      }
 
-      case Opcode::I32Eq:
-        CHECK_TRAP(Binop(Eq<uint32_t>));
+#define V(name, expr)     \
+      case Opcode::name:  \
+        RUN_CHECK_TRAP(expr); \
         break;
+      WABT_FOREACH_NUMERIC_OPCODE(V)
+#undef V
 
-      case Opcode::I32Ne:
-        CHECK_TRAP(Binop(Ne<uint32_t>));
+      case Opcode::V128Const:
+        RUN_CHECK_TRAP(PushRep<v128>(read_v128(&pc)));
         break;
 
-      case Opcode::I32LtS:
-        CHECK_TRAP(Binop(Lt<int32_t>));
+      case Opcode::V128Load:
+        RUN_CHECK_TRAP(Load<kInstrumented, v128>(&pc));
         break;
 
-      case Opcode::I32LeS:
-        CHECK_TRAP(Binop(Le<int32_t>));
+      case Opcode::V128Store:
+        RUN_CHECK_TRAP(Store<kInstrumented, v128>(&pc));
         break;
 
-      case Opcode::I32LtU:
-        CHECK_TRAP(Binop(Lt<uint32_t>));
+      case Opcode::I8X16Splat:
+        RUN_CHECK_TRAP(Unop(SimdSplat<uint8_t, uint32_t>));
         break;
 
-      case Opcode::I32LeU:
-        CHECK_TRAP(Binop(Le<uint32_t>));
+      case Opcode::I16X8Splat:
+        RUN_CHECK_TRAP(Unop(SimdSplat<uint16_t, uint32_t>));
         break;
 
-      case Opcode::I32GtS:
-        CHECK_TRAP(Binop(Gt<int32_t>));
+      case Opcode::I32X4Splat:
+        RUN_CHECK_TRAP(Unop(SimdSplat<uint32_t, uint32_t>));
         break;
 
-      case Opcode::I32GeS:
-        CHECK_TRAP(Binop(Ge<int32_t>));
+      case Opcode::I64X2Splat:
+        RUN_CHECK_TRAP(Unop(SimdSplat<uint64_t, uint64_t>));
         break;
 
-      case Opcode::I32GtU:
-        CHECK_TRAP(Binop(Gt<uint32_t>));
+      case Opcode::F32X4Splat:
+        RUN_CHECK_TRAP(Unop(SimdSplat<uint32_t, uint32_t>));
         break;
 
-      case Opcode::I32GeU:
-        CHECK_TRAP(Binop(Ge<uint32_t>));
+      case Opcode::F64X2Splat:
+        RUN_CHECK_TRAP(Unop(SimdSplat<uint64_t, uint64_t>));
         break;
 
-      case Opcode::I32Clz: {
-        uint32_t value = Pop<uint32_t>();
-        CHECK_TRAP(Push<uint32_t>(value != 0 ? wabt_clz_u32(value) : 32));
+      case Opcode::I32X4ExtractLane: {
+        uint8_t lane = *pc++;
+        RUN_CHECK_TRAP(
+            PushRep<uint32_t>(SimdExtractLane<uint32_t>(PopRep<v128>(), lane)));
         break;
       }
 
-      case Opcode::I32Ctz: {
-        uint32_t value = Pop<uint32_t>();
-        CHECK_TRAP(Push<uint32_t>(value != 0 ? wabt_ctz_u32(value) : 32));
+      case Opcode::I32X4ReplaceLane: {
+        uint8_t lane = *pc++;
+        uint32_t lane_value = PopRep<uint32_t>();
+        v128 value = PopRep<v128>();
+        RUN_CHECK_TRAP(PushRep<v128>(SimdReplaceLane(value, lane, lane_value)));
         break;
       }
 
-      case Opcode::I32Popcnt: {
-        uint32_t value = Pop<uint32_t>();
-        CHECK_TRAP(Push<uint32_t>(wabt_popcount_u32(value)));
+      case Opcode::I64X2ExtractLane: {
+        uint8_t lane = *pc++;
+        RUN_CHECK_TRAP(
+            PushRep<uint64_t>(SimdExtractLane<uint64_t>(PopRep<v128>(), lane)));
         break;
       }
 
-      case Opcode::I32Eqz:
-        CHECK_TRAP(Unop(IntEqz<uint32_t, uint32_t>));
-        break;
-
-      case Opcode::I64Add:
-        CHECK_TRAP(Binop(Add<uint64_t>));
-        break;
-
-      case Opcode::I64Sub:
-        CHECK_TRAP(Binop(Sub<uint64_t>));
+      case Opcode::I64X2ReplaceLane: {
+        uint8_t lane = *pc++;
+        uint64_t lane_value = PopRep<uint64_t>();
+        v128 value = PopRep<v128>();
+        RUN_CHECK_TRAP(PushRep<v128>(SimdReplaceLane(value, lane, lane_value)));
         break;
+      }
 
-      case Opcode::I64Mul:
-        CHECK_TRAP(Binop(Mul<uint64_t>));
+      case Opcode::F32X4ExtractLane: {
+        uint8_t lane = *pc++;
+        RUN_CHECK_TRAP(
+            PushRep<float>(SimdExtractLane<uint32_t>(PopRep<v128>(), lane)));
         break;
+      }
 
-      case Opcode::I64DivS:
-        CHECK_TRAP(BinopTrap(IntDivS<int64_t>));
+      case Opcode::F32X4ReplaceLane: {
+        uint8_t lane = *pc++;
+        uint32_t lane_value = PopRep<float>();
+        v128 value = PopRep<v128>();
+        RUN_CHECK_TRAP(PushRep<v128>(SimdReplaceLane(value, lane, lane_value)));
         break;
+      }
 
-      case Opcode::I64DivU:
-        CHECK_TRAP(BinopTrap(IntDivU<uint64_t>));
+      case Opcode::F64X2ExtractLane: {
+        uint8_t lane = *pc++;
+        RUN_CHECK_TRAP(
+            PushRep<double>(SimdExtractLane<uint64_t>(PopRep<v128>(), lane)));
         break;
+      }
 
-      case Opcode::I64RemS:
-        CHECK_TRAP(BinopTrap(IntRemS<int64_t>));
+      case Opcode::F64X2ReplaceLane: {
+        uint8_t lane = *pc++;
+        uint64_t lane_value = PopRep<double>();
+        v128 value = PopRep<v128>();
+        RUN_CHECK_TRAP(PushRep<v128>(SimdReplaceLane(value, lane, lane_value)));
         break;
+      }
 
-      case Opcode::I64RemU:
-        CHECK_TRAP(BinopTrap(IntRemU<uint64_t>));
+      case Opcode::V128Not:
+        RUN_CHECK_TRAP(Unop(SimdNot));
         break;
 
-      case Opcode::I64And:
-        CHECK_TRAP(Binop(IntAnd<uint64_t>));
+      case Opcode::V128And:
+        RUN_CHECK_TRAP(Binop(SimdAnd));
         break;
 
-      case Opcode::I64Or:
-        CHECK_TRAP(Binop(IntOr<uint64_t>));
+      case Opcode::V128Andnot:
+        RUN_CHECK_TRAP(Binop(SimdAndnot));
         break;
 
-      case Opcode::I64Xor:
-        CHECK_TRAP(Binop(IntXor<uint64_t>));
+      case Opcode::V128Or:
+        RUN_CHECK_TRAP(Binop(SimdOr));
         break;
 
-      case Opcode::I64Shl:
-        CHECK_TRAP(Binop(IntShl<uint64_t>));
+      case Opcode::V128Xor:
+        RUN_CHECK_TRAP(Binop(SimdXor));
         break;
 
-      case Opcode::I64ShrU:
-        CHECK_TRAP(Binop(IntShr<uint64_t>));
+      case Opcode::I8X16Add:
+        RUN_CHECK_TRAP(Binop(SimdAdd<uint8_t>));
         break;
 
-      case Opcode::I64ShrS:
-        CHECK_TRAP(Binop(IntShr<int64_t>));
+      case Opcode::I8X16Sub:
+        RUN_CHECK_TRAP(Binop(SimdSub<uint8_t>));
         break;
 
-      case Opcode::I64Eq:
-        CHECK_TRAP(Binop(Eq<uint64_t>));
+      case Opcode::I16X8Add:
+        RUN_CHECK_TRAP(Binop(SimdAdd<uint16_t>));
         break;
 
-      case Opcode::I64Ne:
-        CHECK_TRAP(Binop(Ne<uint64_t>));
+      case Opcode::I16X8Sub:
+        RUN_CHECK_TRAP(Binop(SimdSub<uint16_t>));
         break;
 
-      case Opcode::I64LtS:
-        CHECK_TRAP(Binop(Lt<int64_t>));
+      case Opcode::I16X8Mul:
+        RUN_CHECK_TRAP(Binop(SimdMul<uint16_t>));
         break;
 
-      case Opcode::I64LeS:
-        CHECK_TRAP(Binop(Le<int64_t>));
+      case Opcode::I32X4Add:
+        RUN_CHECK_TRAP(Binop(SimdAdd<uint32_t>));
         break;
 
-      case Opcode::I64LtU:
-        CHECK_TRAP(Binop(Lt<uint64_t>));
+      case Opcode::I32X4Sub:
+        RUN_CHECK_TRAP(Binop(SimdSub<uint32_t>));
         break;
 
-      case Opcode::I64LeU:
-        CHECK_TRAP(Binop(Le<uint64_t>));
+      case Opcode::I32X4Mul:
+        RUN_CHECK_TRAP(Binop(SimdMul<uint32_t>));
         break;
 
-      case Opcode::I64GtS:
-        CHECK_TRAP(Binop(Gt<int64_t>));
+      case Opcode::I64X2Add:
+        RUN_CHECK_TRAP(Binop(SimdAdd<uint64_t>));
         break;
 
-      case Opcode::I64GeS:
-        CHECK_TRAP(Binop(Ge<int64_t>));
+      case Opcode::I64X2Sub:
+        RUN_CHECK_TRAP(Binop(SimdSub<uint64_t>));
         break;
 
-      case Opcode::I64GtU:
-        CHECK_TRAP(Binop(Gt<uint64_t>));
+      case Opcode::I64X2Mul:
+        RUN_CHECK_TRAP(Binop(SimdMul<uint64_t>));
         break;
 
-      case Opcode::I64GeU:
-        CHECK_TRAP(Binop(Ge<uint64_t>));
+      case Opcode::F32X4Add:
+        RUN_CHECK_TRAP(Binop(SimdAdd<float>));
         break;
 
-      case Opcode::I64Clz: {
-        uint64_t value = Pop<uint64_t>();
-        CHECK_TRAP(Push<uint64_t>(value != 0 ? wabt_clz_u64(value) : 64));
+      case Opcode::F32X4Sub:
+        RUN_CHECK_TRAP(Binop(SimdSub<float>));
         break;
-      }
 
-      case Opcode::I64Ctz: {
-        uint64_t value = Pop<uint64_t>();
-        CHECK_TRAP(Push<uint64_t>(value != 0 ? wabt_ctz_u64(value) : 64));
+      case Opcode::F32X4Mul:
+        RUN_CHECK_TRAP(Binop(SimdMul<float>));
         break;
-      }
 
-      case Opcode::I64Popcnt:
-        CHECK_TRAP(Push<uint64_t>(wabt_popcount_u64(Pop<uint64_t>())));
+      case Opcode::F32X4Div:
+        RUN_CHECK_TRAP(Binop(SimdDiv<float>));
         break;
 
-      case Opcode::F32Add:
-        CHECK_TRAP(Binop(Add<float>));
+      case Opcode::F64X2Add:
+        RUN_CHECK_TRAP(Binop(SimdAdd<double>));
         break;
 
-      case Opcode::F32Sub:
-        CHECK_TRAP(Binop(Sub<float>));
+      case Opcode::F64X2Sub:
+        RUN_CHECK_TRAP(Binop(SimdSub<double>));
         break;
 
-      case Opcode::F32Mul:
-        CHECK_TRAP(Binop(Mul<float>));
+      case Opcode::F64X2Mul:
+        RUN_CHECK_TRAP(Binop(SimdMul<double>));
         break;
 
-      case Opcode::F32Div:
-        CHECK_TRAP(Binop(FloatDiv<float>));
+      case Opcode::F64X2Div:
+        RUN_CHECK_TRAP(Binop(SimdDiv<double>));
         break;
 
-      case Opcode::F32Min:
-        CHECK_TRAP(Binop(FloatMin<float>));
+      case Opcode::I32AtomicLoad:
+        RUN_CHECK_TRAP(AtomicLoad<kInstrumented, uint32_t>(&pc));
         break;
 
-      case Opcode::F32Max:
-        CHECK_TRAP(Binop(FloatMax<float>));
+      case Opcode::I64AtomicLoad:
+        RUN_CHECK_TRAP(AtomicLoad<kInstrumented, uint64_t>(&pc));
         break;
 
-      case Opcode::F32Abs:
-        CHECK_TRAP(Unop(FloatAbs<float>));
+      case Opcode::I32AtomicLoad8U:
+        RUN_CHECK_TRAP(AtomicLoad<kInstrumented, uint8_t, uint32_t>(&pc));
         break;
 
-      case Opcode::F32Neg:
-        CHECK_TRAP(Unop(FloatNeg<float>));
+      case Opcode::I32AtomicLoad16U:
+        RUN_CHECK_TRAP(AtomicLoad<kInstrumented, uint16_t, uint32_t>(&pc));
         break;
 
-      case Opcode::F32Copysign:
-        CHECK_TRAP(Binop(FloatCopySign<float>));
+      case Opcode::I64AtomicLoad8U:
+        RUN_CHECK_TRAP(AtomicLoad<kInstrumented, uint8_t, uint64_t>(&pc));
         break;
 
-      case Opcode::F32Ceil:
-        CHECK_TRAP(Unop(FloatCeil<float>));
+      case Opcode::I64AtomicLoad16U:
+        RUN_CHECK_TRAP(AtomicLoad<kInstrumented, uint16_t, uint64_t>(&pc));
         break;
 
-      case Opcode::F32Floor:
-        CHECK_TRAP(Unop(FloatFloor<float>));
+      case Opcode::I64AtomicLoad32U:
+        RUN_CHECK_TRAP(AtomicLoad<kInstrumented, uint32_t, uint64_t>(&pc));
         break;
 
-      case Opcode::F32Trunc:
-        CHECK_TRAP(Unop(FloatTrunc<float>));
+      case Opcode::I32AtomicStore:
+        RUN_CHECK_TRAP(AtomicStore<kInstrumented, uint32_t>(&pc));
         break;
 
-      case Opcode::F32Nearest:
-        CHECK_TRAP(Unop(FloatNearest<float>));
+      case Opcode::I64AtomicStore:
+        RUN_CHECK_TRAP(AtomicStore<kInstrumented, uint64_t>(&pc));
         break;
 
-      case Opcode::F32Sqrt:
-        CHECK_TRAP(Unop(FloatSqrt<float>));
+      case Opcode::I32AtomicStore8:
+        RUN_CHECK_TRAP(AtomicStore<kInstrumented, uint8_t, uint32_t>(&pc));
         break;
 
-      case Opcode::F32Eq:
-        CHECK_TRAP(Binop(Eq<float>));
+      case Opcode::I32AtomicStore16:
+        RUN_CHECK_TRAP(AtomicStore<kInstrumented, uint16_t, uint32_t>(&pc));
         break;
 
-      case Opcode::F32Ne:
-        CHECK_TRAP(Binop(Ne<float>));
+      case Opcode::I64AtomicStore8:
+        RUN_CHECK_TRAP(AtomicStore<kInstrumented, uint8_t, uint64_t>(&pc));
         break;
 
-      case Opcode::F32Lt:
-        CHECK_TRAP(Binop(Lt<float>));
+      case Opcode::I64AtomicStore16:
+        RUN_CHECK_TRAP(AtomicStore<kInstrumented, uint16_t, uint64_t>(&pc));
         break;
 
-      case Opcode::F32Le:
-        CHECK_TRAP(Binop(Le<float>));
+      case Opcode::I64AtomicStore32:
+        RUN_CHECK_TRAP(AtomicStore<kInstrumented, uint32_t, uint64_t>(&pc));
         break;
 
-      case Opcode::F32Gt:
-        CHECK_TRAP(Binop(Gt<float>));
+      case Opcode::I32AtomicRmwAdd:
+        RUN_CHECK_TRAP(
+            AtomicRmw<kInstrumented, uint32_t>(&pc, AtomicAdd<uint32_t>));
         break;
 
-      case Opcode::F32Ge:
-        CHECK_TRAP(Binop(Ge<float>));
+      case Opcode::I64AtomicRmwAdd:
+        RUN_CHECK_TRAP(
+            AtomicRmw<kInstrumented, uint64_t>(&pc, AtomicAdd<uint64_t>));
         break;
 
-      case Opcode::F64Add:
-        CHECK_TRAP(Binop(Add<double>));
+      case Opcode::I32AtomicRmw8UAdd:
+        RUN_CHECK_TRAP(
+            AtomicRmw<kInstrumented, uint8_t, uint32_t>(
+            &pc, AtomicAdd<uint8_t>));
         break;
 
-      case Opcode::F64Sub:
-        CHECK_TRAP(Binop(Sub<double>));
+      case Opcode::I32AtomicRmw16UAdd:
+        RUN_CHECK_TRAP(
+            AtomicRmw<kInstrumented, uint16_t, uint32_t>(
+            &pc, AtomicAdd<uint16_t>));
         break;
 
-      case Opcode::F64Mul:
-        CHECK_TRAP(Binop(Mul<double>));
+      case Opcode::I64AtomicRmw8UAdd:
+        RUN_CHECK_TRAP(
+            AtomicRmw<kInstrumented, uint8_t, uint64_t>(
+            &pc, AtomicAdd<uint8_t>));
         break;
 
-      case Opcode::F64Div:
-        CHECK_TRAP(Binop(FloatDiv<double>));
+      case Opcode::I64AtomicRmw16UAdd:
+        RUN_CHECK_TRAP(
+            AtomicRmw<kInstrumented, uint16_t, uint64_t>(
+            &pc, AtomicAdd<uint16_t>));
         break;
 
-      case Opcode::F64Min:
-        CHECK_TRAP(Binop(FloatMin<double>));
+      case Opcode::I64AtomicRmw32UAdd:
+        RUN_CHECK_TRAP(
+            AtomicRmw<kInstrumented, uint32_t, uint64_t>(
+            &pc, AtomicAdd<uint32_t>));
         break;
 
-      case Opcode::F64Max:
-        CHECK_TRAP(Binop(FloatMax<double>));
+      case Opcode::I32AtomicRmwSub:
+        RUN_CHECK_TRAP(
+            AtomicRmw<kInstrumented, uint32_t>(&pc, AtomicSub<uint32_t>));
         break;
 
-      case Opcode::F64Abs:
-        CHECK_TRAP(Unop(FloatAbs<double>));
+      case Opcode::I64AtomicRmwSub:
+        RUN_CHECK_TRAP(
+            AtomicRmw<kInstrumented, uint64_t>(&pc, AtomicSub<uint64_t>));
         break;
 
-      case Opcode::F64Neg:
-        CHECK_TRAP(Unop(FloatNeg<double>));
+      case Opcode::I32AtomicRmw8USub:
+        RUN_CHECK_TRAP(
+            AtomicRmw<kInstrumented, uint8_t, uint32_t>(
+            &pc, AtomicSub<uint8_t>));
         break;
 
-      case Opcode::F64Copysign:
-        CHECK_TRAP(Binop(FloatCopySign<double>));
+      case Opcode::I32AtomicRmw16USub:
+        RUN_CHECK_TRAP(
+            AtomicRmw<kInstrumented, uint16_t, uint32_t>(
+            &pc, AtomicSub<uint16_t>));
         break;
 
-      case Opcode::F64Ceil:
-        CHECK_TRAP(Unop(FloatCeil<double>));
+      case Opcode::I64AtomicRmw8USub:
+        RUN_CHECK_TRAP(
+            AtomicRmw<kInstrumented, uint8_t, uint64_t>(
+            &pc, AtomicSub<uint8_t>));
         break;
 
-      case Opcode::F64Floor:
-        CHECK_TRAP(Unop(FloatFloor<double>));
+      case Opcode::I64AtomicRmw16USub:
+        RUN_CHECK_TRAP(
+            AtomicRmw<kInstrumented, uint16_t, uint64_t>(
+            &pc, AtomicSub<uint16_t>));
         break;
 
-      case Opcode::F64Trunc:
-        CHECK_TRAP(Unop(FloatTrunc<double>));
+      case Opcode::I64AtomicRmw32USub:
+        RUN_CHECK_TRAP(
+            AtomicRmw<kInstrumented, uint32_t, uint64_t>(
+            &pc, AtomicSub<uint32_t>));
         break;
 
-      case Opcode::F64Nearest:
-        CHECK_TRAP(Unop(FloatNearest<double>));
+      case Opcode::I32AtomicRmwAnd:
+        RUN_CHECK_TRAP(
+            AtomicRmw<kInstrumented, uint32_t>(&pc, AtomicAnd<uint32_t>));
         break;
 
-      case Opcode::F64Sqrt:
-        CHECK_TRAP(Unop(FloatSqrt<double>));
+      case Opcode::I64AtomicRmwAnd:
+        RUN_CHECK_TRAP(
+            AtomicRmw<kInstrumented, uint64_t>(&pc, AtomicAnd<uint64_t>));
         break;
 
-      case Opcode::F64Eq:
-        CHECK_TRAP(Binop(Eq<double>));
+      case Opcode::I32AtomicRmw8UAnd:
+        RUN_CHECK_TRAP(
+            AtomicRmw<kInstrumented, uint8_t, uint32_t>(
+            &pc, AtomicAnd<uint8_t>));
         break;
 
-      case Opcode::F64Ne:
-        CHECK_TRAP(Binop(Ne<double>));
+      case Opcode::I32AtomicRmw16UAnd:
+        RUN_CHECK_TRAP(
+            AtomicRmw<kInstrumented, uint16_t, uint32_t>(
+            &pc, AtomicAnd<uint16_t>));
         break;
 
-      case Opcode::F64Lt:
-        CHECK_TRAP(Binop(Lt<double>));
+      case Opcode::I64AtomicRmw8UAnd:
+        RUN_CHECK_TRAP(
+            AtomicRmw<kInstrumented, uint8_t, uint64_t>(
+            &pc, AtomicAnd<uint8_t>));
         break;
 
-      case Opcode::F64Le:
-        CHECK_TRAP(Binop(Le<double>));
+      case Opcode::I64AtomicRmw16UAnd:
+        RUN_CHECK_TRAP(
+            AtomicRmw<kInstrumented, uint16_t, uint64_t>(
+            &pc, AtomicAnd<uint16_t>));
         break;
 
-      case Opcode::F64Gt:
-        CHECK_TRAP(Binop(Gt<double>));
+      case Opcode::I64AtomicRmw32UAnd:
+        RUN_CHECK_TRAP(
+            AtomicRmw<kInstrumented, uint32_t, uint64_t>(
+            &pc, AtomicAnd<uint32_t>));
         break;
 
-      case Opcode::F64Ge:
-        CHECK_TRAP(Binop(Ge<double>));
+      case Opcode::I32AtomicRmwOr:
+        RUN_CHECK_TRAP(
+            AtomicRmw<kInstrumented, uint32_t>(&pc, AtomicOr<uint32_t>));
         break;
 
-      case Opcode::I32TruncSF32:
-        CHECK_TRAP(UnopTrap(IntTrunc<int32_t, float>));
+      case Opcode::I64AtomicRmwOr:
+        RUN_CHECK_TRAP(
+            AtomicRmw<kInstrumented, uint64_t>(&pc, AtomicOr<uint64_t>));
         break;
 
-      case Opcode::I32TruncSF64:
-        CHECK_TRAP(UnopTrap(IntTrunc<int32_t, double>));
+      case Opcode::I32AtomicRmw8UOr:
+        RUN_CHECK_TRAP(
+            AtomicRmw<kInstrumented, uint8_t, uint32_t>(
+            &pc, AtomicOr<uint8_t>));
         break;
 
-      case Opcode::I32TruncUF32:
-        CHECK_TRAP(UnopTrap(IntTrunc<uint32_t, float>));
+      case Opcode::I32AtomicRmw16UOr:
+        RUN_CHECK_TRAP(
+            AtomicRmw<kInstrumented, uint16_t, uint32_t>(
+            &pc, AtomicOr<uint16_t>));
         break;
 
-      case Opcode::I32TruncUF64:
-        CHECK_TRAP(UnopTrap(IntTrunc<uint32_t, double>));
+      case Opcode::I64AtomicRmw8UOr:
+        RUN_CHECK_TRAP(
+            AtomicRmw<kInstrumented, uint8_t, uint64_t>(
+            &pc, AtomicOr<uint8_t>));
         break;
 
-      case Opcode::I32WrapI64:
-        CHECK_TRAP(Push<uint32_t>(Pop<uint64_t>()));
+      case Opcode::I64AtomicRmw16UOr:
+        RUN_CHECK_TRAP(
+            AtomicRmw<kInstrumented, uint16_t, uint64_t>(
+            &pc, AtomicOr<uint16_t>));
         break;
 
-      case Opcode::I64TruncSF32:
-        CHECK_TRAP(UnopTrap(IntTrunc<int64_t, float>));
+      case Opcode::I64AtomicRmw32UOr:
+        RUN_CHECK_TRAP(
+            AtomicRmw<kInstrumented, uint32_t, uint64_t>(
+            &pc, AtomicOr<uint32_t>));
         break;
 
-      case Opcode::I64TruncSF64:
-        CHECK_TRAP(UnopTrap(IntTrunc<int64_t, double>));
+      case Opcode::I32AtomicRmwXor:
+        RUN_CHECK_TRAP(
+            AtomicRmw<kInstrumented, uint32_t>(&pc, AtomicXor<uint32_t>));
         break;
 
-      case Opcode::I64TruncUF32:
-        CHECK_TRAP(UnopTrap(IntTrunc<uint64_t, float>));
+      case Opcode::I64AtomicRmwXor:
+        RUN_CHECK_TRAP(
+            AtomicRmw<kInstrumented, uint64_t>(&pc, AtomicXor<uint64_t>));
         break;
 
-      case Opcode::I64TruncUF64:
-        CHECK_TRAP(UnopTrap(IntTrunc<uint64_t, double>));
+      case Opcode::I32AtomicRmw8UXor:
+        RUN_CHECK_TRAP(
+            AtomicRmw<kInstrumented, uint8_t, uint32_t>(
+            &pc, AtomicXor<uint8_t>));
         break;
 
-      case Opcode::I64ExtendSI32:
-        CHECK_TRAP(Push<uint64_t>(Pop<int32_t>()));
+      case Opcode::I32AtomicRmw16UXor:
+        RUN_CHECK_TRAP(
+            AtomicRmw<kInstrumented, uint16_t, uint32_t>(
+            &pc, AtomicXor<uint16_t>));
         break;
 
-      case Opcode::I64ExtendUI32:
-        CHECK_TRAP(Push<uint64_t>(Pop<uint32_t>()));
+      case Opcode::I64AtomicRmw8UXor:
+        RUN_CHECK_TRAP(
+            AtomicRmw<kInstrumented, uint8_t, uint64_t>(
+            &pc, AtomicXor<uint8_t>));
         break;
 
-      case Opcode::F32ConvertSI32:
-        CHECK_TRAP(Push<float>(Pop<int32_t>()));
+      case Opcode::I64AtomicRmw16UXor:
+        RUN_CHECK_TRAP(
+            AtomicRmw<kInstrumented, uint16_t, uint64_t>(
+            &pc, AtomicXor<uint16_t>));
         break;
 
-      case Opcode::F32ConvertUI32:
-        CHECK_TRAP(Push<float>(Pop<uint32_t>()));
+      case Opcode::I64AtomicRmw32UXor:
+        RUN_CHECK_TRAP(
+            AtomicRmw<kInstrumented, uint32_t, uint64_t>(
+            &pc, AtomicXor<uint32_t>));
         break;
 
-      case Opcode::F32ConvertSI64:
-        CHECK_TRAP(Push<float>(Pop<int64_t>()));
+      case Opcode::I32AtomicRmwXchg:
+        RUN_CHECK_TRAP(
+            AtomicRmw<kInstrumented, uint32_t>(&pc, AtomicXchg<uint32_t>));
         break;
 
-      case Opcode::F32ConvertUI64:
-        CHECK_TRAP(Push<float>(wabt_convert_uint64_to_float(Pop<uint64_t>())));
+      case Opcode::I64AtomicRmwXchg:
+        RUN_CHECK_TRAP(
+            AtomicRmw<kInstrumented, uint64_t>(&pc, AtomicXchg<uint64_t>));
         break;
 
-      case Opcode::F32DemoteF64: {
-        typedef FloatTraits<float> F32Traits;
-        typedef FloatTraits<double> F64Traits;
-
-        uint64_t value = PopRep<double>();
-        if (WABT_LIKELY((IsConversionInRange<float, double>(value)))) {
-          CHECK_TRAP(Push<float>(FromRep<double>(value)));
-        } else if (IsInRangeF64DemoteF32RoundToF32Max(value)) {
-          CHECK_TRAP(PushRep<float>(F32Traits::kMax));
-        } else if (IsInRangeF64DemoteF32RoundToNegF32Max(value)) {
-          CHECK_TRAP(PushRep<float>(F32Traits::kNegMax));
-        } else {
-          uint32_t sign = (value >> 32) & F32Traits::kSignMask;
-          uint32_t tag = 0;
-          if (F64Traits::IsNan(value)) {
-            tag = F32Traits::kQuietNanBit |
-                  ((value >> (F64Traits::kSigBits - F32Traits::kSigBits)) &
-                   F32Traits::kSigMask);
-          }
-          CHECK_TRAP(PushRep<float>(sign | F32Traits::kInf | tag));
-        }
+      case Opcode::I32AtomicRmw8UXchg:
+        RUN_CHECK_TRAP(
+            AtomicRmw<kInstrumented, uint8_t, uint32_t>(
+            &pc, AtomicXchg<uint8_t>));
         break;
-      }
 
-      case Opcode::F32ReinterpretI32:
-        CHECK_TRAP(PushRep<float>(Pop<uint32_t>()));
+      case Opcode::I32AtomicRmw16UXchg:
+        RUN_CHECK_TRAP(
+            AtomicRmw<kInstrumented, uint16_t, uint32_t>(
+            &pc, AtomicXchg<uint16_t>));
         break;
 
-      case Opcode::F64ConvertSI32:
-        CHECK_TRAP(Push<double>(Pop<int32_t>()));
+      case Opcode::I64AtomicRmw8UXchg:
+        RUN_CHECK_TRAP(
+            AtomicRmw<kInstrumented, uint8_t, uint64_t>(
+            &pc, AtomicXchg<uint8_t>));
         break;
 
-      case Opcode::F64ConvertUI32:
-        CHECK_TRAP(Push<double>(Pop<uint32_t>()));
+      case Opcode::I64AtomicRmw16UXchg:
+        RUN_CHECK_TRAP(
+            AtomicRmw<kInstrumented, uint16_t, uint64_t>(
+            &pc, AtomicXchg<uint16_t>));
         break;
 
-      case Opcode::F64ConvertSI64:
-        CHECK_TRAP(Push<double>(Pop<int64_t>()));
+      case Opcode::I64AtomicRmw32UXchg:
+        RUN_CHECK_TRAP(
+            AtomicRmw<kInstrumented, uint32_t, uint64_t>(
+            &pc, AtomicXchg<uint32_t>));
         break;
 
-      case Opcode::F64ConvertUI64:
-        CHECK_TRAP(
-            Push<double>(wabt_convert_uint64_to_double(Pop<uint64_t>())));
+      case Opcode::I32AtomicRmwCmpxchg:
+        RUN_CHECK_TRAP(AtomicRmwCmpxchg<kInstrumented, uint32_t>(&pc));
         break;
 
-      case Opcode::F64PromoteF32:
-        CHECK_TRAP(Push<double>(Pop<float>()));
+      case Opcode::I64AtomicRmwCmpxchg:
+        RUN_CHECK_TRAP(AtomicRmwCmpxchg<kInstrumented, uint64_t>(&pc));
         break;
 
-      case Opcode::F64ReinterpretI64:
-        CHECK_TRAP(PushRep<double>(Pop<uint64_t>()));
+      case Opcode::I32AtomicRmw8UCmpxchg:
+        RUN_CHECK_TRAP(AtomicRmwCmpxchg<kInstrumented, uint8_t, uint32_t>(&pc));
         break;
 
-      case Opcode::I32ReinterpretF32:
-        CHECK_TRAP(Push<uint32_t>(PopRep<float>()));
+      case Opcode::I32AtomicRmw16UCmpxchg:
+        RUN_CHECK_TRAP(
+            AtomicRmwCmpxchg<kInstrumented, uint16_t, uint32_t>(&pc));
         break;
 
-      case Opcode::I64ReinterpretF64:
-        CHECK_TRAP(Push<uint64_t>(PopRep<double>()));
+      case Opcode::I64AtomicRmw8UCmpxchg:
+        RUN_CHECK_TRAP(AtomicRmwCmpxchg<kInstrumented, uint8_t, uint64_t>(&pc));
         break;
 
-      case Opcode::I32Rotr:
-        CHECK_TRAP(Binop(IntRotr<uint32_t>));
+      case Opcode::I64AtomicRmw16UCmpxchg:
+        RUN_CHECK_TRAP(
+            AtomicRmwCmpxchg<kInstrumented, uint16_t, uint64_t>(&pc));
         break;
 
-      case Opcode::I32Rotl:
-        CHECK_TRAP(Binop(IntRotl<uint32_t>));
+      case Opcode::I64AtomicRmw32UCmpxchg:
+        RUN_CHECK_TRAP(
+            AtomicRmwCmpxchg<kInstrumented, uint32_t, uint64_t>(&pc));
         break;
 
-      case Opcode::I64Rotr:
-        CHECK_TRAP(Binop(IntRotr<uint64_t>));
+      case Opcode::MemoryAtomicWait32:
+        RUN_CHECK_TRAP(AtomicWait<uint32_t>(&pc));
         break;
 
-      case Opcode::I64Rotl:
-        CHECK_TRAP(Binop(IntRotl<uint64_t>));
+      case Opcode::MemoryAtomicWait64:
+        RUN_CHECK_TRAP(AtomicWait<uint64_t>(&pc));
         break;
 
-      case Opcode::I64Eqz:
-        CHECK_TRAP(Unop(IntEqz<uint32_t, uint64_t>));
+      case Opcode::MemoryAtomicNotify:
+        RUN_CHECK_TRAP(AtomicNotify(&pc));
         break;
 
       case Opcode::Alloca: {
         Value* old_value_stack_top = value_stack_top_;
         value_stack_top_ += read_u32(&pc);
-        CHECK_STACK();
+        RUN_TRAP_IF(value_stack_top_ >= value_stack_end_, ValueStackExhausted);
         memset(old_value_stack_top, 0,
                (value_stack_top_ - old_value_stack_top) * sizeof(Value));
         break;
@@ -1956,7 +3153,7 @@ Result Thread::Run(int num_instructions, IstreamOffset* call_stack_return_top) {
 
       case Opcode::DropKeep: {
         uint32_t drop_count = read_u32(&pc);
-        uint8_t keep_count = *pc++;
+        uint32_t keep_count = read_u32(&pc);
         DropKeep(drop_count, keep_count);
         break;
       }
@@ -1976,10 +3173,49 @@ Result Thread::Run(int num_instructions, IstreamOffset* call_stack_return_top) {
   }
 
 exit_loop:
+  // Run charged the whole batch; refund what is left of it after the
+  // instruction that returned or trapped.
+  if (result != Result::Ok)
+    env_->resource_usage_.instructions -= num_instructions - i - 1;
   pc_ = pc - istream;
   return result;
 }
 
+#undef RUN_TRAP
+#undef RUN_TRAP_UNLESS
+#undef RUN_TRAP_IF
+#undef RUN_CHECK_TRAP
+#undef PUSH_NEG_1_AND_BREAK_IF
+
+bool Thread::EvaluateConstantExpr(Opcode opcode,
+                                  const Value* args,
+                                  Index num_args,
+                                  Value* out_result) {
+  value_stack_top_ = value_stack_.data();
+  for (Index i = 0; i < num_args; ++i) {
+    if (Push(args[i]) != Result::Ok)
+      return false;
+  }
+
+  Result result;
+  switch (opcode) {
+#define V(name, expr)  \
+    case Opcode::name: \
+      result = expr;   \
+      break;
+    WABT_FOREACH_NUMERIC_OPCODE(V)
+#undef V
+
+    default:
+      return false;
+  }
+
+  if (result != Result::Ok)
+    return false;
+  *out_result = Pop();
+  return true;
+}
+
 void Thread::Trace(Stream* stream) {
   const uint8_t* istream = GetIstream();
   const uint8_t* pc = &istream[pc_];
@@ -1989,7 +3225,7 @@ void Thread::Trace(Stream* stream) {
   stream->Writef("#%" PRIzd ". %4" PRIzd ": V:%-3" PRIzd "| ", call_stack_depth,
                  pc - istream, value_stack_depth);
 
-  Opcode opcode = static_cast<Opcode>(*pc++);
+  Opcode opcode = read_opcode(&pc);
   switch (opcode) {
     case Opcode::Select:
       stream->Writef("%s %u, %" PRIu64 ", %" PRIu64 "\n", GetOpcodeName(opcode),
@@ -2047,6 +3283,14 @@ void Thread::Trace(Stream* stream) {
                      Bitcast<double>(read_u64_at(pc)));
       break;
 
+    case Opcode::V128Const: {
+      v128 value = read_v128_at(pc);
+      stream->Writef("%s $0x%08x 0x%08x 0x%08x 0x%08x\n",
+                     GetOpcodeName(opcode), value.v[0], value.v[1], value.v[2],
+                     value.v[3]);
+      break;
+    }
+
     case Opcode::GetLocal:
     case Opcode::GetGlobal:
       stream->Writef("%s $%u\n", GetOpcodeName(opcode), read_u32_at(pc));
@@ -2072,6 +3316,15 @@ void Thread::Trace(Stream* stream) {
       stream->Writef("%s $%u\n", GetOpcodeName(opcode), read_u32_at(pc));
       break;
 
+    case Opcode::ReturnCall:
+      stream->Writef("%s @%u\n", GetOpcodeName(opcode), read_u32_at(pc));
+      break;
+
+    case Opcode::ReturnCallIndirect:
+      stream->Writef("%s $%u, %u\n", GetOpcodeName(opcode), read_u32_at(pc),
+                     Top().i32);
+      break;
+
     case Opcode::I32Load8S:
     case Opcode::I32Load8U:
     case Opcode::I32Load16S:
@@ -2085,48 +3338,41 @@ void Thread::Trace(Stream* stream) {
     case Opcode::I32Load:
     case Opcode::I64Load:
     case Opcode::F32Load:
-    case Opcode::F64Load: {
-      Index memory_index = read_u32(&pc);
-      stream->Writef("%s $%" PRIindex ":%u+$%u\n", GetOpcodeName(opcode),
-                     memory_index, Top().i32, read_u32_at(pc));
+    case Opcode::F64Load:
+    case Opcode::V128Load:
+      stream->Writef("%s %u+$%u\n", GetOpcodeName(opcode), Top().i32,
+                     read_u32_at(pc));
       break;
-    }
 
     case Opcode::I32Store8:
     case Opcode::I32Store16:
-    case Opcode::I32Store: {
-      Index memory_index = read_u32(&pc);
-      stream->Writef("%s $%" PRIindex ":%u+$%u, %u\n", GetOpcodeName(opcode),
-                     memory_index, Pick(2).i32, read_u32_at(pc), Pick(1).i32);
+    case Opcode::I32Store:
+      stream->Writef("%s %u+$%u, %u\n", GetOpcodeName(opcode), Pick(2).i32,
+                     read_u32_at(pc), Pick(1).i32);
       break;
-    }
 
     case Opcode::I64Store8:
     case Opcode::I64Store16:
     case Opcode::I64Store32:
-    case Opcode::I64Store: {
-      Index memory_index = read_u32(&pc);
-      stream->Writef("%s $%" PRIindex ":%u+$%u, %" PRIu64 "\n",
-                     GetOpcodeName(opcode), memory_index, Pick(2).i32,
-                     read_u32_at(pc), Pick(1).i64);
+    case Opcode::I64Store:
+      stream->Writef("%s %u+$%u, %" PRIu64 "\n", GetOpcodeName(opcode),
+                     Pick(2).i32, read_u32_at(pc), Pick(1).i64);
       break;
-    }
 
-    case Opcode::F32Store: {
-      Index memory_index = read_u32(&pc);
-      stream->Writef("%s $%" PRIindex ":%u+$%u, %g\n", GetOpcodeName(opcode),
-                     memory_index, Pick(2).i32, read_u32_at(pc),
-                     Bitcast<float>(Pick(1).f32_bits));
+    case Opcode::F32Store:
+      stream->Writef("%s %u+$%u, %g\n", GetOpcodeName(opcode), Pick(2).i32,
+                     read_u32_at(pc), Bitcast<float>(Pick(1).f32_bits));
       break;
-    }
 
-    case Opcode::F64Store: {
-      Index memory_index = read_u32(&pc);
-      stream->Writef("%s $%" PRIindex ":%u+$%u, %g\n", GetOpcodeName(opcode),
-                     memory_index, Pick(2).i32, read_u32_at(pc),
-                     Bitcast<double>(Pick(1).f64_bits));
+    case Opcode::F64Store:
+      stream->Writef("%s %u+$%u, %g\n", GetOpcodeName(opcode), Pick(2).i32,
+                     read_u32_at(pc), Bitcast<double>(Pick(1).f64_bits));
+      break;
+
+    case Opcode::V128Store:
+      stream->Writef("%s %u+$%u\n", GetOpcodeName(opcode), Pick(2).i32,
+                     read_u32_at(pc));
       break;
-    }
 
     case Opcode::GrowMemory: {
       Index memory_index = read_u32(&pc);
@@ -2135,6 +3381,14 @@ void Thread::Trace(Stream* stream) {
       break;
     }
 
+    case Opcode::MemoryCopy:
+    case Opcode::MemoryFill: {
+      Index memory_index = read_u32(&pc);
+      stream->Writef("%s $%" PRIindex ":%u, %u, %u\n", GetOpcodeName(opcode),
+                     memory_index, Pick(3).i32, Pick(2).i32, Pick(1).i32);
+      break;
+    }
+
     case Opcode::I32Add:
     case Opcode::I32Sub:
     case Opcode::I32Mul:
@@ -2303,6 +3557,165 @@ void Thread::Trace(Stream* stream) {
       stream->Writef("%s %u\n", GetOpcodeName(opcode), Top().i32);
       break;
 
+    case Opcode::I8X16Splat:
+    case Opcode::I16X8Splat:
+    case Opcode::I32X4Splat:
+    case Opcode::I64X2Splat:
+    case Opcode::F32X4Splat:
+    case Opcode::F64X2Splat:
+    case Opcode::V128Not:
+    case Opcode::V128And:
+    case Opcode::V128Andnot:
+    case Opcode::V128Or:
+    case Opcode::V128Xor:
+    case Opcode::I8X16Add:
+    case Opcode::I8X16Sub:
+    case Opcode::I16X8Add:
+    case Opcode::I16X8Sub:
+    case Opcode::I16X8Mul:
+    case Opcode::I32X4Add:
+    case Opcode::I32X4Sub:
+    case Opcode::I32X4Mul:
+    case Opcode::I64X2Add:
+    case Opcode::I64X2Sub:
+    case Opcode::I64X2Mul:
+    case Opcode::F32X4Add:
+    case Opcode::F32X4Sub:
+    case Opcode::F32X4Mul:
+    case Opcode::F32X4Div:
+    case Opcode::F64X2Add:
+    case Opcode::F64X2Sub:
+    case Opcode::F64X2Mul:
+    case Opcode::F64X2Div:
+      stream->Writef("%s\n", GetOpcodeName(opcode));
+      break;
+
+    case Opcode::I32X4ExtractLane:
+    case Opcode::I32X4ReplaceLane:
+    case Opcode::I64X2ExtractLane:
+    case Opcode::I64X2ReplaceLane:
+    case Opcode::F32X4ExtractLane:
+    case Opcode::F32X4ReplaceLane:
+    case Opcode::F64X2ExtractLane:
+    case Opcode::F64X2ReplaceLane:
+      stream->Writef("%s $%u\n", GetOpcodeName(opcode), *pc);
+      break;
+
+    case Opcode::I32AtomicLoad:
+    case Opcode::I64AtomicLoad:
+    case Opcode::I32AtomicLoad8U:
+    case Opcode::I32AtomicLoad16U:
+    case Opcode::I64AtomicLoad8U:
+    case Opcode::I64AtomicLoad16U:
+    case Opcode::I64AtomicLoad32U: {
+      Index memory_index = read_u32(&pc);
+      stream->Writef("%s $%" PRIindex ":%u+$%u\n", GetOpcodeName(opcode),
+                     memory_index, Top().i32, read_u32_at(pc));
+      break;
+    }
+
+    case Opcode::I32AtomicStore:
+    case Opcode::I32AtomicRmwAdd:
+    case Opcode::I32AtomicRmwSub:
+    case Opcode::I32AtomicRmwAnd:
+    case Opcode::I32AtomicRmwOr:
+    case Opcode::I32AtomicRmwXor:
+    case Opcode::I32AtomicRmwXchg:
+    case Opcode::I32AtomicStore8:
+    case Opcode::I32AtomicStore16:
+    case Opcode::I32AtomicRmw8UAdd:
+    case Opcode::I32AtomicRmw16UAdd:
+    case Opcode::I32AtomicRmw8USub:
+    case Opcode::I32AtomicRmw16USub:
+    case Opcode::I32AtomicRmw8UAnd:
+    case Opcode::I32AtomicRmw16UAnd:
+    case Opcode::I32AtomicRmw8UOr:
+    case Opcode::I32AtomicRmw16UOr:
+    case Opcode::I32AtomicRmw8UXor:
+    case Opcode::I32AtomicRmw16UXor:
+    case Opcode::I32AtomicRmw8UXchg:
+    case Opcode::I32AtomicRmw16UXchg:
+    case Opcode::MemoryAtomicNotify: {
+      Index memory_index = read_u32(&pc);
+      stream->Writef("%s $%" PRIindex ":%u+$%u, %u\n", GetOpcodeName(opcode),
+                     memory_index, Pick(2).i32, read_u32_at(pc), Pick(1).i32);
+      break;
+    }
+
+    case Opcode::I64AtomicStore:
+    case Opcode::I64AtomicRmwAdd:
+    case Opcode::I64AtomicRmwSub:
+    case Opcode::I64AtomicRmwAnd:
+    case Opcode::I64AtomicRmwOr:
+    case Opcode::I64AtomicRmwXor:
+    case Opcode::I64AtomicRmwXchg:
+    case Opcode::I64AtomicStore8:
+    case Opcode::I64AtomicStore16:
+    case Opcode::I64AtomicStore32:
+    case Opcode::I64AtomicRmw8UAdd:
+    case Opcode::I64AtomicRmw16UAdd:
+    case Opcode::I64AtomicRmw32UAdd:
+    case Opcode::I64AtomicRmw8USub:
+    case Opcode::I64AtomicRmw16USub:
+    case Opcode::I64AtomicRmw32USub:
+    case Opcode::I64AtomicRmw8UAnd:
+    case Opcode::I64AtomicRmw16UAnd:
+    case Opcode::I64AtomicRmw32UAnd:
+    case Opcode::I64AtomicRmw8UOr:
+    case Opcode::I64AtomicRmw16UOr:
+    case Opcode::I64AtomicRmw32UOr:
+    case Opcode::I64AtomicRmw8UXor:
+    case Opcode::I64AtomicRmw16UXor:
+    case Opcode::I64AtomicRmw32UXor:
+    case Opcode::I64AtomicRmw8UXchg:
+    case Opcode::I64AtomicRmw16UXchg:
+    case Opcode::I64AtomicRmw32UXchg: {
+      Index memory_index = read_u32(&pc);
+      stream->Writef("%s $%" PRIindex ":%u+$%u, %" PRIu64 "\n",
+                     GetOpcodeName(opcode), memory_index, Pick(2).i32,
+                     read_u32_at(pc), Pick(1).i64);
+      break;
+    }
+
+    case Opcode::I32AtomicRmwCmpxchg:
+    case Opcode::I32AtomicRmw8UCmpxchg:
+    case Opcode::I32AtomicRmw16UCmpxchg: {
+      Index memory_index = read_u32(&pc);
+      stream->Writef("%s $%" PRIindex ":%u+$%u, %u, %u\n",
+                     GetOpcodeName(opcode), memory_index, Pick(3).i32,
+                     read_u32_at(pc), Pick(2).i32, Pick(1).i32);
+      break;
+    }
+
+    case Opcode::I64AtomicRmwCmpxchg:
+    case Opcode::I64AtomicRmw8UCmpxchg:
+    case Opcode::I64AtomicRmw16UCmpxchg:
+    case Opcode::I64AtomicRmw32UCmpxchg: {
+      Index memory_index = read_u32(&pc);
+      stream->Writef("%s $%" PRIindex ":%u+$%u, %" PRIu64 ", %" PRIu64 "\n",
+                     GetOpcodeName(opcode), memory_index, Pick(3).i32,
+                     read_u32_at(pc), Pick(2).i64, Pick(1).i64);
+      break;
+    }
+
+    case Opcode::MemoryAtomicWait32: {
+      Index memory_index = read_u32(&pc);
+      stream->Writef("%s $%" PRIindex ":%u+$%u, %u, %" PRId64 "\n",
+                     GetOpcodeName(opcode), memory_index, Pick(3).i32,
+                     read_u32_at(pc), Pick(2).i32,
+                     static_cast<int64_t>(Pick(1).i64));
+      break;
+    }
+
+    case Opcode::MemoryAtomicWait64: {
+      Index memory_index = read_u32(&pc);
+      stream->Writef("%s $%" PRIindex ":%u+$%u, %" PRIu64 ", %" PRId64 "\n",
+                     GetOpcodeName(opcode), memory_index, Pick(3).i32,
+                     read_u32_at(pc), Pick(2).i64,
+                     static_cast<int64_t>(Pick(1).i64));
+      break;
+    }
+
     case Opcode::Alloca:
       stream->Writef("%s $%u\n", GetOpcodeName(opcode), read_u32_at(pc));
       break;
@@ -2314,7 +3727,7 @@ void Thread::Trace(Stream* stream) {
 
     case Opcode::DropKeep:
       stream->Writef("%s $%u $%u\n", GetOpcodeName(opcode), read_u32_at(pc),
-                     *(pc + 4));
+                     read_u32_at(pc + 4));
       break;
 
     case Opcode::Data:
@@ -2338,11 +3751,15 @@ void Environment::Disassemble(Stream* stream,
   to = std::min<IstreamOffset>(to, istream_->data.size());
   const uint8_t* istream = istream_->data.data();
   const uint8_t* pc = &istream[from];
+  // Saved from the last BrTable, to display the Data that follows it.
+  Index br_table_num_targets = 0;
+  IstreamOffset br_table_offset = kInvalidIstreamOffset;
+  IstreamOffset br_table_drop_keep_offset = kInvalidIstreamOffset;
 
   while (static_cast<IstreamOffset>(pc - istream) < to) {
     stream->Writef("%4" PRIzd "| ", pc - istream);
 
-    Opcode opcode = static_cast<Opcode>(*pc++);
+    Opcode opcode = read_opcode(&pc);
     switch (opcode) {
       case Opcode::Select:
         stream->Writef("%s %%[-3], %%[-2], %%[-1]\n", GetOpcodeName(opcode));
@@ -2358,10 +3775,12 @@ void Environment::Disassemble(Stream* stream,
         break;
 
       case Opcode::BrTable: {
-        Index num_targets = read_u32(&pc);
-        IstreamOffset table_offset = read_u32(&pc);
+        br_table_num_targets = read_u32(&pc);
+        br_table_offset = read_u32(&pc);
+        br_table_drop_keep_offset = read_u32(&pc);
         stream->Writef("%s %%[-1], $#%" PRIindex ", table:$%u\n",
-                       GetOpcodeName(opcode), num_targets, table_offset);
+                       GetOpcodeName(opcode), br_table_num_targets,
+                       br_table_offset);
         break;
       }
 
@@ -2398,6 +3817,14 @@ void Environment::Disassemble(Stream* stream,
                        Bitcast<double>(read_u64(&pc)));
         break;
 
+      case Opcode::V128Const: {
+        v128 value = read_v128(&pc);
+        stream->Writef("%s $0x%08x 0x%08x 0x%08x 0x%08x\n",
+                       GetOpcodeName(opcode), value.v[0], value.v[1],
+                       value.v[2], value.v[3]);
+        break;
+      }
+
       case Opcode::GetLocal:
       case Opcode::GetGlobal:
         stream->Writef("%s $%u\n", GetOpcodeName(opcode), read_u32(&pc));
@@ -2410,14 +3837,25 @@ void Environment::Disassemble(Stream* stream,
                        read_u32(&pc));
         break;
 
-      case Opcode::Call:
-        stream->Writef("%s @%u\n", GetOpcodeName(opcode), read_u32(&pc));
+      case Opcode::Call: {
+        IstreamOffset offset = read_u32(&pc);
+        Index num_params = read_u32(&pc);
+        Index memory_index = read_u32(&pc);
+        stream->Writef("%s @%u, $#%u", GetOpcodeName(opcode), offset,
+                       num_params);
+        if (memory_index != kInvalidIndex)
+          stream->Writef(", $%" PRIindex, memory_index);
+        stream->Writef("\n");
         break;
+      }
 
       case Opcode::CallIndirect: {
         Index table_index = read_u32(&pc);
-        stream->Writef("%s $%" PRIindex ":%u, %%[-1]\n", GetOpcodeName(opcode),
-                       table_index, read_u32(&pc));
+        Index sig_index = read_u32(&pc);
+        stream->Writef("%s $%" PRIindex ":%u, $#%u, %%[-1]\n",
+                       GetOpcodeName(opcode), table_index, sig_index,
+                       read_u32(&pc));
+        pc += sizeof(Index);
         break;
       }
 
@@ -2425,6 +3863,25 @@ void Environment::Disassemble(Stream* stream,
         stream->Writef("%s $%u\n", GetOpcodeName(opcode), read_u32(&pc));
         break;
 
+      case Opcode::ReturnCall: {
+        IstreamOffset offset = read_u32(&pc);
+        Index memory_index = read_u32(&pc);
+        stream->Writef("%s @%u", GetOpcodeName(opcode), offset);
+        if (memory_index != kInvalidIndex)
+          stream->Writef(", $%" PRIindex, memory_index);
+        stream->Writef("\n");
+        break;
+      }
+
+      case Opcode::ReturnCallIndirect: {
+        Index table_index = read_u32(&pc);
+        Index sig_index = read_u32(&pc);
+        stream->Writef("%s $%" PRIindex ":%u, $%u, %%[-1]\n",
+                       GetOpcodeName(opcode), table_index, sig_index,
+                       read_u32(&pc));
+        break;
+      }
+
       case Opcode::I32Load8S:
       case Opcode::I32Load8U:
       case Opcode::I32Load16S:
@@ -2438,12 +3895,11 @@ void Environment::Disassemble(Stream* stream,
       case Opcode::I32Load:
       case Opcode::I64Load:
       case Opcode::F32Load:
-      case Opcode::F64Load: {
-        Index memory_index = read_u32(&pc);
-        stream->Writef("%s $%" PRIindex ":%%[-1]+$%u\n", GetOpcodeName(opcode),
-                       memory_index, read_u32(&pc));
+      case Opcode::F64Load:
+      case Opcode::V128Load:
+        stream->Writef("%s %%[-1]+$%u\n", GetOpcodeName(opcode),
+                       read_u32(&pc));
         break;
-      }
 
       case Opcode::I32Store8:
       case Opcode::I32Store16:
@@ -2453,12 +3909,11 @@ void Environment::Disassemble(Stream* stream,
       case Opcode::I64Store32:
       case Opcode::I64Store:
       case Opcode::F32Store:
-      case Opcode::F64Store: {
-        Index memory_index = read_u32(&pc);
-        stream->Writef("%s %%[-2]+$%" PRIindex ", $%u:%%[-1]\n",
-                       GetOpcodeName(opcode), memory_index, read_u32(&pc));
+      case Opcode::F64Store:
+      case Opcode::V128Store:
+        stream->Writef("%s %%[-2]+$%u, %%[-1]\n", GetOpcodeName(opcode),
+                       read_u32(&pc));
         break;
-      }
 
       case Opcode::I32Add:
       case Opcode::I32Sub:
@@ -2536,6 +3991,29 @@ void Environment::Disassemble(Stream* stream,
       case Opcode::F64Le:
       case Opcode::F64Gt:
       case Opcode::F64Ge:
+      case Opcode::V128And:
+      case Opcode::V128Andnot:
+      case Opcode::V128Or:
+      case Opcode::V128Xor:
+      case Opcode::I8X16Add:
+      case Opcode::I8X16Sub:
+      case Opcode::I16X8Add:
+      case Opcode::I16X8Sub:
+      case Opcode::I16X8Mul:
+      case Opcode::I32X4Add:
+      case Opcode::I32X4Sub:
+      case Opcode::I32X4Mul:
+      case Opcode::I64X2Add:
+      case Opcode::I64X2Sub:
+      case Opcode::I64X2Mul:
+      case Opcode::F32X4Add:
+      case Opcode::F32X4Sub:
+      case Opcode::F32X4Mul:
+      case Opcode::F32X4Div:
+      case Opcode::F64X2Add:
+      case Opcode::F64X2Sub:
+      case Opcode::F64X2Mul:
+      case Opcode::F64X2Div:
         stream->Writef("%s %%[-2], %%[-1]\n", GetOpcodeName(opcode));
         break;
 
@@ -2586,9 +4064,31 @@ void Environment::Disassemble(Stream* stream,
       case Opcode::F32ReinterpretI32:
       case Opcode::F64ConvertSI32:
       case Opcode::F64ConvertUI32:
+      case Opcode::I8X16Splat:
+      case Opcode::I16X8Splat:
+      case Opcode::I32X4Splat:
+      case Opcode::I64X2Splat:
+      case Opcode::F32X4Splat:
+      case Opcode::F64X2Splat:
+      case Opcode::V128Not:
         stream->Writef("%s %%[-1]\n", GetOpcodeName(opcode));
         break;
 
+      case Opcode::I32X4ExtractLane:
+      case Opcode::I64X2ExtractLane:
+      case Opcode::F32X4ExtractLane:
+      case Opcode::F64X2ExtractLane:
+        stream->Writef("%s $%u, %%[-1]\n", GetOpcodeName(opcode), *pc++);
+        break;
+
+      case Opcode::I32X4ReplaceLane:
+      case Opcode::I64X2ReplaceLane:
+      case Opcode::F32X4ReplaceLane:
+      case Opcode::F64X2ReplaceLane:
+        stream->Writef("%s $%u, %%[-2], %%[-1]\n", GetOpcodeName(opcode),
+                       *pc++);
+        break;
+
       case Opcode::GrowMemory: {
         Index memory_index = read_u32(&pc);
         stream->Writef("%s $%" PRIindex ":%%[-1]\n", GetOpcodeName(opcode),
@@ -2596,6 +4096,98 @@ void Environment::Disassemble(Stream* stream,
         break;
       }
 
+      case Opcode::MemoryCopy:
+      case Opcode::MemoryFill: {
+        Index memory_index = read_u32(&pc);
+        stream->Writef("%s $%" PRIindex ":%%[-3], %%[-2], %%[-1]\n",
+                       GetOpcodeName(opcode), memory_index);
+        break;
+      }
+
+      case Opcode::I32AtomicLoad:
+      case Opcode::I64AtomicLoad:
+      case Opcode::I32AtomicLoad8U:
+      case Opcode::I32AtomicLoad16U:
+      case Opcode::I64AtomicLoad8U:
+      case Opcode::I64AtomicLoad16U:
+      case Opcode::I64AtomicLoad32U: {
+        Index memory_index = read_u32(&pc);
+        stream->Writef("%s $%" PRIindex ":%%[-1]+$%u\n", GetOpcodeName(opcode),
+                       memory_index, read_u32(&pc));
+        break;
+      }
+
+      case Opcode::I32AtomicStore:
+      case Opcode::I32AtomicRmwAdd:
+      case Opcode::I32AtomicRmwSub:
+      case Opcode::I32AtomicRmwAnd:
+      case Opcode::I32AtomicRmwOr:
+      case Opcode::I32AtomicRmwXor:
+      case Opcode::I32AtomicRmwXchg:
+      case Opcode::MemoryAtomicNotify:
+      case Opcode::I64AtomicStore:
+      case Opcode::I64AtomicRmwAdd:
+      case Opcode::I64AtomicRmwSub:
+      case Opcode::I64AtomicRmwAnd:
+      case Opcode::I64AtomicRmwOr:
+      case Opcode::I64AtomicRmwXor:
+      case Opcode::I64AtomicRmwXchg:
+      case Opcode::I32AtomicStore8:
+      case Opcode::I32AtomicStore16:
+      case Opcode::I32AtomicRmw8UAdd:
+      case Opcode::I32AtomicRmw16UAdd:
+      case Opcode::I32AtomicRmw8USub:
+      case Opcode::I32AtomicRmw16USub:
+      case Opcode::I32AtomicRmw8UAnd:
+      case Opcode::I32AtomicRmw16UAnd:
+      case Opcode::I32AtomicRmw8UOr:
+      case Opcode::I32AtomicRmw16UOr:
+      case Opcode::I32AtomicRmw8UXor:
+      case Opcode::I32AtomicRmw16UXor:
+      case Opcode::I32AtomicRmw8UXchg:
+      case Opcode::I32AtomicRmw16UXchg:
+      case Opcode::I64AtomicStore8:
+      case Opcode::I64AtomicStore16:
+      case Opcode::I64AtomicStore32:
+      case Opcode::I64AtomicRmw8UAdd:
+      case Opcode::I64AtomicRmw16UAdd:
+      case Opcode::I64AtomicRmw32UAdd:
+      case Opcode::I64AtomicRmw8USub:
+      case Opcode::I64AtomicRmw16USub:
+      case Opcode::I64AtomicRmw32USub:
+      case Opcode::I64AtomicRmw8UAnd:
+      case Opcode::I64AtomicRmw16UAnd:
+      case Opcode::I64AtomicRmw32UAnd:
+      case Opcode::I64AtomicRmw8UOr:
+      case Opcode::I64AtomicRmw16UOr:
+      case Opcode::I64AtomicRmw32UOr:
+      case Opcode::I64AtomicRmw8UXor:
+      case Opcode::I64AtomicRmw16UXor:
+      case Opcode::I64AtomicRmw32UXor:
+      case Opcode::I64AtomicRmw8UXchg:
+      case Opcode::I64AtomicRmw16UXchg:
+      case Opcode::I64AtomicRmw32UXchg: {
+        Index memory_index = read_u32(&pc);
+        stream->Writef("%s $%" PRIindex ":%%[-2]+$%u, %%[-1]\n",
+                       GetOpcodeName(opcode), memory_index, read_u32(&pc));
+        break;
+      }
+
+      case Opcode::I32AtomicRmwCmpxchg:
+      case Opcode::I64AtomicRmwCmpxchg:
+      case Opcode::I32AtomicRmw8UCmpxchg:
+      case Opcode::I32AtomicRmw16UCmpxchg:
+      case Opcode::I64AtomicRmw8UCmpxchg:
+      case Opcode::I64AtomicRmw16UCmpxchg:
+      case Opcode::I64AtomicRmw32UCmpxchg:
+      case Opcode::MemoryAtomicWait32:
+      case Opcode::MemoryAtomicWait64: {
+        Index memory_index = read_u32(&pc);
+        stream->Writef("%s $%" PRIindex ":%%[-3]+$%u, %%[-2], %%[-1]\n",
+                       GetOpcodeName(opcode), memory_index, read_u32(&pc));
+        break;
+      }
+
       case Opcode::Alloca:
         stream->Writef("%s $%u\n", GetOpcodeName(opcode), read_u32(&pc));
         break;
@@ -2607,7 +4199,7 @@ void Environment::Disassemble(Stream* stream,
 
       case Opcode::DropKeep: {
         uint32_t drop = read_u32(&pc);
-        uint8_t keep = *pc++;
+        uint32_t keep = read_u32(&pc);
         stream->Writef("%s $%u $%u\n", GetOpcodeName(opcode), drop, keep);
         break;
       }
@@ -2617,23 +4209,24 @@ void Environment::Disassemble(Stream* stream,
         stream->Writef("%s $%u\n", GetOpcodeName(opcode), num_bytes);
         /* for now, the only reason this is emitted is for br_table, so display
          * it as a list of table entries */
-        if (num_bytes % WABT_TABLE_ENTRY_SIZE == 0) {
-          Index num_entries = num_bytes / WABT_TABLE_ENTRY_SIZE;
-          for (Index i = 0; i < num_entries; ++i) {
-            stream->Writef("%4" PRIzd "| ", pc - istream);
-            IstreamOffset offset;
-            uint32_t drop;
-            uint8_t keep;
-            read_table_entry_at(pc, &offset, &drop, &keep);
-            stream->Writef("  entry %" PRIindex
-                           ": offset: %u drop: %u keep: %u\n",
-                           i, offset, drop, keep);
-            pc += WABT_TABLE_ENTRY_SIZE;
+        if (br_table_offset != kInvalidIstreamOffset) {
+          for (Index i = 0; i <= br_table_num_targets; ++i) {
+            IstreamOffset entry_offset =
+                br_table_offset + i * sizeof(IstreamOffset);
+            stream->Writef("%4u|   entry %" PRIindex ": offset: %u", entry_offset,
+                           i, read_u32_at(istream + entry_offset));
+            if (br_table_drop_keep_offset != kInvalidIstreamOffset) {
+              const uint8_t* entry = istream + br_table_drop_keep_offset +
+                                     i * WABT_BR_TABLE_DROP_KEEP_SIZE;
+              stream->Writef(" drop: %u keep: %u",
+                             read_u32_at(entry + WABT_BR_TABLE_DROP_OFFSET),
+                             read_u32_at(entry + WABT_BR_TABLE_KEEP_OFFSET));
+            }
+            stream->Writef("\n");
           }
-        } else {
-          /* just skip those data bytes */
-          pc += num_bytes;
+          br_table_offset = kInvalidIstreamOffset;
         }
+        pc += num_bytes;
 
         break;
       }
@@ -2645,6 +4238,19 @@ void Environment::Disassemble(Stream* stream,
   }
 }
 
+bool Environment::DisassembleTraceRecord(Stream* stream,
+                                         const TraceRecord& record) {
+  if (record.pc >= istream_->data.size() ||
+      istream_->data[record.pc] != record.opcode) {
+    return false;
+  }
+
+  stream->Writef("#%u. V:%-3u| %016" PRIx64 " |", record.call_stack_depth,
+                 record.value_stack_depth, record.top);
+  Disassemble(stream, record.pc, record.pc + 1);
+  return true;
+}
+
 void Environment::DisassembleModule(Stream* stream, Module* module) {
   assert(!module->is_host);
   Disassemble(stream, module->as_defined()->istream_start,
@@ -19,8 +19,12 @@
 
 #include <stdint.h>
 
+#include <atomic>
+#include <condition_variable>
 #include <functional>
+#include <list>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #include "binding-hash.h"
@@ -63,6 +67,14 @@ namespace interpreter {
   V(TrapHostResultTypeMismatch, "host result type mismatch")                \
   /* we called an import function, but it didn't complete succesfully */    \
   V(TrapHostTrapped, "host function trapped")                               \
+  /* atomic memory access address is not naturally aligned */               \
+  V(TrapAtomicMemoryAccessUnaligned, "unaligned atomic")                    \
+  /* memory.atomic.wait on a memory that isn't shared */                    \
+  V(TrapExpectedSharedMemory, "expected shared memory")                     \
+  /* the environment's instruction limit was reached */                     \
+  V(TrapInstructionLimitExceeded, "instruction limit exceeded")             \
+  /* the environment's host call limit was reached */                       \
+  V(TrapHostCallLimitExceeded, "host call limit exceeded")                  \
   /* we attempted to call a function with the an argument list that doesn't \
    * match the function signature */                                        \
   V(ArgumentTypeMismatch, "argument type mismatch")                         \
@@ -80,18 +92,25 @@ enum class Result {
 typedef uint32_t IstreamOffset;
 static const IstreamOffset kInvalidIstreamOffset = ~0;
 
-// A table entry has the following packed layout:
+// BrTable is followed by a Data block holding its targets: an array of
+// num_targets + 1 IstreamOffsets, aligned to 4 bytes, where the last one is
+// the default target. If any target drops values, the offsets are followed by
+// one drop/keep entry per target, with the following packed layout:
 //
 //   struct {
-//     IstreamOffset offset;
 //     uint32_t drop_count;
-//     uint8_t keep_count;
+//     uint32_t keep_count;
 //   };
-#define WABT_TABLE_ENTRY_SIZE \
-  (sizeof(IstreamOffset) + sizeof(uint32_t) + sizeof(uint8_t))
-#define WABT_TABLE_ENTRY_OFFSET_OFFSET 0
-#define WABT_TABLE_ENTRY_DROP_OFFSET sizeof(uint32_t)
-#define WABT_TABLE_ENTRY_KEEP_OFFSET (sizeof(IstreamOffset) + sizeof(uint32_t))
+//
+// Otherwise BrTable's drop/keep table offset is kInvalidIstreamOffset.
+#define WABT_BR_TABLE_DROP_KEEP_SIZE (sizeof(uint32_t) + sizeof(uint32_t))
+#define WABT_BR_TABLE_DROP_OFFSET 0
+#define WABT_BR_TABLE_KEEP_OFFSET sizeof(uint32_t)
+
+// CallIndirect's last immediate is the index of its call site, which selects
+// the running Thread's inline cache of the last callee; see
+// Thread::CallIndirectCache. The istream itself is never written while
+// running.
 
 // NOTE: These enumeration values do not match the standard binary encoding.
 enum class Opcode {
@@ -101,6 +120,25 @@ enum class Opcode {
   Invalid,
 };
 
+static const int kOpcodeCount = static_cast<int>(Opcode::Invalid);
+
+// Opcodes take one byte in the istream, except for the threads opcodes, which
+// are kOpcodePrefix followed by their distance from kFirstPrefixedOpcode.
+static const uint8_t kOpcodePrefix = 0xff;
+static const int kFirstPrefixedOpcode =
+    static_cast<int>(Opcode::MemoryAtomicNotify);
+static_assert(kFirstPrefixedOpcode <= kOpcodePrefix,
+              "one-byte opcodes must not reach kOpcodePrefix");
+static_assert(kOpcodeCount - kFirstPrefixedOpcode <= 256,
+              "prefixed opcodes must fit in the byte after kOpcodePrefix");
+
+inline Opcode FromWabtOpcode(wabt::Opcode opcode) {
+  return static_cast<Opcode>(static_cast<int>(Opcode::Unreachable) +
+                             static_cast<wabt::Opcode::Enum>(opcode));
+}
+
+const char* GetOpcodeName(Opcode opcode);
+
 struct FuncSignature {
   FuncSignature() = default;
   FuncSignature(Index param_count,
@@ -120,13 +158,43 @@ struct Table {
   std::vector<Index> func_indexes;
 };
 
+// The threads blocked in memory.atomic.wait32/wait64 on one shared memory.
+class WaitQueue {
+ public:
+  // Blocks until |address| is notified or |timeout| nanoseconds have passed
+  // (forever if |timeout| is negative). |is_expected| is checked first with
+  // the queue locked, so a notify can't be missed between the check and the
+  // wait. Returns the result of memory.atomic.wait: 0 if woken, 1 if
+  // |is_expected| returned false, or 2 if timed out.
+  uint32_t Wait(uint64_t address,
+                int64_t timeout,
+                const std::function<bool()>& is_expected);
+
+  // Wakes at most |count| of the threads waiting on |address|, oldest first,
+  // and returns the number woken.
+  uint32_t Notify(uint64_t address, uint32_t count);
+
+ private:
+  struct Waiter {
+    uint64_t address;
+    bool woken;
+  };
+
+  std::mutex mutex_;
+  std::condition_variable cond_;
+  std::list<Waiter*> waiters_;
+};
+
 struct Memory {
   Memory() = default;
-  explicit Memory(const Limits& limits)
-      : page_limits(limits), data(limits.initial * WABT_PAGE_SIZE) {}
+  explicit Memory(const Limits& limits);
 
   Limits page_limits;
+  // A shared memory reserves its max size up front, so growing it never moves
+  // |data| while another Thread may be accessing it.
   std::vector<char> data;
+  // Only set for shared memories.
+  std::unique_ptr<WaitQueue> wait_queue;
 };
 
 // ValueTypeRep converts from one type to its representation on the
@@ -140,6 +208,7 @@ template <> struct ValueTypeRepT<int64_t> { typedef uint64_t type; };
 template <> struct ValueTypeRepT<uint64_t> { typedef uint64_t type; };
 template <> struct ValueTypeRepT<float> { typedef uint32_t type; };
 template <> struct ValueTypeRepT<double> { typedef uint64_t type; };
+template <> struct ValueTypeRepT<v128> { typedef v128 type; };
 
 template <typename T>
 using ValueTypeRep = typename ValueTypeRepT<T>::type;
@@ -149,6 +218,7 @@ union Value {
   uint64_t i64;
   ValueTypeRep<float> f32_bits;
   ValueTypeRep<double> f64_bits;
+  ValueTypeRep<v128> v128_bits;
 };
 
 struct TypedValue {
@@ -221,12 +291,18 @@ struct DefinedFunc : Func {
       : Func(sig_index, false),
         offset(kInvalidIstreamOffset),
         local_decl_count(0),
-        local_count(0) {}
+        local_count(0),
+        memory_index(kInvalidIndex) {}
 
   IstreamOffset offset;
   Index local_decl_count;
   Index local_count;
+  // The memory of the module that defines this function, used by its loads
+  // and stores, or kInvalidIndex if the module has none.
+  Index memory_index;
   std::vector<Type> param_and_local_types;
+  // From the name section, if it was read.
+  std::string name;
 };
 
 struct HostFunc : Func {
@@ -293,6 +369,16 @@ struct Module {
   bool is_host;
 };
 
+// Maps an instruction in the istream back to the instruction in the module's
+// binary it was translated from.
+struct OffsetMapEntry {
+  OffsetMapEntry(IstreamOffset istream_offset, uint32_t binary_offset)
+      : istream_offset(istream_offset), binary_offset(binary_offset) {}
+
+  IstreamOffset istream_offset;
+  uint32_t binary_offset;
+};
+
 struct DefinedModule : Module {
   DefinedModule();
 
@@ -300,6 +386,27 @@ struct DefinedModule : Module {
   Index start_func_index; /* kInvalidIndex if not defined */
   IstreamOffset istream_start;
   IstreamOffset istream_end;
+  // The module's function num_func_imports + i is the Environment's function
+  // defined_func_env_index + i, for i < num_defined_funcs.
+  Index num_func_imports;
+  Index defined_func_env_index;
+  Index num_defined_funcs;
+  // Sorted by istream offset, with one entry for each instruction that emits
+  // anything. Only read to describe a trap.
+  std::vector<OffsetMapEntry> offset_map;
+};
+
+// One frame of the call stack of a trap; see Thread::GetTrapStackTrace.
+struct TrapFrame {
+  TrapFrame();
+
+  // The trapping instruction in the innermost frame, a call in the others.
+  IstreamOffset istream_offset;
+  // The rest are only set if the instruction is in a DefinedModule's code.
+  DefinedModule* module;
+  Index func_index;  // In the module's function index space.
+  std::string func_name;  // From the name section or an export, or empty.
+  Offset binary_offset;  // Of the instruction in the module's binary.
 };
 
 struct HostModule : Module {
@@ -318,6 +425,125 @@ HostModule* Module::as_host() {
   return static_cast<HostModule*>(this);
 }
 
+// A fixed-size record of one executed instruction, appended to a TraceBuffer
+// by Thread::Run. The instruction's immediates are not stored; they can be
+// recovered from the istream at |pc|, see Environment::DisassembleTraceRecord.
+struct TraceRecord {
+  IstreamOffset pc;
+  uint32_t opcode;
+  uint32_t value_stack_depth;
+  uint32_t call_stack_depth;
+  uint64_t top;  // Raw bits of the top of the value stack, or 0 if empty.
+};
+
+// Collects TraceRecords without formatting them. If |stream| is non-null, the
+// header is written to it immediately, and the records are written whenever
+// the buffer fills and on Flush, so the whole execution is kept. Otherwise the
+// buffer is a ring that only keeps the most recent |capacity| records.
+//
+// Each Thread should use its own TraceBuffer; there is a single writer, so no
+// locking is needed.
+class TraceBuffer {
+ public:
+  static const uint32_t kMagic = 0x63727477;  // "wtrc"
+  static const uint32_t kVersion = 1;
+  static const size_t kDefaultCapacity = 64 * 1024;
+
+  // |capacity| is rounded up to a power of two.
+  explicit TraceBuffer(Stream* stream = nullptr,
+                       size_t capacity = kDefaultCapacity);
+
+  void Append(const TraceRecord& record) {
+    records_[count_ & mask_] = record;
+    if ((++count_ & mask_) == 0 && stream_)
+      Flush();
+  }
+
+  void Flush();
+
+  uint64_t count() const { return count_; }
+
+  // Copy the records that are still in the buffer, oldest first.
+  void GetRecords(std::vector<TraceRecord>* out_records) const;
+
+  // Parse a trace written by a TraceBuffer with a stream.
+  static wabt::Result ReadRecords(const void* data,
+                                  size_t size,
+                                  std::vector<TraceRecord>* out_records);
+
+ private:
+  Stream* stream_;  // Not owned.
+  std::vector<TraceRecord> records_;
+  uint64_t mask_;
+  uint64_t count_ = 0;
+  uint64_t flushed_ = 0;
+};
+
+// One linear memory access made by a Load or Store instruction at |pc|.
+struct MemoryAccess {
+  IstreamOffset pc;
+  uint64_t address;
+  uint8_t size;
+  bool is_store;
+};
+
+// Writes a sampled log of memory accesses to a stream. Only every
+// |sample_interval|th access is recorded. Each record is a tag byte (access
+// size, plus 0x80 for stores) followed by the differences from the previous
+// record's pc and address as signed LEB128s, so consecutive accesses from the
+// same loop typically take 3 bytes.
+class MemoryAccessLog {
+ public:
+  static const uint32_t kMagic = 0x6d656d77;  // "wmem"
+  static const uint32_t kVersion = 1;
+
+  explicit MemoryAccessLog(Stream* stream, uint32_t sample_interval = 1);
+
+  void Record(IstreamOffset pc, uint64_t address, uint8_t size, bool is_store) {
+    if (--countdown_ != 0)
+      return;
+    countdown_ = sample_interval_;
+    Write(pc, address, size, is_store);
+  }
+
+  uint32_t sample_interval() const { return sample_interval_; }
+
+  // Parse a log written by a MemoryAccessLog.
+  static wabt::Result ReadAccesses(const void* data,
+                                   size_t size,
+                                   uint32_t* out_sample_interval,
+                                   std::vector<MemoryAccess>* out_accesses);
+
+ private:
+  void Write(IstreamOffset pc, uint64_t address, uint8_t size, bool is_store);
+
+  Stream* stream_;  // Not owned.
+  uint32_t sample_interval_;
+  uint32_t countdown_;
+  IstreamOffset last_pc_ = 0;
+  uint64_t last_address_ = 0;
+};
+
+// Hard limits on the resources used by an Environment and the Threads that
+// run in it. Zero means unlimited.
+struct ResourceLimits {
+  // Total pages of all memories. Instantiating a module whose memory would
+  // exceed it fails, and grow_memory past it returns -1.
+  uint32_t max_memory_pages = 0;
+  // Exceeding these traps.
+  uint64_t max_instructions = 0;
+  uint64_t max_host_calls = 0;
+};
+
+struct ResourceUsage {
+  uint32_t peak_memory_pages = 0;
+  uint64_t grow_memory_calls = 0;  // Including ones that failed.
+  // Charged per batch of instructions; a batch that traps is charged in full,
+  // so this can over-count by less than one batch per trap.
+  uint64_t instructions = 0;
+  uint64_t host_calls = 0;
+};
+
 class Environment {
  public:
   // Used to track and reset the state of the environment.
@@ -329,6 +555,7 @@ class Environment {
     size_t tables_size = 0;
     size_t globals_size = 0;
     size_t istream_size = 0;
+    Index call_indirect_sites_size = 0;
   };
 
   Environment();
@@ -427,13 +654,36 @@ class Environment {
 
   HostModule* AppendHostModule(string_view name);
 
+  ResourceLimits& resource_limits() { return resource_limits_; }
+  const ResourceUsage& resource_usage() const { return resource_usage_; }
+  void ResetResourceUsage();
+
+  // Total pages of all memories.
+  uint32_t GetMemoryPageCount() const;
+  // Call after adding or growing a memory.
+  void UpdatePeakMemoryPages();
+
   bool FuncSignaturesAreEqual(Index sig_index_0, Index sig_index_1) const;
 
+  // Describe the instruction at |offset| for a stack trace, by looking it up
+  // in the offset map of the module that contains it.
+  TrapFrame GetTrapFrame(IstreamOffset offset);
+
+  // Call after writing to a table's func_indexes, to invalidate the
+  // call_indirect inline caches of every Thread.
+  void InvalidateCallIndirectCaches();
+  // Returns the index of a new call_indirect site, which names its inline
+  // cache.
+  Index AddCallIndirectSite() { return num_call_indirect_sites_++; }
+
   MarkPoint Mark();
   void ResetToMarkPoint(const MarkPoint&);
 
   void Disassemble(Stream* stream, IstreamOffset from, IstreamOffset to);
   void DisassembleModule(Stream* stream, Module*);
+  // Returns false if |record| doesn't match the instruction in the istream,
+  // e.g. because it was recorded with a different module.
+  bool DisassembleTraceRecord(Stream* stream, const TraceRecord& record);
 
  private:
   friend class Thread;
@@ -443,16 +693,53 @@ class Environment {
   std::vector<std::unique_ptr<Func>> funcs_;
   std::vector<Memory> memories_;
   std::vector<Table> tables_;
+  // Never zero, so the zero-initialized caches of new call sites miss.
+  uint32_t table_generation_ = 1;
+  Index num_call_indirect_sites_ = 0;
   std::vector<Global> globals_;
   std::unique_ptr<OutputBuffer> istream_;
   BindingHash module_bindings_;
   BindingHash registered_module_bindings_;
+  ResourceLimits resource_limits_;
+  ResourceUsage resource_usage_;
+};
+
+// Dynamic execution counts, collected by Thread::Run when enabled with
+// Thread::EnableExecutionCounts. Functions and basic blocks are identified by
+// the istream offset of their first instruction. A basic block is counted
+// each time control arrives at it from a branch, call or return, or by falling
+// through a conditional branch.
+struct ExecutionCounts {
+  ExecutionCounts();
+
+  std::vector<uint64_t> opcode_counts;       // Indexed by Opcode.
+  std::vector<uint64_t> opcode_pair_counts;  // Indexed by prev * count + cur.
+  std::vector<uint64_t> func_counts;         // Indexed by IstreamOffset.
+  std::vector<uint64_t> block_counts;        // Indexed by IstreamOffset.
+  uint64_t call_indirect_cache_hits;
+  uint64_t call_indirect_cache_misses;
+
+  Opcode prev_opcode;
+  bool at_block_start;
+};
+
+// A Thread's call stack holds one CallFrame for each call from a defined
+// function that hasn't returned yet. It saves the caller's state: where to
+// resume, its frame pointer, the address of its first param on the value
+// stack, and its memory. Params and locals are addressed relative to the frame
+// pointer.
+struct CallFrame {
+  IstreamOffset return_offset;
+  Value* frame_pointer;
+  Index memory_index;
 };
 
 class Thread {
  public:
   struct Options {
-    static const uint32_t kDefaultValueStackSize = 512 * 1024 / sizeof(Value);
+    // In elements rather than bytes, so that growing Value to hold a v128
+    // does not halve the recursion depth available to existing modules.
+    static const uint32_t kDefaultValueStackSize = 64 * 1024;
     static const uint32_t kDefaultCallStackSize = 64 * 1024;
 
     explicit Options(uint32_t value_stack_size = kDefaultValueStackSize,
@@ -477,16 +764,57 @@ class Thread {
                        const std::vector<TypedValue>& args,
                        std::vector<TypedValue>* out_results);
 
+  // Start collecting ExecutionCounts. When neither this nor set_trace_buffer
+  // is used, Run uses an uninstrumented instantiation of the interpreter
+  // loop.
+  void EnableExecutionCounts();
+  const ExecutionCounts* execution_counts() const {
+    return execution_counts_.get();
+  }
+
+  // Append a TraceRecord for every executed instruction to |buffer|, or stop
+  // if |buffer| is null. Not owned.
+  void set_trace_buffer(TraceBuffer* buffer) { trace_buffer_ = buffer; }
+
+  // Record the linear memory accesses of every Load and Store to |log|, or
+  // stop if |log| is null. Not owned.
+  void set_memory_access_log(MemoryAccessLog* log) { memory_access_log_ = log; }
+
+  // The call stack when the last RunFunction or TraceFunction trapped,
+  // innermost frame first, or empty if it called a host function directly. It
+  // is only collected on a trap.
+  std::vector<TrapFrame> GetTrapStackTrace() const;
+
+  // Apply the numeric |opcode| to the constants |args| as executing it would,
+  // without an istream, e.g. to fold constants while emitting one. Returns
+  // false if |opcode| isn't foldable, or if it would trap.
+  bool EvaluateConstantExpr(Opcode,
+                            const Value* args,
+                            Index num_args,
+                            Value* out_result);
+
  private:
   const uint8_t* GetIstream() const { return env_->istream_->data.data(); }
 
   Result PushArgs(const FuncSignature*, const std::vector<TypedValue>& args);
   void CopyResults(const FuncSignature*, std::vector<TypedValue>* out_results);
 
-  Result Run(int num_instructions, IstreamOffset* call_stack_return_top);
+  Result Run(int num_instructions, CallFrame* call_stack_return_top);
+  template <bool kInstrumented>
+  Result RunImpl(int num_instructions, CallFrame* call_stack_return_top);
   void Trace(Stream*);
 
+  void RecordInstruction(Opcode, IstreamOffset);
+  void CountFuncEntry(IstreamOffset);
+  void CountOpcode(Opcode, IstreamOffset);
+
   Memory* ReadMemory(const uint8_t** pc);
+  // Make |memory_index| the memory of the running function, whose base and
+  // size are then cached for Load and Store.
+  void CacheMemory(Index memory_index);
+  // Reload the cached memory size, and return whether [0, end) is now in
+  // bounds.
+  bool RecacheMemoryCovers(uint64_t end);
 
   Value& Top();
   Value& Pick(Index depth);
@@ -510,16 +838,63 @@ class Thread {
   template <typename T>
   ValueTypeRep<T> PopRep();
 
-  void DropKeep(uint32_t drop_count, uint8_t keep_count);
+  void DropKeep(uint32_t drop_count, uint32_t keep_count);
+
+  // The last callee of a call_indirect site. It is valid while
+  // table_generation matches the Environment's, and only holds defined
+  // functions.
+  struct CallIndirectCache {
+    uint32_t table_generation = 0;
+    Index entry_index = 0;
+    IstreamOffset offset = 0;
+    Index memory_index = 0;
+  };
+
+  CallIndirectCache* GetCallIndirectCache(Index site_index);
 
-  Result PushCall(const uint8_t* pc) WABT_WARN_UNUSED;
+  // Push a CallFrame for a call to a function whose |num_params| arguments
+  // are on top of the value stack, and which uses |memory_index|.
+  Result PushCall(const uint8_t* pc,
+                  Index num_params,
+                  Index memory_index) WABT_WARN_UNUSED;
   IstreamOffset PopCall();
 
-  template <typename MemType, typename ResultType = MemType>
+  template <bool kInstrumented,
+            typename MemType,
+            typename ResultType = MemType>
   Result Load(const uint8_t** pc) WABT_WARN_UNUSED;
-  template <typename MemType, typename ResultType = MemType>
+  template <bool kInstrumented,
+            typename MemType,
+            typename ResultType = MemType>
   Result Store(const uint8_t** pc) WABT_WARN_UNUSED;
 
+  template <bool kInstrumented, typename T>
+  Result AtomicAccess(const uint8_t** pc,
+                      bool is_store,
+                      Memory** out_memory,
+                      uint64_t* out_offset) WABT_WARN_UNUSED;
+  template <bool kInstrumented,
+            typename MemType,
+            typename ResultType = MemType>
+  Result AtomicLoad(const uint8_t** pc) WABT_WARN_UNUSED;
+  template <bool kInstrumented,
+            typename MemType,
+            typename ResultType = MemType>
+  Result AtomicStore(const uint8_t** pc) WABT_WARN_UNUSED;
+  template <typename T> using AtomicRmwFunc = T(std::atomic<T>*, T);
+  template <bool kInstrumented,
+            typename MemType,
+            typename ResultType = MemType>
+  Result AtomicRmw(const uint8_t** pc,
+                   AtomicRmwFunc<MemType> func) WABT_WARN_UNUSED;
+  template <bool kInstrumented,
+            typename MemType,
+            typename ResultType = MemType>
+  Result AtomicRmwCmpxchg(const uint8_t** pc) WABT_WARN_UNUSED;
+  template <typename T>
+  Result AtomicWait(const uint8_t** pc) WABT_WARN_UNUSED;
+  Result AtomicNotify(const uint8_t** pc) WABT_WARN_UNUSED;
+
   template <typename R, typename T> using UnopFunc      = R(T);
   template <typename R, typename T> using UnopTrapFunc  = Result(T, R*);
   template <typename R, typename T> using BinopFunc     = R(T, T);
@@ -535,19 +910,35 @@ class Thread {
   template <typename R, typename T = R>
   Result BinopTrap(BinopTrapFunc<R, T> func) WABT_WARN_UNUSED;
 
-  Result RunDefinedFunction(IstreamOffset);
-  Result TraceDefinedFunction(IstreamOffset, Stream*);
+  Result RunDefinedFunction(const DefinedFunc*, Index num_params);
+  void SaveTrapStack(Result);
+  Result TraceDefinedFunction(const DefinedFunc*, Index num_params, Stream*);
 
   Result CallHost(HostFunc*);
 
   Environment* env_;
   std::vector<Value> value_stack_;
-  std::vector<IstreamOffset> call_stack_;
+  std::vector<CallFrame> call_stack_;
   Value* value_stack_top_;
   Value* value_stack_end_;
-  IstreamOffset* call_stack_top_;
-  IstreamOffset* call_stack_end_;
+  Value* frame_pointer_;
+  // The running function's memory. Its base and size are reloaded whenever
+  // it changes, grows, or may have been grown by another Thread.
+  Index memory_index_ = kInvalidIndex;
+  char* memory_base_ = nullptr;
+  uint64_t memory_size_ = 0;
+  CallFrame* call_stack_top_;
+  CallFrame* call_stack_end_;
   IstreamOffset pc_;
+  std::unique_ptr<ExecutionCounts> execution_counts_;
+  // Indexed by call_indirect site. Kept per Thread, so Threads running
+  // concurrently never write to shared state to update them.
+  std::vector<CallIndirectCache> call_indirect_caches_;
+  TraceBuffer* trace_buffer_ = nullptr;
+  MemoryAccessLog* memory_access_log_ = nullptr;
+  // The istream offsets of the frames of the last trap; see
+  // GetTrapStackTrace.
+  std::vector<IstreamOffset> trap_stack_;
 };
 
 bool IsCanonicalNan(uint32_t f32_bits);
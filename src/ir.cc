@@ -24,6 +24,12 @@
 namespace {
 
 const char* ExprTypeName[] = {
+  "AtomicLoad",
+  "AtomicNotify",
+  "AtomicRmw",
+  "AtomicRmwCmpxchg",
+  "AtomicStore",
+  "AtomicWait",
   "Binary",
   "Block",
   "Br",
@@ -42,12 +48,17 @@ const char* ExprTypeName[] = {
   "If",
   "Load",
   "Loop",
+  "MemoryCopy",
+  "MemoryFill",
   "Nop",
   "Rethrow",
   "Return",
+  "ReturnCall",
+  "ReturnCallIndirect",
   "Select",
   "SetGlobal",
   "SetLocal",
+  "SimdLaneOp",
   "Store",
   "TeeLocal",
   "Throw",
@@ -237,7 +248,7 @@ Var::Var(Index index, const Location& loc)
     : loc(loc), type_(VarType::Index), index_(index) {}
 
 Var::Var(string_view name, const Location& loc)
-    : loc(loc), type_(VarType::Name), name_(name) {}
+    : loc(loc), type_(VarType::Name), name_(new std::string(name)) {}
 
 Var::Var(Var&& rhs) : Var(kInvalidIndex) {
   *this = std::move(rhs);
@@ -251,8 +262,13 @@ Var& Var::operator=(Var&& rhs) {
   loc = rhs.loc;
   if (rhs.is_index()) {
     set_index(rhs.index_);
-  } else {
-    set_name(rhs.name_);
+  } else if (this != &rhs) {
+    // Take rhs's name, and leave it with an invalid index.
+    Destroy();
+    type_ = VarType::Name;
+    name_ = rhs.name_;
+    rhs.type_ = VarType::Index;
+    rhs.index_ = kInvalidIndex;
   }
   return *this;
 }
@@ -261,8 +277,8 @@ Var& Var::operator=(const Var& rhs) {
   loc = rhs.loc;
   if (rhs.is_index()) {
     set_index(rhs.index_);
-  } else {
-    set_name(rhs.name_);
+  } else if (this != &rhs) {
+    set_name(*rhs.name_);
   }
   return *this;
 }
@@ -280,7 +296,7 @@ void Var::set_index(Index index) {
 void Var::set_name(std::string&& name) {
   Destroy();
   type_ = VarType::Name;
-  Construct(name_, std::move(name));
+  name_ = new std::string(std::move(name));
 }
 
 void Var::set_name(string_view name) {
@@ -289,7 +305,7 @@ void Var::set_name(string_view name) {
 
 void Var::Destroy() {
   if (is_name())
-    Destruct(name_);
+    delete name_;
 }
 
 Const::Const(I32, uint32_t value, const Location& loc_)
@@ -308,6 +324,10 @@ Const::Const(F64, uint64_t value, const Location& loc_)
     : loc(loc_), type(Type::F64), f64_bits(value) {
 }
 
+Const::Const(V128, v128 value, const Location& loc_)
+    : loc(loc_), type(Type::V128), v128_bits(value) {
+}
+
 Block::Block(ExprList exprs) : exprs(std::move(exprs)) {}
 
 Catch::Catch() {}
@@ -24,7 +24,9 @@
 #include <string>
 #include <vector>
 #include <type_traits>
+#include <utility>
 
+#include "arena.h"
 #include "binding-hash.h"
 #include "common.h"
 #include "intrusive-list.h"
@@ -41,6 +43,7 @@ enum class VarType {
 struct Var {
   explicit Var(Index index = kInvalidIndex, const Location& loc = Location());
   explicit Var(string_view name, const Location& loc = Location());
+  // Moving a named Var takes its name, and leaves it with kInvalidIndex.
   Var(Var&&);
   Var(const Var&);
   Var& operator =(const Var&);
@@ -52,7 +55,7 @@ struct Var {
   bool is_name() const { return type_ == VarType::Name; }
 
   Index index() const { assert(is_index()); return index_; }
-  const std::string& name() const { assert(is_name()); return name_; }
+  const std::string& name() const { assert(is_name()); return *name_; }
 
   void set_index(Index);
   void set_name(std::string&&);
@@ -64,9 +67,12 @@ struct Var {
   void Destroy();
 
   VarType type_;
+  // The name is kept out of line, so that a Var that holds an index, as every
+  // Var read from a binary does, is only as big as it needs to be. A Var is
+  // part of many Exprs, so this keeps them small too.
   union {
     Index index_;
-    std::string name_;
+    std::string* name_;
   };
 };
 typedef std::vector<Var> VarVector;
@@ -77,12 +83,14 @@ struct Const {
   struct I64 {};
   struct F32 {};
   struct F64 {};
+  struct V128 {};
 
   Const() : Const(I32(), 0, Location()) {}
   Const(I32, uint32_t val = 0, const Location& loc = Location());
   Const(I64, uint64_t val = 0, const Location& loc = Location());
   Const(F32, uint32_t val = 0, const Location& loc = Location());
   Const(F64, uint64_t val = 0, const Location& loc = Location());
+  Const(V128, v128 val, const Location& loc = Location());
 
   Location loc;
   Type type;
@@ -91,11 +99,18 @@ struct Const {
     uint64_t u64;
     uint32_t f32_bits;
     uint64_t f64_bits;
+    v128 v128_bits;
   };
 };
 typedef std::vector<Const> ConstVector;
 
 enum class ExprType {
+  AtomicLoad,
+  AtomicNotify,
+  AtomicRmw,
+  AtomicRmwCmpxchg,
+  AtomicStore,
+  AtomicWait,
   Binary,
   Block,
   Br,
@@ -114,12 +129,17 @@ enum class ExprType {
   If,
   Load,
   Loop,
+  MemoryCopy,
+  MemoryFill,
   Nop,
   Rethrow,
   Return,
+  ReturnCall,
+  ReturnCallIndirect,
   Select,
   SetGlobal,
   SetLocal,
+  SimdLaneOp,
   Store,
   TeeLocal,
   Throw,
@@ -127,7 +147,7 @@ enum class ExprType {
   Unary,
   Unreachable,
 
-  First = Binary,
+  First = AtomicLoad,
   Last = Unreachable
 };
 
@@ -189,6 +209,8 @@ class ExprMixin : public Expr {
 typedef ExprMixin<ExprType::CurrentMemory> CurrentMemoryExpr;
 typedef ExprMixin<ExprType::Drop> DropExpr;
 typedef ExprMixin<ExprType::GrowMemory> GrowMemoryExpr;
+typedef ExprMixin<ExprType::MemoryCopy> MemoryCopyExpr;
+typedef ExprMixin<ExprType::MemoryFill> MemoryFillExpr;
 typedef ExprMixin<ExprType::Nop> NopExpr;
 typedef ExprMixin<ExprType::Return> ReturnExpr;
 typedef ExprMixin<ExprType::Select> SelectExpr;
@@ -222,6 +244,8 @@ typedef VarExpr<ExprType::CallIndirect> CallIndirectExpr;
 typedef VarExpr<ExprType::GetGlobal> GetGlobalExpr;
 typedef VarExpr<ExprType::GetLocal> GetLocalExpr;
 typedef VarExpr<ExprType::Rethrow> RethrowExpr;
+typedef VarExpr<ExprType::ReturnCall> ReturnCallExpr;
+typedef VarExpr<ExprType::ReturnCallIndirect> ReturnCallIndirectExpr;
 typedef VarExpr<ExprType::SetGlobal> SetGlobalExpr;
 typedef VarExpr<ExprType::SetLocal> SetLocalExpr;
 typedef VarExpr<ExprType::TeeLocal> TeeLocalExpr;
@@ -275,6 +299,14 @@ class ConstExpr : public ExprMixin<ExprType::Const> {
   Const const_;
 };
 
+class SimdLaneOpExpr : public ExprMixin<ExprType::SimdLaneOp> {
+ public:
+  SimdLaneOpExpr(Opcode opcode, uint32_t lane) : opcode(opcode), lane(lane) {}
+
+  Opcode opcode;
+  uint32_t lane;
+};
+
 template <ExprType TypeEnum>
 class LoadStoreExpr : public ExprMixin<TypeEnum> {
  public:
@@ -288,6 +320,33 @@ class LoadStoreExpr : public ExprMixin<TypeEnum> {
 
 typedef LoadStoreExpr<ExprType::Load> LoadExpr;
 typedef LoadStoreExpr<ExprType::Store> StoreExpr;
+typedef LoadStoreExpr<ExprType::AtomicLoad> AtomicLoadExpr;
+typedef LoadStoreExpr<ExprType::AtomicNotify> AtomicNotifyExpr;
+typedef LoadStoreExpr<ExprType::AtomicRmw> AtomicRmwExpr;
+typedef LoadStoreExpr<ExprType::AtomicRmwCmpxchg> AtomicRmwCmpxchgExpr;
+typedef LoadStoreExpr<ExprType::AtomicStore> AtomicStoreExpr;
+typedef LoadStoreExpr<ExprType::AtomicWait> AtomicWaitExpr;
+
+// An Expr allocated in an Arena by MakeArenaExpr. Deleting it, e.g. by erasing
+// it from an ExprList, runs its destructor but leaves its memory to the arena.
+template <typename T>
+class ArenaExpr final : public T {
+ public:
+  template <typename... Args>
+  explicit ArenaExpr(Args&&... args) : T(std::forward<Args>(args)...) {}
+
+  static void* operator new(size_t size, Arena* arena) {
+    return arena->Allocate(size, alignof(ArenaExpr));
+  }
+  static void operator delete(void*, Arena*) {}
+  static void operator delete(void*) {}
+};
+
+// Like new T(args...), but in |arena|. The Expr must not outlive the arena.
+template <typename T, typename... Args>
+T* MakeArenaExpr(Arena* arena, Args&&... args) {
+  return new (arena) ArenaExpr<T>(std::forward<Args>(args)...);
+}
 
 struct Exception {
   Exception() = default;
@@ -582,6 +641,10 @@ struct Module {
   Exception* GetExcept(const Var&) const;
   Index GetExceptIndex(const Var&) const;
 
+  // Holds the Exprs that read_binary_ir creates. It is declared first so that
+  // it is destroyed last, after the fields that refer to them.
+  Arena expr_arena;
+
   Location loc;
   std::string name;
   ModuleFieldList fields;
@@ -0,0 +1,136 @@
+/*
+ * Copyright 2017 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef WABT_LEB128_H_
+#define WABT_LEB128_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "config.h"
+
+namespace wabt {
+
+// Each of these reads a LEB128 from [ptr, end) into |out_value|, and returns
+// its length in bytes, or 0 if it is invalid or runs past |end|.
+//
+// Most LEB128s are a single byte, so that is checked first. Otherwise, with at
+// least 8 bytes left, the LEB128 is decoded from a single 64-bit load without
+// a branch per byte. The _slow functions read it byte by byte, and are only
+// used near the end of the buffer and for 9- and 10-byte i64s.
+
+size_t read_u32_leb128_slow(const uint8_t* ptr,
+                            const uint8_t* end,
+                            uint32_t* out_value);
+
+size_t read_i32_leb128_slow(const uint8_t* ptr,
+                            const uint8_t* end,
+                            uint32_t* out_value);
+
+size_t read_i64_leb128_slow(const uint8_t* ptr,
+                            const uint8_t* end,
+                            uint64_t* out_value);
+
+// Decode the LEB128 at the start of the 8 bytes at |ptr|. Returns its length,
+// or 0 if it is longer than 8 bytes. |out_bits| gets its 7-bit groups, packed
+// together but not sign-extended. Like the interpreter, this assumes a
+// little-endian host.
+inline size_t decode_leb128_word(const uint8_t* ptr, uint64_t* out_bits) {
+  uint64_t word;
+  memcpy(&word, ptr, sizeof(word));
+  // The last byte is the first one without the continuation bit.
+  uint64_t stops = ~word & 0x8080808080808080ull;
+  if (stops == 0)
+    return 0;
+
+  // Keep the groups up to and including the last byte, then pack them.
+  uint64_t bits = word & (stops ^ (stops - 1)) & 0x7f7f7f7f7f7f7f7full;
+  bits = (bits & 0x007f007f007f007full) |
+         ((bits & 0x7f007f007f007f00ull) >> 1);
+  bits = (bits & 0x00003fff00003fffull) |
+         ((bits & 0x3fff00003fff0000ull) >> 2);
+  bits = (bits & 0x000000000fffffffull) |
+         ((bits & 0x0fffffff00000000ull) >> 4);
+  *out_bits = bits;
+  return wabt_ctz_u64(stops) / 8 + 1;
+}
+
+inline size_t read_u32_leb128(const uint8_t* ptr,
+                              const uint8_t* end,
+                              uint32_t* out_value) {
+  if (WABT_LIKELY(ptr < end && (*ptr & 0x80) == 0)) {
+    *out_value = *ptr;
+    return 1;
+  }
+  if (WABT_UNLIKELY(end - ptr < 8))
+    return read_u32_leb128_slow(ptr, end, out_value);
+
+  uint64_t bits;
+  size_t length = decode_leb128_word(ptr, &bits);
+  // At most 5 bytes, and the top bits of the fifth must be clear.
+  if (length == 0 || length > 5 || (bits >> 32) != 0)
+    return 0;
+  *out_value = static_cast<uint32_t>(bits);
+  return length;
+}
+
+inline size_t read_i32_leb128(const uint8_t* ptr,
+                              const uint8_t* end,
+                              uint32_t* out_value) {
+  if (WABT_LIKELY(ptr < end && (*ptr & 0x80) == 0)) {
+    *out_value = static_cast<uint32_t>(static_cast<int8_t>(*ptr << 1) >> 1);
+    return 1;
+  }
+  if (WABT_UNLIKELY(end - ptr < 8))
+    return read_i32_leb128_slow(ptr, end, out_value);
+
+  uint64_t bits;
+  size_t length = decode_leb128_word(ptr, &bits);
+  if (length == 0 || length > 5)
+    return 0;
+  int shift = 64 - 7 * length;
+  int64_t value = static_cast<int64_t>(bits << shift) >> shift;
+  // The top bits of the fifth byte must be a sign-extension of the sign bit.
+  if (value < INT32_MIN || value > INT32_MAX)
+    return 0;
+  *out_value = static_cast<uint32_t>(value);
+  return length;
+}
+
+inline size_t read_i64_leb128(const uint8_t* ptr,
+                              const uint8_t* end,
+                              uint64_t* out_value) {
+  if (WABT_LIKELY(ptr < end && (*ptr & 0x80) == 0)) {
+    *out_value = static_cast<uint64_t>(static_cast<int8_t>(*ptr << 1) >> 1);
+    return 1;
+  }
+  if (WABT_UNLIKELY(end - ptr < 8))
+    return read_i64_leb128_slow(ptr, end, out_value);
+
+  uint64_t bits;
+  size_t length = decode_leb128_word(ptr, &bits);
+  if (length == 0)
+    return read_i64_leb128_slow(ptr, end, out_value);
+  int shift = 64 - 7 * length;
+  *out_value = static_cast<uint64_t>(static_cast<int64_t>(bits << shift) >>
+                                     shift);
+  return length;
+}
+
+}  // namespace wabt
+
+#endif /* WABT_LEB128_H_ */
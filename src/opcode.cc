@@ -40,16 +40,31 @@ Opcode::Info Opcode::invalid_info_ = {
 
 // static
 Opcode Opcode::FromCode(uint32_t code) {
+  Info* end = infos_ + WABT_ARRAY_SIZE(infos_);
   auto iter = std::lower_bound(
-      infos_, infos_ + WABT_ARRAY_SIZE(infos_), code,
+      infos_, end, code,
       [](const Info& info, uint32_t code) { return info.code < code; });
 
-  if (iter->code != code)
+  if (iter == end || iter->code != code)
     return Opcode(Invalid);
 
   return Opcode(static_cast<Enum>(iter - infos_));
 }
 
+// static
+Opcode Opcode::FromCode(uint8_t prefix, uint32_t code) {
+  if (code > 0xff)
+    return Opcode(Invalid);
+  return FromCode((static_cast<uint32_t>(prefix) << 8) | code);
+}
+
+Address Opcode::GetLength() const {
+  if (!HasPrefix())
+    return 1;
+  // The code is at most 0xff, so its LEB128 takes one or two bytes.
+  return GetCode() < 0x80 ? 2 : 3;
+}
+
 Opcode::Info Opcode::GetInfo() const {
   return enum_ < Invalid ? infos_[enum_] : invalid_info_;
 }
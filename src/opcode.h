@@ -44,8 +44,25 @@ struct Opcode {
   Opcode(Enum e) : enum_(e) {}
   operator Enum() const { return enum_; }
 
+  // Opcodes added after the MVP are encoded as a prefix byte followed by a
+  // LEB128 code. opcode.def writes them as (prefix << 8) | code.
+  static const uint8_t kMiscPrefix = 0xfc;
+  static const uint8_t kSimdPrefix = 0xfd;
+  static const uint8_t kThreadsPrefix = 0xfe;
+
+  static bool IsPrefixByte(uint8_t byte) {
+    return byte == kMiscPrefix || byte == kSimdPrefix ||
+           byte == kThreadsPrefix;
+  }
+
   static Opcode FromCode(uint32_t);
-  uint32_t GetCode() const { return GetInfo().code; }
+  static Opcode FromCode(uint8_t prefix, uint32_t code);
+  bool HasPrefix() const { return GetInfo().code > 0xff; }
+  uint8_t GetPrefix() const { return GetInfo().code >> 8; }
+  // The code following the prefix, if any.
+  uint32_t GetCode() const { return GetInfo().code & 0xff; }
+  // The size of the canonical binary encoding, including the prefix.
+  Address GetLength() const;
   const char* GetName() const { return GetInfo().name; }
   Type GetResultType() const { return GetInfo().result_type; }
   Type GetParamType1() const { return GetInfo().param1_type; }
@@ -77,6 +94,35 @@ struct Opcode {
   Enum enum_;
 };
 
+// Whether |options|, a ReadBinaryOptions or a WastParseOptions, allows
+// |opcode|. Opcodes from post-MVP proposals are only allowed when the
+// proposal's --future-* flag is given.
+template <typename Options>
+bool IsOpcodeAllowed(const Options& options, Opcode opcode) {
+  switch (opcode) {
+    case Opcode::ReturnCall:
+    case Opcode::ReturnCallIndirect:
+      return options.allow_future_tail_call;
+
+    default:
+      break;
+  }
+
+  if (!opcode.HasPrefix())
+    return true;
+
+  switch (opcode.GetPrefix()) {
+    case Opcode::kMiscPrefix:
+      return options.allow_future_bulk_memory;
+    case Opcode::kSimdPrefix:
+      return options.allow_future_simd;
+    case Opcode::kThreadsPrefix:
+      return options.allow_future_threads;
+    default:
+      return true;
+  }
+}
+
 }  // end anonymous namespace
 
 #endif  // WABT_OPCODE_H_
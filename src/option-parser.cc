@@ -182,8 +182,9 @@ void OptionParser::Parse(int argc, char* argv[]) {
         const Option& best_option = options_[best_index];
         const char* option_argument = nullptr;
         if (best_option.has_argument) {
-          if (arg[best_length] == '=') {
-            option_argument = &arg[best_length + 1];
+          // |best_length| doesn't include the leading "--".
+          if (arg[2 + best_length] == '=') {
+            option_argument = &arg[2 + best_length + 1];
           } else {
             if (i + 1 == argc || argv[i + 1][0] == '-') {
               Errorf("option '--%s' requires argument",
@@ -0,0 +1,126 @@
+/*
+ * Copyright 2017 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "parallel-for.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace wabt {
+
+namespace {
+
+class ParallelForState {
+ public:
+  ParallelForState(size_t count,
+                   size_t max_ahead,
+                   const std::function<Result(size_t)>& work);
+
+  void Work();
+  // Waits for item |i| to be done, and returns its result.
+  Result Wait(size_t i);
+  // Lets the workers go on past item |i|, or stops them.
+  void Release(size_t i, bool stop);
+
+ private:
+  size_t count_;
+  size_t max_ahead_;
+  const std::function<Result(size_t)>& work_;
+
+  std::mutex mutex_;
+  std::condition_variable item_done_;
+  std::condition_variable item_released_;
+  std::vector<Result> results_;
+  std::vector<bool> is_done_;
+  size_t next_item_ = 0;  // The next item to start.
+  size_t num_released_ = 0;
+  bool stop_ = false;
+};
+
+ParallelForState::ParallelForState(size_t count,
+                                   size_t max_ahead,
+                                   const std::function<Result(size_t)>& work)
+    : count_(count),
+      max_ahead_(max_ahead),
+      work_(work),
+      results_(count, Result::Ok),
+      is_done_(count, false) {}
+
+void ParallelForState::Work() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    item_released_.wait(lock, [this]() {
+      return stop_ || next_item_ == count_ ||
+             next_item_ < num_released_ + max_ahead_;
+    });
+    if (stop_ || next_item_ == count_)
+      return;
+    size_t i = next_item_++;
+    lock.unlock();
+
+    Result result = work_(i);
+
+    lock.lock();
+    results_[i] = result;
+    is_done_[i] = true;
+    item_done_.notify_all();
+  }
+}
+
+Result ParallelForState::Wait(size_t i) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  item_done_.wait(lock, [this, i]() { return static_cast<bool>(is_done_[i]); });
+  return results_[i];
+}
+
+void ParallelForState::Release(size_t i, bool stop) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  num_released_ = i + 1;
+  stop_ = stop;
+  item_released_.notify_all();
+}
+
+}  // end anonymous namespace
+
+Result ParallelForInOrder(size_t count,
+                          int num_threads,
+                          size_t max_ahead,
+                          const std::function<Result(size_t)>& work,
+                          const std::function<Result(size_t, Result)>& done) {
+  ParallelForState state(count, max_ahead, work);
+  std::vector<std::thread> threads;
+  size_t num_workers = std::min(static_cast<size_t>(num_threads), count);
+  for (size_t i = 0; i < num_workers; ++i)
+    threads.emplace_back(&ParallelForState::Work, &state);
+
+  Result result = Result::Ok;
+  for (size_t i = 0; i < count; ++i) {
+    result = done(i, state.Wait(i));
+    bool stop = Failed(result) || i + 1 == count;
+    state.Release(i, stop);
+    if (stop)
+      break;
+  }
+
+  for (std::thread& thread : threads)
+    thread.join();
+  return result;
+}
+
+}  // namespace wabt
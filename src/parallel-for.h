@@ -0,0 +1,40 @@
+/*
+ * Copyright 2017 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef WABT_PARALLEL_FOR_H_
+#define WABT_PARALLEL_FOR_H_
+
+#include <functional>
+
+#include "common.h"
+
+namespace wabt {
+
+// Calls |work|(i) for each i in [0, count) on |num_threads| threads, but no
+// more threads than there are items, and |done|(i, result) for each i in order
+// on the calling thread, as soon as work(i) has returned |result|. At most
+// |max_ahead| items are started before done() has been called for them, so
+// per-item output can be kept until then without holding all of it. Once
+// done() returns an error nothing more is started, and that error is returned.
+Result ParallelForInOrder(size_t count,
+                          int num_threads,
+                          size_t max_ahead,
+                          const std::function<Result(size_t)>& work,
+                          const std::function<Result(size_t, Result)>& done);
+
+}  // namespace wabt
+
+#endif /* WABT_PARALLEL_FOR_H_ */
@@ -33,6 +33,7 @@
 
 #define YYMAXFILL 29
 
+
 #define INITIAL_LEXER_BUFFER_SIZE (64 * 1024)
 
 #define NAME_TO_VALUE(name) WABT_TOKEN_TYPE_##name
@@ -261,7 +262,8 @@ Result WastLexer::Fill(Location* loc, WastParser* parser, size_t need) {
 }
 
 int WastLexer::GetToken(Token* lval, Location* loc, WastParser* parser) {
-#line 265 "src/prebuilt/wast-lexer-gen.cc"
+  
+#line 267 "src/prebuilt/wast-lexer-gen.cc"
 
 enum YYCONDTYPE {
 	YYCOND_i,
@@ -270,7 +272,7 @@ enum YYCONDTYPE {
 	YYCOND_BLOCK_COMMENT,
 };
 
-#line 262 "src/wast-lexer.cc"
+#line 263 "src/wast-lexer.cc"
   YYCONDTYPE cond = YYCOND_i;  // i is the initial state.
 
   if (!lookahead_->tokens_.empty()) {
@@ -282,6361 +284,14452 @@ enum YYCONDTYPE {
   for (;;) {
     next_pos_ = cursor_;
     
-#line 286 "src/prebuilt/wast-lexer-gen.cc"
+#line 288 "src/prebuilt/wast-lexer-gen.cc"
 {
 	unsigned char yych;
 	unsigned int yyaccept = 0;
-	if (cond < 2) {
-		if (cond < 1) {
-			goto YYCOND_i;
+	static const unsigned char yybm[] = {
+		  3,   3,   3,   3,   3,   3,   3,   3, 
+		  3,   3,   0,   3,   3,   3,   3,   3, 
+		  3,   3,   3,   3,   3,   3,   3,   3, 
+		  3,   3,   3,   3,   3,   3,   3,   3, 
+		  7, 255,   1, 255, 255, 255, 255, 253, 
+		  6,   7, 255, 255, 127, 255, 255, 255, 
+		253, 253, 253, 253, 253, 253, 253, 253, 
+		253, 253, 255,   6, 255, 255, 255, 255, 
+		255, 253, 253, 253, 253, 253, 253, 255, 
+		255, 255, 255, 255, 255, 255, 255, 255, 
+		255, 255, 255, 255, 255, 255, 255, 255, 
+		255, 255, 255, 127, 249, 127, 255, 255, 
+		255, 141, 253, 189, 253, 205, 253, 255, 
+		223, 255, 255, 255, 255, 239, 253, 191, 
+		255, 255, 205, 175, 253, 255, 255, 255, 
+		191, 223, 255, 127, 255, 127, 255,   7, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128,   0,   0, 128, 128,   0, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		  0, 127,   0, 127,  63, 127, 127, 127, 
+		  0,   0, 127,  63, 127,  63, 127, 127, 
+		 27,  25,  27,  25,  27,  27,  25,  27, 
+		 25,  27, 127,   0, 127, 127, 127, 127, 
+		127,  95,  95,  95,  95,  95,  95, 127, 
+		127, 127, 127, 127, 127, 127, 127, 127, 
+		127, 127, 127, 127, 127, 127, 127, 127, 
+		127, 127, 127, 127, 127, 127, 127, 127, 
+		127,   7,  31,   7,   7,   6,  21,  39, 
+		127,  62, 127, 127,  39,  36,  37,  47, 
+		 47,  63,  38,  39,  38,  62,  63, 127, 
+		111, 127, 127, 127, 127, 127, 127, 128, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   8,   0,   0,   0,   8,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  8,   0,   2,   0,   0,   0,   0,   2, 
+		  0,   0,   0,   0,   4,   0,   0,   0, 
+		  1,   1,   1,   1,   1,   1,   1,   1, 
+		  1,   1,   0,   0,   0,   0,   0,   0, 
+		  0,   1,   1,   1,   1,   1,   1,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   4,   2,   4,   0,   0, 
+		  0,   1,   1,   1,   1,   1,   1,   0, 
+		  0,   0,   0,   0,   0,   0,   2,   0, 
+		  0,   0,   2,   0,   2,   0,   0,   0, 
+		  0,   0,   0,   4,   0,   4,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+	};
+	switch (cond) {
+	case YYCOND_i:
+		goto YYCOND_i;
+	case YYCOND_BAD_TEXT:
+		goto YYCOND_BAD_TEXT;
+	case YYCOND_LINE_COMMENT:
+		goto YYCOND_LINE_COMMENT;
+	case YYCOND_BLOCK_COMMENT:
+		goto YYCOND_BLOCK_COMMENT;
+	}
+/* *********************************** */
+YYCOND_i:
+	if ((limit_ - cursor_) < 29) FILL(29);
+	yych = *cursor_;
+	if (yybm[256+yych] & 64) {
+		goto yy28;
+	}
+	if (yybm[256+yych] & 128) {
+		goto yy31;
+	}
+	if (yybm[512+yych] & 8) {
+		goto yy27;
+	}
+	if (yych <= 'l') {
+		if (yych <= ';') {
+			if (yych <= '(') {
+				if (yych <= '"') {
+					if (yych <= '\n') goto yy26;
+					goto yy21;
+				} else {
+					if (yych <= '$') goto yy24;
+					goto yy1;
+				}
+			} else {
+				if (yych <= '-') {
+					if (yych == ')') goto yy3;
+					goto yy8;
+				} else {
+					if (yych <= '0') {
+						goto yy4;
+					} else {
+						if (yych <= '9') goto yy5;
+						goto yy25;
+					}
+				}
+			}
 		} else {
-			goto YYCOND_BAD_TEXT;
+			if (yych <= 'd') {
+				if (yych <= 'b') {
+					if (yych == 'b') goto yy14;
+					goto yy22;
+				} else {
+					if (yych == 'c') goto yy29;
+					goto yy18;
+				}
+			} else {
+				if (yych <= 'f') {
+					if (yych == 'e') goto yy17;
+					goto yy7;
+				} else {
+					if (yych <= 'g') {
+						goto yy12;
+					} else {
+						if (yych <= 'i') goto yy2;
+						goto yy11;
+					}
+				}
+			}
 		}
 	} else {
-		if (cond < 3) {
-			goto YYCOND_LINE_COMMENT;
+		if (yych <= 'u') {
+			if (yych <= 'p') {
+				if (yych <= 'n') {
+					if (yych == 'm') goto yy13;
+					goto yy20;
+				} else {
+					if (yych == 'o') goto yy19;
+					goto yy9;
+				}
+			} else {
+				if (yych <= 'r') {
+					if (yych == 'q') goto yy15;
+					goto yy10;
+				} else {
+					if (yych <= 's') {
+						goto yy16;
+					} else {
+						if (yych == 't') goto yy6;
+						goto yy30;
+					}
+				}
+			}
 		} else {
-			goto YYCOND_BLOCK_COMMENT;
+			if (yych <= 0xE0) {
+				if (yych <= 0xC1) {
+					if (yych == 'v') goto yy23;
+					goto yy38;
+				} else {
+					if (yych == 0xE0) goto yy33;
+					goto yy32;
+				}
+			} else {
+				if (yych <= 0xF0) {
+					if (yych == 0xF0) goto yy35;
+					goto yy34;
+				} else {
+					if (yych <= 0xF3) {
+						goto yy36;
+					} else {
+						if (yych == 0xF4) goto yy37;
+						goto yy38;
+					}
+				}
+			}
 		}
 	}
-/* *********************************** */
-YYCOND_BAD_TEXT:
-	if ((limit_ - cursor_) < 5) FILL(5);
+yy1:
+	++cursor_;
 	yych = *cursor_;
-	if (yych <= 0x7F) {
-		if (yych <= '!') {
-			if (yych == '\n') goto yy5;
-			if (yych >= ' ') goto yy7;
+	if (yych == ';') goto yy39;
+	goto yy1451;
+yy2:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[256+yych] & 2) {
+		goto yy28;
+	}
+	if (yych <= '8') {
+		if (yych <= '1') {
+			if (yych <= ')') goto yy1800;
+			goto yy45;
 		} else {
-			if (yych <= '"') goto yy9;
-			if (yych == '\\') goto yy11;
-			goto yy7;
+			if (yych <= '3') {
+				goto yy40;
+			} else {
+				if (yych <= '6') goto yy41;
+				goto yy44;
+			}
 		}
 	} else {
-		if (yych <= 0xEF) {
-			if (yych <= 0xC1) goto yy12;
-			if (yych <= 0xDF) goto yy14;
-			if (yych <= 0xE0) goto yy15;
-			goto yy16;
+		if (yych <= 'f') {
+			if (yych <= ';') goto yy1800;
+			goto yy46;
 		} else {
-			if (yych <= 0xF0) goto yy17;
-			if (yych <= 0xF3) goto yy18;
-			if (yych <= 0xF4) goto yy19;
-			goto yy12;
+			if (yych <= 'm') {
+				goto yy43;
+			} else {
+				if (yych == 'n') goto yy42;
+				goto yy1800;
+			}
 		}
 	}
+yy3:
 	++cursor_;
+	goto yy1452;
 yy4:
-#line 327 "src/wast-lexer.cc"
-	{ ERROR("illegal character in string");
-                                  continue; }
-#line 334 "src/prebuilt/wast-lexer-gen.cc"
-yy5:
 	++cursor_;
-	BEGIN(YYCOND_i);
-#line 320 "src/wast-lexer.cc"
-	{ ERROR("newline in string");
-                                  NEWLINE;
-                                  continue; }
-#line 342 "src/prebuilt/wast-lexer-gen.cc"
-yy7:
+	yych = *cursor_;
+	if (yych == '.') goto yy48;
+	if (yych == 'E') goto yy49;
+	if (yych == 'e') goto yy49;
+	if (yych == 'x') goto yy47;
+	if (yybm[256+yych] & 4) {
+		goto yy28;
+	}
+	if (yych <= ')') {
+		goto yy1453;
+	} else {
+		if (yych <= '9') goto yy5;
+		goto yy1453;
+	}
+yy5:
 	++cursor_;
-#line 319 "src/wast-lexer.cc"
-	{ continue; }
-#line 347 "src/prebuilt/wast-lexer-gen.cc"
-yy9:
+	if ((limit_ - cursor_) < 3) FILL(3);
+	yych = *cursor_;
+	if (yych == '.') goto yy48;
+	if (yych == 'E') goto yy49;
+	if (yych == 'e') goto yy49;
+	if (yybm[256+yych] & 4) {
+		goto yy28;
+	}
+	if (yych <= ')') {
+		goto yy1453;
+	} else {
+		if (yych <= '9') goto yy5;
+		goto yy1453;
+	}
+yy6:
 	++cursor_;
-	BEGIN(YYCOND_i);
-#line 326 "src/wast-lexer.cc"
-	{ SetText(); RETURN(TEXT); }
-#line 353 "src/prebuilt/wast-lexer-gen.cc"
-yy11:
-	yyaccept = 0;
-	yych = *(marker_ = ++cursor_);
-	if (yych <= 'f') {
-		if (yych <= '/') {
-			if (yych <= '!') {
-				if (yych == '\n') goto yy4;
-				goto yy20;
-			} else {
-				if (yych <= '"') goto yy7;
-				if (yych == '\'') goto yy7;
-				goto yy20;
-			}
+	yych = *cursor_;
+	if (yybm[0+yych] & 32) {
+		goto yy28;
+	}
+	if (yych <= 'e') {
+		if (yych <= ';') {
+			goto yy1800;
 		} else {
-			if (yych <= 'F') {
-				if (yych <= '9') goto yy22;
-				if (yych <= '@') goto yy20;
-				goto yy22;
-			} else {
-				if (yych == '\\') goto yy7;
-				if (yych <= '`') goto yy20;
-				goto yy22;
-			}
+			if (yych <= 'a') goto yy51;
+			goto yy52;
 		}
 	} else {
-		if (yych <= 0x7F) {
-			if (yych <= 'q') {
-				if (yych == 'n') goto yy7;
-				goto yy20;
-			} else {
-				if (yych == 's') goto yy20;
-				if (yych <= 't') goto yy7;
-				goto yy20;
-			}
+		if (yych <= 'r') {
+			if (yych <= 'h') goto yy50;
+			goto yy53;
 		} else {
-			if (yych <= 0xEF) {
-				if (yych <= 0xC1) goto yy4;
-				if (yych <= 0xDF) goto yy23;
-				if (yych <= 0xE0) goto yy25;
-				goto yy26;
-			} else {
-				if (yych <= 0xF0) goto yy27;
-				if (yych <= 0xF3) goto yy28;
-				if (yych <= 0xF4) goto yy29;
-				goto yy4;
-			}
+			if (yych <= 'y') goto yy54;
+			goto yy1800;
 		}
 	}
+yy7:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '3') goto yy55;
+	if (yych == '6') goto yy56;
+	if (yych == 'u') goto yy57;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy8:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'i') goto yy60;
+	if (yych == 'n') goto yy61;
+	if (yybm[256+yych] & 4) {
+		goto yy28;
+	}
+	if (yych <= '0') {
+		if (yych <= ')') goto yy1800;
+		goto yy58;
+	} else {
+		if (yych <= '9') goto yy59;
+		goto yy1800;
+	}
+yy9:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy62;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy10:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy63;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy11:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'o') goto yy64;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy12:
 	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy65;
+	if (yych == 'l') goto yy67;
+	if (yych == 'r') goto yy66;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy13:
-#line 329 "src/wast-lexer.cc"
-	{ MAYBE_MALFORMED_UTF8(" in string"); }
-#line 407 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy68;
+	if (yych == 'o') goto yy70;
+	if (yych == 'u') goto yy69;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy14:
-	yych = *++cursor_;
-	if (yych <= 0x7F) goto yy13;
-	if (yych <= 0xBF) goto yy7;
-	goto yy13;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'i') goto yy72;
+	if (yych == 'l') goto yy73;
+	if (yych == 'r') goto yy71;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy15:
-	yyaccept = 1;
-	yych = *(marker_ = ++cursor_);
-	if (yych <= 0x9F) goto yy13;
-	if (yych <= 0xBF) goto yy30;
-	goto yy13;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'u') goto yy74;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy16:
-	yyaccept = 1;
-	yych = *(marker_ = ++cursor_);
-	if (yych <= 0x7F) goto yy13;
-	if (yych <= 0xBF) goto yy30;
-	goto yy13;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy75;
+	if (yych == 'h') goto yy77;
+	if (yych == 't') goto yy76;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy17:
-	yyaccept = 1;
-	yych = *(marker_ = ++cursor_);
-	if (yych <= 0x8F) goto yy13;
-	if (yych <= 0xBF) goto yy31;
-	goto yy13;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy78;
+	if (yych == 'n') goto yy80;
+	if (yych == 'x') goto yy79;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy18:
-	yyaccept = 1;
-	yych = *(marker_ = ++cursor_);
-	if (yych <= 0x7F) goto yy13;
-	if (yych <= 0xBF) goto yy31;
-	goto yy13;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy82;
+	if (yych == 'r') goto yy81;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy19:
-	yyaccept = 1;
-	yych = *(marker_ = ++cursor_);
-	if (yych <= 0x7F) goto yy13;
-	if (yych <= 0x8F) goto yy31;
-	goto yy13;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'f') goto yy83;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy20:
 	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy84;
+	if (yych == 'o') goto yy85;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy21:
-#line 323 "src/wast-lexer.cc"
-	{ ERROR("bad escape \"%.*s\"",
-                                        static_cast<int>(yyleng), yytext);
-                                  continue; }
-#line 450 "src/prebuilt/wast-lexer-gen.cc"
-yy22:
-	yych = *++cursor_;
-	if (yych <= '@') {
-		if (yych <= '/') goto yy21;
-		if (yych <= '9') goto yy7;
-		goto yy21;
+	++cursor_;
+	yyaccept = 0;
+	marker_ = cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 4) {
+		goto yy88;
+	}
+	if (yych <= 0xDF) {
+		if (yych <= '"') {
+			if (yych <= 0x1F) goto yy1460;
+			goto yy87;
+		} else {
+			if (yych <= '\\') {
+				goto yy86;
+			} else {
+				if (yych <= 0xC1) goto yy1460;
+				goto yy89;
+			}
+		}
 	} else {
-		if (yych <= 'F') goto yy7;
-		if (yych <= '`') goto yy21;
-		if (yych <= 'f') goto yy7;
-		goto yy21;
+		if (yych <= 0xF0) {
+			if (yych <= 0xE0) {
+				goto yy90;
+			} else {
+				if (yych == 0xF0) goto yy92;
+				goto yy91;
+			}
+		} else {
+			if (yych <= 0xF3) {
+				goto yy93;
+			} else {
+				if (yych == 0xF4) goto yy94;
+				goto yy1460;
+			}
+		}
+	}
+yy22:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy96;
+	if (yych == 'n') goto yy97;
+	if (yych == 's') goto yy95;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
 	}
+	goto yy1800;
 yy23:
-	yych = *++cursor_;
-	if (yych <= 0x7F) goto yy24;
-	if (yych <= 0xBF) goto yy20;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '1') goto yy98;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy24:
-	cursor_ = marker_;
-	if (yyaccept == 0) {
-		goto yy4;
-	} else {
-		goto yy13;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 128) {
+		goto yy99;
 	}
+	if (yybm[512+yych] & 4) {
+		goto yy28;
+	}
+	goto yy1800;
 yy25:
-	yych = *++cursor_;
-	if (yych <= 0x9F) goto yy24;
-	if (yych <= 0xBF) goto yy23;
-	goto yy24;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == ';') goto yy100;
+	goto yy1801;
 yy26:
-	yych = *++cursor_;
-	if (yych <= 0x7F) goto yy24;
-	if (yych <= 0xBF) goto yy23;
-	goto yy24;
+	++cursor_;
+	goto yy1798;
 yy27:
-	yych = *++cursor_;
-	if (yych <= 0x8F) goto yy24;
-	if (yych <= 0xBF) goto yy26;
-	goto yy24;
+	++cursor_;
+	if (limit_ <= cursor_) FILL(1);
+	yych = *cursor_;
+	if (yybm[512+yych] & 8) {
+		goto yy27;
+	}
+	goto yy1799;
 yy28:
-	yych = *++cursor_;
-	if (yych <= 0x7F) goto yy24;
-	if (yych <= 0xBF) goto yy26;
-	goto yy24;
+	++cursor_;
+	if (limit_ <= cursor_) FILL(1);
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy29:
-	yych = *++cursor_;
-	if (yych <= 0x7F) goto yy24;
-	if (yych <= 0x8F) goto yy26;
-	goto yy24;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy101;
+	if (yych == 'u') goto yy102;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy30:
-	yych = *++cursor_;
-	if (yych <= 0x7F) goto yy24;
-	if (yych <= 0xBF) goto yy7;
-	goto yy24;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'n') goto yy103;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy31:
 	++cursor_;
-	if ((yych = *cursor_) <= 0x7F) goto yy24;
-	if (yych <= 0xBF) goto yy30;
-	goto yy24;
-/* *********************************** */
-YYCOND_BLOCK_COMMENT:
-	if ((limit_ - cursor_) < 4) FILL(4);
+	goto yy1801;
+yy32:
+	++cursor_;
 	yych = *cursor_;
 	if (yych <= 0x7F) {
-		if (yych <= '\'') {
-			if (yych == '\n') goto yy36;
-		} else {
-			if (yych <= '(') goto yy38;
-			if (yych == ';') goto yy39;
-		}
+		goto yy1802;
 	} else {
-		if (yych <= 0xEF) {
-			if (yych <= 0xC1) goto yy40;
-			if (yych <= 0xDF) goto yy42;
-			if (yych <= 0xE0) goto yy43;
-			goto yy44;
-		} else {
-			if (yych <= 0xF0) goto yy45;
-			if (yych <= 0xF3) goto yy46;
-			if (yych <= 0xF4) goto yy47;
-			goto yy40;
-		}
+		if (yych <= 0xBF) goto yy31;
+		goto yy1802;
+	}
+yy33:
+	++cursor_;
+	yyaccept = 1;
+	marker_ = cursor_;
+	yych = *cursor_;
+	if (yych <= 0x9F) {
+		goto yy1802;
+	} else {
+		if (yych <= 0xBF) goto yy104;
+		goto yy1802;
 	}
 yy34:
 	++cursor_;
+	yyaccept = 1;
+	marker_ = cursor_;
+	yych = *cursor_;
+	if (yych <= 0x7F) {
+		goto yy1802;
+	} else {
+		if (yych <= 0xBF) goto yy104;
+		goto yy1802;
+	}
 yy35:
-#line 558 "src/wast-lexer.cc"
-	{ continue; }
-#line 538 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yyaccept = 1;
+	marker_ = cursor_;
+	yych = *cursor_;
+	if (yych <= 0x8F) {
+		goto yy1802;
+	} else {
+		if (yych <= 0xBF) goto yy105;
+		goto yy1802;
+	}
 yy36:
 	++cursor_;
-#line 557 "src/wast-lexer.cc"
-	{ NEWLINE; continue; }
-#line 543 "src/prebuilt/wast-lexer-gen.cc"
+	yyaccept = 1;
+	marker_ = cursor_;
+	yych = *cursor_;
+	if (yych <= 0x7F) {
+		goto yy1802;
+	} else {
+		if (yych <= 0xBF) goto yy105;
+		goto yy1802;
+	}
+yy37:
+	++cursor_;
+	yyaccept = 1;
+	marker_ = cursor_;
+	yych = *cursor_;
+	if (yych <= 0x7F) {
+		goto yy1802;
+	} else {
+		if (yych <= 0x8F) goto yy105;
+		goto yy1802;
+	}
 yy38:
-	yych = *++cursor_;
-	if (yych == ';') goto yy48;
-	goto yy35;
+	++cursor_;
+	goto yy1802;
 yy39:
-	yych = *++cursor_;
-	if (yych == ')') goto yy50;
-	goto yy35;
+	++cursor_;
+	goto yy1797;
 yy40:
 	++cursor_;
+	yych = *cursor_;
+	if (yych == '2') goto yy106;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy41:
-#line 559 "src/wast-lexer.cc"
-	{ MAYBE_MALFORMED_UTF8(" in block comment"); }
-#line 557 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '4') goto yy107;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy42:
-	yych = *++cursor_;
-	if (yych <= 0x7F) goto yy41;
-	if (yych <= 0xBF) goto yy34;
-	goto yy41;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'f') goto yy108;
+	if (yych == 'v') goto yy109;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy43:
-	yych = *(marker_ = ++cursor_);
-	if (yych <= 0x9F) goto yy41;
-	if (yych <= 0xBF) goto yy52;
-	goto yy41;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'p') goto yy110;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy44:
-	yych = *(marker_ = ++cursor_);
-	if (yych <= 0x7F) goto yy41;
-	if (yych <= 0xBF) goto yy52;
-	goto yy41;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'x') goto yy111;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy45:
-	yych = *(marker_ = ++cursor_);
-	if (yych <= 0x8F) goto yy41;
-	if (yych <= 0xBF) goto yy54;
-	goto yy41;
-yy46:
-	yych = *(marker_ = ++cursor_);
-	if (yych <= 0x7F) goto yy41;
-	if (yych <= 0xBF) goto yy54;
-	goto yy41;
-yy47:
-	yych = *(marker_ = ++cursor_);
-	if (yych <= 0x7F) goto yy41;
-	if (yych <= 0x8F) goto yy54;
-	goto yy41;
-yy48:
 	++cursor_;
-#line 553 "src/wast-lexer.cc"
-	{ COMMENT_NESTING++; continue; }
-#line 592 "src/prebuilt/wast-lexer-gen.cc"
+	yych = *cursor_;
+	if (yych == '6') goto yy112;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy46:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1470;
+yy47:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[256+yych] & 32) {
+		goto yy28;
+	}
+	if (yybm[512+yych] & 1) {
+		goto yy113;
+	}
+	goto yy1800;
+yy48:
+	++cursor_;
+	if ((limit_ - cursor_) < 3) FILL(3);
+	yych = *cursor_;
+	if (yych == 'E') goto yy49;
+	if (yych == 'e') goto yy49;
+	if (yybm[256+yych] & 4) {
+		goto yy28;
+	}
+	if (yych <= ')') {
+		goto yy1455;
+	} else {
+		if (yych <= '9') goto yy48;
+		goto yy1455;
+	}
+yy49:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '+') goto yy114;
+	if (yych == '-') goto yy114;
+	if (yybm[256+yych] & 4) {
+		goto yy28;
+	}
+	if (yych <= ')') {
+		goto yy1800;
+	} else {
+		if (yych <= '9') goto yy115;
+		goto yy1800;
+	}
 yy50:
 	++cursor_;
-#line 554 "src/wast-lexer.cc"
-	{ if (--COMMENT_NESTING == 0)
-                                    BEGIN(YYCOND_i);
-                                  continue; }
-#line 599 "src/prebuilt/wast-lexer-gen.cc"
+	yych = *cursor_;
+	if (yych == 'e') goto yy116;
+	if (yych == 'r') goto yy117;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy51:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'b') goto yy118;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy52:
-	yych = *++cursor_;
-	if (yych <= 0x7F) goto yy53;
-	if (yych <= 0xBF) goto yy34;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy119;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy53:
-	cursor_ = marker_;
-	goto yy41;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'y') goto yy120;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy54:
 	++cursor_;
-	if ((yych = *cursor_) <= 0x7F) goto yy53;
-	if (yych <= 0xBF) goto yy52;
-	goto yy53;
-/* *********************************** */
-YYCOND_LINE_COMMENT:
-	{
-		static const unsigned char yybm[] = {
-			128, 128, 128, 128, 128, 128, 128, 128, 
-			128, 128,   0, 128, 128, 128, 128, 128, 
-			128, 128, 128, 128, 128, 128, 128, 128, 
-			128, 128, 128, 128, 128, 128, 128, 128, 
-			128, 128, 128, 128, 128, 128, 128, 128, 
-			128, 128, 128, 128, 128, 128, 128, 128, 
-			128, 128, 128, 128, 128, 128, 128, 128, 
-			128, 128, 128, 128, 128, 128, 128, 128, 
-			128, 128, 128, 128, 128, 128, 128, 128, 
-			128, 128, 128, 128, 128, 128, 128, 128, 
-			128, 128, 128, 128, 128, 128, 128, 128, 
-			128, 128, 128, 128, 128, 128, 128, 128, 
-			128, 128, 128, 128, 128, 128, 128, 128, 
-			128, 128, 128, 128, 128, 128, 128, 128, 
-			128, 128, 128, 128, 128, 128, 128, 128, 
-			128, 128, 128, 128, 128, 128, 128, 128, 
-			  0,   0,   0,   0,   0,   0,   0,   0, 
-			  0,   0,   0,   0,   0,   0,   0,   0, 
-			  0,   0,   0,   0,   0,   0,   0,   0, 
-			  0,   0,   0,   0,   0,   0,   0,   0, 
-			  0,   0,   0,   0,   0,   0,   0,   0, 
-			  0,   0,   0,   0,   0,   0,   0,   0, 
-			  0,   0,   0,   0,   0,   0,   0,   0, 
-			  0,   0,   0,   0,   0,   0,   0,   0, 
-			  0,   0,   0,   0,   0,   0,   0,   0, 
-			  0,   0,   0,   0,   0,   0,   0,   0, 
-			  0,   0,   0,   0,   0,   0,   0,   0, 
-			  0,   0,   0,   0,   0,   0,   0,   0, 
-			  0,   0,   0,   0,   0,   0,   0,   0, 
-			  0,   0,   0,   0,   0,   0,   0,   0, 
-			  0,   0,   0,   0,   0,   0,   0,   0, 
-			  0,   0,   0,   0,   0,   0,   0,   0, 
-		};
-		if ((limit_ - cursor_) < 2) FILL(2);
-		yych = *cursor_;
-		if (yybm[0+yych] & 128) {
-			goto yy57;
-		}
-		if (yych <= 0xE0) {
-			if (yych <= '\n') goto yy60;
-			if (yych <= 0xC1) goto yy62;
-			if (yych <= 0xDF) goto yy64;
-			goto yy65;
-		} else {
-			if (yych <= 0xF0) {
-				if (yych <= 0xEF) goto yy66;
-				goto yy67;
-			} else {
-				if (yych <= 0xF3) goto yy68;
-				if (yych <= 0xF4) goto yy69;
-				goto yy62;
-			}
-		}
+	yych = *cursor_;
+	if (yych == 'p') goto yy121;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy55:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '2') goto yy122;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy56:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '4') goto yy123;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy57:
-		yyaccept = 0;
-		marker_ = ++cursor_;
-		if (limit_ <= cursor_) FILL(1);
-		yych = *cursor_;
-		if (yybm[0+yych] & 128) {
-			goto yy57;
-		}
-		if (yych <= 0xEF) {
-			if (yych <= 0xC1) goto yy59;
-			if (yych <= 0xDF) goto yy70;
-			if (yych <= 0xE0) goto yy72;
-			goto yy73;
-		} else {
-			if (yych <= 0xF0) goto yy74;
-			if (yych <= 0xF3) goto yy75;
-			if (yych <= 0xF4) goto yy76;
-		}
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'n') goto yy124;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy58:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '.') goto yy48;
+	if (yych == 'E') goto yy49;
+	if (yych == 'e') goto yy49;
+	if (yych == 'x') goto yy125;
+	if (yybm[256+yych] & 4) {
+		goto yy28;
+	}
+	if (yych <= ')') {
+		goto yy1454;
+	} else {
+		if (yych <= '9') goto yy59;
+		goto yy1454;
+	}
 yy59:
-#line 551 "src/wast-lexer.cc"
-		{ continue; }
-#line 690 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	if ((limit_ - cursor_) < 3) FILL(3);
+	yych = *cursor_;
+	if (yych == '.') goto yy48;
+	if (yych == 'E') goto yy49;
+	if (yych == 'e') goto yy49;
+	if (yybm[256+yych] & 4) {
+		goto yy28;
+	}
+	if (yych <= ')') {
+		goto yy1454;
+	} else {
+		if (yych <= '9') goto yy59;
+		goto yy1454;
+	}
 yy60:
-		++cursor_;
-		BEGIN(YYCOND_i);
-#line 550 "src/wast-lexer.cc"
-		{ NEWLINE; continue; }
-#line 696 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'n') goto yy126;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy61:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy84;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy62:
-		++cursor_;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy127;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy63:
-#line 566 "src/wast-lexer.cc"
-		{ MAYBE_MALFORMED_UTF8(""); }
-#line 702 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'g') goto yy129;
+	if (yych == 's') goto yy130;
+	if (yych == 't') goto yy128;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy64:
-		yych = *++cursor_;
-		if (yych <= 0x7F) goto yy63;
-		if (yych <= 0xBF) goto yy57;
-		goto yy63;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'c') goto yy131;
+	if (yych == 'o') goto yy132;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy65:
-		yyaccept = 1;
-		yych = *(marker_ = ++cursor_);
-		if (yych <= 0x9F) goto yy63;
-		if (yych <= 0xBF) goto yy70;
-		goto yy63;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy133;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy66:
-		yyaccept = 1;
-		yych = *(marker_ = ++cursor_);
-		if (yych <= 0x7F) goto yy63;
-		if (yych <= 0xBF) goto yy70;
-		goto yy63;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'o') goto yy134;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy67:
-		yyaccept = 1;
-		yych = *(marker_ = ++cursor_);
-		if (yych <= 0x8F) goto yy63;
-		if (yych <= 0xBF) goto yy73;
-		goto yy63;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'o') goto yy135;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy68:
-		yyaccept = 1;
-		yych = *(marker_ = ++cursor_);
-		if (yych <= 0x7F) goto yy63;
-		if (yych <= 0xBF) goto yy73;
-		goto yy63;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'm') goto yy136;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy69:
-		yyaccept = 1;
-		yych = *(marker_ = ++cursor_);
-		if (yych <= 0x7F) goto yy63;
-		if (yych <= 0x8F) goto yy73;
-		goto yy63;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy137;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy70:
-		++cursor_;
-		if (limit_ <= cursor_) FILL(1);
-		yych = *cursor_;
-		if (yych <= 0x7F) goto yy71;
-		if (yych <= 0xBF) goto yy57;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'd') goto yy138;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy71:
-		cursor_ = marker_;
-		if (yyaccept == 0) {
-			goto yy59;
-		} else {
-			goto yy63;
-		}
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '_') goto yy139;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1474;
 yy72:
-		++cursor_;
-		if (limit_ <= cursor_) FILL(1);
-		yych = *cursor_;
-		if (yych <= 0x9F) goto yy71;
-		if (yych <= 0xBF) goto yy70;
-		goto yy71;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'n') goto yy140;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy73:
-		++cursor_;
-		if (limit_ <= cursor_) FILL(1);
-		yych = *cursor_;
-		if (yych <= 0x7F) goto yy71;
-		if (yych <= 0xBF) goto yy70;
-		goto yy71;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'o') goto yy141;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy74:
-		++cursor_;
-		if (limit_ <= cursor_) FILL(1);
-		yych = *cursor_;
-		if (yych <= 0x8F) goto yy71;
-		if (yych <= 0xBF) goto yy73;
-		goto yy71;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'o') goto yy142;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy75:
-		++cursor_;
-		if (limit_ <= cursor_) FILL(1);
-		yych = *cursor_;
-		if (yych <= 0x7F) goto yy71;
-		if (yych <= 0xBF) goto yy73;
-		goto yy71;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy144;
+	if (yych == 't') goto yy143;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy76:
-		++cursor_;
-		if (limit_ <= cursor_) FILL(1);
-		yych = *cursor_;
-		if (yych <= 0x7F) goto yy71;
-		if (yych <= 0x8F) goto yy73;
-		goto yy71;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy145;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
 	}
-/* *********************************** */
-YYCOND_i:
-	{
-		static const unsigned char yybm[] = {
-			  0,   0,   0,   0,   0,   0,   0,   0, 
-			  0,   4,   0,   0,   0,   4,   0,   0, 
-			  0,   0,   0,   0,   0,   0,   0,   0, 
-			  0,   0,   0,   0,   0,   0,   0,   0, 
-			 36, 104,   0, 104, 104, 104, 104, 104, 
-			 32,  32, 104, 104,  40, 104, 104, 104, 
-			248, 248, 248, 248, 248, 248, 248, 248, 
-			248, 248, 104,  32, 104, 104, 104, 104, 
-			104, 232, 232, 232, 232, 232, 232, 104, 
-			104, 104, 104, 104, 104, 104, 104, 104, 
-			104, 104, 104, 104, 104, 104, 104, 104, 
-			104, 104, 104,  40,  72,  40, 104, 104, 
-			104, 232, 232, 232, 232, 232, 232, 104, 
-			104, 104, 104, 104, 104, 104, 104, 104, 
-			104, 104, 104, 104, 104, 104, 104, 104, 
-			104, 104, 104,  40, 104,  40, 104,  32, 
-			  0,   0,   0,   0,   0,   0,   0,   0, 
-			  0,   0,   0,   0,   0,   0,   0,   0, 
-			  0,   0,   0,   0,   0,   0,   0,   0, 
-			  0,   0,   0,   0,   0,   0,   0,   0, 
-			  0,   0,   0,   0,   0,   0,   0,   0, 
-			  0,   0,   0,   0,   0,   0,   0,   0, 
-			  0,   0,   0,   0,   0,   0,   0,   0, 
-			  0,   0,   0,   0,   0,   0,   0,   0, 
-			  0,   0,   0,   0,   0,   0,   0,   0, 
-			  0,   0,   0,   0,   0,   0,   0,   0, 
-			  0,   0,   0,   0,   0,   0,   0,   0, 
-			  0,   0,   0,   0,   0,   0,   0,   0, 
-			  0,   0,   0,   0,   0,   0,   0,   0, 
-			  0,   0,   0,   0,   0,   0,   0,   0, 
-			  0,   0,   0,   0,   0,   0,   0,   0, 
-			  0,   0,   0,   0,   0,   0,   0,   0, 
-		};
-		if ((limit_ - cursor_) < 29) FILL(29);
-		yych = *cursor_;
-		if (yybm[0+yych] & 4) {
-			goto yy81;
-		}
-		if (yych <= 'e') {
-			if (yych <= '+') {
-				if (yych <= '#') {
-					if (yych <= 0x1F) {
-						if (yych <= 0x08) goto yy79;
-						if (yych <= '\n') goto yy84;
-					} else {
-						if (yych == '"') goto yy89;
-						goto yy86;
-					}
-				} else {
-					if (yych <= '(') {
-						if (yych <= '$') goto yy91;
-						if (yych <= '\'') goto yy86;
-						goto yy92;
-					} else {
-						if (yych <= ')') goto yy94;
-						if (yych <= '*') goto yy86;
-						goto yy96;
-					}
-				}
-			} else {
-				if (yych <= ':') {
-					if (yych <= '/') {
-						if (yych == '-') goto yy96;
-						goto yy86;
-					} else {
-						if (yych <= '0') goto yy97;
-						if (yych <= '9') goto yy99;
-						goto yy86;
-					}
-				} else {
-					if (yych <= 'a') {
-						if (yych <= ';') goto yy101;
-						if (yych <= '`') goto yy86;
-						goto yy102;
-					} else {
-						if (yych <= 'b') goto yy103;
-						if (yych <= 'c') goto yy104;
-						if (yych <= 'd') goto yy105;
-						goto yy106;
-					}
-				}
-			}
-		} else {
-			if (yych <= 'r') {
-				if (yych <= 'l') {
-					if (yych <= 'h') {
-						if (yych <= 'f') goto yy107;
-						if (yych <= 'g') goto yy108;
-						goto yy86;
-					} else {
-						if (yych <= 'i') goto yy109;
-						if (yych <= 'k') goto yy86;
-						goto yy110;
-					}
-				} else {
-					if (yych <= 'o') {
-						if (yych <= 'm') goto yy111;
-						if (yych <= 'n') goto yy112;
-						goto yy113;
-					} else {
-						if (yych <= 'p') goto yy114;
-						if (yych <= 'q') goto yy115;
-						goto yy116;
-					}
-				}
-			} else {
-				if (yych <= 0xC1) {
-					if (yych <= 'u') {
-						if (yych <= 's') goto yy117;
-						if (yych <= 't') goto yy118;
-						goto yy119;
-					} else {
-						if (yych <= '~') goto yy86;
-						if (yych >= 0x80) goto yy120;
-					}
-				} else {
-					if (yych <= 0xEF) {
-						if (yych <= 0xDF) goto yy122;
-						if (yych <= 0xE0) goto yy123;
-						goto yy124;
-					} else {
-						if (yych <= 0xF0) goto yy125;
-						if (yych <= 0xF3) goto yy126;
-						if (yych <= 0xF4) goto yy127;
-						goto yy120;
-					}
-				}
-			}
-		}
+	goto yy1800;
+yy77:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy146;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy78:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy148;
+	if (yych == 's') goto yy147;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy79:
-		++cursor_;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'c') goto yy150;
+	if (yych == 'p') goto yy149;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy80:
-#line 565 "src/wast-lexer.cc"
-		{ ERROR("unexpected char"); continue; }
-#line 925 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'd') goto yy151;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy81:
-		++cursor_;
-		if (limit_ <= cursor_) FILL(1);
-		yych = *cursor_;
-		if (yybm[0+yych] & 4) {
-			goto yy81;
-		}
-#line 561 "src/wast-lexer.cc"
-		{ continue; }
-#line 935 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'o') goto yy152;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy82:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy153;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy83:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'f') goto yy154;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy84:
-		++cursor_;
-#line 560 "src/wast-lexer.cc"
-		{ NEWLINE; continue; }
-#line 940 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'n') goto yy155;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy85:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'p') goto yy156;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy86:
-		++cursor_;
-		if (limit_ <= cursor_) FILL(1);
-		yych = *cursor_;
+	++cursor_;
+	if (limit_ <= cursor_) FILL(1);
+	yych = *cursor_;
+	if (yybm[512+yych] & 1) {
+		goto yy157;
+	}
+	if (yybm[512+yych] & 2) {
+		goto yy88;
+	}
+	goto yyback_i;
 yy87:
-		if (yybm[0+yych] & 8) {
-			goto yy86;
-		}
+	++cursor_;
+	goto yy1459;
 yy88:
-#line 562 "src/wast-lexer.cc"
-		{ ERROR("unexpected token \"%.*s\"",
-                                        static_cast<int>(yyleng), yytext);
-                                  continue; }
-#line 954 "src/prebuilt/wast-lexer-gen.cc"
-yy89:
-		yyaccept = 0;
-		yych = *(marker_ = ++cursor_);
-		if (yych <= 0x1F) goto yy90;
-		if (yych <= 0x7F) goto yy129;
-		if (yych <= 0xC1) goto yy90;
-		if (yych <= 0xF4) goto yy129;
-yy90:
-		BEGIN(YYCOND_BAD_TEXT);
-#line 318 "src/wast-lexer.cc"
-		{ continue; }
-#line 966 "src/prebuilt/wast-lexer-gen.cc"
-yy91:
-		yych = *++cursor_;
-		if (yych <= '\'') {
-			if (yych == '!') goto yy141;
-			if (yych <= '"') goto yy88;
-			goto yy141;
-		} else {
-			if (yych <= ':') {
-				if (yych <= ')') goto yy88;
-				goto yy141;
-			} else {
-				if (yych <= ';') goto yy88;
-				if (yych <= '~') goto yy141;
-				goto yy88;
-			}
-		}
-yy92:
-		++cursor_;
-		if ((yych = *cursor_) == ';') goto yy143;
-#line 309 "src/wast-lexer.cc"
-		{ LOOKAHEAD(LPAR); }
-#line 988 "src/prebuilt/wast-lexer-gen.cc"
-yy94:
-		++cursor_;
-#line 310 "src/wast-lexer.cc"
-		{ RETURN(RPAR); }
-#line 993 "src/prebuilt/wast-lexer-gen.cc"
-yy96:
-		yych = *++cursor_;
-		if (yych <= 'h') {
-			if (yych <= '/') goto yy87;
-			if (yych <= '0') goto yy145;
-			if (yych <= '9') goto yy147;
-			goto yy87;
-		} else {
-			if (yych <= 'i') goto yy149;
-			if (yych == 'n') goto yy150;
+	++cursor_;
+	if (limit_ <= cursor_) FILL(1);
+	yych = *cursor_;
+	if (yybm[0+yych] & 4) {
+		goto yy88;
+	}
+	if (yych <= 0xDF) {
+		if (yych <= '"') {
+			if (yych <= 0x1F) goto yyback_i;
 			goto yy87;
-		}
-yy97:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 16) {
-			goto yy99;
-		}
-		if (yych <= ':') {
-			if (yych <= '\'') {
-				if (yych == '!') goto yy86;
-				if (yych >= '#') goto yy86;
-			} else {
-				if (yych <= ')') goto yy98;
-				if (yych == '.') goto yy151;
-				goto yy86;
-			}
 		} else {
-			if (yych <= 'd') {
-				if (yych <= ';') goto yy98;
-				if (yych == 'E') goto yy154;
+			if (yych <= '\\') {
 				goto yy86;
 			} else {
-				if (yych <= 'w') {
-					if (yych <= 'e') goto yy154;
-					goto yy86;
-				} else {
-					if (yych <= 'x') goto yy155;
-					if (yych <= '~') goto yy86;
-				}
+				if (yych <= 0xC1) goto yyback_i;
+				goto yy89;
 			}
 		}
-yy98:
-#line 311 "src/wast-lexer.cc"
-		{ LITERAL(Int); RETURN(NAT); }
-#line 1038 "src/prebuilt/wast-lexer-gen.cc"
-yy99:
-		++cursor_;
-		if ((limit_ - cursor_) < 3) FILL(3);
-		yych = *cursor_;
-		if (yybm[0+yych] & 16) {
-			goto yy99;
-		}
-		if (yych <= '.') {
-			if (yych <= '"') {
-				if (yych == '!') goto yy86;
-				goto yy98;
+	} else {
+		if (yych <= 0xF0) {
+			if (yych <= 0xE0) {
+				goto yy90;
 			} else {
-				if (yych <= '\'') goto yy86;
-				if (yych <= ')') goto yy98;
-				if (yych <= '-') goto yy86;
-				goto yy151;
+				if (yych == 0xF0) goto yy92;
+				goto yy91;
 			}
 		} else {
-			if (yych <= 'E') {
-				if (yych == ';') goto yy98;
-				if (yych <= 'D') goto yy86;
-				goto yy154;
+			if (yych <= 0xF3) {
+				goto yy93;
 			} else {
-				if (yych == 'e') goto yy154;
-				if (yych <= '~') goto yy86;
-				goto yy98;
+				if (yych == 0xF4) goto yy94;
+				goto yyback_i;
 			}
 		}
-yy101:
-		yych = *++cursor_;
-		if (yych == ';') goto yy156;
-		goto yy80;
-yy102:
-		yych = *++cursor_;
-		if (yych <= 'm') {
-			if (yych == 'l') goto yy158;
-			goto yy87;
-		} else {
-			if (yych <= 'n') goto yy159;
-			if (yych == 's') goto yy160;
-			goto yy87;
-		}
-yy103:
-		yych = *++cursor_;
-		if (yych <= 'k') {
-			if (yych == 'i') goto yy161;
-			goto yy87;
-		} else {
-			if (yych <= 'l') goto yy162;
-			if (yych == 'r') goto yy163;
-			goto yy87;
-		}
-yy104:
-		yych = *++cursor_;
-		if (yych == 'a') goto yy165;
-		if (yych == 'u') goto yy166;
-		goto yy87;
-yy105:
-		yych = *++cursor_;
-		if (yych == 'a') goto yy167;
-		if (yych == 'r') goto yy168;
-		goto yy87;
-yy106:
-		yych = *++cursor_;
-		if (yych <= 'm') {
-			if (yych == 'l') goto yy169;
-			goto yy87;
-		} else {
-			if (yych <= 'n') goto yy170;
-			if (yych == 'x') goto yy171;
-			goto yy87;
-		}
-yy107:
-		yych = *++cursor_;
-		if (yych <= '5') {
-			if (yych == '3') goto yy172;
-			goto yy87;
-		} else {
-			if (yych <= '6') goto yy173;
-			if (yych == 'u') goto yy174;
-			goto yy87;
-		}
+	}
+yy89:
+	++cursor_;
+	if (limit_ <= cursor_) FILL(1);
+	yych = *cursor_;
+	if (yych <= 0x7F) {
+		goto yyback_i;
+	} else {
+		if (yych <= 0xBF) goto yy88;
+		goto yyback_i;
+	}
+yy90:
+	++cursor_;
+	if (limit_ <= cursor_) FILL(1);
+	yych = *cursor_;
+	if (yych <= 0x9F) {
+		goto yyback_i;
+	} else {
+		if (yych <= 0xBF) goto yy89;
+		goto yyback_i;
+	}
+yy91:
+	++cursor_;
+	if (limit_ <= cursor_) FILL(1);
+	yych = *cursor_;
+	if (yych <= 0x7F) {
+		goto yyback_i;
+	} else {
+		if (yych <= 0xBF) goto yy89;
+		goto yyback_i;
+	}
+yy92:
+	++cursor_;
+	if (limit_ <= cursor_) FILL(1);
+	yych = *cursor_;
+	if (yych <= 0x8F) {
+		goto yyback_i;
+	} else {
+		if (yych <= 0xBF) goto yy91;
+		goto yyback_i;
+	}
+yy93:
+	++cursor_;
+	if (limit_ <= cursor_) FILL(1);
+	yych = *cursor_;
+	if (yych <= 0x7F) {
+		goto yyback_i;
+	} else {
+		if (yych <= 0xBF) goto yy91;
+		goto yyback_i;
+	}
+yy94:
+	++cursor_;
+	if (limit_ <= cursor_) FILL(1);
+	yych = *cursor_;
+	if (yych <= 0x7F) {
+		goto yyback_i;
+	} else {
+		if (yych <= 0x8F) goto yy91;
+		goto yyback_i;
+	}
+yy95:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 's') goto yy158;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy96:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'i') goto yy159;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy97:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'y') goto yy160;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy98:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '2') goto yy161;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy99:
+	++cursor_;
+	if (limit_ <= cursor_) FILL(1);
+	yych = *cursor_;
+	if (yybm[0+yych] & 128) {
+		goto yy99;
+	}
+	if (yybm[512+yych] & 4) {
+		goto yy28;
+	}
+	goto yy1795;
+yy100:
+	++cursor_;
+	goto yy1796;
+yy101:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy162;
+	if (yych == 't') goto yy163;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy102:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy164;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy103:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy165;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy104:
+	++cursor_;
+	yych = *cursor_;
+	if (yych <= 0x7F) {
+		goto yyback_i;
+	} else {
+		if (yych <= 0xBF) goto yy31;
+		goto yyback_i;
+	}
+yy105:
+	++cursor_;
+	yych = *cursor_;
+	if (yych <= 0x7F) {
+		goto yyback_i;
+	} else {
+		if (yych <= 0xBF) goto yy104;
+		goto yyback_i;
+	}
+yy106:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '.') goto yy166;
+	if (yych == 'x') goto yy167;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1461;
+yy107:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '.') goto yy168;
+	if (yych == 'x') goto yy169;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1462;
 yy108:
-		yych = *++cursor_;
-		if (yych <= 'k') {
-			if (yych == 'e') goto yy175;
-			goto yy87;
-		} else {
-			if (yych <= 'l') goto yy176;
-			if (yych == 'r') goto yy177;
-			goto yy87;
-		}
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1457;
 yy109:
-		yych = *++cursor_;
-		if (yych <= 'e') {
-			if (yych <= '3') {
-				if (yych <= '2') goto yy87;
-				goto yy178;
-			} else {
-				if (yych == '6') goto yy179;
-				goto yy87;
-			}
-		} else {
-			if (yych <= 'l') {
-				if (yych <= 'f') goto yy180;
-				goto yy87;
-			} else {
-				if (yych <= 'm') goto yy182;
-				if (yych <= 'n') goto yy183;
-				goto yy87;
-			}
-		}
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'o') goto yy170;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy110:
-		yych = *++cursor_;
-		if (yych == 'o') goto yy184;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'o') goto yy171;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy111:
-		yych = *++cursor_;
-		if (yych <= 'n') {
-			if (yych == 'e') goto yy185;
-			goto yy87;
-		} else {
-			if (yych <= 'o') goto yy186;
-			if (yych == 'u') goto yy187;
-			goto yy87;
-		}
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '1') goto yy172;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy112:
-		yych = *++cursor_;
-		if (yych == 'a') goto yy188;
-		if (yych == 'o') goto yy189;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'x') goto yy173;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy113:
-		yych = *++cursor_;
-		if (yych == 'f') goto yy190;
-		goto yy87;
+	++cursor_;
+	if ((limit_ - cursor_) < 3) FILL(3);
+	yych = *cursor_;
+	if (yych == '.') goto yy174;
+	if (yych == 'p') goto yy175;
+	if (yybm[256+yych] & 32) {
+		goto yy28;
+	}
+	if (yybm[512+yych] & 1) {
+		goto yy113;
+	}
+	goto yy1453;
 yy114:
-		yych = *++cursor_;
-		if (yych == 'a') goto yy191;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[256+yych] & 4) {
+		goto yy28;
+	}
+	if (yych <= ')') {
+		goto yy1800;
+	} else {
+		if (yych <= '9') goto yy115;
+		goto yy1800;
+	}
 yy115:
-		yych = *++cursor_;
-		if (yych == 'u') goto yy192;
-		goto yy87;
+	++cursor_;
+	if (limit_ <= cursor_) FILL(1);
+	yych = *cursor_;
+	if (yybm[256+yych] & 4) {
+		goto yy28;
+	}
+	if (yych <= ')') {
+		goto yy1455;
+	} else {
+		if (yych <= '9') goto yy115;
+		goto yy1455;
+	}
 yy116:
-		yych = *++cursor_;
-		if (yych == 'e') goto yy193;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'n') goto yy176;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy117:
-		yych = *++cursor_;
-		if (yych == 'e') goto yy194;
-		if (yych == 't') goto yy195;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'o') goto yy177;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy118:
-		yych = *++cursor_;
-		switch (yych) {
-		case 'a':	goto yy196;
-		case 'e':	goto yy197;
-		case 'h':	goto yy198;
-		case 'r':	goto yy199;
-		case 'y':	goto yy200;
-		default:	goto yy87;
-		}
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy178;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy119:
-		yych = *++cursor_;
-		if (yych == 'n') goto yy201;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '_') goto yy179;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy120:
-		++cursor_;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1679;
 yy121:
-#line 566 "src/wast-lexer.cc"
-		{ MAYBE_MALFORMED_UTF8(""); }
-#line 1210 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy180;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy122:
-		yych = *++cursor_;
-		if (yych <= 0x7F) goto yy121;
-		if (yych <= 0xBF) goto yy79;
-		goto yy121;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '.') goto yy181;
+	if (yych == 'x') goto yy182;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1463;
 yy123:
-		yyaccept = 1;
-		yych = *(marker_ = ++cursor_);
-		if (yych <= 0x9F) goto yy121;
-		if (yych <= 0xBF) goto yy202;
-		goto yy121;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '.') goto yy183;
+	if (yych == 'x') goto yy184;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1464;
 yy124:
-		yyaccept = 1;
-		yych = *(marker_ = ++cursor_);
-		if (yych <= 0x7F) goto yy121;
-		if (yych <= 0xBF) goto yy202;
-		goto yy121;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'c') goto yy185;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy125:
-		yyaccept = 1;
-		yych = *(marker_ = ++cursor_);
-		if (yych <= 0x8F) goto yy121;
-		if (yych <= 0xBF) goto yy203;
-		goto yy121;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[256+yych] & 32) {
+		goto yy28;
+	}
+	if (yybm[512+yych] & 1) {
+		goto yy186;
+	}
+	goto yy1800;
 yy126:
-		yyaccept = 1;
-		yych = *(marker_ = ++cursor_);
-		if (yych <= 0x7F) goto yy121;
-		if (yych <= 0xBF) goto yy203;
-		goto yy121;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'f') goto yy108;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy127:
-		yyaccept = 1;
-		yych = *(marker_ = ++cursor_);
-		if (yych <= 0x7F) goto yy121;
-		if (yych <= 0x8F) goto yy203;
-		goto yy121;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy187;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy128:
-		++cursor_;
-		if (limit_ <= cursor_) FILL(1);
-		yych = *cursor_;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'h') goto yy189;
+	if (yych == 'u') goto yy188;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy129:
-		if (yybm[0+yych] & 32) {
-			goto yy128;
-		}
-		if (yych <= 0xDF) {
-			if (yych <= '"') {
-				if (yych >= ' ') goto yy131;
-			} else {
-				if (yych <= '\\') goto yy133;
-				if (yych >= 0xC2) goto yy134;
-			}
-		} else {
-			if (yych <= 0xF0) {
-				if (yych <= 0xE0) goto yy135;
-				if (yych <= 0xEF) goto yy136;
-				goto yy137;
-			} else {
-				if (yych <= 0xF3) goto yy138;
-				if (yych <= 0xF4) goto yy139;
-			}
-		}
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'i') goto yy190;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy130:
-		cursor_ = marker_;
-		if (yyaccept == 0) {
-			goto yy90;
-		} else {
-			goto yy121;
-		}
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'u') goto yy191;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy131:
-		++cursor_;
-#line 317 "src/wast-lexer.cc"
-		{ SetText(); RETURN(TEXT); }
-#line 1282 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy192;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy132:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'p') goto yy193;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy133:
-		++cursor_;
-		if (limit_ <= cursor_) FILL(1);
-		yych = *cursor_;
-		if (yych <= '[') {
-			if (yych <= '\'') {
-				if (yych == '"') goto yy128;
-				if (yych <= '&') goto yy130;
-				goto yy128;
-			} else {
-				if (yych <= '9') {
-					if (yych <= '/') goto yy130;
-					goto yy204;
-				} else {
-					if (yych <= '@') goto yy130;
-					if (yych <= 'F') goto yy204;
-					goto yy130;
-				}
-			}
-		} else {
-			if (yych <= 'n') {
-				if (yych <= '`') {
-					if (yych <= '\\') goto yy128;
-					goto yy130;
-				} else {
-					if (yych <= 'f') goto yy204;
-					if (yych <= 'm') goto yy130;
-					goto yy128;
-				}
-			} else {
-				if (yych <= 'r') {
-					if (yych <= 'q') goto yy130;
-					goto yy128;
-				} else {
-					if (yych == 't') goto yy128;
-					goto yy130;
-				}
-			}
-		}
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '_') goto yy194;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1670;
 yy134:
-		++cursor_;
-		if (limit_ <= cursor_) FILL(1);
-		yych = *cursor_;
-		if (yych <= 0x7F) goto yy130;
-		if (yych <= 0xBF) goto yy128;
-		goto yy130;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'w') goto yy195;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy135:
-		++cursor_;
-		if (limit_ <= cursor_) FILL(1);
-		yych = *cursor_;
-		if (yych <= 0x9F) goto yy130;
-		if (yych <= 0xBF) goto yy134;
-		goto yy130;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'b') goto yy196;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy136:
-		++cursor_;
-		if (limit_ <= cursor_) FILL(1);
-		yych = *cursor_;
-		if (yych <= 0x7F) goto yy130;
-		if (yych <= 0xBF) goto yy134;
-		goto yy130;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'o') goto yy197;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy137:
-		++cursor_;
-		if (limit_ <= cursor_) FILL(1);
-		yych = *cursor_;
-		if (yych <= 0x8F) goto yy130;
-		if (yych <= 0xBF) goto yy136;
-		goto yy130;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1467;
 yy138:
-		++cursor_;
-		if (limit_ <= cursor_) FILL(1);
-		yych = *cursor_;
-		if (yych <= 0x7F) goto yy130;
-		if (yych <= 0xBF) goto yy136;
-		goto yy130;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'u') goto yy198;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy139:
-		++cursor_;
-		if (limit_ <= cursor_) FILL(1);
-		yych = *cursor_;
-		if (yych <= 0x7F) goto yy130;
-		if (yych <= 0x8F) goto yy136;
-		goto yy130;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'i') goto yy199;
+	if (yych == 't') goto yy200;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy140:
-		++cursor_;
-		if (limit_ <= cursor_) FILL(1);
-		yych = *cursor_;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy201;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy141:
-		if (yybm[0+yych] & 64) {
-			goto yy140;
-		}
-		if (yych <= ')') goto yy142;
-		if (yych <= ',') goto yy86;
-		if (yych <= ';') goto yy142;
-		if (yych <= '}') goto yy86;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'c') goto yy202;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy142:
-#line 547 "src/wast-lexer.cc"
-		{ SetText(); RETURN(VAR); }
-#line 1379 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy203;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy143:
-		++cursor_;
-		BEGIN(YYCOND_BLOCK_COMMENT);
-#line 552 "src/wast-lexer.cc"
-		{ COMMENT_NESTING = 1; continue; }
-#line 1385 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '_') goto yy204;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy144:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy205;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy145:
-		++cursor_;
-		if ((yych = *cursor_) <= '9') {
-			if (yych <= '\'') {
-				if (yych == '!') goto yy86;
-				if (yych >= '#') goto yy86;
-			} else {
-				if (yych <= '-') {
-					if (yych >= '*') goto yy86;
-				} else {
-					if (yych <= '.') goto yy151;
-					if (yych <= '/') goto yy86;
-					goto yy147;
-				}
-			}
-		} else {
-			if (yych <= 'd') {
-				if (yych <= ';') {
-					if (yych <= ':') goto yy86;
-				} else {
-					if (yych == 'E') goto yy154;
-					goto yy86;
-				}
-			} else {
-				if (yych <= 'w') {
-					if (yych <= 'e') goto yy154;
-					goto yy86;
-				} else {
-					if (yych <= 'x') goto yy205;
-					if (yych <= '~') goto yy86;
-				}
-			}
-		}
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy206;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy146:
-#line 312 "src/wast-lexer.cc"
-		{ LITERAL(Int); RETURN(INT); }
-#line 1422 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy207;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy147:
-		++cursor_;
-		if ((limit_ - cursor_) < 3) FILL(3);
-		yych = *cursor_;
-		if (yych <= '/') {
-			if (yych <= '\'') {
-				if (yych == '!') goto yy86;
-				if (yych <= '"') goto yy146;
-				goto yy86;
-			} else {
-				if (yych <= ')') goto yy146;
-				if (yych == '.') goto yy151;
-				goto yy86;
-			}
-		} else {
-			if (yych <= 'D') {
-				if (yych <= '9') goto yy147;
-				if (yych == ';') goto yy146;
-				goto yy86;
-			} else {
-				if (yych <= 'd') {
-					if (yych <= 'E') goto yy154;
-					goto yy86;
-				} else {
-					if (yych <= 'e') goto yy154;
-					if (yych <= '~') goto yy86;
-					goto yy146;
-				}
-			}
-		}
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy208;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy148:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'm') goto yy209;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy149:
-		yych = *++cursor_;
-		if (yych == 'n') goto yy206;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'o') goto yy210;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy150:
-		yych = *++cursor_;
-		if (yych == 'a') goto yy188;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy211;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy151:
-		++cursor_;
-		if ((limit_ - cursor_) < 3) FILL(3);
-		yych = *cursor_;
-		if (yych <= '9') {
-			if (yych <= '"') {
-				if (yych == '!') goto yy86;
-			} else {
-				if (yych <= '\'') goto yy86;
-				if (yych <= ')') goto yy153;
-				if (yych <= '/') goto yy86;
-				goto yy151;
-			}
-		} else {
-			if (yych <= 'E') {
-				if (yych == ';') goto yy153;
-				if (yych <= 'D') goto yy86;
-				goto yy154;
-			} else {
-				if (yych == 'e') goto yy154;
-				if (yych <= '~') goto yy86;
-			}
-		}
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1482;
+yy152:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'p') goto yy212;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy153:
-#line 313 "src/wast-lexer.cc"
-		{ LITERAL(Float); RETURN(FLOAT); }
-#line 1487 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy213;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy154:
-		yych = *++cursor_;
-		if (yych <= ',') {
-			if (yych == '+') goto yy207;
-			goto yy87;
-		} else {
-			if (yych <= '-') goto yy207;
-			if (yych <= '/') goto yy87;
-			if (yych <= '9') goto yy208;
-			goto yy87;
-		}
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 's') goto yy214;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy155:
-		yych = *++cursor_;
-		if (yybm[0+yych] & 128) {
-			goto yy210;
-		}
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == ':') goto yy215;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1458;
 yy156:
-		++cursor_;
-		BEGIN(YYCOND_LINE_COMMENT);
-#line 549 "src/wast-lexer.cc"
-		{ continue; }
-#line 1510 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1468;
+yy157:
+	++cursor_;
+	if (limit_ <= cursor_) FILL(1);
+	yych = *cursor_;
+	if (yybm[512+yych] & 1) {
+		goto yy88;
+	}
+	goto yyback_i;
 yy158:
-		yych = *++cursor_;
-		if (yych == 'i') goto yy212;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy216;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy159:
-		yych = *++cursor_;
-		if (yych == 'y') goto yy213;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'g') goto yy217;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy160:
-		yych = *++cursor_;
-		if (yych == 's') goto yy214;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'f') goto yy218;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy161:
-		yych = *++cursor_;
-		if (yych == 'n') goto yy215;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '8') goto yy219;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy162:
-		yych = *++cursor_;
-		if (yych == 'o') goto yy216;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy220;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy163:
-		++cursor_;
-		if ((yych = *cursor_) <= ')') {
-			if (yych <= '!') {
-				if (yych >= '!') goto yy86;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'c') goto yy221;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy164:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy222;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy165:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy223;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy166:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'w') goto yy232;
+	if (yybm[256+yych] & 16) {
+		goto yy28;
+	}
+	if (yych <= 'm') {
+		if (yych <= 'd') {
+			if (yych <= 'a') {
+				if (yych <= ';') goto yy1800;
+				goto yy224;
 			} else {
-				if (yych <= '"') goto yy164;
-				if (yych <= '\'') goto yy86;
+				if (yych == 'd') goto yy237;
+				goto yy235;
 			}
 		} else {
-			if (yych <= '^') {
-				if (yych != ';') goto yy86;
+			if (yych <= 'g') {
+				if (yych == 'e') goto yy227;
+				goto yy234;
 			} else {
-				if (yych <= '_') goto yy217;
-				if (yych <= '~') goto yy86;
+				if (yych == 'm') goto yy236;
+				goto yy226;
 			}
 		}
-yy164:
-#line 342 "src/wast-lexer.cc"
-		{ RETURN(BR); }
-#line 1551 "src/prebuilt/wast-lexer-gen.cc"
-yy165:
-		yych = *++cursor_;
-		if (yych == 'l') goto yy218;
-		if (yych == 't') goto yy219;
-		goto yy87;
-yy166:
-		yych = *++cursor_;
-		if (yych == 'r') goto yy220;
-		goto yy87;
+	} else {
+		if (yych <= 'r') {
+			if (yych <= 'o') {
+				if (yych == 'n') goto yy229;
+				goto yy228;
+			} else {
+				if (yych == 'p') goto yy238;
+				goto yy225;
+			}
+		} else {
+			if (yych <= 't') {
+				if (yych == 's') goto yy231;
+				goto yy233;
+			} else {
+				if (yych <= 'x') goto yy230;
+				goto yy1800;
+			}
+		}
+	}
 yy167:
-		yych = *++cursor_;
-		if (yych == 't') goto yy221;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '4') goto yy239;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy168:
-		yych = *++cursor_;
-		if (yych == 'o') goto yy222;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[256+yych] & 16) {
+		goto yy28;
+	}
+	if (yych <= 'm') {
+		if (yych <= 'd') {
+			if (yych <= 'a') {
+				if (yych <= ';') goto yy1800;
+				goto yy240;
+			} else {
+				if (yych == 'd') goto yy253;
+				goto yy251;
+			}
+		} else {
+			if (yych <= 'g') {
+				if (yych == 'e') goto yy244;
+				goto yy250;
+			} else {
+				if (yych == 'm') goto yy252;
+				goto yy243;
+			}
+		}
+	} else {
+		if (yych <= 'r') {
+			if (yych <= 'o') {
+				if (yych == 'n') goto yy246;
+				goto yy245;
+			} else {
+				if (yych == 'p') goto yy241;
+				goto yy242;
+			}
+		} else {
+			if (yych <= 't') {
+				if (yych == 's') goto yy248;
+				goto yy249;
+			} else {
+				if (yych <= 'x') goto yy247;
+				goto yy1800;
+			}
+		}
+	}
 yy169:
-		yych = *++cursor_;
-		if (yych == 'e') goto yy223;
-		if (yych == 's') goto yy224;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '2') goto yy254;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy170:
-		yych = *++cursor_;
-		if (yych == 'd') goto yy225;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'k') goto yy255;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy171:
-		yych = *++cursor_;
-		if (yych == 'c') goto yy227;
-		if (yych == 'p') goto yy228;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy256;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy172:
-		yych = *++cursor_;
-		if (yych == '2') goto yy229;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '6') goto yy257;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy173:
-		yych = *++cursor_;
-		if (yych == '4') goto yy231;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '8') goto yy258;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy174:
-		yych = *++cursor_;
-		if (yych == 'n') goto yy233;
-		goto yy87;
+	++cursor_;
+	if ((limit_ - cursor_) < 3) FILL(3);
+	yych = *cursor_;
+	if (yych == 'p') goto yy175;
+	if (yybm[256+yych] & 32) {
+		goto yy28;
+	}
+	if (yybm[512+yych] & 1) {
+		goto yy174;
+	}
+	goto yy1800;
 yy175:
-		yych = *++cursor_;
-		if (yych == 't') goto yy234;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '+') goto yy260;
+	if (yych == '-') goto yy260;
+	if (yybm[256+yych] & 4) {
+		goto yy28;
+	}
+	if (yych <= ')') {
+		goto yy1800;
+	} else {
+		if (yych <= '9') goto yy259;
+		goto yy1800;
+	}
 yy176:
-		yych = *++cursor_;
-		if (yych == 'o') goto yy236;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1471;
 yy177:
-		yych = *++cursor_;
-		if (yych == 'o') goto yy237;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'w') goto yy261;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy178:
-		yych = *++cursor_;
-		if (yych == '2') goto yy238;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy262;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy179:
-		yych = *++cursor_;
-		if (yych == '4') goto yy240;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy263;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy180:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 338 "src/wast-lexer.cc"
-		{ RETURN(IF); }
-#line 1622 "src/prebuilt/wast-lexer-gen.cc"
-yy182:
-		yych = *++cursor_;
-		if (yych == 'p') goto yy242;
-		goto yy87;
-yy183:
-		yych = *++cursor_;
-		if (yych == 'f') goto yy243;
-		if (yych == 'v') goto yy245;
-		goto yy87;
-yy184:
-		yych = *++cursor_;
-		if (yych == 'c') goto yy246;
-		if (yych == 'o') goto yy247;
-		goto yy87;
-yy185:
-		yych = *++cursor_;
-		if (yych == 'm') goto yy248;
-		goto yy87;
-yy186:
-		yych = *++cursor_;
-		if (yych == 'd') goto yy249;
-		goto yy87;
-yy187:
-		yych = *++cursor_;
-		if (yych == 't') goto yy250;
-		goto yy87;
-yy188:
-		yych = *++cursor_;
-		if (yych == 'n') goto yy252;
-		goto yy87;
-yy189:
-		yych = *++cursor_;
-		if (yych == 'p') goto yy254;
-		goto yy87;
-yy190:
-		yych = *++cursor_;
-		if (yych == 'f') goto yy256;
-		goto yy87;
-yy191:
-		yych = *++cursor_;
-		if (yych == 'r') goto yy257;
-		goto yy87;
-yy192:
-		yych = *++cursor_;
-		if (yych == 'o') goto yy258;
-		goto yy87;
-yy193:
-		yych = *++cursor_;
-		if (yych <= 'r') {
-			if (yych == 'g') goto yy259;
-			goto yy87;
-		} else {
-			if (yych <= 's') goto yy260;
-			if (yych <= 't') goto yy261;
-			goto yy87;
-		}
-yy194:
-		yych = *++cursor_;
-		if (yych == 'l') goto yy262;
-		if (yych == 't') goto yy263;
-		goto yy87;
-yy195:
-		yych = *++cursor_;
-		if (yych == 'a') goto yy264;
-		goto yy87;
-yy196:
-		yych = *++cursor_;
-		if (yych == 'b') goto yy265;
-		goto yy87;
-yy197:
-		yych = *++cursor_;
-		if (yych == 'e') goto yy266;
-		goto yy87;
-yy198:
-		yych = *++cursor_;
-		if (yych == 'e') goto yy267;
-		if (yych == 'r') goto yy268;
-		goto yy87;
-yy199:
-		yych = *++cursor_;
-		if (yych == 'y') goto yy269;
-		goto yy87;
-yy200:
-		yych = *++cursor_;
-		if (yych == 'p') goto yy271;
-		goto yy87;
-yy201:
-		yych = *++cursor_;
-		if (yych == 'r') goto yy272;
-		goto yy87;
-yy202:
-		yych = *++cursor_;
-		if (yych <= 0x7F) goto yy130;
-		if (yych <= 0xBF) goto yy79;
-		goto yy130;
-yy203:
-		yych = *++cursor_;
-		if (yych <= 0x7F) goto yy130;
-		if (yych <= 0xBF) goto yy202;
-		goto yy130;
-yy204:
-		++cursor_;
-		if (limit_ <= cursor_) FILL(1);
-		yych = *cursor_;
-		if (yych <= '@') {
-			if (yych <= '/') goto yy130;
-			if (yych <= '9') goto yy128;
-			goto yy130;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1650;
+yy181:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[256+yych] & 8) {
+		goto yy28;
+	}
+	if (yych <= 'g') {
+		if (yych <= 'c') {
+			if (yych <= ';') {
+				goto yy1800;
+			} else {
+				if (yych <= 'a') goto yy268;
+				goto yy264;
+			}
 		} else {
-			if (yych <= 'F') goto yy128;
-			if (yych <= '`') goto yy130;
-			if (yych <= 'f') goto yy128;
-			goto yy130;
+			if (yych <= 'e') {
+				if (yych == 'd') goto yy271;
+				goto yy270;
+			} else {
+				if (yych == 'f') goto yy272;
+				goto yy265;
+			}
 		}
-yy205:
-		yych = *++cursor_;
-		if (yych <= '@') {
-			if (yych <= '/') goto yy87;
-			if (yych <= '9') goto yy273;
-			goto yy87;
+	} else {
+		if (yych <= 'n') {
+			if (yych <= 'l') {
+				goto yy273;
+			} else {
+				if (yych == 'm') goto yy269;
+				goto yy266;
+			}
 		} else {
-			if (yych <= 'F') goto yy273;
-			if (yych <= '`') goto yy87;
-			if (yych <= 'f') goto yy273;
-			goto yy87;
+			if (yych <= 's') {
+				if (yych == 's') goto yy267;
+				goto yy274;
+			} else {
+				if (yych == 't') goto yy275;
+				goto yy1800;
+			}
 		}
-yy206:
-		yych = *++cursor_;
-		if (yych == 'f') goto yy243;
-		goto yy87;
-yy207:
-		yych = *++cursor_;
-		if (yych <= '/') goto yy87;
-		if (yych >= ':') goto yy87;
-yy208:
-		++cursor_;
-		if (limit_ <= cursor_) FILL(1);
-		yych = *cursor_;
-		if (yych <= ')') {
-			if (yych <= '!') {
-				if (yych <= ' ') goto yy153;
-				goto yy86;
+	}
+yy182:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '4') goto yy276;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy183:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'p') goto yy288;
+	if (yybm[256+yych] & 8) {
+		goto yy28;
+	}
+	if (yych <= 'g') {
+		if (yych <= 'c') {
+			if (yych <= ';') {
+				goto yy1800;
 			} else {
-				if (yych <= '"') goto yy153;
-				if (yych <= '\'') goto yy86;
-				goto yy153;
+				if (yych <= 'a') goto yy282;
+				goto yy277;
 			}
 		} else {
-			if (yych <= ':') {
-				if (yych <= '/') goto yy86;
-				if (yych <= '9') goto yy208;
-				goto yy86;
+			if (yych <= 'e') {
+				if (yych == 'd') goto yy285;
+				goto yy284;
 			} else {
-				if (yych <= ';') goto yy153;
-				if (yych <= '~') goto yy86;
-				goto yy153;
+				if (yych == 'f') goto yy286;
+				goto yy278;
 			}
 		}
-yy210:
-		++cursor_;
-		if ((limit_ - cursor_) < 3) FILL(3);
-		yych = *cursor_;
-		if (yybm[0+yych] & 128) {
-			goto yy210;
-		}
-		if (yych <= '-') {
-			if (yych <= '"') {
-				if (yych == '!') goto yy86;
-				goto yy98;
+	} else {
+		if (yych <= 'n') {
+			if (yych <= 'l') {
+				goto yy287;
 			} else {
-				if (yych <= '\'') goto yy86;
-				if (yych <= ')') goto yy98;
-				goto yy86;
+				if (yych == 'm') goto yy283;
+				goto yy279;
 			}
 		} else {
-			if (yych <= ';') {
-				if (yych <= '.') goto yy275;
-				if (yych <= ':') goto yy86;
-				goto yy98;
+			if (yych <= 's') {
+				if (yych == 's') goto yy281;
+				goto yy280;
 			} else {
-				if (yych == 'p') goto yy277;
-				if (yych <= '~') goto yy86;
-				goto yy98;
+				if (yych == 't') goto yy289;
+				goto yy1800;
 			}
 		}
-yy212:
-		yych = *++cursor_;
-		if (yych == 'g') goto yy278;
-		goto yy87;
-yy213:
-		yych = *++cursor_;
-		if (yych == 'f') goto yy279;
-		goto yy87;
-yy214:
-		yych = *++cursor_;
-		if (yych == 'e') goto yy280;
-		goto yy87;
+	}
+yy184:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '2') goto yy290;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy185:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1651;
+yy186:
+	++cursor_;
+	if ((limit_ - cursor_) < 3) FILL(3);
+	yych = *cursor_;
+	if (yych == '.') goto yy174;
+	if (yych == 'p') goto yy175;
+	if (yybm[256+yych] & 32) {
+		goto yy28;
+	}
+	if (yybm[512+yych] & 1) {
+		goto yy186;
+	}
+	goto yy1454;
+yy187:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'm') goto yy291;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy188:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy292;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy189:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy293;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy190:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 's') goto yy294;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy191:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy295;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy192:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy296;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy193:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1473;
+yy194:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'g') goto yy297;
+	if (yych == 'l') goto yy298;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy195:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '_') goto yy299;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy196:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy300;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy197:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy301;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy198:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy302;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy199:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'f') goto yy303;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy200:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy304;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy201:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy305;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy202:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'k') goto yy306;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy203:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy307;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy204:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'g') goto yy308;
+	if (yych == 'l') goto yy309;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy205:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'c') goto yy310;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy206:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy311;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy207:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy312;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy208:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1472;
+yy209:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1662;
+yy210:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy313;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy211:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'p') goto yy314;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy212:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1481;
+yy213:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1663;
+yy214:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy315;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy215:
-		yych = *++cursor_;
-		if (yych == 'a') goto yy281;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '0') goto yy316;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy216:
-		yych = *++cursor_;
-		if (yych == 'c') goto yy282;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy317;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy217:
-		yych = *++cursor_;
-		if (yych == 'i') goto yy283;
-		if (yych == 't') goto yy284;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'n') goto yy318;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy218:
-		yych = *++cursor_;
-		if (yych == 'l') goto yy285;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'u') goto yy319;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy219:
-		yych = *++cursor_;
-		if (yych == 'c') goto yy287;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '.') goto yy320;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1465;
 yy220:
-		yych = *++cursor_;
-		if (yych == 'r') goto yy288;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '_') goto yy321;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1477;
 yy221:
-		yych = *++cursor_;
-		if (yych == 'a') goto yy289;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'h') goto yy322;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy222:
-		yych = *++cursor_;
-		if (yych == 'p') goto yy291;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy323;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy223:
-		yych = *++cursor_;
-		if (yych == 'm') goto yy293;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy324;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy224:
-		yych = *++cursor_;
-		if (yych == 'e') goto yy295;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'd') goto yy326;
+	if (yych == 'n') goto yy327;
+	if (yych == 't') goto yy325;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy225:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 348 "src/wast-lexer.cc"
-		{ RETURN(END); }
-#line 1868 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy328;
+	if (yych == 'o') goto yy329;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy226:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy332;
+	if (yych == 'o') goto yy330;
+	if (yych == 't') goto yy331;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy227:
-		yych = *++cursor_;
-		if (yych == 'e') goto yy297;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'q') goto yy333;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy228:
-		yych = *++cursor_;
-		if (yych == 'o') goto yy298;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy334;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy229:
-		++cursor_;
-		if ((yych = *cursor_) <= ')') {
-			if (yych <= '!') {
-				if (yych >= '!') goto yy86;
-			} else {
-				if (yych <= '"') goto yy230;
-				if (yych <= '\'') goto yy86;
-			}
-		} else {
-			if (yych <= ':') {
-				if (yych == '.') goto yy299;
-				goto yy86;
-			} else {
-				if (yych <= ';') goto yy230;
-				if (yych <= '~') goto yy86;
-			}
-		}
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy335;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy230:
-#line 332 "src/wast-lexer.cc"
-		{ TYPE(F32); RETURN(VALUE_TYPE); }
-#line 1898 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'o') goto yy336;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy231:
-		++cursor_;
-		if ((yych = *cursor_) <= ')') {
-			if (yych <= '!') {
-				if (yych >= '!') goto yy86;
-			} else {
-				if (yych <= '"') goto yy232;
-				if (yych <= '\'') goto yy86;
-			}
-		} else {
-			if (yych <= ':') {
-				if (yych == '.') goto yy300;
-				goto yy86;
-			} else {
-				if (yych <= ';') goto yy232;
-				if (yych <= '~') goto yy86;
-			}
-		}
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'h') goto yy337;
+	if (yych == 't') goto yy339;
+	if (yych == 'u') goto yy338;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy232:
-#line 333 "src/wast-lexer.cc"
-		{ TYPE(F64); RETURN(VALUE_TYPE); }
-#line 1920 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy340;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy233:
-		yych = *++cursor_;
-		if (yych == 'c') goto yy301;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy341;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy234:
-		++cursor_;
-		if ((yych = *cursor_) <= ')') {
-			if (yych <= '!') {
-				if (yych >= '!') goto yy86;
-			} else {
-				if (yych <= '"') goto yy235;
-				if (yych <= '\'') goto yy86;
-			}
-		} else {
-			if (yych <= '^') {
-				if (yych != ';') goto yy86;
-			} else {
-				if (yych <= '_') goto yy303;
-				if (yych <= '~') goto yy86;
-			}
-		}
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy343;
+	if (yych == 't') goto yy342;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy235:
-#line 531 "src/wast-lexer.cc"
-		{ RETURN(GET); }
-#line 1945 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy344;
+	if (yych == 'o') goto yy345;
+	if (yych == 't') goto yy346;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy236:
-		yych = *++cursor_;
-		if (yych == 'b') goto yy304;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'u') goto yy347;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy237:
-		yych = *++cursor_;
-		if (yych == 'w') goto yy305;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'i') goto yy348;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy238:
-		++cursor_;
-		if ((yych = *cursor_) <= ')') {
-			if (yych <= '!') {
-				if (yych >= '!') goto yy86;
-			} else {
-				if (yych <= '"') goto yy239;
-				if (yych <= '\'') goto yy86;
-			}
-		} else {
-			if (yych <= ':') {
-				if (yych == '.') goto yy306;
-				goto yy86;
-			} else {
-				if (yych <= ';') goto yy239;
-				if (yych <= '~') goto yy86;
-			}
-		}
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'o') goto yy349;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy239:
-#line 330 "src/wast-lexer.cc"
-		{ TYPE(I32); RETURN(VALUE_TYPE); }
-#line 1975 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '.') goto yy350;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1686;
 yy240:
-		++cursor_;
-		if ((yych = *cursor_) <= ')') {
-			if (yych <= '!') {
-				if (yych >= '!') goto yy86;
-			} else {
-				if (yych <= '"') goto yy241;
-				if (yych <= '\'') goto yy86;
-			}
-		} else {
-			if (yych <= ':') {
-				if (yych == '.') goto yy307;
-				goto yy86;
-			} else {
-				if (yych <= ';') goto yy241;
-				if (yych <= '~') goto yy86;
-			}
-		}
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'd') goto yy353;
+	if (yych == 'n') goto yy352;
+	if (yych == 't') goto yy351;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy241:
-#line 331 "src/wast-lexer.cc"
-		{ TYPE(I64); RETURN(VALUE_TYPE); }
-#line 1997 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'o') goto yy354;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy242:
-		yych = *++cursor_;
-		if (yych == 'o') goto yy308;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy355;
+	if (yych == 'o') goto yy356;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy243:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 315 "src/wast-lexer.cc"
-		{ LITERAL(Infinity); RETURN(FLOAT); }
-#line 2009 "src/prebuilt/wast-lexer-gen.cc"
-yy245:
-		yych = *++cursor_;
-		if (yych == 'o') goto yy309;
-		goto yy87;
-yy246:
-		yych = *++cursor_;
-		if (yych == 'a') goto yy310;
-		goto yy87;
-yy247:
-		yych = *++cursor_;
-		if (yych == 'p') goto yy311;
-		goto yy87;
-yy248:
-		yych = *++cursor_;
-		if (yych == 'o') goto yy313;
-		goto yy87;
-yy249:
-		yych = *++cursor_;
-		if (yych == 'u') goto yy314;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy359;
+	if (yych == 'o') goto yy358;
+	if (yych == 't') goto yy357;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy244:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'q') goto yy360;
+	if (yych == 'x') goto yy361;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy245:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy362;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy246:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy363;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy247:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'o') goto yy364;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy248:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'h') goto yy365;
+	if (yych == 't') goto yy366;
+	if (yych == 'u') goto yy367;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy249:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy368;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy250:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 335 "src/wast-lexer.cc"
-		{ RETURN(MUT); }
-#line 2037 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy369;
+	if (yych == 't') goto yy370;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy251:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy372;
+	if (yych == 'o') goto yy371;
+	if (yych == 't') goto yy373;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy252:
-		++cursor_;
-		if ((yych = *cursor_) <= ')') {
-			if (yych <= '!') {
-				if (yych >= '!') goto yy86;
-			} else {
-				if (yych <= '"') goto yy253;
-				if (yych <= '\'') goto yy86;
-			}
-		} else {
-			if (yych <= ':') {
-				if (yych <= '9') goto yy86;
-				goto yy315;
-			} else {
-				if (yych <= ';') goto yy253;
-				if (yych <= '~') goto yy86;
-			}
-		}
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'u') goto yy374;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy253:
-#line 316 "src/wast-lexer.cc"
-		{ LITERAL(Nan); RETURN(FLOAT); }
-#line 2059 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'i') goto yy375;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy254:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 336 "src/wast-lexer.cc"
-		{ RETURN(NOP); }
-#line 2067 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '.') goto yy376;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1687;
+yy255:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy377;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy256:
-		yych = *++cursor_;
-		if (yych == 's') goto yy316;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy378;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy257:
-		yych = *++cursor_;
-		if (yych == 'a') goto yy317;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '.') goto yy379;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1684;
 yy258:
-		yych = *++cursor_;
-		if (yych == 't') goto yy318;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '.') goto yy380;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1685;
 yy259:
-		yych = *++cursor_;
-		if (yych == 'i') goto yy319;
-		goto yy87;
+	++cursor_;
+	if (limit_ <= cursor_) FILL(1);
+	yych = *cursor_;
+	if (yybm[256+yych] & 4) {
+		goto yy28;
+	}
+	if (yych <= ')') {
+		goto yy1456;
+	} else {
+		if (yych <= '9') goto yy259;
+		goto yy1456;
+	}
 yy260:
-		yych = *++cursor_;
-		if (yych == 'u') goto yy320;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[256+yych] & 4) {
+		goto yy28;
+	}
+	if (yych <= ')') {
+		goto yy1800;
+	} else {
+		if (yych <= '9') goto yy259;
+		goto yy1800;
+	}
 yy261:
-		yych = *++cursor_;
-		if (yych == 'h') goto yy321;
-		if (yych == 'u') goto yy322;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1682;
 yy262:
-		yych = *++cursor_;
-		if (yych == 'e') goto yy323;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1659;
 yy263:
-		yych = *++cursor_;
-		if (yych == '_') goto yy324;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'o') goto yy381;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy264:
-		yych = *++cursor_;
-		if (yych == 'r') goto yy325;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy383;
+	if (yych == 'o') goto yy382;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy265:
-		yych = *++cursor_;
-		if (yych == 'l') goto yy326;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy385;
+	if (yych == 't') goto yy384;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy266:
-		yych = *++cursor_;
-		if (yych == '_') goto yy327;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy386;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy267:
-		yych = *++cursor_;
-		if (yych == 'n') goto yy328;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'q') goto yy388;
+	if (yych == 't') goto yy389;
+	if (yych == 'u') goto yy387;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy268:
-		yych = *++cursor_;
-		if (yych == 'o') goto yy330;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'b') goto yy391;
+	if (yych == 'd') goto yy390;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy269:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 542 "src/wast-lexer.cc"
-		{ RETURN(TRY); }
-#line 2128 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy394;
+	if (yych == 'i') goto yy393;
+	if (yych == 'u') goto yy392;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy270:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'q') goto yy395;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy271:
-		yych = *++cursor_;
-		if (yych == 'e') goto yy331;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy397;
+	if (yych == 'i') goto yy396;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy272:
-		yych = *++cursor_;
-		if (yych == 'e') goto yy333;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy398;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy273:
-		++cursor_;
-		if ((limit_ - cursor_) < 3) FILL(3);
-		yych = *cursor_;
-		if (yych <= '9') {
-			if (yych <= '\'') {
-				if (yych == '!') goto yy86;
-				if (yych <= '"') goto yy146;
-				goto yy86;
-			} else {
-				if (yych <= '-') {
-					if (yych <= ')') goto yy146;
-					goto yy86;
-				} else {
-					if (yych <= '.') goto yy275;
-					if (yych <= '/') goto yy86;
-					goto yy273;
-				}
-			}
-		} else {
-			if (yych <= '`') {
-				if (yych <= ';') {
-					if (yych <= ':') goto yy86;
-					goto yy146;
-				} else {
-					if (yych <= '@') goto yy86;
-					if (yych <= 'F') goto yy273;
-					goto yy86;
-				}
-			} else {
-				if (yych <= 'o') {
-					if (yych <= 'f') goto yy273;
-					goto yy86;
-				} else {
-					if (yych <= 'p') goto yy277;
-					if (yych <= '~') goto yy86;
-					goto yy146;
-				}
-			}
-		}
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy399;
+	if (yych == 'o') goto yy401;
+	if (yych == 't') goto yy400;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy274:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy402;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy275:
-		++cursor_;
-		if ((limit_ - cursor_) < 3) FILL(3);
-		yych = *cursor_;
-		if (yych <= ':') {
-			if (yych <= '\'') {
-				if (yych == '!') goto yy86;
-				if (yych <= '"') goto yy88;
-				goto yy86;
-			} else {
-				if (yych <= ')') goto yy88;
-				if (yych <= '/') goto yy86;
-				if (yych <= '9') goto yy275;
-				goto yy86;
-			}
-		} else {
-			if (yych <= '`') {
-				if (yych <= ';') goto yy88;
-				if (yych <= '@') goto yy86;
-				if (yych <= 'F') goto yy275;
-				goto yy86;
-			} else {
-				if (yych <= 'o') {
-					if (yych <= 'f') goto yy275;
-					goto yy86;
-				} else {
-					if (yych <= 'p') goto yy277;
-					if (yych <= '~') goto yy86;
-					goto yy88;
-				}
-			}
-		}
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy403;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy276:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '.') goto yy404;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1688;
 yy277:
-		yych = *++cursor_;
-		if (yych <= ',') {
-			if (yych == '+') goto yy334;
-			goto yy87;
-		} else {
-			if (yych <= '-') goto yy334;
-			if (yych <= '/') goto yy87;
-			if (yych <= '9') goto yy335;
-			goto yy87;
-		}
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy406;
+	if (yych == 'o') goto yy405;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy278:
-		yych = *++cursor_;
-		if (yych == 'n') goto yy338;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy407;
+	if (yych == 't') goto yy408;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy279:
-		yych = *++cursor_;
-		if (yych == 'u') goto yy339;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy409;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy280:
-		yych = *++cursor_;
-		if (yych == 'r') goto yy340;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy410;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy281:
-		yych = *++cursor_;
-		if (yych == 'r') goto yy341;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'q') goto yy412;
+	if (yych == 't') goto yy413;
+	if (yych == 'u') goto yy411;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy282:
-		yych = *++cursor_;
-		if (yych == 'k') goto yy342;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'b') goto yy414;
+	if (yych == 'd') goto yy415;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy283:
-		yych = *++cursor_;
-		if (yych == 'f') goto yy344;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy417;
+	if (yych == 'i') goto yy416;
+	if (yych == 'u') goto yy418;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy284:
-		yych = *++cursor_;
-		if (yych == 'a') goto yy346;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'q') goto yy419;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy285:
-		++cursor_;
-		if ((yych = *cursor_) <= ')') {
-			if (yych <= '!') {
-				if (yych >= '!') goto yy86;
-			} else {
-				if (yych <= '"') goto yy286;
-				if (yych <= '\'') goto yy86;
-			}
-		} else {
-			if (yych <= '^') {
-				if (yych != ';') goto yy86;
-			} else {
-				if (yych <= '_') goto yy347;
-				if (yych <= '~') goto yy86;
-			}
-		}
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'i') goto yy420;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy286:
-#line 345 "src/wast-lexer.cc"
-		{ RETURN(CALL); }
-#line 2268 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy421;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy287:
-		yych = *++cursor_;
-		if (yych == 'h') goto yy348;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy423;
+	if (yych == 'o') goto yy422;
+	if (yych == 't') goto yy424;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy288:
-		yych = *++cursor_;
-		if (yych == 'e') goto yy350;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy425;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy289:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 524 "src/wast-lexer.cc"
-		{ RETURN(DATA); }
-#line 2284 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy426;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy290:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '.') goto yy427;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1689;
 yy291:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 347 "src/wast-lexer.cc"
-		{ RETURN(DROP); }
-#line 2292 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1652;
+yy292:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'n') goto yy428;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy293:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 523 "src/wast-lexer.cc"
-		{ RETURN(ELEM); }
-#line 2300 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'o') goto yy429;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy294:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy430;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy295:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 340 "src/wast-lexer.cc"
-		{ RETURN(ELSE); }
-#line 2308 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy431;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy296:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1654;
 yy297:
-		yych = *++cursor_;
-		if (yych == 'p') goto yy351;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy432;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy298:
-		yych = *++cursor_;
-		if (yych == 'r') goto yy352;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'o') goto yy433;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy299:
-		yych = *++cursor_;
-		switch (yych) {
-		case 'a':	goto yy353;
-		case 'c':	goto yy354;
-		case 'd':	goto yy355;
-		case 'e':	goto yy356;
-		case 'f':	goto yy357;
-		case 'g':	goto yy358;
-		case 'l':	goto yy359;
-		case 'm':	goto yy360;
-		case 'n':	goto yy361;
-		case 'r':	goto yy362;
-		case 's':	goto yy363;
-		case 't':	goto yy364;
-		default:	goto yy87;
-		}
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'm') goto yy434;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy300:
-		yych = *++cursor_;
-		switch (yych) {
-		case 'a':	goto yy365;
-		case 'c':	goto yy366;
-		case 'd':	goto yy367;
-		case 'e':	goto yy368;
-		case 'f':	goto yy369;
-		case 'g':	goto yy370;
-		case 'l':	goto yy371;
-		case 'm':	goto yy372;
-		case 'n':	goto yy373;
-		case 'p':	goto yy374;
-		case 'r':	goto yy375;
-		case 's':	goto yy376;
-		case 't':	goto yy377;
-		default:	goto yy87;
-		}
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy435;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy301:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 512 "src/wast-lexer.cc"
-		{ RETURN(FUNC); }
-#line 2359 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'y') goto yy436;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy302:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy437;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy303:
-		yych = *++cursor_;
-		if (yych == 'g') goto yy378;
-		if (yych == 'l') goto yy379;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1475;
 yy304:
-		yych = *++cursor_;
-		if (yych == 'a') goto yy380;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'b') goto yy438;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy305:
-		yych = *++cursor_;
-		if (yych == '_') goto yy381;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'y') goto yy439;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy306:
-		yych = *++cursor_;
-		switch (yych) {
-		case 'a':	goto yy382;
-		case 'c':	goto yy383;
-		case 'd':	goto yy384;
-		case 'e':	goto yy385;
-		case 'g':	goto yy386;
-		case 'l':	goto yy387;
-		case 'm':	goto yy388;
-		case 'n':	goto yy389;
-		case 'o':	goto yy390;
-		case 'p':	goto yy391;
-		case 'r':	goto yy392;
-		case 's':	goto yy393;
-		case 't':	goto yy394;
-		case 'w':	goto yy395;
-		case 'x':	goto yy396;
-		default:	goto yy87;
-		}
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1469;
 yy307:
-		yych = *++cursor_;
-		switch (yych) {
-		case 'a':	goto yy397;
-		case 'c':	goto yy398;
-		case 'd':	goto yy399;
-		case 'e':	goto yy400;
-		case 'g':	goto yy401;
-		case 'l':	goto yy402;
-		case 'm':	goto yy403;
-		case 'n':	goto yy404;
-		case 'o':	goto yy405;
-		case 'p':	goto yy406;
-		case 'r':	goto yy407;
-		case 's':	goto yy408;
-		case 't':	goto yy409;
-		case 'x':	goto yy410;
-		default:	goto yy87;
-		}
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1658;
 yy308:
-		yych = *++cursor_;
-		if (yych == 'r') goto yy411;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy440;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy309:
-		yych = *++cursor_;
-		if (yych == 'k') goto yy412;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'o') goto yy441;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy310:
-		yych = *++cursor_;
-		if (yych == 'l') goto yy413;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy442;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy311:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 341 "src/wast-lexer.cc"
-		{ RETURN(LOOP); }
-#line 2431 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1661;
+yy312:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'd') goto yy443;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy313:
-		yych = *++cursor_;
-		if (yych == 'r') goto yy415;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy444;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy314:
-		yych = *++cursor_;
-		if (yych == 'l') goto yy416;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy445;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy315:
-		yych = *++cursor_;
-		if (yych == '0') goto yy417;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy446;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy316:
-		yych = *++cursor_;
-		if (yych == 'e') goto yy418;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'x') goto yy447;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy317:
-		yych = *++cursor_;
-		if (yych == 'm') goto yy419;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy448;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy318:
-		yych = *++cursor_;
-		if (yych == 'e') goto yy421;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '=') goto yy449;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy319:
-		yych = *++cursor_;
-		if (yych == 's') goto yy423;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'n') goto yy450;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy320:
-		yych = *++cursor_;
-		if (yych == 'l') goto yy424;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy451;
+	if (yych == 'n') goto yy455;
+	if (yybm[0+yych] & 64) {
+		goto yy28;
+	}
+	if (yych <= 'c') {
+		if (yych <= ';') {
+			goto yy1800;
+		} else {
+			if (yych <= 'a') goto yy453;
+			goto yy452;
+		}
+	} else {
+		if (yych <= 's') {
+			if (yych <= 'o') goto yy454;
+			goto yy456;
+		} else {
+			if (yych <= 'x') goto yy457;
+			goto yy1800;
+		}
+	}
 yy321:
-		yych = *++cursor_;
-		if (yych == 'r') goto yy425;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'i') goto yy458;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy322:
-		yych = *++cursor_;
-		if (yych == 'r') goto yy426;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '_') goto yy459;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1680;
 yy323:
-		yych = *++cursor_;
-		if (yych == 'c') goto yy427;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'n') goto yy460;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy324:
-		yych = *++cursor_;
-		if (yych == 'g') goto yy428;
-		if (yych == 'l') goto yy429;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'c') goto yy461;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy325:
-		yych = *++cursor_;
-		if (yych == 't') goto yy430;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'o') goto yy462;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy326:
-		yych = *++cursor_;
-		if (yych == 'e') goto yy432;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'd') goto yy463;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy327:
-		yych = *++cursor_;
-		if (yych == 'l') goto yy434;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'd') goto yy464;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy328:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 339 "src/wast-lexer.cc"
-		{ RETURN(THEN); }
-#line 2500 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'i') goto yy466;
+	if (yych == 'm') goto yy465;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy329:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy467;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy330:
-		yych = *++cursor_;
-		if (yych == 'w') goto yy435;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy468;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy331:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 511 "src/wast-lexer.cc"
-		{ RETURN(TYPE); }
-#line 2512 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '_') goto yy469;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy332:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '_') goto yy470;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy333:
-		yych = *++cursor_;
-		if (yych == 'a') goto yy437;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'z') goto yy471;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1587;
 yy334:
-		yych = *++cursor_;
-		if (yych <= '/') goto yy87;
-		if (yych >= ':') goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1559;
 yy335:
-		++cursor_;
-		if (limit_ <= cursor_) FILL(1);
-		yych = *cursor_;
-		if (yych <= ')') {
-			if (yych <= '!') {
-				if (yych >= '!') goto yy86;
-			} else {
-				if (yych <= '"') goto yy337;
-				if (yych <= '\'') goto yy86;
-			}
-		} else {
-			if (yych <= ':') {
-				if (yych <= '/') goto yy86;
-				if (yych <= '9') goto yy335;
-				goto yy86;
-			} else {
-				if (yych <= ';') goto yy337;
-				if (yych <= '~') goto yy86;
-			}
-		}
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1589;
+yy336:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy472;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy337:
-#line 314 "src/wast-lexer.cc"
-		{ LITERAL(Hexfloat); RETURN(FLOAT); }
-#line 2545 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy474;
+	if (yych == 'r') goto yy473;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy338:
-		yych = *++cursor_;
-		if (yych == '=') goto yy438;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'b') goto yy475;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy339:
-		yych = *++cursor_;
-		if (yych == 'n') goto yy439;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'o') goto yy476;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy340:
-		yych = *++cursor_;
-		if (yych == 't') goto yy440;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy477;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy341:
-		yych = *++cursor_;
-		if (yych == 'y') goto yy441;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'u') goto yy478;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy342:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 337 "src/wast-lexer.cc"
-		{ RETURN(BLOCK); }
-#line 2569 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '_') goto yy479;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy343:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '_') goto yy480;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy344:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 343 "src/wast-lexer.cc"
-		{ RETURN(BR_IF); }
-#line 2577 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'z') goto yy481;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy345:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'n') goto yy482;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy346:
-		yych = *++cursor_;
-		if (yych == 'b') goto yy443;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'z') goto yy483;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy347:
-		yych = *++cursor_;
-		if (yych == 'i') goto yy444;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy484;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy348:
-		++cursor_;
-		if ((yych = *cursor_) <= ')') {
-			if (yych <= '!') {
-				if (yych >= '!') goto yy86;
-			} else {
-				if (yych <= '"') goto yy349;
-				if (yych <= '\'') goto yy86;
-			}
-		} else {
-			if (yych <= '^') {
-				if (yych != ';') goto yy86;
-			} else {
-				if (yych <= '_') goto yy445;
-				if (yych <= '~') goto yy86;
-			}
-		}
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'v') goto yy485;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy349:
-#line 543 "src/wast-lexer.cc"
-		{ RETURN_LPAR(CATCH); }
-#line 2606 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'p') goto yy486;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy350:
-		yych = *++cursor_;
-		if (yych == 'n') goto yy446;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 16) {
+		goto yy28;
+	}
+	if (yych <= 'e') {
+		if (yych <= ';') {
+			goto yy1800;
+		} else {
+			if (yych <= 'a') goto yy490;
+			goto yy491;
+		}
+	} else {
+		if (yych <= 'r') {
+			if (yych <= 'm') goto yy487;
+			goto yy489;
+		} else {
+			if (yych == 's') goto yy488;
+			goto yy1800;
+		}
+	}
 yy351:
-		yych = *++cursor_;
-		if (yych == 't') goto yy447;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'o') goto yy492;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy352:
-		yych = *++cursor_;
-		if (yych == 't') goto yy449;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'd') goto yy493;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy353:
-		yych = *++cursor_;
-		if (yych == 'b') goto yy451;
-		if (yych == 'd') goto yy452;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'd') goto yy494;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy354:
-		yych = *++cursor_;
-		if (yych == 'e') goto yy453;
-		if (yych == 'o') goto yy454;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'p') goto yy495;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy355:
-		yych = *++cursor_;
-		if (yych == 'e') goto yy455;
-		if (yych == 'i') goto yy456;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'i') goto yy496;
+	if (yych == 'm') goto yy497;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy356:
-		yych = *++cursor_;
-		if (yych == 'q') goto yy457;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy498;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy357:
-		yych = *++cursor_;
-		if (yych == 'l') goto yy459;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '_') goto yy499;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy358:
-		yych = *++cursor_;
-		if (yych == 'e') goto yy460;
-		if (yych == 't') goto yy462;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy500;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy359:
-		yych = *++cursor_;
-		if (yych <= 'n') {
-			if (yych == 'e') goto yy464;
-			goto yy87;
-		} else {
-			if (yych <= 'o') goto yy466;
-			if (yych == 't') goto yy467;
-			goto yy87;
-		}
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '_') goto yy501;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy360:
-		yych = *++cursor_;
-		if (yych <= 'h') {
-			if (yych == 'a') goto yy469;
-			goto yy87;
-		} else {
-			if (yych <= 'i') goto yy470;
-			if (yych == 'u') goto yy471;
-			goto yy87;
-		}
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'z') goto yy502;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1588;
 yy361:
-		yych = *++cursor_;
-		if (yych == 'e') goto yy472;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy503;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy362:
-		yych = *++cursor_;
-		if (yych == 'e') goto yy474;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1560;
 yy363:
-		yych = *++cursor_;
-		if (yych <= 's') {
-			if (yych == 'q') goto yy475;
-			goto yy87;
-		} else {
-			if (yych <= 't') goto yy476;
-			if (yych <= 'u') goto yy477;
-			goto yy87;
-		}
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1590;
 yy364:
-		yych = *++cursor_;
-		if (yych == 'r') goto yy478;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy504;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy365:
-		yych = *++cursor_;
-		if (yych == 'b') goto yy479;
-		if (yych == 'd') goto yy480;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy506;
+	if (yych == 'r') goto yy505;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy366:
-		yych = *++cursor_;
-		if (yych == 'e') goto yy481;
-		if (yych == 'o') goto yy482;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'o') goto yy507;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy367:
-		yych = *++cursor_;
-		if (yych == 'i') goto yy483;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'b') goto yy508;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy368:
-		yych = *++cursor_;
-		if (yych == 'q') goto yy484;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'u') goto yy509;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy369:
-		yych = *++cursor_;
-		if (yych == 'l') goto yy486;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '_') goto yy510;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy370:
-		yych = *++cursor_;
-		if (yych == 'e') goto yy487;
-		if (yych == 't') goto yy489;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '_') goto yy511;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy371:
-		yych = *++cursor_;
-		if (yych <= 'n') {
-			if (yych == 'e') goto yy491;
-			goto yy87;
-		} else {
-			if (yych <= 'o') goto yy493;
-			if (yych == 't') goto yy494;
-			goto yy87;
-		}
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'n') goto yy512;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy372:
-		yych = *++cursor_;
-		if (yych <= 'h') {
-			if (yych == 'a') goto yy496;
-			goto yy87;
-		} else {
-			if (yych <= 'i') goto yy497;
-			if (yych == 'u') goto yy498;
-			goto yy87;
-		}
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'z') goto yy513;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy373:
-		yych = *++cursor_;
-		if (yych == 'e') goto yy499;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'z') goto yy514;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy374:
-		yych = *++cursor_;
-		if (yych == 'r') goto yy501;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy515;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy375:
-		yych = *++cursor_;
-		if (yych == 'e') goto yy502;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'v') goto yy516;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy376:
-		yych = *++cursor_;
-		if (yych <= 's') {
-			if (yych == 'q') goto yy503;
-			goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 16) {
+		goto yy28;
+	}
+	if (yych <= 'e') {
+		if (yych <= ';') {
+			goto yy1800;
 		} else {
-			if (yych <= 't') goto yy504;
-			if (yych <= 'u') goto yy505;
-			goto yy87;
+			if (yych <= 'a') goto yy519;
+			goto yy517;
+		}
+	} else {
+		if (yych <= 'r') {
+			if (yych <= 'm') goto yy518;
+			goto yy520;
+		} else {
+			if (yych == 's') goto yy521;
+			goto yy1800;
 		}
+	}
 yy377:
-		yych = *++cursor_;
-		if (yych == 'r') goto yy506;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1669;
 yy378:
-		yych = *++cursor_;
-		if (yych == 'l') goto yy507;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1665;
 yy379:
-		yych = *++cursor_;
-		if (yych == 'o') goto yy508;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy522;
+	if (yych == 's') goto yy523;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy380:
-		yych = *++cursor_;
-		if (yych == 'l') goto yy509;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy525;
+	if (yych == 'm') goto yy526;
+	if (yych == 's') goto yy524;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy381:
-		yych = *++cursor_;
-		if (yych == 'm') goto yy511;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'c') goto yy527;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy382:
-		yych = *++cursor_;
-		if (yych == 'd') goto yy512;
-		if (yych == 'n') goto yy513;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'n') goto yy529;
+	if (yych == 'p') goto yy528;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy383:
-		yych = *++cursor_;
-		if (yych <= 'n') {
-			if (yych == 'l') goto yy514;
-			goto yy87;
-		} else {
-			if (yych <= 'o') goto yy515;
-			if (yych == 't') goto yy516;
-			goto yy87;
-		}
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'i') goto yy530;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy384:
-		yych = *++cursor_;
-		if (yych == 'i') goto yy517;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1615;
 yy385:
-		yych = *++cursor_;
-		if (yych == 'q') goto yy518;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1617;
 yy386:
-		yych = *++cursor_;
-		if (yych == 'e') goto yy520;
-		if (yych == 't') goto yy521;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy531;
+	if (yych == 'g') goto yy532;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1609;
 yy387:
-		yych = *++cursor_;
-		if (yych <= 'n') {
-			if (yych == 'e') goto yy522;
-			goto yy87;
-		} else {
-			if (yych <= 'o') goto yy523;
-			if (yych == 't') goto yy524;
-			goto yy87;
-		}
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'b') goto yy533;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy388:
-		yych = *++cursor_;
-		if (yych == 'u') goto yy525;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy534;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy389:
-		yych = *++cursor_;
-		if (yych == 'e') goto yy526;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'o') goto yy535;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy390:
-		yych = *++cursor_;
-		if (yych == 'r') goto yy528;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'd') goto yy536;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy391:
-		yych = *++cursor_;
-		if (yych == 'o') goto yy530;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 's') goto yy537;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy392:
-		yych = *++cursor_;
-		if (yych == 'e') goto yy531;
-		if (yych == 'o') goto yy532;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy538;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy393:
-		yych = *++cursor_;
-		if (yych <= 's') {
-			if (yych == 'h') goto yy533;
-			goto yy87;
-		} else {
-			if (yych <= 't') goto yy534;
-			if (yych <= 'u') goto yy535;
-			goto yy87;
-		}
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'n') goto yy539;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy394:
-		yych = *++cursor_;
-		if (yych == 'r') goto yy536;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'x') goto yy540;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy395:
-		yych = *++cursor_;
-		if (yych == 'r') goto yy537;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1607;
 yy396:
-		yych = *++cursor_;
-		if (yych == 'o') goto yy538;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'v') goto yy541;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy397:
-		yych = *++cursor_;
-		if (yych == 'd') goto yy539;
-		if (yych == 'n') goto yy540;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'm') goto yy542;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy398:
-		yych = *++cursor_;
-		if (yych <= 'n') {
-			if (yych == 'l') goto yy541;
-			goto yy87;
-		} else {
-			if (yych <= 'o') goto yy542;
-			if (yych == 't') goto yy543;
-			goto yy87;
-		}
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'o') goto yy543;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy399:
-		yych = *++cursor_;
-		if (yych == 'i') goto yy544;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1613;
 yy400:
-		yych = *++cursor_;
-		if (yych == 'q') goto yy545;
-		if (yych == 'x') goto yy547;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1611;
 yy401:
-		yych = *++cursor_;
-		if (yych == 'e') goto yy548;
-		if (yych == 't') goto yy549;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy544;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy402:
-		yych = *++cursor_;
-		if (yych <= 'n') {
-			if (yych == 'e') goto yy550;
-			goto yy87;
-		} else {
-			if (yych <= 'o') goto yy551;
-			if (yych == 't') goto yy552;
-			goto yy87;
-		}
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'i') goto yy545;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy403:
-		yych = *++cursor_;
-		if (yych == 'u') goto yy553;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'u') goto yy546;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy404:
-		yych = *++cursor_;
-		if (yych == 'e') goto yy554;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'd') goto yy550;
+	if (yybm[0+yych] & 16) {
+		goto yy28;
+	}
+	if (yych <= 'e') {
+		if (yych <= ';') {
+			goto yy1800;
+		} else {
+			if (yych <= 'a') goto yy551;
+			goto yy549;
+		}
+	} else {
+		if (yych <= 'r') {
+			if (yych <= 'm') goto yy548;
+			goto yy552;
+		} else {
+			if (yych == 's') goto yy547;
+			goto yy1800;
+		}
+	}
 yy405:
-		yych = *++cursor_;
-		if (yych == 'r') goto yy556;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'n') goto yy553;
+	if (yych == 'p') goto yy554;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy406:
-		yych = *++cursor_;
-		if (yych == 'o') goto yy558;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'i') goto yy555;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy407:
-		yych = *++cursor_;
-		if (yych == 'e') goto yy559;
-		if (yych == 'o') goto yy560;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1618;
 yy408:
-		yych = *++cursor_;
-		if (yych <= 's') {
-			if (yych == 'h') goto yy561;
-			goto yy87;
-		} else {
-			if (yych <= 't') goto yy562;
-			if (yych <= 'u') goto yy563;
-			goto yy87;
-		}
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1616;
 yy409:
-		yych = *++cursor_;
-		if (yych == 'r') goto yy564;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy557;
+	if (yych == 'g') goto yy556;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1610;
 yy410:
-		yych = *++cursor_;
-		if (yych == 'o') goto yy565;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'i') goto yy558;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy411:
-		yych = *++cursor_;
-		if (yych == 't') goto yy566;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'b') goto yy559;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy412:
-		yych = *++cursor_;
-		if (yych == 'e') goto yy568;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy560;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy413:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 515 "src/wast-lexer.cc"
-		{ RETURN(LOCAL); }
-#line 2952 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'o') goto yy561;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy414:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 's') goto yy562;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy415:
-		yych = *++cursor_;
-		if (yych == 'y') goto yy570;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'd') goto yy563;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy416:
-		yych = *++cursor_;
-		if (yych == 'e') goto yy572;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'n') goto yy564;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy417:
-		yych = *++cursor_;
-		if (yych == 'x') goto yy574;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'x') goto yy565;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy418:
-		yych = *++cursor_;
-		if (yych == 't') goto yy575;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy566;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy419:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 513 "src/wast-lexer.cc"
-		{ RETURN(PARAM); }
-#line 2976 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1608;
+yy420:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'v') goto yy567;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy421:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 519 "src/wast-lexer.cc"
-		{ RETURN(QUOTE); }
-#line 2984 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'o') goto yy568;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy422:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy569;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy423:
-		yych = *++cursor_;
-		if (yych == 't') goto yy577;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1614;
 yy424:
-		yych = *++cursor_;
-		if (yych == 't') goto yy578;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1612;
 yy425:
-		yych = *++cursor_;
-		if (yych == 'o') goto yy580;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'o') goto yy570;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy426:
-		yych = *++cursor_;
-		if (yych == 'n') goto yy581;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'u') goto yy571;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy427:
-		yych = *++cursor_;
-		if (yych == 't') goto yy583;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'd') goto yy576;
+	if (yybm[0+yych] & 16) {
+		goto yy28;
+	}
+	if (yych <= 'e') {
+		if (yych <= ';') {
+			goto yy1800;
+		} else {
+			if (yych <= 'a') goto yy577;
+			goto yy575;
+		}
+	} else {
+		if (yych <= 'r') {
+			if (yych <= 'm') goto yy574;
+			goto yy572;
+		} else {
+			if (yych == 's') goto yy573;
+			goto yy1800;
+		}
+	}
 yy428:
-		yych = *++cursor_;
-		if (yych == 'l') goto yy585;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '_') goto yy578;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1483;
 yy429:
-		yych = *++cursor_;
-		if (yych == 'o') goto yy586;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'w') goto yy579;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy430:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 522 "src/wast-lexer.cc"
-		{ RETURN(START); }
-#line 3020 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy580;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy431:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1653;
 yy432:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 520 "src/wast-lexer.cc"
-		{ RETURN(TABLE); }
-#line 3028 "src/prebuilt/wast-lexer-gen.cc"
-yy434:
-		yych = *++cursor_;
-		if (yych == 'o') goto yy587;
-		goto yy87;
-yy435:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 545 "src/wast-lexer.cc"
-		{ RETURN(THROW); }
-#line 3040 "src/prebuilt/wast-lexer-gen.cc"
-yy437:
-		yych = *++cursor_;
-		if (yych == 'c') goto yy588;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'o') goto yy581;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy433:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'c') goto yy582;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy434:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy583;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy435:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1655;
+yy436:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '.') goto yy584;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1660;
+yy437:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1656;
 yy438:
-		yych = *++cursor_;
-		if (yych <= '/') goto yy87;
-		if (yych <= '0') goto yy589;
-		if (yych <= '9') goto yy591;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy585;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy439:
-		yych = *++cursor_;
-		if (yych == 'c') goto yy593;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1657;
 yy440:
-		yych = *++cursor_;
-		if (yych == '_') goto yy595;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'o') goto yy586;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy441:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 518 "src/wast-lexer.cc"
-		{ RETURN(BIN); }
-#line 3066 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'c') goto yy587;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy442:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1644;
 yy443:
-		yych = *++cursor_;
-		if (yych == 'l') goto yy596;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1728;
 yy444:
-		yych = *++cursor_;
-		if (yych == 'n') goto yy597;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1666;
 yy445:
-		yych = *++cursor_;
-		if (yych == 'a') goto yy598;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1667;
 yy446:
-		yych = *++cursor_;
-		if (yych == 't') goto yy599;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '=') goto yy588;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1664;
 yy447:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 528 "src/wast-lexer.cc"
-		{ RETURN(EXCEPT); }
-#line 3090 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[256+yych] & 32) {
+		goto yy28;
+	}
+	if (yybm[512+yych] & 1) {
+		goto yy589;
+	}
+	goto yy1800;
+yy448:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '_') goto yy590;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy449:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 527 "src/wast-lexer.cc"
-		{ RETURN(EXPORT); }
-#line 3098 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[256+yych] & 4) {
+		goto yy28;
+	}
+	if (yych <= '0') {
+		if (yych <= ')') goto yy1800;
+		goto yy591;
+	} else {
+		if (yych <= '9') goto yy592;
+		goto yy1800;
+	}
+yy450:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'c') goto yy593;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy451:
-		yych = *++cursor_;
-		if (yych == 's') goto yy600;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'o') goto yy594;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy452:
-		yych = *++cursor_;
-		if (yych == 'd') goto yy602;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'o') goto yy595;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy453:
-		yych = *++cursor_;
-		if (yych == 'i') goto yy604;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'n') goto yy596;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy454:
-		yych = *++cursor_;
-		if (yych == 'n') goto yy605;
-		if (yych == 'p') goto yy606;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy597;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy455:
-		yych = *++cursor_;
-		if (yych == 'm') goto yy607;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'o') goto yy598;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy456:
-		yych = *++cursor_;
-		if (yych == 'v') goto yy608;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy599;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy457:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 470 "src/wast-lexer.cc"
-		{ OPCODE(F32Eq); RETURN(COMPARE); }
-#line 3131 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'o') goto yy600;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy458:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'n') goto yy601;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy459:
-		yych = *++cursor_;
-		if (yych == 'o') goto yy610;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy602;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy460:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 480 "src/wast-lexer.cc"
-		{ OPCODE(F32Ge); RETURN(COMPARE); }
-#line 3143 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy603;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy461:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'h') goto yy604;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy462:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 478 "src/wast-lexer.cc"
-		{ OPCODE(F32Gt); RETURN(COMPARE); }
-#line 3151 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'm') goto yy605;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy463:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1543;
 yy464:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 476 "src/wast-lexer.cc"
-		{ OPCODE(F32Le); RETURN(COMPARE); }
-#line 3159 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1557;
+yy465:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '_') goto yy606;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy466:
-		yych = *++cursor_;
-		if (yych == 'a') goto yy611;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'n') goto yy607;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy467:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 474 "src/wast-lexer.cc"
-		{ OPCODE(F32Lt); RETURN(COMPARE); }
-#line 3171 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy608;
+	if (yych == 'r') goto yy609;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy468:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'd') goto yy610;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy469:
-		yych = *++cursor_;
-		if (yych == 'x') goto yy612;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 's') goto yy611;
+	if (yych == 'u') goto yy612;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy470:
-		yych = *++cursor_;
-		if (yych == 'n') goto yy614;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 's') goto yy614;
+	if (yych == 'u') goto yy613;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy471:
-		yych = *++cursor_;
-		if (yych == 'l') goto yy616;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1521;
 yy472:
-		++cursor_;
-		if ((yych = *cursor_) <= ':') {
-			if (yych <= '"') {
-				if (yych == '!') goto yy86;
-			} else {
-				if (yych <= '\'') goto yy86;
-				if (yych >= '*') goto yy86;
-			}
-		} else {
-			if (yych <= 'a') {
-				if (yych <= ';') goto yy473;
-				if (yych <= '`') goto yy86;
-				goto yy618;
-			} else {
-				if (yych == 'g') goto yy619;
-				if (yych <= '~') goto yy86;
-			}
-		}
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1561;
 yy473:
-#line 472 "src/wast-lexer.cc"
-		{ OPCODE(F32Ne); RETURN(COMPARE); }
-#line 3206 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '_') goto yy615;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy474:
-		yych = *++cursor_;
-		if (yych == 'i') goto yy621;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1563;
 yy475:
-		yych = *++cursor_;
-		if (yych == 'r') goto yy622;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1545;
 yy476:
-		yych = *++cursor_;
-		if (yych == 'o') goto yy623;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy616;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy477:
-		yych = *++cursor_;
-		if (yych == 'b') goto yy624;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'p') goto yy617;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy478:
-		yych = *++cursor_;
-		if (yych == 'u') goto yy626;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'n') goto yy618;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy479:
-		yych = *++cursor_;
-		if (yych == 's') goto yy627;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 's') goto yy619;
+	if (yych == 'u') goto yy620;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy480:
-		yych = *++cursor_;
-		if (yych == 'd') goto yy629;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 's') goto yy621;
+	if (yych == 'u') goto yy622;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy481:
-		yych = *++cursor_;
-		if (yych == 'i') goto yy631;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1523;
 yy482:
-		yych = *++cursor_;
-		if (yych == 'n') goto yy632;
-		if (yych == 'p') goto yy633;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 's') goto yy623;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy483:
-		yych = *++cursor_;
-		if (yych == 'v') goto yy634;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1525;
 yy484:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 471 "src/wast-lexer.cc"
-		{ OPCODE(F64Eq); RETURN(COMPARE); }
-#line 3255 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1547;
+yy485:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '_') goto yy624;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy486:
-		yych = *++cursor_;
-		if (yych == 'o') goto yy636;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'c') goto yy625;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy487:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 481 "src/wast-lexer.cc"
-		{ OPCODE(F64Ge); RETURN(COMPARE); }
-#line 3267 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'u') goto yy626;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy488:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'p') goto yy627;
+	if (yych == 'u') goto yy628;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy489:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 479 "src/wast-lexer.cc"
-		{ OPCODE(F64Gt); RETURN(COMPARE); }
-#line 3275 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy629;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy490:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'd') goto yy630;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy491:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 477 "src/wast-lexer.cc"
-		{ OPCODE(F64Le); RETURN(COMPARE); }
-#line 3283 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'x') goto yy631;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy492:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'm') goto yy632;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy493:
-		yych = *++cursor_;
-		if (yych == 'a') goto yy637;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1558;
 yy494:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 475 "src/wast-lexer.cc"
-		{ OPCODE(F64Lt); RETURN(COMPARE); }
-#line 3295 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1544;
+yy495:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'c') goto yy633;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy496:
-		yych = *++cursor_;
-		if (yych == 'x') goto yy638;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'n') goto yy634;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy497:
-		yych = *++cursor_;
-		if (yych == 'n') goto yy640;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '_') goto yy635;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy498:
-		yych = *++cursor_;
-		if (yych == 'l') goto yy642;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy636;
+	if (yych == 'r') goto yy637;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy499:
-		++cursor_;
-		if ((yych = *cursor_) <= ':') {
-			if (yych <= '"') {
-				if (yych == '!') goto yy86;
-			} else {
-				if (yych <= '\'') goto yy86;
-				if (yych >= '*') goto yy86;
-			}
-		} else {
-			if (yych <= 'a') {
-				if (yych <= ';') goto yy500;
-				if (yych <= '`') goto yy86;
-				goto yy644;
-			} else {
-				if (yych == 'g') goto yy645;
-				if (yych <= '~') goto yy86;
-			}
-		}
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 's') goto yy638;
+	if (yych == 'u') goto yy639;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy500:
-#line 473 "src/wast-lexer.cc"
-		{ OPCODE(F64Ne); RETURN(COMPARE); }
-#line 3330 "src/prebuilt/wast-lexer-gen.cc"
-yy501:
-		yych = *++cursor_;
-		if (yych == 'o') goto yy647;
-		goto yy87;
-yy502:
-		yych = *++cursor_;
-		if (yych == 'i') goto yy648;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'd') goto yy640;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy501:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 's') goto yy641;
+	if (yych == 'u') goto yy642;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy502:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1522;
 yy503:
-		yych = *++cursor_;
-		if (yych == 'r') goto yy649;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy643;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy504:
-		yych = *++cursor_;
-		if (yych == 'o') goto yy650;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1562;
 yy505:
-		yych = *++cursor_;
-		if (yych == 'b') goto yy651;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '_') goto yy644;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy506:
-		yych = *++cursor_;
-		if (yych == 'u') goto yy653;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1564;
 yy507:
-		yych = *++cursor_;
-		if (yych == 'o') goto yy654;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy645;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy508:
-		yych = *++cursor_;
-		if (yych == 'c') goto yy655;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1546;
 yy509:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 516 "src/wast-lexer.cc"
-		{ RETURN(GLOBAL); }
-#line 3370 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'n') goto yy646;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy510:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 's') goto yy648;
+	if (yych == 'u') goto yy647;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy511:
-		yych = *++cursor_;
-		if (yych == 'e') goto yy656;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 's') goto yy649;
+	if (yych == 'u') goto yy650;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy512:
-		yych = *++cursor_;
-		if (yych == 'd') goto yy657;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 's') goto yy651;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy513:
-		yych = *++cursor_;
-		if (yych == 'd') goto yy659;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1524;
 yy514:
-		yych = *++cursor_;
-		if (yych == 'z') goto yy661;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1526;
 yy515:
-		yych = *++cursor_;
-		if (yych == 'n') goto yy663;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1548;
 yy516:
-		yych = *++cursor_;
-		if (yych == 'z') goto yy664;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '_') goto yy652;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy517:
-		yych = *++cursor_;
-		if (yych == 'v') goto yy666;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'x') goto yy653;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy518:
-		++cursor_;
-		if ((yych = *cursor_) <= ')') {
-			if (yych <= '!') {
-				if (yych >= '!') goto yy86;
-			} else {
-				if (yych <= '"') goto yy519;
-				if (yych <= '\'') goto yy86;
-			}
-		} else {
-			if (yych <= 'y') {
-				if (yych != ';') goto yy86;
-			} else {
-				if (yych <= 'z') goto yy667;
-				if (yych <= '~') goto yy86;
-			}
-		}
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'u') goto yy654;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy519:
-#line 450 "src/wast-lexer.cc"
-		{ OPCODE(I32Eq); RETURN(COMPARE); }
-#line 3419 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'd') goto yy655;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy520:
-		yych = *++cursor_;
-		if (yych == '_') goto yy669;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy656;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy521:
-		yych = *++cursor_;
-		if (yych == '_') goto yy670;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'p') goto yy657;
+	if (yych == 'u') goto yy658;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy522:
-		yych = *++cursor_;
-		if (yych == '_') goto yy671;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'd') goto yy659;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy523:
-		yych = *++cursor_;
-		if (yych == 'a') goto yy672;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'p') goto yy660;
+	if (yych == 'u') goto yy661;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy524:
-		yych = *++cursor_;
-		if (yych == '_') goto yy673;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'p') goto yy662;
+	if (yych == 'u') goto yy663;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy525:
-		yych = *++cursor_;
-		if (yych == 'l') goto yy674;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'd') goto yy664;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy526:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 452 "src/wast-lexer.cc"
-		{ OPCODE(I32Ne); RETURN(COMPARE); }
-#line 3451 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'u') goto yy665;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy527:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy666;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy528:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 422 "src/wast-lexer.cc"
-		{ OPCODE(I32Or); RETURN(BINARY); }
-#line 3459 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'y') goto yy667;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy529:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 's') goto yy669;
+	if (yych == 'v') goto yy668;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy530:
-		yych = *++cursor_;
-		if (yych == 'p') goto yy676;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy670;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy531:
-		yych = *++cursor_;
-		if (yych == 'i') goto yy677;
-		if (yych == 'm') goto yy678;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy671;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy532:
-		yych = *++cursor_;
-		if (yych == 't') goto yy679;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1529;
 yy533:
-		yych = *++cursor_;
-		if (yych == 'l') goto yy680;
-		if (yych == 'r') goto yy682;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1575;
 yy534:
-		yych = *++cursor_;
-		if (yych == 'o') goto yy683;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy672;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy535:
-		yych = *++cursor_;
-		if (yych == 'b') goto yy684;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy673;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy536:
-		yych = *++cursor_;
-		if (yych == 'u') goto yy686;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1573;
 yy537:
-		yych = *++cursor_;
-		if (yych == 'a') goto yy687;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1531;
 yy538:
-		yych = *++cursor_;
-		if (yych == 'r') goto yy688;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1577;
 yy539:
-		yych = *++cursor_;
-		if (yych == 'd') goto yy690;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1581;
 yy540:
-		yych = *++cursor_;
-		if (yych == 'd') goto yy692;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1583;
 yy541:
-		yych = *++cursor_;
-		if (yych == 'z') goto yy694;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1579;
 yy542:
-		yych = *++cursor_;
-		if (yych == 'n') goto yy696;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'o') goto yy674;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy543:
-		yych = *++cursor_;
-		if (yych == 'z') goto yy697;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'o') goto yy675;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy544:
-		yych = *++cursor_;
-		if (yych == 'v') goto yy699;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'd') goto yy676;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy545:
-		++cursor_;
-		if ((yych = *cursor_) <= ')') {
-			if (yych <= '!') {
-				if (yych >= '!') goto yy86;
-			} else {
-				if (yych <= '"') goto yy546;
-				if (yych <= '\'') goto yy86;
-			}
-		} else {
-			if (yych <= 'y') {
-				if (yych != ';') goto yy86;
-			} else {
-				if (yych <= 'z') goto yy700;
-				if (yych <= '~') goto yy86;
-			}
-		}
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'n') goto yy677;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy546:
-#line 451 "src/wast-lexer.cc"
-		{ OPCODE(I64Eq); RETURN(COMPARE); }
-#line 3542 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'n') goto yy678;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy547:
-		yych = *++cursor_;
-		if (yych == 't') goto yy702;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'p') goto yy679;
+	if (yych == 'u') goto yy680;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy548:
-		yych = *++cursor_;
-		if (yych == '_') goto yy703;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'u') goto yy681;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy549:
-		yych = *++cursor_;
-		if (yych == '_') goto yy704;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'x') goto yy682;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy550:
-		yych = *++cursor_;
-		if (yych == '_') goto yy705;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'i') goto yy683;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy551:
-		yych = *++cursor_;
-		if (yych == 'a') goto yy706;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'd') goto yy684;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy552:
-		yych = *++cursor_;
-		if (yych == '_') goto yy707;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy685;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy553:
-		yych = *++cursor_;
-		if (yych == 'l') goto yy708;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 's') goto yy687;
+	if (yych == 'v') goto yy686;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy554:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 453 "src/wast-lexer.cc"
-		{ OPCODE(I64Ne); RETURN(COMPARE); }
-#line 3578 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'y') goto yy688;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy555:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy689;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy556:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 423 "src/wast-lexer.cc"
-		{ OPCODE(I64Or); RETURN(BINARY); }
-#line 3586 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1530;
+yy557:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy690;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy558:
-		yych = *++cursor_;
-		if (yych == 'p') goto yy710;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'n') goto yy691;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy559:
-		yych = *++cursor_;
-		if (yych == 'i') goto yy711;
-		if (yych == 'm') goto yy712;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1576;
 yy560:
-		yych = *++cursor_;
-		if (yych == 't') goto yy713;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy692;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy561:
-		yych = *++cursor_;
-		if (yych == 'l') goto yy714;
-		if (yych == 'r') goto yy716;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy693;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy562:
-		yych = *++cursor_;
-		if (yych == 'o') goto yy717;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1532;
 yy563:
-		yych = *++cursor_;
-		if (yych == 'b') goto yy718;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1574;
 yy564:
-		yych = *++cursor_;
-		if (yych == 'u') goto yy720;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1582;
 yy565:
-		yych = *++cursor_;
-		if (yych == 'r') goto yy721;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1584;
 yy566:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 526 "src/wast-lexer.cc"
-		{ RETURN(IMPORT); }
-#line 3628 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1578;
+yy567:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1580;
 yy568:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 530 "src/wast-lexer.cc"
-		{ RETURN(INVOKE); }
-#line 3636 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'o') goto yy694;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy569:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'd') goto yy695;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy570:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 521 "src/wast-lexer.cc"
-		{ RETURN(MEMORY); }
-#line 3644 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'm') goto yy696;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy571:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'n') goto yy697;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy572:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 517 "src/wast-lexer.cc"
-		{ RETURN(MODULE); }
-#line 3652 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy698;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy573:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'p') goto yy699;
+	if (yych == 'u') goto yy700;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy574:
-		yych = *++cursor_;
-		if (yych <= '@') {
-			if (yych <= '/') goto yy87;
-			if (yych <= '9') goto yy723;
-			goto yy87;
-		} else {
-			if (yych <= 'F') goto yy723;
-			if (yych <= '`') goto yy87;
-			if (yych <= 'f') goto yy723;
-			goto yy87;
-		}
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'u') goto yy701;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy575:
-		++cursor_;
-		if ((yych = *cursor_) <= ')') {
-			if (yych <= '!') {
-				if (yych >= '!') goto yy86;
-			} else {
-				if (yych <= '"') goto yy576;
-				if (yych <= '\'') goto yy86;
-			}
-		} else {
-			if (yych <= '<') {
-				if (yych != ';') goto yy86;
-			} else {
-				if (yych <= '=') goto yy725;
-				if (yych <= '~') goto yy86;
-			}
-		}
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'x') goto yy702;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy576:
-#line 525 "src/wast-lexer.cc"
-		{ RETURN(OFFSET); }
-#line 3685 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'i') goto yy703;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy577:
-		yych = *++cursor_;
-		if (yych == 'e') goto yy726;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'd') goto yy704;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy578:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 514 "src/wast-lexer.cc"
-		{ RETURN(RESULT); }
-#line 3697 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'c') goto yy705;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy579:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1683;
 yy580:
-		yych = *++cursor_;
-		if (yych == 'w') goto yy727;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy706;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy581:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 349 "src/wast-lexer.cc"
-		{ RETURN(RETURN); }
-#line 3709 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'b') goto yy707;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy582:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy708;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy583:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 507 "src/wast-lexer.cc"
-		{ RETURN(SELECT); }
-#line 3717 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'm') goto yy709;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy584:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy712;
+	if (yych == 'c') goto yy710;
+	if (yych == 'f') goto yy711;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy585:
-		yych = *++cursor_;
-		if (yych == 'o') goto yy729;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy713;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy586:
-		yych = *++cursor_;
-		if (yych == 'c') goto yy730;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'b') goto yy714;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy587:
-		yych = *++cursor_;
-		if (yych == 'c') goto yy731;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy715;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy588:
-		yych = *++cursor_;
-		if (yych == 'h') goto yy732;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[256+yych] & 4) {
+		goto yy28;
+	}
+	if (yych <= '0') {
+		if (yych <= ')') goto yy1800;
+		goto yy716;
+	} else {
+		if (yych <= '9') goto yy717;
+		goto yy1800;
+	}
 yy589:
-		++cursor_;
-		if ((yych = *cursor_) <= '/') {
-			if (yych <= '"') {
-				if (yych == '!') goto yy86;
-			} else {
-				if (yych <= '\'') goto yy86;
-				if (yych >= '*') goto yy86;
-			}
+	++cursor_;
+	if (limit_ <= cursor_) FILL(1);
+	yych = *cursor_;
+	if (yybm[256+yych] & 32) {
+		goto yy28;
+	}
+	if (yybm[512+yych] & 1) {
+		goto yy589;
+	}
+	goto yy1458;
+yy590:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[256+yych] & 1) {
+		goto yy28;
+	}
+	if (yych <= 'm') {
+		if (yych <= 'e') {
+			if (yych <= ';') goto yy1800;
+			goto yy722;
 		} else {
-			if (yych <= ';') {
-				if (yych <= '9') goto yy591;
-				if (yych <= ':') goto yy86;
-			} else {
-				if (yych == 'x') goto yy733;
-				if (yych <= '~') goto yy86;
-			}
+			if (yych <= 'i') goto yy718;
+			goto yy721;
 		}
-yy590:
-#line 379 "src/wast-lexer.cc"
-		{ SetTextAt(6); RETURN(ALIGN_EQ_NAT); }
-#line 3755 "src/prebuilt/wast-lexer-gen.cc"
-yy591:
-		++cursor_;
-		if (limit_ <= cursor_) FILL(1);
-		yych = *cursor_;
-		if (yych <= ')') {
-			if (yych <= '!') {
-				if (yych <= ' ') goto yy590;
-				goto yy86;
-			} else {
-				if (yych <= '"') goto yy590;
-				if (yych <= '\'') goto yy86;
-				goto yy590;
-			}
+	} else {
+		if (yych <= 't') {
+			if (yych <= 'r') goto yy719;
+			goto yy720;
 		} else {
-			if (yych <= ':') {
-				if (yych <= '/') goto yy86;
-				if (yych <= '9') goto yy591;
-				goto yy86;
-			} else {
-				if (yych <= ';') goto yy590;
-				if (yych <= '~') goto yy86;
-				goto yy590;
-			}
+			if (yych == 'u') goto yy723;
+			goto yy1800;
 		}
+	}
+yy591:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'x') goto yy724;
+	if (yybm[256+yych] & 4) {
+		goto yy28;
+	}
+	if (yych <= ')') {
+		goto yy1515;
+	} else {
+		if (yych <= '9') goto yy592;
+		goto yy1515;
+	}
+yy592:
+	++cursor_;
+	if (limit_ <= cursor_) FILL(1);
+	yych = *cursor_;
+	if (yybm[256+yych] & 4) {
+		goto yy28;
+	}
+	if (yych <= ')') {
+		goto yy1515;
+	} else {
+		if (yych <= '9') goto yy592;
+		goto yy1515;
+	}
 yy593:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 334 "src/wast-lexer.cc"
-		{ RETURN(ANYFUNC); }
-#line 3787 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1466;
+yy594:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy725;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy595:
-		yych = *++cursor_;
-		switch (yych) {
-		case 'e':	goto yy734;
-		case 'i':	goto yy735;
-		case 'm':	goto yy736;
-		case 'r':	goto yy737;
-		case 't':	goto yy738;
-		case 'u':	goto yy739;
-		default:	goto yy87;
-		}
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'n') goto yy726;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy596:
-		yych = *++cursor_;
-		if (yych == 'e') goto yy740;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'd') goto yy727;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy597:
-		yych = *++cursor_;
-		if (yych == 'd') goto yy742;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1707;
 yy598:
-		yych = *++cursor_;
-		if (yych == 'l') goto yy743;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy728;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy599:
-		yych = *++cursor_;
-		if (yych == '_') goto yy744;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'o') goto yy729;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy600:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 394 "src/wast-lexer.cc"
-		{ OPCODE(F32Abs); RETURN(UNARY); }
-#line 3822 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy730;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy601:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'd') goto yy731;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy602:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 436 "src/wast-lexer.cc"
-		{ OPCODE(F32Add); RETURN(BINARY); }
-#line 3830 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy732;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy603:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '_') goto yy733;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy604:
-		yych = *++cursor_;
-		if (yych == 'l') goto yy745;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy734;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy605:
-		yych = *++cursor_;
-		if (yych == 's') goto yy747;
-		if (yych == 'v') goto yy748;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'i') goto yy735;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy606:
-		yych = *++cursor_;
-		if (yych == 'y') goto yy749;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 's') goto yy736;
+	if (yych == 'u') goto yy737;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy607:
-		yych = *++cursor_;
-		if (yych == 'o') goto yy750;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy738;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy608:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 442 "src/wast-lexer.cc"
-		{ OPCODE(F32Div); RETURN(BINARY); }
-#line 3855 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1569;
+yy609:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1571;
 yy610:
-		yych = *++cursor_;
-		if (yych == 'o') goto yy751;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '1') goto yy740;
+	if (yych == '8') goto yy739;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1489;
 yy611:
-		yych = *++cursor_;
-		if (yych == 'd') goto yy752;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1591;
 yy612:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 446 "src/wast-lexer.cc"
-		{ OPCODE(F32Max); RETURN(BINARY); }
-#line 3871 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1593;
+yy613:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1597;
 yy614:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 444 "src/wast-lexer.cc"
-		{ OPCODE(F32Min); RETURN(BINARY); }
-#line 3879 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1595;
+yy615:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 's') goto yy741;
+	if (yych == 'u') goto yy742;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy616:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 440 "src/wast-lexer.cc"
-		{ OPCODE(F32Mul); RETURN(BINARY); }
-#line 3887 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy743;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy617:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '/') goto yy744;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy618:
-		yych = *++cursor_;
-		if (yych == 'r') goto yy754;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'c') goto yy745;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy619:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 392 "src/wast-lexer.cc"
-		{ OPCODE(F32Neg); RETURN(UNARY); }
-#line 3899 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1599;
+yy620:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1601;
 yy621:
-		yych = *++cursor_;
-		if (yych == 'n') goto yy755;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1603;
 yy622:
-		yych = *++cursor_;
-		if (yych == 't') goto yy756;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1605;
 yy623:
-		yych = *++cursor_;
-		if (yych == 'r') goto yy758;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy746;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy624:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 438 "src/wast-lexer.cc"
-		{ OPCODE(F32Sub); RETURN(BINARY); }
-#line 3919 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 's') goto yy747;
+	if (yych == 'u') goto yy748;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy625:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'n') goto yy749;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy626:
-		yych = *++cursor_;
-		if (yych == 'n') goto yy759;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy750;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy627:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 395 "src/wast-lexer.cc"
-		{ OPCODE(F64Abs); RETURN(UNARY); }
-#line 3931 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy751;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy628:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'b') goto yy752;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy629:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 437 "src/wast-lexer.cc"
-		{ OPCODE(F64Add); RETURN(BINARY); }
-#line 3939 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'p') goto yy753;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy630:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'd') goto yy754;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy631:
-		yych = *++cursor_;
-		if (yych == 'l') goto yy760;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy755;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy632:
-		yych = *++cursor_;
-		if (yych == 's') goto yy762;
-		if (yych == 'v') goto yy763;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'i') goto yy756;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy633:
-		yych = *++cursor_;
-		if (yych == 'y') goto yy764;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'n') goto yy757;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy634:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 443 "src/wast-lexer.cc"
-		{ OPCODE(F64Div); RETURN(BINARY); }
-#line 3960 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy758;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy635:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 's') goto yy760;
+	if (yych == 'u') goto yy759;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy636:
-		yych = *++cursor_;
-		if (yych == 'o') goto yy765;
-		goto yy87;
-yy637:
-		yych = *++cursor_;
-		if (yych == 'd') goto yy766;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1570;
+yy637:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1572;
 yy638:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 447 "src/wast-lexer.cc"
-		{ OPCODE(F64Max); RETURN(BINARY); }
-#line 3976 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1592;
+yy639:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1594;
 yy640:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 445 "src/wast-lexer.cc"
-		{ OPCODE(F64Min); RETURN(BINARY); }
-#line 3984 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '1') goto yy763;
+	if (yych == '3') goto yy762;
+	if (yych == '8') goto yy761;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1490;
+yy641:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1596;
 yy642:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 441 "src/wast-lexer.cc"
-		{ OPCODE(F64Mul); RETURN(BINARY); }
-#line 3992 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1598;
+yy643:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'n') goto yy764;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy644:
-		yych = *++cursor_;
-		if (yych == 'r') goto yy768;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 's') goto yy765;
+	if (yych == 'u') goto yy766;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy645:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 393 "src/wast-lexer.cc"
-		{ OPCODE(F64Neg); RETURN(UNARY); }
-#line 4004 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy767;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy646:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'c') goto yy768;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy647:
-		yych = *++cursor_;
-		if (yych == 'm') goto yy769;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1606;
 yy648:
-		yych = *++cursor_;
-		if (yych == 'n') goto yy770;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1604;
 yy649:
-		yych = *++cursor_;
-		if (yych == 't') goto yy771;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1600;
 yy650:
-		yych = *++cursor_;
-		if (yych == 'r') goto yy773;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1602;
 yy651:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 439 "src/wast-lexer.cc"
-		{ OPCODE(F64Sub); RETURN(BINARY); }
-#line 4028 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy769;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy652:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 's') goto yy770;
+	if (yych == 'u') goto yy771;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy653:
-		yych = *++cursor_;
-		if (yych == 'n') goto yy774;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy772;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy654:
-		yych = *++cursor_;
-		if (yych == 'b') goto yy775;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy773;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy655:
-		yych = *++cursor_;
-		if (yych == 'a') goto yy776;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'd') goto yy774;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy656:
-		yych = *++cursor_;
-		if (yych == 'm') goto yy777;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'p') goto yy775;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy657:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 406 "src/wast-lexer.cc"
-		{ OPCODE(I32Add); RETURN(BINARY); }
-#line 4052 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy776;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy658:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'b') goto yy777;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy659:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 420 "src/wast-lexer.cc"
-		{ OPCODE(I32And); RETURN(BINARY); }
-#line 4060 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'd') goto yy778;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy660:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy779;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy661:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 386 "src/wast-lexer.cc"
-		{ OPCODE(I32Clz); RETURN(UNARY); }
-#line 4068 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'b') goto yy780;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy662:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy781;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy663:
-		yych = *++cursor_;
-		if (yych == 's') goto yy778;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'b') goto yy782;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy664:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 388 "src/wast-lexer.cc"
-		{ OPCODE(I32Ctz); RETURN(UNARY); }
-#line 4080 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'd') goto yy783;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy665:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy784;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy666:
-		yych = *++cursor_;
-		if (yych == '_') goto yy779;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy785;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy667:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 384 "src/wast-lexer.cc"
-		{ OPCODE(I32Eqz); RETURN(CONVERT); }
-#line 4092 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 's') goto yy786;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy668:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy787;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy669:
-		yych = *++cursor_;
-		if (yych == 's') goto yy780;
-		if (yych == 'u') goto yy782;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy788;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy670:
-		yych = *++cursor_;
-		if (yych == 's') goto yy784;
-		if (yych == 'u') goto yy786;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1535;
 yy671:
-		yych = *++cursor_;
-		if (yych == 's') goto yy788;
-		if (yych == 'u') goto yy790;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy789;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy672:
-		yych = *++cursor_;
-		if (yych == 'd') goto yy792;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1533;
 yy673:
-		yych = *++cursor_;
-		if (yych == 's') goto yy794;
-		if (yych == 'u') goto yy796;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy790;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy674:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 410 "src/wast-lexer.cc"
-		{ OPCODE(I32Mul); RETURN(BINARY); }
-#line 4124 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy791;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy675:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy792;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy676:
-		yych = *++cursor_;
-		if (yych == 'c') goto yy798;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1491;
 yy677:
-		yych = *++cursor_;
-		if (yych == 'n') goto yy799;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy793;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy678:
-		yych = *++cursor_;
-		if (yych == '_') goto yy800;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'c') goto yy794;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy679:
-		yych = *++cursor_;
-		if (yych == 'l') goto yy801;
-		if (yych == 'r') goto yy803;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy795;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy680:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 426 "src/wast-lexer.cc"
-		{ OPCODE(I32Shl); RETURN(BINARY); }
-#line 4149 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'b') goto yy796;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy681:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy797;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy682:
-		yych = *++cursor_;
-		if (yych == '_') goto yy805;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy798;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy683:
-		yych = *++cursor_;
-		if (yych == 'r') goto yy806;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'v') goto yy799;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy684:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 408 "src/wast-lexer.cc"
-		{ OPCODE(I32Sub); RETURN(BINARY); }
-#line 4165 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'd') goto yy800;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy685:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'p') goto yy801;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy686:
-		yych = *++cursor_;
-		if (yych == 'n') goto yy807;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy802;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy687:
-		yych = *++cursor_;
-		if (yych == 'p') goto yy808;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy803;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy688:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 424 "src/wast-lexer.cc"
-		{ OPCODE(I32Xor); RETURN(BINARY); }
-#line 4181 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 's') goto yy804;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy689:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1536;
 yy690:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 407 "src/wast-lexer.cc"
-		{ OPCODE(I64Add); RETURN(BINARY); }
-#line 4189 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy805;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy691:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy806;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy692:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 421 "src/wast-lexer.cc"
-		{ OPCODE(I64And); RETURN(BINARY); }
-#line 4197 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1534;
+yy693:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy807;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy694:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 387 "src/wast-lexer.cc"
-		{ OPCODE(I64Clz); RETURN(UNARY); }
-#line 4205 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy808;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy695:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1492;
 yy696:
-		yych = *++cursor_;
-		if (yych == 's') goto yy809;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'o') goto yy809;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy697:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 389 "src/wast-lexer.cc"
-		{ OPCODE(I64Ctz); RETURN(UNARY); }
-#line 4217 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'c') goto yy810;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy698:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'p') goto yy811;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy699:
-		yych = *++cursor_;
-		if (yych == '_') goto yy810;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy812;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy700:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 385 "src/wast-lexer.cc"
-		{ OPCODE(I64Eqz); RETURN(CONVERT); }
-#line 4229 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'b') goto yy813;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy701:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy814;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy702:
-		yych = *++cursor_;
-		if (yych == 'e') goto yy811;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy815;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy703:
-		yych = *++cursor_;
-		if (yych == 's') goto yy812;
-		if (yych == 'u') goto yy814;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'v') goto yy816;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy704:
-		yych = *++cursor_;
-		if (yych == 's') goto yy816;
-		if (yych == 'u') goto yy818;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'd') goto yy817;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy705:
-		yych = *++cursor_;
-		if (yych == 's') goto yy820;
-		if (yych == 'u') goto yy822;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy818;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy706:
-		yych = *++cursor_;
-		if (yych == 'd') goto yy824;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1668;
 yy707:
-		yych = *++cursor_;
-		if (yych == 's') goto yy826;
-		if (yych == 'u') goto yy828;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy819;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy708:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 411 "src/wast-lexer.cc"
-		{ OPCODE(I64Mul); RETURN(BINARY); }
-#line 4265 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy820;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy709:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'o') goto yy821;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy710:
-		yych = *++cursor_;
-		if (yych == 'c') goto yy830;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'o') goto yy822;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy711:
-		yych = *++cursor_;
-		if (yych == 'n') goto yy831;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'i') goto yy823;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy712:
-		yych = *++cursor_;
-		if (yych == '_') goto yy832;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy824;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy713:
-		yych = *++cursor_;
-		if (yych == 'l') goto yy833;
-		if (yych == 'r') goto yy835;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1476;
 yy714:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 427 "src/wast-lexer.cc"
-		{ OPCODE(I64Shl); RETURN(BINARY); }
-#line 4290 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy825;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy715:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy826;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy716:
-		yych = *++cursor_;
-		if (yych == '_') goto yy837;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'x') goto yy827;
+	if (yybm[256+yych] & 4) {
+		goto yy28;
+	}
+	if (yych <= ')') {
+		goto yy1514;
+	} else {
+		if (yych <= '9') goto yy717;
+		goto yy1514;
+	}
 yy717:
-		yych = *++cursor_;
-		if (yych == 'r') goto yy838;
-		goto yy87;
+	++cursor_;
+	if (limit_ <= cursor_) FILL(1);
+	yych = *cursor_;
+	if (yybm[256+yych] & 4) {
+		goto yy28;
+	}
+	if (yych <= ')') {
+		goto yy1514;
+	} else {
+		if (yych <= '9') goto yy717;
+		goto yy1514;
+	}
 yy718:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 409 "src/wast-lexer.cc"
-		{ OPCODE(I64Sub); RETURN(BINARY); }
-#line 4306 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'n') goto yy828;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy719:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy829;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy720:
-		yych = *++cursor_;
-		if (yych == 'n') goto yy839;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy830;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy721:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 425 "src/wast-lexer.cc"
-		{ OPCODE(I64Xor); RETURN(BINARY); }
-#line 4318 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy831;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy722:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'x') goto yy832;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy723:
-		++cursor_;
-		if (limit_ <= cursor_) FILL(1);
-		yych = *cursor_;
-		if (yych <= '9') {
-			if (yych <= '"') {
-				if (yych == '!') goto yy86;
-				goto yy253;
-			} else {
-				if (yych <= '\'') goto yy86;
-				if (yych <= ')') goto yy253;
-				if (yych <= '/') goto yy86;
-				goto yy723;
-			}
-		} else {
-			if (yych <= 'F') {
-				if (yych == ';') goto yy253;
-				if (yych <= '@') goto yy86;
-				goto yy723;
-			} else {
-				if (yych <= '`') goto yy86;
-				if (yych <= 'f') goto yy723;
-				if (yych <= '~') goto yy86;
-				goto yy253;
-			}
-		}
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'n') goto yy833;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy724:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[256+yych] & 32) {
+		goto yy28;
+	}
+	if (yybm[512+yych] & 1) {
+		goto yy834;
+	}
+	goto yy1800;
 yy725:
-		yych = *++cursor_;
-		if (yych <= '/') goto yy87;
-		if (yych <= '0') goto yy840;
-		if (yych <= '9') goto yy842;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'd') goto yy835;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy726:
-		yych = *++cursor_;
-		if (yych == 'r') goto yy844;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 's') goto yy836;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy727:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 546 "src/wast-lexer.cc"
-		{ RETURN(RETHROW); }
-#line 4362 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'n') goto yy837;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1705;
+yy728:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1704;
 yy729:
-		yych = *++cursor_;
-		if (yych == 'b') goto yy846;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy838;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy730:
-		yych = *++cursor_;
-		if (yych == 'a') goto yy847;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1708;
 yy731:
-		yych = *++cursor_;
-		if (yych == 'a') goto yy848;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'i') goto yy839;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy732:
-		yych = *++cursor_;
-		if (yych == 'a') goto yy849;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy840;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy733:
-		yych = *++cursor_;
-		if (yych <= '@') {
-			if (yych <= '/') goto yy87;
-			if (yych <= '9') goto yy850;
-			goto yy87;
-		} else {
-			if (yych <= 'F') goto yy850;
-			if (yych <= '`') goto yy87;
-			if (yych <= 'f') goto yy850;
-			goto yy87;
-		}
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'm') goto yy841;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy734:
-		yych = *++cursor_;
-		if (yych == 'x') goto yy852;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'b') goto yy842;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy735:
-		yych = *++cursor_;
-		if (yych == 'n') goto yy853;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'c') goto yy843;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy736:
-		yych = *++cursor_;
-		if (yych == 'a') goto yy854;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1553;
 yy737:
-		yych = *++cursor_;
-		if (yych == 'e') goto yy855;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1555;
 yy738:
-		yych = *++cursor_;
-		if (yych == 'r') goto yy856;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy844;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy739:
-		yych = *++cursor_;
-		if (yych == 'n') goto yy857;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '_') goto yy845;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy740:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 344 "src/wast-lexer.cc"
-		{ RETURN(BR_TABLE); }
-#line 4422 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '6') goto yy846;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy741:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1565;
 yy742:
-		yych = *++cursor_;
-		if (yych == 'i') goto yy858;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1567;
 yy743:
-		yych = *++cursor_;
-		if (yych == 'l') goto yy859;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '1') goto yy848;
+	if (yych == '8') goto yy847;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1494;
 yy744:
-		yych = *++cursor_;
-		if (yych == 'm') goto yy861;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'i') goto yy849;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy745:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 398 "src/wast-lexer.cc"
-		{ OPCODE(F32Ceil); RETURN(UNARY); }
-#line 4442 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '_') goto yy850;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy746:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1516;
 yy747:
-		yych = *++cursor_;
-		if (yych == 't') goto yy862;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1549;
 yy748:
-		yych = *++cursor_;
-		if (yych == 'e') goto yy864;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1551;
 yy749:
-		yych = *++cursor_;
-		if (yych == 's') goto yy865;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy851;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy750:
-		yych = *++cursor_;
-		if (yych == 't') goto yy866;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1716;
 yy751:
-		yych = *++cursor_;
-		if (yych == 'r') goto yy867;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy852;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy752:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 357 "src/wast-lexer.cc"
-		{ OPCODE(F32Load); RETURN(LOAD); }
-#line 4470 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1715;
+yy753:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy853;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy754:
-		yych = *++cursor_;
-		if (yych == 'e') goto yy869;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1714;
 yy755:
-		yych = *++cursor_;
-		if (yych == 't') goto yy870;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy854;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy756:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 396 "src/wast-lexer.cc"
-		{ OPCODE(F32Sqrt); RETURN(UNARY); }
-#line 4486 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'c') goto yy855;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy757:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy856;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy758:
-		yych = *++cursor_;
-		if (yych == 'e') goto yy871;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy857;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy759:
-		yych = *++cursor_;
-		if (yych == 'c') goto yy873;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1556;
 yy760:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 399 "src/wast-lexer.cc"
-		{ OPCODE(F64Ceil); RETURN(UNARY); }
-#line 4502 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1554;
+yy761:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '_') goto yy858;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy762:
-		yych = *++cursor_;
-		if (yych == 't') goto yy875;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '2') goto yy859;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy763:
-		yych = *++cursor_;
-		if (yych == 'e') goto yy877;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '6') goto yy860;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy764:
-		yych = *++cursor_;
-		if (yych == 's') goto yy878;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'd') goto yy861;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy765:
-		yych = *++cursor_;
-		if (yych == 'r') goto yy879;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1566;
 yy766:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 358 "src/wast-lexer.cc"
-		{ OPCODE(F64Load); RETURN(LOAD); }
-#line 4526 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1568;
+yy767:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '1') goto yy862;
+	if (yych == '3') goto yy863;
+	if (yych == '8') goto yy864;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1495;
 yy768:
-		yych = *++cursor_;
-		if (yych == 'e') goto yy881;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '_') goto yy865;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy769:
-		yych = *++cursor_;
-		if (yych == 'o') goto yy882;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1517;
 yy770:
-		yych = *++cursor_;
-		if (yych == 't') goto yy883;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1550;
 yy771:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 397 "src/wast-lexer.cc"
-		{ OPCODE(F64Sqrt); RETURN(UNARY); }
-#line 4546 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1552;
+yy772:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy866;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy773:
-		yych = *++cursor_;
-		if (yych == 'e') goto yy884;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1719;
 yy774:
-		yych = *++cursor_;
-		if (yych == 'c') goto yy886;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1717;
 yy775:
-		yych = *++cursor_;
-		if (yych == 'a') goto yy888;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy867;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy776:
-		yych = *++cursor_;
-		if (yych == 'l') goto yy889;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy868;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy777:
-		yych = *++cursor_;
-		if (yych == 'o') goto yy891;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1718;
 yy778:
-		yych = *++cursor_;
-		if (yych == 't') goto yy892;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1709;
 yy779:
-		yych = *++cursor_;
-		if (yych == 's') goto yy894;
-		if (yych == 'u') goto yy896;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy869;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy780:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 466 "src/wast-lexer.cc"
-		{ OPCODE(I32GeS); RETURN(COMPARE); }
-#line 4583 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1710;
+yy781:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy870;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy782:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 468 "src/wast-lexer.cc"
-		{ OPCODE(I32GeU); RETURN(COMPARE); }
-#line 4591 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1712;
+yy783:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1711;
 yy784:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 462 "src/wast-lexer.cc"
-		{ OPCODE(I32GtS); RETURN(COMPARE); }
-#line 4599 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1713;
+yy785:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1486;
 yy786:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 464 "src/wast-lexer.cc"
-		{ OPCODE(I32GtU); RETURN(COMPARE); }
-#line 4607 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'i') goto yy871;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy787:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy872;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy788:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 458 "src/wast-lexer.cc"
-		{ OPCODE(I32LeS); RETURN(COMPARE); }
-#line 4615 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1518;
+yy789:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 's') goto yy873;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy790:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 460 "src/wast-lexer.cc"
-		{ OPCODE(I32LeU); RETURN(COMPARE); }
-#line 4623 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1496;
+yy791:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy874;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy792:
-		++cursor_;
-		if ((yych = *cursor_) <= '0') {
-			if (yych <= '"') {
-				if (yych == '!') goto yy86;
-			} else {
-				if (yych <= '\'') goto yy86;
-				if (yych >= '*') goto yy86;
-			}
-		} else {
-			if (yych <= '8') {
-				if (yych <= '1') goto yy898;
-				if (yych <= '7') goto yy86;
-				goto yy899;
-			} else {
-				if (yych == ';') goto yy793;
-				if (yych <= '~') goto yy86;
-			}
-		}
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1537;
 yy793:
-#line 355 "src/wast-lexer.cc"
-		{ OPCODE(I32Load); RETURN(LOAD); }
-#line 4646 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy875;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy794:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 454 "src/wast-lexer.cc"
-		{ OPCODE(I32LtS); RETURN(COMPARE); }
-#line 4654 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1539;
+yy795:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy876;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy796:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 456 "src/wast-lexer.cc"
-		{ OPCODE(I32LtU); RETURN(COMPARE); }
-#line 4662 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1721;
+yy797:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1722;
 yy798:
-		yych = *++cursor_;
-		if (yych == 'n') goto yy900;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy877;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy799:
-		yych = *++cursor_;
-		if (yych == 't') goto yy901;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1723;
 yy800:
-		yych = *++cursor_;
-		if (yych == 's') goto yy902;
-		if (yych == 'u') goto yy904;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1720;
 yy801:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 432 "src/wast-lexer.cc"
-		{ OPCODE(I32Rotl); RETURN(BINARY); }
-#line 4683 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy878;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy802:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy879;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy803:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 434 "src/wast-lexer.cc"
-		{ OPCODE(I32Rotr); RETURN(BINARY); }
-#line 4691 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1519;
+yy804:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'i') goto yy880;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy805:
-		yych = *++cursor_;
-		if (yych == 's') goto yy906;
-		if (yych == 'u') goto yy908;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 's') goto yy881;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy806:
-		yych = *++cursor_;
-		if (yych == 'e') goto yy910;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy882;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy807:
-		yych = *++cursor_;
-		if (yych == 'c') goto yy912;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1497;
 yy808:
-		yych = *++cursor_;
-		if (yych == '/') goto yy913;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1538;
 yy809:
-		yych = *++cursor_;
-		if (yych == 't') goto yy914;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy883;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy810:
-		yych = *++cursor_;
-		if (yych == 's') goto yy916;
-		if (yych == 'u') goto yy918;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1540;
 yy811:
-		yych = *++cursor_;
-		if (yych == 'n') goto yy920;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy884;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy812:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 467 "src/wast-lexer.cc"
-		{ OPCODE(I64GeS); RETURN(COMPARE); }
-#line 4729 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy885;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy813:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1725;
 yy814:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 469 "src/wast-lexer.cc"
-		{ OPCODE(I64GeU); RETURN(COMPARE); }
-#line 4737 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1726;
+yy815:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy886;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy816:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 463 "src/wast-lexer.cc"
-		{ OPCODE(I64GtS); RETURN(COMPARE); }
-#line 4745 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1727;
+yy817:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1724;
 yy818:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 465 "src/wast-lexer.cc"
-		{ OPCODE(I64GtU); RETURN(COMPARE); }
-#line 4753 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy887;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy819:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy888;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy820:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 459 "src/wast-lexer.cc"
-		{ OPCODE(I64LeS); RETURN(COMPARE); }
-#line 4761 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1484;
+yy821:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy889;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy822:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 461 "src/wast-lexer.cc"
-		{ OPCODE(I64LeU); RETURN(COMPARE); }
-#line 4769 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'p') goto yy890;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy823:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy891;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy824:
-		++cursor_;
-		if ((yych = *cursor_) <= '1') {
-			if (yych <= '"') {
-				if (yych == '!') goto yy86;
-			} else {
-				if (yych <= '\'') goto yy86;
-				if (yych <= ')') goto yy825;
-				if (yych <= '0') goto yy86;
-				goto yy921;
-			}
-		} else {
-			if (yych <= '8') {
-				if (yych == '3') goto yy922;
-				if (yych <= '7') goto yy86;
-				goto yy923;
-			} else {
-				if (yych == ';') goto yy825;
-				if (yych <= '~') goto yy86;
-			}
-		}
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'o') goto yy892;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy825:
-#line 356 "src/wast-lexer.cc"
-		{ OPCODE(I64Load); RETURN(LOAD); }
-#line 4794 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy893;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy826:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 455 "src/wast-lexer.cc"
-		{ OPCODE(I64LtS); RETURN(COMPARE); }
-#line 4802 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1485;
+yy827:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[256+yych] & 32) {
+		goto yy28;
+	}
+	if (yybm[512+yych] & 1) {
+		goto yy894;
+	}
+	goto yy1800;
 yy828:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 457 "src/wast-lexer.cc"
-		{ OPCODE(I64LtU); RETURN(COMPARE); }
-#line 4810 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'v') goto yy895;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy829:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy896;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy830:
-		yych = *++cursor_;
-		if (yych == 'n') goto yy924;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy897;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy831:
-		yych = *++cursor_;
-		if (yych == 't') goto yy925;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy898;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy832:
-		yych = *++cursor_;
-		if (yych == 's') goto yy926;
-		if (yych == 'u') goto yy928;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'h') goto yy899;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy833:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 433 "src/wast-lexer.cc"
-		{ OPCODE(I64Rotl); RETURN(BINARY); }
-#line 4831 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy900;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy834:
+	++cursor_;
+	if (limit_ <= cursor_) FILL(1);
+	yych = *cursor_;
+	if (yybm[256+yych] & 32) {
+		goto yy28;
+	}
+	if (yybm[512+yych] & 1) {
+		goto yy834;
+	}
+	goto yy1515;
 yy835:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 435 "src/wast-lexer.cc"
-		{ OPCODE(I64Rotr); RETURN(BINARY); }
-#line 4839 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1493;
+yy836:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy901;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy837:
-		yych = *++cursor_;
-		if (yych == 's') goto yy930;
-		if (yych == 'u') goto yy932;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'o') goto yy902;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy838:
-		yych = *++cursor_;
-		if (yych == 'e') goto yy934;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy903;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy839:
-		yych = *++cursor_;
-		if (yych == 'c') goto yy936;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy904;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy840:
-		++cursor_;
-		if ((yych = *cursor_) <= '/') {
-			if (yych <= '"') {
-				if (yych == '!') goto yy86;
-			} else {
-				if (yych <= '\'') goto yy86;
-				if (yych >= '*') goto yy86;
-			}
-		} else {
-			if (yych <= ';') {
-				if (yych <= '9') goto yy842;
-				if (yych <= ':') goto yy86;
-			} else {
-				if (yych == 'x') goto yy937;
-				if (yych <= '~') goto yy86;
-			}
-		}
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1681;
 yy841:
-#line 378 "src/wast-lexer.cc"
-		{ SetTextAt(7); RETURN(OFFSET_EQ_NAT); }
-#line 4874 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy905;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy842:
-		++cursor_;
-		if (limit_ <= cursor_) FILL(1);
-		yych = *cursor_;
-		if (yych <= ')') {
-			if (yych <= '!') {
-				if (yych <= ' ') goto yy841;
-				goto yy86;
-			} else {
-				if (yych <= '"') goto yy841;
-				if (yych <= '\'') goto yy86;
-				goto yy841;
-			}
-		} else {
-			if (yych <= ':') {
-				if (yych <= '/') goto yy86;
-				if (yych <= '9') goto yy842;
-				goto yy86;
-			} else {
-				if (yych <= ';') goto yy841;
-				if (yych <= '~') goto yy86;
-				goto yy841;
-			}
-		}
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy906;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy843:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '.') goto yy907;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy844:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 529 "src/wast-lexer.cc"
-		{ RETURN(REGISTER); }
-#line 4906 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy908;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy845:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 's') goto yy909;
+	if (yych == 'u') goto yy910;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy846:
-		yych = *++cursor_;
-		if (yych == 'a') goto yy938;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '_') goto yy911;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy847:
-		yych = *++cursor_;
-		if (yych == 'l') goto yy939;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1509;
 yy848:
-		yych = *++cursor_;
-		if (yych == 'l') goto yy941;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '6') goto yy912;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy849:
-		yych = *++cursor_;
-		if (yych == 'b') goto yy943;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '6') goto yy913;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy850:
-		++cursor_;
-		if (limit_ <= cursor_) FILL(1);
-		yych = *cursor_;
-		if (yych <= '9') {
-			if (yych <= '"') {
-				if (yych == '!') goto yy86;
-				goto yy590;
-			} else {
-				if (yych <= '\'') goto yy86;
-				if (yych <= ')') goto yy590;
-				if (yych <= '/') goto yy86;
-				goto yy850;
-			}
-		} else {
-			if (yych <= 'F') {
-				if (yych == ';') goto yy590;
-				if (yych <= '@') goto yy86;
-				goto yy850;
-			} else {
-				if (yych <= '`') goto yy86;
-				if (yych <= 'f') goto yy850;
-				if (yych <= '~') goto yy86;
-				goto yy590;
-			}
-		}
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 's') goto yy915;
+	if (yych == 'u') goto yy914;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy851:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1527;
 yy852:
-		yych = *++cursor_;
-		if (yych == 'h') goto yy944;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy916;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy853:
-		yych = *++cursor_;
-		if (yych == 'v') goto yy945;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy917;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy854:
-		yych = *++cursor_;
-		if (yych == 'l') goto yy946;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy918;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy855:
-		yych = *++cursor_;
-		if (yych == 't') goto yy947;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '.') goto yy919;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy856:
-		yych = *++cursor_;
-		if (yych == 'a') goto yy948;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1528;
 yy857:
-		yych = *++cursor_;
-		if (yych == 'l') goto yy949;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy920;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy858:
-		yych = *++cursor_;
-		if (yych == 'r') goto yy950;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 's') goto yy922;
+	if (yych == 'u') goto yy921;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy859:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 544 "src/wast-lexer.cc"
-		{ RETURN_LPAR(CATCH_ALL); }
-#line 4984 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '_') goto yy923;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy860:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '_') goto yy924;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy861:
-		yych = *++cursor_;
-		if (yych == 'e') goto yy951;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '_') goto yy925;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy862:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 382 "src/wast-lexer.cc"
-		{ TYPE(F32); RETURN(CONST); }
-#line 4996 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '6') goto yy926;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy863:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '2') goto yy927;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy864:
-		yych = *++cursor_;
-		if (yych == 'r') goto yy952;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1510;
 yy865:
-		yych = *++cursor_;
-		if (yych == 'i') goto yy953;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 's') goto yy929;
+	if (yych == 'u') goto yy928;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy866:
-		yych = *++cursor_;
-		if (yych == 'e') goto yy954;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy930;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy867:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 400 "src/wast-lexer.cc"
-		{ OPCODE(F32Floor); RETURN(UNARY); }
-#line 5016 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy931;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy868:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy932;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy869:
-		yych = *++cursor_;
-		if (yych == 's') goto yy955;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy933;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy870:
-		yych = *++cursor_;
-		if (yych == 'e') goto yy956;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy934;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy871:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 361 "src/wast-lexer.cc"
-		{ OPCODE(F32Store); RETURN(STORE); }
-#line 5032 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'g') goto yy935;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy872:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy936;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy873:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 402 "src/wast-lexer.cc"
-		{ OPCODE(F32Trunc); RETURN(UNARY); }
-#line 5040 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy937;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy874:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '/') goto yy938;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy875:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 383 "src/wast-lexer.cc"
-		{ TYPE(F64); RETURN(CONST); }
-#line 5048 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy939;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy876:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy940;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy877:
-		yych = *++cursor_;
-		if (yych == 'r') goto yy957;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy941;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy878:
-		yych = *++cursor_;
-		if (yych == 'i') goto yy958;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy942;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy879:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 401 "src/wast-lexer.cc"
-		{ OPCODE(F64Floor); RETURN(UNARY); }
-#line 5064 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy943;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy880:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'g') goto yy944;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy881:
-		yych = *++cursor_;
-		if (yych == 's') goto yy959;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy945;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy882:
-		yych = *++cursor_;
-		if (yych == 't') goto yy960;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy946;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy883:
-		yych = *++cursor_;
-		if (yych == 'e') goto yy961;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy947;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy884:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 362 "src/wast-lexer.cc"
-		{ OPCODE(F64Store); RETURN(STORE); }
-#line 5084 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy948;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy885:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy949;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy886:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 403 "src/wast-lexer.cc"
-		{ OPCODE(F64Trunc); RETURN(UNARY); }
-#line 5092 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy950;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy887:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy951;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy888:
-		yych = *++cursor_;
-		if (yych == 'l') goto yy962;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1487;
 yy889:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 350 "src/wast-lexer.cc"
-		{ RETURN(GET_LOCAL); }
-#line 5104 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'y') goto yy952;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy890:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'y') goto yy953;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy891:
-		yych = *++cursor_;
-		if (yych == 'r') goto yy964;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy954;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy892:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 380 "src/wast-lexer.cc"
-		{ TYPE(I32); RETURN(CONST); }
-#line 5116 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'm') goto yy955;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy893:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1488;
 yy894:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 412 "src/wast-lexer.cc"
-		{ OPCODE(I32DivS); RETURN(BINARY); }
-#line 5124 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	if (limit_ <= cursor_) FILL(1);
+	yych = *cursor_;
+	if (yybm[256+yych] & 32) {
+		goto yy28;
+	}
+	if (yybm[512+yych] & 1) {
+		goto yy894;
+	}
+	goto yy1514;
+yy895:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy956;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy896:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 414 "src/wast-lexer.cc"
-		{ OPCODE(I32DivU); RETURN(BINARY); }
-#line 5132 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'u') goto yy957;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy897:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'p') goto yy958;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy898:
-		yych = *++cursor_;
-		if (yych == '6') goto yy965;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'f') goto yy959;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy899:
-		yych = *++cursor_;
-		if (yych == '_') goto yy966;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy960;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy900:
-		yych = *++cursor_;
-		if (yych == 't') goto yy967;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'i') goto yy961;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy901:
-		yych = *++cursor_;
-		if (yych == 'e') goto yy969;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1520;
 yy902:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 416 "src/wast-lexer.cc"
-		{ OPCODE(I32RemS); RETURN(BINARY); }
-#line 5156 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy962;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy903:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1498;
 yy904:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 418 "src/wast-lexer.cc"
-		{ OPCODE(I32RemU); RETURN(BINARY); }
-#line 5164 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy963;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy905:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'm') goto yy964;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy906:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 428 "src/wast-lexer.cc"
-		{ OPCODE(I32ShrS); RETURN(BINARY); }
-#line 5172 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy965;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy907:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy968;
+	if (yych == 'r') goto yy967;
+	if (yych == 's') goto yy966;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy908:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 430 "src/wast-lexer.cc"
-		{ OPCODE(I32ShrU); RETURN(BINARY); }
-#line 5180 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'p') goto yy969;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy909:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1499;
 yy910:
-		++cursor_;
-		if ((yych = *cursor_) <= '0') {
-			if (yych <= '"') {
-				if (yych == '!') goto yy86;
-			} else {
-				if (yych <= '\'') goto yy86;
-				if (yych >= '*') goto yy86;
-			}
-		} else {
-			if (yych <= '8') {
-				if (yych <= '1') goto yy970;
-				if (yych <= '7') goto yy86;
-				goto yy971;
-			} else {
-				if (yych == ';') goto yy911;
-				if (yych <= '~') goto yy86;
-			}
-		}
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1501;
 yy911:
-#line 359 "src/wast-lexer.cc"
-		{ OPCODE(I32Store); RETURN(STORE); }
-#line 5203 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 's') goto yy970;
+	if (yych == 'u') goto yy971;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy912:
-		yych = *++cursor_;
-		if (yych == '_') goto yy973;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1511;
 yy913:
-		yych = *++cursor_;
-		if (yych == 'i') goto yy974;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '4') goto yy972;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy914:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 381 "src/wast-lexer.cc"
-		{ TYPE(I64); RETURN(CONST); }
-#line 5219 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '/') goto yy973;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy915:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '/') goto yy974;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy916:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 413 "src/wast-lexer.cc"
-		{ OPCODE(I64DivS); RETURN(BINARY); }
-#line 5227 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1692;
+yy917:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'c') goto yy975;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy918:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 415 "src/wast-lexer.cc"
-		{ OPCODE(I64DivU); RETURN(BINARY); }
-#line 5235 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'c') goto yy976;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy919:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy978;
+	if (yych == 'r') goto yy977;
+	if (yych == 's') goto yy979;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy920:
-		yych = *++cursor_;
-		if (yych == 'd') goto yy975;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'p') goto yy980;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy921:
-		yych = *++cursor_;
-		if (yych == '6') goto yy976;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1502;
 yy922:
-		yych = *++cursor_;
-		if (yych == '2') goto yy977;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1500;
 yy923:
-		yych = *++cursor_;
-		if (yych == '_') goto yy978;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 's') goto yy982;
+	if (yych == 'u') goto yy981;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy924:
-		yych = *++cursor_;
-		if (yych == 't') goto yy979;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 's') goto yy983;
+	if (yych == 'u') goto yy984;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy925:
-		yych = *++cursor_;
-		if (yych == 'e') goto yy981;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 's') goto yy985;
+	if (yych == 'u') goto yy986;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy926:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 417 "src/wast-lexer.cc"
-		{ OPCODE(I64RemS); RETURN(BINARY); }
-#line 5267 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1512;
+yy927:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1513;
 yy928:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 419 "src/wast-lexer.cc"
-		{ OPCODE(I64RemU); RETURN(BINARY); }
-#line 5275 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '/') goto yy987;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy929:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '/') goto yy988;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy930:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 429 "src/wast-lexer.cc"
-		{ OPCODE(I64ShrS); RETURN(BINARY); }
-#line 5283 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'c') goto yy989;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy931:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'c') goto yy990;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy932:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 431 "src/wast-lexer.cc"
-		{ OPCODE(I64ShrU); RETURN(BINARY); }
-#line 5291 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1693;
+yy933:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1690;
 yy934:
-		++cursor_;
-		if ((yych = *cursor_) <= '1') {
-			if (yych <= '"') {
-				if (yych == '!') goto yy86;
-			} else {
-				if (yych <= '\'') goto yy86;
-				if (yych <= ')') goto yy935;
-				if (yych <= '0') goto yy86;
-				goto yy982;
-			}
-		} else {
-			if (yych <= '8') {
-				if (yych == '3') goto yy983;
-				if (yych <= '7') goto yy86;
-				goto yy984;
-			} else {
-				if (yych == ';') goto yy935;
-				if (yych <= '~') goto yy86;
-			}
-		}
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1691;
 yy935:
-#line 360 "src/wast-lexer.cc"
-		{ OPCODE(I64Store); RETURN(STORE); }
-#line 5316 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'n') goto yy991;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy936:
-		yych = *++cursor_;
-		if (yych == '_') goto yy986;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '_') goto yy992;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy937:
-		yych = *++cursor_;
-		if (yych <= '@') {
-			if (yych <= '/') goto yy87;
-			if (yych <= '9') goto yy987;
-			goto yy87;
-		} else {
-			if (yych <= 'F') goto yy987;
-			if (yych <= '`') goto yy87;
-			if (yych <= 'f') goto yy987;
-			goto yy87;
-		}
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1541;
 yy938:
-		yych = *++cursor_;
-		if (yych == 'l') goto yy989;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'f') goto yy993;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy939:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 351 "src/wast-lexer.cc"
-		{ RETURN(SET_LOCAL); }
-#line 5344 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'p') goto yy994;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy940:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1694;
 yy941:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 352 "src/wast-lexer.cc"
-		{ RETURN(TEE_LOCAL); }
-#line 5352 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'c') goto yy995;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy942:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'c') goto yy996;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy943:
-		yych = *++cursor_;
-		if (yych == 'l') goto yy991;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '_') goto yy997;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy944:
-		yych = *++cursor_;
-		if (yych == 'a') goto yy992;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'n') goto yy998;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy945:
-		yych = *++cursor_;
-		if (yych == 'a') goto yy993;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1542;
 yy946:
-		yych = *++cursor_;
-		if (yych == 'f') goto yy994;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'p') goto yy999;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy947:
-		yych = *++cursor_;
-		if (yych == 'u') goto yy995;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '/') goto yy1000;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy948:
-		yych = *++cursor_;
-		if (yych == 'p') goto yy996;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'c') goto yy1001;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy949:
-		yych = *++cursor_;
-		if (yych == 'i') goto yy998;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1695;
 yy950:
-		yych = *++cursor_;
-		if (yych == 'e') goto yy999;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'c') goto yy1002;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy951:
-		yych = *++cursor_;
-		if (yych == 'm') goto yy1000;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '_') goto yy1003;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1479;
 yy952:
-		yych = *++cursor_;
-		if (yych == 't') goto yy1001;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1647;
 yy953:
-		yych = *++cursor_;
-		if (yych == 'g') goto yy1002;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1648;
 yy954:
-		yych = *++cursor_;
-		if (yych == '/') goto yy1003;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1649;
 yy955:
-		yych = *++cursor_;
-		if (yych == 't') goto yy1004;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'i') goto yy1004;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy956:
-		yych = *++cursor_;
-		if (yych == 'r') goto yy1006;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy1005;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy957:
-		yych = *++cursor_;
-		if (yych == 't') goto yy1007;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy1006;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy958:
-		yych = *++cursor_;
-		if (yych == 'g') goto yy1008;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1677;
 yy959:
-		yych = *++cursor_;
-		if (yych == 't') goto yy1009;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'o') goto yy1007;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy960:
-		yych = *++cursor_;
-		if (yych == 'e') goto yy1011;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'u') goto yy1008;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy961:
-		yych = *++cursor_;
-		if (yych == 'r') goto yy1012;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'n') goto yy1009;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy962:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 353 "src/wast-lexer.cc"
-		{ RETURN(GET_GLOBAL); }
-#line 5436 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1706;
+yy963:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'c') goto yy1010;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy964:
-		yych = *++cursor_;
-		if (yych == 'y') goto yy1013;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'o') goto yy1011;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy965:
-		yych = *++cursor_;
-		if (yych == '_') goto yy1015;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1645;
 yy966:
-		yych = *++cursor_;
-		if (yych == 's') goto yy1016;
-		if (yych == 'u') goto yy1018;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy1012;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy967:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 390 "src/wast-lexer.cc"
-		{ OPCODE(I32Popcnt); RETURN(UNARY); }
-#line 5457 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'm') goto yy1013;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy968:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'o') goto yy1014;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy969:
-		yych = *++cursor_;
-		if (yych == 'r') goto yy1020;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy1015;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy970:
-		yych = *++cursor_;
-		if (yych == '6') goto yy1021;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1503;
 yy971:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 373 "src/wast-lexer.cc"
-		{ OPCODE(I32Store8); RETURN(STORE); }
-#line 5473 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1505;
+yy972:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1621;
 yy973:
-		yych = *++cursor_;
-		if (yych == 's') goto yy1023;
-		if (yych == 'u') goto yy1024;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'f') goto yy1016;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy974:
-		yych = *++cursor_;
-		if (yych == '6') goto yy1025;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'f') goto yy1017;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy975:
-		yych = *++cursor_;
-		if (yych == '_') goto yy1026;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy1018;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy976:
-		yych = *++cursor_;
-		if (yych == '_') goto yy1027;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy1019;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy977:
-		yych = *++cursor_;
-		if (yych == '_') goto yy1028;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'm') goto yy1020;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy978:
-		yych = *++cursor_;
-		if (yych == 's') goto yy1029;
-		if (yych == 'u') goto yy1031;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'o') goto yy1021;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy979:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 391 "src/wast-lexer.cc"
-		{ OPCODE(I64Popcnt); RETURN(UNARY); }
-#line 5507 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy1022;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy980:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy1023;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy981:
-		yych = *++cursor_;
-		if (yych == 'r') goto yy1033;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1508;
 yy982:
-		yych = *++cursor_;
-		if (yych == '6') goto yy1034;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1507;
 yy983:
-		yych = *++cursor_;
-		if (yych == '2') goto yy1036;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1504;
 yy984:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 374 "src/wast-lexer.cc"
-		{ OPCODE(I64Store8); RETURN(STORE); }
-#line 5527 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1506;
+yy985:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '/') goto yy1024;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy986:
-		yych = *++cursor_;
-		if (yych == 's') goto yy1038;
-		if (yych == 'u') goto yy1039;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '/') goto yy1025;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy987:
-		++cursor_;
-		if (limit_ <= cursor_) FILL(1);
-		yych = *cursor_;
-		if (yych <= '9') {
-			if (yych <= '"') {
-				if (yych == '!') goto yy86;
-				goto yy841;
-			} else {
-				if (yych <= '\'') goto yy86;
-				if (yych <= ')') goto yy841;
-				if (yych <= '/') goto yy86;
-				goto yy987;
-			}
-		} else {
-			if (yych <= 'F') {
-				if (yych == ';') goto yy841;
-				if (yych <= '@') goto yy86;
-				goto yy987;
-			} else {
-				if (yych <= '`') goto yy86;
-				if (yych <= 'f') goto yy987;
-				if (yych <= '~') goto yy86;
-				goto yy841;
-			}
-		}
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'f') goto yy1026;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy988:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'f') goto yy1027;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy989:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 354 "src/wast-lexer.cc"
-		{ RETURN(SET_GLOBAL); }
-#line 5566 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy1028;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy990:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy1029;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy991:
-		yych = *++cursor_;
-		if (yych == 'e') goto yy1040;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1585;
 yy992:
-		yych = *++cursor_;
-		if (yych == 'u') goto yy1042;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 's') goto yy1030;
+	if (yych == 'u') goto yy1031;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy993:
-		yych = *++cursor_;
-		if (yych == 'l') goto yy1043;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '6') goto yy1032;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy994:
-		yych = *++cursor_;
-		if (yych == 'o') goto yy1044;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy1033;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy995:
-		yych = *++cursor_;
-		if (yych == 'r') goto yy1045;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy1034;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy996:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 540 "src/wast-lexer.cc"
-		{ RETURN(ASSERT_TRAP); }
-#line 5594 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy1035;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy997:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 's') goto yy1037;
+	if (yych == 'u') goto yy1036;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy998:
-		yych = *++cursor_;
-		if (yych == 'n') goto yy1046;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1586;
 yy999:
-		yych = *++cursor_;
-		if (yych == 'c') goto yy1047;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy1038;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1000:
-		yych = *++cursor_;
-		if (yych == 'o') goto yy1048;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'f') goto yy1039;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1001:
-		yych = *++cursor_;
-		if (yych == '_') goto yy1049;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy1040;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1002:
-		yych = *++cursor_;
-		if (yych == 'n') goto yy1050;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy1041;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1003:
-		yych = *++cursor_;
-		if (yych == 'f') goto yy1052;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'i') goto yy1042;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1004:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 404 "src/wast-lexer.cc"
-		{ OPCODE(F32Nearest); RETURN(UNARY); }
-#line 5626 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'c') goto yy1043;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1005:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'i') goto yy1044;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1006:
-		yych = *++cursor_;
-		if (yych == 'p') goto yy1053;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'n') goto yy1045;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1007:
-		yych = *++cursor_;
-		if (yych == '_') goto yy1054;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy1046;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1008:
-		yych = *++cursor_;
-		if (yych == 'n') goto yy1055;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 's') goto yy1047;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1009:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 405 "src/wast-lexer.cc"
-		{ OPCODE(F64Nearest); RETURN(UNARY); }
-#line 5646 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'k') goto yy1048;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1010:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy1049;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1011:
-		yych = *++cursor_;
-		if (yych == '/') goto yy1057;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy1050;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1012:
-		yych = *++cursor_;
-		if (yych == 'p') goto yy1058;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'o') goto yy1051;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1013:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 510 "src/wast-lexer.cc"
-		{ RETURN(GROW_MEMORY); }
-#line 5662 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'w') goto yy1052;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1014:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy1053;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1015:
-		yych = *++cursor_;
-		if (yych == 's') goto yy1059;
-		if (yych == 'u') goto yy1061;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy1054;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1016:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 363 "src/wast-lexer.cc"
-		{ OPCODE(I32Load8S); RETURN(LOAD); }
-#line 5675 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '3') goto yy1056;
+	if (yych == '6') goto yy1055;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1017:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '3') goto yy1058;
+	if (yych == '6') goto yy1057;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1018:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 365 "src/wast-lexer.cc"
-		{ OPCODE(I32Load8U); RETURN(LOAD); }
-#line 5683 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '_') goto yy1059;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1019:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '_') goto yy1060;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1020:
-		yych = *++cursor_;
-		if (yych == 'p') goto yy1063;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'w') goto yy1061;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1021:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 375 "src/wast-lexer.cc"
-		{ OPCODE(I32Store16); RETURN(STORE); }
-#line 5695 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy1062;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1022:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'o') goto yy1063;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1023:
-		yych = *++cursor_;
-		if (yych == '/') goto yy1064;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy1064;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1024:
-		yych = *++cursor_;
-		if (yych == '/') goto yy1065;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'i') goto yy1065;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1025:
-		yych = *++cursor_;
-		if (yych == '4') goto yy1066;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'i') goto yy1066;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1026:
-		yych = *++cursor_;
-		if (yych == 's') goto yy1068;
-		if (yych == 'u') goto yy1069;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '3') goto yy1068;
+	if (yych == '6') goto yy1067;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1027:
-		yych = *++cursor_;
-		if (yych == 's') goto yy1070;
-		if (yych == 'u') goto yy1072;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '3') goto yy1069;
+	if (yych == '6') goto yy1070;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1028:
-		yych = *++cursor_;
-		if (yych == 's') goto yy1074;
-		if (yych == 'u') goto yy1076;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '_') goto yy1071;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1029:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 364 "src/wast-lexer.cc"
-		{ OPCODE(I64Load8S); RETURN(LOAD); }
-#line 5730 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '_') goto yy1072;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1030:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '/') goto yy1073;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1031:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 366 "src/wast-lexer.cc"
-		{ OPCODE(I64Load8U); RETURN(LOAD); }
-#line 5738 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '/') goto yy1074;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1032:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '4') goto yy1075;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1033:
-		yych = *++cursor_;
-		if (yych == 'p') goto yy1078;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy1076;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1034:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 376 "src/wast-lexer.cc"
-		{ OPCODE(I64Store16); RETURN(STORE); }
-#line 5750 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '_') goto yy1077;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1035:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '_') goto yy1078;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1036:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 377 "src/wast-lexer.cc"
-		{ OPCODE(I64Store32); RETURN(STORE); }
-#line 5758 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '/') goto yy1079;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1037:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '/') goto yy1080;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1038:
-		yych = *++cursor_;
-		if (yych == '/') goto yy1079;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy1081;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1039:
-		yych = *++cursor_;
-		if (yych == '/') goto yy1080;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '3') goto yy1082;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1040:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 508 "src/wast-lexer.cc"
-		{ RETURN(UNREACHABLE); }
-#line 5774 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '_') goto yy1083;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1041:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '_') goto yy1084;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1042:
-		yych = *++cursor_;
-		if (yych == 's') goto yy1081;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'n') goto yy1085;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1043:
-		yych = *++cursor_;
-		if (yych == 'i') goto yy1082;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '.') goto yy1086;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1044:
-		yych = *++cursor_;
-		if (yych == 'r') goto yy1083;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'd') goto yy1087;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1045:
-		yych = *++cursor_;
-		if (yych == 'n') goto yy1084;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '_') goto yy1088;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1674;
 yy1046:
-		yych = *++cursor_;
-		if (yych == 'k') goto yy1086;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'm') goto yy1089;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1047:
-		yych = *++cursor_;
-		if (yych == 't') goto yy1087;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy1090;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1048:
-		yych = *++cursor_;
-		if (yych == 'r') goto yy1089;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy1091;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1049:
-		yych = *++cursor_;
-		if (yych == 's') goto yy1090;
-		if (yych == 'u') goto yy1091;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1478;
 yy1050:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 448 "src/wast-lexer.cc"
-		{ OPCODE(F32Copysign); RETURN(BINARY); }
-#line 5815 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'y') goto yy1092;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1051:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy1093;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1052:
-		yych = *++cursor_;
-		if (yych == '6') goto yy1092;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '.') goto yy1096;
+	if (yych == '1') goto yy1095;
+	if (yych == '8') goto yy1094;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1053:
-		yych = *++cursor_;
-		if (yych == 'r') goto yy1093;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'd') goto yy1097;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1054:
-		yych = *++cursor_;
-		if (yych == 's') goto yy1094;
-		if (yych == 'u') goto yy1095;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy1098;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1055:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 449 "src/wast-lexer.cc"
-		{ OPCODE(F64Copysign); RETURN(BINARY); }
-#line 5836 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '4') goto yy1099;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1056:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '2') goto yy1100;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1057:
-		yych = *++cursor_;
-		if (yych == 'f') goto yy1096;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '4') goto yy1101;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1058:
-		yych = *++cursor_;
-		if (yych == 'r') goto yy1097;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '2') goto yy1102;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1059:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 367 "src/wast-lexer.cc"
-		{ OPCODE(I32Load16S); RETURN(LOAD); }
-#line 5852 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy1103;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1060:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy1104;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1061:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 369 "src/wast-lexer.cc"
-		{ OPCODE(I32Load16U); RETURN(LOAD); }
-#line 5860 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '.') goto yy1108;
+	if (yych == '1') goto yy1105;
+	if (yych == '3') goto yy1106;
+	if (yych == '8') goto yy1107;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1062:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'd') goto yy1109;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1063:
-		yych = *++cursor_;
-		if (yych == 'r') goto yy1098;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy1110;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1064:
-		yych = *++cursor_;
-		if (yych == 'f') goto yy1099;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy1111;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1065:
-		yych = *++cursor_;
-		if (yych == 'f') goto yy1100;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '3') goto yy1112;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1066:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 484 "src/wast-lexer.cc"
-		{ OPCODE(I32WrapI64); RETURN(CONVERT); }
-#line 5880 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '3') goto yy1113;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1067:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '4') goto yy1114;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1068:
-		yych = *++cursor_;
-		if (yych == '/') goto yy1101;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '2') goto yy1115;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1069:
-		yych = *++cursor_;
-		if (yych == '/') goto yy1102;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '2') goto yy1116;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1070:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 368 "src/wast-lexer.cc"
-		{ OPCODE(I64Load16S); RETURN(LOAD); }
-#line 5896 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '4') goto yy1117;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1071:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy1118;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1072:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 370 "src/wast-lexer.cc"
-		{ OPCODE(I64Load16U); RETURN(LOAD); }
-#line 5904 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy1119;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1073:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'i') goto yy1120;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1074:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 371 "src/wast-lexer.cc"
-		{ OPCODE(I64Load32S); RETURN(LOAD); }
-#line 5912 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'i') goto yy1121;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1075:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1639;
 yy1076:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 372 "src/wast-lexer.cc"
-		{ OPCODE(I64Load32U); RETURN(LOAD); }
-#line 5920 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy1122;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1077:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy1123;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1078:
-		yych = *++cursor_;
-		if (yych == 'r') goto yy1103;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy1124;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1079:
-		yych = *++cursor_;
-		if (yych == 'f') goto yy1104;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'i') goto yy1125;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1080:
-		yych = *++cursor_;
-		if (yych == 'f') goto yy1105;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'i') goto yy1126;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1081:
-		yych = *++cursor_;
-		if (yych == 't') goto yy1106;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy1127;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1082:
-		yych = *++cursor_;
-		if (yych == 'd') goto yy1107;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '2') goto yy1128;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1083:
-		yych = *++cursor_;
-		if (yych == 'm') goto yy1109;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy1129;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1084:
-		++cursor_;
-		if ((yych = *cursor_) <= ')') {
-			if (yych <= '!') {
-				if (yych >= '!') goto yy86;
-			} else {
-				if (yych <= '"') goto yy1085;
-				if (yych <= '\'') goto yy86;
-			}
-		} else {
-			if (yych <= '^') {
-				if (yych != ';') goto yy86;
-			} else {
-				if (yych <= '_') goto yy1110;
-				if (yych <= '~') goto yy86;
-			}
-		}
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy1130;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1085:
-#line 535 "src/wast-lexer.cc"
-		{ RETURN(ASSERT_RETURN); }
-#line 5965 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'd') goto yy1131;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1086:
-		yych = *++cursor_;
-		if (yych == 'a') goto yy1111;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'n') goto yy1133;
+	if (yych == 'w') goto yy1132;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1087:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 346 "src/wast-lexer.cc"
-		{ RETURN(CALL_INDIRECT); }
-#line 5977 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1672;
+yy1088:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy1134;
+	if (yych == 'c') goto yy1135;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1089:
-		yych = *++cursor_;
-		if (yych == 'y') goto yy1112;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy1136;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1090:
-		yych = *++cursor_;
-		if (yych == '/') goto yy1114;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'i') goto yy1137;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1091:
-		yych = *++cursor_;
-		if (yych == '/') goto yy1115;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'b') goto yy1138;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1092:
-		yych = *++cursor_;
-		if (yych == '4') goto yy1116;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1646;
 yy1093:
-		yych = *++cursor_;
-		if (yych == 'e') goto yy1118;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy1139;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1094:
-		yych = *++cursor_;
-		if (yych == '/') goto yy1119;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '_') goto yy1140;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1095:
-		yych = *++cursor_;
-		if (yych == '/') goto yy1120;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '6') goto yy1141;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1096:
-		yych = *++cursor_;
-		if (yych == '3') goto yy1121;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 64) {
+		goto yy28;
+	}
+	if (yych <= 'c') {
+		if (yych <= ';') {
+			goto yy1800;
+		} else {
+			if (yych <= 'a') goto yy1144;
+			goto yy1146;
+		}
+	} else {
+		if (yych <= 's') {
+			if (yych <= 'o') goto yy1145;
+			goto yy1143;
+		} else {
+			if (yych <= 'x') goto yy1142;
+			goto yy1800;
+		}
+	}
 yy1097:
-		yych = *++cursor_;
-		if (yych == 'e') goto yy1122;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '1') goto yy1147;
+	if (yych == '8') goto yy1148;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1732;
 yy1098:
-		yych = *++cursor_;
-		if (yych == 'e') goto yy1123;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '/') goto yy1149;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1099:
-		yych = *++cursor_;
-		if (yych == '3') goto yy1124;
-		if (yych == '6') goto yy1125;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1628;
 yy1100:
-		yych = *++cursor_;
-		if (yych == '3') goto yy1126;
-		if (yych == '6') goto yy1127;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1626;
 yy1101:
-		yych = *++cursor_;
-		if (yych == 'i') goto yy1128;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1624;
 yy1102:
-		yych = *++cursor_;
-		if (yych == 'i') goto yy1129;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1622;
 yy1103:
-		yych = *++cursor_;
-		if (yych == 'e') goto yy1130;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy1150;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1104:
-		yych = *++cursor_;
-		if (yych == '3') goto yy1131;
-		if (yych == '6') goto yy1132;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy1151;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1105:
-		yych = *++cursor_;
-		if (yych == '3') goto yy1133;
-		if (yych == '6') goto yy1134;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '6') goto yy1152;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1106:
-		yych = *++cursor_;
-		if (yych == 'i') goto yy1135;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '2') goto yy1153;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1107:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '_') goto yy1154;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1108:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 64) {
+		goto yy28;
+	}
+	if (yych <= 'c') {
+		if (yych <= ';') {
+			goto yy1800;
+		} else {
+			if (yych <= 'a') goto yy1155;
+			goto yy1158;
 		}
-#line 533 "src/wast-lexer.cc"
-		{ RETURN(ASSERT_INVALID); }
-#line 6061 "src/prebuilt/wast-lexer-gen.cc"
+	} else {
+		if (yych <= 's') {
+			if (yych <= 'o') goto yy1156;
+			goto yy1159;
+		} else {
+			if (yych <= 'x') goto yy1157;
+			goto yy1800;
+		}
+	}
 yy1109:
-		yych = *++cursor_;
-		if (yych == 'e') goto yy1136;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '1') goto yy1161;
+	if (yych == '3') goto yy1162;
+	if (yych == '8') goto yy1160;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1733;
 yy1110:
-		yych = *++cursor_;
-		if (yych == 'a') goto yy1137;
-		if (yych == 'c') goto yy1138;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy1163;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1111:
-		yych = *++cursor_;
-		if (yych == 'b') goto yy1139;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '/') goto yy1164;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1112:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 509 "src/wast-lexer.cc"
-		{ RETURN(CURRENT_MEMORY); }
-#line 6082 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '2') goto yy1165;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1113:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '2') goto yy1166;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1114:
-		yych = *++cursor_;
-		if (yych == 'i') goto yy1140;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1629;
 yy1115:
-		yych = *++cursor_;
-		if (yych == 'i') goto yy1141;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1627;
 yy1116:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 502 "src/wast-lexer.cc"
-		{ OPCODE(F32DemoteF64); RETURN(CONVERT); }
-#line 6098 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1623;
+yy1117:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1625;
 yy1118:
-		yych = *++cursor_;
-		if (yych == 't') goto yy1142;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy1167;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1119:
-		yych = *++cursor_;
-		if (yych == 'i') goto yy1143;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy1168;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1120:
-		yych = *++cursor_;
-		if (yych == 'i') goto yy1144;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '3') goto yy1169;
+	if (yych == '6') goto yy1170;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1121:
-		yych = *++cursor_;
-		if (yych == '2') goto yy1145;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '3') goto yy1172;
+	if (yych == '6') goto yy1171;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1122:
-		yych = *++cursor_;
-		if (yych == 't') goto yy1147;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '/') goto yy1173;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1123:
-		yych = *++cursor_;
-		if (yych == 't') goto yy1148;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy1174;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1124:
-		yych = *++cursor_;
-		if (yych == '2') goto yy1149;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy1175;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1125:
-		yych = *++cursor_;
-		if (yych == '4') goto yy1151;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '3') goto yy1177;
+	if (yych == '6') goto yy1176;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1126:
-		yych = *++cursor_;
-		if (yych == '2') goto yy1153;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '3') goto yy1178;
+	if (yych == '6') goto yy1179;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1127:
-		yych = *++cursor_;
-		if (yych == '4') goto yy1155;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '/') goto yy1180;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1128:
-		yych = *++cursor_;
-		if (yych == '3') goto yy1157;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1638;
 yy1129:
-		yych = *++cursor_;
-		if (yych == '3') goto yy1158;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy1181;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1130:
-		yych = *++cursor_;
-		if (yych == 't') goto yy1159;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy1182;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1131:
-		yych = *++cursor_;
-		if (yych == '2') goto yy1160;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'i') goto yy1183;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1132:
-		yych = *++cursor_;
-		if (yych == '4') goto yy1162;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy1184;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1133:
-		yych = *++cursor_;
-		if (yych == '2') goto yy1164;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'o') goto yy1185;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1134:
-		yych = *++cursor_;
-		if (yych == '4') goto yy1166;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy1186;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1135:
-		yych = *++cursor_;
-		if (yych == 'o') goto yy1168;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy1187;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1136:
-		yych = *++cursor_;
-		if (yych == 'd') goto yy1169;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'd') goto yy1188;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1137:
-		yych = *++cursor_;
-		if (yych == 'r') goto yy1171;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'o') goto yy1189;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1138:
-		yych = *++cursor_;
-		if (yych == 'a') goto yy1172;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy1190;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1139:
-		yych = *++cursor_;
-		if (yych == 'l') goto yy1173;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '1') goto yy1192;
+	if (yych == '8') goto yy1191;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1739;
 yy1140:
-		yych = *++cursor_;
-		if (yych == '3') goto yy1174;
-		if (yych == '6') goto yy1175;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'u') goto yy1193;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1141:
-		yych = *++cursor_;
-		if (yych == '3') goto yy1176;
-		if (yych == '6') goto yy1177;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '_') goto yy1194;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1142:
-		yych = *++cursor_;
-		if (yych == '/') goto yy1178;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'c') goto yy1196;
+	if (yych == 'o') goto yy1195;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1143:
-		yych = *++cursor_;
-		if (yych == '3') goto yy1179;
-		if (yych == '6') goto yy1180;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'u') goto yy1197;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1144:
-		yych = *++cursor_;
-		if (yych == '3') goto yy1181;
-		if (yych == '6') goto yy1182;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'd') goto yy1198;
+	if (yych == 'n') goto yy1199;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1145:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 501 "src/wast-lexer.cc"
-		{ OPCODE(F64PromoteF32); RETURN(CONVERT); }
-#line 6218 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy1200;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1146:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'm') goto yy1201;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1147:
-		yych = *++cursor_;
-		if (yych == '/') goto yy1183;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '6') goto yy1202;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1148:
-		yych = *++cursor_;
-		if (yych == '/') goto yy1184;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '_') goto yy1203;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1149:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 485 "src/wast-lexer.cc"
-		{ OPCODE(I32TruncSF32); RETURN(CONVERT); }
-#line 6234 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'f') goto yy1204;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1150:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'n') goto yy1205;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1151:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 487 "src/wast-lexer.cc"
-		{ OPCODE(I32TruncSF64); RETURN(CONVERT); }
-#line 6242 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'n') goto yy1206;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1152:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '_') goto yy1207;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1153:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 489 "src/wast-lexer.cc"
-		{ OPCODE(I32TruncUF32); RETURN(CONVERT); }
-#line 6250 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '_') goto yy1208;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1154:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'u') goto yy1209;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1155:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 491 "src/wast-lexer.cc"
-		{ OPCODE(I32TruncUF64); RETURN(CONVERT); }
-#line 6258 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'd') goto yy1211;
+	if (yych == 'n') goto yy1210;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1156:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy1212;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1157:
-		yych = *++cursor_;
-		if (yych == '2') goto yy1185;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'c') goto yy1213;
+	if (yych == 'o') goto yy1214;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1158:
-		yych = *++cursor_;
-		if (yych == '2') goto yy1187;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'm') goto yy1215;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1159:
-		yych = *++cursor_;
-		if (yych == '/') goto yy1189;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'u') goto yy1216;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1160:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 486 "src/wast-lexer.cc"
-		{ OPCODE(I64TruncSF32); RETURN(CONVERT); }
-#line 6278 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '_') goto yy1217;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1161:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '6') goto yy1218;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1162:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 488 "src/wast-lexer.cc"
-		{ OPCODE(I64TruncSF64); RETURN(CONVERT); }
-#line 6286 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '2') goto yy1219;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1163:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '1') goto yy1221;
+	if (yych == '3') goto yy1222;
+	if (yych == '8') goto yy1220;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1740;
 yy1164:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 490 "src/wast-lexer.cc"
-		{ OPCODE(I64TruncUF32); RETURN(CONVERT); }
-#line 6294 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'f') goto yy1223;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1165:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1619;
 yy1166:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 492 "src/wast-lexer.cc"
-		{ OPCODE(I64TruncUF64); RETURN(CONVERT); }
-#line 6302 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1620;
+yy1167:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'n') goto yy1224;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1168:
-		yych = *++cursor_;
-		if (yych == 'n') goto yy1190;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'n') goto yy1225;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1169:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 532 "src/wast-lexer.cc"
-		{ RETURN(ASSERT_MALFORMED); }
-#line 6314 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '2') goto yy1226;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1170:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '4') goto yy1227;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1171:
-		yych = *++cursor_;
-		if (yych == 'i') goto yy1192;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '4') goto yy1228;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1172:
-		yych = *++cursor_;
-		if (yych == 'n') goto yy1193;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '2') goto yy1229;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1173:
-		yych = *++cursor_;
-		if (yych == 'e') goto yy1194;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'i') goto yy1230;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1174:
-		yych = *++cursor_;
-		if (yych == '2') goto yy1196;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'n') goto yy1231;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1175:
-		yych = *++cursor_;
-		if (yych == '4') goto yy1198;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'n') goto yy1232;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1176:
-		yych = *++cursor_;
-		if (yych == '2') goto yy1200;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '4') goto yy1233;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1177:
-		yych = *++cursor_;
-		if (yych == '4') goto yy1202;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '2') goto yy1234;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1178:
-		yych = *++cursor_;
-		if (yych == 'i') goto yy1204;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '2') goto yy1235;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1179:
-		yych = *++cursor_;
-		if (yych == '2') goto yy1205;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '4') goto yy1236;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1180:
-		yych = *++cursor_;
-		if (yych == '4') goto yy1207;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'i') goto yy1237;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1181:
-		yych = *++cursor_;
-		if (yych == '2') goto yy1209;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'n') goto yy1238;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1182:
-		yych = *++cursor_;
-		if (yych == '4') goto yy1211;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'n') goto yy1239;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1183:
-		yych = *++cursor_;
-		if (yych == 'i') goto yy1213;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy1240;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1184:
-		yych = *++cursor_;
-		if (yych == 'f') goto yy1214;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'i') goto yy1241;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1185:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 482 "src/wast-lexer.cc"
-		{ OPCODE(I64ExtendSI32); RETURN(CONVERT); }
-#line 6378 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy1242;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1186:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'i') goto yy1243;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1187:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 483 "src/wast-lexer.cc"
-		{ OPCODE(I64ExtendUI32); RETURN(CONVERT); }
-#line 6386 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'n') goto yy1244;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1188:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1671;
 yy1189:
-		yych = *++cursor_;
-		if (yych == 'f') goto yy1215;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'n') goto yy1245;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1190:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 541 "src/wast-lexer.cc"
-		{ RETURN(ASSERT_EXHAUSTION); }
-#line 6398 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy1246;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1191:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1741;
 yy1192:
-		yych = *++cursor_;
-		if (yych == 't') goto yy1216;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '6') goto yy1247;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1193:
-		yych = *++cursor_;
-		if (yych == 'o') goto yy1217;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '.') goto yy1248;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1194:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 534 "src/wast-lexer.cc"
-		{ RETURN(ASSERT_UNLINKABLE); }
-#line 6414 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'u') goto yy1249;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1195:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy1250;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1196:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 493 "src/wast-lexer.cc"
-		{ OPCODE(F32ConvertSI32); RETURN(CONVERT); }
-#line 6422 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'h') goto yy1251;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1197:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'b') goto yy1252;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1198:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 495 "src/wast-lexer.cc"
-		{ OPCODE(F32ConvertSI64); RETURN(CONVERT); }
-#line 6430 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'd') goto yy1253;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1199:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'd') goto yy1254;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1200:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 497 "src/wast-lexer.cc"
-		{ OPCODE(F32ConvertUI32); RETURN(CONVERT); }
-#line 6438 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1767;
+yy1201:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'p') goto yy1255;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1202:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 499 "src/wast-lexer.cc"
-		{ OPCODE(F32ConvertUI64); RETURN(CONVERT); }
-#line 6446 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '_') goto yy1256;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1203:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'u') goto yy1257;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1204:
-		yych = *++cursor_;
-		if (yych == '3') goto yy1218;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '3') goto yy1258;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1205:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 494 "src/wast-lexer.cc"
-		{ OPCODE(F64ConvertSI32); RETURN(CONVERT); }
-#line 6458 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy1259;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1206:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy1260;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1207:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 496 "src/wast-lexer.cc"
-		{ OPCODE(F64ConvertSI64); RETURN(CONVERT); }
-#line 6466 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'u') goto yy1261;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1208:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'u') goto yy1262;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1209:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 498 "src/wast-lexer.cc"
-		{ OPCODE(F64ConvertUI32); RETURN(CONVERT); }
-#line 6474 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '.') goto yy1263;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1210:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'd') goto yy1264;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1211:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 500 "src/wast-lexer.cc"
-		{ OPCODE(F64ConvertUI64); RETURN(CONVERT); }
-#line 6482 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'd') goto yy1265;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1212:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1768;
 yy1213:
-		yych = *++cursor_;
-		if (yych == '6') goto yy1219;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'h') goto yy1266;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1214:
-		yych = *++cursor_;
-		if (yych == '3') goto yy1220;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy1267;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1215:
-		yych = *++cursor_;
-		if (yych == '6') goto yy1221;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'p') goto yy1268;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1216:
-		yych = *++cursor_;
-		if (yych == 'h') goto yy1222;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'b') goto yy1269;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1217:
-		yych = *++cursor_;
-		if (yych == 'n') goto yy1223;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'u') goto yy1270;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1218:
-		yych = *++cursor_;
-		if (yych == '2') goto yy1224;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '_') goto yy1271;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1219:
-		yych = *++cursor_;
-		if (yych == '4') goto yy1226;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '_') goto yy1272;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1220:
-		yych = *++cursor_;
-		if (yych == '2') goto yy1228;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1743;
 yy1221:
-		yych = *++cursor_;
-		if (yych == '4') goto yy1230;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '6') goto yy1273;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1222:
-		yych = *++cursor_;
-		if (yych == 'm') goto yy1232;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '2') goto yy1274;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1223:
-		yych = *++cursor_;
-		if (yych == 'i') goto yy1233;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '6') goto yy1275;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1224:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 503 "src/wast-lexer.cc"
-		{ OPCODE(F32ReinterpretI32); RETURN(CONVERT); }
-#line 6534 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy1276;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1225:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy1277;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1226:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 505 "src/wast-lexer.cc"
-		{ OPCODE(F64ReinterpretI64); RETURN(CONVERT); }
-#line 6542 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1630;
+yy1227:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1632;
 yy1228:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 504 "src/wast-lexer.cc"
-		{ OPCODE(I32ReinterpretF32); RETURN(CONVERT); }
-#line 6550 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1636;
+yy1229:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1634;
 yy1230:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
-		}
-#line 506 "src/wast-lexer.cc"
-		{ OPCODE(I64ReinterpretF64); RETURN(CONVERT); }
-#line 6558 "src/prebuilt/wast-lexer-gen.cc"
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '3') goto yy1278;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1231:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy1279;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1232:
-		yych = *++cursor_;
-		if (yych == 'e') goto yy1234;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy1280;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1233:
-		yych = *++cursor_;
-		if (yych == 'c') goto yy1235;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1637;
 yy1234:
-		yych = *++cursor_;
-		if (yych == 't') goto yy1236;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1635;
 yy1235:
-		yych = *++cursor_;
-		if (yych == 'a') goto yy1237;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1631;
 yy1236:
-		yych = *++cursor_;
-		if (yych == 'i') goto yy1238;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1633;
 yy1237:
-		yych = *++cursor_;
-		if (yych == 'l') goto yy1239;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '6') goto yy1281;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1238:
-		yych = *++cursor_;
-		if (yych == 'c') goto yy1240;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy1282;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1239:
-		yych = *++cursor_;
-		if (yych == '_') goto yy1241;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy1283;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1240:
-		yych = *++cursor_;
-		if (yych == '_') goto yy1242;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy1284;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1241:
-		yych = *++cursor_;
-		if (yych == 'n') goto yy1243;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy1285;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1242:
-		yych = *++cursor_;
-		if (yych == 'n') goto yy1244;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'i') goto yy1286;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1243:
-		yych = *++cursor_;
-		if (yych == 'a') goto yy1245;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy1287;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1244:
-		yych = *++cursor_;
-		if (yych == 'a') goto yy1246;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'o') goto yy1288;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
 yy1245:
-		yych = *++cursor_;
-		if (yych == 'n') goto yy1247;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1678;
 yy1246:
-		yych = *++cursor_;
-		if (yych == 'n') goto yy1249;
-		goto yy87;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1673;
 yy1247:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1742;
+yy1248:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 64) {
+		goto yy28;
+	}
+	if (yych <= 'c') {
+		if (yych <= ';') {
+			goto yy1800;
+		} else {
+			if (yych <= 'a') goto yy1289;
+			goto yy1291;
 		}
-#line 536 "src/wast-lexer.cc"
-		{
-                                  RETURN(ASSERT_RETURN_CANONICAL_NAN); }
-#line 6627 "src/prebuilt/wast-lexer-gen.cc"
+	} else {
+		if (yych <= 's') {
+			if (yych <= 'o') goto yy1293;
+			goto yy1292;
+		} else {
+			if (yych <= 'x') goto yy1290;
+			goto yy1800;
+		}
+	}
 yy1249:
-		++cursor_;
-		if (yybm[0+(yych = *cursor_)] & 8) {
-			goto yy86;
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '.') goto yy1294;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1250:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1774;
+yy1251:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'g') goto yy1295;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1252:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1753;
+yy1253:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1746;
+yy1254:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1760;
+yy1255:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'x') goto yy1296;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1256:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'u') goto yy1297;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1257:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1734;
+yy1258:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '2') goto yy1298;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1259:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1697;
+yy1260:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1696;
+yy1261:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '.') goto yy1299;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1262:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '.') goto yy1300;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1263:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 64) {
+		goto yy28;
+	}
+	if (yych <= 'c') {
+		if (yych <= ';') {
+			goto yy1800;
+		} else {
+			if (yych <= 'a') goto yy1302;
+			goto yy1301;
+		}
+	} else {
+		if (yych <= 's') {
+			if (yych <= 'o') goto yy1303;
+			goto yy1305;
+		} else {
+			if (yych <= 'x') goto yy1304;
+			goto yy1800;
 		}
-#line 538 "src/wast-lexer.cc"
-		{
-                                  RETURN(ASSERT_RETURN_ARITHMETIC_NAN); }
-#line 6636 "src/prebuilt/wast-lexer-gen.cc"
 	}
-}
-#line 567 "src/wast-lexer.cc"
-
+yy1264:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1761;
+yy1265:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1747;
+yy1266:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'g') goto yy1306;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1267:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1775;
+yy1268:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'x') goto yy1307;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1269:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1754;
+yy1270:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1736;
+yy1271:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'u') goto yy1308;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1272:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'u') goto yy1309;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1273:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1744;
+yy1274:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1745;
+yy1275:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '4') goto yy1310;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1276:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1698;
+yy1277:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1699;
+yy1278:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '2') goto yy1311;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1279:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1700;
+yy1280:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1701;
+yy1281:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '4') goto yy1312;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1282:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1703;
+yy1283:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1702;
+yy1284:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'c') goto yy1313;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1285:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '3') goto yy1314;
+	if (yych == '6') goto yy1315;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1286:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'f') goto yy1316;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1287:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'h') goto yy1317;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1288:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'n') goto yy1318;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1289:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'd') goto yy1320;
+	if (yych == 'n') goto yy1319;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1290:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'c') goto yy1321;
+	if (yych == 'o') goto yy1322;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1291:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'm') goto yy1323;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1292:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'u') goto yy1324;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1293:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy1325;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1294:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 64) {
+		goto yy28;
+	}
+	if (yych <= 'c') {
+		if (yych <= ';') {
+			goto yy1800;
+		} else {
+			if (yych <= 'a') goto yy1329;
+			goto yy1327;
+		}
+	} else {
+		if (yych <= 's') {
+			if (yych <= 'o') goto yy1330;
+			goto yy1328;
+		} else {
+			if (yych <= 'x') goto yy1326;
+			goto yy1800;
+		}
+	}
+yy1295:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1781;
+yy1296:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'c') goto yy1331;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1297:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1735;
+yy1298:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1641;
+yy1299:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 64) {
+		goto yy28;
+	}
+	if (yych <= 'c') {
+		if (yych <= ';') {
+			goto yy1800;
+		} else {
+			if (yych <= 'a') goto yy1332;
+			goto yy1335;
+		}
+	} else {
+		if (yych <= 's') {
+			if (yych <= 'o') goto yy1336;
+			goto yy1334;
+		} else {
+			if (yych <= 'x') goto yy1333;
+			goto yy1800;
+		}
+	}
+yy1300:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 64) {
+		goto yy28;
+	}
+	if (yych <= 'c') {
+		if (yych <= ';') {
+			goto yy1800;
+		} else {
+			if (yych <= 'a') goto yy1337;
+			goto yy1341;
+		}
+	} else {
+		if (yych <= 's') {
+			if (yych <= 'o') goto yy1340;
+			goto yy1339;
+		} else {
+			if (yych <= 'x') goto yy1338;
+			goto yy1800;
+		}
+	}
+yy1301:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'm') goto yy1342;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1302:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'd') goto yy1344;
+	if (yych == 'n') goto yy1343;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1303:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy1345;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1304:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'c') goto yy1346;
+	if (yych == 'o') goto yy1347;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1305:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'u') goto yy1348;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1306:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1782;
+yy1307:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'c') goto yy1349;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1308:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1737;
+yy1309:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1738;
+yy1310:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1643;
+yy1311:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1640;
+yy1312:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1642;
+yy1313:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy1350;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1314:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '2') goto yy1351;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1315:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '4') goto yy1352;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1316:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'y') goto yy1353;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1317:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'm') goto yy1354;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1318:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'i') goto yy1355;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1319:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'd') goto yy1356;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1320:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'd') goto yy1357;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1321:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'h') goto yy1358;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1322:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy1359;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1323:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'p') goto yy1360;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1324:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'b') goto yy1361;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1325:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1769;
+yy1326:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'c') goto yy1362;
+	if (yych == 'o') goto yy1363;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1327:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'm') goto yy1364;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1328:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'u') goto yy1365;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1329:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'd') goto yy1366;
+	if (yych == 'n') goto yy1367;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1330:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy1368;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1331:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'h') goto yy1369;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1332:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'd') goto yy1370;
+	if (yych == 'n') goto yy1371;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1333:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'c') goto yy1373;
+	if (yych == 'o') goto yy1372;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1334:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'u') goto yy1374;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1335:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'm') goto yy1375;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1336:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy1376;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1337:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'd') goto yy1378;
+	if (yych == 'n') goto yy1377;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1338:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'c') goto yy1379;
+	if (yych == 'o') goto yy1380;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1339:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'u') goto yy1381;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1340:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy1382;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1341:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'm') goto yy1383;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1342:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'p') goto yy1384;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1343:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'd') goto yy1385;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1344:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'd') goto yy1386;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1345:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1771;
+yy1346:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'h') goto yy1387;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1347:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy1388;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1348:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'b') goto yy1389;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1349:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'h') goto yy1390;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1350:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1480;
+yy1351:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1730;
+yy1352:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1731;
+yy1353:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1729;
+yy1354:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'e') goto yy1391;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1355:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'c') goto yy1392;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1356:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1762;
+yy1357:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1748;
+yy1358:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'g') goto yy1393;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1359:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1776;
+yy1360:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'x') goto yy1394;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1361:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1755;
+yy1362:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'h') goto yy1395;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1363:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy1396;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1364:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'p') goto yy1397;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1365:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'b') goto yy1398;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1366:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'd') goto yy1399;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1367:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'd') goto yy1400;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1368:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1770;
+yy1369:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'g') goto yy1401;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1370:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'd') goto yy1402;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1371:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'd') goto yy1403;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1372:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy1404;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1373:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'h') goto yy1405;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1374:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'b') goto yy1406;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1375:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'p') goto yy1407;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1376:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1772;
+yy1377:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'd') goto yy1408;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1378:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'd') goto yy1409;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1379:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'h') goto yy1410;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1380:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'r') goto yy1411;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1381:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'b') goto yy1412;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1382:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1773;
+yy1383:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'p') goto yy1413;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1384:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'x') goto yy1414;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1385:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1764;
+yy1386:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1750;
+yy1387:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'g') goto yy1415;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1388:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1778;
+yy1389:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1757;
+yy1390:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'g') goto yy1416;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1391:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 't') goto yy1417;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1392:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy1418;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1393:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1783;
+yy1394:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'c') goto yy1419;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1395:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'g') goto yy1420;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1396:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1777;
+yy1397:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'x') goto yy1421;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1398:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1756;
+yy1399:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1749;
+yy1400:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1763;
+yy1401:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1788;
+yy1402:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1751;
+yy1403:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1765;
+yy1404:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1779;
+yy1405:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'g') goto yy1422;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1406:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1758;
+yy1407:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'x') goto yy1423;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1408:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1766;
+yy1409:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1752;
+yy1410:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'g') goto yy1424;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1411:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1780;
+yy1412:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1759;
+yy1413:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'x') goto yy1425;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1414:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'c') goto yy1426;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1415:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1785;
+yy1416:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1789;
+yy1417:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'i') goto yy1427;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1418:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'l') goto yy1428;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1419:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'h') goto yy1429;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1420:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1784;
+yy1421:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'c') goto yy1430;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1422:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1786;
+yy1423:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'c') goto yy1431;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1424:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1787;
+yy1425:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'c') goto yy1432;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1426:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'h') goto yy1433;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1427:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'c') goto yy1434;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1428:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '_') goto yy1435;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1429:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'g') goto yy1436;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1430:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'h') goto yy1437;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1431:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'h') goto yy1438;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1432:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'h') goto yy1439;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1433:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'g') goto yy1440;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1434:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == '_') goto yy1441;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1435:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'n') goto yy1442;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1436:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1790;
+yy1437:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'g') goto yy1443;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1438:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'g') goto yy1444;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1439:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'g') goto yy1445;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1440:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1792;
+yy1441:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'n') goto yy1446;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1442:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy1447;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1443:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1791;
+yy1444:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1793;
+yy1445:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1794;
+yy1446:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'a') goto yy1448;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1447:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'n') goto yy1449;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1448:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == 'n') goto yy1450;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1800;
+yy1449:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1675;
+yy1450:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 8) {
+		goto yy28;
+	}
+	goto yy1676;
+yyback_i:
+	cursor_ = marker_;
+	switch (yyaccept) {
+	case 0:
+		goto yy1460;
+	default:
+		goto yy1802;
+	}
+yy1451:
+#line 309 "src/wast-lexer.cc"
+	{ LOOKAHEAD(LPAR); }
+#line 12539 "src/prebuilt/wast-lexer-gen.cc"
+yy1452:
+#line 310 "src/wast-lexer.cc"
+	{ RETURN(RPAR); }
+#line 12543 "src/prebuilt/wast-lexer-gen.cc"
+yy1453:
+#line 311 "src/wast-lexer.cc"
+	{ LITERAL(Int); RETURN(NAT); }
+#line 12547 "src/prebuilt/wast-lexer-gen.cc"
+yy1454:
+#line 312 "src/wast-lexer.cc"
+	{ LITERAL(Int); RETURN(INT); }
+#line 12551 "src/prebuilt/wast-lexer-gen.cc"
+yy1455:
+#line 313 "src/wast-lexer.cc"
+	{ LITERAL(Float); RETURN(FLOAT); }
+#line 12555 "src/prebuilt/wast-lexer-gen.cc"
+yy1456:
+#line 314 "src/wast-lexer.cc"
+	{ LITERAL(Hexfloat); RETURN(FLOAT); }
+#line 12559 "src/prebuilt/wast-lexer-gen.cc"
+yy1457:
+#line 315 "src/wast-lexer.cc"
+	{ LITERAL(Infinity); RETURN(FLOAT); }
+#line 12563 "src/prebuilt/wast-lexer-gen.cc"
+yy1458:
+#line 316 "src/wast-lexer.cc"
+	{ LITERAL(Nan); RETURN(FLOAT); }
+#line 12567 "src/prebuilt/wast-lexer-gen.cc"
+yy1459:
+#line 317 "src/wast-lexer.cc"
+	{ SetText(); RETURN(TEXT); }
+#line 12571 "src/prebuilt/wast-lexer-gen.cc"
+yy1460:
+	BEGIN(YYCOND_BAD_TEXT);
+#line 318 "src/wast-lexer.cc"
+	{ continue; }
+#line 12576 "src/prebuilt/wast-lexer-gen.cc"
+yy1461:
+#line 330 "src/wast-lexer.cc"
+	{ TYPE(I32); RETURN(VALUE_TYPE); }
+#line 12580 "src/prebuilt/wast-lexer-gen.cc"
+yy1462:
+#line 331 "src/wast-lexer.cc"
+	{ TYPE(I64); RETURN(VALUE_TYPE); }
+#line 12584 "src/prebuilt/wast-lexer-gen.cc"
+yy1463:
+#line 332 "src/wast-lexer.cc"
+	{ TYPE(F32); RETURN(VALUE_TYPE); }
+#line 12588 "src/prebuilt/wast-lexer-gen.cc"
+yy1464:
+#line 333 "src/wast-lexer.cc"
+	{ TYPE(F64); RETURN(VALUE_TYPE); }
+#line 12592 "src/prebuilt/wast-lexer-gen.cc"
+yy1465:
+#line 334 "src/wast-lexer.cc"
+	{ TYPE(V128); RETURN(VALUE_TYPE); }
+#line 12596 "src/prebuilt/wast-lexer-gen.cc"
+yy1466:
+#line 335 "src/wast-lexer.cc"
+	{ RETURN(ANYFUNC); }
+#line 12600 "src/prebuilt/wast-lexer-gen.cc"
+yy1467:
+#line 336 "src/wast-lexer.cc"
+	{ RETURN(MUT); }
+#line 12604 "src/prebuilt/wast-lexer-gen.cc"
+yy1468:
+#line 337 "src/wast-lexer.cc"
+	{ RETURN(NOP); }
+#line 12608 "src/prebuilt/wast-lexer-gen.cc"
+yy1469:
+#line 338 "src/wast-lexer.cc"
+	{ RETURN(BLOCK); }
+#line 12612 "src/prebuilt/wast-lexer-gen.cc"
+yy1470:
+#line 339 "src/wast-lexer.cc"
+	{ RETURN(IF); }
+#line 12616 "src/prebuilt/wast-lexer-gen.cc"
+yy1471:
+#line 340 "src/wast-lexer.cc"
+	{ RETURN(THEN); }
+#line 12620 "src/prebuilt/wast-lexer-gen.cc"
+yy1472:
+#line 341 "src/wast-lexer.cc"
+	{ RETURN(ELSE); }
+#line 12624 "src/prebuilt/wast-lexer-gen.cc"
+yy1473:
+#line 342 "src/wast-lexer.cc"
+	{ RETURN(LOOP); }
+#line 12628 "src/prebuilt/wast-lexer-gen.cc"
+yy1474:
+#line 343 "src/wast-lexer.cc"
+	{ RETURN(BR); }
+#line 12632 "src/prebuilt/wast-lexer-gen.cc"
+yy1475:
+#line 344 "src/wast-lexer.cc"
+	{ RETURN(BR_IF); }
+#line 12636 "src/prebuilt/wast-lexer-gen.cc"
+yy1476:
+#line 345 "src/wast-lexer.cc"
+	{ RETURN(BR_TABLE); }
+#line 12640 "src/prebuilt/wast-lexer-gen.cc"
+yy1477:
+#line 346 "src/wast-lexer.cc"
+	{ RETURN(CALL); }
+#line 12644 "src/prebuilt/wast-lexer-gen.cc"
+yy1478:
+#line 347 "src/wast-lexer.cc"
+	{ RETURN(CALL_INDIRECT); }
+#line 12648 "src/prebuilt/wast-lexer-gen.cc"
+yy1479:
+#line 348 "src/wast-lexer.cc"
+	{ OPCODE(ReturnCall); RETURN(RETURN_CALL); }
+#line 12652 "src/prebuilt/wast-lexer-gen.cc"
+yy1480:
+#line 349 "src/wast-lexer.cc"
+	{
+                                  OPCODE(ReturnCallIndirect);
+                                  RETURN(RETURN_CALL_INDIRECT); }
+#line 12658 "src/prebuilt/wast-lexer-gen.cc"
+yy1481:
+#line 352 "src/wast-lexer.cc"
+	{ RETURN(DROP); }
+#line 12662 "src/prebuilt/wast-lexer-gen.cc"
+yy1482:
+#line 353 "src/wast-lexer.cc"
+	{ RETURN(END); }
+#line 12666 "src/prebuilt/wast-lexer-gen.cc"
+yy1483:
+#line 354 "src/wast-lexer.cc"
+	{ RETURN(RETURN); }
+#line 12670 "src/prebuilt/wast-lexer-gen.cc"
+yy1484:
+#line 355 "src/wast-lexer.cc"
+	{ RETURN(GET_LOCAL); }
+#line 12674 "src/prebuilt/wast-lexer-gen.cc"
+yy1485:
+#line 356 "src/wast-lexer.cc"
+	{ RETURN(SET_LOCAL); }
+#line 12678 "src/prebuilt/wast-lexer-gen.cc"
+yy1486:
+#line 357 "src/wast-lexer.cc"
+	{ RETURN(TEE_LOCAL); }
+#line 12682 "src/prebuilt/wast-lexer-gen.cc"
+yy1487:
+#line 358 "src/wast-lexer.cc"
+	{ RETURN(GET_GLOBAL); }
+#line 12686 "src/prebuilt/wast-lexer-gen.cc"
+yy1488:
+#line 359 "src/wast-lexer.cc"
+	{ RETURN(SET_GLOBAL); }
+#line 12690 "src/prebuilt/wast-lexer-gen.cc"
+yy1489:
+#line 360 "src/wast-lexer.cc"
+	{ OPCODE(I32Load); RETURN(LOAD); }
+#line 12694 "src/prebuilt/wast-lexer-gen.cc"
+yy1490:
+#line 361 "src/wast-lexer.cc"
+	{ OPCODE(I64Load); RETURN(LOAD); }
+#line 12698 "src/prebuilt/wast-lexer-gen.cc"
+yy1491:
+#line 362 "src/wast-lexer.cc"
+	{ OPCODE(F32Load); RETURN(LOAD); }
+#line 12702 "src/prebuilt/wast-lexer-gen.cc"
+yy1492:
+#line 363 "src/wast-lexer.cc"
+	{ OPCODE(F64Load); RETURN(LOAD); }
+#line 12706 "src/prebuilt/wast-lexer-gen.cc"
+yy1493:
+#line 364 "src/wast-lexer.cc"
+	{ OPCODE(V128Load); RETURN(LOAD); }
+#line 12710 "src/prebuilt/wast-lexer-gen.cc"
+yy1494:
+#line 365 "src/wast-lexer.cc"
+	{ OPCODE(I32Store); RETURN(STORE); }
+#line 12714 "src/prebuilt/wast-lexer-gen.cc"
+yy1495:
+#line 366 "src/wast-lexer.cc"
+	{ OPCODE(I64Store); RETURN(STORE); }
+#line 12718 "src/prebuilt/wast-lexer-gen.cc"
+yy1496:
+#line 367 "src/wast-lexer.cc"
+	{ OPCODE(F32Store); RETURN(STORE); }
+#line 12722 "src/prebuilt/wast-lexer-gen.cc"
+yy1497:
+#line 368 "src/wast-lexer.cc"
+	{ OPCODE(F64Store); RETURN(STORE); }
+#line 12726 "src/prebuilt/wast-lexer-gen.cc"
+yy1498:
+#line 369 "src/wast-lexer.cc"
+	{ OPCODE(V128Store); RETURN(STORE); }
+#line 12730 "src/prebuilt/wast-lexer-gen.cc"
+yy1499:
+#line 370 "src/wast-lexer.cc"
+	{ OPCODE(I32Load8S); RETURN(LOAD); }
+#line 12734 "src/prebuilt/wast-lexer-gen.cc"
+yy1500:
+#line 371 "src/wast-lexer.cc"
+	{ OPCODE(I64Load8S); RETURN(LOAD); }
+#line 12738 "src/prebuilt/wast-lexer-gen.cc"
+yy1501:
+#line 372 "src/wast-lexer.cc"
+	{ OPCODE(I32Load8U); RETURN(LOAD); }
+#line 12742 "src/prebuilt/wast-lexer-gen.cc"
+yy1502:
+#line 373 "src/wast-lexer.cc"
+	{ OPCODE(I64Load8U); RETURN(LOAD); }
+#line 12746 "src/prebuilt/wast-lexer-gen.cc"
+yy1503:
+#line 374 "src/wast-lexer.cc"
+	{ OPCODE(I32Load16S); RETURN(LOAD); }
+#line 12750 "src/prebuilt/wast-lexer-gen.cc"
+yy1504:
+#line 375 "src/wast-lexer.cc"
+	{ OPCODE(I64Load16S); RETURN(LOAD); }
+#line 12754 "src/prebuilt/wast-lexer-gen.cc"
+yy1505:
+#line 376 "src/wast-lexer.cc"
+	{ OPCODE(I32Load16U); RETURN(LOAD); }
+#line 12758 "src/prebuilt/wast-lexer-gen.cc"
+yy1506:
+#line 377 "src/wast-lexer.cc"
+	{ OPCODE(I64Load16U); RETURN(LOAD); }
+#line 12762 "src/prebuilt/wast-lexer-gen.cc"
+yy1507:
+#line 378 "src/wast-lexer.cc"
+	{ OPCODE(I64Load32S); RETURN(LOAD); }
+#line 12766 "src/prebuilt/wast-lexer-gen.cc"
+yy1508:
+#line 379 "src/wast-lexer.cc"
+	{ OPCODE(I64Load32U); RETURN(LOAD); }
+#line 12770 "src/prebuilt/wast-lexer-gen.cc"
+yy1509:
+#line 380 "src/wast-lexer.cc"
+	{ OPCODE(I32Store8); RETURN(STORE); }
+#line 12774 "src/prebuilt/wast-lexer-gen.cc"
+yy1510:
+#line 381 "src/wast-lexer.cc"
+	{ OPCODE(I64Store8); RETURN(STORE); }
+#line 12778 "src/prebuilt/wast-lexer-gen.cc"
+yy1511:
+#line 382 "src/wast-lexer.cc"
+	{ OPCODE(I32Store16); RETURN(STORE); }
+#line 12782 "src/prebuilt/wast-lexer-gen.cc"
+yy1512:
+#line 383 "src/wast-lexer.cc"
+	{ OPCODE(I64Store16); RETURN(STORE); }
+#line 12786 "src/prebuilt/wast-lexer-gen.cc"
+yy1513:
+#line 384 "src/wast-lexer.cc"
+	{ OPCODE(I64Store32); RETURN(STORE); }
+#line 12790 "src/prebuilt/wast-lexer-gen.cc"
+yy1514:
+#line 385 "src/wast-lexer.cc"
+	{ SetTextAt(7); RETURN(OFFSET_EQ_NAT); }
+#line 12794 "src/prebuilt/wast-lexer-gen.cc"
+yy1515:
+#line 386 "src/wast-lexer.cc"
+	{ SetTextAt(6); RETURN(ALIGN_EQ_NAT); }
+#line 12798 "src/prebuilt/wast-lexer-gen.cc"
+yy1516:
+#line 387 "src/wast-lexer.cc"
+	{ TYPE(I32); RETURN(CONST); }
+#line 12802 "src/prebuilt/wast-lexer-gen.cc"
+yy1517:
+#line 388 "src/wast-lexer.cc"
+	{ TYPE(I64); RETURN(CONST); }
+#line 12806 "src/prebuilt/wast-lexer-gen.cc"
+yy1518:
+#line 389 "src/wast-lexer.cc"
+	{ TYPE(F32); RETURN(CONST); }
+#line 12810 "src/prebuilt/wast-lexer-gen.cc"
+yy1519:
+#line 390 "src/wast-lexer.cc"
+	{ TYPE(F64); RETURN(CONST); }
+#line 12814 "src/prebuilt/wast-lexer-gen.cc"
+yy1520:
+#line 391 "src/wast-lexer.cc"
+	{ OPCODE(V128Const); RETURN(V128_CONST); }
+#line 12818 "src/prebuilt/wast-lexer-gen.cc"
+yy1521:
+#line 392 "src/wast-lexer.cc"
+	{ OPCODE(I32Eqz); RETURN(CONVERT); }
+#line 12822 "src/prebuilt/wast-lexer-gen.cc"
+yy1522:
+#line 393 "src/wast-lexer.cc"
+	{ OPCODE(I64Eqz); RETURN(CONVERT); }
+#line 12826 "src/prebuilt/wast-lexer-gen.cc"
+yy1523:
+#line 394 "src/wast-lexer.cc"
+	{ OPCODE(I32Clz); RETURN(UNARY); }
+#line 12830 "src/prebuilt/wast-lexer-gen.cc"
+yy1524:
+#line 395 "src/wast-lexer.cc"
+	{ OPCODE(I64Clz); RETURN(UNARY); }
+#line 12834 "src/prebuilt/wast-lexer-gen.cc"
+yy1525:
+#line 396 "src/wast-lexer.cc"
+	{ OPCODE(I32Ctz); RETURN(UNARY); }
+#line 12838 "src/prebuilt/wast-lexer-gen.cc"
+yy1526:
+#line 397 "src/wast-lexer.cc"
+	{ OPCODE(I64Ctz); RETURN(UNARY); }
+#line 12842 "src/prebuilt/wast-lexer-gen.cc"
+yy1527:
+#line 398 "src/wast-lexer.cc"
+	{ OPCODE(I32Popcnt); RETURN(UNARY); }
+#line 12846 "src/prebuilt/wast-lexer-gen.cc"
+yy1528:
+#line 399 "src/wast-lexer.cc"
+	{ OPCODE(I64Popcnt); RETURN(UNARY); }
+#line 12850 "src/prebuilt/wast-lexer-gen.cc"
+yy1529:
+#line 400 "src/wast-lexer.cc"
+	{ OPCODE(F32Neg); RETURN(UNARY); }
+#line 12854 "src/prebuilt/wast-lexer-gen.cc"
+yy1530:
+#line 401 "src/wast-lexer.cc"
+	{ OPCODE(F64Neg); RETURN(UNARY); }
+#line 12858 "src/prebuilt/wast-lexer-gen.cc"
+yy1531:
+#line 402 "src/wast-lexer.cc"
+	{ OPCODE(F32Abs); RETURN(UNARY); }
+#line 12862 "src/prebuilt/wast-lexer-gen.cc"
+yy1532:
+#line 403 "src/wast-lexer.cc"
+	{ OPCODE(F64Abs); RETURN(UNARY); }
+#line 12866 "src/prebuilt/wast-lexer-gen.cc"
+yy1533:
+#line 404 "src/wast-lexer.cc"
+	{ OPCODE(F32Sqrt); RETURN(UNARY); }
+#line 12870 "src/prebuilt/wast-lexer-gen.cc"
+yy1534:
+#line 405 "src/wast-lexer.cc"
+	{ OPCODE(F64Sqrt); RETURN(UNARY); }
+#line 12874 "src/prebuilt/wast-lexer-gen.cc"
+yy1535:
+#line 406 "src/wast-lexer.cc"
+	{ OPCODE(F32Ceil); RETURN(UNARY); }
+#line 12878 "src/prebuilt/wast-lexer-gen.cc"
+yy1536:
+#line 407 "src/wast-lexer.cc"
+	{ OPCODE(F64Ceil); RETURN(UNARY); }
+#line 12882 "src/prebuilt/wast-lexer-gen.cc"
+yy1537:
+#line 408 "src/wast-lexer.cc"
+	{ OPCODE(F32Floor); RETURN(UNARY); }
+#line 12886 "src/prebuilt/wast-lexer-gen.cc"
+yy1538:
+#line 409 "src/wast-lexer.cc"
+	{ OPCODE(F64Floor); RETURN(UNARY); }
+#line 12890 "src/prebuilt/wast-lexer-gen.cc"
+yy1539:
+#line 410 "src/wast-lexer.cc"
+	{ OPCODE(F32Trunc); RETURN(UNARY); }
+#line 12894 "src/prebuilt/wast-lexer-gen.cc"
+yy1540:
+#line 411 "src/wast-lexer.cc"
+	{ OPCODE(F64Trunc); RETURN(UNARY); }
+#line 12898 "src/prebuilt/wast-lexer-gen.cc"
+yy1541:
+#line 412 "src/wast-lexer.cc"
+	{ OPCODE(F32Nearest); RETURN(UNARY); }
+#line 12902 "src/prebuilt/wast-lexer-gen.cc"
+yy1542:
+#line 413 "src/wast-lexer.cc"
+	{ OPCODE(F64Nearest); RETURN(UNARY); }
+#line 12906 "src/prebuilt/wast-lexer-gen.cc"
+yy1543:
+#line 414 "src/wast-lexer.cc"
+	{ OPCODE(I32Add); RETURN(BINARY); }
+#line 12910 "src/prebuilt/wast-lexer-gen.cc"
+yy1544:
+#line 415 "src/wast-lexer.cc"
+	{ OPCODE(I64Add); RETURN(BINARY); }
+#line 12914 "src/prebuilt/wast-lexer-gen.cc"
+yy1545:
+#line 416 "src/wast-lexer.cc"
+	{ OPCODE(I32Sub); RETURN(BINARY); }
+#line 12918 "src/prebuilt/wast-lexer-gen.cc"
+yy1546:
+#line 417 "src/wast-lexer.cc"
+	{ OPCODE(I64Sub); RETURN(BINARY); }
+#line 12922 "src/prebuilt/wast-lexer-gen.cc"
+yy1547:
+#line 418 "src/wast-lexer.cc"
+	{ OPCODE(I32Mul); RETURN(BINARY); }
+#line 12926 "src/prebuilt/wast-lexer-gen.cc"
+yy1548:
+#line 419 "src/wast-lexer.cc"
+	{ OPCODE(I64Mul); RETURN(BINARY); }
+#line 12930 "src/prebuilt/wast-lexer-gen.cc"
+yy1549:
+#line 420 "src/wast-lexer.cc"
+	{ OPCODE(I32DivS); RETURN(BINARY); }
+#line 12934 "src/prebuilt/wast-lexer-gen.cc"
+yy1550:
+#line 421 "src/wast-lexer.cc"
+	{ OPCODE(I64DivS); RETURN(BINARY); }
+#line 12938 "src/prebuilt/wast-lexer-gen.cc"
+yy1551:
+#line 422 "src/wast-lexer.cc"
+	{ OPCODE(I32DivU); RETURN(BINARY); }
+#line 12942 "src/prebuilt/wast-lexer-gen.cc"
+yy1552:
+#line 423 "src/wast-lexer.cc"
+	{ OPCODE(I64DivU); RETURN(BINARY); }
+#line 12946 "src/prebuilt/wast-lexer-gen.cc"
+yy1553:
+#line 424 "src/wast-lexer.cc"
+	{ OPCODE(I32RemS); RETURN(BINARY); }
+#line 12950 "src/prebuilt/wast-lexer-gen.cc"
+yy1554:
+#line 425 "src/wast-lexer.cc"
+	{ OPCODE(I64RemS); RETURN(BINARY); }
+#line 12954 "src/prebuilt/wast-lexer-gen.cc"
+yy1555:
+#line 426 "src/wast-lexer.cc"
+	{ OPCODE(I32RemU); RETURN(BINARY); }
+#line 12958 "src/prebuilt/wast-lexer-gen.cc"
+yy1556:
+#line 427 "src/wast-lexer.cc"
+	{ OPCODE(I64RemU); RETURN(BINARY); }
+#line 12962 "src/prebuilt/wast-lexer-gen.cc"
+yy1557:
+#line 428 "src/wast-lexer.cc"
+	{ OPCODE(I32And); RETURN(BINARY); }
+#line 12966 "src/prebuilt/wast-lexer-gen.cc"
+yy1558:
+#line 429 "src/wast-lexer.cc"
+	{ OPCODE(I64And); RETURN(BINARY); }
+#line 12970 "src/prebuilt/wast-lexer-gen.cc"
+yy1559:
+#line 430 "src/wast-lexer.cc"
+	{ OPCODE(I32Or); RETURN(BINARY); }
+#line 12974 "src/prebuilt/wast-lexer-gen.cc"
+yy1560:
+#line 431 "src/wast-lexer.cc"
+	{ OPCODE(I64Or); RETURN(BINARY); }
+#line 12978 "src/prebuilt/wast-lexer-gen.cc"
+yy1561:
+#line 432 "src/wast-lexer.cc"
+	{ OPCODE(I32Xor); RETURN(BINARY); }
+#line 12982 "src/prebuilt/wast-lexer-gen.cc"
+yy1562:
+#line 433 "src/wast-lexer.cc"
+	{ OPCODE(I64Xor); RETURN(BINARY); }
+#line 12986 "src/prebuilt/wast-lexer-gen.cc"
+yy1563:
+#line 434 "src/wast-lexer.cc"
+	{ OPCODE(I32Shl); RETURN(BINARY); }
+#line 12990 "src/prebuilt/wast-lexer-gen.cc"
+yy1564:
+#line 435 "src/wast-lexer.cc"
+	{ OPCODE(I64Shl); RETURN(BINARY); }
+#line 12994 "src/prebuilt/wast-lexer-gen.cc"
+yy1565:
+#line 436 "src/wast-lexer.cc"
+	{ OPCODE(I32ShrS); RETURN(BINARY); }
+#line 12998 "src/prebuilt/wast-lexer-gen.cc"
+yy1566:
+#line 437 "src/wast-lexer.cc"
+	{ OPCODE(I64ShrS); RETURN(BINARY); }
+#line 13002 "src/prebuilt/wast-lexer-gen.cc"
+yy1567:
+#line 438 "src/wast-lexer.cc"
+	{ OPCODE(I32ShrU); RETURN(BINARY); }
+#line 13006 "src/prebuilt/wast-lexer-gen.cc"
+yy1568:
+#line 439 "src/wast-lexer.cc"
+	{ OPCODE(I64ShrU); RETURN(BINARY); }
+#line 13010 "src/prebuilt/wast-lexer-gen.cc"
+yy1569:
+#line 440 "src/wast-lexer.cc"
+	{ OPCODE(I32Rotl); RETURN(BINARY); }
+#line 13014 "src/prebuilt/wast-lexer-gen.cc"
+yy1570:
+#line 441 "src/wast-lexer.cc"
+	{ OPCODE(I64Rotl); RETURN(BINARY); }
+#line 13018 "src/prebuilt/wast-lexer-gen.cc"
+yy1571:
+#line 442 "src/wast-lexer.cc"
+	{ OPCODE(I32Rotr); RETURN(BINARY); }
+#line 13022 "src/prebuilt/wast-lexer-gen.cc"
+yy1572:
+#line 443 "src/wast-lexer.cc"
+	{ OPCODE(I64Rotr); RETURN(BINARY); }
+#line 13026 "src/prebuilt/wast-lexer-gen.cc"
+yy1573:
+#line 444 "src/wast-lexer.cc"
+	{ OPCODE(F32Add); RETURN(BINARY); }
+#line 13030 "src/prebuilt/wast-lexer-gen.cc"
+yy1574:
+#line 445 "src/wast-lexer.cc"
+	{ OPCODE(F64Add); RETURN(BINARY); }
+#line 13034 "src/prebuilt/wast-lexer-gen.cc"
+yy1575:
+#line 446 "src/wast-lexer.cc"
+	{ OPCODE(F32Sub); RETURN(BINARY); }
+#line 13038 "src/prebuilt/wast-lexer-gen.cc"
+yy1576:
+#line 447 "src/wast-lexer.cc"
+	{ OPCODE(F64Sub); RETURN(BINARY); }
+#line 13042 "src/prebuilt/wast-lexer-gen.cc"
+yy1577:
+#line 448 "src/wast-lexer.cc"
+	{ OPCODE(F32Mul); RETURN(BINARY); }
+#line 13046 "src/prebuilt/wast-lexer-gen.cc"
+yy1578:
+#line 449 "src/wast-lexer.cc"
+	{ OPCODE(F64Mul); RETURN(BINARY); }
+#line 13050 "src/prebuilt/wast-lexer-gen.cc"
+yy1579:
+#line 450 "src/wast-lexer.cc"
+	{ OPCODE(F32Div); RETURN(BINARY); }
+#line 13054 "src/prebuilt/wast-lexer-gen.cc"
+yy1580:
+#line 451 "src/wast-lexer.cc"
+	{ OPCODE(F64Div); RETURN(BINARY); }
+#line 13058 "src/prebuilt/wast-lexer-gen.cc"
+yy1581:
+#line 452 "src/wast-lexer.cc"
+	{ OPCODE(F32Min); RETURN(BINARY); }
+#line 13062 "src/prebuilt/wast-lexer-gen.cc"
+yy1582:
+#line 453 "src/wast-lexer.cc"
+	{ OPCODE(F64Min); RETURN(BINARY); }
+#line 13066 "src/prebuilt/wast-lexer-gen.cc"
+yy1583:
+#line 454 "src/wast-lexer.cc"
+	{ OPCODE(F32Max); RETURN(BINARY); }
+#line 13070 "src/prebuilt/wast-lexer-gen.cc"
+yy1584:
+#line 455 "src/wast-lexer.cc"
+	{ OPCODE(F64Max); RETURN(BINARY); }
+#line 13074 "src/prebuilt/wast-lexer-gen.cc"
+yy1585:
+#line 456 "src/wast-lexer.cc"
+	{ OPCODE(F32Copysign); RETURN(BINARY); }
+#line 13078 "src/prebuilt/wast-lexer-gen.cc"
+yy1586:
+#line 457 "src/wast-lexer.cc"
+	{ OPCODE(F64Copysign); RETURN(BINARY); }
+#line 13082 "src/prebuilt/wast-lexer-gen.cc"
+yy1587:
+#line 458 "src/wast-lexer.cc"
+	{ OPCODE(I32Eq); RETURN(COMPARE); }
+#line 13086 "src/prebuilt/wast-lexer-gen.cc"
+yy1588:
+#line 459 "src/wast-lexer.cc"
+	{ OPCODE(I64Eq); RETURN(COMPARE); }
+#line 13090 "src/prebuilt/wast-lexer-gen.cc"
+yy1589:
+#line 460 "src/wast-lexer.cc"
+	{ OPCODE(I32Ne); RETURN(COMPARE); }
+#line 13094 "src/prebuilt/wast-lexer-gen.cc"
+yy1590:
+#line 461 "src/wast-lexer.cc"
+	{ OPCODE(I64Ne); RETURN(COMPARE); }
+#line 13098 "src/prebuilt/wast-lexer-gen.cc"
+yy1591:
+#line 462 "src/wast-lexer.cc"
+	{ OPCODE(I32LtS); RETURN(COMPARE); }
+#line 13102 "src/prebuilt/wast-lexer-gen.cc"
+yy1592:
+#line 463 "src/wast-lexer.cc"
+	{ OPCODE(I64LtS); RETURN(COMPARE); }
+#line 13106 "src/prebuilt/wast-lexer-gen.cc"
+yy1593:
+#line 464 "src/wast-lexer.cc"
+	{ OPCODE(I32LtU); RETURN(COMPARE); }
+#line 13110 "src/prebuilt/wast-lexer-gen.cc"
+yy1594:
+#line 465 "src/wast-lexer.cc"
+	{ OPCODE(I64LtU); RETURN(COMPARE); }
+#line 13114 "src/prebuilt/wast-lexer-gen.cc"
+yy1595:
+#line 466 "src/wast-lexer.cc"
+	{ OPCODE(I32LeS); RETURN(COMPARE); }
+#line 13118 "src/prebuilt/wast-lexer-gen.cc"
+yy1596:
+#line 467 "src/wast-lexer.cc"
+	{ OPCODE(I64LeS); RETURN(COMPARE); }
+#line 13122 "src/prebuilt/wast-lexer-gen.cc"
+yy1597:
+#line 468 "src/wast-lexer.cc"
+	{ OPCODE(I32LeU); RETURN(COMPARE); }
+#line 13126 "src/prebuilt/wast-lexer-gen.cc"
+yy1598:
+#line 469 "src/wast-lexer.cc"
+	{ OPCODE(I64LeU); RETURN(COMPARE); }
+#line 13130 "src/prebuilt/wast-lexer-gen.cc"
+yy1599:
+#line 470 "src/wast-lexer.cc"
+	{ OPCODE(I32GtS); RETURN(COMPARE); }
+#line 13134 "src/prebuilt/wast-lexer-gen.cc"
+yy1600:
+#line 471 "src/wast-lexer.cc"
+	{ OPCODE(I64GtS); RETURN(COMPARE); }
+#line 13138 "src/prebuilt/wast-lexer-gen.cc"
+yy1601:
+#line 472 "src/wast-lexer.cc"
+	{ OPCODE(I32GtU); RETURN(COMPARE); }
+#line 13142 "src/prebuilt/wast-lexer-gen.cc"
+yy1602:
+#line 473 "src/wast-lexer.cc"
+	{ OPCODE(I64GtU); RETURN(COMPARE); }
+#line 13146 "src/prebuilt/wast-lexer-gen.cc"
+yy1603:
+#line 474 "src/wast-lexer.cc"
+	{ OPCODE(I32GeS); RETURN(COMPARE); }
+#line 13150 "src/prebuilt/wast-lexer-gen.cc"
+yy1604:
+#line 475 "src/wast-lexer.cc"
+	{ OPCODE(I64GeS); RETURN(COMPARE); }
+#line 13154 "src/prebuilt/wast-lexer-gen.cc"
+yy1605:
+#line 476 "src/wast-lexer.cc"
+	{ OPCODE(I32GeU); RETURN(COMPARE); }
+#line 13158 "src/prebuilt/wast-lexer-gen.cc"
+yy1606:
+#line 477 "src/wast-lexer.cc"
+	{ OPCODE(I64GeU); RETURN(COMPARE); }
+#line 13162 "src/prebuilt/wast-lexer-gen.cc"
+yy1607:
+#line 478 "src/wast-lexer.cc"
+	{ OPCODE(F32Eq); RETURN(COMPARE); }
+#line 13166 "src/prebuilt/wast-lexer-gen.cc"
+yy1608:
+#line 479 "src/wast-lexer.cc"
+	{ OPCODE(F64Eq); RETURN(COMPARE); }
+#line 13170 "src/prebuilt/wast-lexer-gen.cc"
+yy1609:
+#line 480 "src/wast-lexer.cc"
+	{ OPCODE(F32Ne); RETURN(COMPARE); }
+#line 13174 "src/prebuilt/wast-lexer-gen.cc"
+yy1610:
+#line 481 "src/wast-lexer.cc"
+	{ OPCODE(F64Ne); RETURN(COMPARE); }
+#line 13178 "src/prebuilt/wast-lexer-gen.cc"
+yy1611:
+#line 482 "src/wast-lexer.cc"
+	{ OPCODE(F32Lt); RETURN(COMPARE); }
+#line 13182 "src/prebuilt/wast-lexer-gen.cc"
+yy1612:
+#line 483 "src/wast-lexer.cc"
+	{ OPCODE(F64Lt); RETURN(COMPARE); }
+#line 13186 "src/prebuilt/wast-lexer-gen.cc"
+yy1613:
+#line 484 "src/wast-lexer.cc"
+	{ OPCODE(F32Le); RETURN(COMPARE); }
+#line 13190 "src/prebuilt/wast-lexer-gen.cc"
+yy1614:
+#line 485 "src/wast-lexer.cc"
+	{ OPCODE(F64Le); RETURN(COMPARE); }
+#line 13194 "src/prebuilt/wast-lexer-gen.cc"
+yy1615:
+#line 486 "src/wast-lexer.cc"
+	{ OPCODE(F32Gt); RETURN(COMPARE); }
+#line 13198 "src/prebuilt/wast-lexer-gen.cc"
+yy1616:
+#line 487 "src/wast-lexer.cc"
+	{ OPCODE(F64Gt); RETURN(COMPARE); }
+#line 13202 "src/prebuilt/wast-lexer-gen.cc"
+yy1617:
+#line 488 "src/wast-lexer.cc"
+	{ OPCODE(F32Ge); RETURN(COMPARE); }
+#line 13206 "src/prebuilt/wast-lexer-gen.cc"
+yy1618:
+#line 489 "src/wast-lexer.cc"
+	{ OPCODE(F64Ge); RETURN(COMPARE); }
+#line 13210 "src/prebuilt/wast-lexer-gen.cc"
+yy1619:
+#line 490 "src/wast-lexer.cc"
+	{ OPCODE(I64ExtendSI32); RETURN(CONVERT); }
+#line 13214 "src/prebuilt/wast-lexer-gen.cc"
+yy1620:
+#line 491 "src/wast-lexer.cc"
+	{ OPCODE(I64ExtendUI32); RETURN(CONVERT); }
+#line 13218 "src/prebuilt/wast-lexer-gen.cc"
+yy1621:
+#line 492 "src/wast-lexer.cc"
+	{ OPCODE(I32WrapI64); RETURN(CONVERT); }
+#line 13222 "src/prebuilt/wast-lexer-gen.cc"
+yy1622:
+#line 493 "src/wast-lexer.cc"
+	{ OPCODE(I32TruncSF32); RETURN(CONVERT); }
+#line 13226 "src/prebuilt/wast-lexer-gen.cc"
+yy1623:
+#line 494 "src/wast-lexer.cc"
+	{ OPCODE(I64TruncSF32); RETURN(CONVERT); }
+#line 13230 "src/prebuilt/wast-lexer-gen.cc"
+yy1624:
+#line 495 "src/wast-lexer.cc"
+	{ OPCODE(I32TruncSF64); RETURN(CONVERT); }
+#line 13234 "src/prebuilt/wast-lexer-gen.cc"
+yy1625:
+#line 496 "src/wast-lexer.cc"
+	{ OPCODE(I64TruncSF64); RETURN(CONVERT); }
+#line 13238 "src/prebuilt/wast-lexer-gen.cc"
+yy1626:
+#line 497 "src/wast-lexer.cc"
+	{ OPCODE(I32TruncUF32); RETURN(CONVERT); }
+#line 13242 "src/prebuilt/wast-lexer-gen.cc"
+yy1627:
+#line 498 "src/wast-lexer.cc"
+	{ OPCODE(I64TruncUF32); RETURN(CONVERT); }
+#line 13246 "src/prebuilt/wast-lexer-gen.cc"
+yy1628:
+#line 499 "src/wast-lexer.cc"
+	{ OPCODE(I32TruncUF64); RETURN(CONVERT); }
+#line 13250 "src/prebuilt/wast-lexer-gen.cc"
+yy1629:
+#line 500 "src/wast-lexer.cc"
+	{ OPCODE(I64TruncUF64); RETURN(CONVERT); }
+#line 13254 "src/prebuilt/wast-lexer-gen.cc"
+yy1630:
+#line 501 "src/wast-lexer.cc"
+	{ OPCODE(F32ConvertSI32); RETURN(CONVERT); }
+#line 13258 "src/prebuilt/wast-lexer-gen.cc"
+yy1631:
+#line 502 "src/wast-lexer.cc"
+	{ OPCODE(F64ConvertSI32); RETURN(CONVERT); }
+#line 13262 "src/prebuilt/wast-lexer-gen.cc"
+yy1632:
+#line 503 "src/wast-lexer.cc"
+	{ OPCODE(F32ConvertSI64); RETURN(CONVERT); }
+#line 13266 "src/prebuilt/wast-lexer-gen.cc"
+yy1633:
+#line 504 "src/wast-lexer.cc"
+	{ OPCODE(F64ConvertSI64); RETURN(CONVERT); }
+#line 13270 "src/prebuilt/wast-lexer-gen.cc"
+yy1634:
+#line 505 "src/wast-lexer.cc"
+	{ OPCODE(F32ConvertUI32); RETURN(CONVERT); }
+#line 13274 "src/prebuilt/wast-lexer-gen.cc"
+yy1635:
+#line 506 "src/wast-lexer.cc"
+	{ OPCODE(F64ConvertUI32); RETURN(CONVERT); }
+#line 13278 "src/prebuilt/wast-lexer-gen.cc"
+yy1636:
+#line 507 "src/wast-lexer.cc"
+	{ OPCODE(F32ConvertUI64); RETURN(CONVERT); }
+#line 13282 "src/prebuilt/wast-lexer-gen.cc"
+yy1637:
+#line 508 "src/wast-lexer.cc"
+	{ OPCODE(F64ConvertUI64); RETURN(CONVERT); }
+#line 13286 "src/prebuilt/wast-lexer-gen.cc"
+yy1638:
+#line 509 "src/wast-lexer.cc"
+	{ OPCODE(F64PromoteF32); RETURN(CONVERT); }
+#line 13290 "src/prebuilt/wast-lexer-gen.cc"
+yy1639:
+#line 510 "src/wast-lexer.cc"
+	{ OPCODE(F32DemoteF64); RETURN(CONVERT); }
+#line 13294 "src/prebuilt/wast-lexer-gen.cc"
+yy1640:
+#line 511 "src/wast-lexer.cc"
+	{ OPCODE(F32ReinterpretI32); RETURN(CONVERT); }
+#line 13298 "src/prebuilt/wast-lexer-gen.cc"
+yy1641:
+#line 512 "src/wast-lexer.cc"
+	{ OPCODE(I32ReinterpretF32); RETURN(CONVERT); }
+#line 13302 "src/prebuilt/wast-lexer-gen.cc"
+yy1642:
+#line 513 "src/wast-lexer.cc"
+	{ OPCODE(F64ReinterpretI64); RETURN(CONVERT); }
+#line 13306 "src/prebuilt/wast-lexer-gen.cc"
+yy1643:
+#line 514 "src/wast-lexer.cc"
+	{ OPCODE(I64ReinterpretF64); RETURN(CONVERT); }
+#line 13310 "src/prebuilt/wast-lexer-gen.cc"
+yy1644:
+#line 515 "src/wast-lexer.cc"
+	{ RETURN(SELECT); }
+#line 13314 "src/prebuilt/wast-lexer-gen.cc"
+yy1645:
+#line 516 "src/wast-lexer.cc"
+	{ RETURN(UNREACHABLE); }
+#line 13318 "src/prebuilt/wast-lexer-gen.cc"
+yy1646:
+#line 517 "src/wast-lexer.cc"
+	{ RETURN(CURRENT_MEMORY); }
+#line 13322 "src/prebuilt/wast-lexer-gen.cc"
+yy1647:
+#line 518 "src/wast-lexer.cc"
+	{ RETURN(GROW_MEMORY); }
+#line 13326 "src/prebuilt/wast-lexer-gen.cc"
+yy1648:
+#line 519 "src/wast-lexer.cc"
+	{ OPCODE(MemoryCopy); RETURN(MEMORY_COPY); }
+#line 13330 "src/prebuilt/wast-lexer-gen.cc"
+yy1649:
+#line 520 "src/wast-lexer.cc"
+	{ OPCODE(MemoryFill); RETURN(MEMORY_FILL); }
+#line 13334 "src/prebuilt/wast-lexer-gen.cc"
+yy1650:
+#line 521 "src/wast-lexer.cc"
+	{ RETURN(TYPE); }
+#line 13338 "src/prebuilt/wast-lexer-gen.cc"
+yy1651:
+#line 522 "src/wast-lexer.cc"
+	{ RETURN(FUNC); }
+#line 13342 "src/prebuilt/wast-lexer-gen.cc"
+yy1652:
+#line 523 "src/wast-lexer.cc"
+	{ RETURN(PARAM); }
+#line 13346 "src/prebuilt/wast-lexer-gen.cc"
+yy1653:
+#line 524 "src/wast-lexer.cc"
+	{ RETURN(RESULT); }
+#line 13350 "src/prebuilt/wast-lexer-gen.cc"
+yy1654:
+#line 525 "src/wast-lexer.cc"
+	{ RETURN(LOCAL); }
+#line 13354 "src/prebuilt/wast-lexer-gen.cc"
+yy1655:
+#line 526 "src/wast-lexer.cc"
+	{ RETURN(GLOBAL); }
+#line 13358 "src/prebuilt/wast-lexer-gen.cc"
+yy1656:
+#line 527 "src/wast-lexer.cc"
+	{ RETURN(MODULE); }
+#line 13362 "src/prebuilt/wast-lexer-gen.cc"
+yy1657:
+#line 528 "src/wast-lexer.cc"
+	{ RETURN(BIN); }
+#line 13366 "src/prebuilt/wast-lexer-gen.cc"
+yy1658:
+#line 529 "src/wast-lexer.cc"
+	{ RETURN(QUOTE); }
+#line 13370 "src/prebuilt/wast-lexer-gen.cc"
+yy1659:
+#line 530 "src/wast-lexer.cc"
+	{ RETURN(TABLE); }
+#line 13374 "src/prebuilt/wast-lexer-gen.cc"
+yy1660:
+#line 531 "src/wast-lexer.cc"
+	{ RETURN(MEMORY); }
+#line 13378 "src/prebuilt/wast-lexer-gen.cc"
+yy1661:
+#line 532 "src/wast-lexer.cc"
+	{ RETURN(START); }
+#line 13382 "src/prebuilt/wast-lexer-gen.cc"
+yy1662:
+#line 533 "src/wast-lexer.cc"
+	{ RETURN(ELEM); }
+#line 13386 "src/prebuilt/wast-lexer-gen.cc"
+yy1663:
+#line 534 "src/wast-lexer.cc"
+	{ RETURN(DATA); }
+#line 13390 "src/prebuilt/wast-lexer-gen.cc"
+yy1664:
+#line 535 "src/wast-lexer.cc"
+	{ RETURN(OFFSET); }
+#line 13394 "src/prebuilt/wast-lexer-gen.cc"
+yy1665:
+#line 536 "src/wast-lexer.cc"
+	{ RETURN(IMPORT); }
+#line 13398 "src/prebuilt/wast-lexer-gen.cc"
+yy1666:
+#line 537 "src/wast-lexer.cc"
+	{ RETURN(EXPORT); }
+#line 13402 "src/prebuilt/wast-lexer-gen.cc"
+yy1667:
+#line 538 "src/wast-lexer.cc"
+	{ RETURN(EXCEPT); }
+#line 13406 "src/prebuilt/wast-lexer-gen.cc"
+yy1668:
+#line 539 "src/wast-lexer.cc"
+	{ RETURN(REGISTER); }
+#line 13410 "src/prebuilt/wast-lexer-gen.cc"
+yy1669:
+#line 540 "src/wast-lexer.cc"
+	{ RETURN(INVOKE); }
+#line 13414 "src/prebuilt/wast-lexer-gen.cc"
+yy1670:
+#line 541 "src/wast-lexer.cc"
+	{ RETURN(GET); }
+#line 13418 "src/prebuilt/wast-lexer-gen.cc"
+yy1671:
+#line 542 "src/wast-lexer.cc"
+	{ RETURN(ASSERT_MALFORMED); }
+#line 13422 "src/prebuilt/wast-lexer-gen.cc"
+yy1672:
+#line 543 "src/wast-lexer.cc"
+	{ RETURN(ASSERT_INVALID); }
+#line 13426 "src/prebuilt/wast-lexer-gen.cc"
+yy1673:
+#line 544 "src/wast-lexer.cc"
+	{ RETURN(ASSERT_UNLINKABLE); }
+#line 13430 "src/prebuilt/wast-lexer-gen.cc"
+yy1674:
+#line 545 "src/wast-lexer.cc"
+	{ RETURN(ASSERT_RETURN); }
+#line 13434 "src/prebuilt/wast-lexer-gen.cc"
+yy1675:
+#line 546 "src/wast-lexer.cc"
+	{
+                                  RETURN(ASSERT_RETURN_CANONICAL_NAN); }
+#line 13439 "src/prebuilt/wast-lexer-gen.cc"
+yy1676:
+#line 548 "src/wast-lexer.cc"
+	{
+                                  RETURN(ASSERT_RETURN_ARITHMETIC_NAN); }
+#line 13444 "src/prebuilt/wast-lexer-gen.cc"
+yy1677:
+#line 550 "src/wast-lexer.cc"
+	{ RETURN(ASSERT_TRAP); }
+#line 13448 "src/prebuilt/wast-lexer-gen.cc"
+yy1678:
+#line 551 "src/wast-lexer.cc"
+	{ RETURN(ASSERT_EXHAUSTION); }
+#line 13452 "src/prebuilt/wast-lexer-gen.cc"
+yy1679:
+#line 552 "src/wast-lexer.cc"
+	{ RETURN(TRY); }
+#line 13456 "src/prebuilt/wast-lexer-gen.cc"
+yy1680:
+#line 553 "src/wast-lexer.cc"
+	{ RETURN_LPAR(CATCH); }
+#line 13460 "src/prebuilt/wast-lexer-gen.cc"
+yy1681:
+#line 554 "src/wast-lexer.cc"
+	{ RETURN_LPAR(CATCH_ALL); }
+#line 13464 "src/prebuilt/wast-lexer-gen.cc"
+yy1682:
+#line 555 "src/wast-lexer.cc"
+	{ RETURN(THROW); }
+#line 13468 "src/prebuilt/wast-lexer-gen.cc"
+yy1683:
+#line 556 "src/wast-lexer.cc"
+	{ RETURN(RETHROW); }
+#line 13472 "src/prebuilt/wast-lexer-gen.cc"
+yy1684:
+#line 557 "src/wast-lexer.cc"
+	{ RETURN(I8X16); }
+#line 13476 "src/prebuilt/wast-lexer-gen.cc"
+yy1685:
+#line 558 "src/wast-lexer.cc"
+	{ RETURN(I16X8); }
+#line 13480 "src/prebuilt/wast-lexer-gen.cc"
+yy1686:
+#line 559 "src/wast-lexer.cc"
+	{ RETURN(I32X4); }
+#line 13484 "src/prebuilt/wast-lexer-gen.cc"
+yy1687:
+#line 560 "src/wast-lexer.cc"
+	{ RETURN(I64X2); }
+#line 13488 "src/prebuilt/wast-lexer-gen.cc"
+yy1688:
+#line 561 "src/wast-lexer.cc"
+	{ RETURN(F32X4); }
+#line 13492 "src/prebuilt/wast-lexer-gen.cc"
+yy1689:
+#line 562 "src/wast-lexer.cc"
+	{ RETURN(F64X2); }
+#line 13496 "src/prebuilt/wast-lexer-gen.cc"
+yy1690:
+#line 563 "src/wast-lexer.cc"
+	{ OPCODE(I8X16Splat); RETURN(UNARY); }
+#line 13500 "src/prebuilt/wast-lexer-gen.cc"
+yy1691:
+#line 564 "src/wast-lexer.cc"
+	{ OPCODE(I16X8Splat); RETURN(UNARY); }
+#line 13504 "src/prebuilt/wast-lexer-gen.cc"
+yy1692:
+#line 565 "src/wast-lexer.cc"
+	{ OPCODE(I32X4Splat); RETURN(UNARY); }
+#line 13508 "src/prebuilt/wast-lexer-gen.cc"
+yy1693:
+#line 566 "src/wast-lexer.cc"
+	{ OPCODE(I64X2Splat); RETURN(UNARY); }
+#line 13512 "src/prebuilt/wast-lexer-gen.cc"
+yy1694:
+#line 567 "src/wast-lexer.cc"
+	{ OPCODE(F32X4Splat); RETURN(UNARY); }
+#line 13516 "src/prebuilt/wast-lexer-gen.cc"
+yy1695:
+#line 568 "src/wast-lexer.cc"
+	{ OPCODE(F64X2Splat); RETURN(UNARY); }
+#line 13520 "src/prebuilt/wast-lexer-gen.cc"
+yy1696:
+#line 569 "src/wast-lexer.cc"
+	{
+                                  OPCODE(I32X4ExtractLane);
+                                  RETURN(SIMD_LANE_OP); }
+#line 13526 "src/prebuilt/wast-lexer-gen.cc"
+yy1697:
+#line 572 "src/wast-lexer.cc"
+	{
+                                  OPCODE(I32X4ReplaceLane);
+                                  RETURN(SIMD_LANE_OP); }
+#line 13532 "src/prebuilt/wast-lexer-gen.cc"
+yy1698:
+#line 575 "src/wast-lexer.cc"
+	{
+                                  OPCODE(I64X2ExtractLane);
+                                  RETURN(SIMD_LANE_OP); }
+#line 13538 "src/prebuilt/wast-lexer-gen.cc"
+yy1699:
+#line 578 "src/wast-lexer.cc"
+	{
+                                  OPCODE(I64X2ReplaceLane);
+                                  RETURN(SIMD_LANE_OP); }
+#line 13544 "src/prebuilt/wast-lexer-gen.cc"
+yy1700:
+#line 581 "src/wast-lexer.cc"
+	{
+                                  OPCODE(F32X4ExtractLane);
+                                  RETURN(SIMD_LANE_OP); }
+#line 13550 "src/prebuilt/wast-lexer-gen.cc"
+yy1701:
+#line 584 "src/wast-lexer.cc"
+	{
+                                  OPCODE(F32X4ReplaceLane);
+                                  RETURN(SIMD_LANE_OP); }
+#line 13556 "src/prebuilt/wast-lexer-gen.cc"
+yy1702:
+#line 587 "src/wast-lexer.cc"
+	{
+                                  OPCODE(F64X2ExtractLane);
+                                  RETURN(SIMD_LANE_OP); }
+#line 13562 "src/prebuilt/wast-lexer-gen.cc"
+yy1703:
+#line 590 "src/wast-lexer.cc"
+	{
+                                  OPCODE(F64X2ReplaceLane);
+                                  RETURN(SIMD_LANE_OP); }
+#line 13568 "src/prebuilt/wast-lexer-gen.cc"
+yy1704:
+#line 593 "src/wast-lexer.cc"
+	{ OPCODE(V128Not); RETURN(UNARY); }
+#line 13572 "src/prebuilt/wast-lexer-gen.cc"
+yy1705:
+#line 594 "src/wast-lexer.cc"
+	{ OPCODE(V128And); RETURN(BINARY); }
+#line 13576 "src/prebuilt/wast-lexer-gen.cc"
+yy1706:
+#line 595 "src/wast-lexer.cc"
+	{ OPCODE(V128Andnot); RETURN(BINARY); }
+#line 13580 "src/prebuilt/wast-lexer-gen.cc"
+yy1707:
+#line 596 "src/wast-lexer.cc"
+	{ OPCODE(V128Or); RETURN(BINARY); }
+#line 13584 "src/prebuilt/wast-lexer-gen.cc"
+yy1708:
+#line 597 "src/wast-lexer.cc"
+	{ OPCODE(V128Xor); RETURN(BINARY); }
+#line 13588 "src/prebuilt/wast-lexer-gen.cc"
+yy1709:
+#line 598 "src/wast-lexer.cc"
+	{ OPCODE(I8X16Add); RETURN(BINARY); }
+#line 13592 "src/prebuilt/wast-lexer-gen.cc"
+yy1710:
+#line 599 "src/wast-lexer.cc"
+	{ OPCODE(I8X16Sub); RETURN(BINARY); }
+#line 13596 "src/prebuilt/wast-lexer-gen.cc"
+yy1711:
+#line 600 "src/wast-lexer.cc"
+	{ OPCODE(I16X8Add); RETURN(BINARY); }
+#line 13600 "src/prebuilt/wast-lexer-gen.cc"
+yy1712:
+#line 601 "src/wast-lexer.cc"
+	{ OPCODE(I16X8Sub); RETURN(BINARY); }
+#line 13604 "src/prebuilt/wast-lexer-gen.cc"
+yy1713:
+#line 602 "src/wast-lexer.cc"
+	{ OPCODE(I16X8Mul); RETURN(BINARY); }
+#line 13608 "src/prebuilt/wast-lexer-gen.cc"
+yy1714:
+#line 603 "src/wast-lexer.cc"
+	{ OPCODE(I32X4Add); RETURN(BINARY); }
+#line 13612 "src/prebuilt/wast-lexer-gen.cc"
+yy1715:
+#line 604 "src/wast-lexer.cc"
+	{ OPCODE(I32X4Sub); RETURN(BINARY); }
+#line 13616 "src/prebuilt/wast-lexer-gen.cc"
+yy1716:
+#line 605 "src/wast-lexer.cc"
+	{ OPCODE(I32X4Mul); RETURN(BINARY); }
+#line 13620 "src/prebuilt/wast-lexer-gen.cc"
+yy1717:
+#line 606 "src/wast-lexer.cc"
+	{ OPCODE(I64X2Add); RETURN(BINARY); }
+#line 13624 "src/prebuilt/wast-lexer-gen.cc"
+yy1718:
+#line 607 "src/wast-lexer.cc"
+	{ OPCODE(I64X2Sub); RETURN(BINARY); }
+#line 13628 "src/prebuilt/wast-lexer-gen.cc"
+yy1719:
+#line 608 "src/wast-lexer.cc"
+	{ OPCODE(I64X2Mul); RETURN(BINARY); }
+#line 13632 "src/prebuilt/wast-lexer-gen.cc"
+yy1720:
+#line 609 "src/wast-lexer.cc"
+	{ OPCODE(F32X4Add); RETURN(BINARY); }
+#line 13636 "src/prebuilt/wast-lexer-gen.cc"
+yy1721:
+#line 610 "src/wast-lexer.cc"
+	{ OPCODE(F32X4Sub); RETURN(BINARY); }
+#line 13640 "src/prebuilt/wast-lexer-gen.cc"
+yy1722:
+#line 611 "src/wast-lexer.cc"
+	{ OPCODE(F32X4Mul); RETURN(BINARY); }
+#line 13644 "src/prebuilt/wast-lexer-gen.cc"
+yy1723:
+#line 612 "src/wast-lexer.cc"
+	{ OPCODE(F32X4Div); RETURN(BINARY); }
+#line 13648 "src/prebuilt/wast-lexer-gen.cc"
+yy1724:
+#line 613 "src/wast-lexer.cc"
+	{ OPCODE(F64X2Add); RETURN(BINARY); }
+#line 13652 "src/prebuilt/wast-lexer-gen.cc"
+yy1725:
+#line 614 "src/wast-lexer.cc"
+	{ OPCODE(F64X2Sub); RETURN(BINARY); }
+#line 13656 "src/prebuilt/wast-lexer-gen.cc"
+yy1726:
+#line 615 "src/wast-lexer.cc"
+	{ OPCODE(F64X2Mul); RETURN(BINARY); }
+#line 13660 "src/prebuilt/wast-lexer-gen.cc"
+yy1727:
+#line 616 "src/wast-lexer.cc"
+	{ OPCODE(F64X2Div); RETURN(BINARY); }
+#line 13664 "src/prebuilt/wast-lexer-gen.cc"
+yy1728:
+#line 617 "src/wast-lexer.cc"
+	{ RETURN(SHARED); }
+#line 13668 "src/prebuilt/wast-lexer-gen.cc"
+yy1729:
+#line 618 "src/wast-lexer.cc"
+	{
+                                  OPCODE(MemoryAtomicNotify);
+                                  RETURN(ATOMIC_NOTIFY); }
+#line 13674 "src/prebuilt/wast-lexer-gen.cc"
+yy1730:
+#line 621 "src/wast-lexer.cc"
+	{
+                                  OPCODE(MemoryAtomicWait32);
+                                  RETURN(ATOMIC_WAIT); }
+#line 13680 "src/prebuilt/wast-lexer-gen.cc"
+yy1731:
+#line 624 "src/wast-lexer.cc"
+	{
+                                  OPCODE(MemoryAtomicWait64);
+                                  RETURN(ATOMIC_WAIT); }
+#line 13686 "src/prebuilt/wast-lexer-gen.cc"
+yy1732:
+#line 627 "src/wast-lexer.cc"
+	{ OPCODE(I32AtomicLoad); RETURN(ATOMIC_LOAD); }
+#line 13690 "src/prebuilt/wast-lexer-gen.cc"
+yy1733:
+#line 628 "src/wast-lexer.cc"
+	{ OPCODE(I64AtomicLoad); RETURN(ATOMIC_LOAD); }
+#line 13694 "src/prebuilt/wast-lexer-gen.cc"
+yy1734:
+#line 629 "src/wast-lexer.cc"
+	{
+                                  OPCODE(I32AtomicLoad8U);
+                                  RETURN(ATOMIC_LOAD); }
+#line 13700 "src/prebuilt/wast-lexer-gen.cc"
+yy1735:
+#line 632 "src/wast-lexer.cc"
+	{
+                                  OPCODE(I32AtomicLoad16U);
+                                  RETURN(ATOMIC_LOAD); }
+#line 13706 "src/prebuilt/wast-lexer-gen.cc"
+yy1736:
+#line 635 "src/wast-lexer.cc"
+	{
+                                  OPCODE(I64AtomicLoad8U);
+                                  RETURN(ATOMIC_LOAD); }
+#line 13712 "src/prebuilt/wast-lexer-gen.cc"
+yy1737:
+#line 638 "src/wast-lexer.cc"
+	{
+                                  OPCODE(I64AtomicLoad16U);
+                                  RETURN(ATOMIC_LOAD); }
+#line 13718 "src/prebuilt/wast-lexer-gen.cc"
+yy1738:
+#line 641 "src/wast-lexer.cc"
+	{
+                                  OPCODE(I64AtomicLoad32U);
+                                  RETURN(ATOMIC_LOAD); }
+#line 13724 "src/prebuilt/wast-lexer-gen.cc"
+yy1739:
+#line 644 "src/wast-lexer.cc"
+	{
+                                  OPCODE(I32AtomicStore);
+                                  RETURN(ATOMIC_STORE); }
+#line 13730 "src/prebuilt/wast-lexer-gen.cc"
+yy1740:
+#line 647 "src/wast-lexer.cc"
+	{
+                                  OPCODE(I64AtomicStore);
+                                  RETURN(ATOMIC_STORE); }
+#line 13736 "src/prebuilt/wast-lexer-gen.cc"
+yy1741:
+#line 650 "src/wast-lexer.cc"
+	{
+                                  OPCODE(I32AtomicStore8);
+                                  RETURN(ATOMIC_STORE); }
+#line 13742 "src/prebuilt/wast-lexer-gen.cc"
+yy1742:
+#line 653 "src/wast-lexer.cc"
+	{
+                                  OPCODE(I32AtomicStore16);
+                                  RETURN(ATOMIC_STORE); }
+#line 13748 "src/prebuilt/wast-lexer-gen.cc"
+yy1743:
+#line 656 "src/wast-lexer.cc"
+	{
+                                  OPCODE(I64AtomicStore8);
+                                  RETURN(ATOMIC_STORE); }
+#line 13754 "src/prebuilt/wast-lexer-gen.cc"
+yy1744:
+#line 659 "src/wast-lexer.cc"
+	{
+                                  OPCODE(I64AtomicStore16);
+                                  RETURN(ATOMIC_STORE); }
+#line 13760 "src/prebuilt/wast-lexer-gen.cc"
+yy1745:
+#line 662 "src/wast-lexer.cc"
+	{
+                                  OPCODE(I64AtomicStore32);
+                                  RETURN(ATOMIC_STORE); }
+#line 13766 "src/prebuilt/wast-lexer-gen.cc"
+yy1746:
+#line 665 "src/wast-lexer.cc"
+	{ OPCODE(I32AtomicRmwAdd); RETURN(ATOMIC_RMW); }
+#line 13770 "src/prebuilt/wast-lexer-gen.cc"
+yy1747:
+#line 666 "src/wast-lexer.cc"
+	{ OPCODE(I64AtomicRmwAdd); RETURN(ATOMIC_RMW); }
+#line 13774 "src/prebuilt/wast-lexer-gen.cc"
+yy1748:
+#line 667 "src/wast-lexer.cc"
+	{
+                                  OPCODE(I32AtomicRmw8UAdd);
+                                  RETURN(ATOMIC_RMW); }
+#line 13780 "src/prebuilt/wast-lexer-gen.cc"
+yy1749:
+#line 670 "src/wast-lexer.cc"
+	{
+                                  OPCODE(I32AtomicRmw16UAdd);
+                                  RETURN(ATOMIC_RMW); }
+#line 13786 "src/prebuilt/wast-lexer-gen.cc"
+yy1750:
+#line 673 "src/wast-lexer.cc"
+	{
+                                  OPCODE(I64AtomicRmw8UAdd);
+                                  RETURN(ATOMIC_RMW); }
+#line 13792 "src/prebuilt/wast-lexer-gen.cc"
+yy1751:
+#line 676 "src/wast-lexer.cc"
+	{
+                                  OPCODE(I64AtomicRmw16UAdd);
+                                  RETURN(ATOMIC_RMW); }
+#line 13798 "src/prebuilt/wast-lexer-gen.cc"
+yy1752:
+#line 679 "src/wast-lexer.cc"
+	{
+                                  OPCODE(I64AtomicRmw32UAdd);
+                                  RETURN(ATOMIC_RMW); }
+#line 13804 "src/prebuilt/wast-lexer-gen.cc"
+yy1753:
+#line 682 "src/wast-lexer.cc"
+	{ OPCODE(I32AtomicRmwSub); RETURN(ATOMIC_RMW); }
+#line 13808 "src/prebuilt/wast-lexer-gen.cc"
+yy1754:
+#line 683 "src/wast-lexer.cc"
+	{ OPCODE(I64AtomicRmwSub); RETURN(ATOMIC_RMW); }
+#line 13812 "src/prebuilt/wast-lexer-gen.cc"
+yy1755:
+#line 684 "src/wast-lexer.cc"
+	{
+                                  OPCODE(I32AtomicRmw8USub);
+                                  RETURN(ATOMIC_RMW); }
+#line 13818 "src/prebuilt/wast-lexer-gen.cc"
+yy1756:
+#line 687 "src/wast-lexer.cc"
+	{
+                                  OPCODE(I32AtomicRmw16USub);
+                                  RETURN(ATOMIC_RMW); }
+#line 13824 "src/prebuilt/wast-lexer-gen.cc"
+yy1757:
+#line 690 "src/wast-lexer.cc"
+	{
+                                  OPCODE(I64AtomicRmw8USub);
+                                  RETURN(ATOMIC_RMW); }
+#line 13830 "src/prebuilt/wast-lexer-gen.cc"
+yy1758:
+#line 693 "src/wast-lexer.cc"
+	{
+                                  OPCODE(I64AtomicRmw16USub);
+                                  RETURN(ATOMIC_RMW); }
+#line 13836 "src/prebuilt/wast-lexer-gen.cc"
+yy1759:
+#line 696 "src/wast-lexer.cc"
+	{
+                                  OPCODE(I64AtomicRmw32USub);
+                                  RETURN(ATOMIC_RMW); }
+#line 13842 "src/prebuilt/wast-lexer-gen.cc"
+yy1760:
+#line 699 "src/wast-lexer.cc"
+	{ OPCODE(I32AtomicRmwAnd); RETURN(ATOMIC_RMW); }
+#line 13846 "src/prebuilt/wast-lexer-gen.cc"
+yy1761:
+#line 700 "src/wast-lexer.cc"
+	{ OPCODE(I64AtomicRmwAnd); RETURN(ATOMIC_RMW); }
+#line 13850 "src/prebuilt/wast-lexer-gen.cc"
+yy1762:
+#line 701 "src/wast-lexer.cc"
+	{
+                                  OPCODE(I32AtomicRmw8UAnd);
+                                  RETURN(ATOMIC_RMW); }
+#line 13856 "src/prebuilt/wast-lexer-gen.cc"
+yy1763:
+#line 704 "src/wast-lexer.cc"
+	{
+                                  OPCODE(I32AtomicRmw16UAnd);
+                                  RETURN(ATOMIC_RMW); }
+#line 13862 "src/prebuilt/wast-lexer-gen.cc"
+yy1764:
+#line 707 "src/wast-lexer.cc"
+	{
+                                  OPCODE(I64AtomicRmw8UAnd);
+                                  RETURN(ATOMIC_RMW); }
+#line 13868 "src/prebuilt/wast-lexer-gen.cc"
+yy1765:
+#line 710 "src/wast-lexer.cc"
+	{
+                                  OPCODE(I64AtomicRmw16UAnd);
+                                  RETURN(ATOMIC_RMW); }
+#line 13874 "src/prebuilt/wast-lexer-gen.cc"
+yy1766:
+#line 713 "src/wast-lexer.cc"
+	{
+                                  OPCODE(I64AtomicRmw32UAnd);
+                                  RETURN(ATOMIC_RMW); }
+#line 13880 "src/prebuilt/wast-lexer-gen.cc"
+yy1767:
+#line 716 "src/wast-lexer.cc"
+	{ OPCODE(I32AtomicRmwOr); RETURN(ATOMIC_RMW); }
+#line 13884 "src/prebuilt/wast-lexer-gen.cc"
+yy1768:
+#line 717 "src/wast-lexer.cc"
+	{ OPCODE(I64AtomicRmwOr); RETURN(ATOMIC_RMW); }
+#line 13888 "src/prebuilt/wast-lexer-gen.cc"
+yy1769:
+#line 718 "src/wast-lexer.cc"
+	{
+                                  OPCODE(I32AtomicRmw8UOr);
+                                  RETURN(ATOMIC_RMW); }
+#line 13894 "src/prebuilt/wast-lexer-gen.cc"
+yy1770:
+#line 721 "src/wast-lexer.cc"
+	{
+                                  OPCODE(I32AtomicRmw16UOr);
+                                  RETURN(ATOMIC_RMW); }
+#line 13900 "src/prebuilt/wast-lexer-gen.cc"
+yy1771:
+#line 724 "src/wast-lexer.cc"
+	{
+                                  OPCODE(I64AtomicRmw8UOr);
+                                  RETURN(ATOMIC_RMW); }
+#line 13906 "src/prebuilt/wast-lexer-gen.cc"
+yy1772:
+#line 727 "src/wast-lexer.cc"
+	{
+                                  OPCODE(I64AtomicRmw16UOr);
+                                  RETURN(ATOMIC_RMW); }
+#line 13912 "src/prebuilt/wast-lexer-gen.cc"
+yy1773:
+#line 730 "src/wast-lexer.cc"
+	{
+                                  OPCODE(I64AtomicRmw32UOr);
+                                  RETURN(ATOMIC_RMW); }
+#line 13918 "src/prebuilt/wast-lexer-gen.cc"
+yy1774:
+#line 733 "src/wast-lexer.cc"
+	{ OPCODE(I32AtomicRmwXor); RETURN(ATOMIC_RMW); }
+#line 13922 "src/prebuilt/wast-lexer-gen.cc"
+yy1775:
+#line 734 "src/wast-lexer.cc"
+	{ OPCODE(I64AtomicRmwXor); RETURN(ATOMIC_RMW); }
+#line 13926 "src/prebuilt/wast-lexer-gen.cc"
+yy1776:
+#line 735 "src/wast-lexer.cc"
+	{
+                                  OPCODE(I32AtomicRmw8UXor);
+                                  RETURN(ATOMIC_RMW); }
+#line 13932 "src/prebuilt/wast-lexer-gen.cc"
+yy1777:
+#line 738 "src/wast-lexer.cc"
+	{
+                                  OPCODE(I32AtomicRmw16UXor);
+                                  RETURN(ATOMIC_RMW); }
+#line 13938 "src/prebuilt/wast-lexer-gen.cc"
+yy1778:
+#line 741 "src/wast-lexer.cc"
+	{
+                                  OPCODE(I64AtomicRmw8UXor);
+                                  RETURN(ATOMIC_RMW); }
+#line 13944 "src/prebuilt/wast-lexer-gen.cc"
+yy1779:
+#line 744 "src/wast-lexer.cc"
+	{
+                                  OPCODE(I64AtomicRmw16UXor);
+                                  RETURN(ATOMIC_RMW); }
+#line 13950 "src/prebuilt/wast-lexer-gen.cc"
+yy1780:
+#line 747 "src/wast-lexer.cc"
+	{
+                                  OPCODE(I64AtomicRmw32UXor);
+                                  RETURN(ATOMIC_RMW); }
+#line 13956 "src/prebuilt/wast-lexer-gen.cc"
+yy1781:
+#line 750 "src/wast-lexer.cc"
+	{
+                                  OPCODE(I32AtomicRmwXchg);
+                                  RETURN(ATOMIC_RMW); }
+#line 13962 "src/prebuilt/wast-lexer-gen.cc"
+yy1782:
+#line 753 "src/wast-lexer.cc"
+	{
+                                  OPCODE(I64AtomicRmwXchg);
+                                  RETURN(ATOMIC_RMW); }
+#line 13968 "src/prebuilt/wast-lexer-gen.cc"
+yy1783:
+#line 756 "src/wast-lexer.cc"
+	{
+                                  OPCODE(I32AtomicRmw8UXchg);
+                                  RETURN(ATOMIC_RMW); }
+#line 13974 "src/prebuilt/wast-lexer-gen.cc"
+yy1784:
+#line 759 "src/wast-lexer.cc"
+	{
+                                  OPCODE(I32AtomicRmw16UXchg);
+                                  RETURN(ATOMIC_RMW); }
+#line 13980 "src/prebuilt/wast-lexer-gen.cc"
+yy1785:
+#line 762 "src/wast-lexer.cc"
+	{
+                                  OPCODE(I64AtomicRmw8UXchg);
+                                  RETURN(ATOMIC_RMW); }
+#line 13986 "src/prebuilt/wast-lexer-gen.cc"
+yy1786:
+#line 765 "src/wast-lexer.cc"
+	{
+                                  OPCODE(I64AtomicRmw16UXchg);
+                                  RETURN(ATOMIC_RMW); }
+#line 13992 "src/prebuilt/wast-lexer-gen.cc"
+yy1787:
+#line 768 "src/wast-lexer.cc"
+	{
+                                  OPCODE(I64AtomicRmw32UXchg);
+                                  RETURN(ATOMIC_RMW); }
+#line 13998 "src/prebuilt/wast-lexer-gen.cc"
+yy1788:
+#line 771 "src/wast-lexer.cc"
+	{
+                                  OPCODE(I32AtomicRmwCmpxchg);
+                                  RETURN(ATOMIC_RMW_CMPXCHG); }
+#line 14004 "src/prebuilt/wast-lexer-gen.cc"
+yy1789:
+#line 774 "src/wast-lexer.cc"
+	{
+                                  OPCODE(I64AtomicRmwCmpxchg);
+                                  RETURN(ATOMIC_RMW_CMPXCHG); }
+#line 14010 "src/prebuilt/wast-lexer-gen.cc"
+yy1790:
+#line 777 "src/wast-lexer.cc"
+	{
+                                  OPCODE(I32AtomicRmw8UCmpxchg);
+                                  RETURN(ATOMIC_RMW_CMPXCHG); }
+#line 14016 "src/prebuilt/wast-lexer-gen.cc"
+yy1791:
+#line 780 "src/wast-lexer.cc"
+	{
+                                  OPCODE(I32AtomicRmw16UCmpxchg);
+                                  RETURN(ATOMIC_RMW_CMPXCHG); }
+#line 14022 "src/prebuilt/wast-lexer-gen.cc"
+yy1792:
+#line 783 "src/wast-lexer.cc"
+	{
+                                  OPCODE(I64AtomicRmw8UCmpxchg);
+                                  RETURN(ATOMIC_RMW_CMPXCHG); }
+#line 14028 "src/prebuilt/wast-lexer-gen.cc"
+yy1793:
+#line 786 "src/wast-lexer.cc"
+	{
+                                  OPCODE(I64AtomicRmw16UCmpxchg);
+                                  RETURN(ATOMIC_RMW_CMPXCHG); }
+#line 14034 "src/prebuilt/wast-lexer-gen.cc"
+yy1794:
+#line 789 "src/wast-lexer.cc"
+	{
+                                  OPCODE(I64AtomicRmw32UCmpxchg);
+                                  RETURN(ATOMIC_RMW_CMPXCHG); }
+#line 14040 "src/prebuilt/wast-lexer-gen.cc"
+yy1795:
+#line 792 "src/wast-lexer.cc"
+	{ SetText(); RETURN(VAR); }
+#line 14044 "src/prebuilt/wast-lexer-gen.cc"
+yy1796:
+	BEGIN(YYCOND_LINE_COMMENT);
+#line 794 "src/wast-lexer.cc"
+	{ continue; }
+#line 14049 "src/prebuilt/wast-lexer-gen.cc"
+yy1797:
+	BEGIN(YYCOND_BLOCK_COMMENT);
+#line 797 "src/wast-lexer.cc"
+	{ COMMENT_NESTING = 1; continue; }
+#line 14054 "src/prebuilt/wast-lexer-gen.cc"
+yy1798:
+#line 805 "src/wast-lexer.cc"
+	{ NEWLINE; continue; }
+#line 14058 "src/prebuilt/wast-lexer-gen.cc"
+yy1799:
+#line 806 "src/wast-lexer.cc"
+	{ continue; }
+#line 14062 "src/prebuilt/wast-lexer-gen.cc"
+yy1800:
+#line 807 "src/wast-lexer.cc"
+	{ ERROR("unexpected token \"%.*s\"",
+                                        static_cast<int>(yyleng), yytext);
+                                  continue; }
+#line 14068 "src/prebuilt/wast-lexer-gen.cc"
+yy1801:
+#line 810 "src/wast-lexer.cc"
+	{ ERROR("unexpected char"); continue; }
+#line 14072 "src/prebuilt/wast-lexer-gen.cc"
+yy1802:
+#line 811 "src/wast-lexer.cc"
+	{ MAYBE_MALFORMED_UTF8(""); }
+#line 14076 "src/prebuilt/wast-lexer-gen.cc"
+/* *********************************** */
+YYCOND_BAD_TEXT:
+	if ((limit_ - cursor_) < 5) FILL(5);
+	yych = *cursor_;
+	if (yybm[0+yych] & 4) {
+		goto yy1804;
+	}
+	if (yych <= 0xC1) {
+		if (yych <= 0x1F) {
+			if (yych == '\n') goto yy1813;
+			goto yy1812;
+		} else {
+			if (yych <= '"') {
+				goto yy1811;
+			} else {
+				if (yych <= '\\') goto yy1814;
+				goto yy1815;
+			}
+		}
+	} else {
+		if (yych <= 0xEF) {
+			if (yych <= 0xDF) {
+				goto yy1805;
+			} else {
+				if (yych == 0xE0) goto yy1806;
+				goto yy1807;
+			}
+		} else {
+			if (yych <= 0xF3) {
+				if (yych == 0xF0) goto yy1808;
+				goto yy1809;
+			} else {
+				if (yych == 0xF4) goto yy1810;
+				goto yy1815;
+			}
+		}
+	}
+yy1804:
+	++cursor_;
+	goto yy1826;
+yy1805:
+	++cursor_;
+	yych = *cursor_;
+	if (yych <= 0x7F) {
+		goto yy1831;
+	} else {
+		if (yych <= 0xBF) goto yy1804;
+		goto yy1831;
+	}
+yy1806:
+	++cursor_;
+	yyaccept = 2;
+	marker_ = cursor_;
+	yych = *cursor_;
+	if (yych <= 0x9F) {
+		goto yy1831;
+	} else {
+		if (yych <= 0xBF) goto yy1816;
+		goto yy1831;
+	}
+yy1807:
+	++cursor_;
+	yyaccept = 2;
+	marker_ = cursor_;
+	yych = *cursor_;
+	if (yych <= 0x7F) {
+		goto yy1831;
+	} else {
+		if (yych <= 0xBF) goto yy1816;
+		goto yy1831;
+	}
+yy1808:
+	++cursor_;
+	yyaccept = 2;
+	marker_ = cursor_;
+	yych = *cursor_;
+	if (yych <= 0x8F) {
+		goto yy1831;
+	} else {
+		if (yych <= 0xBF) goto yy1817;
+		goto yy1831;
+	}
+yy1809:
+	++cursor_;
+	yyaccept = 2;
+	marker_ = cursor_;
+	yych = *cursor_;
+	if (yych <= 0x7F) {
+		goto yy1831;
+	} else {
+		if (yych <= 0xBF) goto yy1817;
+		goto yy1831;
+	}
+yy1810:
+	++cursor_;
+	yyaccept = 2;
+	marker_ = cursor_;
+	yych = *cursor_;
+	if (yych <= 0x7F) {
+		goto yy1831;
+	} else {
+		if (yych <= 0x8F) goto yy1817;
+		goto yy1831;
+	}
+yy1811:
+	++cursor_;
+	goto yy1829;
+yy1812:
+	++cursor_;
+	goto yy1830;
+yy1813:
+	++cursor_;
+	goto yy1827;
+yy1814:
+	++cursor_;
+	yyaccept = 3;
+	marker_ = cursor_;
+	yych = *cursor_;
+	if (yybm[0+yych] & 2) {
+		goto yy1819;
+	}
+	if (yybm[512+yych] & 1) {
+		goto yy1818;
+	}
+	if (yybm[512+yych] & 2) {
+		goto yy1804;
+	}
+	if (yych <= 0xEF) {
+		if (yych <= 0xDF) {
+			if (yych <= 0xC1) goto yy1830;
+			goto yy1820;
+		} else {
+			if (yych == 0xE0) goto yy1821;
+			goto yy1822;
+		}
+	} else {
+		if (yych <= 0xF3) {
+			if (yych == 0xF0) goto yy1823;
+			goto yy1824;
+		} else {
+			if (yych == 0xF4) goto yy1825;
+			goto yy1830;
+		}
+	}
+yy1815:
+	++cursor_;
+	goto yy1831;
+yy1816:
+	++cursor_;
+	yych = *cursor_;
+	if (yych <= 0x7F) {
+		goto yyback_BAD_TEXT;
+	} else {
+		if (yych <= 0xBF) goto yy1804;
+		goto yyback_BAD_TEXT;
+	}
+yy1817:
+	++cursor_;
+	yych = *cursor_;
+	if (yych <= 0x7F) {
+		goto yyback_BAD_TEXT;
+	} else {
+		if (yych <= 0xBF) goto yy1816;
+		goto yyback_BAD_TEXT;
+	}
+yy1818:
+	++cursor_;
+	yych = *cursor_;
+	if (yybm[512+yych] & 1) {
+		goto yy1804;
+	}
+	goto yy1828;
+yy1819:
+	++cursor_;
+	goto yy1828;
+yy1820:
+	++cursor_;
+	yych = *cursor_;
+	if (yych <= 0x7F) {
+		goto yyback_BAD_TEXT;
+	} else {
+		if (yych <= 0xBF) goto yy1819;
+		goto yyback_BAD_TEXT;
+	}
+yy1821:
+	++cursor_;
+	yych = *cursor_;
+	if (yych <= 0x9F) {
+		goto yyback_BAD_TEXT;
+	} else {
+		if (yych <= 0xBF) goto yy1820;
+		goto yyback_BAD_TEXT;
+	}
+yy1822:
+	++cursor_;
+	yych = *cursor_;
+	if (yych <= 0x7F) {
+		goto yyback_BAD_TEXT;
+	} else {
+		if (yych <= 0xBF) goto yy1820;
+		goto yyback_BAD_TEXT;
+	}
+yy1823:
+	++cursor_;
+	yych = *cursor_;
+	if (yych <= 0x8F) {
+		goto yyback_BAD_TEXT;
+	} else {
+		if (yych <= 0xBF) goto yy1822;
+		goto yyback_BAD_TEXT;
+	}
+yy1824:
+	++cursor_;
+	yych = *cursor_;
+	if (yych <= 0x7F) {
+		goto yyback_BAD_TEXT;
+	} else {
+		if (yych <= 0xBF) goto yy1822;
+		goto yyback_BAD_TEXT;
+	}
+yy1825:
+	++cursor_;
+	yych = *cursor_;
+	if (yych <= 0x7F) {
+		goto yyback_BAD_TEXT;
+	} else {
+		if (yych <= 0x8F) goto yy1822;
+		goto yyback_BAD_TEXT;
+	}
+yyback_BAD_TEXT:
+	cursor_ = marker_;
+	switch (yyaccept) {
+	case 2:
+		goto yy1831;
+	default:
+		goto yy1830;
+	}
+yy1826:
+#line 319 "src/wast-lexer.cc"
+	{ continue; }
+#line 14317 "src/prebuilt/wast-lexer-gen.cc"
+yy1827:
+	BEGIN(YYCOND_i);
+#line 320 "src/wast-lexer.cc"
+	{ ERROR("newline in string");
+                                  NEWLINE;
+                                  continue; }
+#line 14324 "src/prebuilt/wast-lexer-gen.cc"
+yy1828:
+#line 323 "src/wast-lexer.cc"
+	{ ERROR("bad escape \"%.*s\"",
+                                        static_cast<int>(yyleng), yytext);
+                                  continue; }
+#line 14330 "src/prebuilt/wast-lexer-gen.cc"
+yy1829:
+	BEGIN(YYCOND_i);
+#line 326 "src/wast-lexer.cc"
+	{ SetText(); RETURN(TEXT); }
+#line 14335 "src/prebuilt/wast-lexer-gen.cc"
+yy1830:
+#line 327 "src/wast-lexer.cc"
+	{ ERROR("illegal character in string");
+                                  continue; }
+#line 14340 "src/prebuilt/wast-lexer-gen.cc"
+yy1831:
+#line 329 "src/wast-lexer.cc"
+	{ MAYBE_MALFORMED_UTF8(" in string"); }
+#line 14344 "src/prebuilt/wast-lexer-gen.cc"
+/* *********************************** */
+YYCOND_LINE_COMMENT:
+	if ((limit_ - cursor_) < 2) FILL(2);
+	yych = *cursor_;
+	if (yych <= 0xDF) {
+		if (yych <= '\n') {
+			if (yych == '\n') goto yy1833;
+			goto yy1834;
+		} else {
+			if (yych <= 0x7F) {
+				goto yy1834;
+			} else {
+				if (yych <= 0xC1) goto yy1841;
+				goto yy1835;
+			}
+		}
+	} else {
+		if (yych <= 0xF0) {
+			if (yych <= 0xE0) {
+				goto yy1836;
+			} else {
+				if (yych == 0xF0) goto yy1838;
+				goto yy1837;
+			}
+		} else {
+			if (yych <= 0xF3) {
+				goto yy1839;
+			} else {
+				if (yych == 0xF4) goto yy1840;
+				goto yy1841;
+			}
+		}
+	}
+yy1833:
+	++cursor_;
+	goto yy1848;
+yy1834:
+	++cursor_;
+	yyaccept = 4;
+	marker_ = cursor_;
+	if (limit_ <= cursor_) FILL(1);
+	yych = *cursor_;
+	if (yych <= 0xDF) {
+		if (yych <= '\n') {
+			if (yych == '\n') goto yy1849;
+			goto yy1834;
+		} else {
+			if (yych <= 0x7F) {
+				goto yy1834;
+			} else {
+				if (yych <= 0xC1) goto yy1849;
+				goto yy1842;
+			}
+		}
+	} else {
+		if (yych <= 0xF0) {
+			if (yych <= 0xE0) {
+				goto yy1843;
+			} else {
+				if (yych == 0xF0) goto yy1845;
+				goto yy1844;
+			}
+		} else {
+			if (yych <= 0xF3) {
+				goto yy1846;
+			} else {
+				if (yych == 0xF4) goto yy1847;
+				goto yy1849;
+			}
+		}
+	}
+yy1835:
+	++cursor_;
+	yych = *cursor_;
+	if (yych <= 0x7F) {
+		goto yy1850;
+	} else {
+		if (yych <= 0xBF) goto yy1834;
+		goto yy1850;
+	}
+yy1836:
+	++cursor_;
+	yyaccept = 5;
+	marker_ = cursor_;
+	yych = *cursor_;
+	if (yych <= 0x9F) {
+		goto yy1850;
+	} else {
+		if (yych <= 0xBF) goto yy1842;
+		goto yy1850;
+	}
+yy1837:
+	++cursor_;
+	yyaccept = 5;
+	marker_ = cursor_;
+	yych = *cursor_;
+	if (yych <= 0x7F) {
+		goto yy1850;
+	} else {
+		if (yych <= 0xBF) goto yy1842;
+		goto yy1850;
+	}
+yy1838:
+	++cursor_;
+	yyaccept = 5;
+	marker_ = cursor_;
+	yych = *cursor_;
+	if (yych <= 0x8F) {
+		goto yy1850;
+	} else {
+		if (yych <= 0xBF) goto yy1844;
+		goto yy1850;
+	}
+yy1839:
+	++cursor_;
+	yyaccept = 5;
+	marker_ = cursor_;
+	yych = *cursor_;
+	if (yych <= 0x7F) {
+		goto yy1850;
+	} else {
+		if (yych <= 0xBF) goto yy1844;
+		goto yy1850;
+	}
+yy1840:
+	++cursor_;
+	yyaccept = 5;
+	marker_ = cursor_;
+	yych = *cursor_;
+	if (yych <= 0x7F) {
+		goto yy1850;
+	} else {
+		if (yych <= 0x8F) goto yy1844;
+		goto yy1850;
+	}
+yy1841:
+	++cursor_;
+	goto yy1850;
+yy1842:
+	++cursor_;
+	if (limit_ <= cursor_) FILL(1);
+	yych = *cursor_;
+	if (yych <= 0x7F) {
+		goto yyback_LINE_COMMENT;
+	} else {
+		if (yych <= 0xBF) goto yy1834;
+		goto yyback_LINE_COMMENT;
+	}
+yy1843:
+	++cursor_;
+	if (limit_ <= cursor_) FILL(1);
+	yych = *cursor_;
+	if (yych <= 0x9F) {
+		goto yyback_LINE_COMMENT;
+	} else {
+		if (yych <= 0xBF) goto yy1842;
+		goto yyback_LINE_COMMENT;
+	}
+yy1844:
+	++cursor_;
+	if (limit_ <= cursor_) FILL(1);
+	yych = *cursor_;
+	if (yych <= 0x7F) {
+		goto yyback_LINE_COMMENT;
+	} else {
+		if (yych <= 0xBF) goto yy1842;
+		goto yyback_LINE_COMMENT;
+	}
+yy1845:
+	++cursor_;
+	if (limit_ <= cursor_) FILL(1);
+	yych = *cursor_;
+	if (yych <= 0x8F) {
+		goto yyback_LINE_COMMENT;
+	} else {
+		if (yych <= 0xBF) goto yy1844;
+		goto yyback_LINE_COMMENT;
+	}
+yy1846:
+	++cursor_;
+	if (limit_ <= cursor_) FILL(1);
+	yych = *cursor_;
+	if (yych <= 0x7F) {
+		goto yyback_LINE_COMMENT;
+	} else {
+		if (yych <= 0xBF) goto yy1844;
+		goto yyback_LINE_COMMENT;
+	}
+yy1847:
+	++cursor_;
+	if (limit_ <= cursor_) FILL(1);
+	yych = *cursor_;
+	if (yych <= 0x7F) {
+		goto yyback_LINE_COMMENT;
+	} else {
+		if (yych <= 0x8F) goto yy1844;
+		goto yyback_LINE_COMMENT;
+	}
+yyback_LINE_COMMENT:
+	cursor_ = marker_;
+	switch (yyaccept) {
+	case 4:
+		goto yy1849;
+	default:
+		goto yy1850;
+	}
+yy1848:
+	BEGIN(YYCOND_i);
+#line 795 "src/wast-lexer.cc"
+	{ NEWLINE; continue; }
+#line 14555 "src/prebuilt/wast-lexer-gen.cc"
+yy1849:
+#line 796 "src/wast-lexer.cc"
+	{ continue; }
+#line 14559 "src/prebuilt/wast-lexer-gen.cc"
+yy1850:
+#line 811 "src/wast-lexer.cc"
+	{ MAYBE_MALFORMED_UTF8(""); }
+#line 14563 "src/prebuilt/wast-lexer-gen.cc"
+/* *********************************** */
+YYCOND_BLOCK_COMMENT:
+	if ((limit_ - cursor_) < 4) FILL(4);
+	yych = *cursor_;
+	if (yybm[0+yych] & 1) {
+		goto yy1855;
+	}
+	if (yych <= 0xDF) {
+		if (yych <= '(') {
+			if (yych <= '\n') goto yy1854;
+			goto yy1852;
+		} else {
+			if (yych <= ';') {
+				goto yy1853;
+			} else {
+				if (yych <= 0xC1) goto yy1862;
+				goto yy1856;
+			}
+		}
+	} else {
+		if (yych <= 0xF0) {
+			if (yych <= 0xE0) {
+				goto yy1857;
+			} else {
+				if (yych == 0xF0) goto yy1859;
+				goto yy1858;
+			}
+		} else {
+			if (yych <= 0xF3) {
+				goto yy1860;
+			} else {
+				if (yych == 0xF4) goto yy1861;
+				goto yy1862;
+			}
+		}
+	}
+yy1852:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == ';') goto yy1863;
+	goto yy1870;
+yy1853:
+	++cursor_;
+	yych = *cursor_;
+	if (yych == ')') goto yy1864;
+	goto yy1870;
+yy1854:
+	++cursor_;
+	goto yy1869;
+yy1855:
+	++cursor_;
+	goto yy1870;
+yy1856:
+	++cursor_;
+	yych = *cursor_;
+	if (yych <= 0x7F) {
+		goto yy1871;
+	} else {
+		if (yych <= 0xBF) goto yy1855;
+		goto yy1871;
+	}
+yy1857:
+	++cursor_;
+	yyaccept = 6;
+	marker_ = cursor_;
+	yych = *cursor_;
+	if (yych <= 0x9F) {
+		goto yy1871;
+	} else {
+		if (yych <= 0xBF) goto yy1865;
+		goto yy1871;
+	}
+yy1858:
+	++cursor_;
+	yyaccept = 6;
+	marker_ = cursor_;
+	yych = *cursor_;
+	if (yych <= 0x7F) {
+		goto yy1871;
+	} else {
+		if (yych <= 0xBF) goto yy1865;
+		goto yy1871;
+	}
+yy1859:
+	++cursor_;
+	yyaccept = 6;
+	marker_ = cursor_;
+	yych = *cursor_;
+	if (yych <= 0x8F) {
+		goto yy1871;
+	} else {
+		if (yych <= 0xBF) goto yy1866;
+		goto yy1871;
+	}
+yy1860:
+	++cursor_;
+	yyaccept = 6;
+	marker_ = cursor_;
+	yych = *cursor_;
+	if (yych <= 0x7F) {
+		goto yy1871;
+	} else {
+		if (yych <= 0xBF) goto yy1866;
+		goto yy1871;
+	}
+yy1861:
+	++cursor_;
+	yyaccept = 6;
+	marker_ = cursor_;
+	yych = *cursor_;
+	if (yych <= 0x7F) {
+		goto yy1871;
+	} else {
+		if (yych <= 0x8F) goto yy1866;
+		goto yy1871;
+	}
+yy1862:
+	++cursor_;
+	goto yy1871;
+yy1863:
+	++cursor_;
+	goto yy1867;
+yy1864:
+	++cursor_;
+	goto yy1868;
+yy1865:
+	++cursor_;
+	yych = *cursor_;
+	if (yych <= 0x7F) {
+		goto yyback_BLOCK_COMMENT;
+	} else {
+		if (yych <= 0xBF) goto yy1855;
+		goto yyback_BLOCK_COMMENT;
+	}
+yy1866:
+	++cursor_;
+	yych = *cursor_;
+	if (yych <= 0x7F) {
+		goto yyback_BLOCK_COMMENT;
+	} else {
+		if (yych <= 0xBF) goto yy1865;
+		goto yyback_BLOCK_COMMENT;
+	}
+yyback_BLOCK_COMMENT:
+	cursor_ = marker_;
+	goto yy1871;
+yy1867:
+#line 798 "src/wast-lexer.cc"
+	{ COMMENT_NESTING++; continue; }
+#line 14713 "src/prebuilt/wast-lexer-gen.cc"
+yy1868:
+#line 799 "src/wast-lexer.cc"
+	{ if (--COMMENT_NESTING == 0)
+                                    BEGIN(YYCOND_i);
+                                  continue; }
+#line 14719 "src/prebuilt/wast-lexer-gen.cc"
+yy1869:
+#line 802 "src/wast-lexer.cc"
+	{ NEWLINE; continue; }
+#line 14723 "src/prebuilt/wast-lexer-gen.cc"
+yy1870:
+#line 803 "src/wast-lexer.cc"
+	{ continue; }
+#line 14727 "src/prebuilt/wast-lexer-gen.cc"
+yy1871:
+#line 804 "src/wast-lexer.cc"
+	{ MAYBE_MALFORMED_UTF8(" in block comment"); }
+#line 14731 "src/prebuilt/wast-lexer-gen.cc"
+}
+#line 813 "src/wast-lexer.cc"
   }
 }
 
@@ -1,8 +1,9 @@
-/* A Bison parser, made by GNU Bison 3.0.4.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison implementation for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989-1990, 2000-2015 Free Software Foundation, Inc.
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
 
    This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
@@ -15,7 +16,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -33,6 +34,10 @@
 /* C LALR(1) parser skeleton written by Richard Stallman, by
    simplifying the original so-called "semantic" parser.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 /* All symbols defined below should begin with yy or YY, to avoid
    infringing on user name space.  This should be done even for local
    variables, as they might otherwise be expanded by user macros.
@@ -40,11 +45,11 @@
    define necessary library symbols; they are noted "INFRINGES ON
    USER NAME SPACE" below.  */
 
-/* Identify Bison output.  */
-#define YYBISON 1
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
 
-/* Bison version.  */
-#define YYBISON_VERSION "3.0.4"
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
 
 /* Skeleton name.  */
 #define YYSKELETON_NAME "yacc.c"
@@ -68,12 +73,12 @@
 #define yydebug         wabt_wast_parser_debug
 #define yynerrs         wabt_wast_parser_nerrs
 
-
-/* Copy the first part of user declarations.  */
-#line 17 "src/wast-parser.y" /* yacc.c:339  */
+/* First part of user prologue.  */
+#line 17 "src/wast-parser.y"
 
 #include <algorithm>
 #include <cassert>
+#include <cinttypes>
 #include <cstdarg>
 #include <cstdio>
 #include <cstdlib>
@@ -159,6 +164,14 @@
     }                                                                 \
  } while (0)
 
+#define CHECK_ALLOW_OPCODE(loc, opcode)                                     \
+  do {                                                                      \
+    if (!IsOpcodeAllowed(*parser->options, opcode)) {                       \
+      wast_parser_error(loc, lexer, parser, "opcode not allowed: %s",       \
+                        Opcode(opcode).GetName());                          \
+    }                                                                       \
+  } while (0)
+
 #define YYMALLOC(size) new char [size]
 #define YYFREE(p) delete [] (p)
 
@@ -175,6 +188,11 @@ static Result parse_const(Type type,
                           const char* s,
                           const char* end,
                           Const* out);
+static size_t get_simd_shape_lane_count(SimdShape shape);
+static Result parse_simd_lane(SimdShape shape,
+                              const Literal& lane,
+                              size_t index,
+                              v128* out);
 static size_t CopyStringContents(StringSlice* text, char* dest);
 static void DupTextList(TextList* text_list, std::vector<uint8_t>* out_data);
 
@@ -187,6 +205,9 @@ static void check_import_ordering(Location* loc,
                                   WastParser* parser,
                                   Module* module,
                                   const ModuleFieldList&);
+static void append_block_func_types(Location* loc,
+                                    Module* module,
+                                    const ExprList& exprs);
 static void append_module_fields(Module*, ModuleFieldList*);
 
 class BinaryErrorHandlerModule : public ErrorHandler {
@@ -210,189 +231,318 @@ class BinaryErrorHandlerModule : public ErrorHandler {
 #define wabt_wast_parser_error wast_parser_error
 
 
-#line 214 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:339  */
+#line 235 "src/prebuilt/wast-parser-gen.cc"
 
-# ifndef YY_NULLPTR
-#  if defined __cplusplus && 201103L <= __cplusplus
-#   define YY_NULLPTR nullptr
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
 #  else
-#   define YY_NULLPTR 0
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
 #  endif
 # endif
-
-/* Enabling verbose error messages.  */
-#ifdef YYERROR_VERBOSE
-# undef YYERROR_VERBOSE
-# define YYERROR_VERBOSE 1
-#else
-# define YYERROR_VERBOSE 1
-#endif
-
-/* In a future release of Bison, this section will be replaced
-   by #include "wast-parser-gen.hh".  */
-#ifndef YY_WABT_WAST_PARSER_SRC_PREBUILT_WAST_PARSER_GEN_HH_INCLUDED
-# define YY_WABT_WAST_PARSER_SRC_PREBUILT_WAST_PARSER_GEN_HH_INCLUDED
-/* Debug traces.  */
-#ifndef WABT_WAST_PARSER_DEBUG
-# if defined YYDEBUG
-#if YYDEBUG
-#   define WABT_WAST_PARSER_DEBUG 1
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
 #  else
-#   define WABT_WAST_PARSER_DEBUG 0
+#   define YY_NULLPTR ((void*)0)
 #  endif
-# else /* ! defined YYDEBUG */
-#  define WABT_WAST_PARSER_DEBUG 0
-# endif /* ! defined YYDEBUG */
-#endif  /* ! defined WABT_WAST_PARSER_DEBUG */
-#if WABT_WAST_PARSER_DEBUG
-extern int wabt_wast_parser_debug;
-#endif
-
-/* Token type.  */
-#ifndef WABT_WAST_PARSER_TOKENTYPE
-# define WABT_WAST_PARSER_TOKENTYPE
-  enum wabt_wast_parser_tokentype
-  {
-    WABT_TOKEN_TYPE_EOF = 0,
-    WABT_TOKEN_TYPE_LPAR = 258,
-    WABT_TOKEN_TYPE_RPAR = 259,
-    WABT_TOKEN_TYPE_NAT = 260,
-    WABT_TOKEN_TYPE_INT = 261,
-    WABT_TOKEN_TYPE_FLOAT = 262,
-    WABT_TOKEN_TYPE_TEXT = 263,
-    WABT_TOKEN_TYPE_VAR = 264,
-    WABT_TOKEN_TYPE_VALUE_TYPE = 265,
-    WABT_TOKEN_TYPE_ANYFUNC = 266,
-    WABT_TOKEN_TYPE_MUT = 267,
-    WABT_TOKEN_TYPE_NOP = 268,
-    WABT_TOKEN_TYPE_DROP = 269,
-    WABT_TOKEN_TYPE_BLOCK = 270,
-    WABT_TOKEN_TYPE_END = 271,
-    WABT_TOKEN_TYPE_IF = 272,
-    WABT_TOKEN_TYPE_THEN = 273,
-    WABT_TOKEN_TYPE_ELSE = 274,
-    WABT_TOKEN_TYPE_LOOP = 275,
-    WABT_TOKEN_TYPE_BR = 276,
-    WABT_TOKEN_TYPE_BR_IF = 277,
-    WABT_TOKEN_TYPE_BR_TABLE = 278,
-    WABT_TOKEN_TYPE_TRY = 279,
-    WABT_TOKEN_TYPE_CATCH = 280,
-    WABT_TOKEN_TYPE_CATCH_ALL = 281,
-    WABT_TOKEN_TYPE_THROW = 282,
-    WABT_TOKEN_TYPE_RETHROW = 283,
-    WABT_TOKEN_TYPE_LPAR_CATCH = 284,
-    WABT_TOKEN_TYPE_LPAR_CATCH_ALL = 285,
-    WABT_TOKEN_TYPE_CALL = 286,
-    WABT_TOKEN_TYPE_CALL_INDIRECT = 287,
-    WABT_TOKEN_TYPE_RETURN = 288,
-    WABT_TOKEN_TYPE_GET_LOCAL = 289,
-    WABT_TOKEN_TYPE_SET_LOCAL = 290,
-    WABT_TOKEN_TYPE_TEE_LOCAL = 291,
-    WABT_TOKEN_TYPE_GET_GLOBAL = 292,
-    WABT_TOKEN_TYPE_SET_GLOBAL = 293,
-    WABT_TOKEN_TYPE_LOAD = 294,
-    WABT_TOKEN_TYPE_STORE = 295,
-    WABT_TOKEN_TYPE_OFFSET_EQ_NAT = 296,
-    WABT_TOKEN_TYPE_ALIGN_EQ_NAT = 297,
-    WABT_TOKEN_TYPE_CONST = 298,
-    WABT_TOKEN_TYPE_UNARY = 299,
-    WABT_TOKEN_TYPE_BINARY = 300,
-    WABT_TOKEN_TYPE_COMPARE = 301,
-    WABT_TOKEN_TYPE_CONVERT = 302,
-    WABT_TOKEN_TYPE_SELECT = 303,
-    WABT_TOKEN_TYPE_UNREACHABLE = 304,
-    WABT_TOKEN_TYPE_CURRENT_MEMORY = 305,
-    WABT_TOKEN_TYPE_GROW_MEMORY = 306,
-    WABT_TOKEN_TYPE_FUNC = 307,
-    WABT_TOKEN_TYPE_START = 308,
-    WABT_TOKEN_TYPE_TYPE = 309,
-    WABT_TOKEN_TYPE_PARAM = 310,
-    WABT_TOKEN_TYPE_RESULT = 311,
-    WABT_TOKEN_TYPE_LOCAL = 312,
-    WABT_TOKEN_TYPE_GLOBAL = 313,
-    WABT_TOKEN_TYPE_TABLE = 314,
-    WABT_TOKEN_TYPE_ELEM = 315,
-    WABT_TOKEN_TYPE_MEMORY = 316,
-    WABT_TOKEN_TYPE_DATA = 317,
-    WABT_TOKEN_TYPE_OFFSET = 318,
-    WABT_TOKEN_TYPE_IMPORT = 319,
-    WABT_TOKEN_TYPE_EXPORT = 320,
-    WABT_TOKEN_TYPE_EXCEPT = 321,
-    WABT_TOKEN_TYPE_MODULE = 322,
-    WABT_TOKEN_TYPE_BIN = 323,
-    WABT_TOKEN_TYPE_QUOTE = 324,
-    WABT_TOKEN_TYPE_REGISTER = 325,
-    WABT_TOKEN_TYPE_INVOKE = 326,
-    WABT_TOKEN_TYPE_GET = 327,
-    WABT_TOKEN_TYPE_ASSERT_MALFORMED = 328,
-    WABT_TOKEN_TYPE_ASSERT_INVALID = 329,
-    WABT_TOKEN_TYPE_ASSERT_UNLINKABLE = 330,
-    WABT_TOKEN_TYPE_ASSERT_RETURN = 331,
-    WABT_TOKEN_TYPE_ASSERT_RETURN_CANONICAL_NAN = 332,
-    WABT_TOKEN_TYPE_ASSERT_RETURN_ARITHMETIC_NAN = 333,
-    WABT_TOKEN_TYPE_ASSERT_TRAP = 334,
-    WABT_TOKEN_TYPE_ASSERT_EXHAUSTION = 335,
-    WABT_TOKEN_TYPE_LOW = 336
-  };
-#endif
-
-/* Value type.  */
-#if ! defined WABT_WAST_PARSER_STYPE && ! defined WABT_WAST_PARSER_STYPE_IS_DECLARED
-typedef ::wabt::Token WABT_WAST_PARSER_STYPE;
-# define WABT_WAST_PARSER_STYPE_IS_TRIVIAL 1
-# define WABT_WAST_PARSER_STYPE_IS_DECLARED 1
-#endif
+# endif
 
-/* Location type.  */
-#if ! defined WABT_WAST_PARSER_LTYPE && ! defined WABT_WAST_PARSER_LTYPE_IS_DECLARED
-typedef struct WABT_WAST_PARSER_LTYPE WABT_WAST_PARSER_LTYPE;
-struct WABT_WAST_PARSER_LTYPE
+#include "wast-parser-gen.hh"
+/* Symbol kind.  */
+enum yysymbol_kind_t
 {
-  int first_line;
-  int first_column;
-  int last_line;
-  int last_column;
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "EOF"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_LPAR = 3,                       /* "("  */
+  YYSYMBOL_RPAR = 4,                       /* ")"  */
+  YYSYMBOL_NAT = 5,                        /* NAT  */
+  YYSYMBOL_INT = 6,                        /* INT  */
+  YYSYMBOL_FLOAT = 7,                      /* FLOAT  */
+  YYSYMBOL_TEXT = 8,                       /* TEXT  */
+  YYSYMBOL_VAR = 9,                        /* VAR  */
+  YYSYMBOL_VALUE_TYPE = 10,                /* VALUE_TYPE  */
+  YYSYMBOL_ANYFUNC = 11,                   /* ANYFUNC  */
+  YYSYMBOL_MUT = 12,                       /* MUT  */
+  YYSYMBOL_NOP = 13,                       /* NOP  */
+  YYSYMBOL_DROP = 14,                      /* DROP  */
+  YYSYMBOL_BLOCK = 15,                     /* BLOCK  */
+  YYSYMBOL_END = 16,                       /* END  */
+  YYSYMBOL_IF = 17,                        /* IF  */
+  YYSYMBOL_THEN = 18,                      /* THEN  */
+  YYSYMBOL_ELSE = 19,                      /* ELSE  */
+  YYSYMBOL_LOOP = 20,                      /* LOOP  */
+  YYSYMBOL_BR = 21,                        /* BR  */
+  YYSYMBOL_BR_IF = 22,                     /* BR_IF  */
+  YYSYMBOL_BR_TABLE = 23,                  /* BR_TABLE  */
+  YYSYMBOL_TRY = 24,                       /* TRY  */
+  YYSYMBOL_CATCH = 25,                     /* CATCH  */
+  YYSYMBOL_CATCH_ALL = 26,                 /* CATCH_ALL  */
+  YYSYMBOL_THROW = 27,                     /* THROW  */
+  YYSYMBOL_RETHROW = 28,                   /* RETHROW  */
+  YYSYMBOL_LPAR_CATCH = 29,                /* LPAR_CATCH  */
+  YYSYMBOL_LPAR_CATCH_ALL = 30,            /* LPAR_CATCH_ALL  */
+  YYSYMBOL_CALL = 31,                      /* CALL  */
+  YYSYMBOL_CALL_INDIRECT = 32,             /* CALL_INDIRECT  */
+  YYSYMBOL_RETURN = 33,                    /* RETURN  */
+  YYSYMBOL_RETURN_CALL = 34,               /* RETURN_CALL  */
+  YYSYMBOL_RETURN_CALL_INDIRECT = 35,      /* RETURN_CALL_INDIRECT  */
+  YYSYMBOL_GET_LOCAL = 36,                 /* GET_LOCAL  */
+  YYSYMBOL_SET_LOCAL = 37,                 /* SET_LOCAL  */
+  YYSYMBOL_TEE_LOCAL = 38,                 /* TEE_LOCAL  */
+  YYSYMBOL_GET_GLOBAL = 39,                /* GET_GLOBAL  */
+  YYSYMBOL_SET_GLOBAL = 40,                /* SET_GLOBAL  */
+  YYSYMBOL_LOAD = 41,                      /* LOAD  */
+  YYSYMBOL_STORE = 42,                     /* STORE  */
+  YYSYMBOL_OFFSET_EQ_NAT = 43,             /* OFFSET_EQ_NAT  */
+  YYSYMBOL_ALIGN_EQ_NAT = 44,              /* ALIGN_EQ_NAT  */
+  YYSYMBOL_ATOMIC_LOAD = 45,               /* ATOMIC_LOAD  */
+  YYSYMBOL_ATOMIC_STORE = 46,              /* ATOMIC_STORE  */
+  YYSYMBOL_ATOMIC_RMW = 47,                /* ATOMIC_RMW  */
+  YYSYMBOL_ATOMIC_RMW_CMPXCHG = 48,        /* ATOMIC_RMW_CMPXCHG  */
+  YYSYMBOL_ATOMIC_WAIT = 49,               /* ATOMIC_WAIT  */
+  YYSYMBOL_ATOMIC_NOTIFY = 50,             /* ATOMIC_NOTIFY  */
+  YYSYMBOL_CONST = 51,                     /* CONST  */
+  YYSYMBOL_UNARY = 52,                     /* UNARY  */
+  YYSYMBOL_BINARY = 53,                    /* BINARY  */
+  YYSYMBOL_COMPARE = 54,                   /* COMPARE  */
+  YYSYMBOL_CONVERT = 55,                   /* CONVERT  */
+  YYSYMBOL_SELECT = 56,                    /* SELECT  */
+  YYSYMBOL_UNREACHABLE = 57,               /* UNREACHABLE  */
+  YYSYMBOL_CURRENT_MEMORY = 58,            /* CURRENT_MEMORY  */
+  YYSYMBOL_GROW_MEMORY = 59,               /* GROW_MEMORY  */
+  YYSYMBOL_MEMORY_COPY = 60,               /* MEMORY_COPY  */
+  YYSYMBOL_MEMORY_FILL = 61,               /* MEMORY_FILL  */
+  YYSYMBOL_V128_CONST = 62,                /* V128_CONST  */
+  YYSYMBOL_SIMD_LANE_OP = 63,              /* SIMD_LANE_OP  */
+  YYSYMBOL_I8X16 = 64,                     /* I8X16  */
+  YYSYMBOL_I16X8 = 65,                     /* I16X8  */
+  YYSYMBOL_I32X4 = 66,                     /* I32X4  */
+  YYSYMBOL_I64X2 = 67,                     /* I64X2  */
+  YYSYMBOL_F32X4 = 68,                     /* F32X4  */
+  YYSYMBOL_F64X2 = 69,                     /* F64X2  */
+  YYSYMBOL_FUNC = 70,                      /* FUNC  */
+  YYSYMBOL_START = 71,                     /* START  */
+  YYSYMBOL_TYPE = 72,                      /* TYPE  */
+  YYSYMBOL_PARAM = 73,                     /* PARAM  */
+  YYSYMBOL_RESULT = 74,                    /* RESULT  */
+  YYSYMBOL_LOCAL = 75,                     /* LOCAL  */
+  YYSYMBOL_GLOBAL = 76,                    /* GLOBAL  */
+  YYSYMBOL_TABLE = 77,                     /* TABLE  */
+  YYSYMBOL_ELEM = 78,                      /* ELEM  */
+  YYSYMBOL_MEMORY = 79,                    /* MEMORY  */
+  YYSYMBOL_DATA = 80,                      /* DATA  */
+  YYSYMBOL_OFFSET = 81,                    /* OFFSET  */
+  YYSYMBOL_IMPORT = 82,                    /* IMPORT  */
+  YYSYMBOL_EXPORT = 83,                    /* EXPORT  */
+  YYSYMBOL_EXCEPT = 84,                    /* EXCEPT  */
+  YYSYMBOL_SHARED = 85,                    /* SHARED  */
+  YYSYMBOL_MODULE = 86,                    /* MODULE  */
+  YYSYMBOL_BIN = 87,                       /* BIN  */
+  YYSYMBOL_QUOTE = 88,                     /* QUOTE  */
+  YYSYMBOL_REGISTER = 89,                  /* REGISTER  */
+  YYSYMBOL_INVOKE = 90,                    /* INVOKE  */
+  YYSYMBOL_GET = 91,                       /* GET  */
+  YYSYMBOL_ASSERT_MALFORMED = 92,          /* ASSERT_MALFORMED  */
+  YYSYMBOL_ASSERT_INVALID = 93,            /* ASSERT_INVALID  */
+  YYSYMBOL_ASSERT_UNLINKABLE = 94,         /* ASSERT_UNLINKABLE  */
+  YYSYMBOL_ASSERT_RETURN = 95,             /* ASSERT_RETURN  */
+  YYSYMBOL_ASSERT_RETURN_CANONICAL_NAN = 96, /* ASSERT_RETURN_CANONICAL_NAN  */
+  YYSYMBOL_ASSERT_RETURN_ARITHMETIC_NAN = 97, /* ASSERT_RETURN_ARITHMETIC_NAN  */
+  YYSYMBOL_ASSERT_TRAP = 98,               /* ASSERT_TRAP  */
+  YYSYMBOL_ASSERT_EXHAUSTION = 99,         /* ASSERT_EXHAUSTION  */
+  YYSYMBOL_LOW = 100,                      /* LOW  */
+  YYSYMBOL_YYACCEPT = 101,                 /* $accept  */
+  YYSYMBOL_text_list = 102,                /* text_list  */
+  YYSYMBOL_text_list_opt = 103,            /* text_list_opt  */
+  YYSYMBOL_quoted_text = 104,              /* quoted_text  */
+  YYSYMBOL_value_type = 105,               /* value_type  */
+  YYSYMBOL_value_type_list = 106,          /* value_type_list  */
+  YYSYMBOL_elem_type = 107,                /* elem_type  */
+  YYSYMBOL_global_type = 108,              /* global_type  */
+  YYSYMBOL_func_type = 109,                /* func_type  */
+  YYSYMBOL_func_sig = 110,                 /* func_sig  */
+  YYSYMBOL_func_sig_result = 111,          /* func_sig_result  */
+  YYSYMBOL_table_sig = 112,                /* table_sig  */
+  YYSYMBOL_memory_sig = 113,               /* memory_sig  */
+  YYSYMBOL_limits = 114,                   /* limits  */
+  YYSYMBOL_type_use = 115,                 /* type_use  */
+  YYSYMBOL_nat = 116,                      /* nat  */
+  YYSYMBOL_literal = 117,                  /* literal  */
+  YYSYMBOL_simd_shape = 118,               /* simd_shape  */
+  YYSYMBOL_simd_lane_list = 119,           /* simd_lane_list  */
+  YYSYMBOL_var = 120,                      /* var  */
+  YYSYMBOL_var_list = 121,                 /* var_list  */
+  YYSYMBOL_bind_var_opt = 122,             /* bind_var_opt  */
+  YYSYMBOL_bind_var = 123,                 /* bind_var  */
+  YYSYMBOL_labeling_opt = 124,             /* labeling_opt  */
+  YYSYMBOL_offset_opt = 125,               /* offset_opt  */
+  YYSYMBOL_align_opt = 126,                /* align_opt  */
+  YYSYMBOL_instr = 127,                    /* instr  */
+  YYSYMBOL_plain_instr = 128,              /* plain_instr  */
+  YYSYMBOL_block_instr = 129,              /* block_instr  */
+  YYSYMBOL_block_sig = 130,                /* block_sig  */
+  YYSYMBOL_block = 131,                    /* block  */
+  YYSYMBOL_plain_catch = 132,              /* plain_catch  */
+  YYSYMBOL_plain_catch_all = 133,          /* plain_catch_all  */
+  YYSYMBOL_catch_instr = 134,              /* catch_instr  */
+  YYSYMBOL_catch_instr_list = 135,         /* catch_instr_list  */
+  YYSYMBOL_expr = 136,                     /* expr  */
+  YYSYMBOL_expr1 = 137,                    /* expr1  */
+  YYSYMBOL_try_ = 138,                     /* try_  */
+  YYSYMBOL_catch_sexp = 139,               /* catch_sexp  */
+  YYSYMBOL_catch_sexp_list = 140,          /* catch_sexp_list  */
+  YYSYMBOL_if_block = 141,                 /* if_block  */
+  YYSYMBOL_if_ = 142,                      /* if_  */
+  YYSYMBOL_rethrow_check = 143,            /* rethrow_check  */
+  YYSYMBOL_throw_check = 144,              /* throw_check  */
+  YYSYMBOL_try_check = 145,                /* try_check  */
+  YYSYMBOL_instr_list = 146,               /* instr_list  */
+  YYSYMBOL_expr_list = 147,                /* expr_list  */
+  YYSYMBOL_const_expr = 148,               /* const_expr  */
+  YYSYMBOL_exception = 149,                /* exception  */
+  YYSYMBOL_exception_field = 150,          /* exception_field  */
+  YYSYMBOL_func = 151,                     /* func  */
+  YYSYMBOL_func_fields = 152,              /* func_fields  */
+  YYSYMBOL_func_fields_import = 153,       /* func_fields_import  */
+  YYSYMBOL_func_fields_import1 = 154,      /* func_fields_import1  */
+  YYSYMBOL_func_fields_import_result = 155, /* func_fields_import_result  */
+  YYSYMBOL_func_fields_body = 156,         /* func_fields_body  */
+  YYSYMBOL_func_fields_body1 = 157,        /* func_fields_body1  */
+  YYSYMBOL_func_result_body = 158,         /* func_result_body  */
+  YYSYMBOL_func_body = 159,                /* func_body  */
+  YYSYMBOL_func_body1 = 160,               /* func_body1  */
+  YYSYMBOL_offset = 161,                   /* offset  */
+  YYSYMBOL_elem = 162,                     /* elem  */
+  YYSYMBOL_table = 163,                    /* table  */
+  YYSYMBOL_table_fields = 164,             /* table_fields  */
+  YYSYMBOL_data = 165,                     /* data  */
+  YYSYMBOL_memory = 166,                   /* memory  */
+  YYSYMBOL_memory_fields = 167,            /* memory_fields  */
+  YYSYMBOL_global = 168,                   /* global  */
+  YYSYMBOL_global_fields = 169,            /* global_fields  */
+  YYSYMBOL_import_desc = 170,              /* import_desc  */
+  YYSYMBOL_import = 171,                   /* import  */
+  YYSYMBOL_inline_import = 172,            /* inline_import  */
+  YYSYMBOL_export_desc = 173,              /* export_desc  */
+  YYSYMBOL_export = 174,                   /* export  */
+  YYSYMBOL_inline_export = 175,            /* inline_export  */
+  YYSYMBOL_type_def = 176,                 /* type_def  */
+  YYSYMBOL_start = 177,                    /* start  */
+  YYSYMBOL_module_field = 178,             /* module_field  */
+  YYSYMBOL_module_fields_opt = 179,        /* module_fields_opt  */
+  YYSYMBOL_module_fields = 180,            /* module_fields  */
+  YYSYMBOL_module = 181,                   /* module  */
+  YYSYMBOL_inline_module = 182,            /* inline_module  */
+  YYSYMBOL_script_var_opt = 183,           /* script_var_opt  */
+  YYSYMBOL_script_module = 184,            /* script_module  */
+  YYSYMBOL_action = 185,                   /* action  */
+  YYSYMBOL_assertion = 186,                /* assertion  */
+  YYSYMBOL_cmd = 187,                      /* cmd  */
+  YYSYMBOL_cmd_list = 188,                 /* cmd_list  */
+  YYSYMBOL_const = 189,                    /* const  */
+  YYSYMBOL_const_list = 190,               /* const_list  */
+  YYSYMBOL_script = 191,                   /* script  */
+  YYSYMBOL_script_start = 192              /* script_start  */
 };
-# define WABT_WAST_PARSER_LTYPE_IS_DECLARED 1
-# define WABT_WAST_PARSER_LTYPE_IS_TRIVIAL 1
-#endif
-
-
+typedef enum yysymbol_kind_t yysymbol_kind_t;
 
-int wabt_wast_parser_parse (::wabt::WastLexer* lexer, ::wabt::WastParser* parser);
 
-#endif /* !YY_WABT_WAST_PARSER_SRC_PREBUILT_WAST_PARSER_GEN_HH_INCLUDED  */
 
-/* Copy the second part of user declarations.  */
-
-#line 369 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:358  */
 
 #ifdef short
 # undef short
 #endif
 
-#ifdef YYTYPE_UINT8
-typedef YYTYPE_UINT8 yytype_uint8;
-#else
-typedef unsigned char yytype_uint8;
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
 #endif
 
-#ifdef YYTYPE_INT8
-typedef YYTYPE_INT8 yytype_int8;
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
 #else
 typedef signed char yytype_int8;
 #endif
 
-#ifdef YYTYPE_UINT16
-typedef YYTYPE_UINT16 yytype_uint16;
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
+#else
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
 #else
-typedef unsigned short int yytype_uint16;
+typedef short yytype_uint8;
 #endif
 
-#ifdef YYTYPE_INT16
-typedef YYTYPE_INT16 yytype_int16;
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
 #else
-typedef short int yytype_int16;
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
 #endif
 
 #ifndef YYSIZE_T
@@ -400,15 +550,28 @@ typedef short int yytype_int16;
 #  define YYSIZE_T __SIZE_TYPE__
 # elif defined size_t
 #  define YYSIZE_T size_t
-# elif ! defined YYSIZE_T
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
 #  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
 #  define YYSIZE_T size_t
 # else
-#  define YYSIZE_T unsigned int
+#  define YYSIZE_T unsigned
 # endif
 #endif
 
-#define YYSIZE_MAXIMUM ((YYSIZE_T) -1)
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
 
 #ifndef YY_
 # if defined YYENABLE_NLS && YYENABLE_NLS
@@ -422,47 +585,43 @@ typedef short int yytype_int16;
 # endif
 #endif
 
-#ifndef YY_ATTRIBUTE
-# if (defined __GNUC__                                               \
-      && (2 < __GNUC__ || (__GNUC__ == 2 && 96 <= __GNUC_MINOR__)))  \
-     || defined __SUNPRO_C && 0x5110 <= __SUNPRO_C
-#  define YY_ATTRIBUTE(Spec) __attribute__(Spec)
-# else
-#  define YY_ATTRIBUTE(Spec) /* empty */
-# endif
-#endif
 
 #ifndef YY_ATTRIBUTE_PURE
-# define YY_ATTRIBUTE_PURE   YY_ATTRIBUTE ((__pure__))
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
 #endif
 
 #ifndef YY_ATTRIBUTE_UNUSED
-# define YY_ATTRIBUTE_UNUSED YY_ATTRIBUTE ((__unused__))
-#endif
-
-#if !defined _Noreturn \
-     && (!defined __STDC_VERSION__ || __STDC_VERSION__ < 201112)
-# if defined _MSC_VER && 1200 <= _MSC_VER
-#  define _Noreturn __declspec (noreturn)
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
 # else
-#  define _Noreturn YY_ATTRIBUTE ((__noreturn__))
+#  define YY_ATTRIBUTE_UNUSED
 # endif
 #endif
 
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(E) ((void) (E))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(E) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-#if defined __GNUC__ && 407 <= __GNUC__ * 100 + __GNUC_MINOR__
 /* Suppress an incorrect diagnostic about yylval being uninitialized.  */
-# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN \
-    _Pragma ("GCC diagnostic push") \
-    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")\
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
     _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
-# define YY_IGNORE_MAYBE_UNINITIALIZED_END \
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
     _Pragma ("GCC diagnostic pop")
 #else
 # define YY_INITIAL_VALUE(Value) Value
@@ -475,8 +634,22 @@ typedef short int yytype_int16;
 # define YY_INITIAL_VALUE(Value) /* Nothing. */
 #endif
 
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
 
-#if ! defined yyoverflow || YYERROR_VERBOSE
+#if 1
 
 /* The parser invokes alloca or malloc; define the necessary symbols.  */
 
@@ -541,8 +714,7 @@ void free (void *); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 # endif
-#endif /* ! defined yyoverflow || YYERROR_VERBOSE */
-
+#endif /* 1 */
 
 #if (! defined yyoverflow \
      && (! defined __cplusplus \
@@ -552,18 +724,19 @@ void free (void *); /* INFRINGES ON USER NAME SPACE */
 /* A type that is properly aligned for any stack member.  */
 union yyalloc
 {
-  yytype_int16 yyss_alloc;
+  yy_state_t yyss_alloc;
   YYSTYPE yyvs_alloc;
   YYLTYPE yyls_alloc;
 };
 
 /* The size of the maximum gap between one aligned stack and the next.  */
-# define YYSTACK_GAP_MAXIMUM (sizeof (union yyalloc) - 1)
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
 
 /* The size of an array large to enough to hold all stacks, each with
    N elements.  */
 # define YYSTACK_BYTES(N) \
-     ((N) * (sizeof (yytype_int16) + sizeof (YYSTYPE) + sizeof (YYLTYPE)) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE) \
+             + YYSIZEOF (YYLTYPE)) \
       + 2 * YYSTACK_GAP_MAXIMUM)
 
 # define YYCOPY_NEEDED 1
@@ -576,11 +749,11 @@ union yyalloc
 # define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
     do                                                                  \
       {                                                                 \
-        YYSIZE_T yynewbytes;                                            \
+        YYPTRDIFF_T yynewbytes;                                         \
         YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
         Stack = &yyptr->Stack_alloc;                                    \
-        yynewbytes = yystacksize * sizeof (*Stack) + YYSTACK_GAP_MAXIMUM; \
-        yyptr += yynewbytes / sizeof (*yyptr);                          \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
       }                                                                 \
     while (0)
 
@@ -592,12 +765,12 @@ union yyalloc
 # ifndef YYCOPY
 #  if defined __GNUC__ && 1 < __GNUC__
 #   define YYCOPY(Dst, Src, Count) \
-      __builtin_memcpy (Dst, Src, (Count) * sizeof (*(Src)))
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
 #  else
 #   define YYCOPY(Dst, Src, Count)              \
       do                                        \
         {                                       \
-          YYSIZE_T yyi;                         \
+          YYPTRDIFF_T yyi;                      \
           for (yyi = 0; yyi < (Count); yyi++)   \
             (Dst)[yyi] = (Src)[yyi];            \
         }                                       \
@@ -609,28 +782,31 @@ union yyalloc
 /* YYFINAL -- State number of the termination state.  */
 #define YYFINAL  52
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   1028
+#define YYLAST   1307
 
 /* YYNTOKENS -- Number of terminals.  */
-#define YYNTOKENS  82
+#define YYNTOKENS  101
 /* YYNNTS -- Number of nonterminals.  */
-#define YYNNTS  89
+#define YYNNTS  92
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  218
+#define YYNRULES  240
 /* YYNSTATES -- Number of states.  */
-#define YYNSTATES  481
+#define YYNSTATES  519
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   355
 
-/* YYTRANSLATE[YYX] -- Symbol number corresponding to YYX as returned
-   by yylex, with out-of-bounds checking.  */
-#define YYUNDEFTOK  2
-#define YYMAXUTOK   336
 
-#define YYTRANSLATE(YYX)                                                \
-  ((unsigned int) (YYX) <= YYMAXUTOK ? yytranslate[YYX] : YYUNDEFTOK)
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
 
 /* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
-   as returned by yylex, without out-of-bounds checking.  */
-static const yytype_uint8 yytranslate[] =
+   as returned by yylex.  */
+static const yytype_int8 yytranslate[] =
 {
        0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -665,605 +841,683 @@ static const yytype_uint8 yytranslate[] =
       45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
       55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
       65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
-      75,    76,    77,    78,    79,    80,    81
+      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
+      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
+      95,    96,    97,    98,    99,   100
 };
 
 #if WABT_WAST_PARSER_DEBUG
-  /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
-static const yytype_uint16 yyrline[] =
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
 {
-       0,   265,   265,   271,   281,   282,   286,   297,   298,   304,
-     307,   312,   320,   324,   325,   330,   339,   340,   348,   354,
-     360,   365,   372,   378,   389,   393,   397,   404,   407,   412,
-     413,   420,   421,   424,   428,   429,   433,   434,   450,   451,
-     466,   470,   474,   478,   481,   484,   487,   490,   494,   498,
-     502,   505,   509,   513,   517,   521,   525,   529,   533,   536,
-     539,   551,   554,   557,   560,   563,   566,   569,   573,   580,
-     587,   594,   601,   610,   620,   623,   628,   635,   643,   651,
-     652,   656,   661,   668,   672,   677,   684,   691,   697,   707,
-     713,   723,   726,   732,   737,   745,   752,   755,   762,   768,
-     776,   783,   791,   801,   806,   812,   818,   819,   826,   827,
-     834,   839,   846,   853,   868,   875,   878,   887,   893,   902,
-     909,   910,   916,   926,   927,   936,   943,   944,   950,   960,
-     961,   970,   977,   982,   987,   998,  1001,  1005,  1015,  1027,
-    1042,  1045,  1051,  1057,  1077,  1087,  1099,  1114,  1117,  1123,
-    1129,  1152,  1167,  1173,  1179,  1190,  1200,  1209,  1216,  1223,
-    1230,  1238,  1249,  1259,  1265,  1271,  1277,  1283,  1291,  1300,
-    1311,  1317,  1328,  1335,  1336,  1337,  1338,  1339,  1340,  1341,
-    1342,  1343,  1344,  1345,  1349,  1350,  1354,  1360,  1369,  1389,
-    1396,  1399,  1405,  1423,  1431,  1442,  1454,  1466,  1470,  1474,
-    1478,  1482,  1485,  1488,  1491,  1495,  1502,  1505,  1506,  1509,
-    1518,  1522,  1529,  1541,  1542,  1549,  1552,  1615,  1624
+       0,   291,   291,   297,   307,   308,   312,   323,   332,   333,
+     339,   342,   347,   355,   359,   360,   365,   374,   375,   383,
+     389,   395,   401,   407,   417,   423,   434,   438,   442,   449,
+     450,   451,   452,   453,   454,   457,   458,   465,   468,   473,
+     474,   481,   482,   485,   489,   490,   494,   495,   511,   512,
+     527,   531,   535,   539,   542,   545,   548,   551,   555,   559,
+     563,   566,   570,   574,   579,   584,   588,   592,   596,   600,
+     604,   608,   612,   616,   620,   624,   628,   632,   636,   648,
+     670,   678,   682,   686,   690,   694,   697,   700,   704,   708,
+     712,   719,   726,   733,   740,   749,   759,   762,   767,   774,
+     782,   790,   791,   795,   800,   807,   811,   816,   823,   830,
+     836,   846,   852,   862,   865,   871,   876,   884,   891,   894,
+     901,   907,   915,   922,   930,   940,   945,   951,   957,   958,
+     965,   966,   973,   978,   985,   992,  1007,  1014,  1017,  1026,
+    1032,  1041,  1048,  1049,  1055,  1065,  1066,  1075,  1082,  1083,
+    1089,  1099,  1100,  1109,  1116,  1121,  1126,  1137,  1140,  1144,
+    1154,  1166,  1181,  1184,  1190,  1196,  1216,  1226,  1238,  1253,
+    1256,  1262,  1268,  1291,  1306,  1312,  1318,  1329,  1339,  1348,
+    1355,  1362,  1369,  1377,  1388,  1398,  1404,  1410,  1416,  1422,
+    1430,  1439,  1450,  1456,  1467,  1474,  1475,  1476,  1477,  1478,
+    1479,  1480,  1481,  1482,  1483,  1484,  1488,  1489,  1493,  1499,
+    1508,  1538,  1545,  1548,  1554,  1572,  1580,  1591,  1603,  1615,
+    1619,  1623,  1627,  1631,  1634,  1637,  1640,  1644,  1651,  1654,
+    1655,  1658,  1667,  1671,  1678,  1690,  1691,  1698,  1701,  1764,
+    1773
 };
 #endif
 
-#if WABT_WAST_PARSER_DEBUG || YYERROR_VERBOSE || 1
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if 1
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
 /* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
    First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
 static const char *const yytname[] =
 {
-  "\"EOF\"", "error", "$undefined", "\"(\"", "\")\"", "NAT", "INT",
+  "\"EOF\"", "error", "\"invalid token\"", "\"(\"", "\")\"", "NAT", "INT",
   "FLOAT", "TEXT", "VAR", "VALUE_TYPE", "ANYFUNC", "MUT", "NOP", "DROP",
   "BLOCK", "END", "IF", "THEN", "ELSE", "LOOP", "BR", "BR_IF", "BR_TABLE",
   "TRY", "CATCH", "CATCH_ALL", "THROW", "RETHROW", "LPAR_CATCH",
-  "LPAR_CATCH_ALL", "CALL", "CALL_INDIRECT", "RETURN", "GET_LOCAL",
-  "SET_LOCAL", "TEE_LOCAL", "GET_GLOBAL", "SET_GLOBAL", "LOAD", "STORE",
-  "OFFSET_EQ_NAT", "ALIGN_EQ_NAT", "CONST", "UNARY", "BINARY", "COMPARE",
-  "CONVERT", "SELECT", "UNREACHABLE", "CURRENT_MEMORY", "GROW_MEMORY",
-  "FUNC", "START", "TYPE", "PARAM", "RESULT", "LOCAL", "GLOBAL", "TABLE",
-  "ELEM", "MEMORY", "DATA", "OFFSET", "IMPORT", "EXPORT", "EXCEPT",
-  "MODULE", "BIN", "QUOTE", "REGISTER", "INVOKE", "GET",
-  "ASSERT_MALFORMED", "ASSERT_INVALID", "ASSERT_UNLINKABLE",
-  "ASSERT_RETURN", "ASSERT_RETURN_CANONICAL_NAN",
+  "LPAR_CATCH_ALL", "CALL", "CALL_INDIRECT", "RETURN", "RETURN_CALL",
+  "RETURN_CALL_INDIRECT", "GET_LOCAL", "SET_LOCAL", "TEE_LOCAL",
+  "GET_GLOBAL", "SET_GLOBAL", "LOAD", "STORE", "OFFSET_EQ_NAT",
+  "ALIGN_EQ_NAT", "ATOMIC_LOAD", "ATOMIC_STORE", "ATOMIC_RMW",
+  "ATOMIC_RMW_CMPXCHG", "ATOMIC_WAIT", "ATOMIC_NOTIFY", "CONST", "UNARY",
+  "BINARY", "COMPARE", "CONVERT", "SELECT", "UNREACHABLE",
+  "CURRENT_MEMORY", "GROW_MEMORY", "MEMORY_COPY", "MEMORY_FILL",
+  "V128_CONST", "SIMD_LANE_OP", "I8X16", "I16X8", "I32X4", "I64X2",
+  "F32X4", "F64X2", "FUNC", "START", "TYPE", "PARAM", "RESULT", "LOCAL",
+  "GLOBAL", "TABLE", "ELEM", "MEMORY", "DATA", "OFFSET", "IMPORT",
+  "EXPORT", "EXCEPT", "SHARED", "MODULE", "BIN", "QUOTE", "REGISTER",
+  "INVOKE", "GET", "ASSERT_MALFORMED", "ASSERT_INVALID",
+  "ASSERT_UNLINKABLE", "ASSERT_RETURN", "ASSERT_RETURN_CANONICAL_NAN",
   "ASSERT_RETURN_ARITHMETIC_NAN", "ASSERT_TRAP", "ASSERT_EXHAUSTION",
   "LOW", "$accept", "text_list", "text_list_opt", "quoted_text",
-  "value_type_list", "elem_type", "global_type", "func_type", "func_sig",
-  "func_sig_result", "table_sig", "memory_sig", "limits", "type_use",
-  "nat", "literal", "var", "var_list", "bind_var_opt", "bind_var",
-  "labeling_opt", "offset_opt", "align_opt", "instr", "plain_instr",
-  "block_instr", "block_sig", "block", "plain_catch", "plain_catch_all",
-  "catch_instr", "catch_instr_list", "expr", "expr1", "try_", "catch_sexp",
-  "catch_sexp_list", "if_block", "if_", "rethrow_check", "throw_check",
-  "try_check", "instr_list", "expr_list", "const_expr", "exception",
-  "exception_field", "func", "func_fields", "func_fields_import",
-  "func_fields_import1", "func_fields_import_result", "func_fields_body",
-  "func_fields_body1", "func_result_body", "func_body", "func_body1",
-  "offset", "elem", "table", "table_fields", "data", "memory",
-  "memory_fields", "global", "global_fields", "import_desc", "import",
-  "inline_import", "export_desc", "export", "inline_export", "type_def",
-  "start", "module_field", "module_fields_opt", "module_fields", "module",
-  "inline_module", "script_var_opt", "script_module", "action",
-  "assertion", "cmd", "cmd_list", "const", "const_list", "script",
-  "script_start", YY_NULLPTR
+  "value_type", "value_type_list", "elem_type", "global_type", "func_type",
+  "func_sig", "func_sig_result", "table_sig", "memory_sig", "limits",
+  "type_use", "nat", "literal", "simd_shape", "simd_lane_list", "var",
+  "var_list", "bind_var_opt", "bind_var", "labeling_opt", "offset_opt",
+  "align_opt", "instr", "plain_instr", "block_instr", "block_sig", "block",
+  "plain_catch", "plain_catch_all", "catch_instr", "catch_instr_list",
+  "expr", "expr1", "try_", "catch_sexp", "catch_sexp_list", "if_block",
+  "if_", "rethrow_check", "throw_check", "try_check", "instr_list",
+  "expr_list", "const_expr", "exception", "exception_field", "func",
+  "func_fields", "func_fields_import", "func_fields_import1",
+  "func_fields_import_result", "func_fields_body", "func_fields_body1",
+  "func_result_body", "func_body", "func_body1", "offset", "elem", "table",
+  "table_fields", "data", "memory", "memory_fields", "global",
+  "global_fields", "import_desc", "import", "inline_import", "export_desc",
+  "export", "inline_export", "type_def", "start", "module_field",
+  "module_fields_opt", "module_fields", "module", "inline_module",
+  "script_var_opt", "script_module", "action", "assertion", "cmd",
+  "cmd_list", "const", "const_list", "script", "script_start", YY_NULLPTR
 };
-#endif
 
-# ifdef YYPRINT
-/* YYTOKNUM[NUM] -- (External) token number corresponding to the
-   (internal) symbol number NUM (which must be that of a token).  */
-static const yytype_uint16 yytoknum[] =
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
 {
-       0,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
-     285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
-     295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
-     305,   306,   307,   308,   309,   310,   311,   312,   313,   314,
-     315,   316,   317,   318,   319,   320,   321,   322,   323,   324,
-     325,   326,   327,   328,   329,   330,   331,   332,   333,   334,
-     335,   336
-};
-# endif
+  return yytname[yysymbol];
+}
+#endif
 
-#define YYPACT_NINF -400
+#define YYPACT_NINF (-415)
 
-#define yypact_value_is_default(Yystate) \
-  (!!((Yystate) == (-400)))
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
 
-#define YYTABLE_NINF -31
+#define YYTABLE_NINF (-41)
 
-#define yytable_value_is_error(Yytable_value) \
+#define yytable_value_is_error(Yyn) \
   0
 
-  /* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
-     STATE-NUM.  */
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
 static const yytype_int16 yypact[] =
 {
-      20,   948,  -400,  -400,  -400,  -400,  -400,  -400,  -400,  -400,
-    -400,  -400,  -400,  -400,  -400,    55,  -400,  -400,  -400,  -400,
-    -400,  -400,    77,  -400,   105,   106,   238,   129,   106,   106,
-     168,   106,   168,   141,   141,   106,   106,   141,   147,   147,
-     167,   167,   167,   193,   193,   193,   205,   193,   100,  -400,
-     240,  -400,  -400,  -400,   463,  -400,  -400,  -400,  -400,   211,
-     165,   220,   226,    34,   152,   412,   241,  -400,  -400,    50,
-     241,   253,  -400,   141,   246,  -400,    51,   147,  -400,   141,
-     141,   198,   141,   141,   141,   -40,  -400,   271,   278,   160,
-     141,   141,   141,   366,  -400,  -400,   106,   106,   106,   238,
-     238,  -400,  -400,  -400,  -400,   238,   238,  -400,   238,   238,
-     238,   238,   238,   249,   249,   282,  -400,  -400,  -400,  -400,
-    -400,  -400,  -400,  -400,   502,   541,  -400,  -400,  -400,   238,
-     238,   106,  -400,   290,  -400,  -400,  -400,  -400,  -400,   293,
-     463,  -400,   302,  -400,   304,    49,  -400,   541,   319,   121,
-      34,   103,  -400,   324,  -400,   320,   325,   328,   325,   152,
-     106,   106,   106,   541,   330,   331,   106,  -400,   233,   221,
-    -400,  -400,   332,   325,    50,   253,  -400,   335,   334,   336,
-     117,   340,   135,   253,   253,   344,    55,   345,  -400,   346,
-     347,   349,   353,   190,  -400,  -400,   354,   355,   359,   238,
-     106,  -400,   106,   141,   141,  -400,   580,   580,   580,  -400,
-    -400,   238,  -400,  -400,  -400,  -400,  -400,  -400,  -400,  -400,
-     298,   298,  -400,  -400,  -400,  -400,   697,  -400,   947,  -400,
-    -400,  -400,   580,  -400,   237,   367,  -400,  -400,  -400,  -400,
-     179,   368,  -400,  -400,   361,  -400,  -400,  -400,   362,  -400,
-    -400,   313,  -400,  -400,  -400,  -400,  -400,   580,   379,   580,
-     380,   330,  -400,  -400,   580,   236,  -400,  -400,   253,  -400,
-    -400,  -400,   381,  -400,  -400,   148,  -400,   387,   238,   238,
-     238,   238,   238,  -400,  -400,  -400,   119,   242,  -400,  -400,
-     255,  -400,  -400,  -400,  -400,   352,  -400,  -400,  -400,  -400,
-    -400,   388,   187,   386,   191,   200,   397,   141,   404,   868,
-     580,   402,  -400,    24,   403,   251,  -400,  -400,  -400,   276,
-     106,  -400,   266,  -400,   106,  -400,  -400,   420,  -400,  -400,
-     828,   379,   425,  -400,  -400,  -400,  -400,  -400,   580,  -400,
-     296,  -400,   433,  -400,   106,   106,   106,   106,  -400,   434,
-     437,   438,   449,   450,  -400,  -400,  -400,   282,  -400,   502,
-     460,   619,   658,   461,   464,  -400,  -400,  -400,   106,   106,
-     106,   106,   238,   541,  -400,  -400,  -400,   118,   201,   457,
-     208,   215,   459,   216,  -400,   248,   541,  -400,   908,   330,
-    -400,   467,   468,  -400,   296,  -400,   469,   121,   325,   325,
-    -400,  -400,  -400,  -400,  -400,   470,  -400,   502,   742,  -400,
-     787,  -400,   658,  -400,   218,  -400,  -400,   541,  -400,   541,
-    -400,   106,  -400,   367,   475,   478,   302,   484,   479,  -400,
-     485,   541,  -400,   448,   466,  -400,   244,   489,   500,   514,
-     516,   517,  -400,  -400,  -400,  -400,   511,  -400,  -400,  -400,
-     367,   472,  -400,  -400,   302,   476,  -400,   528,   539,   553,
-     555,  -400,  -400,  -400,  -400,  -400,   106,  -400,  -400,   547,
-     557,  -400,  -400,  -400,   541,   548,   566,   541,  -400,   567,
-    -400
+      15,  1208,  -415,  -415,  -415,  -415,  -415,  -415,  -415,  -415,
+    -415,  -415,  -415,  -415,  -415,    70,  -415,  -415,  -415,  -415,
+    -415,  -415,    81,  -415,    37,    93,   191,    66,    93,    93,
+     139,    93,   139,   100,   100,    93,    93,   100,   129,   129,
+     120,   120,   120,   138,   138,   138,   154,   138,   167,  -415,
+     226,  -415,  -415,  -415,   807,  -415,  -415,  -415,  -415,   150,
+      96,   165,   178,    38,    46,   464,   186,  -415,  -415,   207,
+     186,   209,  -415,   100,   212,  -415,    17,   129,  -415,   100,
+     100,   149,   100,   100,   100,   -31,  -415,   237,   244,    94,
+     100,   100,   100,   400,  -415,  -415,    93,    93,    93,   191,
+     191,  -415,  -415,  -415,  -415,   191,   191,  -415,   191,   191,
+     191,   191,   191,   191,   191,   181,   181,   181,   181,   181,
+     181,   181,   181,   288,  -415,  -415,  -415,  -415,  -415,  -415,
+    -415,  -415,  -415,  -415,   269,   262,   868,   929,  -415,  -415,
+    -415,   191,   191,    93,  -415,   267,  -415,  -415,  -415,  -415,
+    -415,   272,   807,  -415,   274,  -415,   275,    24,  -415,  -415,
+     929,   277,    62,    38,    33,  -415,   280,  -415,   293,   262,
+     282,   262,    46,    93,    93,    93,   929,   343,   335,    93,
+    -415,   222,   220,  -415,  -415,   354,   262,   207,   209,  -415,
+     355,   367,   370,    98,   371,   146,   209,   209,   373,    70,
+     378,  -415,   384,   385,   387,   389,   257,  -415,  -415,   391,
+     394,   396,   191,    93,  -415,    93,   100,   100,  -415,   990,
+     990,   990,  -415,  -415,   191,  -415,  -415,  -415,  -415,  -415,
+    -415,  -415,  -415,  -415,  -415,   229,   229,   229,   229,   229,
+     229,   229,   229,  -415,  -415,  -415,  -415,  -415,  -415,  -415,
+    -415,  -415,  -415,  -415,  -415,   515,  -415,  1214,  -415,  -415,
+    -415,   990,  -415,   270,   398,  -415,  -415,  -415,  -415,   233,
+     399,  -415,  -415,   364,  -415,  -415,  -415,   392,  -415,  -415,
+     328,  -415,   327,  -415,  -415,  -415,   990,   415,   990,   421,
+     343,  -415,  -415,   990,   259,  -415,  -415,   209,  -415,  -415,
+    -415,   422,  -415,  -415,   132,  -415,   425,   191,   191,   191,
+     191,   191,  -415,  -415,  -415,    79,   228,  -415,  -415,   295,
+    -415,  -415,  -415,  -415,   368,  -415,  -415,  -415,  -415,  -415,
+     426,   151,   364,   169,   184,   364,   100,   439,   745,   990,
+     428,  -415,   114,   448,   225,  -415,  -415,  -415,  -415,  -415,
+    -415,  -415,  -415,  -415,   288,   331,    93,  -415,   287,  -415,
+      93,  -415,  -415,   461,  -415,  -415,  -415,   690,   415,   463,
+    -415,  -415,  -415,  -415,  -415,   990,  -415,   336,  -415,   465,
+    -415,    93,    93,    93,    93,  -415,   466,   467,   472,   476,
+     485,  -415,  -415,  -415,   288,  -415,   868,   486,  1051,  1112,
+     489,   490,  -415,  -415,  -415,    93,    93,    93,    93,  -415,
+     191,   929,  -415,  -415,  -415,   111,   195,   364,   203,   210,
+     364,   215,  -415,   265,   929,  -415,  1163,   343,  -415,   504,
+     505,  -415,   336,  -415,   528,    62,   262,   262,  -415,  -415,
+    -415,  -415,  -415,   529,  -415,   868,   578,  -415,   634,  -415,
+    1112,  -415,   218,  -415,  -415,   929,  -415,   929,  -415,    93,
+    -415,   398,   530,   537,   274,   540,   538,  -415,   554,   929,
+    -415,   442,   533,  -415,   281,   575,   576,   577,   579,   580,
+    -415,  -415,  -415,  -415,   452,  -415,  -415,  -415,   398,   508,
+    -415,  -415,   274,   511,  -415,   583,   590,   592,   593,  -415,
+    -415,  -415,  -415,  -415,    93,  -415,  -415,   568,   600,  -415,
+    -415,  -415,   929,   585,   603,   929,  -415,   604,  -415
 };
 
-  /* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
-     Performed when YYTABLE does not specify something else to do.  Zero
-     means the default is an error.  */
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
 static const yytype_uint8 yydefact[] =
 {
-     215,     0,   112,   183,   177,   178,   175,   179,   176,   174,
-     181,   182,   173,   180,   186,   189,   208,   217,   188,   206,
-     207,   210,   216,   218,     0,    31,     0,     0,    31,    31,
-       0,    31,     0,     0,     0,    31,    31,     0,   190,   190,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   187,
-       0,   211,     1,    33,   106,    32,    23,    28,    27,     0,
-       0,     0,     0,     0,     0,     0,     0,   136,    29,     0,
-       0,     4,     6,     0,     0,     7,   184,   190,   191,     0,
-       0,     0,     0,     0,     0,     0,   213,     0,     0,     0,
-       0,     0,     0,     0,    44,    45,    34,    34,    34,     0,
-       0,    29,   105,   104,   103,     0,     0,    50,     0,     0,
-       0,     0,     0,    36,    36,     0,    61,    62,    63,    64,
-      46,    43,    65,    66,   106,   106,    40,    41,    42,     0,
-       0,    34,   132,     0,   115,   125,   126,   129,   131,   123,
-     106,   172,    16,   170,     0,     0,    10,   106,     0,     0,
-       0,     0,     9,     0,   140,     0,    20,     0,     0,     0,
-      34,    34,    34,   106,   108,     0,    34,    29,     0,     0,
-     147,    19,     0,     0,     0,     4,     2,     5,     0,     0,
-       0,     0,     0,     0,     0,     0,   185,     0,   213,     0,
-       0,     0,     0,     0,   202,   203,     0,     0,     0,     0,
-       7,     7,     7,     0,     0,    35,   106,   106,   106,    47,
-      48,     0,    51,    52,    53,    54,    55,    56,    57,    37,
-      38,    38,    24,    25,    26,    60,     0,   114,     0,   107,
-      68,    67,   106,   113,     0,   123,   117,   119,   120,   118,
-       0,     0,    13,   171,     0,   110,   152,   151,     0,   153,
-     154,     0,    18,    21,   139,   141,   142,   106,     0,   106,
-       0,   108,    84,    83,   106,     0,   138,    30,     4,   146,
-     148,   149,     0,     3,   145,     0,   160,     0,     0,     0,
-       0,     0,     0,   168,   111,     8,     0,     0,   192,   209,
-       0,   196,   197,   198,   199,     0,   201,   214,   200,   204,
-     205,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     106,     0,    76,     0,     0,    49,    39,    58,    59,     0,
-       7,     7,     0,   116,     7,     7,    12,     0,    29,    85,
-       0,     0,     0,    87,    96,    86,   135,   109,   106,    88,
-       0,   137,     0,   144,    31,    31,    31,    31,   161,     0,
-       0,     0,     0,     0,   193,   194,   195,     0,    22,   106,
-       0,   106,   106,     0,     0,   169,     7,    75,    34,    34,
-      34,    34,     0,   106,    79,    80,    81,     0,     0,     0,
-       0,     0,     0,     0,    11,     0,   106,    95,     0,   102,
-      89,     0,     0,    93,    90,   150,    16,     0,     0,     0,
-     163,   166,   164,   165,   167,     0,   127,   106,     0,   130,
-       0,   133,   106,   162,     0,    69,    71,   106,    70,   106,
-      78,    34,    82,   123,     0,   123,    16,     0,    16,   143,
-       0,   106,   101,     0,     0,    94,     0,     0,     0,     0,
-       0,     0,   212,   128,   134,    74,     0,    77,    73,   121,
-     123,     0,   124,    14,    16,     0,    17,    98,     0,     0,
-       0,   156,   155,   159,   157,   158,    34,   122,    15,     0,
-     100,    91,    92,    72,   106,     0,     0,   106,    97,     0,
-      99
+     237,     0,   134,   205,   199,   200,   197,   201,   198,   196,
+     203,   204,   195,   202,   208,   211,   230,   239,   210,   228,
+     229,   232,   238,   240,     0,    41,     0,     0,    41,    41,
+       0,    41,     0,     0,     0,    41,    41,     0,   212,   212,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   209,
+       0,   233,     1,    43,   128,    42,    25,    38,    37,     0,
+       0,     0,     0,     0,     0,     0,     0,   158,    39,     0,
+       0,     4,     6,     0,     0,     8,   206,   212,   213,     0,
+       0,     0,     0,     0,     0,     0,   235,     0,     0,     0,
+       0,     0,     0,     0,    54,    55,    44,    44,    44,     0,
+       0,    39,   127,   126,   125,     0,     0,    60,     0,     0,
+       0,     0,     0,     0,     0,    46,    46,    46,    46,    46,
+      46,    46,    46,     0,    81,    82,    83,    84,    56,    53,
+      85,    86,    87,    88,     0,     0,   128,   128,    50,    51,
+      52,     0,     0,    44,   154,     0,   137,   147,   148,   151,
+     153,   145,   128,   194,    17,   192,     0,     0,     7,    11,
+     128,     0,     0,     0,     0,    10,     0,   162,     0,    21,
+       0,     0,     0,    44,    44,    44,   128,   130,     0,    44,
+      39,     0,     0,   169,    20,     0,     0,     0,     4,     2,
+       5,     0,     0,     0,     0,     0,     0,     0,     0,   207,
+       0,   235,     0,     0,     0,     0,     0,   224,   225,     0,
+       0,     0,     0,     8,     8,     8,     0,     0,    45,   128,
+     128,   128,    57,    58,     0,    61,    62,    63,    64,    65,
+      66,    67,    68,    69,    47,    48,    48,    48,    48,    48,
+      48,    48,    48,    26,    27,    28,    78,    29,    30,    31,
+      32,    33,    34,    35,    80,     0,   136,     0,   129,    90,
+      89,   128,   135,     0,   145,   139,   141,   142,   140,     0,
+       0,    14,   193,     0,   132,   174,   173,     0,   175,   176,
+       0,    19,    22,   161,   163,   164,   128,     0,   128,     0,
+     130,   106,   105,   128,     0,   160,    40,     4,   168,   170,
+     171,     0,     3,   167,     0,   182,     0,     0,     0,     0,
+       0,     0,   190,   133,     9,     0,     0,   214,   231,     0,
+     218,   219,   220,   221,     0,   223,   236,   222,   226,   227,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   128,
+       0,    98,     0,     0,    59,    49,    70,    71,    72,    73,
+      74,    75,    76,    77,    79,     0,     8,     8,     0,   138,
+       8,     8,    13,     0,    39,    23,   107,     0,     0,     0,
+     109,   118,   108,   157,   131,   128,   110,     0,   159,     0,
+     166,    41,    41,    41,    41,   183,     0,     0,     0,     0,
+       0,   215,   216,   217,     0,    24,   128,     0,   128,   128,
+       0,     0,   191,     8,    97,    44,    44,    44,    44,    36,
+       0,   128,   101,   102,   103,     0,     0,     0,     0,     0,
+       0,     0,    12,     0,   128,   117,     0,   124,   111,     0,
+       0,   115,   112,   172,    17,     0,     0,     0,   185,   188,
+     186,   187,   189,     0,   149,   128,     0,   152,     0,   155,
+     128,   184,     0,    91,    93,   128,    92,   128,   100,    44,
+     104,   145,     0,   145,    17,     0,    17,   165,     0,   128,
+     123,     0,     0,   116,     0,     0,     0,     0,     0,     0,
+     234,   150,   156,    96,     0,    99,    95,   143,   145,     0,
+     146,    15,    17,     0,    18,   120,     0,     0,     0,   178,
+     177,   181,   179,   180,    44,   144,    16,     0,   122,   113,
+     114,    94,   128,     0,     0,   128,   119,     0,   121
 };
 
-  /* YYPGOTO[NTERM-NUM].  */
+/* YYPGOTO[NTERM-NUM].  */
 static const yytype_int16 yypgoto[] =
 {
-    -400,   145,  -159,    -1,  -174,   427,  -143,   534,  -381,   170,
-    -150,  -160,   -62,  -134,   -52,   252,   -12,   -92,    31,    21,
-     -97,   491,   378,  -400,   -54,  -400,  -190,  -131,   173,   176,
-     258,  -400,   -28,  -400,   283,   243,  -400,   307,  -400,  -400,
-    -400,   -46,  -122,   383,   482,   481,  -400,  -400,   508,   414,
-    -399,   259,   550,  -337,   315,  -400,  -341,    63,  -400,  -400,
-     518,  -400,  -400,   509,  -400,   537,  -400,  -400,   -34,  -400,
-    -400,    39,  -400,  -400,    -5,  -400,   612,  -400,  -400,    53,
-     144,   234,  -400,   677,  -400,  -400,   512,  -400,  -400
+    -415,   172,  -169,    80,   -50,  -170,   453,  -157,   560,  -411,
+     176,  -164,  -171,   -61,  -142,   -40,  -333,  -415,  -415,   -20,
+     -84,    -3,    27,   -97,   136,    90,  -415,   -62,  -415,  -223,
+    -121,   173,   171,   230,  -415,   -28,  -415,   271,   227,  -415,
+     292,  -415,  -415,  -415,   -54,  -110,   360,   487,   506,  -415,
+    -415,   512,   413,  -414,   236,   542,  -374,   302,  -415,  -383,
+      69,  -415,  -415,   534,  -415,  -415,   514,  -415,   539,  -415,
+    -415,   -29,  -415,  -415,    34,  -415,  -415,    -1,  -415,   639,
+    -415,  -415,    -9,    78,   305,  -415,   694,  -415,  -415,   518,
+    -415,  -415
 };
 
-  /* YYDEFGOTO[NTERM-NUM].  */
+/* YYDEFGOTO[NTERM-NUM].  */
 static const yytype_int16 yydefgoto[] =
 {
-      -1,   177,   178,    73,   182,   153,   147,    61,   241,   242,
-     154,   170,   155,   124,    58,   225,   267,   168,    54,   205,
-     206,   220,   317,   125,   126,   127,   310,   311,   374,   375,
-     376,   377,   128,   165,   339,   393,   394,   333,   334,   129,
-     130,   131,   132,   262,   246,     2,     3,     4,   133,   236,
-     237,   238,   134,   135,   136,   137,   138,    68,     5,     6,
-     157,     7,     8,   172,     9,   148,   277,    10,   139,   181,
-      11,   140,    12,    13,    14,   185,    15,    16,    17,    79,
-      18,    19,    20,    21,    22,   297,   193,    23,    24
+       0,   190,   191,    73,   314,   195,   166,   160,    61,   270,
+     271,   167,   183,   168,   136,    58,   246,   253,   354,   296,
+     181,    54,   218,   219,   235,   346,   137,   138,   139,   339,
+     340,   412,   413,   414,   415,   140,   178,   376,   431,   432,
+     370,   371,   141,   142,   143,   144,   291,   275,     2,     3,
+       4,   145,   265,   266,   267,   146,   147,   148,   149,   150,
+      68,     5,     6,   170,     7,     8,   185,     9,   161,   306,
+      10,   151,   194,    11,   152,    12,    13,    14,   198,    15,
+      16,    17,    79,    18,    19,    20,    21,    22,   326,   206,
+      23,    24
 };
 
-  /* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
-     positive, shift that token.  If negative, reduce the rule whose
-     number is the opposite.  If YYTABLE_NINF, syntax error.  */
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
 static const yytype_int16 yytable[] =
 {
-     207,   208,    67,   229,    67,   235,   249,   171,   255,   211,
-      49,   164,   156,   270,    59,   437,   272,   156,    66,   166,
-      70,   411,   406,     1,   449,   245,   302,   304,   305,   149,
-     158,    38,    39,    74,   232,   173,    77,   145,    67,   164,
-     369,   245,    67,   370,   146,   453,    55,   166,    62,    55,
-      55,   467,    55,   169,    48,    56,    55,    55,    48,    63,
-      64,   244,    69,   257,   258,   259,    75,    76,   331,   264,
-     443,   444,   179,   468,   338,   265,   313,   314,   188,   189,
-      50,   190,   191,   192,   312,   312,   312,   209,   210,   196,
-     197,   198,    80,   212,   213,    71,   214,   215,   216,   217,
-     218,   319,   150,   159,   253,    52,   156,   156,   174,   342,
-     312,   171,   171,   203,   204,    53,   149,   230,   231,   183,
-     184,   156,   156,   354,   248,   158,   329,   273,   335,   167,
-     187,   146,    60,   175,   421,   312,   261,   312,    53,   284,
-     173,   331,   340,   372,   373,   285,   378,   380,   338,    72,
-     381,   383,    25,    26,    27,   151,    78,    56,    28,    29,
-      30,    31,    32,   152,    33,    34,    35,   203,   204,   278,
-      81,    65,   164,    56,   164,   279,   280,    57,   281,   367,
-     166,    49,   166,   282,    82,    83,    84,   301,   312,   150,
-      90,   359,   414,   295,   296,   361,    85,   285,   159,   315,
-     344,   285,   307,   308,   362,   423,   345,   346,    89,   347,
-     285,   285,   425,   174,    35,   141,   340,   142,   285,   426,
-     428,   303,   445,   306,   143,   285,   285,    36,   285,    60,
-     332,    38,    39,   261,   324,   325,   385,   266,    56,   441,
-     341,    56,    57,    56,    65,    57,   355,    57,   440,   180,
-     273,   420,   429,    56,   439,   164,   -30,    57,   295,   356,
-     -30,   176,   438,   166,   430,    36,   349,   350,   351,   352,
-     353,   415,   416,   417,   418,   194,   164,    86,    87,    88,
-      91,    92,   195,   268,   166,   203,   204,   222,   223,   224,
-     219,   199,   320,   321,   233,   446,   234,   447,   199,   324,
-     325,   372,   373,   332,   389,   240,   364,    36,   243,   458,
-      37,    38,    39,    40,    41,    42,    43,    44,    45,    46,
-      47,   320,   321,   247,   448,   391,   392,   251,   286,   287,
-      56,   152,   254,   228,   164,   263,   269,   171,   274,   275,
-     316,   379,   166,   273,   283,   382,   156,   156,   288,   289,
-     291,   292,   476,   293,   164,   479,   164,   294,   298,   299,
-     419,   432,   166,   300,   166,    55,    55,    55,    55,   473,
-     322,   327,   326,   328,   244,   396,   397,   398,   399,    94,
-      95,   160,   330,   161,   336,   343,   162,    99,   100,   101,
-     102,   348,   358,   103,   104,   357,   360,   105,   106,   107,
-     108,   109,   110,   111,   112,   113,   114,   363,   365,   115,
-     116,   117,   118,   119,   120,   121,   122,   123,   368,   371,
-     199,   200,   201,   202,   384,    94,    95,   160,   388,   161,
-     203,   204,   162,    99,   100,   101,   102,   395,   400,   103,
-     104,   401,   402,   105,   106,   107,   108,   109,   110,   111,
-     112,   113,   114,   403,   404,   115,   116,   117,   118,   119,
-     120,   121,   122,   123,   407,   412,    93,   424,   413,   427,
-     433,   434,   436,   372,   442,   163,    94,    95,    96,   450,
-      97,   451,   455,    98,    99,   100,   101,   102,   454,   457,
-     103,   104,   373,   461,   105,   106,   107,   108,   109,   110,
-     111,   112,   113,   114,   462,   226,   115,   116,   117,   118,
-     119,   120,   121,   122,   123,    94,    95,    96,   463,    97,
-     464,   465,    98,    99,   100,   101,   102,   466,   321,   103,
-     104,   469,   325,   105,   106,   107,   108,   109,   110,   111,
-     112,   113,   114,   470,   228,   115,   116,   117,   118,   119,
-     120,   121,   122,   123,    94,    95,    96,   471,    97,   472,
-     475,    98,    99,   100,   101,   102,   474,   477,   103,   104,
-     478,   480,   105,   106,   107,   108,   109,   110,   111,   112,
-     113,   114,   252,   309,   115,   116,   117,   118,   119,   120,
-     121,   122,   123,    94,    95,    96,   144,    97,   456,   318,
-      98,    99,   100,   101,   102,   221,   459,   103,   104,   405,
-     460,   105,   106,   107,   108,   109,   110,   111,   112,   113,
-     114,   390,   408,   115,   116,   117,   118,   119,   120,   121,
-     122,   123,    94,    95,    96,   422,    97,   435,   387,    98,
-      99,   100,   101,   102,   337,   260,   103,   104,   239,   323,
-     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
-     276,   410,   115,   116,   117,   118,   119,   120,   121,   122,
-     123,    94,    95,    96,   227,    97,   409,   256,    98,    99,
-     100,   101,   102,   271,   452,   103,   104,   250,   186,   105,
-     106,   107,   108,   109,   110,   111,   112,   113,   114,    51,
-     290,   115,   116,   117,   118,   119,   120,   121,   122,   123,
-      94,    95,   160,     0,   161,     0,     0,   162,    99,   100,
-     101,   102,     0,     0,   103,   104,     0,     0,   105,   106,
-     107,   108,   109,   110,   111,   112,   113,   114,     0,     0,
-     115,   116,   117,   118,   119,   120,   121,   122,   123,     0,
-       0,     0,   200,   201,   202,    94,    95,   160,     0,   161,
-       0,     0,   162,    99,   100,   101,   102,     0,     0,   103,
-     104,     0,     0,   105,   106,   107,   108,   109,   110,   111,
-     112,   113,   114,     0,     0,   115,   116,   117,   118,   119,
-     120,   121,   122,   123,     0,     0,     0,     0,   201,   202,
-      94,    95,   160,     0,   161,     0,     0,   162,    99,   100,
+     220,   221,    67,   177,    67,   278,    59,   284,   184,   264,
+      66,   179,    70,   159,    49,   299,   449,   224,     1,   301,
+      48,   409,   444,   475,   169,    63,    64,   258,    69,   169,
+      80,   177,    75,    76,   162,   171,   273,    52,    67,   179,
+     186,   157,    67,   331,   333,   334,   261,   487,   158,   164,
+     274,    56,    55,   491,    62,    55,    55,   165,    55,    38,
+      39,   443,    55,    55,   368,   277,   274,   482,   200,    60,
+     375,   481,   158,    48,   505,    53,   286,   287,   288,   222,
+     223,   506,   293,   391,    50,   225,   226,   302,   227,   228,
+     229,   230,   231,   232,   233,   254,   294,   163,   172,   342,
+     343,    71,    53,   187,   196,   197,   216,   217,    72,   341,
+     341,   341,   159,   159,    74,   216,   217,    77,    82,    83,
+      84,   259,   260,    81,    90,   184,   184,   459,   379,   282,
+     406,   169,   169,   407,   162,   180,   410,   411,    78,   188,
+     355,    85,    65,   171,    56,   368,   169,   169,    57,   290,
+     313,   341,   375,   192,   153,   396,   158,    89,   186,   201,
+     202,   158,   203,   204,   205,   366,   154,   372,   307,   155,
+     209,   210,   211,   398,   308,   309,   341,   310,   341,   158,
+      36,    60,   311,   377,    38,    39,   416,   418,   399,    65,
+     419,   421,   330,   177,   158,   177,    56,   163,    49,   461,
+      57,   179,   381,   179,   344,   158,   172,   463,   382,   383,
+     182,   384,    56,   158,   464,   193,    35,   189,   404,   466,
+     158,   187,   483,   363,   234,   158,   295,    56,   158,   341,
+     -40,    57,   392,   452,   -40,    36,   302,    25,    26,    27,
+     332,   207,   335,    28,    29,    30,    31,    32,   208,    33,
+      34,    35,   236,   237,   238,   239,   240,   241,   242,   369,
+     324,   325,   290,   378,    56,   377,   479,    56,    57,   467,
+      56,   262,   478,   345,    57,   263,   177,   269,   477,   272,
+     423,   276,   397,   280,   179,   400,   283,   386,   387,   388,
+     389,   390,   476,   243,   244,   245,   336,   337,   324,   393,
+     297,   458,   216,   217,   165,   177,   360,   361,   453,   454,
+     455,   456,    36,   179,   468,    37,    38,    39,    40,    41,
+      42,    43,    44,    45,    46,    47,   347,   348,   349,   350,
+     351,   352,   353,   247,   248,   249,   250,   251,   252,   292,
+     369,   427,   212,   356,   357,   484,   257,   485,    86,    87,
+      88,    91,    92,   212,   360,   361,   410,   411,   298,   496,
+     356,   357,   486,   302,   177,   429,   430,   462,   315,   316,
+     465,   303,   179,   304,   158,   312,   184,   317,   434,   435,
+     436,   437,   318,   417,   177,   159,   177,   420,   320,   321,
+     457,   322,   179,   323,   179,   327,   169,   169,   328,   470,
+     329,   358,   514,   362,   273,   517,   364,   511,    55,    55,
+      55,    55,   365,    94,    95,   173,   401,   174,   367,   394,
+     175,    99,   100,   101,   102,   373,   380,   103,   104,   385,
+     395,   105,   106,   107,   108,   109,   110,   111,   112,   113,
+     114,   115,   116,   402,   405,   117,   118,   119,   120,   121,
+     122,   123,   124,   125,   126,   127,   128,   129,   130,   131,
+     132,   133,   134,   135,   408,   422,   426,   410,   504,   433,
+     438,   439,   212,   213,   214,   215,   440,    94,    95,   173,
+     441,   174,   216,   217,   175,    99,   100,   101,   102,   442,
+     445,   103,   104,   450,   451,   105,   106,   107,   108,   109,
+     110,   111,   112,   113,   114,   115,   116,   471,   472,   117,
+     118,   119,   120,   121,   122,   123,   124,   125,   126,   127,
+     128,   129,   130,   131,   132,   133,   134,   135,    94,    95,
+     173,   474,   174,   480,   488,   175,    99,   100,   101,   102,
+     489,   493,   103,   104,   492,   176,   105,   106,   107,   108,
+     109,   110,   111,   112,   113,   114,   115,   116,   495,   411,
+     117,   118,   119,   120,   121,   122,   123,   124,   125,   126,
+     127,   128,   129,   130,   131,   132,   133,   134,   135,   499,
+     500,   501,   357,   502,   503,   361,   507,   512,   213,   214,
+     215,    94,    95,   173,   508,   174,   509,   510,   175,    99,
+     100,   101,   102,   513,   515,   103,   104,   516,   518,   105,
+     106,   107,   108,   109,   110,   111,   112,   113,   114,   115,
+     116,   281,   156,   117,   118,   119,   120,   121,   122,   123,
+     124,   125,   126,   127,   128,   129,   130,   131,   132,   133,
+     134,   135,   494,   498,   497,   460,   428,    94,    95,   173,
+     374,   174,   214,   215,   175,    99,   100,   101,   102,   473,
+     425,   103,   104,   289,   268,   105,   106,   107,   108,   109,
+     110,   111,   112,   113,   114,   115,   116,   359,   256,   117,
+     118,   119,   120,   121,   122,   123,   124,   125,   126,   127,
+     128,   129,   130,   131,   132,   133,   134,   135,   305,   490,
+     447,   300,   279,    94,    95,   173,   285,   174,   424,   215,
+     175,    99,   100,   101,   102,   199,    51,   103,   104,   319,
+       0,   105,   106,   107,   108,   109,   110,   111,   112,   113,
+     114,   115,   116,     0,     0,   117,   118,   119,   120,   121,
+     122,   123,   124,   125,   126,   127,   128,   129,   130,   131,
+     132,   133,   134,   135,     0,     0,     0,     0,    94,    95,
+     173,     0,   174,     0,   403,   175,    99,   100,   101,   102,
+       0,     0,   103,   104,     0,     0,   105,   106,   107,   108,
+     109,   110,   111,   112,   113,   114,   115,   116,     0,     0,
+     117,   118,   119,   120,   121,   122,   123,   124,   125,   126,
+     127,   128,   129,   130,   131,   132,   133,   134,   135,     0,
+      93,     0,     0,     0,     0,     0,     0,     0,     0,   403,
+      94,    95,    96,     0,    97,     0,     0,    98,    99,   100,
      101,   102,     0,     0,   103,   104,     0,     0,   105,   106,
-     107,   108,   109,   110,   111,   112,   113,   114,     0,     0,
-     115,   116,   117,   118,   119,   120,   121,   122,   123,     0,
-       0,    94,    95,   160,   202,   161,   386,     0,   162,    99,
+     107,   108,   109,   110,   111,   112,   113,   114,   115,   116,
+       0,     0,   117,   118,   119,   120,   121,   122,   123,   124,
+     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
+     135,   255,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    94,    95,    96,     0,    97,     0,     0,    98,    99,
      100,   101,   102,     0,     0,   103,   104,     0,     0,   105,
-     106,   107,   108,   109,   110,   111,   112,   113,   114,     0,
-       0,   115,   116,   117,   118,   119,   120,   121,   122,   123,
-       0,    94,    95,   160,   366,   161,     0,     0,   162,    99,
-     100,   101,   102,     0,     0,   103,   104,     0,     0,   105,
-     106,   107,   108,   109,   110,   111,   112,   113,   114,     0,
-       0,   115,   116,   117,   118,   119,   120,   121,   122,   123,
-       0,    94,    95,   160,   366,   161,   431,     0,   162,    99,
-     100,   101,   102,     0,     0,   103,   104,     0,     0,   105,
-     106,   107,   108,   109,   110,   111,   112,   113,   114,     0,
-       0,   115,   116,   117,   118,   119,   120,   121,   122,   123,
-      94,    95,   160,     0,   161,     0,     0,   162,    99,   100,
-     101,   102,     0,     0,   103,   104,     0,     0,   105,   106,
-     107,   108,   109,   110,   111,   112,   113,   114,     0,     0,
-     115,   116,   117,   118,   119,   120,   121,   122,   123,     0,
-      25,    26,    27,     0,     0,     0,    28,    29,    30,    31,
-      32,     0,    33,    34,    35,    36,     0,     0,    37,    38,
-      39,    40,    41,    42,    43,    44,    45,    46,    47
+     106,   107,   108,   109,   110,   111,   112,   113,   114,   115,
+     116,     0,     0,   117,   118,   119,   120,   121,   122,   123,
+     124,   125,   126,   127,   128,   129,   130,   131,   132,   133,
+     134,   135,   257,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    94,    95,    96,     0,    97,     0,     0,    98,
+      99,   100,   101,   102,     0,     0,   103,   104,     0,     0,
+     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
+     115,   116,     0,     0,   117,   118,   119,   120,   121,   122,
+     123,   124,   125,   126,   127,   128,   129,   130,   131,   132,
+     133,   134,   135,   338,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    94,    95,    96,     0,    97,     0,     0,
+      98,    99,   100,   101,   102,     0,     0,   103,   104,     0,
+       0,   105,   106,   107,   108,   109,   110,   111,   112,   113,
+     114,   115,   116,     0,     0,   117,   118,   119,   120,   121,
+     122,   123,   124,   125,   126,   127,   128,   129,   130,   131,
+     132,   133,   134,   135,   446,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    94,    95,    96,     0,    97,     0,
+       0,    98,    99,   100,   101,   102,     0,     0,   103,   104,
+       0,     0,   105,   106,   107,   108,   109,   110,   111,   112,
+     113,   114,   115,   116,     0,     0,   117,   118,   119,   120,
+     121,   122,   123,   124,   125,   126,   127,   128,   129,   130,
+     131,   132,   133,   134,   135,   448,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    94,    95,    96,     0,    97,
+       0,     0,    98,    99,   100,   101,   102,     0,     0,   103,
+     104,     0,     0,   105,   106,   107,   108,   109,   110,   111,
+     112,   113,   114,   115,   116,     0,     0,   117,   118,   119,
+     120,   121,   122,   123,   124,   125,   126,   127,   128,   129,
+     130,   131,   132,   133,   134,   135,    94,    95,   173,     0,
+     174,   469,     0,   175,    99,   100,   101,   102,     0,     0,
+     103,   104,     0,     0,   105,   106,   107,   108,   109,   110,
+     111,   112,   113,   114,   115,   116,     0,     0,   117,   118,
+     119,   120,   121,   122,   123,   124,   125,   126,   127,   128,
+     129,   130,   131,   132,   133,   134,   135,    94,    95,   173,
+       0,   174,     0,     0,   175,    99,   100,   101,   102,     0,
+       0,   103,   104,     0,     0,   105,   106,   107,   108,   109,
+     110,   111,   112,   113,   114,   115,   116,     0,     0,   117,
+     118,   119,   120,   121,   122,   123,   124,   125,   126,   127,
+     128,   129,   130,   131,   132,   133,   134,   135,    25,    26,
+      27,     0,     0,     0,    28,    29,    30,    31,    32,     0,
+      33,    34,    35,     0,    36,     0,     0,    37,    38,    39,
+      40,    41,    42,    43,    44,    45,    46,    47
 };
 
 static const yytype_int16 yycheck[] =
 {
-      97,    98,    30,   125,    32,   139,   149,    69,   158,   101,
-      15,    65,    64,   173,    26,   396,   175,    69,    30,    65,
-      32,   362,   359,     3,   423,   147,   200,   201,   202,    63,
-      64,    71,    72,    34,   131,    69,    37,     3,    66,    93,
-      16,   163,    70,    19,    10,   426,    25,    93,    27,    28,
-      29,   450,    31,     3,     3,     5,    35,    36,     3,    28,
-      29,    12,    31,   160,   161,   162,    35,    36,   258,   166,
-     407,   412,    73,   454,   264,   167,   207,   208,    79,    80,
-       3,    82,    83,    84,   206,   207,   208,    99,   100,    90,
-      91,    92,    39,   105,   106,    32,   108,   109,   110,   111,
-     112,   232,    63,    64,   156,     0,   158,   159,    69,   268,
-     232,   173,   174,    64,    65,     9,   150,   129,   130,    68,
-      69,   173,   174,     4,     3,   159,   257,     8,   259,    66,
-      77,    10,     3,    70,    16,   257,   164,   259,     9,     4,
-     174,   331,   264,    25,    26,    10,   320,   321,   338,     8,
-     324,   325,    52,    53,    54,     3,     9,     5,    58,    59,
-      60,    61,    62,    11,    64,    65,    66,    64,    65,    52,
-       3,     3,   226,     5,   228,    58,    59,     9,    61,   310,
-     226,   186,   228,    66,    40,    41,    42,   199,   310,   150,
-      46,     4,   366,     3,     4,     4,     3,    10,   159,   211,
-      52,    10,   203,   204,     4,     4,    58,    59,     3,    61,
-      10,    10,     4,   174,    66,     4,   338,    52,    10,     4,
-       4,   200,     4,   202,     4,    10,    10,    67,    10,     3,
-     258,    71,    72,   261,    55,    56,   328,     4,     5,   399,
-       4,     5,     9,     5,     3,     9,     4,     9,   398,     3,
-       8,   373,     4,     5,   397,   309,     5,     9,     3,     4,
-       9,     8,   396,   309,   386,    67,   278,   279,   280,   281,
-     282,   368,   369,   370,   371,     4,   330,    43,    44,    45,
-      46,    47,     4,    62,   330,    64,    65,     5,     6,     7,
-      41,    54,    55,    56,     4,   417,     3,   419,    54,    55,
-      56,    25,    26,   331,   332,     3,   307,    67,     4,   431,
-      70,    71,    72,    73,    74,    75,    76,    77,    78,    79,
-      80,    55,    56,     4,   421,    29,    30,     3,   183,   184,
-       5,    11,     4,     3,   388,     4,     4,   399,     4,     3,
-      42,   320,   388,     8,     4,   324,   398,   399,     4,     4,
-       4,     4,   474,     4,   408,   477,   410,     4,     4,     4,
-     372,   389,   408,     4,   410,   344,   345,   346,   347,   466,
-       3,    10,     4,    60,    12,   344,   345,   346,   347,    13,
-      14,    15,     3,    17,     4,     4,    20,    21,    22,    23,
-      24,     4,     4,    27,    28,    43,    10,    31,    32,    33,
-      34,    35,    36,    37,    38,    39,    40,    10,     4,    43,
-      44,    45,    46,    47,    48,    49,    50,    51,    16,    16,
-      54,    55,    56,    57,     4,    13,    14,    15,     3,    17,
-      64,    65,    20,    21,    22,    23,    24,     4,     4,    27,
-      28,     4,     4,    31,    32,    33,    34,    35,    36,    37,
-      38,    39,    40,     4,     4,    43,    44,    45,    46,    47,
-      48,    49,    50,    51,     4,     4,     3,    10,     4,    10,
-       3,     3,     3,    25,     4,    63,    13,    14,    15,     4,
-      17,     3,     3,    20,    21,    22,    23,    24,     4,     4,
-      27,    28,    26,     4,    31,    32,    33,    34,    35,    36,
-      37,    38,    39,    40,     4,     3,    43,    44,    45,    46,
-      47,    48,    49,    50,    51,    13,    14,    15,     4,    17,
-       4,     4,    20,    21,    22,    23,    24,    16,    56,    27,
-      28,     3,    56,    31,    32,    33,    34,    35,    36,    37,
-      38,    39,    40,     4,     3,    43,    44,    45,    46,    47,
-      48,    49,    50,    51,    13,    14,    15,     4,    17,     4,
-       3,    20,    21,    22,    23,    24,    19,    19,    27,    28,
-       4,     4,    31,    32,    33,    34,    35,    36,    37,    38,
-      39,    40,   155,     3,    43,    44,    45,    46,    47,    48,
-      49,    50,    51,    13,    14,    15,    62,    17,   428,   221,
-      20,    21,    22,    23,    24,   114,   433,    27,    28,   357,
-     434,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,   338,     3,    43,    44,    45,    46,    47,    48,    49,
-      50,    51,    13,    14,    15,   377,    17,   394,   331,    20,
-      21,    22,    23,    24,   261,   163,    27,    28,   140,   235,
-      31,    32,    33,    34,    35,    36,    37,    38,    39,    40,
-     179,     3,    43,    44,    45,    46,    47,    48,    49,    50,
-      51,    13,    14,    15,   124,    17,   361,   159,    20,    21,
-      22,    23,    24,   174,   425,    27,    28,   150,    76,    31,
-      32,    33,    34,    35,    36,    37,    38,    39,    40,    22,
-     188,    43,    44,    45,    46,    47,    48,    49,    50,    51,
+      97,    98,    30,    65,    32,   162,    26,   171,    69,   151,
+      30,    65,    32,    63,    15,   186,   399,   101,     3,   188,
+       3,   354,   396,   434,    64,    28,    29,   137,    31,    69,
+      39,    93,    35,    36,    63,    64,    12,     0,    66,    93,
+      69,     3,    70,   213,   214,   215,   143,   461,    10,     3,
+     160,     5,    25,   464,    27,    28,    29,    11,    31,    90,
+      91,   394,    35,    36,   287,     3,   176,   450,    77,     3,
+     293,   445,    10,     3,   488,     9,   173,   174,   175,    99,
+     100,   492,   179,     4,     3,   105,   106,     8,   108,   109,
+     110,   111,   112,   113,   114,   135,   180,    63,    64,   220,
+     221,    32,     9,    69,    87,    88,    82,    83,     8,   219,
+     220,   221,   162,   163,    34,    82,    83,    37,    40,    41,
+      42,   141,   142,     3,    46,   186,   187,    16,   297,   169,
+      16,   171,   172,    19,   163,    66,    25,    26,     9,    70,
+     261,     3,     3,   172,     5,   368,   186,   187,     9,   177,
+       4,   261,   375,    73,     4,     4,    10,     3,   187,    79,
+      80,    10,    82,    83,    84,   286,    70,   288,    70,     4,
+      90,    91,    92,     4,    76,    77,   286,    79,   288,    10,
+      86,     3,    84,   293,    90,    91,   356,   357,     4,     3,
+     360,   361,   212,   255,    10,   257,     5,   163,   199,     4,
+       9,   255,    70,   257,   224,    10,   172,     4,    76,    77,
+       3,    79,     5,    10,     4,     3,    84,     8,   339,     4,
+      10,   187,     4,   273,    43,    10,     4,     5,    10,   339,
+       5,     9,     4,   403,     9,    86,     8,    70,    71,    72,
+     213,     4,   215,    76,    77,    78,    79,    80,     4,    82,
+      83,    84,   116,   117,   118,   119,   120,   121,   122,   287,
+       3,     4,   290,     4,     5,   375,   437,     5,     9,     4,
+       5,     4,   436,    44,     9,     3,   338,     3,   435,     4,
+     364,     4,   332,     3,   338,   335,     4,   307,   308,   309,
+     310,   311,   434,     5,     6,     7,   216,   217,     3,     4,
+      80,   411,    82,    83,    11,   367,    73,    74,   405,   406,
+     407,   408,    86,   367,   424,    89,    90,    91,    92,    93,
+      94,    95,    96,    97,    98,    99,   236,   237,   238,   239,
+     240,   241,   242,    64,    65,    66,    67,    68,    69,     4,
+     368,   369,    72,    73,    74,   455,     3,   457,    43,    44,
+      45,    46,    47,    72,    73,    74,    25,    26,     4,   469,
+      73,    74,   459,     8,   426,    29,    30,   417,   196,   197,
+     420,     4,   426,     3,    10,     4,   437,     4,   381,   382,
+     383,   384,     4,   356,   446,   435,   448,   360,     4,     4,
+     410,     4,   446,     4,   448,     4,   436,   437,     4,   427,
+       4,     3,   512,     4,    12,   515,    78,   504,   381,   382,
+     383,   384,    85,    13,    14,    15,   336,    17,     3,    51,
+      20,    21,    22,    23,    24,     4,     4,    27,    28,     4,
+       4,    31,    32,    33,    34,    35,    36,    37,    38,    39,
+      40,    41,    42,     4,    16,    45,    46,    47,    48,    49,
+      50,    51,    52,    53,    54,    55,    56,    57,    58,    59,
+      60,    61,    62,    63,    16,     4,     3,    25,    16,     4,
+       4,     4,    72,    73,    74,    75,     4,    13,    14,    15,
+       4,    17,    82,    83,    20,    21,    22,    23,    24,     4,
+       4,    27,    28,     4,     4,    31,    32,    33,    34,    35,
+      36,    37,    38,    39,    40,    41,    42,     3,     3,    45,
+      46,    47,    48,    49,    50,    51,    52,    53,    54,    55,
+      56,    57,    58,    59,    60,    61,    62,    63,    13,    14,
+      15,     3,    17,     4,     4,    20,    21,    22,    23,    24,
+       3,     3,    27,    28,     4,    81,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,     4,    26,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,     4,
+       4,     4,    74,     4,     4,    74,     3,    19,    73,    74,
+      75,    13,    14,    15,     4,    17,     4,     4,    20,    21,
+      22,    23,    24,     3,    19,    27,    28,     4,     4,    31,
+      32,    33,    34,    35,    36,    37,    38,    39,    40,    41,
+      42,   168,    62,    45,    46,    47,    48,    49,    50,    51,
+      52,    53,    54,    55,    56,    57,    58,    59,    60,    61,
+      62,    63,   466,   472,   471,   415,   375,    13,    14,    15,
+     290,    17,    74,    75,    20,    21,    22,    23,    24,   432,
+     368,    27,    28,   176,   152,    31,    32,    33,    34,    35,
+      36,    37,    38,    39,    40,    41,    42,   264,   136,    45,
+      46,    47,    48,    49,    50,    51,    52,    53,    54,    55,
+      56,    57,    58,    59,    60,    61,    62,    63,   192,   463,
+     398,   187,   163,    13,    14,    15,   172,    17,    18,    75,
+      20,    21,    22,    23,    24,    76,    22,    27,    28,   201,
+      -1,    31,    32,    33,    34,    35,    36,    37,    38,    39,
+      40,    41,    42,    -1,    -1,    45,    46,    47,    48,    49,
+      50,    51,    52,    53,    54,    55,    56,    57,    58,    59,
+      60,    61,    62,    63,    -1,    -1,    -1,    -1,    13,    14,
+      15,    -1,    17,    -1,    74,    20,    21,    22,    23,    24,
+      -1,    -1,    27,    28,    -1,    -1,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    -1,    -1,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    -1,
+       3,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    74,
       13,    14,    15,    -1,    17,    -1,    -1,    20,    21,    22,
       23,    24,    -1,    -1,    27,    28,    -1,    -1,    31,    32,
-      33,    34,    35,    36,    37,    38,    39,    40,    -1,    -1,
-      43,    44,    45,    46,    47,    48,    49,    50,    51,    -1,
-      -1,    -1,    55,    56,    57,    13,    14,    15,    -1,    17,
+      33,    34,    35,    36,    37,    38,    39,    40,    41,    42,
+      -1,    -1,    45,    46,    47,    48,    49,    50,    51,    52,
+      53,    54,    55,    56,    57,    58,    59,    60,    61,    62,
+      63,     3,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    13,    14,    15,    -1,    17,    -1,    -1,    20,    21,
+      22,    23,    24,    -1,    -1,    27,    28,    -1,    -1,    31,
+      32,    33,    34,    35,    36,    37,    38,    39,    40,    41,
+      42,    -1,    -1,    45,    46,    47,    48,    49,    50,    51,
+      52,    53,    54,    55,    56,    57,    58,    59,    60,    61,
+      62,    63,     3,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    13,    14,    15,    -1,    17,    -1,    -1,    20,
+      21,    22,    23,    24,    -1,    -1,    27,    28,    -1,    -1,
+      31,    32,    33,    34,    35,    36,    37,    38,    39,    40,
+      41,    42,    -1,    -1,    45,    46,    47,    48,    49,    50,
+      51,    52,    53,    54,    55,    56,    57,    58,    59,    60,
+      61,    62,    63,     3,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    13,    14,    15,    -1,    17,    -1,    -1,
+      20,    21,    22,    23,    24,    -1,    -1,    27,    28,    -1,
+      -1,    31,    32,    33,    34,    35,    36,    37,    38,    39,
+      40,    41,    42,    -1,    -1,    45,    46,    47,    48,    49,
+      50,    51,    52,    53,    54,    55,    56,    57,    58,    59,
+      60,    61,    62,    63,     3,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    13,    14,    15,    -1,    17,    -1,
+      -1,    20,    21,    22,    23,    24,    -1,    -1,    27,    28,
+      -1,    -1,    31,    32,    33,    34,    35,    36,    37,    38,
+      39,    40,    41,    42,    -1,    -1,    45,    46,    47,    48,
+      49,    50,    51,    52,    53,    54,    55,    56,    57,    58,
+      59,    60,    61,    62,    63,     3,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    13,    14,    15,    -1,    17,
       -1,    -1,    20,    21,    22,    23,    24,    -1,    -1,    27,
       28,    -1,    -1,    31,    32,    33,    34,    35,    36,    37,
-      38,    39,    40,    -1,    -1,    43,    44,    45,    46,    47,
-      48,    49,    50,    51,    -1,    -1,    -1,    -1,    56,    57,
-      13,    14,    15,    -1,    17,    -1,    -1,    20,    21,    22,
-      23,    24,    -1,    -1,    27,    28,    -1,    -1,    31,    32,
-      33,    34,    35,    36,    37,    38,    39,    40,    -1,    -1,
-      43,    44,    45,    46,    47,    48,    49,    50,    51,    -1,
-      -1,    13,    14,    15,    57,    17,    18,    -1,    20,    21,
-      22,    23,    24,    -1,    -1,    27,    28,    -1,    -1,    31,
-      32,    33,    34,    35,    36,    37,    38,    39,    40,    -1,
-      -1,    43,    44,    45,    46,    47,    48,    49,    50,    51,
-      -1,    13,    14,    15,    56,    17,    -1,    -1,    20,    21,
-      22,    23,    24,    -1,    -1,    27,    28,    -1,    -1,    31,
-      32,    33,    34,    35,    36,    37,    38,    39,    40,    -1,
-      -1,    43,    44,    45,    46,    47,    48,    49,    50,    51,
-      -1,    13,    14,    15,    56,    17,    18,    -1,    20,    21,
-      22,    23,    24,    -1,    -1,    27,    28,    -1,    -1,    31,
-      32,    33,    34,    35,    36,    37,    38,    39,    40,    -1,
-      -1,    43,    44,    45,    46,    47,    48,    49,    50,    51,
-      13,    14,    15,    -1,    17,    -1,    -1,    20,    21,    22,
-      23,    24,    -1,    -1,    27,    28,    -1,    -1,    31,    32,
-      33,    34,    35,    36,    37,    38,    39,    40,    -1,    -1,
-      43,    44,    45,    46,    47,    48,    49,    50,    51,    -1,
-      52,    53,    54,    -1,    -1,    -1,    58,    59,    60,    61,
-      62,    -1,    64,    65,    66,    67,    -1,    -1,    70,    71,
-      72,    73,    74,    75,    76,    77,    78,    79,    80
+      38,    39,    40,    41,    42,    -1,    -1,    45,    46,    47,
+      48,    49,    50,    51,    52,    53,    54,    55,    56,    57,
+      58,    59,    60,    61,    62,    63,    13,    14,    15,    -1,
+      17,    18,    -1,    20,    21,    22,    23,    24,    -1,    -1,
+      27,    28,    -1,    -1,    31,    32,    33,    34,    35,    36,
+      37,    38,    39,    40,    41,    42,    -1,    -1,    45,    46,
+      47,    48,    49,    50,    51,    52,    53,    54,    55,    56,
+      57,    58,    59,    60,    61,    62,    63,    13,    14,    15,
+      -1,    17,    -1,    -1,    20,    21,    22,    23,    24,    -1,
+      -1,    27,    28,    -1,    -1,    31,    32,    33,    34,    35,
+      36,    37,    38,    39,    40,    41,    42,    -1,    -1,    45,
+      46,    47,    48,    49,    50,    51,    52,    53,    54,    55,
+      56,    57,    58,    59,    60,    61,    62,    63,    70,    71,
+      72,    -1,    -1,    -1,    76,    77,    78,    79,    80,    -1,
+      82,    83,    84,    -1,    86,    -1,    -1,    89,    90,    91,
+      92,    93,    94,    95,    96,    97,    98,    99
 };
 
-  /* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-     symbol of state STATE-NUM.  */
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
 static const yytype_uint8 yystos[] =
 {
-       0,     3,   127,   128,   129,   140,   141,   143,   144,   146,
-     149,   152,   154,   155,   156,   158,   159,   160,   162,   163,
-     164,   165,   166,   169,   170,    52,    53,    54,    58,    59,
-      60,    61,    62,    64,    65,    66,    67,    70,    71,    72,
-      73,    74,    75,    76,    77,    78,    79,    80,     3,   156,
-       3,   165,     0,     9,   100,   101,     5,     9,    96,    98,
-       3,    89,   101,   100,   100,     3,    98,   114,   139,   100,
-      98,   139,     8,    85,    85,   100,   100,    85,     9,   161,
-     161,     3,   162,   162,   162,     3,   163,   163,   163,     3,
-     162,   163,   163,     3,    13,    14,    15,    17,    20,    21,
+       0,     3,   149,   150,   151,   162,   163,   165,   166,   168,
+     171,   174,   176,   177,   178,   180,   181,   182,   184,   185,
+     186,   187,   188,   191,   192,    70,    71,    72,    76,    77,
+      78,    79,    80,    82,    83,    84,    86,    89,    90,    91,
+      92,    93,    94,    95,    96,    97,    98,    99,     3,   178,
+       3,   187,     0,     9,   122,   123,     5,     9,   116,   120,
+       3,   109,   123,   122,   122,     3,   120,   136,   161,   122,
+     120,   161,     8,   104,   104,   122,   122,   104,     9,   183,
+     183,     3,   184,   184,   184,     3,   185,   185,   185,     3,
+     184,   185,   185,     3,    13,    14,    15,    17,    20,    21,
       22,    23,    24,    27,    28,    31,    32,    33,    34,    35,
-      36,    37,    38,    39,    40,    43,    44,    45,    46,    47,
-      48,    49,    50,    51,    95,   105,   106,   107,   114,   121,
-     122,   123,   124,   130,   134,   135,   136,   137,   138,   150,
-     153,     4,    52,     4,    89,     3,    10,    88,   147,   150,
-     153,     3,    11,    87,    92,    94,    96,   142,   150,   153,
-      15,    17,    20,    63,   106,   115,   123,   139,    99,     3,
-      93,    94,   145,   150,   153,   139,     8,    83,    84,    85,
-       3,   151,    86,    68,    69,   157,   158,   161,    85,    85,
-      85,    85,    85,   168,     4,     4,    85,    85,    85,    54,
-      55,    56,    57,    64,    65,   101,   102,   102,   102,    98,
-      98,    99,    98,    98,    98,    98,    98,    98,    98,    41,
-     103,   103,     5,     6,     7,    97,     3,   134,     3,   124,
-      98,    98,   102,     4,     3,    95,   131,   132,   133,   130,
-       3,    90,    91,     4,    12,   124,   126,     4,     3,    88,
-     147,     3,    87,    96,     4,    92,   142,   102,   102,   102,
-     126,   114,   125,     4,   102,    99,     4,    98,    62,     4,
-      93,   145,    84,     8,     4,     3,   127,   148,    52,    58,
-      59,    61,    66,     4,     4,    10,    83,    83,     4,     4,
-     168,     4,     4,     4,     4,     3,     4,   167,     4,     4,
-       4,    98,    86,   101,    86,    86,   101,    85,    85,     3,
-     108,   109,   124,   109,   109,    98,    42,   104,   104,   109,
-      55,    56,     3,   131,    55,    56,     4,    10,    60,   109,
-       3,   108,   114,   119,   120,   109,     4,   125,   108,   116,
-     124,     4,    84,     4,    52,    58,    59,    61,     4,    98,
-      98,    98,    98,    98,     4,     4,     4,    43,     4,     4,
-      10,     4,     4,    10,    85,     4,    56,   109,    16,    16,
-      19,    16,    25,    26,   110,   111,   112,   113,    86,   101,
-      86,    86,   101,    86,     4,    99,    18,   119,     3,   114,
-     116,    29,    30,   117,   118,     4,   100,   100,   100,   100,
-       4,     4,     4,     4,     4,    97,   135,     4,     3,   136,
-       3,   138,     4,     4,    86,   102,   102,   102,   102,    98,
-     124,    16,   112,     4,    10,     4,     4,    10,     4,     4,
-     124,    18,   114,     3,     3,   117,     3,    90,    95,    88,
-      92,    93,     4,   135,   138,     4,   124,   124,   102,   132,
-       4,     3,   133,    90,     4,     3,    91,     4,   124,   110,
-     111,     4,     4,     4,     4,     4,    16,   132,    90,     3,
-       4,     4,     4,   102,    19,     3,   124,    19,     4,   124,
-       4
+      36,    37,    38,    39,    40,    41,    42,    45,    46,    47,
+      48,    49,    50,    51,    52,    53,    54,    55,    56,    57,
+      58,    59,    60,    61,    62,    63,   115,   127,   128,   129,
+     136,   143,   144,   145,   146,   152,   156,   157,   158,   159,
+     160,   172,   175,     4,    70,     4,   109,     3,    10,   105,
+     108,   169,   172,   175,     3,    11,   107,   112,   114,   116,
+     164,   172,   175,    15,    17,    20,    81,   128,   137,   145,
+     161,   121,     3,   113,   114,   167,   172,   175,   161,     8,
+     102,   103,   104,     3,   173,   106,    87,    88,   179,   180,
+     183,   104,   104,   104,   104,   104,   190,     4,     4,   104,
+     104,   104,    72,    73,    74,    75,    82,    83,   123,   124,
+     124,   124,   120,   120,   121,   120,   120,   120,   120,   120,
+     120,   120,   120,   120,    43,   125,   125,   125,   125,   125,
+     125,   125,   125,     5,     6,     7,   117,    64,    65,    66,
+      67,    68,    69,   118,   116,     3,   156,     3,   146,   120,
+     120,   124,     4,     3,   115,   153,   154,   155,   152,     3,
+     110,   111,     4,    12,   146,   148,     4,     3,   108,   169,
+       3,   107,   116,     4,   112,   164,   124,   124,   124,   148,
+     136,   147,     4,   124,   121,     4,   120,    80,     4,   113,
+     167,   103,     8,     4,     3,   149,   170,    70,    76,    77,
+      79,    84,     4,     4,   105,   102,   102,     4,     4,   190,
+       4,     4,     4,     4,     3,     4,   189,     4,     4,     4,
+     120,   106,   123,   106,   106,   123,   104,   104,     3,   130,
+     131,   146,   131,   131,   120,    44,   126,   126,   126,   126,
+     126,   126,   126,   126,   119,   131,    73,    74,     3,   153,
+      73,    74,     4,   105,    78,    85,   131,     3,   130,   136,
+     141,   142,   131,     4,   147,   130,   138,   146,     4,   103,
+       4,    70,    76,    77,    79,     4,   120,   120,   120,   120,
+     120,     4,     4,     4,    51,     4,     4,   105,     4,     4,
+     105,   104,     4,    74,   131,    16,    16,    19,    16,   117,
+      25,    26,   132,   133,   134,   135,   106,   123,   106,   106,
+     123,   106,     4,   121,    18,   141,     3,   136,   138,    29,
+      30,   139,   140,     4,   122,   122,   122,   122,     4,     4,
+       4,     4,     4,   117,   157,     4,     3,   158,     3,   160,
+       4,     4,   106,   124,   124,   124,   124,   120,   146,    16,
+     134,     4,   105,     4,     4,   105,     4,     4,   146,    18,
+     136,     3,     3,   139,     3,   110,   115,   108,   112,   113,
+       4,   157,   160,     4,   146,   146,   124,   154,     4,     3,
+     155,   110,     4,     3,   111,     4,   146,   132,   133,     4,
+       4,     4,     4,     4,    16,   154,   110,     3,     4,     4,
+       4,   124,    19,     3,   146,    19,     4,   146,     4
 };
 
-  /* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
 static const yytype_uint8 yyr1[] =
 {
-       0,    82,    83,    83,    84,    84,    85,    86,    86,    87,
-      88,    88,    89,    90,    90,    90,    91,    91,    92,    93,
-      94,    94,    95,    96,    97,    97,    97,    98,    98,    99,
-      99,   100,   100,   101,   102,   102,   103,   103,   104,   104,
-     105,   105,   105,   106,   106,   106,   106,   106,   106,   106,
-     106,   106,   106,   106,   106,   106,   106,   106,   106,   106,
-     106,   106,   106,   106,   106,   106,   106,   106,   106,   107,
-     107,   107,   107,   107,   108,   109,   109,   110,   111,   112,
-     112,   113,   113,   114,   115,   115,   115,   115,   115,   116,
-     116,   117,   117,   118,   118,   119,   119,   120,   120,   120,
-     120,   120,   120,   121,   122,   123,   124,   124,   125,   125,
-     126,   127,   128,   129,   130,   130,   130,   130,   130,   131,
-     132,   132,   132,   133,   133,   134,   135,   135,   135,   136,
-     136,   137,   138,   138,   138,   139,   139,   140,   140,   141,
-     142,   142,   142,   142,   143,   143,   144,   145,   145,   145,
-     145,   146,   147,   147,   147,   148,   148,   148,   148,   148,
-     148,   149,   150,   151,   151,   151,   151,   151,   152,   153,
-     154,   154,   155,   156,   156,   156,   156,   156,   156,   156,
-     156,   156,   156,   156,   157,   157,   158,   158,   159,   160,
-     161,   161,   162,   162,   162,   163,   163,   164,   164,   164,
-     164,   164,   164,   164,   164,   164,   165,   165,   165,   165,
-     166,   166,   167,   168,   168,   169,   169,   169,   170
+       0,   101,   102,   102,   103,   103,   104,   105,   106,   106,
+     107,   108,   108,   109,   110,   110,   110,   111,   111,   112,
+     113,   114,   114,   114,   115,   116,   117,   117,   117,   118,
+     118,   118,   118,   118,   118,   119,   119,   120,   120,   121,
+     121,   122,   122,   123,   124,   124,   125,   125,   126,   126,
+     127,   127,   127,   128,   128,   128,   128,   128,   128,   128,
+     128,   128,   128,   128,   128,   128,   128,   128,   128,   128,
+     128,   128,   128,   128,   128,   128,   128,   128,   128,   128,
+     128,   128,   128,   128,   128,   128,   128,   128,   128,   128,
+     128,   129,   129,   129,   129,   129,   130,   131,   131,   132,
+     133,   134,   134,   135,   135,   136,   137,   137,   137,   137,
+     137,   138,   138,   139,   139,   140,   140,   141,   141,   142,
+     142,   142,   142,   142,   142,   143,   144,   145,   146,   146,
+     147,   147,   148,   149,   150,   151,   152,   152,   152,   152,
+     152,   153,   154,   154,   154,   155,   155,   156,   157,   157,
+     157,   158,   158,   159,   160,   160,   160,   161,   161,   162,
+     162,   163,   164,   164,   164,   164,   165,   165,   166,   167,
+     167,   167,   167,   168,   169,   169,   169,   170,   170,   170,
+     170,   170,   170,   171,   172,   173,   173,   173,   173,   173,
+     174,   175,   176,   176,   177,   178,   178,   178,   178,   178,
+     178,   178,   178,   178,   178,   178,   179,   179,   180,   180,
+     181,   182,   183,   183,   184,   184,   184,   185,   185,   186,
+     186,   186,   186,   186,   186,   186,   186,   186,   187,   187,
+     187,   187,   188,   188,   189,   190,   190,   191,   191,   191,
+     192
 };
 
-  /* YYR2[YYN] -- Number of symbols on the right hand side of rule YYN.  */
-static const yytype_uint8 yyr2[] =
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
 {
-       0,     2,     1,     2,     0,     1,     1,     0,     2,     1,
-       1,     4,     4,     1,     5,     6,     0,     5,     2,     1,
-       1,     2,     4,     1,     1,     1,     1,     1,     1,     0,
+       0,     2,     1,     2,     0,     1,     1,     1,     0,     2,
+       1,     1,     4,     4,     1,     5,     6,     0,     5,     2,
+       1,     1,     2,     3,     4,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     0,     2,     1,     1,     0,
        2,     0,     1,     1,     0,     1,     0,     1,     0,     1,
        1,     1,     1,     1,     1,     1,     1,     2,     2,     3,
-       1,     2,     2,     2,     2,     2,     2,     2,     3,     3,
-       2,     1,     1,     1,     1,     1,     1,     2,     2,     5,
-       5,     5,     8,     6,     4,     2,     1,     3,     2,     1,
-       1,     1,     2,     3,     2,     3,     3,     3,     3,     2,
-       2,     4,     4,     1,     2,     2,     1,     8,     4,     9,
-       5,     3,     2,     1,     1,     1,     0,     2,     0,     2,
-       1,     5,     1,     5,     2,     1,     3,     2,     2,     1,
-       1,     5,     6,     0,     5,     1,     1,     5,     6,     1,
-       5,     1,     1,     5,     6,     4,     1,     6,     5,     5,
-       1,     2,     2,     5,     6,     5,     5,     1,     2,     2,
-       4,     5,     2,     2,     2,     5,     5,     5,     5,     5,
-       1,     6,     5,     4,     4,     4,     4,     4,     5,     4,
-       4,     5,     4,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     0,     1,     1,     2,     1,     1,
-       0,     1,     5,     6,     6,     6,     5,     5,     5,     5,
-       5,     5,     4,     4,     5,     5,     1,     1,     1,     5,
-       1,     2,     4,     0,     2,     0,     1,     1,     1
+       1,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       3,     3,     3,     3,     3,     3,     3,     3,     2,     3,
+       2,     1,     1,     1,     1,     1,     1,     1,     1,     2,
+       2,     5,     5,     5,     8,     6,     4,     2,     1,     3,
+       2,     1,     1,     1,     2,     3,     2,     3,     3,     3,
+       3,     2,     2,     4,     4,     1,     2,     2,     1,     8,
+       4,     9,     5,     3,     2,     1,     1,     1,     0,     2,
+       0,     2,     1,     5,     1,     5,     2,     1,     3,     2,
+       2,     1,     1,     5,     6,     0,     5,     1,     1,     5,
+       6,     1,     5,     1,     1,     5,     6,     4,     1,     6,
+       5,     5,     1,     2,     2,     5,     6,     5,     5,     1,
+       2,     2,     4,     5,     2,     2,     2,     5,     5,     5,
+       5,     5,     1,     6,     5,     4,     4,     4,     4,     4,
+       5,     4,     4,     5,     4,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     0,     1,     1,     2,
+       1,     1,     0,     1,     5,     6,     6,     6,     5,     5,
+       5,     5,     5,     5,     4,     4,     5,     5,     1,     1,
+       1,     5,     1,     2,     4,     0,     2,     0,     1,     1,
+       1
 };
 
 
+enum { YYENOMEM = -2 };
+
 #define yyerrok         (yyerrstatus = 0)
-#define yyclearin       (yychar = YYEMPTY)
-#define YYEMPTY         (-2)
-#define YYEOF           0
+#define yyclearin       (yychar = WABT_TOKEN_TYPE_WABT_WAST_PARSER_EMPTY)
 
 #define YYACCEPT        goto yyacceptlab
 #define YYABORT         goto yyabortlab
 #define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
 
 
 #define YYRECOVERING()  (!!yyerrstatus)
 
-#define YYBACKUP(Token, Value)                                  \
-do                                                              \
-  if (yychar == YYEMPTY)                                        \
-    {                                                           \
-      yychar = (Token);                                         \
-      yylval = (Value);                                         \
-      YYPOPSTACK (yylen);                                       \
-      yystate = *yyssp;                                         \
-      goto yybackup;                                            \
-    }                                                           \
-  else                                                          \
-    {                                                           \
-      yyerror (&yylloc, lexer, parser, YY_("syntax error: cannot back up")); \
-      YYERROR;                                                  \
-    }                                                           \
-while (0)
-
-/* Error token number */
-#define YYTERROR        1
-#define YYERRCODE       256
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == WABT_TOKEN_TYPE_WABT_WAST_PARSER_EMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (&yylloc, lexer, parser, YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
 
+/* Backward compatibility with an undocumented macro.
+   Use WABT_TOKEN_TYPE_WABT_WAST_PARSER_error or WABT_TOKEN_TYPE_WABT_WAST_PARSER_UNDEF. */
+#define YYERRCODE WABT_TOKEN_TYPE_WABT_WAST_PARSER_UNDEF
 
 /* YYLLOC_DEFAULT -- Set CURRENT to span from RHS[1] to RHS[N].
    If N is 0, then set CURRENT to the empty location which ends
@@ -1307,20 +1561,27 @@ do {                                            \
 } while (0)
 
 
-/* YY_LOCATION_PRINT -- Print the location on the stream.
+/* YYLOCATION_PRINT -- Print the location on the stream.
    This macro was not mandated originally: define only if we know
    we won't break user code: when these are the locations we know.  */
 
-#ifndef YY_LOCATION_PRINT
-# if defined WABT_WAST_PARSER_LTYPE_IS_TRIVIAL && WABT_WAST_PARSER_LTYPE_IS_TRIVIAL
+# ifndef YYLOCATION_PRINT
+
+#  if defined YY_LOCATION_PRINT
+
+   /* Temporary convenience wrapper in case some people defined the
+      undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YYLOCATION_PRINT(File, Loc)  YY_LOCATION_PRINT(File, *(Loc))
+
+#  elif defined WABT_WAST_PARSER_LTYPE_IS_TRIVIAL && WABT_WAST_PARSER_LTYPE_IS_TRIVIAL
 
 /* Print *YYLOCP on YYO.  Private, do not rely on its existence. */
 
 YY_ATTRIBUTE_UNUSED
-static unsigned
+static int
 yy_location_print_ (FILE *yyo, YYLTYPE const * const yylocp)
 {
-  unsigned res = 0;
+  int res = 0;
   int end_col = 0 != yylocp->last_column ? yylocp->last_column - 1 : 0;
   if (0 <= yylocp->first_line)
     {
@@ -1340,65 +1601,73 @@ yy_location_print_ (FILE *yyo, YYLTYPE const * const yylocp)
         res += YYFPRINTF (yyo, "-%d", end_col);
     }
   return res;
- }
+}
 
-#  define YY_LOCATION_PRINT(File, Loc)          \
-  yy_location_print_ (File, &(Loc))
+#   define YYLOCATION_PRINT  yy_location_print_
 
-# else
-#  define YY_LOCATION_PRINT(File, Loc) ((void) 0)
-# endif
-#endif
+    /* Temporary convenience wrapper in case some people defined the
+       undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YY_LOCATION_PRINT(File, Loc)  YYLOCATION_PRINT(File, &(Loc))
+
+#  else
+
+#   define YYLOCATION_PRINT(File, Loc) ((void) 0)
+    /* Temporary convenience wrapper in case some people defined the
+       undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YY_LOCATION_PRINT  YYLOCATION_PRINT
+
+#  endif
+# endif /* !defined YYLOCATION_PRINT */
 
 
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)                    \
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
 do {                                                                      \
   if (yydebug)                                                            \
     {                                                                     \
       YYFPRINTF (stderr, "%s ", Title);                                   \
       yy_symbol_print (stderr,                                            \
-                  Type, Value, Location, lexer, parser); \
+                  Kind, Value, Location, lexer, parser); \
       YYFPRINTF (stderr, "\n");                                           \
     }                                                                     \
 } while (0)
 
 
-/*----------------------------------------.
-| Print this symbol's value on YYOUTPUT.  |
-`----------------------------------------*/
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
 
 static void
-yy_symbol_value_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp, ::wabt::WastLexer* lexer, ::wabt::WastParser* parser)
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp, ::wabt::WastLexer* lexer, ::wabt::WastParser* parser)
 {
-  FILE *yyo = yyoutput;
-  YYUSE (yyo);
-  YYUSE (yylocationp);
-  YYUSE (lexer);
-  YYUSE (parser);
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  YY_USE (yylocationp);
+  YY_USE (lexer);
+  YY_USE (parser);
   if (!yyvaluep)
     return;
-# ifdef YYPRINT
-  if (yytype < YYNTOKENS)
-    YYPRINT (yyoutput, yytoknum[yytype], *yyvaluep);
-# endif
-  YYUSE (yytype);
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
 
 static void
-yy_symbol_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp, ::wabt::WastLexer* lexer, ::wabt::WastParser* parser)
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp, ::wabt::WastLexer* lexer, ::wabt::WastParser* parser)
 {
-  YYFPRINTF (yyoutput, "%s %s (",
-             yytype < YYNTOKENS ? "token" : "nterm", yytname[yytype]);
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
 
-  YY_LOCATION_PRINT (yyoutput, *yylocationp);
-  YYFPRINTF (yyoutput, ": ");
-  yy_symbol_value_print (yyoutput, yytype, yyvaluep, yylocationp, lexer, parser);
-  YYFPRINTF (yyoutput, ")");
+  YYLOCATION_PRINT (yyo, yylocationp);
+  YYFPRINTF (yyo, ": ");
+  yy_symbol_value_print (yyo, yykind, yyvaluep, yylocationp, lexer, parser);
+  YYFPRINTF (yyo, ")");
 }
 
 /*------------------------------------------------------------------.
@@ -1407,7 +1676,7 @@ yy_symbol_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep, YYL
 `------------------------------------------------------------------*/
 
 static void
-yy_stack_print (yytype_int16 *yybottom, yytype_int16 *yytop)
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
 {
   YYFPRINTF (stderr, "Stack now");
   for (; yybottom <= yytop; yybottom++)
@@ -1430,21 +1699,22 @@ do {                                                            \
 `------------------------------------------------*/
 
 static void
-yy_reduce_print (yytype_int16 *yyssp, YYSTYPE *yyvsp, YYLTYPE *yylsp, int yyrule, ::wabt::WastLexer* lexer, ::wabt::WastParser* parser)
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp, YYLTYPE *yylsp,
+                 int yyrule, ::wabt::WastLexer* lexer, ::wabt::WastParser* parser)
 {
-  unsigned long int yylno = yyrline[yyrule];
+  int yylno = yyrline[yyrule];
   int yynrhs = yyr2[yyrule];
   int yyi;
-  YYFPRINTF (stderr, "Reducing stack by rule %d (line %lu):\n",
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
              yyrule - 1, yylno);
   /* The symbols being reduced.  */
   for (yyi = 0; yyi < yynrhs; yyi++)
     {
       YYFPRINTF (stderr, "   $%d = ", yyi + 1);
       yy_symbol_print (stderr,
-                       yystos[yyssp[yyi + 1 - yynrhs]],
-                       &(yyvsp[(yyi + 1) - (yynrhs)])
-                       , &(yylsp[(yyi + 1) - (yynrhs)])                       , lexer, parser);
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)],
+                       &(yylsp[(yyi + 1) - (yynrhs)]), lexer, parser);
       YYFPRINTF (stderr, "\n");
     }
 }
@@ -1459,8 +1729,8 @@ do {                                    \
    multiple parsers can coexist.  */
 int yydebug;
 #else /* !WABT_WAST_PARSER_DEBUG */
-# define YYDPRINTF(Args)
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
 # define YY_STACK_PRINT(Bottom, Top)
 # define YY_REDUCE_PRINT(Rule)
 #endif /* !WABT_WAST_PARSER_DEBUG */
@@ -1483,28 +1753,77 @@ int yydebug;
 #endif
 
 
-#if YYERROR_VERBOSE
+/* Context of a parse error.  */
+typedef struct
+{
+  yy_state_t *yyssp;
+  yysymbol_kind_t yytoken;
+  YYLTYPE *yylloc;
+} yypcontext_t;
+
+/* Put in YYARG at most YYARGN of the expected tokens given the
+   current YYCTX, and return the number of tokens stored in YYARG.  If
+   YYARG is null, return the number of expected tokens (guaranteed to
+   be less than YYNTOKENS).  Return YYENOMEM on memory exhaustion.
+   Return 0 if there are more than YYARGN expected tokens, yet fill
+   YYARG up to YYARGN. */
+static int
+yypcontext_expected_tokens (const yypcontext_t *yyctx,
+                            yysymbol_kind_t yyarg[], int yyargn)
+{
+  /* Actual size of YYARG. */
+  int yycount = 0;
+  int yyn = yypact[+*yyctx->yyssp];
+  if (!yypact_value_is_default (yyn))
+    {
+      /* Start YYX at -YYN if negative to avoid negative indexes in
+         YYCHECK.  In other words, skip the first -YYN actions for
+         this state because they are default actions.  */
+      int yyxbegin = yyn < 0 ? -yyn : 0;
+      /* Stay within bounds of both yycheck and yytname.  */
+      int yychecklim = YYLAST - yyn + 1;
+      int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
+      int yyx;
+      for (yyx = yyxbegin; yyx < yyxend; ++yyx)
+        if (yycheck[yyx + yyn] == yyx && yyx != YYSYMBOL_YYerror
+            && !yytable_value_is_error (yytable[yyx + yyn]))
+          {
+            if (!yyarg)
+              ++yycount;
+            else if (yycount == yyargn)
+              return 0;
+            else
+              yyarg[yycount++] = YY_CAST (yysymbol_kind_t, yyx);
+          }
+    }
+  if (yyarg && yycount == 0 && 0 < yyargn)
+    yyarg[0] = YYSYMBOL_YYEMPTY;
+  return yycount;
+}
+
+
 
-# ifndef yystrlen
-#  if defined __GLIBC__ && defined _STRING_H
-#   define yystrlen strlen
-#  else
+
+#ifndef yystrlen
+# if defined __GLIBC__ && defined _STRING_H
+#  define yystrlen(S) (YY_CAST (YYPTRDIFF_T, strlen (S)))
+# else
 /* Return the length of YYSTR.  */
-static YYSIZE_T
+static YYPTRDIFF_T
 yystrlen (const char *yystr)
 {
-  YYSIZE_T yylen;
+  YYPTRDIFF_T yylen;
   for (yylen = 0; yystr[yylen]; yylen++)
     continue;
   return yylen;
 }
-#  endif
 # endif
+#endif
 
-# ifndef yystpcpy
-#  if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
-#   define yystpcpy stpcpy
-#  else
+#ifndef yystpcpy
+# if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
+#  define yystpcpy stpcpy
+# else
 /* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
    YYDEST.  */
 static char *
@@ -1518,10 +1837,10 @@ yystpcpy (char *yydest, const char *yysrc)
 
   return yyd - 1;
 }
-#  endif
 # endif
+#endif
 
-# ifndef yytnamerr
+#ifndef yytnamerr
 /* Copy to YYRES the contents of YYSTR after stripping away unnecessary
    quotes and backslashes, so that it's suitable for yyerror.  The
    heuristic is that double-quoting is unnecessary unless the string
@@ -1529,14 +1848,13 @@ yystpcpy (char *yydest, const char *yysrc)
    backslash-backslash).  YYSTR is taken from yytname.  If YYRES is
    null, do not copy; instead, return the length of what the result
    would have been.  */
-static YYSIZE_T
+static YYPTRDIFF_T
 yytnamerr (char *yyres, const char *yystr)
 {
   if (*yystr == '"')
     {
-      YYSIZE_T yyn = 0;
+      YYPTRDIFF_T yyn = 0;
       char const *yyp = yystr;
-
       for (;;)
         switch (*++yyp)
           {
@@ -1547,7 +1865,10 @@ yytnamerr (char *yyres, const char *yystr)
           case '\\':
             if (*++yyp != '\\')
               goto do_not_strip_quotes;
-            /* Fall through.  */
+            else
+              goto append;
+
+          append:
           default:
             if (yyres)
               yyres[yyn] = *yyp;
@@ -1562,36 +1883,20 @@ yytnamerr (char *yyres, const char *yystr)
     do_not_strip_quotes: ;
     }
 
-  if (! yyres)
+  if (yyres)
+    return yystpcpy (yyres, yystr) - yyres;
+  else
     return yystrlen (yystr);
-
-  return yystpcpy (yyres, yystr) - yyres;
 }
-# endif
+#endif
 
-/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
-   about the unexpected token YYTOKEN for the state stack whose top is
-   YYSSP.
 
-   Return 0 if *YYMSG was successfully written.  Return 1 if *YYMSG is
-   not large enough to hold the message.  In that case, also set
-   *YYMSG_ALLOC to the required number of bytes.  Return 2 if the
-   required number of bytes is too large to store.  */
 static int
-yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
-                yytype_int16 *yyssp, int yytoken)
+yy_syntax_error_arguments (const yypcontext_t *yyctx,
+                           yysymbol_kind_t yyarg[], int yyargn)
 {
-  YYSIZE_T yysize0 = yytnamerr (YY_NULLPTR, yytname[yytoken]);
-  YYSIZE_T yysize = yysize0;
-  enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-  /* Internationalized format string. */
-  const char *yyformat = YY_NULLPTR;
-  /* Arguments of yyformat. */
-  char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
-  /* Number of reported tokens (one for the "unexpected", one per
-     "expected"). */
+  /* Actual size of YYARG. */
   int yycount = 0;
-
   /* There are many possibilities here to consider:
      - If this state is a consistent state with a default action, then
        the only way this function was invoked is if the default action
@@ -1615,63 +1920,78 @@ yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
        one exception: it will still contain any token that will not be
        accepted due to an error action in a later state.
   */
-  if (yytoken != YYEMPTY)
-    {
-      int yyn = yypact[*yyssp];
-      yyarg[yycount++] = yytname[yytoken];
-      if (!yypact_value_is_default (yyn))
-        {
-          /* Start YYX at -YYN if negative to avoid negative indexes in
-             YYCHECK.  In other words, skip the first -YYN actions for
-             this state because they are default actions.  */
-          int yyxbegin = yyn < 0 ? -yyn : 0;
-          /* Stay within bounds of both yycheck and yytname.  */
-          int yychecklim = YYLAST - yyn + 1;
-          int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
-          int yyx;
-
-          for (yyx = yyxbegin; yyx < yyxend; ++yyx)
-            if (yycheck[yyx + yyn] == yyx && yyx != YYTERROR
-                && !yytable_value_is_error (yytable[yyx + yyn]))
-              {
-                if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                  {
-                    yycount = 1;
-                    yysize = yysize0;
-                    break;
-                  }
-                yyarg[yycount++] = yytname[yyx];
-                {
-                  YYSIZE_T yysize1 = yysize + yytnamerr (YY_NULLPTR, yytname[yyx]);
-                  if (! (yysize <= yysize1
-                         && yysize1 <= YYSTACK_ALLOC_MAXIMUM))
-                    return 2;
-                  yysize = yysize1;
-                }
-              }
-        }
+  if (yyctx->yytoken != YYSYMBOL_YYEMPTY)
+    {
+      int yyn;
+      if (yyarg)
+        yyarg[yycount] = yyctx->yytoken;
+      ++yycount;
+      yyn = yypcontext_expected_tokens (yyctx,
+                                        yyarg ? yyarg + 1 : yyarg, yyargn - 1);
+      if (yyn == YYENOMEM)
+        return YYENOMEM;
+      else
+        yycount += yyn;
     }
+  return yycount;
+}
+
+/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
+   about the unexpected token YYTOKEN for the state stack whose top is
+   YYSSP.
+
+   Return 0 if *YYMSG was successfully written.  Return -1 if *YYMSG is
+   not large enough to hold the message.  In that case, also set
+   *YYMSG_ALLOC to the required number of bytes.  Return YYENOMEM if the
+   required number of bytes is too large to store.  */
+static int
+yysyntax_error (YYPTRDIFF_T *yymsg_alloc, char **yymsg,
+                const yypcontext_t *yyctx)
+{
+  enum { YYARGS_MAX = 5 };
+  /* Internationalized format string. */
+  const char *yyformat = YY_NULLPTR;
+  /* Arguments of yyformat: reported tokens (one for the "unexpected",
+     one per "expected"). */
+  yysymbol_kind_t yyarg[YYARGS_MAX];
+  /* Cumulated lengths of YYARG.  */
+  YYPTRDIFF_T yysize = 0;
+
+  /* Actual size of YYARG. */
+  int yycount = yy_syntax_error_arguments (yyctx, yyarg, YYARGS_MAX);
+  if (yycount == YYENOMEM)
+    return YYENOMEM;
 
   switch (yycount)
     {
-# define YYCASE_(N, S)                      \
+#define YYCASE_(N, S)                       \
       case N:                               \
         yyformat = S;                       \
-      break
+        break
+    default: /* Avoid compiler warnings. */
       YYCASE_(0, YY_("syntax error"));
       YYCASE_(1, YY_("syntax error, unexpected %s"));
       YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
       YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
       YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
       YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
-# undef YYCASE_
+#undef YYCASE_
     }
 
+  /* Compute error message size.  Don't count the "%s"s, but reserve
+     room for the terminator.  */
+  yysize = yystrlen (yyformat) - 2 * yycount + 1;
   {
-    YYSIZE_T yysize1 = yysize + yystrlen (yyformat);
-    if (! (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM))
-      return 2;
-    yysize = yysize1;
+    int yyi;
+    for (yyi = 0; yyi < yycount; ++yyi)
+      {
+        YYPTRDIFF_T yysize1
+          = yysize + yytnamerr (YY_NULLPTR, yytname[yyarg[yyi]]);
+        if (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM)
+          yysize = yysize1;
+        else
+          return YYENOMEM;
+      }
   }
 
   if (*yymsg_alloc < yysize)
@@ -1680,7 +2000,7 @@ yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
       if (! (yysize <= *yymsg_alloc
              && *yymsg_alloc <= YYSTACK_ALLOC_MAXIMUM))
         *yymsg_alloc = YYSTACK_ALLOC_MAXIMUM;
-      return 1;
+      return -1;
     }
 
   /* Avoid sprintf, as that infringes on the user's name space.
@@ -1692,451 +2012,457 @@ yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
     while ((*yyp = *yyformat) != '\0')
       if (*yyp == '%' && yyformat[1] == 's' && yyi < yycount)
         {
-          yyp += yytnamerr (yyp, yyarg[yyi++]);
+          yyp += yytnamerr (yyp, yytname[yyarg[yyi++]]);
           yyformat += 2;
         }
       else
         {
-          yyp++;
-          yyformat++;
+          ++yyp;
+          ++yyformat;
         }
   }
   return 0;
 }
-#endif /* YYERROR_VERBOSE */
+
 
 /*-----------------------------------------------.
 | Release the memory associated to this symbol.  |
 `-----------------------------------------------*/
 
 static void
-yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep, YYLTYPE *yylocationp, ::wabt::WastLexer* lexer, ::wabt::WastParser* parser)
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep, YYLTYPE *yylocationp, ::wabt::WastLexer* lexer, ::wabt::WastParser* parser)
 {
-  YYUSE (yyvaluep);
-  YYUSE (yylocationp);
-  YYUSE (lexer);
-  YYUSE (parser);
+  YY_USE (yyvaluep);
+  YY_USE (yylocationp);
+  YY_USE (lexer);
+  YY_USE (parser);
   if (!yymsg)
     yymsg = "Deleting";
-  YY_SYMBOL_PRINT (yymsg, yytype, yyvaluep, yylocationp);
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
 
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
-  switch (yytype)
+  switch (yykind)
     {
-          case 5: /* NAT  */
-#line 228 "src/wast-parser.y" /* yacc.c:1257  */
-      {}
-#line 1730 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_NAT: /* NAT  */
+#line 253 "src/wast-parser.y"
+            {}
+#line 2051 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 6: /* INT  */
-#line 228 "src/wast-parser.y" /* yacc.c:1257  */
-      {}
-#line 1736 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_INT: /* INT  */
+#line 253 "src/wast-parser.y"
+            {}
+#line 2057 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 7: /* FLOAT  */
-#line 228 "src/wast-parser.y" /* yacc.c:1257  */
-      {}
-#line 1742 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_FLOAT: /* FLOAT  */
+#line 253 "src/wast-parser.y"
+            {}
+#line 2063 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 8: /* TEXT  */
-#line 228 "src/wast-parser.y" /* yacc.c:1257  */
-      {}
-#line 1748 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_TEXT: /* TEXT  */
+#line 253 "src/wast-parser.y"
+            {}
+#line 2069 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 9: /* VAR  */
-#line 228 "src/wast-parser.y" /* yacc.c:1257  */
-      {}
-#line 1754 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_VAR: /* VAR  */
+#line 253 "src/wast-parser.y"
+            {}
+#line 2075 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 41: /* OFFSET_EQ_NAT  */
-#line 228 "src/wast-parser.y" /* yacc.c:1257  */
-      {}
-#line 1760 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_OFFSET_EQ_NAT: /* OFFSET_EQ_NAT  */
+#line 253 "src/wast-parser.y"
+            {}
+#line 2081 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 42: /* ALIGN_EQ_NAT  */
-#line 228 "src/wast-parser.y" /* yacc.c:1257  */
-      {}
-#line 1766 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_ALIGN_EQ_NAT: /* ALIGN_EQ_NAT  */
+#line 253 "src/wast-parser.y"
+            {}
+#line 2087 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 83: /* text_list  */
-#line 249 "src/wast-parser.y" /* yacc.c:1257  */
-      { destroy_text_list(&((*yyvaluep).text_list)); }
-#line 1772 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_text_list: /* text_list  */
+#line 274 "src/wast-parser.y"
+            { destroy_text_list(&((*yyvaluep).text_list)); }
+#line 2093 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 84: /* text_list_opt  */
-#line 249 "src/wast-parser.y" /* yacc.c:1257  */
-      { destroy_text_list(&((*yyvaluep).text_list)); }
-#line 1778 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_text_list_opt: /* text_list_opt  */
+#line 274 "src/wast-parser.y"
+            { destroy_text_list(&((*yyvaluep).text_list)); }
+#line 2099 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 85: /* quoted_text  */
-#line 229 "src/wast-parser.y" /* yacc.c:1257  */
-      { destroy_string_slice(&((*yyvaluep).text)); }
-#line 1784 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_quoted_text: /* quoted_text  */
+#line 254 "src/wast-parser.y"
+            { destroy_string_slice(&((*yyvaluep).text)); }
+#line 2105 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 86: /* value_type_list  */
-#line 250 "src/wast-parser.y" /* yacc.c:1257  */
-      { delete ((*yyvaluep).types); }
-#line 1790 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_value_type_list: /* value_type_list  */
+#line 276 "src/wast-parser.y"
+            { delete ((*yyvaluep).types); }
+#line 2111 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 88: /* global_type  */
-#line 242 "src/wast-parser.y" /* yacc.c:1257  */
-      { delete ((*yyvaluep).global); }
-#line 1796 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_global_type: /* global_type  */
+#line 267 "src/wast-parser.y"
+            { delete ((*yyvaluep).global); }
+#line 2117 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 89: /* func_type  */
-#line 241 "src/wast-parser.y" /* yacc.c:1257  */
-      { delete ((*yyvaluep).func_sig); }
-#line 1802 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_func_type: /* func_type  */
+#line 266 "src/wast-parser.y"
+            { delete ((*yyvaluep).func_sig); }
+#line 2123 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 90: /* func_sig  */
-#line 241 "src/wast-parser.y" /* yacc.c:1257  */
-      { delete ((*yyvaluep).func_sig); }
-#line 1808 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_func_sig: /* func_sig  */
+#line 266 "src/wast-parser.y"
+            { delete ((*yyvaluep).func_sig); }
+#line 2129 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 91: /* func_sig_result  */
-#line 241 "src/wast-parser.y" /* yacc.c:1257  */
-      { delete ((*yyvaluep).func_sig); }
-#line 1814 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_func_sig_result: /* func_sig_result  */
+#line 266 "src/wast-parser.y"
+            { delete ((*yyvaluep).func_sig); }
+#line 2135 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 93: /* memory_sig  */
-#line 244 "src/wast-parser.y" /* yacc.c:1257  */
-      { delete ((*yyvaluep).memory); }
-#line 1820 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_memory_sig: /* memory_sig  */
+#line 269 "src/wast-parser.y"
+            { delete ((*yyvaluep).memory); }
+#line 2141 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 95: /* type_use  */
-#line 251 "src/wast-parser.y" /* yacc.c:1257  */
-      { delete ((*yyvaluep).var); }
-#line 1826 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_type_use: /* type_use  */
+#line 277 "src/wast-parser.y"
+            { delete ((*yyvaluep).var); }
+#line 2147 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 97: /* literal  */
-#line 230 "src/wast-parser.y" /* yacc.c:1257  */
-      { destroy_string_slice(&((*yyvaluep).literal).text); }
-#line 1832 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_literal: /* literal  */
+#line 255 "src/wast-parser.y"
+            { destroy_string_slice(&((*yyvaluep).literal).text); }
+#line 2153 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 98: /* var  */
-#line 251 "src/wast-parser.y" /* yacc.c:1257  */
-      { delete ((*yyvaluep).var); }
-#line 1838 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_simd_lane_list: /* simd_lane_list  */
+#line 275 "src/wast-parser.y"
+            { destroy_simd_lane_vector(((*yyvaluep).simd_lanes)); }
+#line 2159 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 99: /* var_list  */
-#line 252 "src/wast-parser.y" /* yacc.c:1257  */
-      { delete ((*yyvaluep).vars); }
-#line 1844 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_var: /* var  */
+#line 277 "src/wast-parser.y"
+            { delete ((*yyvaluep).var); }
+#line 2165 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 100: /* bind_var_opt  */
-#line 248 "src/wast-parser.y" /* yacc.c:1257  */
-      { delete ((*yyvaluep).string); }
-#line 1850 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_var_list: /* var_list  */
+#line 278 "src/wast-parser.y"
+            { delete ((*yyvaluep).vars); }
+#line 2171 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 101: /* bind_var  */
-#line 248 "src/wast-parser.y" /* yacc.c:1257  */
-      { delete ((*yyvaluep).string); }
-#line 1856 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_bind_var_opt: /* bind_var_opt  */
+#line 273 "src/wast-parser.y"
+            { delete ((*yyvaluep).string); }
+#line 2177 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 102: /* labeling_opt  */
-#line 248 "src/wast-parser.y" /* yacc.c:1257  */
-      { delete ((*yyvaluep).string); }
-#line 1862 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_bind_var: /* bind_var  */
+#line 273 "src/wast-parser.y"
+            { delete ((*yyvaluep).string); }
+#line 2183 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 105: /* instr  */
-#line 238 "src/wast-parser.y" /* yacc.c:1257  */
-      { delete ((*yyvaluep).expr_list); }
-#line 1868 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_labeling_opt: /* labeling_opt  */
+#line 273 "src/wast-parser.y"
+            { delete ((*yyvaluep).string); }
+#line 2189 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 106: /* plain_instr  */
-#line 237 "src/wast-parser.y" /* yacc.c:1257  */
-      { delete ((*yyvaluep).expr); }
-#line 1874 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_instr: /* instr  */
+#line 263 "src/wast-parser.y"
+            { delete ((*yyvaluep).expr_list); }
+#line 2195 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 107: /* block_instr  */
-#line 237 "src/wast-parser.y" /* yacc.c:1257  */
-      { delete ((*yyvaluep).expr); }
-#line 1880 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_plain_instr: /* plain_instr  */
+#line 262 "src/wast-parser.y"
+            { delete ((*yyvaluep).expr); }
+#line 2201 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 108: /* block_sig  */
-#line 250 "src/wast-parser.y" /* yacc.c:1257  */
-      { delete ((*yyvaluep).types); }
-#line 1886 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_block_instr: /* block_instr  */
+#line 262 "src/wast-parser.y"
+            { delete ((*yyvaluep).expr); }
+#line 2207 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 109: /* block  */
-#line 232 "src/wast-parser.y" /* yacc.c:1257  */
-      { delete ((*yyvaluep).block); }
-#line 1892 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_block_sig: /* block_sig  */
+#line 276 "src/wast-parser.y"
+            { delete ((*yyvaluep).types); }
+#line 2213 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 114: /* expr  */
-#line 238 "src/wast-parser.y" /* yacc.c:1257  */
-      { delete ((*yyvaluep).expr_list); }
-#line 1898 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_block: /* block  */
+#line 257 "src/wast-parser.y"
+            { delete ((*yyvaluep).block); }
+#line 2219 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 115: /* expr1  */
-#line 238 "src/wast-parser.y" /* yacc.c:1257  */
-      { delete ((*yyvaluep).expr_list); }
-#line 1904 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_expr: /* expr  */
+#line 263 "src/wast-parser.y"
+            { delete ((*yyvaluep).expr_list); }
+#line 2225 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 119: /* if_block  */
-#line 238 "src/wast-parser.y" /* yacc.c:1257  */
-      { delete ((*yyvaluep).expr_list); }
-#line 1910 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_expr1: /* expr1  */
+#line 263 "src/wast-parser.y"
+            { delete ((*yyvaluep).expr_list); }
+#line 2231 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 120: /* if_  */
-#line 238 "src/wast-parser.y" /* yacc.c:1257  */
-      { delete ((*yyvaluep).expr_list); }
-#line 1916 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_if_block: /* if_block  */
+#line 263 "src/wast-parser.y"
+            { delete ((*yyvaluep).expr_list); }
+#line 2237 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 124: /* instr_list  */
-#line 238 "src/wast-parser.y" /* yacc.c:1257  */
-      { delete ((*yyvaluep).expr_list); }
-#line 1922 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_if_: /* if_  */
+#line 263 "src/wast-parser.y"
+            { delete ((*yyvaluep).expr_list); }
+#line 2243 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 125: /* expr_list  */
-#line 238 "src/wast-parser.y" /* yacc.c:1257  */
-      { delete ((*yyvaluep).expr_list); }
-#line 1928 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_instr_list: /* instr_list  */
+#line 263 "src/wast-parser.y"
+            { delete ((*yyvaluep).expr_list); }
+#line 2249 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 126: /* const_expr  */
-#line 238 "src/wast-parser.y" /* yacc.c:1257  */
-      { delete ((*yyvaluep).expr_list); }
-#line 1934 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_expr_list: /* expr_list  */
+#line 263 "src/wast-parser.y"
+            { delete ((*yyvaluep).expr_list); }
+#line 2255 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 129: /* func  */
-#line 239 "src/wast-parser.y" /* yacc.c:1257  */
-      { delete ((*yyvaluep).module_fields); }
-#line 1940 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_const_expr: /* const_expr  */
+#line 263 "src/wast-parser.y"
+            { delete ((*yyvaluep).expr_list); }
+#line 2261 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 130: /* func_fields  */
-#line 239 "src/wast-parser.y" /* yacc.c:1257  */
-      { delete ((*yyvaluep).module_fields); }
-#line 1946 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_func: /* func  */
+#line 264 "src/wast-parser.y"
+            { delete ((*yyvaluep).module_fields); }
+#line 2267 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 131: /* func_fields_import  */
-#line 240 "src/wast-parser.y" /* yacc.c:1257  */
-      { delete ((*yyvaluep).func); }
-#line 1952 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_func_fields: /* func_fields  */
+#line 264 "src/wast-parser.y"
+            { delete ((*yyvaluep).module_fields); }
+#line 2273 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 132: /* func_fields_import1  */
-#line 240 "src/wast-parser.y" /* yacc.c:1257  */
-      { delete ((*yyvaluep).func); }
-#line 1958 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_func_fields_import: /* func_fields_import  */
+#line 265 "src/wast-parser.y"
+            { delete ((*yyvaluep).func); }
+#line 2279 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 133: /* func_fields_import_result  */
-#line 240 "src/wast-parser.y" /* yacc.c:1257  */
-      { delete ((*yyvaluep).func); }
-#line 1964 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_func_fields_import1: /* func_fields_import1  */
+#line 265 "src/wast-parser.y"
+            { delete ((*yyvaluep).func); }
+#line 2285 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 134: /* func_fields_body  */
-#line 240 "src/wast-parser.y" /* yacc.c:1257  */
-      { delete ((*yyvaluep).func); }
-#line 1970 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_func_fields_import_result: /* func_fields_import_result  */
+#line 265 "src/wast-parser.y"
+            { delete ((*yyvaluep).func); }
+#line 2291 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 135: /* func_fields_body1  */
-#line 240 "src/wast-parser.y" /* yacc.c:1257  */
-      { delete ((*yyvaluep).func); }
-#line 1976 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_func_fields_body: /* func_fields_body  */
+#line 265 "src/wast-parser.y"
+            { delete ((*yyvaluep).func); }
+#line 2297 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 136: /* func_result_body  */
-#line 240 "src/wast-parser.y" /* yacc.c:1257  */
-      { delete ((*yyvaluep).func); }
-#line 1982 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_func_fields_body1: /* func_fields_body1  */
+#line 265 "src/wast-parser.y"
+            { delete ((*yyvaluep).func); }
+#line 2303 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 137: /* func_body  */
-#line 240 "src/wast-parser.y" /* yacc.c:1257  */
-      { delete ((*yyvaluep).func); }
-#line 1988 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_func_result_body: /* func_result_body  */
+#line 265 "src/wast-parser.y"
+            { delete ((*yyvaluep).func); }
+#line 2309 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 138: /* func_body1  */
-#line 240 "src/wast-parser.y" /* yacc.c:1257  */
-      { delete ((*yyvaluep).func); }
-#line 1994 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_func_body: /* func_body  */
+#line 265 "src/wast-parser.y"
+            { delete ((*yyvaluep).func); }
+#line 2315 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 139: /* offset  */
-#line 238 "src/wast-parser.y" /* yacc.c:1257  */
-      { delete ((*yyvaluep).expr_list); }
-#line 2000 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_func_body1: /* func_body1  */
+#line 265 "src/wast-parser.y"
+            { delete ((*yyvaluep).func); }
+#line 2321 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 141: /* table  */
-#line 239 "src/wast-parser.y" /* yacc.c:1257  */
-      { delete ((*yyvaluep).module_fields); }
-#line 2006 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_offset: /* offset  */
+#line 263 "src/wast-parser.y"
+            { delete ((*yyvaluep).expr_list); }
+#line 2327 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 142: /* table_fields  */
-#line 239 "src/wast-parser.y" /* yacc.c:1257  */
-      { delete ((*yyvaluep).module_fields); }
-#line 2012 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_table: /* table  */
+#line 264 "src/wast-parser.y"
+            { delete ((*yyvaluep).module_fields); }
+#line 2333 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 144: /* memory  */
-#line 239 "src/wast-parser.y" /* yacc.c:1257  */
-      { delete ((*yyvaluep).module_fields); }
-#line 2018 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_table_fields: /* table_fields  */
+#line 264 "src/wast-parser.y"
+            { delete ((*yyvaluep).module_fields); }
+#line 2339 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 145: /* memory_fields  */
-#line 239 "src/wast-parser.y" /* yacc.c:1257  */
-      { delete ((*yyvaluep).module_fields); }
-#line 2024 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_memory: /* memory  */
+#line 264 "src/wast-parser.y"
+            { delete ((*yyvaluep).module_fields); }
+#line 2345 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 146: /* global  */
-#line 239 "src/wast-parser.y" /* yacc.c:1257  */
-      { delete ((*yyvaluep).module_fields); }
-#line 2030 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_memory_fields: /* memory_fields  */
+#line 264 "src/wast-parser.y"
+            { delete ((*yyvaluep).module_fields); }
+#line 2351 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 147: /* global_fields  */
-#line 239 "src/wast-parser.y" /* yacc.c:1257  */
-      { delete ((*yyvaluep).module_fields); }
-#line 2036 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_global: /* global  */
+#line 264 "src/wast-parser.y"
+            { delete ((*yyvaluep).module_fields); }
+#line 2357 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 148: /* import_desc  */
-#line 243 "src/wast-parser.y" /* yacc.c:1257  */
-      { delete ((*yyvaluep).import); }
-#line 2042 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_global_fields: /* global_fields  */
+#line 264 "src/wast-parser.y"
+            { delete ((*yyvaluep).module_fields); }
+#line 2363 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 150: /* inline_import  */
-#line 243 "src/wast-parser.y" /* yacc.c:1257  */
-      { delete ((*yyvaluep).import); }
-#line 2048 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_import_desc: /* import_desc  */
+#line 268 "src/wast-parser.y"
+            { delete ((*yyvaluep).import); }
+#line 2369 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 151: /* export_desc  */
-#line 236 "src/wast-parser.y" /* yacc.c:1257  */
-      { delete ((*yyvaluep).export_); }
-#line 2054 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_inline_import: /* inline_import  */
+#line 268 "src/wast-parser.y"
+            { delete ((*yyvaluep).import); }
+#line 2375 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 153: /* inline_export  */
-#line 236 "src/wast-parser.y" /* yacc.c:1257  */
-      { delete ((*yyvaluep).export_); }
-#line 2060 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_export_desc: /* export_desc  */
+#line 261 "src/wast-parser.y"
+            { delete ((*yyvaluep).export_); }
+#line 2381 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 156: /* module_field  */
-#line 239 "src/wast-parser.y" /* yacc.c:1257  */
-      { delete ((*yyvaluep).module_fields); }
-#line 2066 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_inline_export: /* inline_export  */
+#line 261 "src/wast-parser.y"
+            { delete ((*yyvaluep).export_); }
+#line 2387 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 157: /* module_fields_opt  */
-#line 245 "src/wast-parser.y" /* yacc.c:1257  */
-      { delete ((*yyvaluep).module); }
-#line 2072 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_module_field: /* module_field  */
+#line 264 "src/wast-parser.y"
+            { delete ((*yyvaluep).module_fields); }
+#line 2393 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 158: /* module_fields  */
-#line 245 "src/wast-parser.y" /* yacc.c:1257  */
-      { delete ((*yyvaluep).module); }
-#line 2078 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_module_fields_opt: /* module_fields_opt  */
+#line 270 "src/wast-parser.y"
+            { delete ((*yyvaluep).module); }
+#line 2399 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 159: /* module  */
-#line 245 "src/wast-parser.y" /* yacc.c:1257  */
-      { delete ((*yyvaluep).module); }
-#line 2084 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_module_fields: /* module_fields  */
+#line 270 "src/wast-parser.y"
+            { delete ((*yyvaluep).module); }
+#line 2405 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 160: /* inline_module  */
-#line 245 "src/wast-parser.y" /* yacc.c:1257  */
-      { delete ((*yyvaluep).module); }
-#line 2090 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_module: /* module  */
+#line 270 "src/wast-parser.y"
+            { delete ((*yyvaluep).module); }
+#line 2411 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 161: /* script_var_opt  */
-#line 251 "src/wast-parser.y" /* yacc.c:1257  */
-      { delete ((*yyvaluep).var); }
-#line 2096 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_inline_module: /* inline_module  */
+#line 270 "src/wast-parser.y"
+            { delete ((*yyvaluep).module); }
+#line 2417 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 162: /* script_module  */
-#line 246 "src/wast-parser.y" /* yacc.c:1257  */
-      { delete ((*yyvaluep).script_module); }
-#line 2102 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_script_var_opt: /* script_var_opt  */
+#line 277 "src/wast-parser.y"
+            { delete ((*yyvaluep).var); }
+#line 2423 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 163: /* action  */
-#line 231 "src/wast-parser.y" /* yacc.c:1257  */
-      { delete ((*yyvaluep).action); }
-#line 2108 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_script_module: /* script_module  */
+#line 271 "src/wast-parser.y"
+            { delete ((*yyvaluep).script_module); }
+#line 2429 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 164: /* assertion  */
-#line 233 "src/wast-parser.y" /* yacc.c:1257  */
-      { delete ((*yyvaluep).command); }
-#line 2114 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_action: /* action  */
+#line 256 "src/wast-parser.y"
+            { delete ((*yyvaluep).action); }
+#line 2435 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 165: /* cmd  */
-#line 233 "src/wast-parser.y" /* yacc.c:1257  */
-      { delete ((*yyvaluep).command); }
-#line 2120 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_assertion: /* assertion  */
+#line 258 "src/wast-parser.y"
+            { delete ((*yyvaluep).command); }
+#line 2441 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 166: /* cmd_list  */
-#line 234 "src/wast-parser.y" /* yacc.c:1257  */
-      { delete ((*yyvaluep).commands); }
-#line 2126 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_cmd: /* cmd  */
+#line 258 "src/wast-parser.y"
+            { delete ((*yyvaluep).command); }
+#line 2447 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 168: /* const_list  */
-#line 235 "src/wast-parser.y" /* yacc.c:1257  */
-      { delete ((*yyvaluep).consts); }
-#line 2132 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_cmd_list: /* cmd_list  */
+#line 259 "src/wast-parser.y"
+            { delete ((*yyvaluep).commands); }
+#line 2453 "src/prebuilt/wast-parser-gen.cc"
         break;
 
-    case 169: /* script  */
-#line 247 "src/wast-parser.y" /* yacc.c:1257  */
-      { delete ((*yyvaluep).script); }
-#line 2138 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1257  */
+    case YYSYMBOL_const_list: /* const_list  */
+#line 260 "src/wast-parser.y"
+            { delete ((*yyvaluep).consts); }
+#line 2459 "src/prebuilt/wast-parser-gen.cc"
         break;
 
+    case YYSYMBOL_script: /* script  */
+#line 272 "src/wast-parser.y"
+            { delete ((*yyvaluep).script); }
+#line 2465 "src/prebuilt/wast-parser-gen.cc"
+        break;
 
       default:
         break;
@@ -2147,6 +2473,8 @@ yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep, YYLTYPE *yylocatio
 
 
 
+
+
 /*----------.
 | yyparse.  |
 `----------*/
@@ -2154,7 +2482,7 @@ yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep, YYLTYPE *yylocatio
 int
 yyparse (::wabt::WastLexer* lexer, ::wabt::WastParser* parser)
 {
-/* The lookahead symbol.  */
+/* Lookahead token kind.  */
 int yychar;
 
 
@@ -2173,55 +2501,50 @@ static YYLTYPE yyloc_default
 YYLTYPE yylloc = yyloc_default;
 
     /* Number of syntax errors so far.  */
-    int yynerrs;
+    int yynerrs = 0;
 
-    int yystate;
+    yy_state_fast_t yystate = 0;
     /* Number of tokens to shift before error messages enabled.  */
-    int yyerrstatus;
+    int yyerrstatus = 0;
 
-    /* The stacks and their tools:
-       'yyss': related to states.
-       'yyvs': related to semantic values.
-       'yyls': related to locations.
-
-       Refer to the stacks through separate pointers, to allow yyoverflow
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
        to reallocate them elsewhere.  */
 
-    /* The state stack.  */
-    yytype_int16 yyssa[YYINITDEPTH];
-    yytype_int16 *yyss;
-    yytype_int16 *yyssp;
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
+
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
 
-    /* The semantic value stack.  */
+    /* The semantic value stack: array, bottom, top.  */
     YYSTYPE yyvsa[YYINITDEPTH];
-    YYSTYPE *yyvs;
-    YYSTYPE *yyvsp;
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
 
-    /* The location stack.  */
+    /* The location stack: array, bottom, top.  */
     YYLTYPE yylsa[YYINITDEPTH];
-    YYLTYPE *yyls;
-    YYLTYPE *yylsp;
-
-    /* The locations where the error started and ended.  */
-    YYLTYPE yyerror_range[3];
-
-    YYSIZE_T yystacksize;
+    YYLTYPE *yyls = yylsa;
+    YYLTYPE *yylsp = yyls;
 
   int yyn;
+  /* The return value of yyparse.  */
   int yyresult;
-  /* Lookahead token as an internal (translated) token number.  */
-  int yytoken = 0;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
   /* The variables used to return semantic value and location from the
      action routines.  */
   YYSTYPE yyval;
   YYLTYPE yyloc;
 
-#if YYERROR_VERBOSE
+  /* The locations where the error started and ended.  */
+  YYLTYPE yyerror_range[3];
+
   /* Buffer for error messages, and its allocated size.  */
   char yymsgbuf[128];
   char *yymsg = yymsgbuf;
-  YYSIZE_T yymsg_alloc = sizeof yymsgbuf;
-#endif
+  YYPTRDIFF_T yymsg_alloc = sizeof yymsgbuf;
 
 #define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N), yylsp -= (N))
 
@@ -2229,43 +2552,49 @@ YYLTYPE yylloc = yyloc_default;
      Keep to zero when no symbol should be popped.  */
   int yylen = 0;
 
-  yyssp = yyss = yyssa;
-  yyvsp = yyvs = yyvsa;
-  yylsp = yyls = yylsa;
-  yystacksize = YYINITDEPTH;
-
   YYDPRINTF ((stderr, "Starting parse\n"));
 
-  yystate = 0;
-  yyerrstatus = 0;
-  yynerrs = 0;
-  yychar = YYEMPTY; /* Cause a token to be read.  */
+  yychar = WABT_TOKEN_TYPE_WABT_WAST_PARSER_EMPTY; /* Cause a token to be read.  */
+
   yylsp[0] = yylloc;
   goto yysetstate;
 
+
 /*------------------------------------------------------------.
-| yynewstate -- Push a new state, which is found in yystate.  |
+| yynewstate -- push a new state, which is found in yystate.  |
 `------------------------------------------------------------*/
- yynewstate:
+yynewstate:
   /* In all cases, when you get here, the value and location stacks
      have just been pushed.  So pushing a state here evens the stacks.  */
   yyssp++;
 
- yysetstate:
-  *yyssp = yystate;
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
 
   if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
     {
       /* Get the current used size of the three stacks, in elements.  */
-      YYSIZE_T yysize = yyssp - yyss + 1;
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
 
-#ifdef yyoverflow
+# if defined yyoverflow
       {
         /* Give user a chance to reallocate the stack.  Use copies of
            these so that the &'s don't force the real ones into
            memory.  */
+        yy_state_t *yyss1 = yyss;
         YYSTYPE *yyvs1 = yyvs;
-        yytype_int16 *yyss1 = yyss;
         YYLTYPE *yyls1 = yyls;
 
         /* Each stack pointer address is followed by the size of the
@@ -2273,32 +2602,29 @@ YYLTYPE yylloc = yyloc_default;
            conditional around just the two extra args, but that might
            be undefined if yyoverflow is a macro.  */
         yyoverflow (YY_("memory exhausted"),
-                    &yyss1, yysize * sizeof (*yyssp),
-                    &yyvs1, yysize * sizeof (*yyvsp),
-                    &yyls1, yysize * sizeof (*yylsp),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yyls1, yysize * YYSIZEOF (*yylsp),
                     &yystacksize);
-
-        yyls = yyls1;
         yyss = yyss1;
         yyvs = yyvs1;
+        yyls = yyls1;
       }
-#else /* no yyoverflow */
-# ifndef YYSTACK_RELOCATE
-      goto yyexhaustedlab;
-# else
+# else /* defined YYSTACK_RELOCATE */
       /* Extend the stack our own way.  */
       if (YYMAXDEPTH <= yystacksize)
-        goto yyexhaustedlab;
+        YYNOMEM;
       yystacksize *= 2;
       if (YYMAXDEPTH < yystacksize)
         yystacksize = YYMAXDEPTH;
 
       {
-        yytype_int16 *yyss1 = yyss;
+        yy_state_t *yyss1 = yyss;
         union yyalloc *yyptr =
-          (union yyalloc *) YYSTACK_ALLOC (YYSTACK_BYTES (yystacksize));
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
         if (! yyptr)
-          goto yyexhaustedlab;
+          YYNOMEM;
         YYSTACK_RELOCATE (yyss_alloc, yyss);
         YYSTACK_RELOCATE (yyvs_alloc, yyvs);
         YYSTACK_RELOCATE (yyls_alloc, yyls);
@@ -2307,31 +2633,32 @@ YYLTYPE yylloc = yyloc_default;
           YYSTACK_FREE (yyss1);
       }
 # endif
-#endif /* no yyoverflow */
 
       yyssp = yyss + yysize - 1;
       yyvsp = yyvs + yysize - 1;
       yylsp = yyls + yysize - 1;
 
-      YYDPRINTF ((stderr, "Stack size increased to %lu\n",
-                  (unsigned long int) yystacksize));
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
 
       if (yyss + yystacksize - 1 <= yyssp)
         YYABORT;
     }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
 
-  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
 
   if (yystate == YYFINAL)
     YYACCEPT;
 
   goto yybackup;
 
+
 /*-----------.
 | yybackup.  |
 `-----------*/
 yybackup:
-
   /* Do appropriate processing given the current state.  Read a
      lookahead token if we need one and don't already have one.  */
 
@@ -2342,18 +2669,30 @@ yybackup:
 
   /* Not known => get a lookahead token if don't already have one.  */
 
-  /* YYCHAR is either YYEMPTY or YYEOF or a valid lookahead symbol.  */
-  if (yychar == YYEMPTY)
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == WABT_TOKEN_TYPE_WABT_WAST_PARSER_EMPTY)
     {
-      YYDPRINTF ((stderr, "Reading a token: "));
+      YYDPRINTF ((stderr, "Reading a token\n"));
       yychar = yylex (&yylval, &yylloc);
     }
 
-  if (yychar <= YYEOF)
+  if (yychar <= WABT_TOKEN_TYPE_EOF)
     {
-      yychar = yytoken = YYEOF;
+      yychar = WABT_TOKEN_TYPE_EOF;
+      yytoken = YYSYMBOL_YYEOF;
       YYDPRINTF ((stderr, "Now at end of input.\n"));
     }
+  else if (yychar == WABT_TOKEN_TYPE_WABT_WAST_PARSER_error)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = WABT_TOKEN_TYPE_WABT_WAST_PARSER_UNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      yyerror_range[1] = yylloc;
+      goto yyerrlab1;
+    }
   else
     {
       yytoken = YYTRANSLATE (yychar);
@@ -2381,15 +2720,14 @@ yybackup:
 
   /* Shift the lookahead token.  */
   YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
-
-  /* Discard the shifted token.  */
-  yychar = YYEMPTY;
-
   yystate = yyn;
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
   YY_IGNORE_MAYBE_UNINITIALIZED_END
   *++yylsp = yylloc;
+
+  /* Discard the shifted token.  */
+  yychar = WABT_TOKEN_TYPE_WABT_WAST_PARSER_EMPTY;
   goto yynewstate;
 
 
@@ -2404,7 +2742,7 @@ yydefault:
 
 
 /*-----------------------------.
-| yyreduce -- Do a reduction.  |
+| yyreduce -- do a reduction.  |
 `-----------------------------*/
 yyreduce:
   /* yyn is the number of a rule to reduce with.  */
@@ -2420,25 +2758,26 @@ yyreduce:
      GCC warning that YYVAL may be used uninitialized.  */
   yyval = yyvsp[1-yylen];
 
-  /* Default location.  */
+  /* Default location. */
   YYLLOC_DEFAULT (yyloc, (yylsp - yylen), yylen);
+  yyerror_range[1] = yyloc;
   YY_REDUCE_PRINT (yyn);
   switch (yyn)
     {
-        case 2:
-#line 265 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 2: /* text_list: TEXT  */
+#line 291 "src/wast-parser.y"
+         {
       TextListNode* node = new TextListNode();
       DUPTEXT(node->text, (yyvsp[0].text));
       node->next = nullptr;
       (yyval.text_list).first = (yyval.text_list).last = node;
     }
-#line 2437 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 2776 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 3:
-#line 271 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 3: /* text_list: text_list TEXT  */
+#line 297 "src/wast-parser.y"
+                   {
       (yyval.text_list) = (yyvsp[-1].text_list);
       TextListNode* node = new TextListNode();
       DUPTEXT(node->text, (yyvsp[0].text));
@@ -2446,157 +2785,184 @@ yyreduce:
       (yyval.text_list).last->next = node;
       (yyval.text_list).last = node;
     }
-#line 2450 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 2789 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 4:
-#line 281 "src/wast-parser.y" /* yacc.c:1646  */
-    { (yyval.text_list).first = (yyval.text_list).last = nullptr; }
-#line 2456 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+  case 4: /* text_list_opt: %empty  */
+#line 307 "src/wast-parser.y"
+                { (yyval.text_list).first = (yyval.text_list).last = nullptr; }
+#line 2795 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 6:
-#line 286 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 6: /* quoted_text: TEXT  */
+#line 312 "src/wast-parser.y"
+         {
       char* data = new char[(yyvsp[0].text).length + 1];
       size_t actual_size = CopyStringContents(&(yyvsp[0].text), data);
       (yyval.text).start = data;
       (yyval.text).length = actual_size;
     }
-#line 2467 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 2806 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 7:
-#line 297 "src/wast-parser.y" /* yacc.c:1646  */
-    { (yyval.types) = new TypeVector(); }
-#line 2473 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+  case 7: /* value_type: VALUE_TYPE  */
+#line 323 "src/wast-parser.y"
+               {
+      if ((yyvsp[0].type) == Type::V128 && !parser->options->allow_future_simd) {
+        wast_parser_error(&(yylsp[0]), lexer, parser, "value type not allowed: %s",
+                          get_type_name((yyvsp[0].type)));
+      }
+      (yyval.type) = (yyvsp[0].type);
+    }
+#line 2818 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 8:
-#line 298 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 8: /* value_type_list: %empty  */
+#line 332 "src/wast-parser.y"
+                { (yyval.types) = new TypeVector(); }
+#line 2824 "src/prebuilt/wast-parser-gen.cc"
+    break;
+
+  case 9: /* value_type_list: value_type_list value_type  */
+#line 333 "src/wast-parser.y"
+                               {
       (yyval.types) = (yyvsp[-1].types);
       (yyval.types)->push_back((yyvsp[0].type));
     }
-#line 2482 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 2833 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 9:
-#line 304 "src/wast-parser.y" /* yacc.c:1646  */
-    {}
-#line 2488 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+  case 10: /* elem_type: ANYFUNC  */
+#line 339 "src/wast-parser.y"
+            {}
+#line 2839 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 10:
-#line 307 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 11: /* global_type: value_type  */
+#line 342 "src/wast-parser.y"
+               {
       (yyval.global) = new Global();
       (yyval.global)->type = (yyvsp[0].type);
       (yyval.global)->mutable_ = false;
     }
-#line 2498 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 2849 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 11:
-#line 312 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 12: /* global_type: "(" MUT value_type ")"  */
+#line 347 "src/wast-parser.y"
+                             {
       (yyval.global) = new Global();
       (yyval.global)->type = (yyvsp[-1].type);
       (yyval.global)->mutable_ = true;
     }
-#line 2508 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 2859 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 12:
-#line 320 "src/wast-parser.y" /* yacc.c:1646  */
-    { (yyval.func_sig) = (yyvsp[-1].func_sig); }
-#line 2514 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+  case 13: /* func_type: "(" FUNC func_sig ")"  */
+#line 355 "src/wast-parser.y"
+                            { (yyval.func_sig) = (yyvsp[-1].func_sig); }
+#line 2865 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 14:
-#line 325 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 15: /* func_sig: "(" PARAM value_type_list ")" func_sig  */
+#line 360 "src/wast-parser.y"
+                                             {
       (yyval.func_sig) = (yyvsp[0].func_sig);
       (yyval.func_sig)->param_types.insert((yyval.func_sig)->param_types.begin(), (yyvsp[-2].types)->begin(), (yyvsp[-2].types)->end());
       delete (yyvsp[-2].types);
     }
-#line 2524 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 2875 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 15:
-#line 330 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 16: /* func_sig: "(" PARAM bind_var value_type ")" func_sig  */
+#line 365 "src/wast-parser.y"
+                                                 {
       (yyval.func_sig) = (yyvsp[0].func_sig);
       (yyval.func_sig)->param_types.insert((yyval.func_sig)->param_types.begin(), (yyvsp[-2].type));
       // Ignore bind_var.
       delete (yyvsp[-3].string);
     }
-#line 2535 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 2886 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 16:
-#line 339 "src/wast-parser.y" /* yacc.c:1646  */
-    { (yyval.func_sig) = new FuncSignature(); }
-#line 2541 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+  case 17: /* func_sig_result: %empty  */
+#line 374 "src/wast-parser.y"
+                { (yyval.func_sig) = new FuncSignature(); }
+#line 2892 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 17:
-#line 340 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 18: /* func_sig_result: "(" RESULT value_type_list ")" func_sig_result  */
+#line 375 "src/wast-parser.y"
+                                                     {
       (yyval.func_sig) = (yyvsp[0].func_sig);
       (yyval.func_sig)->result_types.insert((yyval.func_sig)->result_types.begin(), (yyvsp[-2].types)->begin(), (yyvsp[-2].types)->end());
       delete (yyvsp[-2].types);
     }
-#line 2551 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 2902 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 18:
-#line 348 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 19: /* table_sig: limits elem_type  */
+#line 383 "src/wast-parser.y"
+                     {
       (yyval.table) = new Table();
       (yyval.table)->elem_limits = (yyvsp[-1].limits);
     }
-#line 2560 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 2911 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 19:
-#line 354 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 20: /* memory_sig: limits  */
+#line 389 "src/wast-parser.y"
+           {
       (yyval.memory) = new Memory();
       (yyval.memory)->page_limits = (yyvsp[0].limits);
     }
-#line 2569 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 2920 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 20:
-#line 360 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 21: /* limits: nat  */
+#line 395 "src/wast-parser.y"
+        {
       (yyval.limits).has_max = false;
+      (yyval.limits).is_shared = false;
       (yyval.limits).initial = (yyvsp[0].u64);
       (yyval.limits).max = 0;
     }
-#line 2579 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 2931 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 21:
-#line 365 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 22: /* limits: nat nat  */
+#line 401 "src/wast-parser.y"
+            {
       (yyval.limits).has_max = true;
+      (yyval.limits).is_shared = false;
       (yyval.limits).initial = (yyvsp[-1].u64);
       (yyval.limits).max = (yyvsp[0].u64);
     }
-#line 2589 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 2942 "src/prebuilt/wast-parser-gen.cc"
+    break;
+
+  case 23: /* limits: nat nat SHARED  */
+#line 407 "src/wast-parser.y"
+                   {
+      if (!parser->options->allow_future_threads)
+        wast_parser_error(&(yylsp[0]), lexer, parser, "shared memory not allowed");
+      (yyval.limits).has_max = true;
+      (yyval.limits).is_shared = true;
+      (yyval.limits).initial = (yyvsp[-2].u64);
+      (yyval.limits).max = (yyvsp[-1].u64);
+    }
+#line 2955 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 22:
-#line 372 "src/wast-parser.y" /* yacc.c:1646  */
-    { (yyval.var) = (yyvsp[-1].var); }
-#line 2595 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+  case 24: /* type_use: "(" TYPE var ")"  */
+#line 417 "src/wast-parser.y"
+                       { (yyval.var) = (yyvsp[-1].var); }
+#line 2961 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 23:
-#line 378 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 25: /* nat: NAT  */
+#line 423 "src/wast-parser.y"
+        {
       if (Failed(parse_uint64((yyvsp[0].literal).text.start,
                               (yyvsp[0].literal).text.start + (yyvsp[0].literal).text.length, &(yyval.u64)))) {
         wast_parser_error(&(yylsp[0]), lexer, parser,
@@ -2604,95 +2970,146 @@ yyreduce:
                           WABT_PRINTF_STRING_SLICE_ARG((yyvsp[0].literal).text));
       }
     }
-#line 2608 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 2974 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 24:
-#line 389 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 26: /* literal: NAT  */
+#line 434 "src/wast-parser.y"
+        {
       (yyval.literal).type = (yyvsp[0].literal).type;
       DUPTEXT((yyval.literal).text, (yyvsp[0].literal).text);
     }
-#line 2617 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 2983 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 25:
-#line 393 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 27: /* literal: INT  */
+#line 438 "src/wast-parser.y"
+        {
       (yyval.literal).type = (yyvsp[0].literal).type;
       DUPTEXT((yyval.literal).text, (yyvsp[0].literal).text);
     }
-#line 2626 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 2992 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 26:
-#line 397 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 28: /* literal: FLOAT  */
+#line 442 "src/wast-parser.y"
+          {
       (yyval.literal).type = (yyvsp[0].literal).type;
       DUPTEXT((yyval.literal).text, (yyvsp[0].literal).text);
     }
-#line 2635 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3001 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 27:
-#line 404 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 29: /* simd_shape: I8X16  */
+#line 449 "src/wast-parser.y"
+          { (yyval.simd_shape) = SimdShape::I8X16; }
+#line 3007 "src/prebuilt/wast-parser-gen.cc"
+    break;
+
+  case 30: /* simd_shape: I16X8  */
+#line 450 "src/wast-parser.y"
+          { (yyval.simd_shape) = SimdShape::I16X8; }
+#line 3013 "src/prebuilt/wast-parser-gen.cc"
+    break;
+
+  case 31: /* simd_shape: I32X4  */
+#line 451 "src/wast-parser.y"
+          { (yyval.simd_shape) = SimdShape::I32X4; }
+#line 3019 "src/prebuilt/wast-parser-gen.cc"
+    break;
+
+  case 32: /* simd_shape: I64X2  */
+#line 452 "src/wast-parser.y"
+          { (yyval.simd_shape) = SimdShape::I64X2; }
+#line 3025 "src/prebuilt/wast-parser-gen.cc"
+    break;
+
+  case 33: /* simd_shape: F32X4  */
+#line 453 "src/wast-parser.y"
+          { (yyval.simd_shape) = SimdShape::F32X4; }
+#line 3031 "src/prebuilt/wast-parser-gen.cc"
+    break;
+
+  case 34: /* simd_shape: F64X2  */
+#line 454 "src/wast-parser.y"
+          { (yyval.simd_shape) = SimdShape::F64X2; }
+#line 3037 "src/prebuilt/wast-parser-gen.cc"
+    break;
+
+  case 35: /* simd_lane_list: %empty  */
+#line 457 "src/wast-parser.y"
+                { (yyval.simd_lanes) = new SimdLaneVector(); }
+#line 3043 "src/prebuilt/wast-parser-gen.cc"
+    break;
+
+  case 36: /* simd_lane_list: simd_lane_list literal  */
+#line 458 "src/wast-parser.y"
+                           {
+      (yyval.simd_lanes) = (yyvsp[-1].simd_lanes);
+      (yyval.simd_lanes)->push_back(SimdLane{(yyvsp[0].literal), (yylsp[0])});
+    }
+#line 3052 "src/prebuilt/wast-parser-gen.cc"
+    break;
+
+  case 37: /* var: nat  */
+#line 465 "src/wast-parser.y"
+        {
       (yyval.var) = new Var((yyvsp[0].u64), (yylsp[0]));
     }
-#line 2643 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3060 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 28:
-#line 407 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 38: /* var: VAR  */
+#line 468 "src/wast-parser.y"
+        {
       (yyval.var) = new Var(string_view((yyvsp[0].text).start, (yyvsp[0].text).length), (yylsp[0]));
     }
-#line 2651 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3068 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 29:
-#line 412 "src/wast-parser.y" /* yacc.c:1646  */
-    { (yyval.vars) = new VarVector(); }
-#line 2657 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+  case 39: /* var_list: %empty  */
+#line 473 "src/wast-parser.y"
+                { (yyval.vars) = new VarVector(); }
+#line 3074 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 30:
-#line 413 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 40: /* var_list: var_list var  */
+#line 474 "src/wast-parser.y"
+                 {
       (yyval.vars) = (yyvsp[-1].vars);
       (yyval.vars)->emplace_back(std::move(*(yyvsp[0].var)));
       delete (yyvsp[0].var);
     }
-#line 2667 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3084 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 31:
-#line 420 "src/wast-parser.y" /* yacc.c:1646  */
-    { (yyval.string) = new std::string(); }
-#line 2673 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+  case 41: /* bind_var_opt: %empty  */
+#line 481 "src/wast-parser.y"
+                { (yyval.string) = new std::string(); }
+#line 3090 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 33:
-#line 424 "src/wast-parser.y" /* yacc.c:1646  */
-    { (yyval.string) = new std::string(string_slice_to_string((yyvsp[0].text))); }
-#line 2679 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+  case 43: /* bind_var: VAR  */
+#line 485 "src/wast-parser.y"
+        { (yyval.string) = new std::string(string_slice_to_string((yyvsp[0].text))); }
+#line 3096 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 34:
-#line 428 "src/wast-parser.y" /* yacc.c:1646  */
-    { (yyval.string) = new std::string(); }
-#line 2685 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+  case 44: /* labeling_opt: %empty  */
+#line 489 "src/wast-parser.y"
+                          { (yyval.string) = new std::string(); }
+#line 3102 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 36:
-#line 433 "src/wast-parser.y" /* yacc.c:1646  */
-    { (yyval.u64) = 0; }
-#line 2691 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+  case 46: /* offset_opt: %empty  */
+#line 494 "src/wast-parser.y"
+                { (yyval.u64) = 0; }
+#line 3108 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 37:
-#line 434 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 47: /* offset_opt: OFFSET_EQ_NAT  */
+#line 495 "src/wast-parser.y"
+                  {
       uint64_t offset64;
       if (Failed(parse_int64((yyvsp[0].text).start, (yyvsp[0].text).start + (yyvsp[0].text).length, &offset64,
                              ParseIntType::SignedAndUnsigned))) {
@@ -2706,18 +3123,18 @@ yyreduce:
       }
       (yyval.u64) = static_cast<uint32_t>(offset64);
     }
-#line 2710 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3127 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 38:
-#line 450 "src/wast-parser.y" /* yacc.c:1646  */
-    { (yyval.u32) = USE_NATURAL_ALIGNMENT; }
-#line 2716 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+  case 48: /* align_opt: %empty  */
+#line 511 "src/wast-parser.y"
+                { (yyval.u32) = USE_NATURAL_ALIGNMENT; }
+#line 3133 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 39:
-#line 451 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 49: /* align_opt: ALIGN_EQ_NAT  */
+#line 512 "src/wast-parser.y"
+                 {
       if (Failed(parse_int32((yyvsp[0].text).start, (yyvsp[0].text).start + (yyvsp[0].text).length, &(yyval.u32),
                              ParseIntType::UnsignedOnly))) {
         wast_parser_error(&(yylsp[0]), lexer, parser,
@@ -2729,176 +3146,252 @@ yyreduce:
         wast_parser_error(&(yylsp[0]), lexer, parser, "alignment must be power-of-two");
       }
     }
-#line 2733 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3150 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 40:
-#line 466 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 50: /* instr: plain_instr  */
+#line 527 "src/wast-parser.y"
+                {
       (yyval.expr_list) = new ExprList((yyvsp[0].expr));
       (yyval.expr_list)->back().loc = (yylsp[0]);
     }
-#line 2742 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3159 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 41:
-#line 470 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 51: /* instr: block_instr  */
+#line 531 "src/wast-parser.y"
+                {
       (yyval.expr_list) = new ExprList((yyvsp[0].expr));
       (yyval.expr_list)->back().loc = (yylsp[0]);
     }
-#line 2751 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3168 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 43:
-#line 478 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 53: /* plain_instr: UNREACHABLE  */
+#line 539 "src/wast-parser.y"
+                {
       (yyval.expr) = new UnreachableExpr();
     }
-#line 2759 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3176 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 44:
-#line 481 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 54: /* plain_instr: NOP  */
+#line 542 "src/wast-parser.y"
+        {
       (yyval.expr) = new NopExpr();
     }
-#line 2767 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3184 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 45:
-#line 484 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 55: /* plain_instr: DROP  */
+#line 545 "src/wast-parser.y"
+         {
       (yyval.expr) = new DropExpr();
     }
-#line 2775 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3192 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 46:
-#line 487 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 56: /* plain_instr: SELECT  */
+#line 548 "src/wast-parser.y"
+           {
       (yyval.expr) = new SelectExpr();
     }
-#line 2783 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3200 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 47:
-#line 490 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 57: /* plain_instr: BR var  */
+#line 551 "src/wast-parser.y"
+           {
       (yyval.expr) = new BrExpr(std::move(*(yyvsp[0].var)));
       delete (yyvsp[0].var);
     }
-#line 2792 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3209 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 48:
-#line 494 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 58: /* plain_instr: BR_IF var  */
+#line 555 "src/wast-parser.y"
+              {
       (yyval.expr) = new BrIfExpr(std::move(*(yyvsp[0].var)));
       delete (yyvsp[0].var);
     }
-#line 2801 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3218 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 49:
-#line 498 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 59: /* plain_instr: BR_TABLE var_list var  */
+#line 559 "src/wast-parser.y"
+                          {
       (yyval.expr) = new BrTableExpr((yyvsp[-1].vars), std::move(*(yyvsp[0].var)));
       delete (yyvsp[0].var);
     }
-#line 2810 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3227 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 50:
-#line 502 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 60: /* plain_instr: RETURN  */
+#line 563 "src/wast-parser.y"
+           {
       (yyval.expr) = new ReturnExpr();
     }
-#line 2818 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3235 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 51:
-#line 505 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 61: /* plain_instr: CALL var  */
+#line 566 "src/wast-parser.y"
+             {
       (yyval.expr) = new CallExpr(std::move(*(yyvsp[0].var)));
       delete (yyvsp[0].var);
     }
-#line 2827 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3244 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 52:
-#line 509 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 62: /* plain_instr: CALL_INDIRECT var  */
+#line 570 "src/wast-parser.y"
+                      {
       (yyval.expr) = new CallIndirectExpr(std::move(*(yyvsp[0].var)));
       delete (yyvsp[0].var);
     }
-#line 2836 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3253 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 53:
-#line 513 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 63: /* plain_instr: RETURN_CALL var  */
+#line 574 "src/wast-parser.y"
+                    {
+      CHECK_ALLOW_OPCODE(&(yylsp[-1]), Opcode::ReturnCall);
+      (yyval.expr) = new ReturnCallExpr(std::move(*(yyvsp[0].var)));
+      delete (yyvsp[0].var);
+    }
+#line 3263 "src/prebuilt/wast-parser-gen.cc"
+    break;
+
+  case 64: /* plain_instr: RETURN_CALL_INDIRECT var  */
+#line 579 "src/wast-parser.y"
+                             {
+      CHECK_ALLOW_OPCODE(&(yylsp[-1]), Opcode::ReturnCallIndirect);
+      (yyval.expr) = new ReturnCallIndirectExpr(std::move(*(yyvsp[0].var)));
+      delete (yyvsp[0].var);
+    }
+#line 3273 "src/prebuilt/wast-parser-gen.cc"
+    break;
+
+  case 65: /* plain_instr: GET_LOCAL var  */
+#line 584 "src/wast-parser.y"
+                  {
       (yyval.expr) = new GetLocalExpr(std::move(*(yyvsp[0].var)));
       delete (yyvsp[0].var);
     }
-#line 2845 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3282 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 54:
-#line 517 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 66: /* plain_instr: SET_LOCAL var  */
+#line 588 "src/wast-parser.y"
+                  {
       (yyval.expr) = new SetLocalExpr(std::move(*(yyvsp[0].var)));
       delete (yyvsp[0].var);
     }
-#line 2854 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3291 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 55:
-#line 521 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 67: /* plain_instr: TEE_LOCAL var  */
+#line 592 "src/wast-parser.y"
+                  {
       (yyval.expr) = new TeeLocalExpr(std::move(*(yyvsp[0].var)));
       delete (yyvsp[0].var);
     }
-#line 2863 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3300 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 56:
-#line 525 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 68: /* plain_instr: GET_GLOBAL var  */
+#line 596 "src/wast-parser.y"
+                   {
       (yyval.expr) = new GetGlobalExpr(std::move(*(yyvsp[0].var)));
       delete (yyvsp[0].var);
     }
-#line 2872 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3309 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 57:
-#line 529 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 69: /* plain_instr: SET_GLOBAL var  */
+#line 600 "src/wast-parser.y"
+                   {
       (yyval.expr) = new SetGlobalExpr(std::move(*(yyvsp[0].var)));
       delete (yyvsp[0].var);
     }
-#line 2881 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3318 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 58:
-#line 533 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 70: /* plain_instr: LOAD offset_opt align_opt  */
+#line 604 "src/wast-parser.y"
+                              {
+      CHECK_ALLOW_OPCODE(&(yylsp[-2]), (yyvsp[-2].opcode));
       (yyval.expr) = new LoadExpr((yyvsp[-2].opcode), (yyvsp[0].u32), (yyvsp[-1].u64));
     }
-#line 2889 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3327 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 59:
-#line 536 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 71: /* plain_instr: STORE offset_opt align_opt  */
+#line 608 "src/wast-parser.y"
+                               {
+      CHECK_ALLOW_OPCODE(&(yylsp[-2]), (yyvsp[-2].opcode));
       (yyval.expr) = new StoreExpr((yyvsp[-2].opcode), (yyvsp[0].u32), (yyvsp[-1].u64));
     }
-#line 2897 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3336 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 60:
-#line 539 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 72: /* plain_instr: ATOMIC_LOAD offset_opt align_opt  */
+#line 612 "src/wast-parser.y"
+                                     {
+      CHECK_ALLOW_OPCODE(&(yylsp[-2]), (yyvsp[-2].opcode));
+      (yyval.expr) = new AtomicLoadExpr((yyvsp[-2].opcode), (yyvsp[0].u32), (yyvsp[-1].u64));
+    }
+#line 3345 "src/prebuilt/wast-parser-gen.cc"
+    break;
+
+  case 73: /* plain_instr: ATOMIC_STORE offset_opt align_opt  */
+#line 616 "src/wast-parser.y"
+                                      {
+      CHECK_ALLOW_OPCODE(&(yylsp[-2]), (yyvsp[-2].opcode));
+      (yyval.expr) = new AtomicStoreExpr((yyvsp[-2].opcode), (yyvsp[0].u32), (yyvsp[-1].u64));
+    }
+#line 3354 "src/prebuilt/wast-parser-gen.cc"
+    break;
+
+  case 74: /* plain_instr: ATOMIC_RMW offset_opt align_opt  */
+#line 620 "src/wast-parser.y"
+                                    {
+      CHECK_ALLOW_OPCODE(&(yylsp[-2]), (yyvsp[-2].opcode));
+      (yyval.expr) = new AtomicRmwExpr((yyvsp[-2].opcode), (yyvsp[0].u32), (yyvsp[-1].u64));
+    }
+#line 3363 "src/prebuilt/wast-parser-gen.cc"
+    break;
+
+  case 75: /* plain_instr: ATOMIC_RMW_CMPXCHG offset_opt align_opt  */
+#line 624 "src/wast-parser.y"
+                                            {
+      CHECK_ALLOW_OPCODE(&(yylsp[-2]), (yyvsp[-2].opcode));
+      (yyval.expr) = new AtomicRmwCmpxchgExpr((yyvsp[-2].opcode), (yyvsp[0].u32), (yyvsp[-1].u64));
+    }
+#line 3372 "src/prebuilt/wast-parser-gen.cc"
+    break;
+
+  case 76: /* plain_instr: ATOMIC_WAIT offset_opt align_opt  */
+#line 628 "src/wast-parser.y"
+                                     {
+      CHECK_ALLOW_OPCODE(&(yylsp[-2]), (yyvsp[-2].opcode));
+      (yyval.expr) = new AtomicWaitExpr((yyvsp[-2].opcode), (yyvsp[0].u32), (yyvsp[-1].u64));
+    }
+#line 3381 "src/prebuilt/wast-parser-gen.cc"
+    break;
+
+  case 77: /* plain_instr: ATOMIC_NOTIFY offset_opt align_opt  */
+#line 632 "src/wast-parser.y"
+                                       {
+      CHECK_ALLOW_OPCODE(&(yylsp[-2]), (yyvsp[-2].opcode));
+      (yyval.expr) = new AtomicNotifyExpr((yyvsp[-2].opcode), (yyvsp[0].u32), (yyvsp[-1].u64));
+    }
+#line 3390 "src/prebuilt/wast-parser-gen.cc"
+    break;
+
+  case 78: /* plain_instr: CONST literal  */
+#line 636 "src/wast-parser.y"
+                  {
       Const const_;
       const_.loc = (yylsp[-1]);
       if (Failed(parse_const((yyvsp[-1].type), (yyvsp[0].literal).type, (yyvsp[0].literal).text.start,
@@ -2910,114 +3403,176 @@ yyreduce:
       delete [] (yyvsp[0].literal).text.start;
       (yyval.expr) = new ConstExpr(const_);
     }
-#line 2914 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3407 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 61:
-#line 551 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 79: /* plain_instr: V128_CONST simd_shape simd_lane_list  */
+#line 648 "src/wast-parser.y"
+                                         {
+      CHECK_ALLOW_OPCODE(&(yylsp[-2]), Opcode::V128Const);
+      Const const_(Const::V128(), v128(), (yylsp[-2]));
+      size_t num_lanes = get_simd_shape_lane_count((yyvsp[-1].simd_shape));
+      if ((yyvsp[0].simd_lanes)->size() != num_lanes) {
+        wast_parser_error(&(yylsp[-1]), lexer, parser,
+                          "expected %" PRIzd " lanes, got %" PRIzd,
+                          num_lanes, (yyvsp[0].simd_lanes)->size());
+      } else {
+        for (size_t i = 0; i < num_lanes; ++i) {
+          SimdLane& lane = (*(yyvsp[0].simd_lanes))[i];
+          if (Failed(parse_simd_lane((yyvsp[-1].simd_shape), lane.literal, i,
+                                     &const_.v128_bits))) {
+            wast_parser_error(&lane.loc, lexer, parser,
+                              "invalid literal \"" PRIstringslice "\"",
+                              WABT_PRINTF_STRING_SLICE_ARG(lane.literal.text));
+          }
+        }
+      }
+      destroy_simd_lane_vector((yyvsp[0].simd_lanes));
+      (yyval.expr) = new ConstExpr(const_);
+    }
+#line 3434 "src/prebuilt/wast-parser-gen.cc"
+    break;
+
+  case 80: /* plain_instr: SIMD_LANE_OP nat  */
+#line 670 "src/wast-parser.y"
+                     {
+      CHECK_ALLOW_OPCODE(&(yylsp[-1]), (yyvsp[-1].opcode));
+      if ((yyvsp[0].u64) > UINT8_MAX) {
+        wast_parser_error(&(yylsp[0]), lexer, parser,
+                          "invalid lane index %" PRIu64, (yyvsp[0].u64));
+      }
+      (yyval.expr) = new SimdLaneOpExpr((yyvsp[-1].opcode), (yyvsp[0].u64));
+    }
+#line 3447 "src/prebuilt/wast-parser-gen.cc"
+    break;
+
+  case 81: /* plain_instr: UNARY  */
+#line 678 "src/wast-parser.y"
+          {
+      CHECK_ALLOW_OPCODE(&(yylsp[0]), (yyvsp[0].opcode));
       (yyval.expr) = new UnaryExpr((yyvsp[0].opcode));
     }
-#line 2922 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3456 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 62:
-#line 554 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 82: /* plain_instr: BINARY  */
+#line 682 "src/wast-parser.y"
+           {
+      CHECK_ALLOW_OPCODE(&(yylsp[0]), (yyvsp[0].opcode));
       (yyval.expr) = new BinaryExpr((yyvsp[0].opcode));
     }
-#line 2930 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3465 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 63:
-#line 557 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 83: /* plain_instr: COMPARE  */
+#line 686 "src/wast-parser.y"
+            {
+      CHECK_ALLOW_OPCODE(&(yylsp[0]), (yyvsp[0].opcode));
       (yyval.expr) = new CompareExpr((yyvsp[0].opcode));
     }
-#line 2938 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3474 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 64:
-#line 560 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 84: /* plain_instr: CONVERT  */
+#line 690 "src/wast-parser.y"
+            {
+      CHECK_ALLOW_OPCODE(&(yylsp[0]), (yyvsp[0].opcode));
       (yyval.expr) = new ConvertExpr((yyvsp[0].opcode));
     }
-#line 2946 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3483 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 65:
-#line 563 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 85: /* plain_instr: CURRENT_MEMORY  */
+#line 694 "src/wast-parser.y"
+                   {
       (yyval.expr) = new CurrentMemoryExpr();
     }
-#line 2954 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3491 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 66:
-#line 566 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 86: /* plain_instr: GROW_MEMORY  */
+#line 697 "src/wast-parser.y"
+                {
       (yyval.expr) = new GrowMemoryExpr();
     }
-#line 2962 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3499 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 67:
-#line 569 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 87: /* plain_instr: MEMORY_COPY  */
+#line 700 "src/wast-parser.y"
+                {
+      CHECK_ALLOW_OPCODE(&(yylsp[0]), Opcode::MemoryCopy);
+      (yyval.expr) = new MemoryCopyExpr();
+    }
+#line 3508 "src/prebuilt/wast-parser-gen.cc"
+    break;
+
+  case 88: /* plain_instr: MEMORY_FILL  */
+#line 704 "src/wast-parser.y"
+                {
+      CHECK_ALLOW_OPCODE(&(yylsp[0]), Opcode::MemoryFill);
+      (yyval.expr) = new MemoryFillExpr();
+    }
+#line 3517 "src/prebuilt/wast-parser-gen.cc"
+    break;
+
+  case 89: /* plain_instr: throw_check var  */
+#line 708 "src/wast-parser.y"
+                    {
       (yyval.expr) = new ThrowExpr(std::move(*(yyvsp[0].var)));
       delete (yyvsp[0].var);
     }
-#line 2971 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3526 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 68:
-#line 573 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 90: /* plain_instr: rethrow_check var  */
+#line 712 "src/wast-parser.y"
+                      {
       (yyval.expr) = new RethrowExpr(std::move(*(yyvsp[0].var)));
       delete (yyvsp[0].var);
     }
-#line 2980 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3535 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 69:
-#line 580 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 91: /* block_instr: BLOCK labeling_opt block END labeling_opt  */
+#line 719 "src/wast-parser.y"
+                                              {
       auto expr = new BlockExpr((yyvsp[-2].block));
       expr->block->label = std::move(*(yyvsp[-3].string));
       delete (yyvsp[-3].string);
       CHECK_END_LABEL((yylsp[0]), expr->block->label, (yyvsp[0].string));
       (yyval.expr) = expr;
     }
-#line 2992 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3547 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 70:
-#line 587 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 92: /* block_instr: LOOP labeling_opt block END labeling_opt  */
+#line 726 "src/wast-parser.y"
+                                             {
       auto expr = new LoopExpr((yyvsp[-2].block));
       expr->block->label = std::move(*(yyvsp[-3].string));
       delete (yyvsp[-3].string);
       CHECK_END_LABEL((yylsp[0]), expr->block->label, (yyvsp[0].string));
       (yyval.expr) = expr;
     }
-#line 3004 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3559 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 71:
-#line 594 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 93: /* block_instr: IF labeling_opt block END labeling_opt  */
+#line 733 "src/wast-parser.y"
+                                           {
       auto expr = new IfExpr((yyvsp[-2].block));
       expr->true_->label = std::move(*(yyvsp[-3].string));
       delete (yyvsp[-3].string);
       CHECK_END_LABEL((yylsp[0]), expr->true_->label, (yyvsp[0].string));
       (yyval.expr) = expr;
     }
-#line 3016 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3571 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 72:
-#line 601 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 94: /* block_instr: IF labeling_opt block ELSE labeling_opt instr_list END labeling_opt  */
+#line 740 "src/wast-parser.y"
+                                                                        {
       auto expr = new IfExpr((yyvsp[-5].block), std::move(*(yyvsp[-2].expr_list)));
       delete (yyvsp[-2].expr_list);
       expr->true_->label = std::move(*(yyvsp[-6].string));
@@ -3026,245 +3581,245 @@ yyreduce:
       CHECK_END_LABEL((yylsp[0]), expr->true_->label, (yyvsp[0].string));
       (yyval.expr) = expr;
     }
-#line 3030 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3585 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 73:
-#line 610 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 95: /* block_instr: try_check labeling_opt block catch_instr_list END labeling_opt  */
+#line 749 "src/wast-parser.y"
+                                                                   {
       (yyvsp[-3].block)->label = std::move(*(yyvsp[-4].string));
       delete (yyvsp[-4].string);
       (yyval.expr) = (yyvsp[-2].try_expr);
       cast<TryExpr>((yyval.expr))->block = (yyvsp[-3].block);
       CHECK_END_LABEL((yylsp[0]), (yyvsp[-3].block)->label, (yyvsp[0].string));
     }
-#line 3042 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3597 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 74:
-#line 620 "src/wast-parser.y" /* yacc.c:1646  */
-    { (yyval.types) = (yyvsp[-1].types); }
-#line 3048 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+  case 96: /* block_sig: "(" RESULT value_type_list ")"  */
+#line 759 "src/wast-parser.y"
+                                     { (yyval.types) = (yyvsp[-1].types); }
+#line 3603 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 75:
-#line 623 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 97: /* block: block_sig block  */
+#line 762 "src/wast-parser.y"
+                    {
       (yyval.block) = (yyvsp[0].block);
       (yyval.block)->sig.insert((yyval.block)->sig.end(), (yyvsp[-1].types)->begin(), (yyvsp[-1].types)->end());
       delete (yyvsp[-1].types);
     }
-#line 3058 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3613 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 76:
-#line 628 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 98: /* block: instr_list  */
+#line 767 "src/wast-parser.y"
+               {
       (yyval.block) = new Block(std::move(*(yyvsp[0].expr_list)));
       delete (yyvsp[0].expr_list);
     }
-#line 3067 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3622 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 77:
-#line 635 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 99: /* plain_catch: CATCH var instr_list  */
+#line 774 "src/wast-parser.y"
+                         {
       (yyval.catch_) = new Catch(std::move(*(yyvsp[-1].var)), std::move(*(yyvsp[0].expr_list)));
       delete (yyvsp[-1].var);
       delete (yyvsp[0].expr_list);
       (yyval.catch_)->loc = (yylsp[-2]);
     }
-#line 3078 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3633 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 78:
-#line 643 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 100: /* plain_catch_all: CATCH_ALL instr_list  */
+#line 782 "src/wast-parser.y"
+                         {
       (yyval.catch_) = new Catch(std::move(*(yyvsp[0].expr_list)));
       delete (yyvsp[0].expr_list);
       (yyval.catch_)->loc = (yylsp[-1]);
     }
-#line 3088 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3643 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 81:
-#line 656 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 103: /* catch_instr_list: catch_instr  */
+#line 795 "src/wast-parser.y"
+                {
       auto expr = new TryExpr();
       expr->catches.push_back((yyvsp[0].catch_));
       (yyval.try_expr) = expr;
     }
-#line 3098 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3653 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 82:
-#line 661 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 104: /* catch_instr_list: catch_instr_list catch_instr  */
+#line 800 "src/wast-parser.y"
+                                 {
       (yyval.try_expr) = (yyvsp[-1].try_expr);
       cast<TryExpr>((yyval.try_expr))->catches.push_back((yyvsp[0].catch_));
     }
-#line 3107 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3662 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 83:
-#line 668 "src/wast-parser.y" /* yacc.c:1646  */
-    { (yyval.expr_list) = (yyvsp[-1].expr_list); }
-#line 3113 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+  case 105: /* expr: "(" expr1 ")"  */
+#line 807 "src/wast-parser.y"
+                    { (yyval.expr_list) = (yyvsp[-1].expr_list); }
+#line 3668 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 84:
-#line 672 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 106: /* expr1: plain_instr expr_list  */
+#line 811 "src/wast-parser.y"
+                          {
       (yyval.expr_list) = (yyvsp[0].expr_list);
       (yyval.expr_list)->push_back((yyvsp[-1].expr));
       (yyvsp[-1].expr)->loc = (yylsp[-1]);
     }
-#line 3123 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3678 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 85:
-#line 677 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 107: /* expr1: BLOCK labeling_opt block  */
+#line 816 "src/wast-parser.y"
+                             {
       auto expr = new BlockExpr((yyvsp[0].block));
       expr->block->label = std::move(*(yyvsp[-1].string));
       delete (yyvsp[-1].string);
       expr->loc = (yylsp[-2]);
       (yyval.expr_list) = new ExprList(expr);
     }
-#line 3135 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3690 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 86:
-#line 684 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 108: /* expr1: LOOP labeling_opt block  */
+#line 823 "src/wast-parser.y"
+                            {
       auto expr = new LoopExpr((yyvsp[0].block));
       expr->block->label = std::move(*(yyvsp[-1].string));
       delete (yyvsp[-1].string);
       expr->loc = (yylsp[-2]);
       (yyval.expr_list) = new ExprList(expr);
     }
-#line 3147 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3702 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 87:
-#line 691 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 109: /* expr1: IF labeling_opt if_block  */
+#line 830 "src/wast-parser.y"
+                             {
       (yyval.expr_list) = (yyvsp[0].expr_list);
       IfExpr* if_ = cast<IfExpr>(&(yyvsp[0].expr_list)->back());
       if_->true_->label = std::move(*(yyvsp[-1].string));
       delete (yyvsp[-1].string);
     }
-#line 3158 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3713 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 88:
-#line 697 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 110: /* expr1: try_check labeling_opt try_  */
+#line 836 "src/wast-parser.y"
+                                {
       Block* block = (yyvsp[0].try_expr)->block;
       block->label = std::move(*(yyvsp[-1].string));
       delete (yyvsp[-1].string);
       (yyvsp[0].try_expr)->loc = (yylsp[-2]);
       (yyval.expr_list) = new ExprList((yyvsp[0].try_expr));
     }
-#line 3170 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3725 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 89:
-#line 707 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 111: /* try_: block_sig try_  */
+#line 846 "src/wast-parser.y"
+                   {
       (yyval.try_expr) = (yyvsp[0].try_expr);
       Block* block = (yyval.try_expr)->block;
       block->sig.insert(block->sig.end(), (yyvsp[-1].types)->begin(), (yyvsp[-1].types)->end());
       delete (yyvsp[-1].types);
     }
-#line 3181 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3736 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 90:
-#line 713 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 112: /* try_: instr_list catch_sexp_list  */
+#line 852 "src/wast-parser.y"
+                               {
       Block* block = new Block();
       block->exprs = std::move(*(yyvsp[-1].expr_list));
       delete (yyvsp[-1].expr_list);
       (yyval.try_expr) = (yyvsp[0].try_expr);
       (yyval.try_expr)->block = block;
     }
-#line 3193 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3748 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 91:
-#line 723 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 113: /* catch_sexp: LPAR_CATCH "(" plain_catch ")"  */
+#line 862 "src/wast-parser.y"
+                                     {
       (yyval.catch_) = (yyvsp[-1].catch_);
     }
-#line 3201 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3756 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 92:
-#line 726 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 114: /* catch_sexp: LPAR_CATCH_ALL "(" plain_catch_all ")"  */
+#line 865 "src/wast-parser.y"
+                                             {
       (yyval.catch_) = (yyvsp[-1].catch_);
     }
-#line 3209 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3764 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 93:
-#line 732 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 115: /* catch_sexp_list: catch_sexp  */
+#line 871 "src/wast-parser.y"
+               {
       auto expr = new TryExpr();
       expr->catches.push_back((yyvsp[0].catch_));
       (yyval.try_expr) = expr;
     }
-#line 3219 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3774 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 94:
-#line 737 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 116: /* catch_sexp_list: catch_sexp_list catch_sexp  */
+#line 876 "src/wast-parser.y"
+                               {
       (yyval.try_expr) = (yyvsp[-1].try_expr);
       cast<TryExpr>((yyval.try_expr))->catches.push_back((yyvsp[0].catch_));
     }
-#line 3228 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3783 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 95:
-#line 745 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 117: /* if_block: block_sig if_block  */
+#line 884 "src/wast-parser.y"
+                       {
       IfExpr* if_ = cast<IfExpr>(&(yyvsp[0].expr_list)->back());
       (yyval.expr_list) = (yyvsp[0].expr_list);
       Block* true_ = if_->true_;
       true_->sig.insert(true_->sig.end(), (yyvsp[-1].types)->begin(), (yyvsp[-1].types)->end());
       delete (yyvsp[-1].types);
     }
-#line 3240 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3795 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 97:
-#line 755 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 119: /* if_: "(" THEN instr_list ")" "(" ELSE instr_list ")"  */
+#line 894 "src/wast-parser.y"
+                                                        {
       Expr* expr = new IfExpr(new Block(std::move(*(yyvsp[-5].expr_list))), std::move(*(yyvsp[-1].expr_list)));
       delete (yyvsp[-5].expr_list);
       delete (yyvsp[-1].expr_list);
       expr->loc = (yylsp[-7]);
       (yyval.expr_list) = new ExprList(expr);
     }
-#line 3252 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3807 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 98:
-#line 762 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 120: /* if_: "(" THEN instr_list ")"  */
+#line 901 "src/wast-parser.y"
+                              {
       Expr* expr = new IfExpr(new Block(std::move(*(yyvsp[-1].expr_list))));
       delete (yyvsp[-1].expr_list);
       expr->loc = (yylsp[-3]);
       (yyval.expr_list) = new ExprList(expr);
     }
-#line 3263 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3818 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 99:
-#line 768 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 121: /* if_: expr "(" THEN instr_list ")" "(" ELSE instr_list ")"  */
+#line 907 "src/wast-parser.y"
+                                                             {
       Expr* expr = new IfExpr(new Block(std::move(*(yyvsp[-5].expr_list))), std::move(*(yyvsp[-1].expr_list)));
       delete (yyvsp[-5].expr_list);
       delete (yyvsp[-1].expr_list);
@@ -3272,24 +3827,24 @@ yyreduce:
       (yyval.expr_list) = (yyvsp[-8].expr_list);
       (yyval.expr_list)->push_back(expr);
     }
-#line 3276 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3831 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 100:
-#line 776 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 122: /* if_: expr "(" THEN instr_list ")"  */
+#line 915 "src/wast-parser.y"
+                                   {
       Expr* expr = new IfExpr(new Block(std::move(*(yyvsp[-1].expr_list))));
       delete (yyvsp[-1].expr_list);
       expr->loc = (yylsp[-4]);
       (yyval.expr_list) = (yyvsp[-4].expr_list);
       (yyval.expr_list)->push_back(expr);
     }
-#line 3288 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3843 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 101:
-#line 783 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 123: /* if_: expr expr expr  */
+#line 922 "src/wast-parser.y"
+                   {
       Expr* expr = new IfExpr(new Block(std::move(*(yyvsp[-1].expr_list))), std::move(*(yyvsp[0].expr_list)));
       delete (yyvsp[-1].expr_list);
       delete (yyvsp[0].expr_list);
@@ -3297,98 +3852,98 @@ yyreduce:
       (yyval.expr_list) = (yyvsp[-2].expr_list);
       (yyval.expr_list)->push_back(expr);
     }
-#line 3301 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3856 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 102:
-#line 791 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 124: /* if_: expr expr  */
+#line 930 "src/wast-parser.y"
+              {
       Expr* expr = new IfExpr(new Block(std::move(*(yyvsp[0].expr_list))));
       delete (yyvsp[0].expr_list);
       expr->loc = (yylsp[-1]);
       (yyval.expr_list) = (yyvsp[-1].expr_list);
       (yyval.expr_list)->push_back(expr);
     }
-#line 3313 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3868 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 103:
-#line 801 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 125: /* rethrow_check: RETHROW  */
+#line 940 "src/wast-parser.y"
+            {
      CHECK_ALLOW_EXCEPTIONS(&(yylsp[0]), "rethrow");
     }
-#line 3321 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3876 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 104:
-#line 806 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 126: /* throw_check: THROW  */
+#line 945 "src/wast-parser.y"
+          {
       CHECK_ALLOW_EXCEPTIONS(&(yylsp[0]), "throw");
     }
-#line 3329 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3884 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 105:
-#line 812 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 127: /* try_check: TRY  */
+#line 951 "src/wast-parser.y"
+        {
       CHECK_ALLOW_EXCEPTIONS(&(yylsp[0]), "try");
     }
-#line 3337 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3892 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 106:
-#line 818 "src/wast-parser.y" /* yacc.c:1646  */
-    { (yyval.expr_list) = new ExprList(); }
-#line 3343 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+  case 128: /* instr_list: %empty  */
+#line 957 "src/wast-parser.y"
+                { (yyval.expr_list) = new ExprList(); }
+#line 3898 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 107:
-#line 819 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 129: /* instr_list: instr instr_list  */
+#line 958 "src/wast-parser.y"
+                     {
       (yyval.expr_list) = (yyvsp[0].expr_list);
       (yyval.expr_list)->splice((yyval.expr_list)->begin(), std::move(*(yyvsp[-1].expr_list)));
       delete (yyvsp[-1].expr_list);
     }
-#line 3353 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3908 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 108:
-#line 826 "src/wast-parser.y" /* yacc.c:1646  */
-    { (yyval.expr_list) = new ExprList(); }
-#line 3359 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+  case 130: /* expr_list: %empty  */
+#line 965 "src/wast-parser.y"
+                { (yyval.expr_list) = new ExprList(); }
+#line 3914 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 109:
-#line 827 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 131: /* expr_list: expr expr_list  */
+#line 966 "src/wast-parser.y"
+                   {
       (yyval.expr_list) = (yyvsp[0].expr_list);
       (yyval.expr_list)->splice((yyval.expr_list)->begin(), std::move(*(yyvsp[-1].expr_list)));
       delete (yyvsp[-1].expr_list);
     }
-#line 3369 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3924 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 111:
-#line 839 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 133: /* exception: "(" EXCEPT bind_var_opt value_type_list ")"  */
+#line 978 "src/wast-parser.y"
+                                                  {
       (yyval.exception) = new Exception(*(yyvsp[-2].string), *(yyvsp[-1].types));
       delete (yyvsp[-2].string);
       delete (yyvsp[-1].types);
     }
-#line 3379 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3934 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 112:
-#line 846 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 134: /* exception_field: exception  */
+#line 985 "src/wast-parser.y"
+              {
       (yyval.module_field) = new ExceptionModuleField((yyvsp[0].exception));
     }
-#line 3387 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3942 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 113:
-#line 853 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 135: /* func: "(" FUNC bind_var_opt func_fields ")"  */
+#line 992 "src/wast-parser.y"
+                                            {
       (yyval.module_fields) = (yyvsp[-1].module_fields);
       ModuleField* main_field = &(yyval.module_fields)->front();
       main_field->loc = (yylsp[-3]);
@@ -3400,32 +3955,32 @@ yyreduce:
       }
       delete (yyvsp[-2].string);
     }
-#line 3404 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3959 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 114:
-#line 868 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 136: /* func_fields: type_use func_fields_body  */
+#line 1007 "src/wast-parser.y"
+                              {
       auto field = new FuncModuleField((yyvsp[0].func));
       field->func->decl.has_func_type = true;
       field->func->decl.type_var = std::move(*(yyvsp[-1].var));
       delete (yyvsp[-1].var);
       (yyval.module_fields) = new ModuleFieldList(field);
     }
-#line 3416 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3971 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 115:
-#line 875 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 137: /* func_fields: func_fields_body  */
+#line 1014 "src/wast-parser.y"
+                     {
       (yyval.module_fields) = new ModuleFieldList(new FuncModuleField((yyvsp[0].func)));
     }
-#line 3424 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3979 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 116:
-#line 878 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 138: /* func_fields: inline_import type_use func_fields_import  */
+#line 1017 "src/wast-parser.y"
+                                              {
       auto field = new ImportModuleField((yyvsp[-2].import), (yylsp[-2]));
       field->import->kind = ExternalKind::Func;
       field->import->func = (yyvsp[0].func);
@@ -3434,174 +3989,174 @@ yyreduce:
       delete (yyvsp[-1].var);
       (yyval.module_fields) = new ModuleFieldList(field);
     }
-#line 3438 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 3993 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 117:
-#line 887 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 139: /* func_fields: inline_import func_fields_import  */
+#line 1026 "src/wast-parser.y"
+                                     {
       auto field = new ImportModuleField((yyvsp[-1].import), (yylsp[-1]));
       field->import->kind = ExternalKind::Func;
       field->import->func = (yyvsp[0].func);
       (yyval.module_fields) = new ModuleFieldList(field);
     }
-#line 3449 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4004 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 118:
-#line 893 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 140: /* func_fields: inline_export func_fields  */
+#line 1032 "src/wast-parser.y"
+                              {
       auto field = new ExportModuleField((yyvsp[-1].export_), (yylsp[-1]));
       field->export_->kind = ExternalKind::Func;
       (yyval.module_fields) = (yyvsp[0].module_fields);
       (yyval.module_fields)->push_back(field);
     }
-#line 3460 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4015 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 119:
-#line 902 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 141: /* func_fields_import: func_fields_import1  */
+#line 1041 "src/wast-parser.y"
+                        {
       (yyval.func) = (yyvsp[0].func);
       reverse_bindings(&(yyval.func)->decl.sig.param_types, &(yyval.func)->param_bindings);
     }
-#line 3469 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4024 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 121:
-#line 910 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 143: /* func_fields_import1: "(" PARAM value_type_list ")" func_fields_import1  */
+#line 1049 "src/wast-parser.y"
+                                                        {
       (yyval.func) = (yyvsp[0].func);
       (yyval.func)->decl.sig.param_types.insert((yyval.func)->decl.sig.param_types.begin(),
                                       (yyvsp[-2].types)->begin(), (yyvsp[-2].types)->end());
       delete (yyvsp[-2].types);
     }
-#line 3480 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4035 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 122:
-#line 916 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 144: /* func_fields_import1: "(" PARAM bind_var value_type ")" func_fields_import1  */
+#line 1055 "src/wast-parser.y"
+                                                            {
       (yyval.func) = (yyvsp[0].func);
       (yyval.func)->param_bindings.emplace(*(yyvsp[-3].string),
                                  Binding((yylsp[-3]), (yyval.func)->decl.sig.param_types.size()));
       delete (yyvsp[-3].string);
       (yyval.func)->decl.sig.param_types.insert((yyval.func)->decl.sig.param_types.begin(), (yyvsp[-2].type));
     }
-#line 3492 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4047 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 123:
-#line 926 "src/wast-parser.y" /* yacc.c:1646  */
-    { (yyval.func) = new Func(); }
-#line 3498 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+  case 145: /* func_fields_import_result: %empty  */
+#line 1065 "src/wast-parser.y"
+                { (yyval.func) = new Func(); }
+#line 4053 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 124:
-#line 927 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 146: /* func_fields_import_result: "(" RESULT value_type_list ")" func_fields_import_result  */
+#line 1066 "src/wast-parser.y"
+                                                               {
       (yyval.func) = (yyvsp[0].func);
       (yyval.func)->decl.sig.result_types.insert((yyval.func)->decl.sig.result_types.begin(),
                                        (yyvsp[-2].types)->begin(), (yyvsp[-2].types)->end());
       delete (yyvsp[-2].types);
     }
-#line 3509 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4064 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 125:
-#line 936 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 147: /* func_fields_body: func_fields_body1  */
+#line 1075 "src/wast-parser.y"
+                      {
       (yyval.func) = (yyvsp[0].func);
       reverse_bindings(&(yyval.func)->decl.sig.param_types, &(yyval.func)->param_bindings);
     }
-#line 3518 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4073 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 127:
-#line 944 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 149: /* func_fields_body1: "(" PARAM value_type_list ")" func_fields_body1  */
+#line 1083 "src/wast-parser.y"
+                                                      {
       (yyval.func) = (yyvsp[0].func);
       (yyval.func)->decl.sig.param_types.insert((yyval.func)->decl.sig.param_types.begin(),
                                       (yyvsp[-2].types)->begin(), (yyvsp[-2].types)->end());
       delete (yyvsp[-2].types);
     }
-#line 3529 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4084 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 128:
-#line 950 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 150: /* func_fields_body1: "(" PARAM bind_var value_type ")" func_fields_body1  */
+#line 1089 "src/wast-parser.y"
+                                                          {
       (yyval.func) = (yyvsp[0].func);
       (yyval.func)->param_bindings.emplace(*(yyvsp[-3].string),
                                  Binding((yylsp[-3]), (yyval.func)->decl.sig.param_types.size()));
       delete (yyvsp[-3].string);
       (yyval.func)->decl.sig.param_types.insert((yyval.func)->decl.sig.param_types.begin(), (yyvsp[-2].type));
     }
-#line 3541 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4096 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 130:
-#line 961 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 152: /* func_result_body: "(" RESULT value_type_list ")" func_result_body  */
+#line 1100 "src/wast-parser.y"
+                                                      {
       (yyval.func) = (yyvsp[0].func);
       (yyval.func)->decl.sig.result_types.insert((yyval.func)->decl.sig.result_types.begin(),
                                        (yyvsp[-2].types)->begin(), (yyvsp[-2].types)->end());
       delete (yyvsp[-2].types);
     }
-#line 3552 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4107 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 131:
-#line 970 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 153: /* func_body: func_body1  */
+#line 1109 "src/wast-parser.y"
+               {
       (yyval.func) = (yyvsp[0].func);
       reverse_bindings(&(yyval.func)->local_types, &(yyval.func)->local_bindings);
     }
-#line 3561 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4116 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 132:
-#line 977 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 154: /* func_body1: instr_list  */
+#line 1116 "src/wast-parser.y"
+               {
       (yyval.func) = new Func();
       (yyval.func)->exprs = std::move(*(yyvsp[0].expr_list));
       delete (yyvsp[0].expr_list);
     }
-#line 3571 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4126 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 133:
-#line 982 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 155: /* func_body1: "(" LOCAL value_type_list ")" func_body1  */
+#line 1121 "src/wast-parser.y"
+                                               {
       (yyval.func) = (yyvsp[0].func);
       (yyval.func)->local_types.insert((yyval.func)->local_types.begin(), (yyvsp[-2].types)->begin(), (yyvsp[-2].types)->end());
       delete (yyvsp[-2].types);
     }
-#line 3581 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4136 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 134:
-#line 987 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 156: /* func_body1: "(" LOCAL bind_var value_type ")" func_body1  */
+#line 1126 "src/wast-parser.y"
+                                                   {
       (yyval.func) = (yyvsp[0].func);
       (yyval.func)->local_bindings.emplace(*(yyvsp[-3].string), Binding((yylsp[-3]), (yyval.func)->local_types.size()));
       delete (yyvsp[-3].string);
       (yyval.func)->local_types.insert((yyval.func)->local_types.begin(), (yyvsp[-2].type));
     }
-#line 3592 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4147 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 135:
-#line 998 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 157: /* offset: "(" OFFSET const_expr ")"  */
+#line 1137 "src/wast-parser.y"
+                                {
       (yyval.expr_list) = (yyvsp[-1].expr_list);
     }
-#line 3600 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4155 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 137:
-#line 1005 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 159: /* elem: "(" ELEM var offset var_list ")"  */
+#line 1144 "src/wast-parser.y"
+                                       {
       auto elem_segment = new ElemSegment();
       elem_segment->table_var = std::move(*(yyvsp[-3].var));
       delete (yyvsp[-3].var);
@@ -3611,12 +4166,12 @@ yyreduce:
       delete (yyvsp[-1].vars);
       (yyval.module_field) = new ElemSegmentModuleField(elem_segment, (yylsp[-4]));
     }
-#line 3615 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4170 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 138:
-#line 1015 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 160: /* elem: "(" ELEM offset var_list ")"  */
+#line 1154 "src/wast-parser.y"
+                                   {
       auto elem_segment = new ElemSegment();
       elem_segment->table_var = Var(0, (yylsp[-3]));
       elem_segment->offset = std::move(*(yyvsp[-2].expr_list));
@@ -3625,12 +4180,12 @@ yyreduce:
       delete (yyvsp[-1].vars);
       (yyval.module_field) = new ElemSegmentModuleField(elem_segment, (yylsp[-3]));
     }
-#line 3629 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4184 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 139:
-#line 1027 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 161: /* table: "(" TABLE bind_var_opt table_fields ")"  */
+#line 1166 "src/wast-parser.y"
+                                              {
       (yyval.module_fields) = (yyvsp[-1].module_fields);
       ModuleField* main_field = &(yyval.module_fields)->front();
       main_field->loc = (yylsp[-3]);
@@ -3642,42 +4197,42 @@ yyreduce:
       }
       delete (yyvsp[-2].string);
     }
-#line 3646 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4201 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 140:
-#line 1042 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 162: /* table_fields: table_sig  */
+#line 1181 "src/wast-parser.y"
+              {
       (yyval.module_fields) = new ModuleFieldList(new TableModuleField((yyvsp[0].table)));
     }
-#line 3654 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4209 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 141:
-#line 1045 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 163: /* table_fields: inline_import table_sig  */
+#line 1184 "src/wast-parser.y"
+                            {
       auto field = new ImportModuleField((yyvsp[-1].import));
       field->import->kind = ExternalKind::Table;
       field->import->table = (yyvsp[0].table);
       (yyval.module_fields) = new ModuleFieldList(field);
     }
-#line 3665 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4220 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 142:
-#line 1051 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 164: /* table_fields: inline_export table_fields  */
+#line 1190 "src/wast-parser.y"
+                               {
       auto field = new ExportModuleField((yyvsp[-1].export_), (yylsp[-1]));
       field->export_->kind = ExternalKind::Table;
       (yyval.module_fields) = (yyvsp[0].module_fields);
       (yyval.module_fields)->push_back(field);
     }
-#line 3676 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4231 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 143:
-#line 1057 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 165: /* table_fields: elem_type "(" ELEM var_list ")"  */
+#line 1196 "src/wast-parser.y"
+                                      {
       auto table = new Table();
       table->elem_limits.initial = (yyvsp[-1].vars)->size();
       table->elem_limits.max = (yyvsp[-1].vars)->size();
@@ -3694,12 +4249,12 @@ yyreduce:
       (yyval.module_fields)->push_back(new TableModuleField(table));
       (yyval.module_fields)->push_back(new ElemSegmentModuleField(elem_segment, (yylsp[-2])));
     }
-#line 3698 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4253 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 144:
-#line 1077 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 166: /* data: "(" DATA var offset text_list_opt ")"  */
+#line 1216 "src/wast-parser.y"
+                                            {
       auto data_segment = new DataSegment();
       data_segment->memory_var = std::move(*(yyvsp[-3].var));
       delete (yyvsp[-3].var);
@@ -3709,12 +4264,12 @@ yyreduce:
       destroy_text_list(&(yyvsp[-1].text_list));
       (yyval.module_field) = new DataSegmentModuleField(data_segment, (yylsp[-4]));
     }
-#line 3713 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4268 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 145:
-#line 1087 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 167: /* data: "(" DATA offset text_list_opt ")"  */
+#line 1226 "src/wast-parser.y"
+                                        {
       auto data_segment = new DataSegment();
       data_segment->memory_var = Var(0, (yylsp[-3]));
       data_segment->offset = std::move(*(yyvsp[-2].expr_list));
@@ -3723,12 +4278,12 @@ yyreduce:
       destroy_text_list(&(yyvsp[-1].text_list));
       (yyval.module_field) = new DataSegmentModuleField(data_segment, (yylsp[-3]));
     }
-#line 3727 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4282 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 146:
-#line 1099 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 168: /* memory: "(" MEMORY bind_var_opt memory_fields ")"  */
+#line 1238 "src/wast-parser.y"
+                                                {
       (yyval.module_fields) = (yyvsp[-1].module_fields);
       ModuleField* main_field = &(yyval.module_fields)->front();
       main_field->loc = (yylsp[-3]);
@@ -3740,42 +4295,42 @@ yyreduce:
       }
       delete (yyvsp[-2].string);
     }
-#line 3744 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4299 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 147:
-#line 1114 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 169: /* memory_fields: memory_sig  */
+#line 1253 "src/wast-parser.y"
+               {
       (yyval.module_fields) = new ModuleFieldList(new MemoryModuleField((yyvsp[0].memory)));
     }
-#line 3752 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4307 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 148:
-#line 1117 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 170: /* memory_fields: inline_import memory_sig  */
+#line 1256 "src/wast-parser.y"
+                             {
       auto field = new ImportModuleField((yyvsp[-1].import));
       field->import->kind = ExternalKind::Memory;
       field->import->memory = (yyvsp[0].memory);
       (yyval.module_fields) = new ModuleFieldList(field);
     }
-#line 3763 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4318 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 149:
-#line 1123 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 171: /* memory_fields: inline_export memory_fields  */
+#line 1262 "src/wast-parser.y"
+                                {
       auto field = new ExportModuleField((yyvsp[-1].export_), (yylsp[-1]));
       field->export_->kind = ExternalKind::Memory;
       (yyval.module_fields) = (yyvsp[0].module_fields);
       (yyval.module_fields)->push_back(field);
     }
-#line 3774 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4329 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 150:
-#line 1129 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 172: /* memory_fields: "(" DATA text_list_opt ")"  */
+#line 1268 "src/wast-parser.y"
+                                 {
       auto data_segment = new DataSegment();
       data_segment->memory_var = Var(kInvalidIndex);
       data_segment->offset.push_back(new ConstExpr(Const(Const::I32(), 0)));
@@ -3795,12 +4350,12 @@ yyreduce:
       (yyval.module_fields)->push_back(new MemoryModuleField(memory));
       (yyval.module_fields)->push_back(new DataSegmentModuleField(data_segment, (yylsp[-2])));
     }
-#line 3799 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4354 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 151:
-#line 1152 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 173: /* global: "(" GLOBAL bind_var_opt global_fields ")"  */
+#line 1291 "src/wast-parser.y"
+                                                {
       (yyval.module_fields) = (yyvsp[-1].module_fields);
       ModuleField* main_field = &(yyval.module_fields)->front();
       main_field->loc = (yylsp[-3]);
@@ -3812,45 +4367,45 @@ yyreduce:
       }
       delete (yyvsp[-2].string);
     }
-#line 3816 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4371 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 152:
-#line 1167 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 174: /* global_fields: global_type const_expr  */
+#line 1306 "src/wast-parser.y"
+                           {
       auto field = new GlobalModuleField((yyvsp[-1].global));
       field->global->init_expr = std::move(*(yyvsp[0].expr_list));
       delete (yyvsp[0].expr_list);
       (yyval.module_fields) = new ModuleFieldList(field);
     }
-#line 3827 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4382 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 153:
-#line 1173 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 175: /* global_fields: inline_import global_type  */
+#line 1312 "src/wast-parser.y"
+                              {
       auto field = new ImportModuleField((yyvsp[-1].import));
       field->import->kind = ExternalKind::Global;
       field->import->global = (yyvsp[0].global);
       (yyval.module_fields) = new ModuleFieldList(field);
     }
-#line 3838 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4393 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 154:
-#line 1179 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 176: /* global_fields: inline_export global_fields  */
+#line 1318 "src/wast-parser.y"
+                                {
       auto field = new ExportModuleField((yyvsp[-1].export_), (yylsp[-1]));
       field->export_->kind = ExternalKind::Global;
       (yyval.module_fields) = (yyvsp[0].module_fields);
       (yyval.module_fields)->push_back(field);
     }
-#line 3849 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4404 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 155:
-#line 1190 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 177: /* import_desc: "(" FUNC bind_var_opt type_use ")"  */
+#line 1329 "src/wast-parser.y"
+                                         {
       (yyval.import) = new Import();
       (yyval.import)->kind = ExternalKind::Func;
       (yyval.import)->func = new Func();
@@ -3860,12 +4415,12 @@ yyreduce:
       (yyval.import)->func->decl.type_var = std::move(*(yyvsp[-1].var));
       delete (yyvsp[-1].var);
     }
-#line 3864 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4419 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 156:
-#line 1200 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 178: /* import_desc: "(" FUNC bind_var_opt func_sig ")"  */
+#line 1339 "src/wast-parser.y"
+                                         {
       (yyval.import) = new Import();
       (yyval.import)->kind = ExternalKind::Func;
       (yyval.import)->func = new Func();
@@ -3874,58 +4429,58 @@ yyreduce:
       (yyval.import)->func->decl.sig = std::move(*(yyvsp[-1].func_sig));
       delete (yyvsp[-1].func_sig);
     }
-#line 3878 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4433 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 157:
-#line 1209 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 179: /* import_desc: "(" TABLE bind_var_opt table_sig ")"  */
+#line 1348 "src/wast-parser.y"
+                                           {
       (yyval.import) = new Import();
       (yyval.import)->kind = ExternalKind::Table;
       (yyval.import)->table = (yyvsp[-1].table);
       (yyval.import)->table->name = std::move(*(yyvsp[-2].string));
       delete (yyvsp[-2].string);
     }
-#line 3890 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4445 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 158:
-#line 1216 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 180: /* import_desc: "(" MEMORY bind_var_opt memory_sig ")"  */
+#line 1355 "src/wast-parser.y"
+                                             {
       (yyval.import) = new Import();
       (yyval.import)->kind = ExternalKind::Memory;
       (yyval.import)->memory = (yyvsp[-1].memory);
       (yyval.import)->memory->name = std::move(*(yyvsp[-2].string));
       delete (yyvsp[-2].string);
     }
-#line 3902 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4457 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 159:
-#line 1223 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 181: /* import_desc: "(" GLOBAL bind_var_opt global_type ")"  */
+#line 1362 "src/wast-parser.y"
+                                              {
       (yyval.import) = new Import();
       (yyval.import)->kind = ExternalKind::Global;
       (yyval.import)->global = (yyvsp[-1].global);
       (yyval.import)->global->name = std::move(*(yyvsp[-2].string));
       delete (yyvsp[-2].string);
     }
-#line 3914 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4469 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 160:
-#line 1230 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 182: /* import_desc: exception  */
+#line 1369 "src/wast-parser.y"
+              {
       (yyval.import) = new Import();
       (yyval.import)->kind = ExternalKind::Except;
       (yyval.import)->except = (yyvsp[0].exception);
     }
-#line 3924 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4479 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 161:
-#line 1238 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 183: /* import: "(" IMPORT quoted_text quoted_text import_desc ")"  */
+#line 1377 "src/wast-parser.y"
+                                                         {
       auto field = new ImportModuleField((yyvsp[-1].import), (yylsp[-4]));
       field->import->module_name = string_slice_to_string((yyvsp[-3].text));
       destroy_string_slice(&(yyvsp[-3].text));
@@ -3933,111 +4488,111 @@ yyreduce:
       destroy_string_slice(&(yyvsp[-2].text));
       (yyval.module_field) = field;
     }
-#line 3937 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4492 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 162:
-#line 1249 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 184: /* inline_import: "(" IMPORT quoted_text quoted_text ")"  */
+#line 1388 "src/wast-parser.y"
+                                             {
       (yyval.import) = new Import();
       (yyval.import)->module_name = string_slice_to_string((yyvsp[-2].text));
       destroy_string_slice(&(yyvsp[-2].text));
       (yyval.import)->field_name = string_slice_to_string((yyvsp[-1].text));
       destroy_string_slice(&(yyvsp[-1].text));
     }
-#line 3949 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4504 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 163:
-#line 1259 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 185: /* export_desc: "(" FUNC var ")"  */
+#line 1398 "src/wast-parser.y"
+                       {
       (yyval.export_) = new Export();
       (yyval.export_)->kind = ExternalKind::Func;
       (yyval.export_)->var = std::move(*(yyvsp[-1].var));
       delete (yyvsp[-1].var);
     }
-#line 3960 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4515 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 164:
-#line 1265 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 186: /* export_desc: "(" TABLE var ")"  */
+#line 1404 "src/wast-parser.y"
+                        {
       (yyval.export_) = new Export();
       (yyval.export_)->kind = ExternalKind::Table;
       (yyval.export_)->var = std::move(*(yyvsp[-1].var));
       delete (yyvsp[-1].var);
     }
-#line 3971 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4526 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 165:
-#line 1271 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 187: /* export_desc: "(" MEMORY var ")"  */
+#line 1410 "src/wast-parser.y"
+                         {
       (yyval.export_) = new Export();
       (yyval.export_)->kind = ExternalKind::Memory;
       (yyval.export_)->var = std::move(*(yyvsp[-1].var));
       delete (yyvsp[-1].var);
     }
-#line 3982 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4537 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 166:
-#line 1277 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 188: /* export_desc: "(" GLOBAL var ")"  */
+#line 1416 "src/wast-parser.y"
+                         {
       (yyval.export_) = new Export();
       (yyval.export_)->kind = ExternalKind::Global;
       (yyval.export_)->var = std::move(*(yyvsp[-1].var));
       delete (yyvsp[-1].var);
     }
-#line 3993 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4548 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 167:
-#line 1283 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 189: /* export_desc: "(" EXCEPT var ")"  */
+#line 1422 "src/wast-parser.y"
+                         {
       (yyval.export_) = new Export();
       (yyval.export_)->kind = ExternalKind::Except;
       (yyval.export_)->var = std::move(*(yyvsp[-1].var));
       delete (yyvsp[-1].var);
     }
-#line 4004 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4559 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 168:
-#line 1291 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 190: /* export: "(" EXPORT quoted_text export_desc ")"  */
+#line 1430 "src/wast-parser.y"
+                                             {
       auto field = new ExportModuleField((yyvsp[-1].export_), (yylsp[-3]));
       field->export_->name = string_slice_to_string((yyvsp[-2].text));
       destroy_string_slice(&(yyvsp[-2].text));
       (yyval.module_field) = field;
     }
-#line 4015 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4570 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 169:
-#line 1300 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 191: /* inline_export: "(" EXPORT quoted_text ")"  */
+#line 1439 "src/wast-parser.y"
+                                 {
       (yyval.export_) = new Export();
       (yyval.export_)->name = string_slice_to_string((yyvsp[-1].text));
       destroy_string_slice(&(yyvsp[-1].text));
     }
-#line 4025 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4580 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 170:
-#line 1311 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 192: /* type_def: "(" TYPE func_type ")"  */
+#line 1450 "src/wast-parser.y"
+                             {
       auto func_type = new FuncType();
       func_type->sig = std::move(*(yyvsp[-1].func_sig));
       delete (yyvsp[-1].func_sig);
       (yyval.module_field) = new FuncTypeModuleField(func_type, (yylsp[-2]));
     }
-#line 4036 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4591 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 171:
-#line 1317 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 193: /* type_def: "(" TYPE bind_var func_type ")"  */
+#line 1456 "src/wast-parser.y"
+                                      {
       auto func_type = new FuncType();
       func_type->name = std::move(*(yyvsp[-2].string));
       delete (yyvsp[-2].string);
@@ -4045,91 +4600,91 @@ yyreduce:
       delete (yyvsp[-1].func_sig);
       (yyval.module_field) = new FuncTypeModuleField(func_type, (yylsp[-3]));
     }
-#line 4049 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4604 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 172:
-#line 1328 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 194: /* start: "(" START var ")"  */
+#line 1467 "src/wast-parser.y"
+                        {
       (yyval.module_field) = new StartModuleField(*(yyvsp[-1].var), (yylsp[-2]));
       delete (yyvsp[-1].var);
     }
-#line 4058 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4613 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 173:
-#line 1335 "src/wast-parser.y" /* yacc.c:1646  */
-    { (yyval.module_fields) = new ModuleFieldList((yyvsp[0].module_field)); }
-#line 4064 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+  case 195: /* module_field: type_def  */
+#line 1474 "src/wast-parser.y"
+             { (yyval.module_fields) = new ModuleFieldList((yyvsp[0].module_field)); }
+#line 4619 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 178:
-#line 1340 "src/wast-parser.y" /* yacc.c:1646  */
-    { (yyval.module_fields) = new ModuleFieldList((yyvsp[0].module_field)); }
-#line 4070 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+  case 200: /* module_field: elem  */
+#line 1479 "src/wast-parser.y"
+         { (yyval.module_fields) = new ModuleFieldList((yyvsp[0].module_field)); }
+#line 4625 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 179:
-#line 1341 "src/wast-parser.y" /* yacc.c:1646  */
-    { (yyval.module_fields) = new ModuleFieldList((yyvsp[0].module_field)); }
-#line 4076 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+  case 201: /* module_field: data  */
+#line 1480 "src/wast-parser.y"
+         { (yyval.module_fields) = new ModuleFieldList((yyvsp[0].module_field)); }
+#line 4631 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 180:
-#line 1342 "src/wast-parser.y" /* yacc.c:1646  */
-    { (yyval.module_fields) = new ModuleFieldList((yyvsp[0].module_field)); }
-#line 4082 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+  case 202: /* module_field: start  */
+#line 1481 "src/wast-parser.y"
+          { (yyval.module_fields) = new ModuleFieldList((yyvsp[0].module_field)); }
+#line 4637 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 181:
-#line 1343 "src/wast-parser.y" /* yacc.c:1646  */
-    { (yyval.module_fields) = new ModuleFieldList((yyvsp[0].module_field)); }
-#line 4088 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+  case 203: /* module_field: import  */
+#line 1482 "src/wast-parser.y"
+           { (yyval.module_fields) = new ModuleFieldList((yyvsp[0].module_field)); }
+#line 4643 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 182:
-#line 1344 "src/wast-parser.y" /* yacc.c:1646  */
-    { (yyval.module_fields) = new ModuleFieldList((yyvsp[0].module_field)); }
-#line 4094 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+  case 204: /* module_field: export  */
+#line 1483 "src/wast-parser.y"
+           { (yyval.module_fields) = new ModuleFieldList((yyvsp[0].module_field)); }
+#line 4649 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 183:
-#line 1345 "src/wast-parser.y" /* yacc.c:1646  */
-    { (yyval.module_fields) = new ModuleFieldList((yyvsp[0].module_field)); }
-#line 4100 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+  case 205: /* module_field: exception_field  */
+#line 1484 "src/wast-parser.y"
+                    { (yyval.module_fields) = new ModuleFieldList((yyvsp[0].module_field)); }
+#line 4655 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 184:
-#line 1349 "src/wast-parser.y" /* yacc.c:1646  */
-    { (yyval.module) = new Module(); }
-#line 4106 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+  case 206: /* module_fields_opt: %empty  */
+#line 1488 "src/wast-parser.y"
+                { (yyval.module) = new Module(); }
+#line 4661 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 186:
-#line 1354 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 208: /* module_fields: module_field  */
+#line 1493 "src/wast-parser.y"
+                 {
       (yyval.module) = new Module();
       check_import_ordering(&(yylsp[0]), lexer, parser, (yyval.module), *(yyvsp[0].module_fields));
       append_module_fields((yyval.module), (yyvsp[0].module_fields));
       delete (yyvsp[0].module_fields);
     }
-#line 4117 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4672 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 187:
-#line 1360 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 209: /* module_fields: module_fields module_field  */
+#line 1499 "src/wast-parser.y"
+                               {
       (yyval.module) = (yyvsp[-1].module);
       check_import_ordering(&(yylsp[0]), lexer, parser, (yyval.module), *(yyvsp[0].module_fields));
       append_module_fields((yyval.module), (yyvsp[0].module_fields));
       delete (yyvsp[0].module_fields);
     }
-#line 4128 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4683 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 188:
-#line 1369 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 210: /* module: script_module  */
+#line 1508 "src/wast-parser.y"
+                  {
       if ((yyvsp[0].script_module)->type == ScriptModule::Type::Text) {
         (yyval.module) = (yyvsp[0].script_module)->text;
         (yyvsp[0].script_module)->text = nullptr;
@@ -4137,6 +4692,16 @@ yyreduce:
         assert((yyvsp[0].script_module)->type == ScriptModule::Type::Binary);
         (yyval.module) = new Module();
         ReadBinaryOptions options;
+        const WastParseOptions* parse_options = parser->options;
+        options.allow_future_exceptions =
+            parse_options->allow_future_exceptions;
+        options.allow_future_bulk_memory =
+            parse_options->allow_future_bulk_memory;
+        options.allow_future_simd = parse_options->allow_future_simd;
+        options.allow_future_threads = parse_options->allow_future_threads;
+        options.allow_future_tail_call = parse_options->allow_future_tail_call;
+        options.allow_future_multi_value =
+            parse_options->allow_future_multi_value;
         BinaryErrorHandlerModule error_handler(&(yyvsp[0].script_module)->binary.loc, lexer, parser);
         const char* filename = "<text>";
         read_binary_ir(filename, (yyvsp[0].script_module)->binary.data.data(), (yyvsp[0].script_module)->binary.data.size(),
@@ -4146,28 +4711,28 @@ yyreduce:
       }
       delete (yyvsp[0].script_module);
     }
-#line 4150 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4715 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 190:
-#line 1396 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 212: /* script_var_opt: %empty  */
+#line 1545 "src/wast-parser.y"
+                {
       (yyval.var) = new Var(kInvalidIndex);
     }
-#line 4158 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4723 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 191:
-#line 1399 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 213: /* script_var_opt: VAR  */
+#line 1548 "src/wast-parser.y"
+        {
       (yyval.var) = new Var(string_view((yyvsp[0].text).start, (yyvsp[0].text).length), (yylsp[0]));
     }
-#line 4166 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4731 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 192:
-#line 1405 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 214: /* script_module: "(" MODULE bind_var_opt module_fields_opt ")"  */
+#line 1554 "src/wast-parser.y"
+                                                    {
       (yyval.script_module) = new ScriptModule(ScriptModule::Type::Text);
       (yyval.script_module)->text = (yyvsp[-1].module);
       (yyval.script_module)->text->name = std::move(*(yyvsp[-2].string));
@@ -4185,12 +4750,12 @@ yyreduce:
         }
       }
     }
-#line 4189 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4754 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 193:
-#line 1423 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 215: /* script_module: "(" MODULE bind_var_opt BIN text_list ")"  */
+#line 1572 "src/wast-parser.y"
+                                                {
       (yyval.script_module) = new ScriptModule(ScriptModule::Type::Binary);
       (yyval.script_module)->binary.name = std::move(*(yyvsp[-3].string));
       delete (yyvsp[-3].string);
@@ -4198,12 +4763,12 @@ yyreduce:
       DupTextList(&(yyvsp[-1].text_list), &(yyval.script_module)->binary.data);
       destroy_text_list(&(yyvsp[-1].text_list));
     }
-#line 4202 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4767 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 194:
-#line 1431 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 216: /* script_module: "(" MODULE bind_var_opt QUOTE text_list ")"  */
+#line 1580 "src/wast-parser.y"
+                                                  {
       (yyval.script_module) = new ScriptModule(ScriptModule::Type::Quoted);
       (yyval.script_module)->quoted.name = std::move(*(yyvsp[-3].string));
       delete (yyvsp[-3].string);
@@ -4211,12 +4776,12 @@ yyreduce:
       DupTextList(&(yyvsp[-1].text_list), &(yyval.script_module)->quoted.data);
       destroy_text_list(&(yyvsp[-1].text_list));
     }
-#line 4215 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4780 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 195:
-#line 1442 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 217: /* action: "(" INVOKE script_var_opt quoted_text const_list ")"  */
+#line 1591 "src/wast-parser.y"
+                                                           {
       (yyval.action) = new Action();
       (yyval.action)->loc = (yylsp[-4]);
       (yyval.action)->module_var = std::move(*(yyvsp[-3].var));
@@ -4228,12 +4793,12 @@ yyreduce:
       (yyval.action)->invoke->args = std::move(*(yyvsp[-1].consts));
       delete (yyvsp[-1].consts);
     }
-#line 4232 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4797 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 196:
-#line 1454 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 218: /* action: "(" GET script_var_opt quoted_text ")"  */
+#line 1603 "src/wast-parser.y"
+                                             {
       (yyval.action) = new Action();
       (yyval.action)->loc = (yylsp[-3]);
       (yyval.action)->module_var = std::move(*(yyvsp[-2].var));
@@ -4242,136 +4807,136 @@ yyreduce:
       (yyval.action)->name = string_slice_to_string((yyvsp[-1].text));
       destroy_string_slice(&(yyvsp[-1].text));
     }
-#line 4246 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4811 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 197:
-#line 1466 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 219: /* assertion: "(" ASSERT_MALFORMED script_module quoted_text ")"  */
+#line 1615 "src/wast-parser.y"
+                                                         {
       (yyval.command) = new AssertMalformedCommand((yyvsp[-2].script_module), string_slice_to_string((yyvsp[-1].text)));
       destroy_string_slice(&(yyvsp[-1].text));
     }
-#line 4255 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4820 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 198:
-#line 1470 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 220: /* assertion: "(" ASSERT_INVALID script_module quoted_text ")"  */
+#line 1619 "src/wast-parser.y"
+                                                       {
       (yyval.command) = new AssertInvalidCommand((yyvsp[-2].script_module), string_slice_to_string((yyvsp[-1].text)));
       destroy_string_slice(&(yyvsp[-1].text));
     }
-#line 4264 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4829 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 199:
-#line 1474 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 221: /* assertion: "(" ASSERT_UNLINKABLE script_module quoted_text ")"  */
+#line 1623 "src/wast-parser.y"
+                                                          {
       (yyval.command) = new AssertUnlinkableCommand((yyvsp[-2].script_module), string_slice_to_string((yyvsp[-1].text)));
       destroy_string_slice(&(yyvsp[-1].text));
     }
-#line 4273 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4838 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 200:
-#line 1478 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 222: /* assertion: "(" ASSERT_TRAP script_module quoted_text ")"  */
+#line 1627 "src/wast-parser.y"
+                                                    {
       (yyval.command) = new AssertUninstantiableCommand((yyvsp[-2].script_module), string_slice_to_string((yyvsp[-1].text)));
       destroy_string_slice(&(yyvsp[-1].text));
     }
-#line 4282 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4847 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 201:
-#line 1482 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 223: /* assertion: "(" ASSERT_RETURN action const_list ")"  */
+#line 1631 "src/wast-parser.y"
+                                              {
       (yyval.command) = new AssertReturnCommand((yyvsp[-2].action), (yyvsp[-1].consts));
     }
-#line 4290 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4855 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 202:
-#line 1485 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 224: /* assertion: "(" ASSERT_RETURN_CANONICAL_NAN action ")"  */
+#line 1634 "src/wast-parser.y"
+                                                 {
       (yyval.command) = new AssertReturnCanonicalNanCommand((yyvsp[-1].action));
     }
-#line 4298 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4863 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 203:
-#line 1488 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 225: /* assertion: "(" ASSERT_RETURN_ARITHMETIC_NAN action ")"  */
+#line 1637 "src/wast-parser.y"
+                                                  {
       (yyval.command) = new AssertReturnArithmeticNanCommand((yyvsp[-1].action));
     }
-#line 4306 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4871 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 204:
-#line 1491 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 226: /* assertion: "(" ASSERT_TRAP action quoted_text ")"  */
+#line 1640 "src/wast-parser.y"
+                                             {
       (yyval.command) = new AssertTrapCommand((yyvsp[-2].action), string_slice_to_string((yyvsp[-1].text)));
       destroy_string_slice(&(yyvsp[-1].text));
     }
-#line 4315 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4880 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 205:
-#line 1495 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 227: /* assertion: "(" ASSERT_EXHAUSTION action quoted_text ")"  */
+#line 1644 "src/wast-parser.y"
+                                                   {
       (yyval.command) = new AssertExhaustionCommand((yyvsp[-2].action), string_slice_to_string((yyvsp[-1].text)));
       destroy_string_slice(&(yyvsp[-1].text));
     }
-#line 4324 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4889 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 206:
-#line 1502 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 228: /* cmd: action  */
+#line 1651 "src/wast-parser.y"
+           {
       (yyval.command) = new ActionCommand((yyvsp[0].action));
     }
-#line 4332 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4897 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 208:
-#line 1506 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 230: /* cmd: module  */
+#line 1655 "src/wast-parser.y"
+           {
       (yyval.command) = new ModuleCommand((yyvsp[0].module));
     }
-#line 4340 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4905 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 209:
-#line 1509 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 231: /* cmd: "(" REGISTER quoted_text script_var_opt ")"  */
+#line 1658 "src/wast-parser.y"
+                                                  {
       auto* command = new RegisterCommand(string_slice_to_string((yyvsp[-2].text)), *(yyvsp[-1].var));
       destroy_string_slice(&(yyvsp[-2].text));
       delete (yyvsp[-1].var);
       command->var.loc = (yylsp[-1]);
       (yyval.command) = command;
     }
-#line 4352 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4917 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 210:
-#line 1518 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 232: /* cmd_list: cmd  */
+#line 1667 "src/wast-parser.y"
+        {
       (yyval.commands) = new CommandPtrVector();
       (yyval.commands)->emplace_back((yyvsp[0].command));
     }
-#line 4361 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4926 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 211:
-#line 1522 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 233: /* cmd_list: cmd_list cmd  */
+#line 1671 "src/wast-parser.y"
+                 {
       (yyval.commands) = (yyvsp[-1].commands);
       (yyval.commands)->emplace_back((yyvsp[0].command));
     }
-#line 4370 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4935 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 212:
-#line 1529 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 234: /* const: "(" CONST literal ")"  */
+#line 1678 "src/wast-parser.y"
+                            {
       (yyval.const_).loc = (yylsp[-2]);
       if (Failed(parse_const((yyvsp[-2].type), (yyvsp[-1].literal).type, (yyvsp[-1].literal).text.start,
                              (yyvsp[-1].literal).text.start + (yyvsp[-1].literal).text.length, &(yyval.const_)))) {
@@ -4381,35 +4946,35 @@ yyreduce:
       }
       delete [] (yyvsp[-1].literal).text.start;
     }
-#line 4385 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4950 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 213:
-#line 1541 "src/wast-parser.y" /* yacc.c:1646  */
-    { (yyval.consts) = new ConstVector(); }
-#line 4391 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+  case 235: /* const_list: %empty  */
+#line 1690 "src/wast-parser.y"
+                { (yyval.consts) = new ConstVector(); }
+#line 4956 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 214:
-#line 1542 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 236: /* const_list: const_list const  */
+#line 1691 "src/wast-parser.y"
+                     {
       (yyval.consts) = (yyvsp[-1].consts);
       (yyval.consts)->push_back((yyvsp[0].const_));
     }
-#line 4400 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4965 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 215:
-#line 1549 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 237: /* script: %empty  */
+#line 1698 "src/wast-parser.y"
+                {
       (yyval.script) = new Script();
     }
-#line 4408 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 4973 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 216:
-#line 1552 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 238: /* script: cmd_list  */
+#line 1701 "src/wast-parser.y"
+             {
       (yyval.script) = new Script();
       (yyval.script)->commands = std::move(*(yyvsp[0].commands));
       delete (yyvsp[0].commands);
@@ -4472,26 +5037,27 @@ yyreduce:
         }
       }
     }
-#line 4476 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 5041 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 217:
-#line 1615 "src/wast-parser.y" /* yacc.c:1646  */
-    {
+  case 239: /* script: inline_module  */
+#line 1764 "src/wast-parser.y"
+                  {
       (yyval.script) = new Script();
       (yyval.script)->commands.emplace_back(new ModuleCommand((yyvsp[0].module)));
     }
-#line 4485 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 5050 "src/prebuilt/wast-parser-gen.cc"
     break;
 
-  case 218:
-#line 1624 "src/wast-parser.y" /* yacc.c:1646  */
-    { parser->script = (yyvsp[0].script); }
-#line 4491 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+  case 240: /* script_start: script  */
+#line 1773 "src/wast-parser.y"
+           { parser->script = (yyvsp[0].script); }
+#line 5056 "src/prebuilt/wast-parser-gen.cc"
     break;
 
 
-#line 4495 "src/prebuilt/wast-parser-gen.cc" /* yacc.c:1646  */
+#line 5060 "src/prebuilt/wast-parser-gen.cc"
+
       default: break;
     }
   /* User semantic actions sometimes alter yychar, and that requires
@@ -4505,11 +5071,10 @@ yyreduce:
      case of YYERROR or YYBACKUP, subsequent parser actions might lead
      to an incorrect destructor call or verbose syntax error message
      before the lookahead is translated.  */
-  YY_SYMBOL_PRINT ("-> $$ =", yyr1[yyn], &yyval, &yyloc);
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
 
   YYPOPSTACK (yylen);
   yylen = 0;
-  YY_STACK_PRINT (yyss, yyssp);
 
   *++yyvsp = yyval;
   *++yylsp = yyloc;
@@ -4517,14 +5082,13 @@ yyreduce:
   /* Now 'shift' the result of the reduction.  Determine what state
      that goes to, based on the state we popped back to and the rule
      number reduced by.  */
-
-  yyn = yyr1[yyn];
-
-  yystate = yypgoto[yyn - YYNTOKENS] + *yyssp;
-  if (0 <= yystate && yystate <= YYLAST && yycheck[yystate] == *yyssp)
-    yystate = yytable[yystate];
-  else
-    yystate = yydefgoto[yyn - YYNTOKENS];
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
 
   goto yynewstate;
 
@@ -4535,66 +5099,61 @@ yyreduce:
 yyerrlab:
   /* Make sure we have latest lookahead translation.  See comments at
      user semantic actions for why this is necessary.  */
-  yytoken = yychar == YYEMPTY ? YYEMPTY : YYTRANSLATE (yychar);
-
+  yytoken = yychar == WABT_TOKEN_TYPE_WABT_WAST_PARSER_EMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
   /* If not already recovering from an error, report this error.  */
   if (!yyerrstatus)
     {
       ++yynerrs;
-#if ! YYERROR_VERBOSE
-      yyerror (&yylloc, lexer, parser, YY_("syntax error"));
-#else
-# define YYSYNTAX_ERROR yysyntax_error (&yymsg_alloc, &yymsg, \
-                                        yyssp, yytoken)
       {
+        yypcontext_t yyctx
+          = {yyssp, yytoken, &yylloc};
         char const *yymsgp = YY_("syntax error");
         int yysyntax_error_status;
-        yysyntax_error_status = YYSYNTAX_ERROR;
+        yysyntax_error_status = yysyntax_error (&yymsg_alloc, &yymsg, &yyctx);
         if (yysyntax_error_status == 0)
           yymsgp = yymsg;
-        else if (yysyntax_error_status == 1)
+        else if (yysyntax_error_status == -1)
           {
             if (yymsg != yymsgbuf)
               YYSTACK_FREE (yymsg);
-            yymsg = (char *) YYSTACK_ALLOC (yymsg_alloc);
-            if (!yymsg)
+            yymsg = YY_CAST (char *,
+                             YYSTACK_ALLOC (YY_CAST (YYSIZE_T, yymsg_alloc)));
+            if (yymsg)
               {
-                yymsg = yymsgbuf;
-                yymsg_alloc = sizeof yymsgbuf;
-                yysyntax_error_status = 2;
+                yysyntax_error_status
+                  = yysyntax_error (&yymsg_alloc, &yymsg, &yyctx);
+                yymsgp = yymsg;
               }
             else
               {
-                yysyntax_error_status = YYSYNTAX_ERROR;
-                yymsgp = yymsg;
+                yymsg = yymsgbuf;
+                yymsg_alloc = sizeof yymsgbuf;
+                yysyntax_error_status = YYENOMEM;
               }
           }
         yyerror (&yylloc, lexer, parser, yymsgp);
-        if (yysyntax_error_status == 2)
-          goto yyexhaustedlab;
+        if (yysyntax_error_status == YYENOMEM)
+          YYNOMEM;
       }
-# undef YYSYNTAX_ERROR
-#endif
     }
 
   yyerror_range[1] = yylloc;
-
   if (yyerrstatus == 3)
     {
       /* If just tried and failed to reuse lookahead token after an
          error, discard it.  */
 
-      if (yychar <= YYEOF)
+      if (yychar <= WABT_TOKEN_TYPE_EOF)
         {
           /* Return failure if at end of input.  */
-          if (yychar == YYEOF)
+          if (yychar == WABT_TOKEN_TYPE_EOF)
             YYABORT;
         }
       else
         {
           yydestruct ("Error: discarding",
                       yytoken, &yylval, &yylloc, lexer, parser);
-          yychar = YYEMPTY;
+          yychar = WABT_TOKEN_TYPE_WABT_WAST_PARSER_EMPTY;
         }
     }
 
@@ -4607,14 +5166,12 @@ yyerrlab:
 | yyerrorlab -- error raised explicitly by YYERROR.  |
 `---------------------------------------------------*/
 yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
 
-  /* Pacify compilers like GCC when the user code never invokes
-     YYERROR and the label yyerrorlab therefore never appears in user
-     code.  */
-  if (/*CONSTCOND*/ 0)
-     goto yyerrorlab;
-
-  yyerror_range[1] = yylsp[1-yylen];
   /* Do not reclaim the symbols of the rule whose action triggered
      this YYERROR.  */
   YYPOPSTACK (yylen);
@@ -4630,13 +5187,14 @@ yyerrorlab:
 yyerrlab1:
   yyerrstatus = 3;      /* Each real token shifted decrements this.  */
 
+  /* Pop stack until we find a state that shifts the error token.  */
   for (;;)
     {
       yyn = yypact[yystate];
       if (!yypact_value_is_default (yyn))
         {
-          yyn += YYTERROR;
-          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYTERROR)
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
             {
               yyn = yytable[yyn];
               if (0 < yyn)
@@ -4650,7 +5208,7 @@ yyerrlab1:
 
       yyerror_range[1] = *yylsp;
       yydestruct ("Error: popping",
-                  yystos[yystate], yyvsp, yylsp, lexer, parser);
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp, yylsp, lexer, parser);
       YYPOPSTACK (1);
       yystate = *yyssp;
       YY_STACK_PRINT (yyss, yyssp);
@@ -4661,13 +5219,11 @@ yyerrlab1:
   YY_IGNORE_MAYBE_UNINITIALIZED_END
 
   yyerror_range[2] = yylloc;
-  /* Using YYLLOC is tempting, but would change the location of
-     the lookahead.  YYLOC is available though.  */
-  YYLLOC_DEFAULT (yyloc, yyerror_range, 2);
-  *++yylsp = yyloc;
+  ++yylsp;
+  YYLLOC_DEFAULT (*yylsp, yyerror_range, 2);
 
   /* Shift the error token.  */
-  YY_SYMBOL_PRINT ("Shifting", yystos[yyn], yyvsp, yylsp);
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
 
   yystate = yyn;
   goto yynewstate;
@@ -4678,27 +5234,31 @@ yyerrlab1:
 `-------------------------------------*/
 yyacceptlab:
   yyresult = 0;
-  goto yyreturn;
+  goto yyreturnlab;
+
 
 /*-----------------------------------.
 | yyabortlab -- YYABORT comes here.  |
 `-----------------------------------*/
 yyabortlab:
   yyresult = 1;
-  goto yyreturn;
+  goto yyreturnlab;
+
 
-#if !defined yyoverflow || YYERROR_VERBOSE
-/*-------------------------------------------------.
-| yyexhaustedlab -- memory exhaustion comes here.  |
-`-------------------------------------------------*/
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
 yyexhaustedlab:
   yyerror (&yylloc, lexer, parser, YY_("memory exhausted"));
   yyresult = 2;
-  /* Fall through.  */
-#endif
+  goto yyreturnlab;
+
 
-yyreturn:
-  if (yychar != YYEMPTY)
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != WABT_TOKEN_TYPE_WABT_WAST_PARSER_EMPTY)
     {
       /* Make sure we have latest lookahead translation.  See comments at
          user semantic actions for why this is necessary.  */
@@ -4713,20 +5273,19 @@ yyreturn:
   while (yyssp != yyss)
     {
       yydestruct ("Cleanup: popping",
-                  yystos[*yyssp], yyvsp, yylsp, lexer, parser);
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp, yylsp, lexer, parser);
       YYPOPSTACK (1);
     }
 #ifndef yyoverflow
   if (yyss != yyssa)
     YYSTACK_FREE (yyss);
 #endif
-#if YYERROR_VERBOSE
   if (yymsg != yymsgbuf)
     YYSTACK_FREE (yymsg);
-#endif
   return yyresult;
 }
-#line 1627 "src/wast-parser.y" /* yacc.c:1906  */
+
+#line 1776 "src/wast-parser.y"
 
 
 Result parse_const(Type type,
@@ -4751,6 +5310,71 @@ Result parse_const(Type type,
   return Result::Error;
 }
 
+size_t get_simd_shape_lane_count(SimdShape shape) {
+  switch (shape) {
+    case SimdShape::I8X16: return 16;
+    case SimdShape::I16X8: return 8;
+    case SimdShape::I32X4: return 4;
+    case SimdShape::I64X2: return 2;
+    case SimdShape::F32X4: return 4;
+    case SimdShape::F64X2: return 2;
+  }
+  WABT_UNREACHABLE;
+}
+
+// Parses lane |index| of a v128.const written with |shape| into |out|. The
+// lanes are stored little-endian, so lane 0 is in the low bits of out->v[0].
+Result parse_simd_lane(SimdShape shape,
+                       const Literal& lane,
+                       size_t index,
+                       v128* out) {
+  const char* s = lane.text.start;
+  const char* end = lane.text.start + lane.text.length;
+  switch (shape) {
+    case SimdShape::I8X16:
+    case SimdShape::I16X8: {
+      uint32_t value;
+      if (Failed(parse_int32(s, end, &value,
+                             ParseIntType::SignedAndUnsigned))) {
+        return Result::Error;
+      }
+      int lane_bits = shape == SimdShape::I8X16 ? 8 : 16;
+      // Accept both the signed and the unsigned range of the lane.
+      int32_t signed_value = static_cast<int32_t>(value);
+      if (signed_value < -(1 << (lane_bits - 1)) ||
+          signed_value >= (1 << lane_bits)) {
+        return Result::Error;
+      }
+      size_t bit = index * lane_bits;
+      uint32_t mask = (1u << lane_bits) - 1;
+      out->v[bit / 32] |= (value & mask) << (bit % 32);
+      return Result::Ok;
+    }
+
+    case SimdShape::I32X4:
+      return parse_int32(s, end, &out->v[index],
+                         ParseIntType::SignedAndUnsigned);
+
+    case SimdShape::F32X4:
+      return parse_float(lane.type, s, end, &out->v[index]);
+
+    case SimdShape::I64X2:
+    case SimdShape::F64X2: {
+      uint64_t value;
+      Result result =
+          shape == SimdShape::I64X2
+              ? parse_int64(s, end, &value, ParseIntType::SignedAndUnsigned)
+              : parse_double(lane.type, s, end, &value);
+      if (Failed(result))
+        return Result::Error;
+      out->v[index * 2] = static_cast<uint32_t>(value);
+      out->v[index * 2 + 1] = static_cast<uint32_t>(value >> 32);
+      return Result::Ok;
+    }
+  }
+  WABT_UNREACHABLE;
+}
+
 size_t CopyStringContents(StringSlice* text, char* dest) {
   const char* src = text->start + 1;
   const char* end = text->start + text->length - 1;
@@ -4851,6 +5475,62 @@ void append_implicit_func_declaration(Location* loc,
   }
 }
 
+// Block signatures with more than one result are encoded as a type index, so
+// make sure a matching func type exists.
+void append_block_sig_func_type(Location* loc,
+                                Module* module,
+                                const BlockSignature& sig) {
+  if (sig.size() <= 1)
+    return;
+
+  FuncSignature func_sig;
+  func_sig.result_types = sig;
+  if (module->GetFuncTypeIndex(func_sig) == kInvalidIndex)
+    module->AppendImplicitFuncType(*loc, func_sig);
+}
+
+void append_block_func_types(Location* loc,
+                             Module* module,
+                             const ExprList& exprs) {
+  for (const Expr& expr : exprs) {
+    switch (expr.type) {
+      case ExprType::Block: {
+        const Block* block = cast<BlockExpr>(&expr)->block;
+        append_block_sig_func_type(loc, module, block->sig);
+        append_block_func_types(loc, module, block->exprs);
+        break;
+      }
+
+      case ExprType::Loop: {
+        const Block* block = cast<LoopExpr>(&expr)->block;
+        append_block_sig_func_type(loc, module, block->sig);
+        append_block_func_types(loc, module, block->exprs);
+        break;
+      }
+
+      case ExprType::If: {
+        const IfExpr* if_expr = cast<IfExpr>(&expr);
+        append_block_sig_func_type(loc, module, if_expr->true_->sig);
+        append_block_func_types(loc, module, if_expr->true_->exprs);
+        append_block_func_types(loc, module, if_expr->false_);
+        break;
+      }
+
+      case ExprType::TryBlock: {
+        const TryExpr* try_expr = cast<TryExpr>(&expr);
+        append_block_sig_func_type(loc, module, try_expr->block->sig);
+        append_block_func_types(loc, module, try_expr->block->exprs);
+        for (const Catch* catch_ : try_expr->catches)
+          append_block_func_types(loc, module, catch_->exprs);
+        break;
+      }
+
+      default:
+        break;
+    }
+  }
+}
+
 void check_import_ordering(Location* loc, WastLexer* lexer, WastParser* parser,
                            Module* module, const ModuleFieldList& fields) {
   for (const ModuleField& field: fields) {
@@ -4881,6 +5561,7 @@ void append_module_fields(Module* module, ModuleFieldList* fields) {
       case ModuleFieldType::Func: {
         Func* func = cast<FuncModuleField>(&field)->func;
         append_implicit_func_declaration(&field.loc, module, &func->decl);
+        append_block_func_types(&field.loc, module, func->exprs);
         name = &func->name;
         bindings = &module->func_bindings;
         index = module->funcs.size();
@@ -1,8 +1,9 @@
-/* A Bison parser, made by GNU Bison 3.0.4.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison interface for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989-1990, 2000-2015 Free Software Foundation, Inc.
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
 
    This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
@@ -15,7 +16,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -30,6 +31,10 @@
    This special exception was added by the Free Software Foundation in
    version 2.2 of Bison.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 #ifndef YY_WABT_WAST_PARSER_SRC_PREBUILT_WAST_PARSER_GEN_HH_INCLUDED
 # define YY_WABT_WAST_PARSER_SRC_PREBUILT_WAST_PARSER_GEN_HH_INCLUDED
 /* Debug traces.  */
@@ -48,92 +53,115 @@
 extern int wabt_wast_parser_debug;
 #endif
 
-/* Token type.  */
+/* Token kinds.  */
 #ifndef WABT_WAST_PARSER_TOKENTYPE
 # define WABT_WAST_PARSER_TOKENTYPE
   enum wabt_wast_parser_tokentype
   {
-    WABT_TOKEN_TYPE_EOF = 0,
-    WABT_TOKEN_TYPE_LPAR = 258,
-    WABT_TOKEN_TYPE_RPAR = 259,
-    WABT_TOKEN_TYPE_NAT = 260,
-    WABT_TOKEN_TYPE_INT = 261,
-    WABT_TOKEN_TYPE_FLOAT = 262,
-    WABT_TOKEN_TYPE_TEXT = 263,
-    WABT_TOKEN_TYPE_VAR = 264,
-    WABT_TOKEN_TYPE_VALUE_TYPE = 265,
-    WABT_TOKEN_TYPE_ANYFUNC = 266,
-    WABT_TOKEN_TYPE_MUT = 267,
-    WABT_TOKEN_TYPE_NOP = 268,
-    WABT_TOKEN_TYPE_DROP = 269,
-    WABT_TOKEN_TYPE_BLOCK = 270,
-    WABT_TOKEN_TYPE_END = 271,
-    WABT_TOKEN_TYPE_IF = 272,
-    WABT_TOKEN_TYPE_THEN = 273,
-    WABT_TOKEN_TYPE_ELSE = 274,
-    WABT_TOKEN_TYPE_LOOP = 275,
-    WABT_TOKEN_TYPE_BR = 276,
-    WABT_TOKEN_TYPE_BR_IF = 277,
-    WABT_TOKEN_TYPE_BR_TABLE = 278,
-    WABT_TOKEN_TYPE_TRY = 279,
-    WABT_TOKEN_TYPE_CATCH = 280,
-    WABT_TOKEN_TYPE_CATCH_ALL = 281,
-    WABT_TOKEN_TYPE_THROW = 282,
-    WABT_TOKEN_TYPE_RETHROW = 283,
-    WABT_TOKEN_TYPE_LPAR_CATCH = 284,
-    WABT_TOKEN_TYPE_LPAR_CATCH_ALL = 285,
-    WABT_TOKEN_TYPE_CALL = 286,
-    WABT_TOKEN_TYPE_CALL_INDIRECT = 287,
-    WABT_TOKEN_TYPE_RETURN = 288,
-    WABT_TOKEN_TYPE_GET_LOCAL = 289,
-    WABT_TOKEN_TYPE_SET_LOCAL = 290,
-    WABT_TOKEN_TYPE_TEE_LOCAL = 291,
-    WABT_TOKEN_TYPE_GET_GLOBAL = 292,
-    WABT_TOKEN_TYPE_SET_GLOBAL = 293,
-    WABT_TOKEN_TYPE_LOAD = 294,
-    WABT_TOKEN_TYPE_STORE = 295,
-    WABT_TOKEN_TYPE_OFFSET_EQ_NAT = 296,
-    WABT_TOKEN_TYPE_ALIGN_EQ_NAT = 297,
-    WABT_TOKEN_TYPE_CONST = 298,
-    WABT_TOKEN_TYPE_UNARY = 299,
-    WABT_TOKEN_TYPE_BINARY = 300,
-    WABT_TOKEN_TYPE_COMPARE = 301,
-    WABT_TOKEN_TYPE_CONVERT = 302,
-    WABT_TOKEN_TYPE_SELECT = 303,
-    WABT_TOKEN_TYPE_UNREACHABLE = 304,
-    WABT_TOKEN_TYPE_CURRENT_MEMORY = 305,
-    WABT_TOKEN_TYPE_GROW_MEMORY = 306,
-    WABT_TOKEN_TYPE_FUNC = 307,
-    WABT_TOKEN_TYPE_START = 308,
-    WABT_TOKEN_TYPE_TYPE = 309,
-    WABT_TOKEN_TYPE_PARAM = 310,
-    WABT_TOKEN_TYPE_RESULT = 311,
-    WABT_TOKEN_TYPE_LOCAL = 312,
-    WABT_TOKEN_TYPE_GLOBAL = 313,
-    WABT_TOKEN_TYPE_TABLE = 314,
-    WABT_TOKEN_TYPE_ELEM = 315,
-    WABT_TOKEN_TYPE_MEMORY = 316,
-    WABT_TOKEN_TYPE_DATA = 317,
-    WABT_TOKEN_TYPE_OFFSET = 318,
-    WABT_TOKEN_TYPE_IMPORT = 319,
-    WABT_TOKEN_TYPE_EXPORT = 320,
-    WABT_TOKEN_TYPE_EXCEPT = 321,
-    WABT_TOKEN_TYPE_MODULE = 322,
-    WABT_TOKEN_TYPE_BIN = 323,
-    WABT_TOKEN_TYPE_QUOTE = 324,
-    WABT_TOKEN_TYPE_REGISTER = 325,
-    WABT_TOKEN_TYPE_INVOKE = 326,
-    WABT_TOKEN_TYPE_GET = 327,
-    WABT_TOKEN_TYPE_ASSERT_MALFORMED = 328,
-    WABT_TOKEN_TYPE_ASSERT_INVALID = 329,
-    WABT_TOKEN_TYPE_ASSERT_UNLINKABLE = 330,
-    WABT_TOKEN_TYPE_ASSERT_RETURN = 331,
-    WABT_TOKEN_TYPE_ASSERT_RETURN_CANONICAL_NAN = 332,
-    WABT_TOKEN_TYPE_ASSERT_RETURN_ARITHMETIC_NAN = 333,
-    WABT_TOKEN_TYPE_ASSERT_TRAP = 334,
-    WABT_TOKEN_TYPE_ASSERT_EXHAUSTION = 335,
-    WABT_TOKEN_TYPE_LOW = 336
+    WABT_TOKEN_TYPE_WABT_WAST_PARSER_EMPTY = -2,
+    WABT_TOKEN_TYPE_EOF = 0,       /* "EOF"  */
+    WABT_TOKEN_TYPE_WABT_WAST_PARSER_error = 256, /* error  */
+    WABT_TOKEN_TYPE_WABT_WAST_PARSER_UNDEF = 257, /* "invalid token"  */
+    WABT_TOKEN_TYPE_LPAR = 258,    /* "("  */
+    WABT_TOKEN_TYPE_RPAR = 259,    /* ")"  */
+    WABT_TOKEN_TYPE_NAT = 260,     /* NAT  */
+    WABT_TOKEN_TYPE_INT = 261,     /* INT  */
+    WABT_TOKEN_TYPE_FLOAT = 262,   /* FLOAT  */
+    WABT_TOKEN_TYPE_TEXT = 263,    /* TEXT  */
+    WABT_TOKEN_TYPE_VAR = 264,     /* VAR  */
+    WABT_TOKEN_TYPE_VALUE_TYPE = 265, /* VALUE_TYPE  */
+    WABT_TOKEN_TYPE_ANYFUNC = 266, /* ANYFUNC  */
+    WABT_TOKEN_TYPE_MUT = 267,     /* MUT  */
+    WABT_TOKEN_TYPE_NOP = 268,     /* NOP  */
+    WABT_TOKEN_TYPE_DROP = 269,    /* DROP  */
+    WABT_TOKEN_TYPE_BLOCK = 270,   /* BLOCK  */
+    WABT_TOKEN_TYPE_END = 271,     /* END  */
+    WABT_TOKEN_TYPE_IF = 272,      /* IF  */
+    WABT_TOKEN_TYPE_THEN = 273,    /* THEN  */
+    WABT_TOKEN_TYPE_ELSE = 274,    /* ELSE  */
+    WABT_TOKEN_TYPE_LOOP = 275,    /* LOOP  */
+    WABT_TOKEN_TYPE_BR = 276,      /* BR  */
+    WABT_TOKEN_TYPE_BR_IF = 277,   /* BR_IF  */
+    WABT_TOKEN_TYPE_BR_TABLE = 278, /* BR_TABLE  */
+    WABT_TOKEN_TYPE_TRY = 279,     /* TRY  */
+    WABT_TOKEN_TYPE_CATCH = 280,   /* CATCH  */
+    WABT_TOKEN_TYPE_CATCH_ALL = 281, /* CATCH_ALL  */
+    WABT_TOKEN_TYPE_THROW = 282,   /* THROW  */
+    WABT_TOKEN_TYPE_RETHROW = 283, /* RETHROW  */
+    WABT_TOKEN_TYPE_LPAR_CATCH = 284, /* LPAR_CATCH  */
+    WABT_TOKEN_TYPE_LPAR_CATCH_ALL = 285, /* LPAR_CATCH_ALL  */
+    WABT_TOKEN_TYPE_CALL = 286,    /* CALL  */
+    WABT_TOKEN_TYPE_CALL_INDIRECT = 287, /* CALL_INDIRECT  */
+    WABT_TOKEN_TYPE_RETURN = 288,  /* RETURN  */
+    WABT_TOKEN_TYPE_RETURN_CALL = 289, /* RETURN_CALL  */
+    WABT_TOKEN_TYPE_RETURN_CALL_INDIRECT = 290, /* RETURN_CALL_INDIRECT  */
+    WABT_TOKEN_TYPE_GET_LOCAL = 291, /* GET_LOCAL  */
+    WABT_TOKEN_TYPE_SET_LOCAL = 292, /* SET_LOCAL  */
+    WABT_TOKEN_TYPE_TEE_LOCAL = 293, /* TEE_LOCAL  */
+    WABT_TOKEN_TYPE_GET_GLOBAL = 294, /* GET_GLOBAL  */
+    WABT_TOKEN_TYPE_SET_GLOBAL = 295, /* SET_GLOBAL  */
+    WABT_TOKEN_TYPE_LOAD = 296,    /* LOAD  */
+    WABT_TOKEN_TYPE_STORE = 297,   /* STORE  */
+    WABT_TOKEN_TYPE_OFFSET_EQ_NAT = 298, /* OFFSET_EQ_NAT  */
+    WABT_TOKEN_TYPE_ALIGN_EQ_NAT = 299, /* ALIGN_EQ_NAT  */
+    WABT_TOKEN_TYPE_ATOMIC_LOAD = 300, /* ATOMIC_LOAD  */
+    WABT_TOKEN_TYPE_ATOMIC_STORE = 301, /* ATOMIC_STORE  */
+    WABT_TOKEN_TYPE_ATOMIC_RMW = 302, /* ATOMIC_RMW  */
+    WABT_TOKEN_TYPE_ATOMIC_RMW_CMPXCHG = 303, /* ATOMIC_RMW_CMPXCHG  */
+    WABT_TOKEN_TYPE_ATOMIC_WAIT = 304, /* ATOMIC_WAIT  */
+    WABT_TOKEN_TYPE_ATOMIC_NOTIFY = 305, /* ATOMIC_NOTIFY  */
+    WABT_TOKEN_TYPE_CONST = 306,   /* CONST  */
+    WABT_TOKEN_TYPE_UNARY = 307,   /* UNARY  */
+    WABT_TOKEN_TYPE_BINARY = 308,  /* BINARY  */
+    WABT_TOKEN_TYPE_COMPARE = 309, /* COMPARE  */
+    WABT_TOKEN_TYPE_CONVERT = 310, /* CONVERT  */
+    WABT_TOKEN_TYPE_SELECT = 311,  /* SELECT  */
+    WABT_TOKEN_TYPE_UNREACHABLE = 312, /* UNREACHABLE  */
+    WABT_TOKEN_TYPE_CURRENT_MEMORY = 313, /* CURRENT_MEMORY  */
+    WABT_TOKEN_TYPE_GROW_MEMORY = 314, /* GROW_MEMORY  */
+    WABT_TOKEN_TYPE_MEMORY_COPY = 315, /* MEMORY_COPY  */
+    WABT_TOKEN_TYPE_MEMORY_FILL = 316, /* MEMORY_FILL  */
+    WABT_TOKEN_TYPE_V128_CONST = 317, /* V128_CONST  */
+    WABT_TOKEN_TYPE_SIMD_LANE_OP = 318, /* SIMD_LANE_OP  */
+    WABT_TOKEN_TYPE_I8X16 = 319,   /* I8X16  */
+    WABT_TOKEN_TYPE_I16X8 = 320,   /* I16X8  */
+    WABT_TOKEN_TYPE_I32X4 = 321,   /* I32X4  */
+    WABT_TOKEN_TYPE_I64X2 = 322,   /* I64X2  */
+    WABT_TOKEN_TYPE_F32X4 = 323,   /* F32X4  */
+    WABT_TOKEN_TYPE_F64X2 = 324,   /* F64X2  */
+    WABT_TOKEN_TYPE_FUNC = 325,    /* FUNC  */
+    WABT_TOKEN_TYPE_START = 326,   /* START  */
+    WABT_TOKEN_TYPE_TYPE = 327,    /* TYPE  */
+    WABT_TOKEN_TYPE_PARAM = 328,   /* PARAM  */
+    WABT_TOKEN_TYPE_RESULT = 329,  /* RESULT  */
+    WABT_TOKEN_TYPE_LOCAL = 330,   /* LOCAL  */
+    WABT_TOKEN_TYPE_GLOBAL = 331,  /* GLOBAL  */
+    WABT_TOKEN_TYPE_TABLE = 332,   /* TABLE  */
+    WABT_TOKEN_TYPE_ELEM = 333,    /* ELEM  */
+    WABT_TOKEN_TYPE_MEMORY = 334,  /* MEMORY  */
+    WABT_TOKEN_TYPE_DATA = 335,    /* DATA  */
+    WABT_TOKEN_TYPE_OFFSET = 336,  /* OFFSET  */
+    WABT_TOKEN_TYPE_IMPORT = 337,  /* IMPORT  */
+    WABT_TOKEN_TYPE_EXPORT = 338,  /* EXPORT  */
+    WABT_TOKEN_TYPE_EXCEPT = 339,  /* EXCEPT  */
+    WABT_TOKEN_TYPE_SHARED = 340,  /* SHARED  */
+    WABT_TOKEN_TYPE_MODULE = 341,  /* MODULE  */
+    WABT_TOKEN_TYPE_BIN = 342,     /* BIN  */
+    WABT_TOKEN_TYPE_QUOTE = 343,   /* QUOTE  */
+    WABT_TOKEN_TYPE_REGISTER = 344, /* REGISTER  */
+    WABT_TOKEN_TYPE_INVOKE = 345,  /* INVOKE  */
+    WABT_TOKEN_TYPE_GET = 346,     /* GET  */
+    WABT_TOKEN_TYPE_ASSERT_MALFORMED = 347, /* ASSERT_MALFORMED  */
+    WABT_TOKEN_TYPE_ASSERT_INVALID = 348, /* ASSERT_INVALID  */
+    WABT_TOKEN_TYPE_ASSERT_UNLINKABLE = 349, /* ASSERT_UNLINKABLE  */
+    WABT_TOKEN_TYPE_ASSERT_RETURN = 350, /* ASSERT_RETURN  */
+    WABT_TOKEN_TYPE_ASSERT_RETURN_CANONICAL_NAN = 351, /* ASSERT_RETURN_CANONICAL_NAN  */
+    WABT_TOKEN_TYPE_ASSERT_RETURN_ARITHMETIC_NAN = 352, /* ASSERT_RETURN_ARITHMETIC_NAN  */
+    WABT_TOKEN_TYPE_ASSERT_TRAP = 353, /* ASSERT_TRAP  */
+    WABT_TOKEN_TYPE_ASSERT_EXHAUSTION = 354, /* ASSERT_EXHAUSTION  */
+    WABT_TOKEN_TYPE_LOW = 355      /* LOW  */
   };
+  typedef enum wabt_wast_parser_tokentype wabt_wast_parser_token_kind_t;
 #endif
 
 /* Value type.  */
@@ -159,6 +187,8 @@ struct WABT_WAST_PARSER_LTYPE
 
 
 
+
 int wabt_wast_parser_parse (::wabt::WastLexer* lexer, ::wabt::WastParser* parser);
 
+
 #endif /* !YY_WABT_WAST_PARSER_SRC_PREBUILT_WAST_PARSER_GEN_HH_INCLUDED  */
@@ -0,0 +1,80 @@
+/*
+ * Copyright 2017 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "arena.h"
+#include "cast.h"
+#include "ir.h"
+
+using namespace wabt;
+
+TEST(arena, alignment) {
+  Arena arena;
+  for (size_t alignment = 1; alignment <= alignof(std::max_align_t);
+       alignment *= 2) {
+    arena.Allocate(1, 1);
+    void* p = arena.Allocate(3, alignment);
+    ASSERT_EQ(0u, reinterpret_cast<uintptr_t>(p) % alignment);
+  }
+}
+
+TEST(arena, allocations_dont_overlap) {
+  Arena arena;
+  std::vector<char*> allocations;
+  for (int i = 0; i < 10000; ++i) {
+    char* p = static_cast<char*>(arena.Allocate(24, 8));
+    memset(p, i & 0xff, 24);
+    allocations.push_back(p);
+  }
+  for (int i = 0; i < 10000; ++i) {
+    for (int j = 0; j < 24; ++j)
+      ASSERT_EQ(i & 0xff, static_cast<uint8_t>(allocations[i][j]));
+  }
+}
+
+TEST(arena, large_allocation) {
+  Arena arena;
+  arena.Allocate(16, 8);
+  const size_t kSize = 16 * 1024 * 1024;
+  char* p = static_cast<char*>(arena.Allocate(kSize, 8));
+  memset(p, 0, kSize);
+  ASSERT_GE(arena.reserved_size(), kSize);
+  // The allocations after it still fit.
+  arena.Allocate(16, 8);
+  ASSERT_LT(arena.reserved_size(), 2 * kSize);
+}
+
+TEST(arena, expr_list) {
+  Arena arena;
+  ExprList exprs;
+  exprs.push_back(MakeArenaExpr<NopExpr>(&arena));
+  // Long enough that the name is allocated on the heap, so a leak would show.
+  exprs.push_back(MakeArenaExpr<BrExpr>(
+      &arena, Var("$a_label_name_that_is_too_long_to_be_stored_inline")));
+  exprs.push_back(MakeArenaExpr<ConstExpr>(&arena, Const(Const::I32(), 42)));
+  ASSERT_EQ(ExprType::Br, (++exprs.begin())->type);
+
+  // Erasing an arena Expr runs its destructor, but doesn't free it.
+  exprs.erase(++exprs.begin());
+  ASSERT_EQ(2u, exprs.size());
+  ASSERT_EQ(ExprType::Const, exprs.back().type);
+  ASSERT_EQ(42u, cast<ConstExpr>(&exprs.back())->const_.u32);
+}
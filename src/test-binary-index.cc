@@ -0,0 +1,145 @@
+/*
+ * Copyright 2017 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+
+#include <string>
+#include <vector>
+
+#include "binary-reader.h"
+#include "binary-reader-logging.h"
+#include "binary-reader-nop.h"
+#include "stream.h"
+
+using namespace wabt;
+
+namespace {
+
+const uint8_t kModule[] = {
+    // header
+    0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00,
+    // type: (func (result i32))
+    0x01, 0x05, 0x01, 0x60, 0x00, 0x01, 0x7f,
+    // import: (import "a" "b" (func (type 0)))
+    0x02, 0x07, 0x01, 0x01, 0x61, 0x01, 0x62, 0x00, 0x00,
+    // function: two functions of type 0
+    0x03, 0x03, 0x02, 0x00, 0x00,
+    // export: (export "foo" (func 1))
+    0x07, 0x07, 0x01, 0x03, 0x66, 0x6f, 0x6f, 0x00, 0x01,
+    // code: (i32.const 42), (block (result i32) (call 0))
+    0x0a, 0x0e, 0x02, 0x04, 0x00, 0x41, 0x2a, 0x0b, 0x07, 0x00, 0x02, 0x7f,
+    0x10, 0x00, 0x0b, 0x0b,
+    // custom: "hi" "x"
+    0x00, 0x04, 0x02, 0x68, 0x69, 0x78,
+};
+
+// The logged callbacks, without the indentation, which depends on where
+// reading started.
+std::string GetLog(MemoryStream& log) {
+  const std::vector<uint8_t>& data = log.writer().output_buffer().data;
+  std::string result;
+  bool line_start = true;
+  for (uint8_t c : data) {
+    if (line_start && c == ' ')
+      continue;
+    line_start = c == '\n';
+    result += c;
+  }
+  return result;
+}
+
+std::string ReadModule() {
+  MemoryStream log;
+  BinaryReaderNop nop;
+  BinaryReaderLogging delegate(&log, &nop);
+  ReadBinaryOptions options;
+  EXPECT_EQ(Result::Ok, read_binary(kModule, sizeof(kModule), &delegate,
+                                    &options));
+  return GetLog(log);
+}
+
+}  // end anonymous namespace
+
+TEST(binary_index, sections) {
+  ReadBinaryOptions options;
+  BinaryIndex index;
+  ASSERT_EQ(Result::Ok,
+            read_binary_index(kModule, sizeof(kModule), &options, &index));
+  EXPECT_EQ(1u, index.version);
+  ASSERT_EQ(6u, index.sections.size());
+  EXPECT_EQ(BinarySection::Code, index.sections[4].section);
+  EXPECT_EQ(0x28u, index.sections[4].offset);
+  EXPECT_EQ(0x0eu, index.sections[4].size);
+  EXPECT_EQ(2u, index.sections[4].count);
+  EXPECT_EQ("hi", index.sections[5].name);
+
+  EXPECT_EQ(4u, index.FindSection(BinarySection::Code));
+  EXPECT_EQ(kInvalidIndex, index.FindSection(BinarySection::Data));
+  EXPECT_EQ(5u, index.FindCustomSection("hi"));
+  EXPECT_EQ(kInvalidIndex, index.FindCustomSection("name"));
+
+  ASSERT_EQ(2u, index.function_bodies.size());
+  EXPECT_EQ(0x29u, index.function_bodies[0].offset);
+  EXPECT_EQ(5u, index.function_bodies[0].size);
+  EXPECT_EQ(0x2eu, index.function_bodies[1].offset);
+  EXPECT_EQ(8u, index.function_bodies[1].size);
+  EXPECT_EQ(1u, index.num_func_imports);
+  EXPECT_EQ(2u, index.num_function_signatures);
+}
+
+// Each section and function body read on its own makes the same callbacks as
+// when it is read as part of the whole module.
+TEST(binary_index, random_access) {
+  std::string expected = ReadModule();
+  ReadBinaryOptions options;
+  BinaryIndex index;
+  ASSERT_EQ(Result::Ok,
+            read_binary_index(kModule, sizeof(kModule), &options, &index));
+
+  for (Index i = 0; i < index.sections.size(); ++i) {
+    SCOPED_TRACE(i);
+    MemoryStream log;
+    BinaryReaderNop nop;
+    BinaryReaderLogging delegate(&log, &nop);
+    ASSERT_EQ(Result::Ok, read_binary_section(kModule, sizeof(kModule), index,
+                                              i, &delegate, &options));
+    std::string actual = GetLog(log);
+    EXPECT_EQ(0u, actual.find("Begin"));
+    EXPECT_NE(std::string::npos, expected.find(actual));
+  }
+
+  for (Index i = 0; i < index.function_bodies.size(); ++i) {
+    SCOPED_TRACE(i);
+    MemoryStream log;
+    BinaryReaderNop nop;
+    BinaryReaderLogging delegate(&log, &nop);
+    ASSERT_EQ(Result::Ok,
+              read_binary_function_body(kModule, sizeof(kModule), index, i,
+                                        &delegate, &options));
+    std::string actual = GetLog(log);
+    EXPECT_EQ(0u, actual.find("BeginFunctionBody"));
+    EXPECT_NE(std::string::npos, expected.find(actual));
+  }
+}
+
+TEST(binary_index, truncated_function_body) {
+  std::vector<uint8_t> data(kModule, kModule + sizeof(kModule));
+  data[0x2e] = 0x20;  // The second body now runs past the code section.
+  ReadBinaryOptions options;
+  BinaryIndex index;
+  EXPECT_EQ(Result::Error,
+            read_binary_index(data.data(), data.size(), &options, &index));
+}
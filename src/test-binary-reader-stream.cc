@@ -0,0 +1,182 @@
+/*
+ * Copyright 2017 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "binary-reader-impl.h"
+#include "binary-reader-interpreter.h"
+#include "binary-reader-logging.h"
+#include "binary-reader-nop.h"
+#include "error-handler.h"
+#include "interpreter.h"
+#include "stream.h"
+
+using namespace wabt;
+
+namespace {
+
+const uint8_t kModule[] = {
+    // header
+    0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00,
+    // type: (func (result i32))
+    0x01, 0x05, 0x01, 0x60, 0x00, 0x01, 0x7f,
+    // function: two functions of type 0
+    0x03, 0x03, 0x02, 0x00, 0x00,
+    // memory: (memory 1)
+    0x05, 0x03, 0x01, 0x00, 0x01,
+    // export: (export "foo" (func 0))
+    0x07, 0x07, 0x01, 0x03, 0x66, 0x6f, 0x6f, 0x00, 0x00,
+    // code: (i32.const 42), (local i32) (get_local 0)
+    0x0a, 0x0d, 0x02, 0x04, 0x00, 0x41, 0x2a, 0x0b, 0x06, 0x01, 0x01, 0x7f,
+    0x20, 0x00, 0x0b,
+    // data: (data (i32.const 0) "abc")
+    0x0b, 0x09, 0x01, 0x00, 0x41, 0x00, 0x0b, 0x03, 0x61, 0x62, 0x63,
+};
+
+class BinaryReaderError : public BinaryReaderNop {
+ public:
+  bool OnError(const char* message) override {
+    error = message;
+    return true;
+  }
+
+  std::string error;
+};
+
+struct ReadResult {
+  Result result;
+  std::string log;  // The callbacks made, as logged by BinaryReaderLogging.
+  std::string error;
+};
+
+// If |chunk_size| is 0, |data| is read all at once, otherwise it is pushed
+// |chunk_size| bytes at a time.
+ReadResult ReadModule(const uint8_t* data, size_t size, size_t chunk_size) {
+  MemoryStream log;
+  BinaryReaderError error_delegate;
+  BinaryReaderLogging delegate(&log, &error_delegate);
+  ReadBinaryOptions options;
+  Result result;
+  if (chunk_size == 0) {
+    BinaryReaderT<BinaryReaderDelegate> reader(data, size, &delegate,
+                                               &options);
+    result = reader.ReadModule();
+  } else {
+    StreamingBinaryReader<BinaryReaderDelegate> reader(&delegate, &options);
+    result = Result::Ok;
+    for (size_t i = 0; i < size && Succeeded(result); i += chunk_size)
+      result = reader.Push(data + i, std::min(chunk_size, size - i));
+    if (Succeeded(result))
+      result = reader.Finish();
+  }
+
+  const std::vector<uint8_t>& log_data = log.writer().output_buffer().data;
+  return {result, std::string(log_data.begin(), log_data.end()),
+          error_delegate.error};
+}
+
+}  // end anonymous namespace
+
+TEST(binary_reader_stream, chunks) {
+  ReadResult expected = ReadModule(kModule, sizeof(kModule), 0);
+  ASSERT_EQ(Result::Ok, expected.result);
+  for (size_t chunk_size = 1; chunk_size <= sizeof(kModule); ++chunk_size) {
+    SCOPED_TRACE(chunk_size);
+    ReadResult actual = ReadModule(kModule, sizeof(kModule), chunk_size);
+    EXPECT_EQ(Result::Ok, actual.result);
+    EXPECT_EQ(expected.log, actual.log);
+  }
+}
+
+// Most prefixes of the module are invalid. The function bodies of a truncated
+// code section that did arrive are read before the error is reported, so the
+// log may be longer than when reading all at once.
+TEST(binary_reader_stream, truncated) {
+  for (size_t size = 0; size < sizeof(kModule); ++size) {
+    SCOPED_TRACE(size);
+    ReadResult expected = ReadModule(kModule, size, 0);
+    for (size_t chunk_size : {1, 3, 64}) {
+      ReadResult actual = ReadModule(kModule, size, chunk_size);
+      EXPECT_EQ(expected.result, actual.result);
+      EXPECT_EQ(expected.error, actual.error);
+      EXPECT_EQ(0u, actual.log.compare(0, expected.log.size(), expected.log));
+    }
+  }
+}
+
+// The body size is checked before the streaming reader waits for the body.
+TEST(binary_reader_stream, invalid_function_body_size) {
+  const uint8_t kBadModule[] = {
+      // header
+      0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00,
+      // type: (func)
+      0x01, 0x04, 0x01, 0x60, 0x00, 0x00,
+      // function: one function of type 0
+      0x03, 0x02, 0x01, 0x00,
+      // code: a body size that doesn't fit in a u32
+      0x0a, 0x08, 0x01, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x0b,
+  };
+  ReadResult expected = ReadModule(kBadModule, sizeof(kBadModule), 0);
+  ASSERT_EQ(Result::Error, expected.result);
+  for (size_t chunk_size = 1; chunk_size <= sizeof(kBadModule);
+       ++chunk_size) {
+    SCOPED_TRACE(chunk_size);
+    ReadResult actual = ReadModule(kBadModule, sizeof(kBadModule), chunk_size);
+    EXPECT_EQ(Result::Error, actual.result);
+    EXPECT_EQ(expected.error, actual.error);
+  }
+}
+
+TEST(binary_reader_stream, function_bodies_before_end) {
+  MemoryStream log;
+  BinaryReaderNop nop;
+  BinaryReaderLogging delegate(&log, &nop);
+  ReadBinaryOptions options;
+  StreamingBinaryReader<BinaryReaderDelegate> reader(&delegate, &options);
+
+  // Everything up to the end of the first function body.
+  const size_t kFirstBodyEnd = 47;
+  ASSERT_EQ(Result::Ok, reader.Push(kModule, kFirstBodyEnd));
+  const std::vector<uint8_t>& log_data = log.writer().output_buffer().data;
+  std::string output(log_data.begin(), log_data.end());
+  EXPECT_NE(std::string::npos, output.find("EndFunctionBody(0)"));
+  EXPECT_EQ(std::string::npos, output.find("BeginFunctionBody(1)"));
+
+  ASSERT_EQ(Result::Ok, reader.Push(kModule + kFirstBodyEnd,
+                                    sizeof(kModule) - kFirstBodyEnd));
+  EXPECT_EQ(Result::Ok, reader.Finish());
+}
+
+// The buffer moves as it grows, so the interpreter has to copy the data
+// segment before the end of the module, where it is written to memory.
+TEST(binary_reader_stream, interpreter_data_segment) {
+  interpreter::Environment env;
+  ReadBinaryOptions options;
+  ErrorHandlerNop error_handler;
+  StreamingInterpreterReader reader(&env, &options, &error_handler);
+  for (size_t i = 0; i < sizeof(kModule); ++i)
+    ASSERT_EQ(Result::Ok, reader.Push(kModule + i, 1));
+  interpreter::DefinedModule* module;
+  ASSERT_EQ(Result::Ok, reader.Finish(&module));
+
+  interpreter::Memory* memory = env.GetMemory(module->memory_index);
+  ASSERT_LE(3u, memory->data.size());
+  EXPECT_EQ("abc", std::string(memory->data.begin(), memory->data.begin() + 3));
+}
@@ -0,0 +1,93 @@
+/*
+ * Copyright 2017 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "binary-reader.h"
+#include "binary-reader-interpreter.h"
+#include "error-handler.h"
+#include "interpreter.h"
+
+using namespace wabt;
+
+namespace {
+
+// (module
+//   (memory 1 2 shared)
+//   (func (export "wait") (result i32)
+//     ;; Wait until "grow" has run, then use the memory.
+//     (drop (memory.atomic.wait32
+//       (i32.const 0) (i32.const 0) (i64.const -1)))
+//     (i32.store (i32.const 8) (i32.const 7))
+//     (i32.load (i32.const 8)))
+//   (func (export "grow") (result i32)
+//     (drop (grow_memory (i32.const 1)))
+//     (i32.atomic.store (i32.const 0) (i32.const 1))
+//     (memory.atomic.notify (i32.const 0) (i32.const 1))))
+const uint8_t kSharedMemoryModule[] = {
+    0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00, 0x01, 0x05, 0x01, 0x60,
+    0x00, 0x01, 0x7f, 0x03, 0x03, 0x02, 0x00, 0x00, 0x05, 0x04, 0x01, 0x03,
+    0x01, 0x02, 0x07, 0x0f, 0x02, 0x04, 0x77, 0x61, 0x69, 0x74, 0x00, 0x00,
+    0x04, 0x67, 0x72, 0x6f, 0x77, 0x00, 0x01, 0x0a, 0x33, 0x02, 0x19, 0x00,
+    0x41, 0x00, 0x41, 0x00, 0x42, 0x7f, 0xfe, 0x01, 0x02, 0x00, 0x1a, 0x41,
+    0x08, 0x41, 0x07, 0x36, 0x02, 0x00, 0x41, 0x08, 0x28, 0x02, 0x00, 0x0b,
+    0x17, 0x00, 0x41, 0x01, 0x40, 0x00, 0x1a, 0x41, 0x00, 0x41, 0x01, 0xfe,
+    0x17, 0x02, 0x00, 0x41, 0x00, 0x41, 0x01, 0xfe, 0x00, 0x02, 0x00, 0x0b,
+};
+
+}  // end anonymous namespace
+
+TEST(interpreter, grow_shared_memory_while_waiting) {
+  interpreter::Environment env;
+  ReadBinaryOptions options;
+  options.allow_future_threads = true;
+  ErrorHandlerNop error_handler;
+  interpreter::DefinedModule* module;
+  ASSERT_EQ(wabt::Result::Ok,
+            read_binary_interpreter(&env, kSharedMemoryModule,
+                                    sizeof(kSharedMemoryModule), &options,
+                                    &error_handler, &module));
+  interpreter::Memory* memory = env.GetMemory(module->memory_index);
+  const char* data = memory->data.data();
+
+  interpreter::Thread waiter(&env);
+  interpreter::Result wait_result;
+  std::vector<interpreter::TypedValue> wait_results;
+  std::thread wait_thread([&]() {
+    wait_result = waiter.RunFunction(module->GetExport("wait")->index, {},
+                                     &wait_results);
+  });
+
+  // Give the waiter time to block; if it hasn't yet, its wait doesn't block
+  // and it only checks the memory after the grow.
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  interpreter::Thread grower(&env);
+  std::vector<interpreter::TypedValue> grow_results;
+  EXPECT_EQ(interpreter::Result::Ok,
+            grower.RunFunction(module->GetExport("grow")->index, {},
+                               &grow_results));
+  wait_thread.join();
+
+  EXPECT_EQ(2u * WABT_PAGE_SIZE, memory->data.size());
+  EXPECT_EQ(data, memory->data.data());
+  ASSERT_EQ(interpreter::Result::Ok, wait_result);
+  ASSERT_EQ(1u, wait_results.size());
+  EXPECT_EQ(7u, wait_results[0].value.i32);
+}
@@ -0,0 +1,199 @@
+/*
+ * Copyright 2017 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+#include "leb128.h"
+
+using namespace wabt;
+
+namespace {
+
+std::vector<uint8_t> encode_unsigned(uint64_t value) {
+  std::vector<uint8_t> result;
+  do {
+    uint8_t byte = value & 0x7f;
+    value >>= 7;
+    if (value != 0)
+      byte |= 0x80;
+    result.push_back(byte);
+  } while (value != 0);
+  return result;
+}
+
+std::vector<uint8_t> encode_signed(int64_t value) {
+  std::vector<uint8_t> result;
+  bool more;
+  do {
+    uint8_t byte = value & 0x7f;
+    value >>= 7;
+    more = !((value == 0 && !(byte & 0x40)) || (value == -1 && (byte & 0x40)));
+    if (more)
+      byte |= 0x80;
+    result.push_back(byte);
+  } while (more);
+  return result;
+}
+
+// The bytes after the LEB128 are set, so the fast path must ignore them.
+std::vector<uint8_t> with_padding(std::vector<uint8_t> data) {
+  data.resize(data.size() + 16, 0xff);
+  return data;
+}
+
+const uint64_t kValues[] = {0,
+                            1,
+                            0x3f,
+                            0x40,
+                            0x7f,
+                            0x80,
+                            0x3fff,
+                            0x4000,
+                            0x1fffff,
+                            0x200000,
+                            0xfffffff,
+                            0x10000000,
+                            0x7fffffff,
+                            0x80000000,
+                            0xffffffff,
+                            0x100000000ull,
+                            0x7ffffffffffull,
+                            0xffffffffffffffull,
+                            0x100000000000000ull,
+                            0x7fffffffffffffffull,
+                            0x8000000000000000ull,
+                            0xffffffffffffffffull};
+
+}  // end anonymous namespace
+
+TEST(leb128, u32) {
+  for (uint64_t value : kValues) {
+    if (value > UINT32_MAX)
+      continue;
+    std::vector<uint8_t> data = encode_unsigned(value);
+    for (const std::vector<uint8_t>& buffer : {data, with_padding(data)}) {
+      uint32_t result = 0;
+      ASSERT_EQ(data.size(), read_u32_leb128(buffer.data(),
+                                             buffer.data() + buffer.size(),
+                                             &result));
+      ASSERT_EQ(value, result);
+    }
+  }
+}
+
+TEST(leb128, i32) {
+  for (uint64_t bits : kValues) {
+    for (int64_t value :
+         {static_cast<int64_t>(bits), -static_cast<int64_t>(bits)}) {
+      if (value < INT32_MIN || value > INT32_MAX)
+        continue;
+      std::vector<uint8_t> data = encode_signed(value);
+      for (const std::vector<uint8_t>& buffer : {data, with_padding(data)}) {
+        uint32_t result = 0;
+        ASSERT_EQ(data.size(), read_i32_leb128(buffer.data(),
+                                               buffer.data() + buffer.size(),
+                                               &result));
+        ASSERT_EQ(static_cast<uint32_t>(value), result);
+      }
+    }
+  }
+}
+
+TEST(leb128, i64) {
+  for (uint64_t bits : kValues) {
+    for (int64_t value :
+         {static_cast<int64_t>(bits), -static_cast<int64_t>(bits)}) {
+      std::vector<uint8_t> data = encode_signed(value);
+      for (const std::vector<uint8_t>& buffer : {data, with_padding(data)}) {
+        uint64_t result = 0;
+        ASSERT_EQ(data.size(), read_i64_leb128(buffer.data(),
+                                               buffer.data() + buffer.size(),
+                                               &result));
+        ASSERT_EQ(static_cast<uint64_t>(value), result);
+      }
+    }
+  }
+}
+
+TEST(leb128, invalid) {
+  uint32_t u32;
+  uint64_t u64;
+  // Too long for a u32 or i32.
+  std::vector<uint8_t> six_bytes =
+      with_padding({0x80, 0x80, 0x80, 0x80, 0x80, 0});
+  EXPECT_EQ(0u, read_u32_leb128(six_bytes.data(),
+                                six_bytes.data() + six_bytes.size(), &u32));
+  EXPECT_EQ(0u, read_i32_leb128(six_bytes.data(),
+                                six_bytes.data() + six_bytes.size(), &u32));
+  EXPECT_EQ(6u, read_i64_leb128(six_bytes.data(),
+                                six_bytes.data() + six_bytes.size(), &u64));
+
+  // More than 32 bits.
+  std::vector<uint8_t> u33 = with_padding({0x80, 0x80, 0x80, 0x80, 0x10});
+  EXPECT_EQ(0u, read_u32_leb128(u33.data(), u33.data() + u33.size(), &u32));
+
+  // The top bits aren't a sign-extension of bit 31.
+  std::vector<uint8_t> bad_sign = with_padding({0x80, 0x80, 0x80, 0x80, 0x08});
+  EXPECT_EQ(0u, read_i32_leb128(bad_sign.data(),
+                                bad_sign.data() + bad_sign.size(), &u32));
+  std::vector<uint8_t> good_sign = with_padding({0x80, 0x80, 0x80, 0x80, 0x78});
+  EXPECT_EQ(5u, read_i32_leb128(good_sign.data(),
+                                good_sign.data() + good_sign.size(), &u32));
+  EXPECT_EQ(0x80000000u, u32);
+
+  // Runs past the end.
+  std::vector<uint8_t> truncated = {0x80, 0x80};
+  EXPECT_EQ(0u, read_u32_leb128(truncated.data(),
+                                truncated.data() + truncated.size(), &u32));
+  EXPECT_EQ(0u, read_i64_leb128(truncated.data(),
+                                truncated.data() + truncated.size(), &u64));
+}
+
+TEST(leb128, fast_matches_slow) {
+  uint32_t seed = 1;
+  uint8_t bytes[16];
+  for (int i = 0; i < 100000; ++i) {
+    // Random bytes, with the LEB128 ending at byte i % 11, or after byte 10.
+    for (uint8_t& byte : bytes) {
+      seed = seed * 1103515245 + 12345;
+      byte = static_cast<uint8_t>(seed >> 16) | 0x80;
+    }
+    if (i % 11 != 10)
+      bytes[i % 11] &= 0x7f;
+
+    uint32_t fast32, slow32;
+    size_t length = read_u32_leb128_slow(bytes, bytes + 16, &slow32);
+    ASSERT_EQ(length, read_u32_leb128(bytes, bytes + 16, &fast32));
+    if (length) {
+      ASSERT_EQ(slow32, fast32);
+    }
+
+    length = read_i32_leb128_slow(bytes, bytes + 16, &slow32);
+    ASSERT_EQ(length, read_i32_leb128(bytes, bytes + 16, &fast32));
+    if (length) {
+      ASSERT_EQ(slow32, fast32);
+    }
+
+    uint64_t fast64, slow64;
+    length = read_i64_leb128_slow(bytes, bytes + 16, &slow64);
+    ASSERT_EQ(length, read_i64_leb128(bytes, bytes + 16, &fast64));
+    if (length) {
+      ASSERT_EQ(slow64, fast64);
+    }
+  }
+}
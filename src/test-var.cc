@@ -0,0 +1,136 @@
+/*
+ * Copyright 2017 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+
+#include <string>
+#include <utility>
+
+#include "ir.h"
+
+using namespace wabt;
+
+TEST(var, default_is_invalid_index) {
+  Var var;
+  ASSERT_TRUE(var.is_index());
+  ASSERT_EQ(kInvalidIndex, var.index());
+}
+
+TEST(var, copy_index) {
+  Var src(3, Location(1));
+  Var dst(src);
+  ASSERT_TRUE(dst.is_index());
+  ASSERT_EQ(3u, dst.index());
+  ASSERT_EQ(1u, dst.loc.offset);
+  ASSERT_TRUE(src.is_index());
+  ASSERT_EQ(3u, src.index());
+}
+
+TEST(var, copy_name) {
+  Var src("$foo", Location(1));
+  Var dst(src);
+  ASSERT_TRUE(dst.is_name());
+  ASSERT_EQ("$foo", dst.name());
+  ASSERT_EQ(1u, dst.loc.offset);
+
+  // The copy has a name of its own.
+  ASSERT_NE(&src.name(), &dst.name());
+  dst.set_name(string_view("$bar"));
+  ASSERT_EQ("$foo", src.name());
+  ASSERT_EQ("$bar", dst.name());
+}
+
+TEST(var, copy_assign) {
+  Var src("$foo", Location(1));
+  Var dst("$bar", Location(2));
+  dst = src;
+  ASSERT_EQ("$foo", dst.name());
+  ASSERT_EQ(1u, dst.loc.offset);
+  ASSERT_EQ("$foo", src.name());
+
+  dst = Var(5);
+  ASSERT_TRUE(dst.is_index());
+  ASSERT_EQ(5u, dst.index());
+
+  dst = src;
+  ASSERT_TRUE(dst.is_name());
+  ASSERT_EQ("$foo", dst.name());
+}
+
+TEST(var, copy_assign_self) {
+  Var var("$foo");
+  Var& ref = var;
+  var = ref;
+  ASSERT_TRUE(var.is_name());
+  ASSERT_EQ("$foo", var.name());
+}
+
+TEST(var, move_index) {
+  // Moving a Var that holds an index copies it.
+  Var src(3, Location(1));
+  Var dst(std::move(src));
+  ASSERT_TRUE(dst.is_index());
+  ASSERT_EQ(3u, dst.index());
+  ASSERT_EQ(1u, dst.loc.offset);
+  ASSERT_TRUE(src.is_index());
+  ASSERT_EQ(3u, src.index());
+}
+
+TEST(var, move_name) {
+  // Moving a named Var takes its name, and leaves it with an invalid index.
+  Var src("$foo", Location(1));
+  const std::string* name = &src.name();
+  Var dst(std::move(src));
+  ASSERT_TRUE(dst.is_name());
+  ASSERT_EQ("$foo", dst.name());
+  ASSERT_EQ(name, &dst.name());
+  ASSERT_EQ(1u, dst.loc.offset);
+  ASSERT_TRUE(src.is_index());
+  ASSERT_EQ(kInvalidIndex, src.index());
+}
+
+TEST(var, move_assign) {
+  Var src("$foo", Location(1));
+  Var dst("$bar", Location(2));
+  dst = std::move(src);
+  ASSERT_TRUE(dst.is_name());
+  ASSERT_EQ("$foo", dst.name());
+  ASSERT_EQ(1u, dst.loc.offset);
+  ASSERT_TRUE(src.is_index());
+  ASSERT_EQ(kInvalidIndex, src.index());
+
+  dst = Var(5);
+  ASSERT_TRUE(dst.is_index());
+  ASSERT_EQ(5u, dst.index());
+}
+
+TEST(var, move_assign_self) {
+  Var var("$foo");
+  Var& ref = var;
+  var = std::move(ref);
+  ASSERT_TRUE(var.is_name());
+  ASSERT_EQ("$foo", var.name());
+}
+
+TEST(var, set_index_and_name) {
+  Var var("$foo");
+  var.set_index(7);
+  ASSERT_TRUE(var.is_index());
+  ASSERT_EQ(7u, var.index());
+  var.set_name(std::string("$bar"));
+  ASSERT_TRUE(var.is_name());
+  ASSERT_EQ("$bar", var.name());
+}
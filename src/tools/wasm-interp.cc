@@ -26,6 +26,7 @@
 #include "binary-reader-interpreter.h"
 #include "binary-reader.h"
 #include "error-handler.h"
+#include "int-counter.h"
 #include "interpreter.h"
 #include "literal.h"
 #include "option-parser.h"
@@ -45,6 +46,13 @@ static const char* s_infile;
 static ReadBinaryOptions s_read_binary_options;
 static Thread::Options s_thread_options;
 static bool s_trace;
+static bool s_count;
+static const char* s_trace_filename;
+static const char* s_decode_trace_filename;
+static const char* s_memory_access_log_filename;
+static uint32_t s_memory_access_sample = 1;
+static ResourceLimits s_resource_limits;
+static bool s_resource_usage;
 static bool s_spec;
 static bool s_run_all_exports;
 
@@ -70,6 +78,27 @@ examples:
   # parse test.wasm, run the exported functions and trace the output
   $ wasm-interp test.wasm --run-all-exports --trace
 
+  # parse test.wasm, run the exported functions and print how often each
+  # opcode, opcode pair, function and basic block was executed
+  $ wasm-interp test.wasm --run-all-exports --count
+
+  # parse test.wasm, run the exported functions and write a binary trace of
+  # every executed instruction to test.trace
+  $ wasm-interp test.wasm --run-all-exports --trace-file test.trace
+
+  # parse test.wasm and disassemble the binary trace test.trace against it
+  $ wasm-interp test.wasm --decode-trace test.trace
+
+  # parse test.wasm, run the exported functions and log every 16th linear
+  # memory access to test.memlog, to be summarized with wasm-memheat
+  $ wasm-interp test.wasm --run-all-exports --memory-access-log test.memlog \
+      --memory-access-sample 16
+
+  # parse test.wasm and run the exported functions, trapping after 1000000
+  # instructions, and print the resources used
+  $ wasm-interp test.wasm --run-all-exports --max-instructions 1000000 \
+      --resource-usage
+
   # parse test.json and run the spec tests
   $ wasm-interp test.json --spec
 
@@ -100,6 +129,70 @@ static void parse_options(int argc, char** argv) {
                      s_thread_options.call_stack_size = atoi(argument.c_str());
                    });
   parser.AddOption('t', "trace", "Trace execution", []() { s_trace = true; });
+  parser.AddOption("count", "Count executed opcodes, functions and blocks",
+                   []() { s_count = true; });
+  parser.AddOption('\0', "trace-file", "FILENAME",
+                   "Write a binary execution trace to FILENAME",
+                   [](const char* argument) { s_trace_filename = argument; });
+  parser.AddOption('\0', "decode-trace", "FILENAME",
+                   "Disassemble the binary execution trace FILENAME instead "
+                   "of running the module",
+                   [](const char* argument) {
+                     s_decode_trace_filename = argument;
+                   });
+  parser.AddOption('\0', "memory-access-log", "FILENAME",
+                   "Log the address and size of linear memory accesses to "
+                   "FILENAME",
+                   [](const char* argument) {
+                     s_memory_access_log_filename = argument;
+                   });
+  parser.AddOption('\0', "memory-access-sample", "N",
+                   "Only log every Nth memory access (default 1)",
+                   [](const std::string& argument) {
+                     s_memory_access_sample = atoi(argument.c_str());
+                   });
+  parser.AddOption('\0', "max-memory-pages", "N",
+                   "Limit the total pages of all memories to N",
+                   [](const std::string& argument) {
+                     s_resource_limits.max_memory_pages =
+                         strtoul(argument.c_str(), nullptr, 10);
+                   });
+  parser.AddOption('\0', "max-instructions", "N",
+                   "Trap after executing N instructions",
+                   [](const std::string& argument) {
+                     s_resource_limits.max_instructions =
+                         strtoull(argument.c_str(), nullptr, 10);
+                   });
+  parser.AddOption('\0', "max-host-calls", "N",
+                   "Trap when calling more than N host functions",
+                   [](const std::string& argument) {
+                     s_resource_limits.max_host_calls =
+                         strtoull(argument.c_str(), nullptr, 10);
+                   });
+  parser.AddOption("resource-usage",
+                   "Print the memory, instructions and host calls used",
+                   []() { s_resource_usage = true; });
+  parser.AddOption("future-bulk-memory",
+                   "Test future extension for bulk memory operations",
+                   []() {
+                     s_read_binary_options.allow_future_bulk_memory = true;
+                   });
+  parser.AddOption("future-simd",
+                   "Test future extension for SIMD",
+                   []() { s_read_binary_options.allow_future_simd = true; });
+  parser.AddOption("future-threads",
+                   "Test future extension for threads",
+                   []() { s_read_binary_options.allow_future_threads = true; });
+  parser.AddOption("future-tail-call",
+                   "Test future extension for tail calls",
+                   []() {
+                     s_read_binary_options.allow_future_tail_call = true;
+                   });
+  parser.AddOption("future-multi-value",
+                   "Test future extension for multi-value",
+                   []() {
+                     s_read_binary_options.allow_future_multi_value = true;
+                   });
   parser.AddOption("spec", "Run spec tests (input file should be .json)",
                    []() { s_spec = true; });
   parser.AddOption(
@@ -113,6 +206,11 @@ static void parse_options(int argc, char** argv) {
 
   if (s_spec && s_run_all_exports)
     WABT_FATAL("--spec and --run-all-exports are incompatible.\n");
+
+  if (s_spec && (s_trace_filename || s_decode_trace_filename ||
+                 s_memory_access_log_filename)) {
+    WABT_FATAL("--spec is incompatible with binary tracing.\n");
+  }
 }
 
 enum class ModuleType {
@@ -166,6 +264,13 @@ static void sprint_typed_value(char* buffer,
       break;
     }
 
+    case Type::V128: {
+      const v128& value = tv->value.v128_bits;
+      snprintf(buffer, size, "v128:0x%08x 0x%08x 0x%08x 0x%08x", value.v[0],
+               value.v[1], value.v[2], value.v[3]);
+      break;
+    }
+
     default:
       assert(0);
       break;
@@ -212,6 +317,26 @@ static void print_call(string_view module_name,
   }
 }
 
+static void print_trap_stack_trace(Thread* thread) {
+  const size_t kMaxFrames = 16;
+  std::vector<TrapFrame> frames = thread->GetTrapStackTrace();
+  for (size_t i = 0; i < frames.size() && i < kMaxFrames; ++i) {
+    const TrapFrame& frame = frames[i];
+    printf("  #%" PRIzd " ", i);
+    if (frame.func_index != kInvalidIndex)
+      printf("func[%" PRIindex "]", frame.func_index);
+    else
+      printf("func[?]");
+    if (!frame.func_name.empty())
+      printf(" <%s>", frame.func_name.c_str());
+    if (frame.binary_offset != kInvalidOffset)
+      printf(" @ 0x%06" PRIzx, frame.binary_offset);
+    printf("\n");
+  }
+  if (frames.size() > kMaxFrames)
+    printf("  ... %" PRIzd " more frames\n", frames.size() - kMaxFrames);
+}
+
 static interpreter::Result run_function(Thread* thread,
                                         Index func_index,
                                         const std::vector<TypedValue>& args,
@@ -290,8 +415,77 @@ static void run_all_exports(Module* module,
     interpreter::Result iresult = run_export(thread, &export_, args, &results);
     if (verbose == RunVerbosity::Verbose) {
       print_call(string_view(), export_.name, args, results, iresult);
+      if (iresult != interpreter::Result::Ok)
+        print_trap_stack_trace(thread);
+    }
+  }
+}
+
+static void display_opcode_name(FILE* out, intmax_t value) {
+  fprintf(out, "%s", GetOpcodeName(static_cast<interpreter::Opcode>(value)));
+}
+
+static void display_istream_offset(FILE* out, intmax_t value) {
+  fprintf(out, "@%" PRIdMAX, value);
+}
+
+static void print_execution_counts(Thread* thread) {
+  const ExecutionCounts* counts = thread->execution_counts();
+  Environment* env = thread->env();
+
+  IntCounterVector opcode_vec;
+  for (int i = 0; i < kOpcodeCount; ++i) {
+    if (counts->opcode_counts[i])
+      opcode_vec.emplace_back(i, counts->opcode_counts[i]);
+  }
+
+  IntPairCounterVector opcode_pair_vec;
+  for (int i = 0; i < kOpcodeCount; ++i) {
+    for (int j = 0; j < kOpcodeCount; ++j) {
+      uint64_t count = counts->opcode_pair_counts[i * kOpcodeCount + j];
+      if (count)
+        opcode_pair_vec.emplace_back(i, j, count);
     }
   }
+
+  IntCounterVector func_vec;
+  for (Index i = 0; i < env->GetFuncCount(); ++i) {
+    Func* func = env->GetFunc(i);
+    if (func->is_host)
+      continue;
+    IstreamOffset offset = func->as_defined()->offset;
+    if (offset < counts->func_counts.size() && counts->func_counts[offset])
+      func_vec.emplace_back(i, counts->func_counts[offset]);
+  }
+
+  IntCounterVector block_vec;
+  for (size_t i = 0; i < counts->block_counts.size(); ++i) {
+    if (counts->block_counts[i])
+      block_vec.emplace_back(i, counts->block_counts[i]);
+  }
+
+  DisplayCounterOptions options;
+  display_sorted_int_counter_vector(stdout, "Opcode counts:", opcode_vec,
+                                    int_counter_gt, display_opcode_name,
+                                    nullptr, options);
+  display_sorted_int_pair_counter_vector(
+      stdout, "\nOpcode pair counts:", opcode_pair_vec, int_pair_counter_gt,
+      display_opcode_name, display_opcode_name, nullptr, options);
+  display_sorted_int_counter_vector(stdout, "\nFunction counts:", func_vec,
+                                    int_counter_gt, display_intmax, "func",
+                                    options);
+  display_sorted_int_counter_vector(stdout, "\nBlock counts:", block_vec,
+                                    int_counter_gt, display_istream_offset,
+                                    "block", options);
+
+  uint64_t cache_hits = counts->call_indirect_cache_hits;
+  uint64_t cache_lookups = cache_hits + counts->call_indirect_cache_misses;
+  if (cache_lookups) {
+    printf("\ncall_indirect cache: %" PRIu64 " hits, %" PRIu64
+           " misses (%.1f%% hit rate)\n",
+           cache_hits, counts->call_indirect_cache_misses,
+           100.0 * cache_hits / cache_lookups);
+  }
 }
 
 static wabt::Result read_module(const char* module_filename,
@@ -299,20 +493,32 @@ static wabt::Result read_module(const char* module_filename,
                                 ErrorHandler* error_handler,
                                 DefinedModule** out_module) {
   wabt::Result result;
-  std::vector<uint8_t> file_data;
 
   *out_module = nullptr;
 
-  result = ReadFile(module_filename, &file_data);
-  if (Succeeded(result)) {
-    result = read_binary_interpreter(env, DataOrNull(file_data),
-                                     file_data.size(), &s_read_binary_options,
-                                     error_handler, out_module);
-
+  if (MappedFile::CanMap(module_filename)) {
+    MappedFile file;
+    result = file.Open(module_filename);
     if (Succeeded(result)) {
-      if (s_verbose)
-        env->DisassembleModule(s_stdout_stream.get(), *out_module);
+      result = read_binary_interpreter(env, file.data(), file.size(),
+                                       &s_read_binary_options,
+                                       error_handler, out_module);
     }
+  } else {
+    // E.g. a pipe; compile the module while the rest of it is still arriving.
+    StreamingInterpreterReader reader(env, &s_read_binary_options,
+                                      error_handler);
+    result = ReadFileChunks(module_filename,
+                            [&reader](const void* data, size_t size) {
+                              return reader.Push(data, size);
+                            });
+    if (Succeeded(result))
+      result = reader.Finish(out_module);
+  }
+
+  if (Succeeded(result)) {
+    if (s_verbose)
+      env->DisassembleModule(s_stdout_stream.get(), *out_module);
   }
   return result;
 }
@@ -381,6 +587,8 @@ class SpectestHostImportDelegate : public HostImportDelegate {
       memory->page_limits.initial = 1;
       memory->page_limits.max = 2;
       memory->data.resize(memory->page_limits.initial * WABT_MAX_PAGES);
+      if (memory->page_limits.is_shared)
+        memory->data.reserve(memory->page_limits.max * WABT_PAGE_SIZE);
       return wabt::Result::Ok;
     } else {
       PrintError(callback, "unknown host memory import " PRIimport,
@@ -435,11 +643,46 @@ class SpectestHostImportDelegate : public HostImportDelegate {
   }
 };
 
+static void print_resource_usage(const Environment* env) {
+  const ResourceUsage& usage = env->resource_usage();
+  printf("Resource usage:\n");
+  printf("peak memory pages: %u\n", usage.peak_memory_pages);
+  printf("grow_memory calls: %" PRIu64 "\n", usage.grow_memory_calls);
+  printf("instructions: %" PRIu64 "\n", usage.instructions);
+  printf("host calls: %" PRIu64 "\n", usage.host_calls);
+}
+
 static void init_environment(Environment* env) {
+  env->resource_limits() = s_resource_limits;
   HostModule* host_module = env->AppendHostModule("spectest");
   host_module->import_delegate.reset(new SpectestHostImportDelegate());
 }
 
+static wabt::Result decode_trace(Environment* env,
+                                 const char* trace_filename) {
+  MappedFile trace_file;
+  wabt::Result result = trace_file.Open(trace_filename);
+  if (Failed(result))
+    return result;
+
+  std::vector<TraceRecord> records;
+  result = TraceBuffer::ReadRecords(trace_file.data(), trace_file.size(),
+                                    &records);
+  if (Failed(result)) {
+    fprintf(stderr, "%s: invalid binary trace file\n", trace_filename);
+    return result;
+  }
+
+  for (size_t i = 0; i < records.size(); ++i) {
+    if (!env->DisassembleTraceRecord(s_stdout_stream.get(), records[i])) {
+      fprintf(stderr, "%s: record %" PRIzd " doesn't match the module\n",
+              trace_filename, i);
+      return wabt::Result::Error;
+    }
+  }
+  return wabt::Result::Ok;
+}
+
 static wabt::Result read_and_run_module(const char* module_filename) {
   wabt::Result result;
   Environment env;
@@ -447,17 +690,55 @@ static wabt::Result read_and_run_module(const char* module_filename) {
 
   ErrorHandlerFile error_handler(Location::Type::Binary);
   DefinedModule* module = nullptr;
+  // Function names for trap stack traces. They are optional, so a name
+  // section that can't be read doesn't stop the module from loading.
+  s_read_binary_options.read_debug_names = true;
+  s_read_binary_options.skip_bad_names = true;
   result = read_module(module_filename, &env, &error_handler, &module);
+  if (Succeeded(result) && s_decode_trace_filename)
+    return decode_trace(&env, s_decode_trace_filename);
+
   if (Succeeded(result)) {
     Thread thread(&env, s_thread_options);
+    if (s_count)
+      thread.EnableExecutionCounts();
+
+    std::unique_ptr<FileStream> trace_stream;
+    std::unique_ptr<TraceBuffer> trace_buffer;
+    if (s_trace_filename) {
+      trace_stream.reset(new FileStream(s_trace_filename));
+      if (!trace_stream->is_open())
+        return wabt::Result::Error;
+      trace_buffer.reset(new TraceBuffer(trace_stream.get()));
+      thread.set_trace_buffer(trace_buffer.get());
+    }
+
+    std::unique_ptr<FileStream> memory_access_stream;
+    std::unique_ptr<MemoryAccessLog> memory_access_log;
+    if (s_memory_access_log_filename) {
+      memory_access_stream.reset(new FileStream(s_memory_access_log_filename));
+      if (!memory_access_stream->is_open())
+        return wabt::Result::Error;
+      memory_access_log.reset(new MemoryAccessLog(memory_access_stream.get(),
+                                                  s_memory_access_sample));
+      thread.set_memory_access_log(memory_access_log.get());
+    }
+
     interpreter::Result iresult = run_start_function(&thread, module);
     if (iresult == interpreter::Result::Ok) {
       if (s_run_all_exports)
         run_all_exports(module, &thread, RunVerbosity::Verbose);
     } else {
       print_interpreter_result("error running start function", iresult);
+      print_trap_stack_trace(&thread);
     }
+    if (s_count)
+      print_execution_counts(&thread);
+    if (trace_buffer)
+      trace_buffer->Flush();
   }
+  if (s_resource_usage)
+    print_resource_usage(&env);
   return result;
 }
 
@@ -1465,6 +1746,8 @@ static wabt::Result read_and_run_spec_json(const char* spec_json_filename) {
   ctx.loc.line = 1;
   ctx.loc.first_column = 1;
   init_environment(&ctx.env);
+  if (s_count)
+    ctx.thread.EnableExecutionCounts();
 
   wabt::Result result = ReadFile(spec_json_filename, &ctx.json_data);
   if (Failed(result))
@@ -1472,6 +1755,10 @@ static wabt::Result read_and_run_spec_json(const char* spec_json_filename) {
 
   result = parse_commands(&ctx);
   printf("%d/%d tests passed.\n", ctx.passed, ctx.total);
+  if (s_count)
+    print_execution_counts(&ctx.thread);
+  if (s_resource_usage)
+    print_resource_usage(&ctx.env);
   return result;
 }
 
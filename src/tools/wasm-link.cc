@@ -93,10 +93,8 @@ Section::~Section() {
   }
 }
 
-LinkerInputBinary::LinkerInputBinary(const char* filename,
-                                     const std::vector<uint8_t>& data)
+LinkerInputBinary::LinkerInputBinary(const char* filename)
     : filename(filename),
-      data(data),
       active_function_imports(0),
       active_global_imports(0),
       type_index_offset(0),
@@ -160,7 +158,7 @@ Index LinkerInputBinary::RelocateGlobalIndex(Index global_index) {
 
 static void apply_relocation(Section* section, Reloc* r) {
   LinkerInputBinary* binary = section->binary;
-  uint8_t* section_data = &binary->data[section->offset];
+  uint8_t* section_data = binary->file.mutable_data() + section->offset;
   size_t section_size = section->size;
 
   Index cur_value = 0, new_value = 0;
@@ -208,7 +206,7 @@ static void write_section_payload(Context* ctx, Section* sec) {
   sec->output_payload_offset =
       ctx->stream.offset() - ctx->current_section_payload_offset;
 
-  uint8_t* payload = &sec->binary->data[sec->payload_offset];
+  const uint8_t* payload = sec->binary->file.data() + sec->payload_offset;
   ctx->stream.WriteData(payload, sec->payload_size, "section content");
 }
 
@@ -392,9 +390,8 @@ static void write_function_section(Context* ctx,
     Index count = sec->count;
     Offset input_offset = 0;
     Index sig_index = 0;
-    const uint8_t* start = &sec->binary->data[sec->payload_offset];
-    const uint8_t* end =
-        &sec->binary->data[sec->payload_offset + sec->payload_size];
+    const uint8_t* start = sec->binary->file.data() + sec->payload_offset;
+    const uint8_t* end = start + sec->payload_size;
     while (count--) {
       input_offset += read_u32_leb128(start + input_offset, end, &sig_index);
       write_u32_leb128(stream, sec->binary->RelocateTypeIndex(sig_index),
@@ -797,13 +794,11 @@ int ProgramMain(int argc, char** argv) {
   for (size_t i = 0; i < s_infiles.size(); i++) {
     const std::string& input_filename = s_infiles[i];
     LOG_DEBUG("reading file: %s\n", input_filename.c_str());
-    std::vector<uint8_t> file_data;
-    result = ReadFile(input_filename.c_str(), &file_data);
+    LinkerInputBinary* b = new LinkerInputBinary(input_filename.c_str());
+    context.inputs.emplace_back(b);
+    result = b->file.Open(input_filename.c_str(), true);
     if (Failed(result))
       return result != Result::Ok;
-    LinkerInputBinary* b =
-        new LinkerInputBinary(input_filename.c_str(), file_data);
-    context.inputs.emplace_back(b);
     LinkOptions options = { NULL };
     if (s_debug)
       options.log_stream = s_log_stream.get();
@@ -0,0 +1,276 @@
+/*
+ * Copyright 2017 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "binary-reader-interpreter.h"
+#include "binary-reader.h"
+#include "error-handler.h"
+#include "interpreter.h"
+#include "option-parser.h"
+#include "stream.h"
+
+using namespace wabt;
+using namespace wabt::interpreter;
+
+static int s_verbose;
+static const char* s_infile;
+static const char* s_logfile;
+static uint64_t s_page_size = 4096;
+
+static ReadBinaryOptions s_read_binary_options;
+static std::unique_ptr<FileStream> s_log_stream;
+
+static const int kMaxHeatWidth = 40;
+
+static const char s_description[] =
+R"(  Read a file in the wasm binary format and a memory access log written by
+  wasm-interp --memory-access-log, and report the accesses per page of linear
+  memory and the read/write ratio per function.
+
+examples:
+  # run test.wasm, logging every 16th memory access to test.memlog
+  $ wasm-interp test.wasm --run-all-exports --memory-access-log test.memlog \
+      --memory-access-sample 16
+
+  # report the accesses in test.memlog per 4KiB page
+  $ wasm-memheat test.wasm test.memlog
+
+  # report the accesses in test.memlog per wasm page
+  $ wasm-memheat test.wasm test.memlog --page-size 65536
+)";
+
+static void parse_options(int argc, char** argv) {
+  OptionParser parser("wasm-memheat", s_description);
+
+  parser.AddOption('v', "verbose", "Use multiple times for more info", []() {
+    s_verbose++;
+    s_log_stream = FileStream::CreateStdout();
+    s_read_binary_options.log_stream = s_log_stream.get();
+  });
+  parser.AddHelpOption();
+  parser.AddOption('p', "page-size", "SIZE",
+                   "Size in bytes of the pages to report, must be a power of "
+                   "two (default 4096)",
+                   [](const std::string& argument) {
+                     s_page_size = strtoull(argument.c_str(), nullptr, 10);
+                   });
+  parser.AddArgument("filename", OptionParser::ArgumentCount::One,
+                     [](const char* argument) { s_infile = argument; });
+  parser.AddArgument("logfile", OptionParser::ArgumentCount::One,
+                     [](const char* argument) { s_logfile = argument; });
+  parser.Parse(argc, argv);
+
+  if (s_page_size == 0 || (s_page_size & (s_page_size - 1)) != 0)
+    WABT_FATAL("--page-size must be a power of two.\n");
+}
+
+struct AccessCount {
+  uint64_t reads = 0;
+  uint64_t writes = 0;
+
+  uint64_t total() const { return reads + writes; }
+  void Add(const MemoryAccess& access) {
+    if (access.is_store)
+      writes++;
+    else
+      reads++;
+  }
+};
+
+static interpreter::Result trap_host_callback(const HostFunc* func,
+                                              const FuncSignature* sig,
+                                              Index num_args,
+                                              TypedValue* args,
+                                              Index num_results,
+                                              TypedValue* out_results,
+                                              void* user_data) {
+  return interpreter::Result::TrapHostTrapped;
+}
+
+// The module is only read to rebuild the istream that wasm-interp ran, so
+// every import is accepted as-is; tables and memories keep their declared
+// limits.
+class AcceptingHostImportDelegate : public HostImportDelegate {
+ public:
+  wabt::Result ImportFunc(Import*,
+                          Func* func,
+                          FuncSignature*,
+                          const ErrorCallback&) override {
+    func->as_host()->callback = trap_host_callback;
+    return wabt::Result::Ok;
+  }
+
+  wabt::Result ImportTable(Import*, Table*, const ErrorCallback&) override {
+    return wabt::Result::Ok;
+  }
+
+  wabt::Result ImportMemory(Import*, Memory*, const ErrorCallback&) override {
+    return wabt::Result::Ok;
+  }
+
+  wabt::Result ImportGlobal(Import*, Global*, const ErrorCallback&) override {
+    return wabt::Result::Ok;
+  }
+};
+
+// Maps istream offsets back to the defined function that contains them.
+class FuncMap {
+ public:
+  explicit FuncMap(Environment* env) {
+    for (Index i = 0; i < env->GetFuncCount(); ++i) {
+      Func* func = env->GetFunc(i);
+      if (!func->is_host)
+        func_offsets_.emplace_back(func->as_defined()->offset, i);
+    }
+    std::sort(func_offsets_.begin(), func_offsets_.end());
+  }
+
+  Index GetFuncIndex(IstreamOffset pc) const {
+    auto iter = std::upper_bound(
+        func_offsets_.begin(), func_offsets_.end(),
+        std::make_pair(pc, kInvalidIndex));
+    if (iter == func_offsets_.begin())
+      return kInvalidIndex;
+    return (iter - 1)->second;
+  }
+
+ private:
+  std::vector<std::pair<IstreamOffset, Index>> func_offsets_;
+};
+
+static std::string get_func_name(DefinedModule* module, Index func_index) {
+  for (const Export& export_ : module->exports) {
+    if (export_.kind == ExternalKind::Func && export_.index == func_index)
+      return export_.name;
+  }
+  return std::string();
+}
+
+static void print_page_heatmap(const std::map<uint64_t, AccessCount>& pages) {
+  uint64_t max_total = 0;
+  for (const auto& pair : pages)
+    max_total = std::max(max_total, pair.second.total());
+
+  printf("\nPage heatmap (%" PRIu64 "-byte pages):\n", s_page_size);
+  printf("%10s  %18s  %10s  %10s  %s\n", "page", "address", "reads", "writes",
+         "heat");
+  for (const auto& pair : pages) {
+    const AccessCount& count = pair.second;
+    int width = static_cast<int>(
+        (count.total() * kMaxHeatWidth + max_total - 1) / max_total);
+    printf("%10" PRIu64 "  0x%016" PRIx64 "  %10" PRIu64 "  %10" PRIu64 "  %s\n",
+           pair.first, pair.first * s_page_size, count.reads, count.writes,
+           std::string(width, '#').c_str());
+  }
+}
+
+static void print_func_ratios(DefinedModule* module,
+                              const std::map<Index, AccessCount>& funcs) {
+  printf("\nFunction read/write ratio:\n");
+  printf("%10s  %10s  %10s  %7s  %s\n", "func", "reads", "writes", "reads%",
+         "name");
+  for (const auto& pair : funcs) {
+    const AccessCount& count = pair.second;
+    double read_percent = 100.0 * count.reads / count.total();
+    if (pair.first == kInvalidIndex) {
+      printf("%10s", "?");
+    } else {
+      printf("%10" PRIindex, pair.first);
+    }
+    printf("  %10" PRIu64 "  %10" PRIu64 "  %6.1f%%  %s\n", count.reads,
+           count.writes, read_percent,
+           get_func_name(module, pair.first).c_str());
+  }
+}
+
+static wabt::Result read_module(Environment* env, DefinedModule** out_module) {
+  MappedFile file;
+  wabt::Result result = file.Open(s_infile);
+  if (Failed(result))
+    return result;
+
+  ErrorHandlerFile error_handler(Location::Type::Binary);
+  return read_binary_interpreter(env, file.data(), file.size(),
+                                 &s_read_binary_options, &error_handler,
+                                 out_module);
+}
+
+int ProgramMain(int argc, char** argv) {
+  init_stdio();
+  parse_options(argc, argv);
+
+  Environment env;
+  HostModule* host_module = env.AppendHostModule("spectest");
+  host_module->import_delegate.reset(new AcceptingHostImportDelegate());
+
+  DefinedModule* module = nullptr;
+  wabt::Result result = read_module(&env, &module);
+  if (Failed(result))
+    return 1;
+
+  MappedFile log_file;
+  result = log_file.Open(s_logfile);
+  if (Failed(result))
+    return 1;
+
+  uint32_t sample_interval;
+  std::vector<MemoryAccess> accesses;
+  result = MemoryAccessLog::ReadAccesses(log_file.data(), log_file.size(),
+                                         &sample_interval, &accesses);
+  if (Failed(result)) {
+    fprintf(stderr, "%s: invalid memory access log\n", s_logfile);
+    return 1;
+  }
+
+  FuncMap func_map(&env);
+  AccessCount total;
+  std::map<uint64_t, AccessCount> pages;
+  std::map<Index, AccessCount> funcs;
+  for (const MemoryAccess& access : accesses) {
+    total.Add(access);
+    funcs[func_map.GetFuncIndex(access.pc)].Add(access);
+
+    // An unaligned access can straddle two pages; it counts for both.
+    uint64_t first_page = access.address / s_page_size;
+    uint64_t last_page = (access.address + access.size - 1) / s_page_size;
+    for (uint64_t page = first_page; page <= last_page; ++page)
+      pages[page].Add(access);
+  }
+
+  printf("Sampled accesses: %" PRIu64 " (1 in %u), %" PRIu64 " reads, %" PRIu64
+         " writes\n",
+         total.total(), sample_interval, total.reads, total.writes);
+  if (total.total() != 0) {
+    print_page_heatmap(pages);
+    print_func_ratios(module, funcs);
+  }
+  return 0;
+}
+
+int main(int argc, char** argv) {
+  WABT_TRY
+  return ProgramMain(argc, argv);
+  WABT_CATCH_BAD_ALLOC_AND_EXIT
+}
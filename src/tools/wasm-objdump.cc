@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include <climits>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
@@ -52,6 +53,25 @@ static void parse_options(int argc, char** argv) {
                    []() { s_objdump_options.raw = true; });
   parser.AddOption('d', "disassemble", "Disassemble function bodies",
                    []() { s_objdump_options.disassemble = true; });
+  parser.AddOption('\0', "jobs", "N",
+                   "Disassemble function bodies on N threads (default 1)",
+                   [](const std::string& argument) {
+                     char* end;
+                     long jobs = strtol(argument.c_str(), &end, 10);
+                     if (*end != '\0' || jobs < 1 || jobs > INT_MAX)
+                       WABT_FATAL("--jobs must be a positive integer.\n");
+                     s_objdump_options.jobs = jobs;
+                   });
+  parser.AddOption('\0', "chunk-size", "BYTES",
+                   "With --jobs, disassemble function bodies in chunks of "
+                   "about BYTES (default 65536)",
+                   [](const std::string& argument) {
+                     char* end;
+                     long long size = strtoll(argument.c_str(), &end, 10);
+                     if (*end != '\0' || size < 1)
+                       WABT_FATAL("--chunk-size must be a positive integer.\n");
+                     s_objdump_options.chunk_size = size;
+                   });
   parser.AddOption("debug", "Print extra debug information", []() {
     s_objdump_options.debug = true;
     s_log_stream = FileStream::CreateStdout();
@@ -61,6 +81,23 @@ static void parse_options(int argc, char** argv) {
                    "Test future extension for exception handling",
                    []() { s_objdump_options.allow_future_exceptions = true;
                    });
+  parser.AddOption("future-bulk-memory",
+                   "Test future extension for bulk memory operations",
+                   []() { s_objdump_options.allow_future_bulk_memory = true; });
+  parser.AddOption("future-simd",
+                   "Test future extension for SIMD",
+                   []() { s_objdump_options.allow_future_simd = true; });
+  parser.AddOption("future-threads",
+                   "Test future extension for threads",
+                   []() { s_objdump_options.allow_future_threads = true; });
+  parser.AddOption("future-tail-call",
+                   "Test future extension for tail calls",
+                   []() { s_objdump_options.allow_future_tail_call = true; });
+  parser.AddOption("future-multi-value",
+                   "Test future extension for multi-value",
+                   []() {
+                     s_objdump_options.allow_future_multi_value = true;
+                   });
   parser.AddOption('x', "details", "Show section details",
                    []() { s_objdump_options.details = true; });
   parser.AddOption('r', "reloc", "Show relocations inline with disassembly",
@@ -74,16 +111,16 @@ static void parse_options(int argc, char** argv) {
 }
 
 Result dump_file(const char* filename) {
-  std::vector<uint8_t> file_data;
-  Result result = ReadFile(filename, &file_data);
+  MappedFile file;
+  Result result = file.Open(filename);
   if (Failed(result))
     return result;
 
-  uint8_t* data = DataOrNull(file_data);
-  size_t size = file_data.size();
+  const uint8_t* data = file.data();
+  size_t size = file.size();
 
-  // Perform serveral passed over the binary in order to print out different
-  // types of information.
+  // The prepass indexes the binary; each of the other passes then reads only
+  // the sections that it prints.
   s_objdump_options.filename = filename;
   printf("\n");
 
@@ -34,8 +34,7 @@ using namespace wabt;
 static int s_verbose;
 static const char* s_infile;
 static const char* s_outfile;
-static size_t s_cutoff = 0;
-static const char* s_separator = ": ";
+static DisplayCounterOptions s_display_options;
 
 static ReadBinaryOptions s_read_binary_options;
 static std::unique_ptr<FileStream> s_log_stream;
@@ -66,160 +65,37 @@ static void parse_options(int argc, char** argv) {
                    [](const char* argument) { s_outfile = argument; });
   parser.AddOption(
       'c', "cutoff", "N", "Cutoff for reporting counts less than N",
-      [](const std::string& argument) { s_cutoff = atol(argument.c_str()); });
+      [](const std::string& argument) {
+        s_display_options.cutoff = atol(argument.c_str());
+      });
   parser.AddOption(
       's', "separator", "SEPARATOR",
       "Separator text between element and count when reporting counts",
-      [](const char* argument) { s_separator = argument; });
+      [](const char* argument) { s_display_options.separator = argument; });
   parser.AddArgument("filename", OptionParser::ArgumentCount::OneOrMore,
                      [](const char* argument) { s_infile = argument; });
   parser.Parse(argc, argv);
 }
 
-typedef int(int_counter_lt_fcn)(const IntCounter&, const IntCounter&);
-
-typedef int(int_pair_counter_lt_fcn)(const IntPairCounter&,
-                                     const IntPairCounter&);
-
-typedef void (*display_name_fcn)(FILE* out, intmax_t value);
-
 static void display_opcode_name(FILE* out, intmax_t opcode) {
   fprintf(out, "%s", Opcode(Opcode::Enum(opcode)).GetName());
 }
 
-static void display_intmax(FILE* out, intmax_t value) {
-  fprintf(out, "%" PRIdMAX, value);
-}
-
-static void display_int_counter_vector(FILE* out,
-                                       const IntCounterVector& vec,
-                                       display_name_fcn display_fcn,
-                                       const char* opcode_name) {
-  for (const IntCounter& counter : vec) {
-    if (counter.count == 0)
-      continue;
-    if (opcode_name)
-      fprintf(out, "(%s ", opcode_name);
-    display_fcn(out, counter.value);
-    if (opcode_name)
-      fprintf(out, ")");
-    fprintf(out, "%s%" PRIzd "\n", s_separator, counter.count);
-  }
-}
-
-static void display_int_pair_counter_vector(FILE* out,
-                                            const IntPairCounterVector& vec,
-                                            display_name_fcn display_first_fcn,
-                                            display_name_fcn display_second_fcn,
-                                            const char* opcode_name) {
-  for (const IntPairCounter& pair : vec) {
-    if (pair.count == 0)
-      continue;
-    if (opcode_name)
-      fprintf(out, "(%s ", opcode_name);
-    display_first_fcn(out, pair.first);
-    fputc(' ', out);
-    display_second_fcn(out, pair.second);
-    if (opcode_name)
-      fprintf(out, ")");
-    fprintf(out, "%s%" PRIzd "\n", s_separator, pair.count);
-  }
-}
-
-static int opcode_counter_gt(const IntCounter& counter_1,
-                             const IntCounter& counter_2) {
-  if (counter_1.count > counter_2.count)
-    return 1;
-  if (counter_1.count < counter_2.count)
-    return 0;
+static bool opcode_counter_gt(const IntCounter& counter_1,
+                              const IntCounter& counter_2) {
+  if (counter_1.count != counter_2.count)
+    return counter_1.count > counter_2.count;
   const char* name_1 = Opcode(Opcode::Enum(counter_1.value)).GetName();
   const char* name_2 = Opcode(Opcode::Enum(counter_2.value)).GetName();
-  int diff = strcmp(name_1, name_2);
-  if (diff > 0)
-    return 1;
-  return 0;
-}
-
-static int int_counter_gt(const IntCounter& counter_1,
-                          const IntCounter& counter_2) {
-  if (counter_1.count < counter_2.count)
-    return 0;
-  if (counter_1.count > counter_2.count)
-    return 1;
-  if (counter_1.value < counter_2.value)
-    return 0;
-  if (counter_1.value > counter_2.value)
-    return 1;
-  return 0;
-}
-
-static int int_pair_counter_gt(const IntPairCounter& counter_1,
-                               const IntPairCounter& counter_2) {
-  if (counter_1.count < counter_2.count)
-    return 0;
-  if (counter_1.count > counter_2.count)
-    return 1;
-  if (counter_1.first < counter_2.first)
-    return 0;
-  if (counter_1.first > counter_2.first)
-    return 1;
-  if (counter_1.second < counter_2.second)
-    return 0;
-  if (counter_1.second > counter_2.second)
-    return 1;
-  return 0;
-}
-
-static void display_sorted_int_counter_vector(FILE* out,
-                                              const char* title,
-                                              const IntCounterVector& vec,
-                                              int_counter_lt_fcn lt_fcn,
-                                              display_name_fcn display_fcn,
-                                              const char* opcode_name) {
-  if (vec.size() == 0)
-    return;
-
-  /* First filter out values less than cutoff. This speeds up sorting. */
-  IntCounterVector filtered_vec;
-  for (const IntCounter& counter: vec) {
-    if (counter.count < s_cutoff)
-      continue;
-    filtered_vec.push_back(counter);
-  }
-  std::sort(filtered_vec.begin(), filtered_vec.end(), lt_fcn);
-  fprintf(out, "%s\n", title);
-  display_int_counter_vector(out, filtered_vec, display_fcn, opcode_name);
-}
-
-static void display_sorted_int_pair_counter_vector(
-    FILE* out,
-    const char* title,
-    const IntPairCounterVector& vec,
-    int_pair_counter_lt_fcn lt_fcn,
-    display_name_fcn display_first_fcn,
-    display_name_fcn display_second_fcn,
-    const char* opcode_name) {
-  if (vec.size() == 0)
-    return;
-
-  IntPairCounterVector filtered_vec;
-  for (const IntPairCounter& pair : vec) {
-    if (pair.count < s_cutoff)
-      continue;
-    filtered_vec.push_back(pair);
-  }
-  std::sort(filtered_vec.begin(), filtered_vec.end(), lt_fcn);
-  fprintf(out, "%s\n", title);
-  display_int_pair_counter_vector(out, filtered_vec, display_first_fcn,
-                                  display_second_fcn, opcode_name);
+  return strcmp(name_1, name_2) > 0;
 }
 
 int ProgramMain(int argc, char** argv) {
   init_stdio();
   parse_options(argc, argv);
 
-  std::vector<uint8_t> file_data;
-  Result result = ReadFile(s_infile, &file_data);
+  MappedFile file;
+  Result result = file.Open(s_infile);
   if (Failed(result)) {
     const char* input_name = s_infile ? s_infile : "stdin";
     ERROR("Unable to parse: %s", input_name);
@@ -233,30 +109,36 @@ int ProgramMain(int argc, char** argv) {
   }
   if (Succeeded(result)) {
     OpcntData opcnt_data;
-    result = read_binary_opcnt(DataOrNull(file_data), file_data.size(),
+    result = read_binary_opcnt(file.data(), file.size(),
                                &s_read_binary_options, &opcnt_data);
     if (Succeeded(result)) {
       display_sorted_int_counter_vector(
           out, "Opcode counts:", opcnt_data.opcode_vec, opcode_counter_gt,
-          display_opcode_name, nullptr);
+          display_opcode_name, nullptr, s_display_options);
       display_sorted_int_counter_vector(
           out, "\ni32.const:", opcnt_data.i32_const_vec, int_counter_gt,
-          display_intmax, Opcode::I32Const_Opcode.GetName());
+          display_intmax, Opcode::I32Const_Opcode.GetName(),
+          s_display_options);
       display_sorted_int_counter_vector(
           out, "\nget_local:", opcnt_data.get_local_vec, int_counter_gt,
-          display_intmax, Opcode::GetLocal_Opcode.GetName());
+          display_intmax, Opcode::GetLocal_Opcode.GetName(),
+          s_display_options);
       display_sorted_int_counter_vector(
           out, "\nset_local:", opcnt_data.set_local_vec, int_counter_gt,
-          display_intmax, Opcode::SetLocal_Opcode.GetName());
+          display_intmax, Opcode::SetLocal_Opcode.GetName(),
+          s_display_options);
       display_sorted_int_counter_vector(
           out, "\ntee_local:", opcnt_data.tee_local_vec, int_counter_gt,
-          display_intmax, Opcode::TeeLocal_Opcode.GetName());
+          display_intmax, Opcode::TeeLocal_Opcode.GetName(),
+          s_display_options);
       display_sorted_int_pair_counter_vector(
           out, "\ni32.load:", opcnt_data.i32_load_vec, int_pair_counter_gt,
-          display_intmax, display_intmax, Opcode::I32Load_Opcode.GetName());
+          display_intmax, display_intmax, Opcode::I32Load_Opcode.GetName(),
+          s_display_options);
       display_sorted_int_pair_counter_vector(
           out, "\ni32.store:", opcnt_data.i32_store_vec, int_pair_counter_gt,
-          display_intmax, display_intmax, Opcode::I32Store_Opcode.GetName());
+          display_intmax, display_intmax, Opcode::I32Store_Opcode.GetName(),
+          s_display_options);
     }
   }
   return result != Result::Ok;
@@ -0,0 +1,131 @@
+/*
+ * Copyright 2017 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+
+#include "binary-reader.h"
+#include "binary-reader-validator.h"
+#include "error-handler.h"
+#include "option-parser.h"
+#include "stream.h"
+
+using namespace wabt;
+
+static int s_verbose;
+static const char* s_infile;
+static int s_jobs = 1;
+
+static ReadBinaryOptions s_read_binary_options;
+static std::unique_ptr<FileStream> s_log_stream;
+
+static const char s_description[] =
+R"(  Read a file in the wasm binary format, and validate it. Nothing is printed
+  if the module is valid; otherwise the first error is printed and the exit
+  status is 1.
+
+examples:
+  # validate binary file test.wasm
+  $ wasm-validate test.wasm
+
+  # validate test.wasm, checking the function bodies on 4 threads
+  $ wasm-validate test.wasm --jobs=4
+)";
+
+static void parse_options(int argc, char** argv) {
+  OptionParser parser("wasm-validate", s_description);
+
+  parser.AddOption('v', "verbose", "Use multiple times for more info", []() {
+    s_verbose++;
+    s_log_stream = FileStream::CreateStdout();
+    s_read_binary_options.log_stream = s_log_stream.get();
+  });
+  parser.AddHelpOption();
+  parser.AddOption('\0', "jobs", "N",
+                   "Check function bodies on N threads (default 1)",
+                   [](const std::string& argument) {
+                     char* end;
+                     long jobs = strtol(argument.c_str(), &end, 10);
+                     if (*end != '\0' || jobs < 1 || jobs > INT_MAX)
+                       WABT_FATAL("--jobs must be a positive integer.\n");
+                     s_jobs = jobs;
+                   });
+  parser.AddOption("future-exceptions",
+                   "Test future extension for exception handling",
+                   []() { s_read_binary_options.allow_future_exceptions = true;
+                   });
+  parser.AddOption("future-bulk-memory",
+                   "Test future extension for bulk memory operations",
+                   []() {
+                     s_read_binary_options.allow_future_bulk_memory = true;
+                   });
+  parser.AddOption("future-simd",
+                   "Test future extension for SIMD",
+                   []() { s_read_binary_options.allow_future_simd = true; });
+  parser.AddOption("future-threads",
+                   "Test future extension for threads",
+                   []() { s_read_binary_options.allow_future_threads = true; });
+  parser.AddOption("future-tail-call",
+                   "Test future extension for tail calls",
+                   []() {
+                     s_read_binary_options.allow_future_tail_call = true;
+                   });
+  parser.AddOption("future-multi-value",
+                   "Test future extension for multi-value",
+                   []() {
+                     s_read_binary_options.allow_future_multi_value = true;
+                   });
+  parser.AddArgument("filename", OptionParser::ArgumentCount::One,
+                     [](const char* argument) { s_infile = argument; });
+  parser.Parse(argc, argv);
+}
+
+int ProgramMain(int argc, char** argv) {
+  init_stdio();
+  parse_options(argc, argv);
+
+  ErrorHandlerFile error_handler(Location::Type::Binary);
+  Result result;
+  if (MappedFile::CanMap(s_infile)) {
+    MappedFile file;
+    result = file.Open(s_infile);
+    if (Succeeded(result)) {
+      result = validate_binary(file.data(), file.size(),
+                               &s_read_binary_options, &error_handler,
+                               s_jobs);
+    }
+  } else {
+    // E.g. a pipe; check each section as soon as it has arrived.
+    StreamingBinaryValidator validator(&s_read_binary_options,
+                                       &error_handler);
+    result = ReadFileChunks(s_infile, [&validator](const void* data,
+                                                   size_t size) {
+      return validator.Push(data, size);
+    });
+    if (Succeeded(result))
+      result = validator.Finish();
+  }
+  return result != Result::Ok;
+}
+
+int main(int argc, char** argv) {
+  WABT_TRY
+  return ProgramMain(argc, argv);
+  WABT_CATCH_BAD_ALLOC_AND_EXIT
+}
@@ -77,6 +77,27 @@ static void parse_options(int argc, char** argv) {
                    "Test future extension for exception handling",
                    []() { s_read_binary_options.allow_future_exceptions = true;
                    });
+  parser.AddOption("future-bulk-memory",
+                   "Test future extension for bulk memory operations",
+                   []() {
+                     s_read_binary_options.allow_future_bulk_memory = true;
+                   });
+  parser.AddOption("future-simd",
+                   "Test future extension for SIMD",
+                   []() { s_read_binary_options.allow_future_simd = true; });
+  parser.AddOption("future-threads",
+                   "Test future extension for threads",
+                   []() { s_read_binary_options.allow_future_threads = true; });
+  parser.AddOption("future-tail-call",
+                   "Test future extension for tail calls",
+                   []() {
+                     s_read_binary_options.allow_future_tail_call = true;
+                   });
+  parser.AddOption("future-multi-value",
+                   "Test future extension for multi-value",
+                   []() {
+                     s_read_binary_options.allow_future_multi_value = true;
+                   });
   parser.AddOption("inline-exports", "Write all exports inline",
                    []() { s_write_wat_options.inline_export = true; });
   parser.AddOption("no-debug-names", "Ignore debug names in the binary file",
@@ -101,18 +122,21 @@ int ProgramMain(int argc, char** argv) {
   init_stdio();
   parse_options(argc, argv);
 
-  std::vector<uint8_t> file_data;
-  result = ReadFile(s_infile.c_str(), &file_data);
+  MappedFile file;
+  result = file.Open(s_infile.c_str());
   if (Succeeded(result)) {
     ErrorHandlerFile error_handler(Location::Type::Binary);
     Module module;
-    result = read_binary_ir(s_infile.c_str(), DataOrNull(file_data),
-                            file_data.size(), &s_read_binary_options,
+    result = read_binary_ir(s_infile.c_str(), file.data(), file.size(),
+                            &s_read_binary_options,
                             &error_handler, &module);
     if (Succeeded(result)) {
       if (Succeeded(result) && s_validate) {
         WastLexer* lexer = nullptr;
-        result = validate_module(lexer, &module, &error_handler);
+        ValidateOptions options;
+        options.allow_future_multi_value =
+            s_read_binary_options.allow_future_multi_value;
+        result = validate_module(lexer, &module, &error_handler, &options);
       }
 
       if (s_generate_names)
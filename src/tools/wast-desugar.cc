@@ -67,6 +67,21 @@ static void parse_options(int argc, char** argv) {
   parser.AddOption("future-exceptions",
                    "Test future extension for exception handling",
                    []() { s_parse_options.allow_future_exceptions = true; });
+  parser.AddOption("future-bulk-memory",
+                   "Test future extension for bulk memory operations",
+                   []() { s_parse_options.allow_future_bulk_memory = true; });
+  parser.AddOption("future-simd",
+                   "Test future extension for SIMD",
+                   []() { s_parse_options.allow_future_simd = true; });
+  parser.AddOption("future-threads",
+                   "Test future extension for threads",
+                   []() { s_parse_options.allow_future_threads = true; });
+  parser.AddOption("future-tail-call",
+                   "Test future extension for tail calls",
+                   []() { s_parse_options.allow_future_tail_call = true; });
+  parser.AddOption("future-multi-value",
+                   "Test future extension for multi-value",
+                   []() { s_parse_options.allow_future_multi_value = true; });
   parser.AddOption(
       "generate-names",
       "Give auto-generated names to non-named functions, types, etc.",
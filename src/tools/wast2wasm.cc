@@ -86,6 +86,21 @@ static void parse_options(int argc, char* argv[]) {
   parser.AddOption("future-exceptions",
                    "Test future extension for exception handling",
                    []() { s_parse_options.allow_future_exceptions = true; });
+  parser.AddOption("future-bulk-memory",
+                   "Test future extension for bulk memory operations",
+                   []() { s_parse_options.allow_future_bulk_memory = true; });
+  parser.AddOption("future-simd",
+                   "Test future extension for SIMD",
+                   []() { s_parse_options.allow_future_simd = true; });
+  parser.AddOption("future-threads",
+                   "Test future extension for threads",
+                   []() { s_parse_options.allow_future_threads = true; });
+  parser.AddOption("future-tail-call",
+                   "Test future extension for tail calls",
+                   []() { s_parse_options.allow_future_tail_call = true; });
+  parser.AddOption("future-multi-value",
+                   "Test future extension for multi-value",
+                   []() { s_parse_options.allow_future_multi_value = true; });
   parser.AddOption('o', "output", "FILE", "output wasm binary file",
                    [](const char* argument) { s_outfile = argument; });
   parser.AddOption(
@@ -143,8 +158,12 @@ int ProgramMain(int argc, char** argv) {
   if (Succeeded(result)) {
     result = resolve_names_script(lexer.get(), script, &error_handler);
 
-    if (Succeeded(result) && s_validate)
-      result = validate_script(lexer.get(), script, &error_handler);
+    if (Succeeded(result) && s_validate) {
+      ValidateOptions options;
+      options.allow_future_multi_value =
+          s_parse_options.allow_future_multi_value;
+      result = validate_script(lexer.get(), script, &error_handler, &options);
+    }
 
     if (Succeeded(result)) {
       if (s_spec) {
@@ -16,6 +16,8 @@
 
 #include "type-checker.h"
 
+#include <string>
+
 #define CHECK_RESULT(expr)  \
   do {                      \
     if (Failed(expr))       \
@@ -178,6 +180,35 @@ Result TypeChecker::CheckType(Type actual, Type expected, const char* desc) {
   return Result::Ok;
 }
 
+static std::string TypesToString(const TypeVector& types) {
+  if (types.empty())
+    return get_type_name(Type::Void);
+
+  std::string result;
+  for (size_t i = 0; i < types.size(); ++i) {
+    if (i != 0)
+      result += ' ';
+    result += get_type_name(types[i]);
+  }
+  return result;
+}
+
+Result TypeChecker::CheckTypes(const TypeVector& actual,
+                               const TypeVector& expected,
+                               const char* desc) {
+  bool match = actual.size() == expected.size();
+  for (size_t i = 0; match && i < actual.size(); ++i) {
+    match = expected[i] == actual[i] || expected[i] == Type::Any ||
+            actual[i] == Type::Any;
+  }
+  if (!match) {
+    PrintError("type mismatch in %s, expected %s but got %s.", desc,
+               TypesToString(expected).c_str(), TypesToString(actual).c_str());
+    return Result::Error;
+  }
+  return Result::Ok;
+}
+
 Result TypeChecker::CheckSignature(const TypeVector& sig, const char* desc) {
   Result result = Result::Ok;
   COMBINE_RESULT(result, CheckTypeStackLimit(sig.size(), desc));
@@ -212,6 +243,27 @@ Result TypeChecker::PopAndCheckCall(const TypeVector& param_types,
   return result;
 }
 
+// The callee's results become the results of the current function, so they
+// must match its signature exactly.
+Result TypeChecker::PopAndCheckReturnCall(const TypeVector& param_types,
+                                          const TypeVector& result_types,
+                                          const char* desc) {
+  Result result = Result::Ok;
+  Label* func_label;
+  CHECK_RESULT(GetLabel(label_stack_.size() - 1, &func_label));
+  COMBINE_RESULT(result, PopAndCheckCall(param_types, result_types, desc));
+  if (result_types.size() != func_label->sig.size()) {
+    PrintError("result count mismatch in %s, expected %" PRIzd
+               " but got %" PRIzd ".",
+               desc, func_label->sig.size(), result_types.size());
+    result = Result::Error;
+  } else {
+    COMBINE_RESULT(result, PopAndCheckSignature(func_label->sig, desc));
+  }
+  CHECK_RESULT(SetUnreachable());
+  return result;
+}
+
 Result TypeChecker::PopAndCheck1Type(Type expected, const char* desc) {
   Result result = Result::Ok;
   Type actual = Type::Any;
@@ -235,6 +287,24 @@ Result TypeChecker::PopAndCheck2Types(Type expected1,
   return result;
 }
 
+Result TypeChecker::PopAndCheck3Types(Type expected1,
+                                      Type expected2,
+                                      Type expected3,
+                                      const char* desc) {
+  Result result = Result::Ok;
+  Type actual1 = Type::Any;
+  Type actual2 = Type::Any;
+  Type actual3 = Type::Any;
+  COMBINE_RESULT(result, CheckTypeStackLimit(3, desc));
+  COMBINE_RESULT(result, PopType(&actual3));
+  COMBINE_RESULT(result, PopType(&actual2));
+  COMBINE_RESULT(result, PopType(&actual1));
+  COMBINE_RESULT(result, CheckType(actual1, expected1, desc));
+  COMBINE_RESULT(result, CheckType(actual2, expected2, desc));
+  COMBINE_RESULT(result, CheckType(actual3, expected3, desc));
+  return result;
+}
+
 Result TypeChecker::PopAndCheck2TypesAreEqual(Type* out_type,
                                               const char* desc) {
   Result result = Result::Ok;
@@ -268,6 +338,40 @@ Result TypeChecker::BeginFunction(const TypeVector* sig) {
   return Result::Ok;
 }
 
+Result TypeChecker::OnAtomicLoad(Opcode opcode) {
+  return CheckOpcode1(opcode);
+}
+
+Result TypeChecker::OnAtomicNotify(Opcode opcode) {
+  return CheckOpcode2(opcode);
+}
+
+Result TypeChecker::OnAtomicRmw(Opcode opcode) {
+  return CheckOpcode2(opcode);
+}
+
+// The expected and replacement values both have the type of the 2nd parameter.
+Result TypeChecker::OnAtomicRmwCmpxchg(Opcode opcode) {
+  Result result =
+      PopAndCheck3Types(opcode.GetParamType1(), opcode.GetParamType2(),
+                        opcode.GetParamType2(), opcode.GetName());
+  PushType(opcode.GetResultType());
+  return result;
+}
+
+Result TypeChecker::OnAtomicStore(Opcode opcode) {
+  return CheckOpcode2(opcode);
+}
+
+// The timeout is always an i64 count of nanoseconds.
+Result TypeChecker::OnAtomicWait(Opcode opcode) {
+  Result result = PopAndCheck3Types(opcode.GetParamType1(),
+                                    opcode.GetParamType2(), Type::I64,
+                                    opcode.GetName());
+  PushType(opcode.GetResultType());
+  return result;
+}
+
 Result TypeChecker::OnBinary(Opcode opcode) {
   return CheckOpcode2(opcode);
 }
@@ -298,7 +402,8 @@ Result TypeChecker::OnBrIf(Index depth) {
 }
 
 Result TypeChecker::BeginBrTable() {
-  br_table_sig_ = Type::Any;
+  br_table_sig_.clear();
+  br_table_sig_is_set_ = false;
   return PopAndCheck1Type(Type::I32, "br_table");
 }
 
@@ -306,16 +411,14 @@ Result TypeChecker::OnBrTableTarget(Index depth) {
   Result result = Result::Ok;
   Label* label;
   CHECK_RESULT(GetLabel(depth, &label));
-  Type label_sig;
-  if (label->label_type == LabelType::Loop) {
-    label_sig = Type::Void;
-  } else {
-    assert(label->sig.size() <= 1);
-    label_sig = label->sig.size() == 0 ? Type::Void : label->sig[0];
-  }
+  TypeVector label_sig;
+  if (label->label_type != LabelType::Loop)
+    label_sig = label->sig;
 
-  COMBINE_RESULT(result, CheckType(br_table_sig_, label_sig, "br_table"));
+  if (br_table_sig_is_set_)
+    COMBINE_RESULT(result, CheckTypes(br_table_sig_, label_sig, "br_table"));
   br_table_sig_ = label_sig;
+  br_table_sig_is_set_ = true;
 
   if (label->label_type != LabelType::Loop)
     COMBINE_RESULT(result, CheckSignature(label->sig, "br_table"));
@@ -353,7 +456,9 @@ Result TypeChecker::OnCatchBlock(const TypeVector* sig) {
   Result result = Result::Ok;
   Label* label;
   CHECK_RESULT(TopLabel(&label));
-  COMBINE_RESULT(result, CheckLabelType(label, LabelType::Try));
+  // A try block can have several catch blocks.
+  if (label->label_type != LabelType::Catch)
+    COMBINE_RESULT(result, CheckLabelType(label, LabelType::Try));
   COMBINE_RESULT(result, PopAndCheckSignature(label->sig, "try block"));
   COMBINE_RESULT(result, CheckTypeStackEnd("try block"));
   ResetTypeStackToLabel(label);
@@ -458,6 +563,16 @@ Result TypeChecker::OnLoop(const TypeVector* sig) {
   return Result::Ok;
 }
 
+Result TypeChecker::OnMemoryCopy() {
+  return PopAndCheck3Types(Type::I32, Type::I32, Type::I32,
+                           "memory.copy");
+}
+
+Result TypeChecker::OnMemoryFill() {
+  return PopAndCheck3Types(Type::I32, Type::I32, Type::I32,
+                           "memory.fill");
+}
+
 Result TypeChecker::OnRethrow(Index depth) {
   Result result = Result::Ok;
   Label* label;
@@ -500,6 +615,20 @@ Result TypeChecker::OnReturn() {
   return result;
 }
 
+Result TypeChecker::OnReturnCall(const TypeVector* param_types,
+                                 const TypeVector* result_types) {
+  return PopAndCheckReturnCall(*param_types, *result_types, "return_call");
+}
+
+Result TypeChecker::OnReturnCallIndirect(const TypeVector* param_types,
+                                         const TypeVector* result_types) {
+  Result result = Result::Ok;
+  COMBINE_RESULT(result, PopAndCheck1Type(Type::I32, "return_call_indirect"));
+  COMBINE_RESULT(result, PopAndCheckReturnCall(*param_types, *result_types,
+                                               "return_call_indirect"));
+  return result;
+}
+
 Result TypeChecker::OnSelect() {
   Result result = Result::Ok;
   COMBINE_RESULT(result, PopAndCheck1Type(Type::I32, "select"));
@@ -517,6 +646,28 @@ Result TypeChecker::OnSetLocal(Type type) {
   return PopAndCheck1Type(type, "set_local");
 }
 
+Result TypeChecker::OnSimdLaneOp(Opcode opcode, uint32_t lane) {
+  Result result = Result::Ok;
+  // extract_lane has no second operand; replace_lane takes the new lane
+  // value as its second operand.
+  bool is_extract = opcode.GetParamType2() == Type::Void;
+  Type lane_type =
+      is_extract ? opcode.GetResultType() : opcode.GetParamType2();
+  uint32_t lane_count =
+      (lane_type == Type::I64 || lane_type == Type::F64) ? 2 : 4;
+  if (lane >= lane_count) {
+    PrintError("lane index must be less than %u in %s, got %u", lane_count,
+               opcode.GetName(), lane);
+    result = Result::Error;
+  }
+  if (is_extract) {
+    COMBINE_RESULT(result, CheckOpcode1(opcode));
+  } else {
+    COMBINE_RESULT(result, CheckOpcode2(opcode));
+  }
+  return result;
+}
+
 Result TypeChecker::OnStore(Opcode opcode) {
   return CheckOpcode2(opcode);
 }
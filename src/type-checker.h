@@ -51,6 +51,12 @@ class TypeChecker {
   Result GetLabel(Index depth, Label** out_label);
 
   Result BeginFunction(const TypeVector* sig);
+  Result OnAtomicLoad(Opcode);
+  Result OnAtomicNotify(Opcode);
+  Result OnAtomicRmw(Opcode);
+  Result OnAtomicRmwCmpxchg(Opcode);
+  Result OnAtomicStore(Opcode);
+  Result OnAtomicWait(Opcode);
   Result OnBinary(Opcode);
   Result OnBlock(const TypeVector* sig);
   Result OnBr(Index depth);
@@ -76,11 +82,18 @@ class TypeChecker {
   Result OnIf(const TypeVector* sig);
   Result OnLoad(Opcode);
   Result OnLoop(const TypeVector* sig);
+  Result OnMemoryCopy();
+  Result OnMemoryFill();
   Result OnRethrow(Index depth);
   Result OnReturn();
+  Result OnReturnCall(const TypeVector* param_types,
+                      const TypeVector* result_types);
+  Result OnReturnCallIndirect(const TypeVector* param_types,
+                              const TypeVector* result_types);
   Result OnSelect();
   Result OnSetGlobal(Type);
   Result OnSetLocal(Type);
+  Result OnSimdLaneOp(Opcode, uint32_t lane);
   Result OnStore(Opcode);
   Result OnTeeLocal(Type);
   Result OnThrow(const TypeVector* sig);
@@ -106,13 +119,23 @@ class TypeChecker {
   Result CheckTypeStackLimit(size_t expected, const char* desc);
   Result CheckTypeStackEnd(const char* desc);
   Result CheckType(Type actual, Type expected, const char* desc);
+  Result CheckTypes(const TypeVector& actual,
+                    const TypeVector& expected,
+                    const char* desc);
   Result CheckSignature(const TypeVector& sig, const char* desc);
   Result PopAndCheckSignature(const TypeVector& sig, const char* desc);
+  Result PopAndCheckReturnCall(const TypeVector& param_types,
+                               const TypeVector& result_types,
+                               const char* desc);
   Result PopAndCheckCall(const TypeVector& param_types,
                          const TypeVector& result_types,
                          const char* desc);
   Result PopAndCheck1Type(Type expected, const char* desc);
   Result PopAndCheck2Types(Type expected1, Type expected2, const char* desc);
+  Result PopAndCheck3Types(Type expected1,
+                           Type expected2,
+                           Type expected3,
+                           const char* desc);
   Result PopAndCheck2TypesAreEqual(Type* out_type, const char* desc);
   Result CheckOpcode1(Opcode opcode);
   Result CheckOpcode2(Opcode opcode);
@@ -121,9 +144,10 @@ class TypeChecker {
   ErrorCallback error_callback_;
   TypeVector type_stack_;
   std::vector<Label> label_stack_;
-  // TODO(binji): This will need to be complete signature when signatures with
-  // multiple types are allowed.
-  Type br_table_sig_ = Type::Void;
+  // The signature shared by all br_table targets seen so far; unset until the
+  // first target is checked.
+  TypeVector br_table_sig_;
+  bool br_table_sig_is_set_ = false;
 };
 
 }  // namespace wabt
@@ -35,7 +35,10 @@ namespace {
 class Validator {
  public:
   WABT_DISALLOW_COPY_AND_ASSIGN(Validator);
-  Validator(ErrorHandler*, WastLexer*, const Script*);
+  Validator(ErrorHandler*,
+            WastLexer*,
+            const Script*,
+            const ValidateOptions* options);
 
   Result CheckModule(const Module* module);
   Result CheckScript(const Script* script);
@@ -79,6 +82,11 @@ class Validator {
   void CheckAlign(const Location* loc,
                   Address alignment,
                   Address natural_alignment);
+  void CheckAtomicAlign(const Location* loc,
+                        Address alignment,
+                        Address natural_alignment);
+  template <typename T>
+  void CheckAtomicExpr(const T* expr, Result (TypeChecker::*func)(Opcode));
   void CheckType(const Location* loc,
                  Type actual,
                  Type expected,
@@ -145,6 +153,7 @@ class Validator {
   ErrorHandler* error_handler_ = nullptr;
   WastLexer* lexer_ = nullptr;
   const Script* script_ = nullptr;
+  const ValidateOptions* options_ = nullptr;
   const Module* current_module_ = nullptr;
   const Func* current_func_ = nullptr;
   Index current_table_index_ = 0;
@@ -161,8 +170,12 @@ class Validator {
 
 Validator::Validator(ErrorHandler* error_handler,
                      WastLexer* lexer,
-                     const Script* script)
-    : error_handler_(error_handler), lexer_(lexer), script_(script) {
+                     const Script* script,
+                     const ValidateOptions* options)
+    : error_handler_(error_handler),
+      lexer_(lexer),
+      script_(script),
+      options_(options) {
   typechecker_.set_error_callback(
       [this](const char* msg) { OnTypecheckerError(msg); });
 }
@@ -320,6 +333,25 @@ void Validator::CheckAlign(const Location* loc,
   }
 }
 
+void Validator::CheckAtomicAlign(const Location* loc,
+                                 Address alignment,
+                                 Address natural_alignment) {
+  if (alignment != WABT_USE_NATURAL_ALIGNMENT &&
+      alignment != natural_alignment) {
+    PrintError(loc, "alignment must be equal to natural alignment (%u)",
+               natural_alignment);
+  }
+}
+
+template <typename T>
+void Validator::CheckAtomicExpr(const T* expr,
+                                Result (TypeChecker::*func)(Opcode)) {
+  CheckHasMemory(&expr->loc, expr->opcode);
+  CheckAtomicAlign(&expr->loc, expr->align,
+                   get_opcode_natural_alignment(expr->opcode));
+  (typechecker_.*func)(expr->opcode);
+}
+
 void Validator::CheckType(const Location* loc,
                           Type actual,
                           Type expected,
@@ -409,7 +441,7 @@ void Validator::CheckHasMemory(const Location* loc, Opcode opcode) {
 void Validator::CheckBlockSig(const Location* loc,
                               Opcode opcode,
                               const BlockSignature* sig) {
-  if (sig->size() > 1) {
+  if (sig->size() > 1 && !options_->allow_future_multi_value) {
     PrintError(loc,
                "multiple %s signature result types not currently supported.",
                opcode.GetName());
@@ -420,6 +452,33 @@ void Validator::CheckExpr(const Expr* expr) {
   expr_loc_ = &expr->loc;
 
   switch (expr->type) {
+    case ExprType::AtomicLoad:
+      CheckAtomicExpr(cast<AtomicLoadExpr>(expr), &TypeChecker::OnAtomicLoad);
+      break;
+
+    case ExprType::AtomicNotify:
+      CheckAtomicExpr(cast<AtomicNotifyExpr>(expr),
+                      &TypeChecker::OnAtomicNotify);
+      break;
+
+    case ExprType::AtomicRmw:
+      CheckAtomicExpr(cast<AtomicRmwExpr>(expr), &TypeChecker::OnAtomicRmw);
+      break;
+
+    case ExprType::AtomicRmwCmpxchg:
+      CheckAtomicExpr(cast<AtomicRmwCmpxchgExpr>(expr),
+                      &TypeChecker::OnAtomicRmwCmpxchg);
+      break;
+
+    case ExprType::AtomicStore:
+      CheckAtomicExpr(cast<AtomicStoreExpr>(expr),
+                      &TypeChecker::OnAtomicStore);
+      break;
+
+    case ExprType::AtomicWait:
+      CheckAtomicExpr(cast<AtomicWaitExpr>(expr), &TypeChecker::OnAtomicWait);
+      break;
+
     case ExprType::Binary:
       typechecker_.OnBinary(cast<BinaryExpr>(expr)->opcode);
       break;
@@ -541,6 +600,16 @@ void Validator::CheckExpr(const Expr* expr) {
       typechecker_.OnCurrentMemory();
       break;
 
+    case ExprType::MemoryCopy:
+      CheckHasMemory(&expr->loc, Opcode::MemoryCopy);
+      typechecker_.OnMemoryCopy();
+      break;
+
+    case ExprType::MemoryFill:
+      CheckHasMemory(&expr->loc, Opcode::MemoryFill);
+      typechecker_.OnMemoryFill();
+      break;
+
     case ExprType::Nop:
       break;
 
@@ -552,6 +621,29 @@ void Validator::CheckExpr(const Expr* expr) {
       typechecker_.OnReturn();
       break;
 
+    case ExprType::ReturnCall: {
+      const Func* callee;
+      if (Succeeded(CheckFuncVar(&cast<ReturnCallExpr>(expr)->var, &callee))) {
+        typechecker_.OnReturnCall(&callee->decl.sig.param_types,
+                                  &callee->decl.sig.result_types);
+      }
+      break;
+    }
+
+    case ExprType::ReturnCallIndirect: {
+      const FuncType* func_type;
+      if (current_module_->tables.size() == 0) {
+        PrintError(&expr->loc,
+                   "found return_call_indirect operator, but no table");
+      }
+      if (Succeeded(CheckFuncTypeVar(
+              &cast<ReturnCallIndirectExpr>(expr)->var, &func_type))) {
+        typechecker_.OnReturnCallIndirect(&func_type->sig.param_types,
+                                          &func_type->sig.result_types);
+      }
+      break;
+    }
+
     case ExprType::Select:
       typechecker_.OnSelect();
       break;
@@ -566,6 +658,12 @@ void Validator::CheckExpr(const Expr* expr) {
           GetLocalVarTypeOrAny(&cast<SetLocalExpr>(expr)->var));
       break;
 
+    case ExprType::SimdLaneOp: {
+      auto lane_expr = cast<SimdLaneOpExpr>(expr);
+      typechecker_.OnSimdLaneOp(lane_expr->opcode, lane_expr->lane);
+      break;
+    }
+
     case ExprType::Store: {
       auto store_expr = cast<StoreExpr>(expr);
       CheckHasMemory(&store_expr->loc, store_expr->opcode);
@@ -641,7 +739,7 @@ void Validator::CheckFuncSignatureMatchesFuncType(const Location* loc,
 
 void Validator::CheckFunc(const Location* loc, const Func* func) {
   current_func_ = func;
-  if (func->GetNumResults() > 1) {
+  if (func->GetNumResults() > 1 && !options_->allow_future_multi_value) {
     PrintError(loc, "multiple result values not currently supported.");
     // Don't run any other checks, the won't test the result_type properly.
     return;
@@ -749,6 +847,8 @@ void Validator::CheckTable(const Location* loc, const Table* table) {
   if (current_table_index_ == 1)
     PrintError(loc, "only one table allowed");
   CheckLimits(loc, &table->elem_limits, UINT32_MAX, "elems");
+  if (table->elem_limits.is_shared)
+    PrintError(loc, "tables may not be shared");
 }
 
 void Validator::CheckElemSegments(const Module* module) {
@@ -1147,16 +1247,18 @@ Result Validator::CheckScript(const Script* script) {
 
 Result validate_script(WastLexer* lexer,
                        const Script* script,
-                       ErrorHandler* error_handler) {
-  Validator validator(error_handler, lexer, script);
+                       ErrorHandler* error_handler,
+                       const ValidateOptions* options) {
+  Validator validator(error_handler, lexer, script, options);
 
   return validator.CheckScript(script);
 }
 
 Result validate_module(WastLexer* lexer,
                        const Module* module,
-                       ErrorHandler* error_handler) {
-  Validator validator(error_handler, lexer, nullptr);
+                       ErrorHandler* error_handler,
+                       const ValidateOptions* options) {
+  Validator validator(error_handler, lexer, nullptr, options);
 
   return validator.CheckModule(module);
 }
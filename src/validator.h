@@ -25,10 +25,20 @@ struct Module;
 struct Script;
 class ErrorHandler;
 
+struct ValidateOptions {
+  bool allow_future_multi_value = false;
+};
+
 // Perform all checks on the script. It is valid if and only if this function
 // succeeds.
-Result validate_script(WastLexer*, const Script*, ErrorHandler*);
-Result validate_module(WastLexer*, const Module*, ErrorHandler*);
+Result validate_script(WastLexer*,
+                       const Script*,
+                       ErrorHandler*,
+                       const ValidateOptions*);
+Result validate_module(WastLexer*,
+                       const Module*,
+                       ErrorHandler*,
+                       const ValidateOptions*);
 
 }  // namespace wabt
 
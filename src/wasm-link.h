@@ -101,7 +101,7 @@ typedef std::vector<Section*> SectionPtrVector;
 class LinkerInputBinary {
  public:
   WABT_DISALLOW_COPY_AND_ASSIGN(LinkerInputBinary);
-  LinkerInputBinary(const char* filename, const std::vector<uint8_t>& data);
+  explicit LinkerInputBinary(const char* filename);
 
   Index RelocateFuncIndex(Index findex);
   Index RelocateTypeIndex(Index index);
@@ -112,7 +112,8 @@ class LinkerInputBinary {
   bool IsInactiveFunctionImport(Index index);
 
   const char* filename;
-  std::vector<uint8_t> data;
+  /* Opened writable; relocations are applied in place, never to the file. */
+  MappedFile file;
   std::vector<std::unique_ptr<Section>> sections;
   std::vector<Export> exports;
 
@@ -331,6 +331,7 @@ int WastLexer::GetToken(Token* lval, Location* loc, WastParser* parser) {
       <i> "i64"                 { TYPE(I64); RETURN(VALUE_TYPE); }
       <i> "f32"                 { TYPE(F32); RETURN(VALUE_TYPE); }
       <i> "f64"                 { TYPE(F64); RETURN(VALUE_TYPE); }
+      <i> "v128"                { TYPE(V128); RETURN(VALUE_TYPE); }
       <i> "anyfunc"             { RETURN(ANYFUNC); }
       <i> "mut"                 { RETURN(MUT); }
       <i> "nop"                 { RETURN(NOP); }
@@ -344,6 +345,10 @@ int WastLexer::GetToken(Token* lval, Location* loc, WastParser* parser) {
       <i> "br_table"            { RETURN(BR_TABLE); }
       <i> "call"                { RETURN(CALL); }
       <i> "call_indirect"       { RETURN(CALL_INDIRECT); }
+      <i> "return_call"         { OPCODE(ReturnCall); RETURN(RETURN_CALL); }
+      <i> "return_call_indirect" {
+                                  OPCODE(ReturnCallIndirect);
+                                  RETURN(RETURN_CALL_INDIRECT); }
       <i> "drop"                { RETURN(DROP); }
       <i> "end"                 { RETURN(END); }
       <i> "return"              { RETURN(RETURN); }
@@ -356,10 +361,12 @@ int WastLexer::GetToken(Token* lval, Location* loc, WastParser* parser) {
       <i> "i64.load"            { OPCODE(I64Load); RETURN(LOAD); }
       <i> "f32.load"            { OPCODE(F32Load); RETURN(LOAD); }
       <i> "f64.load"            { OPCODE(F64Load); RETURN(LOAD); }
+      <i> "v128.load"           { OPCODE(V128Load); RETURN(LOAD); }
       <i> "i32.store"           { OPCODE(I32Store); RETURN(STORE); }
       <i> "i64.store"           { OPCODE(I64Store); RETURN(STORE); }
       <i> "f32.store"           { OPCODE(F32Store); RETURN(STORE); }
       <i> "f64.store"           { OPCODE(F64Store); RETURN(STORE); }
+      <i> "v128.store"          { OPCODE(V128Store); RETURN(STORE); }
       <i> "i32.load8_s"         { OPCODE(I32Load8S); RETURN(LOAD); }
       <i> "i64.load8_s"         { OPCODE(I64Load8S); RETURN(LOAD); }
       <i> "i32.load8_u"         { OPCODE(I32Load8U); RETURN(LOAD); }
@@ -381,6 +388,7 @@ int WastLexer::GetToken(Token* lval, Location* loc, WastParser* parser) {
       <i> "i64.const"           { TYPE(I64); RETURN(CONST); }
       <i> "f32.const"           { TYPE(F32); RETURN(CONST); }
       <i> "f64.const"           { TYPE(F64); RETURN(CONST); }
+      <i> "v128.const"          { OPCODE(V128Const); RETURN(V128_CONST); }
       <i> "i32.eqz"             { OPCODE(I32Eqz); RETURN(CONVERT); }
       <i> "i64.eqz"             { OPCODE(I64Eqz); RETURN(CONVERT); }
       <i> "i32.clz"             { OPCODE(I32Clz); RETURN(UNARY); }
@@ -508,6 +516,8 @@ int WastLexer::GetToken(Token* lval, Location* loc, WastParser* parser) {
       <i> "unreachable"         { RETURN(UNREACHABLE); }
       <i> "current_memory"      { RETURN(CURRENT_MEMORY); }
       <i> "grow_memory"         { RETURN(GROW_MEMORY); }
+      <i> "memory.copy"         { OPCODE(MemoryCopy); RETURN(MEMORY_COPY); }
+      <i> "memory.fill"         { OPCODE(MemoryFill); RETURN(MEMORY_FILL); }
       <i> "type"                { RETURN(TYPE); }
       <i> "func"                { RETURN(FUNC); }
       <i> "param"               { RETURN(PARAM); }
@@ -544,6 +554,241 @@ int WastLexer::GetToken(Token* lval, Location* loc, WastParser* parser) {
       <i> "catch_all"           { RETURN_LPAR(CATCH_ALL); }
       <i> "throw"               { RETURN(THROW); }
       <i> "rethrow"             { RETURN(RETHROW); }
+      <i> "i8x16"               { RETURN(I8X16); }
+      <i> "i16x8"               { RETURN(I16X8); }
+      <i> "i32x4"               { RETURN(I32X4); }
+      <i> "i64x2"               { RETURN(I64X2); }
+      <i> "f32x4"               { RETURN(F32X4); }
+      <i> "f64x2"               { RETURN(F64X2); }
+      <i> "i8x16.splat"         { OPCODE(I8X16Splat); RETURN(UNARY); }
+      <i> "i16x8.splat"         { OPCODE(I16X8Splat); RETURN(UNARY); }
+      <i> "i32x4.splat"         { OPCODE(I32X4Splat); RETURN(UNARY); }
+      <i> "i64x2.splat"         { OPCODE(I64X2Splat); RETURN(UNARY); }
+      <i> "f32x4.splat"         { OPCODE(F32X4Splat); RETURN(UNARY); }
+      <i> "f64x2.splat"         { OPCODE(F64X2Splat); RETURN(UNARY); }
+      <i> "i32x4.extract_lane" {
+                                  OPCODE(I32X4ExtractLane);
+                                  RETURN(SIMD_LANE_OP); }
+      <i> "i32x4.replace_lane" {
+                                  OPCODE(I32X4ReplaceLane);
+                                  RETURN(SIMD_LANE_OP); }
+      <i> "i64x2.extract_lane" {
+                                  OPCODE(I64X2ExtractLane);
+                                  RETURN(SIMD_LANE_OP); }
+      <i> "i64x2.replace_lane" {
+                                  OPCODE(I64X2ReplaceLane);
+                                  RETURN(SIMD_LANE_OP); }
+      <i> "f32x4.extract_lane" {
+                                  OPCODE(F32X4ExtractLane);
+                                  RETURN(SIMD_LANE_OP); }
+      <i> "f32x4.replace_lane" {
+                                  OPCODE(F32X4ReplaceLane);
+                                  RETURN(SIMD_LANE_OP); }
+      <i> "f64x2.extract_lane" {
+                                  OPCODE(F64X2ExtractLane);
+                                  RETURN(SIMD_LANE_OP); }
+      <i> "f64x2.replace_lane" {
+                                  OPCODE(F64X2ReplaceLane);
+                                  RETURN(SIMD_LANE_OP); }
+      <i> "v128.not"            { OPCODE(V128Not); RETURN(UNARY); }
+      <i> "v128.and"            { OPCODE(V128And); RETURN(BINARY); }
+      <i> "v128.andnot"         { OPCODE(V128Andnot); RETURN(BINARY); }
+      <i> "v128.or"             { OPCODE(V128Or); RETURN(BINARY); }
+      <i> "v128.xor"            { OPCODE(V128Xor); RETURN(BINARY); }
+      <i> "i8x16.add"           { OPCODE(I8X16Add); RETURN(BINARY); }
+      <i> "i8x16.sub"           { OPCODE(I8X16Sub); RETURN(BINARY); }
+      <i> "i16x8.add"           { OPCODE(I16X8Add); RETURN(BINARY); }
+      <i> "i16x8.sub"           { OPCODE(I16X8Sub); RETURN(BINARY); }
+      <i> "i16x8.mul"           { OPCODE(I16X8Mul); RETURN(BINARY); }
+      <i> "i32x4.add"           { OPCODE(I32X4Add); RETURN(BINARY); }
+      <i> "i32x4.sub"           { OPCODE(I32X4Sub); RETURN(BINARY); }
+      <i> "i32x4.mul"           { OPCODE(I32X4Mul); RETURN(BINARY); }
+      <i> "i64x2.add"           { OPCODE(I64X2Add); RETURN(BINARY); }
+      <i> "i64x2.sub"           { OPCODE(I64X2Sub); RETURN(BINARY); }
+      <i> "i64x2.mul"           { OPCODE(I64X2Mul); RETURN(BINARY); }
+      <i> "f32x4.add"           { OPCODE(F32X4Add); RETURN(BINARY); }
+      <i> "f32x4.sub"           { OPCODE(F32X4Sub); RETURN(BINARY); }
+      <i> "f32x4.mul"           { OPCODE(F32X4Mul); RETURN(BINARY); }
+      <i> "f32x4.div"           { OPCODE(F32X4Div); RETURN(BINARY); }
+      <i> "f64x2.add"           { OPCODE(F64X2Add); RETURN(BINARY); }
+      <i> "f64x2.sub"           { OPCODE(F64X2Sub); RETURN(BINARY); }
+      <i> "f64x2.mul"           { OPCODE(F64X2Mul); RETURN(BINARY); }
+      <i> "f64x2.div"           { OPCODE(F64X2Div); RETURN(BINARY); }
+      <i> "shared"              { RETURN(SHARED); }
+      <i> "memory.atomic.notify" {
+                                  OPCODE(MemoryAtomicNotify);
+                                  RETURN(ATOMIC_NOTIFY); }
+      <i> "memory.atomic.wait32" {
+                                  OPCODE(MemoryAtomicWait32);
+                                  RETURN(ATOMIC_WAIT); }
+      <i> "memory.atomic.wait64" {
+                                  OPCODE(MemoryAtomicWait64);
+                                  RETURN(ATOMIC_WAIT); }
+      <i> "i32.atomic.load"     { OPCODE(I32AtomicLoad); RETURN(ATOMIC_LOAD); }
+      <i> "i64.atomic.load"     { OPCODE(I64AtomicLoad); RETURN(ATOMIC_LOAD); }
+      <i> "i32.atomic.load8_u" {
+                                  OPCODE(I32AtomicLoad8U);
+                                  RETURN(ATOMIC_LOAD); }
+      <i> "i32.atomic.load16_u" {
+                                  OPCODE(I32AtomicLoad16U);
+                                  RETURN(ATOMIC_LOAD); }
+      <i> "i64.atomic.load8_u" {
+                                  OPCODE(I64AtomicLoad8U);
+                                  RETURN(ATOMIC_LOAD); }
+      <i> "i64.atomic.load16_u" {
+                                  OPCODE(I64AtomicLoad16U);
+                                  RETURN(ATOMIC_LOAD); }
+      <i> "i64.atomic.load32_u" {
+                                  OPCODE(I64AtomicLoad32U);
+                                  RETURN(ATOMIC_LOAD); }
+      <i> "i32.atomic.store" {
+                                  OPCODE(I32AtomicStore);
+                                  RETURN(ATOMIC_STORE); }
+      <i> "i64.atomic.store" {
+                                  OPCODE(I64AtomicStore);
+                                  RETURN(ATOMIC_STORE); }
+      <i> "i32.atomic.store8" {
+                                  OPCODE(I32AtomicStore8);
+                                  RETURN(ATOMIC_STORE); }
+      <i> "i32.atomic.store16" {
+                                  OPCODE(I32AtomicStore16);
+                                  RETURN(ATOMIC_STORE); }
+      <i> "i64.atomic.store8" {
+                                  OPCODE(I64AtomicStore8);
+                                  RETURN(ATOMIC_STORE); }
+      <i> "i64.atomic.store16" {
+                                  OPCODE(I64AtomicStore16);
+                                  RETURN(ATOMIC_STORE); }
+      <i> "i64.atomic.store32" {
+                                  OPCODE(I64AtomicStore32);
+                                  RETURN(ATOMIC_STORE); }
+      <i> "i32.atomic.rmw.add"  { OPCODE(I32AtomicRmwAdd); RETURN(ATOMIC_RMW); }
+      <i> "i64.atomic.rmw.add"  { OPCODE(I64AtomicRmwAdd); RETURN(ATOMIC_RMW); }
+      <i> "i32.atomic.rmw8_u.add" {
+                                  OPCODE(I32AtomicRmw8UAdd);
+                                  RETURN(ATOMIC_RMW); }
+      <i> "i32.atomic.rmw16_u.add" {
+                                  OPCODE(I32AtomicRmw16UAdd);
+                                  RETURN(ATOMIC_RMW); }
+      <i> "i64.atomic.rmw8_u.add" {
+                                  OPCODE(I64AtomicRmw8UAdd);
+                                  RETURN(ATOMIC_RMW); }
+      <i> "i64.atomic.rmw16_u.add" {
+                                  OPCODE(I64AtomicRmw16UAdd);
+                                  RETURN(ATOMIC_RMW); }
+      <i> "i64.atomic.rmw32_u.add" {
+                                  OPCODE(I64AtomicRmw32UAdd);
+                                  RETURN(ATOMIC_RMW); }
+      <i> "i32.atomic.rmw.sub"  { OPCODE(I32AtomicRmwSub); RETURN(ATOMIC_RMW); }
+      <i> "i64.atomic.rmw.sub"  { OPCODE(I64AtomicRmwSub); RETURN(ATOMIC_RMW); }
+      <i> "i32.atomic.rmw8_u.sub" {
+                                  OPCODE(I32AtomicRmw8USub);
+                                  RETURN(ATOMIC_RMW); }
+      <i> "i32.atomic.rmw16_u.sub" {
+                                  OPCODE(I32AtomicRmw16USub);
+                                  RETURN(ATOMIC_RMW); }
+      <i> "i64.atomic.rmw8_u.sub" {
+                                  OPCODE(I64AtomicRmw8USub);
+                                  RETURN(ATOMIC_RMW); }
+      <i> "i64.atomic.rmw16_u.sub" {
+                                  OPCODE(I64AtomicRmw16USub);
+                                  RETURN(ATOMIC_RMW); }
+      <i> "i64.atomic.rmw32_u.sub" {
+                                  OPCODE(I64AtomicRmw32USub);
+                                  RETURN(ATOMIC_RMW); }
+      <i> "i32.atomic.rmw.and"  { OPCODE(I32AtomicRmwAnd); RETURN(ATOMIC_RMW); }
+      <i> "i64.atomic.rmw.and"  { OPCODE(I64AtomicRmwAnd); RETURN(ATOMIC_RMW); }
+      <i> "i32.atomic.rmw8_u.and" {
+                                  OPCODE(I32AtomicRmw8UAnd);
+                                  RETURN(ATOMIC_RMW); }
+      <i> "i32.atomic.rmw16_u.and" {
+                                  OPCODE(I32AtomicRmw16UAnd);
+                                  RETURN(ATOMIC_RMW); }
+      <i> "i64.atomic.rmw8_u.and" {
+                                  OPCODE(I64AtomicRmw8UAnd);
+                                  RETURN(ATOMIC_RMW); }
+      <i> "i64.atomic.rmw16_u.and" {
+                                  OPCODE(I64AtomicRmw16UAnd);
+                                  RETURN(ATOMIC_RMW); }
+      <i> "i64.atomic.rmw32_u.and" {
+                                  OPCODE(I64AtomicRmw32UAnd);
+                                  RETURN(ATOMIC_RMW); }
+      <i> "i32.atomic.rmw.or"   { OPCODE(I32AtomicRmwOr); RETURN(ATOMIC_RMW); }
+      <i> "i64.atomic.rmw.or"   { OPCODE(I64AtomicRmwOr); RETURN(ATOMIC_RMW); }
+      <i> "i32.atomic.rmw8_u.or" {
+                                  OPCODE(I32AtomicRmw8UOr);
+                                  RETURN(ATOMIC_RMW); }
+      <i> "i32.atomic.rmw16_u.or" {
+                                  OPCODE(I32AtomicRmw16UOr);
+                                  RETURN(ATOMIC_RMW); }
+      <i> "i64.atomic.rmw8_u.or" {
+                                  OPCODE(I64AtomicRmw8UOr);
+                                  RETURN(ATOMIC_RMW); }
+      <i> "i64.atomic.rmw16_u.or" {
+                                  OPCODE(I64AtomicRmw16UOr);
+                                  RETURN(ATOMIC_RMW); }
+      <i> "i64.atomic.rmw32_u.or" {
+                                  OPCODE(I64AtomicRmw32UOr);
+                                  RETURN(ATOMIC_RMW); }
+      <i> "i32.atomic.rmw.xor"  { OPCODE(I32AtomicRmwXor); RETURN(ATOMIC_RMW); }
+      <i> "i64.atomic.rmw.xor"  { OPCODE(I64AtomicRmwXor); RETURN(ATOMIC_RMW); }
+      <i> "i32.atomic.rmw8_u.xor" {
+                                  OPCODE(I32AtomicRmw8UXor);
+                                  RETURN(ATOMIC_RMW); }
+      <i> "i32.atomic.rmw16_u.xor" {
+                                  OPCODE(I32AtomicRmw16UXor);
+                                  RETURN(ATOMIC_RMW); }
+      <i> "i64.atomic.rmw8_u.xor" {
+                                  OPCODE(I64AtomicRmw8UXor);
+                                  RETURN(ATOMIC_RMW); }
+      <i> "i64.atomic.rmw16_u.xor" {
+                                  OPCODE(I64AtomicRmw16UXor);
+                                  RETURN(ATOMIC_RMW); }
+      <i> "i64.atomic.rmw32_u.xor" {
+                                  OPCODE(I64AtomicRmw32UXor);
+                                  RETURN(ATOMIC_RMW); }
+      <i> "i32.atomic.rmw.xchg" {
+                                  OPCODE(I32AtomicRmwXchg);
+                                  RETURN(ATOMIC_RMW); }
+      <i> "i64.atomic.rmw.xchg" {
+                                  OPCODE(I64AtomicRmwXchg);
+                                  RETURN(ATOMIC_RMW); }
+      <i> "i32.atomic.rmw8_u.xchg" {
+                                  OPCODE(I32AtomicRmw8UXchg);
+                                  RETURN(ATOMIC_RMW); }
+      <i> "i32.atomic.rmw16_u.xchg" {
+                                  OPCODE(I32AtomicRmw16UXchg);
+                                  RETURN(ATOMIC_RMW); }
+      <i> "i64.atomic.rmw8_u.xchg" {
+                                  OPCODE(I64AtomicRmw8UXchg);
+                                  RETURN(ATOMIC_RMW); }
+      <i> "i64.atomic.rmw16_u.xchg" {
+                                  OPCODE(I64AtomicRmw16UXchg);
+                                  RETURN(ATOMIC_RMW); }
+      <i> "i64.atomic.rmw32_u.xchg" {
+                                  OPCODE(I64AtomicRmw32UXchg);
+                                  RETURN(ATOMIC_RMW); }
+      <i> "i32.atomic.rmw.cmpxchg" {
+                                  OPCODE(I32AtomicRmwCmpxchg);
+                                  RETURN(ATOMIC_RMW_CMPXCHG); }
+      <i> "i64.atomic.rmw.cmpxchg" {
+                                  OPCODE(I64AtomicRmwCmpxchg);
+                                  RETURN(ATOMIC_RMW_CMPXCHG); }
+      <i> "i32.atomic.rmw8_u.cmpxchg" {
+                                  OPCODE(I32AtomicRmw8UCmpxchg);
+                                  RETURN(ATOMIC_RMW_CMPXCHG); }
+      <i> "i32.atomic.rmw16_u.cmpxchg" {
+                                  OPCODE(I32AtomicRmw16UCmpxchg);
+                                  RETURN(ATOMIC_RMW_CMPXCHG); }
+      <i> "i64.atomic.rmw8_u.cmpxchg" {
+                                  OPCODE(I64AtomicRmw8UCmpxchg);
+                                  RETURN(ATOMIC_RMW_CMPXCHG); }
+      <i> "i64.atomic.rmw16_u.cmpxchg" {
+                                  OPCODE(I64AtomicRmw16UCmpxchg);
+                                  RETURN(ATOMIC_RMW_CMPXCHG); }
+      <i> "i64.atomic.rmw32_u.cmpxchg" {
+                                  OPCODE(I64AtomicRmw32UCmpxchg);
+                                  RETURN(ATOMIC_RMW_CMPXCHG); }
       <i> name                  { SetText(); RETURN(VAR); }
 
       <i> ";;" => LINE_COMMENT  { continue; }
@@ -77,4 +77,10 @@ void destroy_text_list(TextList* text_list) {
   }
 }
 
+void destroy_simd_lane_vector(SimdLaneVector* lanes) {
+  for (SimdLane& lane : *lanes)
+    destroy_string_slice(&lane.literal.text);
+  delete lanes;
+}
+
 }  // namespace wabt
@@ -42,6 +42,24 @@ struct TextList {
   TextListNode* last;
 };
 
+// How the lanes of a v128.const are written.
+enum class SimdShape {
+  I8X16,
+  I16X8,
+  I32X4,
+  I64X2,
+  F32X4,
+  F64X2,
+};
+
+// A lane of a v128.const. The lanes are parsed as plain literals, and only
+// converted once the whole instruction has been reduced.
+struct SimdLane {
+  Literal literal;
+  Location loc;
+};
+typedef std::vector<SimdLane> SimdLaneVector;
+
 union Token {
   /* terminals */
   StringSlice text;
@@ -79,6 +97,8 @@ union Token {
   ModuleFieldList* module_fields;
   ScriptModule* script_module;
   Script* script;
+  SimdLaneVector* simd_lanes;
+  SimdShape simd_shape;
   std::string* string;
   Table* table;
   TextList text_list;
@@ -116,6 +136,7 @@ void wast_format_error(ErrorHandler*,
                        const char* format,
                        va_list);
 void destroy_text_list(TextList*);
+void destroy_simd_lane_vector(SimdLaneVector*);
 void destroy_module_field_list(ModuleFieldList*);
 
 }  // namespace wabt
@@ -26,6 +26,11 @@ class ErrorHandler;
 
 struct WastParseOptions {
   bool allow_future_exceptions = false;
+  bool allow_future_bulk_memory = false;
+  bool allow_future_simd = false;
+  bool allow_future_threads = false;
+  bool allow_future_tail_call = false;
+  bool allow_future_multi_value = false;
   bool debug_parsing = false;
 };
 
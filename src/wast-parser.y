@@ -17,6 +17,7 @@
 %{
 #include <algorithm>
 #include <cassert>
+#include <cinttypes>
 #include <cstdarg>
 #include <cstdio>
 #include <cstdlib>
@@ -102,6 +103,14 @@
     }                                                                 \
  } while (0)
 
+#define CHECK_ALLOW_OPCODE(loc, opcode)                                     \
+  do {                                                                      \
+    if (!IsOpcodeAllowed(*parser->options, opcode)) {                       \
+      wast_parser_error(loc, lexer, parser, "opcode not allowed: %s",       \
+                        Opcode(opcode).GetName());                          \
+    }                                                                       \
+  } while (0)
+
 #define YYMALLOC(size) new char [size]
 #define YYFREE(p) delete [] (p)
 
@@ -118,6 +127,11 @@ static Result parse_const(Type type,
                           const char* s,
                           const char* end,
                           Const* out);
+static size_t get_simd_shape_lane_count(SimdShape shape);
+static Result parse_simd_lane(SimdShape shape,
+                              const Literal& lane,
+                              size_t index,
+                              v128* out);
 static size_t CopyStringContents(StringSlice* text, char* dest);
 static void DupTextList(TextList* text_list, std::vector<uint8_t>* out_data);
 
@@ -130,6 +144,9 @@ static void check_import_ordering(Location* loc,
                                   WastParser* parser,
                                   Module* module,
                                   const ModuleFieldList&);
+static void append_block_func_types(Location* loc,
+                                    Module* module,
+                                    const ExprList& exprs);
 static void append_module_fields(Module*, ModuleFieldList*);
 
 class BinaryErrorHandlerModule : public ErrorHandler {
@@ -168,13 +185,17 @@ class BinaryErrorHandlerModule : public ErrorHandler {
 %token NOP DROP BLOCK END IF THEN ELSE LOOP BR BR_IF BR_TABLE
 %token TRY CATCH CATCH_ALL THROW RETHROW
 %token LPAR_CATCH LPAR_CATCH_ALL
-%token CALL CALL_INDIRECT RETURN
+%token CALL CALL_INDIRECT RETURN RETURN_CALL RETURN_CALL_INDIRECT
 %token GET_LOCAL SET_LOCAL TEE_LOCAL GET_GLOBAL SET_GLOBAL
 %token LOAD STORE OFFSET_EQ_NAT ALIGN_EQ_NAT
+%token ATOMIC_LOAD ATOMIC_STORE ATOMIC_RMW ATOMIC_RMW_CMPXCHG
+%token ATOMIC_WAIT ATOMIC_NOTIFY
 %token CONST UNARY BINARY COMPARE CONVERT SELECT
-%token UNREACHABLE CURRENT_MEMORY GROW_MEMORY
+%token UNREACHABLE CURRENT_MEMORY GROW_MEMORY MEMORY_COPY MEMORY_FILL
+%token V128_CONST SIMD_LANE_OP
+%token I8X16 I16X8 I32X4 I64X2 F32X4 F64X2
 %token FUNC START TYPE PARAM RESULT LOCAL GLOBAL
-%token TABLE ELEM MEMORY DATA OFFSET IMPORT EXPORT EXCEPT
+%token TABLE ELEM MEMORY DATA OFFSET IMPORT EXPORT EXCEPT SHARED
 %token MODULE BIN QUOTE
 %token REGISTER INVOKE GET
 %token ASSERT_MALFORMED ASSERT_INVALID ASSERT_UNLINKABLE
@@ -182,10 +203,12 @@ class BinaryErrorHandlerModule : public ErrorHandler {
 %token ASSERT_TRAP ASSERT_EXHAUSTION
 %token EOF 0 "EOF"
 
-%type<opcode> BINARY COMPARE CONVERT LOAD STORE UNARY
+%type<opcode> BINARY COMPARE CONVERT LOAD STORE UNARY SIMD_LANE_OP
+%type<opcode> ATOMIC_LOAD ATOMIC_STORE ATOMIC_RMW ATOMIC_RMW_CMPXCHG
+%type<opcode> ATOMIC_WAIT ATOMIC_NOTIFY
 %type<text> ALIGN_EQ_NAT OFFSET_EQ_NAT TEXT VAR
 %type<type> SELECT
-%type<type> CONST VALUE_TYPE
+%type<type> CONST VALUE_TYPE value_type
 %type<literal> NAT INT FLOAT
 
 %type<action> action
@@ -205,6 +228,7 @@ class BinaryErrorHandlerModule : public ErrorHandler {
 %type<global> global_type
 %type<import> import_desc inline_import
 %type<limits> limits
+%type<simd_lanes> simd_lane_list
 %type<memory> memory_sig
 %type<module> module module_fields_opt module_fields inline_module
 %type<module_field> type_def start data elem import export exception_field
@@ -212,6 +236,7 @@ class BinaryErrorHandlerModule : public ErrorHandler {
 %type<script_module> script_module
 %type<literal> literal
 %type<script> script
+%type<simd_shape> simd_shape
 %type<string> bind_var bind_var_opt labeling_opt
 %type<table> table_sig
 %type<text> quoted_text
@@ -247,6 +272,7 @@ class BinaryErrorHandlerModule : public ErrorHandler {
 %destructor { delete $$; } <script>
 %destructor { delete $$; } <string>
 %destructor { destroy_text_list(&$$); } <text_list>
+%destructor { destroy_simd_lane_vector($$); } <simd_lanes>
 %destructor { delete $$; } <types>
 %destructor { delete $$; } <var>
 %destructor { delete $$; } <vars>
@@ -293,9 +319,18 @@ quoted_text :
 
 /* Types */
 
+value_type :
+    VALUE_TYPE {
+      if ($1 == Type::V128 && !parser->options->allow_future_simd) {
+        wast_parser_error(&@1, lexer, parser, "value type not allowed: %s",
+                          get_type_name($1));
+      }
+      $$ = $1;
+    }
+;
 value_type_list :
     /* empty */ { $$ = new TypeVector(); }
-  | value_type_list VALUE_TYPE {
+  | value_type_list value_type {
       $$ = $1;
       $$->push_back($2);
     }
@@ -304,12 +339,12 @@ elem_type :
     ANYFUNC {}
 ;
 global_type :
-    VALUE_TYPE {
+    value_type {
       $$ = new Global();
       $$->type = $1;
       $$->mutable_ = false;
     }
-  | LPAR MUT VALUE_TYPE RPAR {
+  | LPAR MUT value_type RPAR {
       $$ = new Global();
       $$->type = $3;
       $$->mutable_ = true;
@@ -327,7 +362,7 @@ func_sig :
       $$->param_types.insert($$->param_types.begin(), $3->begin(), $3->end());
       delete $3;
     }
-  | LPAR PARAM bind_var VALUE_TYPE RPAR func_sig {
+  | LPAR PARAM bind_var value_type RPAR func_sig {
       $$ = $6;
       $$->param_types.insert($$->param_types.begin(), $4);
       // Ignore bind_var.
@@ -359,11 +394,21 @@ memory_sig :
 limits :
     nat {
       $$.has_max = false;
+      $$.is_shared = false;
       $$.initial = $1;
       $$.max = 0;
     }
   | nat nat {
       $$.has_max = true;
+      $$.is_shared = false;
+      $$.initial = $1;
+      $$.max = $2;
+    }
+  | nat nat SHARED {
+      if (!parser->options->allow_future_threads)
+        wast_parser_error(&@3, lexer, parser, "shared memory not allowed");
+      $$.has_max = true;
+      $$.is_shared = true;
       $$.initial = $1;
       $$.max = $2;
     }
@@ -400,6 +445,22 @@ literal :
     }
 ;
 
+simd_shape :
+    I8X16 { $$ = SimdShape::I8X16; }
+  | I16X8 { $$ = SimdShape::I16X8; }
+  | I32X4 { $$ = SimdShape::I32X4; }
+  | I64X2 { $$ = SimdShape::I64X2; }
+  | F32X4 { $$ = SimdShape::F32X4; }
+  | F64X2 { $$ = SimdShape::F64X2; }
+;
+simd_lane_list :
+    /* empty */ { $$ = new SimdLaneVector(); }
+  | simd_lane_list literal {
+      $$ = $1;
+      $$->push_back(SimdLane{$2, @2});
+    }
+;
+
 var :
     nat {
       $$ = new Var($1, @1);
@@ -510,6 +571,16 @@ plain_instr :
       $$ = new CallIndirectExpr(std::move(*$2));
       delete $2;
     }
+  | RETURN_CALL var {
+      CHECK_ALLOW_OPCODE(&@1, Opcode::ReturnCall);
+      $$ = new ReturnCallExpr(std::move(*$2));
+      delete $2;
+    }
+  | RETURN_CALL_INDIRECT var {
+      CHECK_ALLOW_OPCODE(&@1, Opcode::ReturnCallIndirect);
+      $$ = new ReturnCallIndirectExpr(std::move(*$2));
+      delete $2;
+    }
   | GET_LOCAL var {
       $$ = new GetLocalExpr(std::move(*$2));
       delete $2;
@@ -531,11 +602,37 @@ plain_instr :
       delete $2;
     }
   | LOAD offset_opt align_opt {
+      CHECK_ALLOW_OPCODE(&@1, $1);
       $$ = new LoadExpr($1, $3, $2);
     }
   | STORE offset_opt align_opt {
+      CHECK_ALLOW_OPCODE(&@1, $1);
       $$ = new StoreExpr($1, $3, $2);
     }
+  | ATOMIC_LOAD offset_opt align_opt {
+      CHECK_ALLOW_OPCODE(&@1, $1);
+      $$ = new AtomicLoadExpr($1, $3, $2);
+    }
+  | ATOMIC_STORE offset_opt align_opt {
+      CHECK_ALLOW_OPCODE(&@1, $1);
+      $$ = new AtomicStoreExpr($1, $3, $2);
+    }
+  | ATOMIC_RMW offset_opt align_opt {
+      CHECK_ALLOW_OPCODE(&@1, $1);
+      $$ = new AtomicRmwExpr($1, $3, $2);
+    }
+  | ATOMIC_RMW_CMPXCHG offset_opt align_opt {
+      CHECK_ALLOW_OPCODE(&@1, $1);
+      $$ = new AtomicRmwCmpxchgExpr($1, $3, $2);
+    }
+  | ATOMIC_WAIT offset_opt align_opt {
+      CHECK_ALLOW_OPCODE(&@1, $1);
+      $$ = new AtomicWaitExpr($1, $3, $2);
+    }
+  | ATOMIC_NOTIFY offset_opt align_opt {
+      CHECK_ALLOW_OPCODE(&@1, $1);
+      $$ = new AtomicNotifyExpr($1, $3, $2);
+    }
   | CONST literal {
       Const const_;
       const_.loc = @1;
@@ -548,16 +645,50 @@ plain_instr :
       delete [] $2.text.start;
       $$ = new ConstExpr(const_);
     }
+  | V128_CONST simd_shape simd_lane_list {
+      CHECK_ALLOW_OPCODE(&@1, Opcode::V128Const);
+      Const const_(Const::V128(), v128(), @1);
+      size_t num_lanes = get_simd_shape_lane_count($2);
+      if ($3->size() != num_lanes) {
+        wast_parser_error(&@2, lexer, parser,
+                          "expected %" PRIzd " lanes, got %" PRIzd,
+                          num_lanes, $3->size());
+      } else {
+        for (size_t i = 0; i < num_lanes; ++i) {
+          SimdLane& lane = (*$3)[i];
+          if (Failed(parse_simd_lane($2, lane.literal, i,
+                                     &const_.v128_bits))) {
+            wast_parser_error(&lane.loc, lexer, parser,
+                              "invalid literal \"" PRIstringslice "\"",
+                              WABT_PRINTF_STRING_SLICE_ARG(lane.literal.text));
+          }
+        }
+      }
+      destroy_simd_lane_vector($3);
+      $$ = new ConstExpr(const_);
+    }
+  | SIMD_LANE_OP nat {
+      CHECK_ALLOW_OPCODE(&@1, $1);
+      if ($2 > UINT8_MAX) {
+        wast_parser_error(&@2, lexer, parser,
+                          "invalid lane index %" PRIu64, $2);
+      }
+      $$ = new SimdLaneOpExpr($1, $2);
+    }
   | UNARY {
+      CHECK_ALLOW_OPCODE(&@1, $1);
       $$ = new UnaryExpr($1);
     }
   | BINARY {
+      CHECK_ALLOW_OPCODE(&@1, $1);
       $$ = new BinaryExpr($1);
     }
   | COMPARE {
+      CHECK_ALLOW_OPCODE(&@1, $1);
       $$ = new CompareExpr($1);
     }
   | CONVERT {
+      CHECK_ALLOW_OPCODE(&@1, $1);
       $$ = new ConvertExpr($1);
     }
   | CURRENT_MEMORY {
@@ -566,6 +697,14 @@ plain_instr :
   | GROW_MEMORY {
       $$ = new GrowMemoryExpr();
     }
+  | MEMORY_COPY {
+      CHECK_ALLOW_OPCODE(&@1, Opcode::MemoryCopy);
+      $$ = new MemoryCopyExpr();
+    }
+  | MEMORY_FILL {
+      CHECK_ALLOW_OPCODE(&@1, Opcode::MemoryFill);
+      $$ = new MemoryFillExpr();
+    }
   | throw_check var {
       $$ = new ThrowExpr(std::move(*$2));
       delete $2;
@@ -913,7 +1052,7 @@ func_fields_import1 :
                                       $3->begin(), $3->end());
       delete $3;
     }
-  | LPAR PARAM bind_var VALUE_TYPE RPAR func_fields_import1 {
+  | LPAR PARAM bind_var value_type RPAR func_fields_import1 {
       $$ = $6;
       $$->param_bindings.emplace(*$3,
                                  Binding(@3, $$->decl.sig.param_types.size()));
@@ -947,7 +1086,7 @@ func_fields_body1 :
                                       $3->begin(), $3->end());
       delete $3;
     }
-  | LPAR PARAM bind_var VALUE_TYPE RPAR func_fields_body1 {
+  | LPAR PARAM bind_var value_type RPAR func_fields_body1 {
       $$ = $6;
       $$->param_bindings.emplace(*$3,
                                  Binding(@3, $$->decl.sig.param_types.size()));
@@ -984,7 +1123,7 @@ func_body1 :
       $$->local_types.insert($$->local_types.begin(), $3->begin(), $3->end());
       delete $3;
     }
-  | LPAR LOCAL bind_var VALUE_TYPE RPAR func_body1 {
+  | LPAR LOCAL bind_var value_type RPAR func_body1 {
       $$ = $6;
       $$->local_bindings.emplace(*$3, Binding(@3, $$->local_types.size()));
       delete $3;
@@ -1374,6 +1513,16 @@ module :
         assert($1->type == ScriptModule::Type::Binary);
         $$ = new Module();
         ReadBinaryOptions options;
+        const WastParseOptions* parse_options = parser->options;
+        options.allow_future_exceptions =
+            parse_options->allow_future_exceptions;
+        options.allow_future_bulk_memory =
+            parse_options->allow_future_bulk_memory;
+        options.allow_future_simd = parse_options->allow_future_simd;
+        options.allow_future_threads = parse_options->allow_future_threads;
+        options.allow_future_tail_call = parse_options->allow_future_tail_call;
+        options.allow_future_multi_value =
+            parse_options->allow_future_multi_value;
         BinaryErrorHandlerModule error_handler(&$1->binary.loc, lexer, parser);
         const char* filename = "<text>";
         read_binary_ir(filename, $1->binary.data.data(), $1->binary.data.size(),
@@ -1648,6 +1797,71 @@ Result parse_const(Type type,
   return Result::Error;
 }
 
+size_t get_simd_shape_lane_count(SimdShape shape) {
+  switch (shape) {
+    case SimdShape::I8X16: return 16;
+    case SimdShape::I16X8: return 8;
+    case SimdShape::I32X4: return 4;
+    case SimdShape::I64X2: return 2;
+    case SimdShape::F32X4: return 4;
+    case SimdShape::F64X2: return 2;
+  }
+  WABT_UNREACHABLE;
+}
+
+// Parses lane |index| of a v128.const written with |shape| into |out|. The
+// lanes are stored little-endian, so lane 0 is in the low bits of out->v[0].
+Result parse_simd_lane(SimdShape shape,
+                       const Literal& lane,
+                       size_t index,
+                       v128* out) {
+  const char* s = lane.text.start;
+  const char* end = lane.text.start + lane.text.length;
+  switch (shape) {
+    case SimdShape::I8X16:
+    case SimdShape::I16X8: {
+      uint32_t value;
+      if (Failed(parse_int32(s, end, &value,
+                             ParseIntType::SignedAndUnsigned))) {
+        return Result::Error;
+      }
+      int lane_bits = shape == SimdShape::I8X16 ? 8 : 16;
+      // Accept both the signed and the unsigned range of the lane.
+      int32_t signed_value = static_cast<int32_t>(value);
+      if (signed_value < -(1 << (lane_bits - 1)) ||
+          signed_value >= (1 << lane_bits)) {
+        return Result::Error;
+      }
+      size_t bit = index * lane_bits;
+      uint32_t mask = (1u << lane_bits) - 1;
+      out->v[bit / 32] |= (value & mask) << (bit % 32);
+      return Result::Ok;
+    }
+
+    case SimdShape::I32X4:
+      return parse_int32(s, end, &out->v[index],
+                         ParseIntType::SignedAndUnsigned);
+
+    case SimdShape::F32X4:
+      return parse_float(lane.type, s, end, &out->v[index]);
+
+    case SimdShape::I64X2:
+    case SimdShape::F64X2: {
+      uint64_t value;
+      Result result =
+          shape == SimdShape::I64X2
+              ? parse_int64(s, end, &value, ParseIntType::SignedAndUnsigned)
+              : parse_double(lane.type, s, end, &value);
+      if (Failed(result))
+        return Result::Error;
+      out->v[index * 2] = static_cast<uint32_t>(value);
+      out->v[index * 2 + 1] = static_cast<uint32_t>(value >> 32);
+      return Result::Ok;
+    }
+  }
+  WABT_UNREACHABLE;
+}
+
 size_t CopyStringContents(StringSlice* text, char* dest) {
   const char* src = text->start + 1;
   const char* end = text->start + text->length - 1;
@@ -1748,6 +1962,62 @@ void append_implicit_func_declaration(Location* loc,
   }
 }
 
+// Block signatures with more than one result are encoded as a type index, so
+// make sure a matching func type exists.
+void append_block_sig_func_type(Location* loc,
+                                Module* module,
+                                const BlockSignature& sig) {
+  if (sig.size() <= 1)
+    return;
+
+  FuncSignature func_sig;
+  func_sig.result_types = sig;
+  if (module->GetFuncTypeIndex(func_sig) == kInvalidIndex)
+    module->AppendImplicitFuncType(*loc, func_sig);
+}
+
+void append_block_func_types(Location* loc,
+                             Module* module,
+                             const ExprList& exprs) {
+  for (const Expr& expr : exprs) {
+    switch (expr.type) {
+      case ExprType::Block: {
+        const Block* block = cast<BlockExpr>(&expr)->block;
+        append_block_sig_func_type(loc, module, block->sig);
+        append_block_func_types(loc, module, block->exprs);
+        break;
+      }
+
+      case ExprType::Loop: {
+        const Block* block = cast<LoopExpr>(&expr)->block;
+        append_block_sig_func_type(loc, module, block->sig);
+        append_block_func_types(loc, module, block->exprs);
+        break;
+      }
+
+      case ExprType::If: {
+        const IfExpr* if_expr = cast<IfExpr>(&expr);
+        append_block_sig_func_type(loc, module, if_expr->true_->sig);
+        append_block_func_types(loc, module, if_expr->true_->exprs);
+        append_block_func_types(loc, module, if_expr->false_);
+        break;
+      }
+
+      case ExprType::TryBlock: {
+        const TryExpr* try_expr = cast<TryExpr>(&expr);
+        append_block_sig_func_type(loc, module, try_expr->block->sig);
+        append_block_func_types(loc, module, try_expr->block->exprs);
+        for (const Catch* catch_ : try_expr->catches)
+          append_block_func_types(loc, module, catch_->exprs);
+        break;
+      }
+
+      default:
+        break;
+    }
+  }
+}
+
 void check_import_ordering(Location* loc, WastLexer* lexer, WastParser* parser,
                            Module* module, const ModuleFieldList& fields) {
   for (const ModuleField& field: fields) {
@@ -1778,6 +2048,7 @@ void append_module_fields(Module* module, ModuleFieldList* fields) {
       case ModuleFieldType::Func: {
         Func* func = cast<FuncModuleField>(&field)->func;
         append_implicit_func_declaration(&field.loc, module, &func->decl);
+        append_block_func_types(&field.loc, module, func->exprs);
         name = &func->name;
         bindings = &module->func_bindings;
         index = module->funcs.size();
@@ -132,6 +132,8 @@ class WatWriter {
                   const Block* block,
                   const char* start_text);
   void WriteConst(const Const* const_);
+  template <typename T>
+  void WriteLoadStoreExpr(const Expr* expr);
   void WriteExpr(const Expr* expr);
   void WriteExprList(const ExprList& exprs);
   void WriteInitExpr(const ExprList& expr);
@@ -455,15 +457,59 @@ void WatWriter::WriteConst(const Const* const_) {
       break;
     }
 
+    case Type::V128:
+      WritePutsSpace(Opcode::V128Const_Opcode.GetName());
+      WritePutsSpace("i32x4");
+      Writef("0x%08x 0x%08x 0x%08x 0x%08x", const_->v128_bits.v[0],
+             const_->v128_bits.v[1], const_->v128_bits.v[2],
+             const_->v128_bits.v[3]);
+      WriteNewline(NO_FORCE_NEWLINE);
+      break;
+
     default:
       assert(0);
       break;
   }
 }
 
+template <typename T>
+void WatWriter::WriteLoadStoreExpr(const Expr* expr) {
+  auto typed_expr = cast<T>(expr);
+  WritePutsSpace(typed_expr->opcode.GetName());
+  if (typed_expr->offset)
+    Writef("offset=%u", typed_expr->offset);
+  if (!typed_expr->opcode.IsNaturallyAligned(typed_expr->align))
+    Writef("align=%u", typed_expr->align);
+  WriteNewline(NO_FORCE_NEWLINE);
+}
+
 void WatWriter::WriteExpr(const Expr* expr) {
   WABT_TRACE_ARGS(WriteExpr, "%s", GetExprTypeName(*expr));
   switch (expr->type) {
+    case ExprType::AtomicLoad:
+      WriteLoadStoreExpr<AtomicLoadExpr>(expr);
+      break;
+
+    case ExprType::AtomicNotify:
+      WriteLoadStoreExpr<AtomicNotifyExpr>(expr);
+      break;
+
+    case ExprType::AtomicRmw:
+      WriteLoadStoreExpr<AtomicRmwExpr>(expr);
+      break;
+
+    case ExprType::AtomicRmwCmpxchg:
+      WriteLoadStoreExpr<AtomicRmwCmpxchgExpr>(expr);
+      break;
+
+    case ExprType::AtomicStore:
+      WriteLoadStoreExpr<AtomicStoreExpr>(expr);
+      break;
+
+    case ExprType::AtomicWait:
+      WriteLoadStoreExpr<AtomicWaitExpr>(expr);
+      break;
+
     case ExprType::Binary:
       WritePutsNewline(cast<BinaryExpr>(expr)->opcode.GetName());
       break;
@@ -547,16 +593,9 @@ void WatWriter::WriteExpr(const Expr* expr) {
       break;
     }
 
-    case ExprType::Load: {
-      auto load_expr = cast<LoadExpr>(expr);
-      WritePutsSpace(load_expr->opcode.GetName());
-      if (load_expr->offset)
-        Writef("offset=%u", load_expr->offset);
-      if (!load_expr->opcode.IsNaturallyAligned(load_expr->align))
-        Writef("align=%u", load_expr->align);
-      WriteNewline(NO_FORCE_NEWLINE);
+    case ExprType::Load:
+      WriteLoadStoreExpr<LoadExpr>(expr);
       break;
-    }
 
     case ExprType::Loop:
       WriteBlock(LabelType::Loop, cast<LoopExpr>(expr)->block,
@@ -567,6 +606,14 @@ void WatWriter::WriteExpr(const Expr* expr) {
       WritePutsNewline(Opcode::CurrentMemory_Opcode.GetName());
       break;
 
+    case ExprType::MemoryCopy:
+      WritePutsNewline(Opcode::MemoryCopy_Opcode.GetName());
+      break;
+
+    case ExprType::MemoryFill:
+      WritePutsNewline(Opcode::MemoryFill_Opcode.GetName());
+      break;
+
     case ExprType::Nop:
       WritePutsNewline(Opcode::Nop_Opcode.GetName());
       break;
@@ -580,6 +627,16 @@ void WatWriter::WriteExpr(const Expr* expr) {
       WritePutsNewline(Opcode::Return_Opcode.GetName());
       break;
 
+    case ExprType::ReturnCall:
+      WritePutsSpace(Opcode::ReturnCall_Opcode.GetName());
+      WriteVar(&cast<ReturnCallExpr>(expr)->var, NextChar::Newline);
+      break;
+
+    case ExprType::ReturnCallIndirect:
+      WritePutsSpace(Opcode::ReturnCallIndirect_Opcode.GetName());
+      WriteVar(&cast<ReturnCallIndirectExpr>(expr)->var, NextChar::Newline);
+      break;
+
     case ExprType::Select:
       WritePutsNewline(Opcode::Select_Opcode.GetName());
       break;
@@ -594,17 +651,18 @@ void WatWriter::WriteExpr(const Expr* expr) {
       WriteVar(&cast<SetLocalExpr>(expr)->var, NextChar::Newline);
       break;
 
-    case ExprType::Store: {
-      auto store_expr = cast<StoreExpr>(expr);
-      WritePutsSpace(store_expr->opcode.GetName());
-      if (store_expr->offset)
-        Writef("offset=%u", store_expr->offset);
-      if (!store_expr->opcode.IsNaturallyAligned(store_expr->align))
-        Writef("align=%u", store_expr->align);
+    case ExprType::SimdLaneOp: {
+      auto lane_expr = cast<SimdLaneOpExpr>(expr);
+      WritePutsSpace(lane_expr->opcode.GetName());
+      Writef("%u", lane_expr->lane);
       WriteNewline(NO_FORCE_NEWLINE);
       break;
     }
 
+    case ExprType::Store:
+      WriteLoadStoreExpr<StoreExpr>(expr);
+      break;
+
     case ExprType::TeeLocal:
       WritePutsSpace(Opcode::TeeLocal_Opcode.GetName());
       WriteVar(&cast<TeeLocalExpr>(expr)->var, NextChar::Newline);
@@ -700,12 +758,23 @@ Index WatWriter::GetFuncSigResultCount(const Var* var) {
 void WatWriter::WriteFoldedExpr(const Expr* expr) {
   WABT_TRACE_ARGS(WriteFoldedExpr, "%s", GetExprTypeName(*expr));
   switch (expr->type) {
+    case ExprType::AtomicNotify:
+    case ExprType::AtomicRmw:
     case ExprType::Binary:
     case ExprType::Compare:
     case ExprType::Store:
       PushExpr(expr, 2, 1);
       break;
 
+    case ExprType::AtomicRmwCmpxchg:
+    case ExprType::AtomicWait:
+      PushExpr(expr, 3, 1);
+      break;
+
+    case ExprType::AtomicStore:
+      PushExpr(expr, 2, 0);
+      break;
+
     case ExprType::Block:
       PushExpr(expr, 0, cast<BlockExpr>(expr)->block->sig.size());
       break;
@@ -749,6 +818,7 @@ void WatWriter::WriteFoldedExpr(const Expr* expr) {
     case ExprType::Convert:
     case ExprType::GrowMemory:
     case ExprType::Load:
+    case ExprType::AtomicLoad:
     case ExprType::TeeLocal:
     case ExprType::Unary:
       PushExpr(expr, 1, 1);
@@ -760,6 +830,13 @@ void WatWriter::WriteFoldedExpr(const Expr* expr) {
       PushExpr(expr, 1, 0);
       break;
 
+    case ExprType::SimdLaneOp: {
+      // extract_lane takes one operand, replace_lane takes two.
+      Opcode opcode = cast<SimdLaneOpExpr>(expr)->opcode;
+      PushExpr(expr, opcode.GetParamType2() == Type::Void ? 1 : 2, 1);
+      break;
+    }
+
     case ExprType::If:
       PushExpr(expr, 1, cast<IfExpr>(expr)->true_->sig.size());
       break;
@@ -776,10 +853,26 @@ void WatWriter::WriteFoldedExpr(const Expr* expr) {
       PushExpr(expr, current_func_->decl.sig.result_types.size(), 1);
       break;
 
+    case ExprType::ReturnCall:
+      PushExpr(expr, GetFuncParamCount(&cast<ReturnCallExpr>(expr)->var), 1);
+      break;
+
+    case ExprType::ReturnCallIndirect:
+      PushExpr(expr,
+               GetFuncSigParamCount(&cast<ReturnCallIndirectExpr>(expr)->var) +
+                   1,
+               1);
+      break;
+
     case ExprType::Rethrow:
       PushExpr(expr, 0, 0);
       break;
 
+    case ExprType::MemoryCopy:
+    case ExprType::MemoryFill:
+      PushExpr(expr, 3, 0);
+      break;
+
     case ExprType::Select:
       PushExpr(expr, 3, 1);
       break;
@@ -1030,6 +1123,8 @@ void WatWriter::WriteLimits(const Limits* limits) {
   Writef("%" PRIu64, limits->initial);
   if (limits->has_max)
     Writef("%" PRIu64, limits->max);
+  if (limits->is_shared)
+    Writef("shared");
 }
 
 void WatWriter::WriteTable(const Table* table) {
@@ -25,7 +25,7 @@ SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
 REPO_ROOT_DIR = os.path.dirname(SCRIPT_DIR)
 EXECUTABLES = [
     'wast2wasm', 'wasm2wast', 'wasm-objdump', 'wasm-interp', 'wasm-opcodecnt',
-    'wast-desugar', 'wasm-link'
+    'wast-desugar', 'wasm-link', 'wasm-memheat', 'wasm-validate'
 ]
 
 
@@ -88,5 +88,13 @@ def GetWasmOpcodeCntExecutable(override=None):
   return FindExecutable('wasm-opcodecnt', override)
 
 
+def GetWasmMemHeatExecutable(override=None):
+  return FindExecutable('wasm-memheat', override)
+
+
+def GetWasmValidateExecutable(override=None):
+  return FindExecutable('wasm-validate', override)
+
+
 def GetWastDesugarExecutable(override=None):
   return FindExecutable('wast-desugar', override)
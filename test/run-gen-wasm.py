@@ -46,6 +46,7 @@ def main(args):
   parser.add_argument('-p', '--print-cmd', action='store_true',
                       help='print the commands that are run.')
   parser.add_argument('--no-debug-names', action='store_true')
+  parser.add_argument('--future-multi-value', action='store_true')
   parser.add_argument('--objdump', action='store_true',
                       help="objdump the resulting binary")
   parser.add_argument('file', help='test file.')
@@ -64,6 +65,7 @@ def main(args):
       error_cmdline=options.error_cmdline)
   wasm2wast.AppendOptionalArgs({
       '--no-debug-names': options.no_debug_names,
+      '--future-multi-value': options.future_multi_value,
   })
   wasm2wast.AppendOptionalArgs({'--verbose': options.verbose,})
 
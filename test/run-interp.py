@@ -46,6 +46,24 @@ def main(args):
   parser.add_argument('--run-all-exports', action='store_true')
   parser.add_argument('--spec', action='store_true')
   parser.add_argument('-t', '--trace', action='store_true')
+  parser.add_argument('--count', action='store_true')
+  parser.add_argument('--max-memory-pages', metavar='N')
+  parser.add_argument('--max-instructions', metavar='N')
+  parser.add_argument('--max-host-calls', metavar='N')
+  parser.add_argument('--resource-usage', action='store_true')
+  parser.add_argument('--binary-trace',
+                      help='write a binary trace, then decode it.',
+                      action='store_true')
+  parser.add_argument('--memory-heatmap',
+                      help='log memory accesses, then run wasm-memheat.',
+                      action='store_true')
+  parser.add_argument('--memory-access-sample', metavar='N')
+  parser.add_argument('--debug-names', action='store_true')
+  parser.add_argument('--future-bulk-memory', action='store_true')
+  parser.add_argument('--future-simd', action='store_true')
+  parser.add_argument('--future-threads', action='store_true')
+  parser.add_argument('--future-tail-call', action='store_true')
+  parser.add_argument('--future-multi-value', action='store_true')
   parser.add_argument('file', help='test file.')
   options = parser.parse_args(args)
 
@@ -55,6 +73,12 @@ def main(args):
   wast2wasm.AppendOptionalArgs({
       '-v': options.verbose,
       '--spec': options.spec,
+      '--debug-names': options.debug_names,
+      '--future-bulk-memory': options.future_bulk_memory,
+      '--future-simd': options.future_simd,
+      '--future-threads': options.future_threads,
+      '--future-tail-call': options.future_tail_call,
+      '--future-multi-value': options.future_multi_value,
   })
 
   wasm_interp = utils.Executable(
@@ -65,16 +89,44 @@ def main(args):
       '--run-all-exports': options.run_all_exports,
       '--spec': options.spec,
       '--trace': options.trace,
+      '--count': options.count,
+      '--max-memory-pages': options.max_memory_pages,
+      '--max-instructions': options.max_instructions,
+      '--max-host-calls': options.max_host_calls,
+      '--resource-usage': options.resource_usage,
+      '--future-bulk-memory': options.future_bulk_memory,
+      '--future-simd': options.future_simd,
+      '--future-threads': options.future_threads,
+      '--future-tail-call': options.future_tail_call,
+      '--future-multi-value': options.future_multi_value,
   })
 
+  wasm_memheat = utils.Executable(
+      find_exe.GetWasmMemHeatExecutable(options.bindir),
+      error_cmdline=options.error_cmdline)
+
   wast2wasm.verbose = options.print_cmd
   wasm_interp.verbose = options.print_cmd
+  wasm_memheat.verbose = options.print_cmd
 
   with utils.TempDirectory(options.out_dir, 'run-interp-') as out_dir:
     new_ext = '.json' if options.spec else '.wasm'
     out_file = utils.ChangeDir(utils.ChangeExt(options.file, new_ext), out_dir)
     wast2wasm.RunWithArgs(options.file, '-o', out_file)
-    wasm_interp.RunWithArgs(out_file)
+    if options.memory_heatmap:
+      log_file = utils.ChangeExt(out_file, '.memlog')
+      sample_args = []
+      if options.memory_access_sample:
+        sample_args = ['--memory-access-sample', options.memory_access_sample]
+      wasm_interp.RunWithArgs(out_file, '--memory-access-log', log_file,
+                              *sample_args)
+      wasm_memheat.RunWithArgs(out_file, log_file)
+    elif options.binary_trace:
+      trace_file = utils.ChangeExt(out_file, '.trace')
+      wasm_interp.RunWithArgs(out_file, '--trace-file', trace_file)
+      wasm_interp.RunWithArgs(out_file, '--decode-trace', trace_file)
+    else:
+      wasm_interp.RunWithArgs(out_file)
 
   return 0
 
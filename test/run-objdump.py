@@ -48,12 +48,19 @@ def main(args):
   parser.add_argument('--dump-verbose', action='store_true')
   parser.add_argument('--dump-debug', action='store_true')
   parser.add_argument('--future-exceptions', action='store_true')
+  parser.add_argument('--future-bulk-memory', action='store_true')
+  parser.add_argument('--future-simd', action='store_true')
+  parser.add_argument('--future-threads', action='store_true')
+  parser.add_argument('--future-tail-call', action='store_true')
+  parser.add_argument('--future-multi-value', action='store_true')
   parser.add_argument('--gen-wasm', action='store_true',
                       help='parse with gen-wasm')
   parser.add_argument('--spec', action='store_true')
   parser.add_argument('-r', '--relocatable', action='store_true')
   parser.add_argument('--no-canonicalize-leb128s', action='store_true')
   parser.add_argument('--debug-names', action='store_true')
+  parser.add_argument('--jobs', metavar='N')
+  parser.add_argument('--chunk-size', metavar='BYTES')
   parser.add_argument('file', help='test file.')
   options = parser.parse_args(args)
 
@@ -69,6 +76,11 @@ def main(args):
   wast2wasm.AppendOptionalArgs({
       '--debug-names': options.debug_names,
       '--future-exceptions': options.future_exceptions,
+      '--future-bulk-memory': options.future_bulk_memory,
+      '--future-simd': options.future_simd,
+      '--future-threads': options.future_threads,
+      '--future-tail-call': options.future_tail_call,
+      '--future-multi-value': options.future_multi_value,
       '--no-check': options.no_check,
       '--no-canonicalize-leb128s': options.no_canonicalize_leb128s,
       '--spec': options.spec,
@@ -82,9 +94,16 @@ def main(args):
       error_cmdline=options.error_cmdline)
   wasm_objdump.AppendOptionalArgs({
       '--future-exceptions': options.future_exceptions,
+      '--future-bulk-memory': options.future_bulk_memory,
+      '--future-simd': options.future_simd,
+      '--future-threads': options.future_threads,
+      '--future-tail-call': options.future_tail_call,
+      '--future-multi-value': options.future_multi_value,
       '-h': options.headers,
       '-x': options.dump_verbose,
       '--debug': options.dump_debug,
+      '--jobs': options.jobs,
+      '--chunk-size': options.chunk_size,
   })
 
   gen_wasm.verbose = options.print_cmd
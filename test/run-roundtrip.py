@@ -117,6 +117,11 @@ def main(args):
   parser.add_argument('--generate-names', action='store_true')
   parser.add_argument('--fold-exprs', action='store_true')
   parser.add_argument('--future-exceptions', action='store_true')
+  parser.add_argument('--future-bulk-memory', action='store_true')
+  parser.add_argument('--future-simd', action='store_true')
+  parser.add_argument('--future-threads', action='store_true')
+  parser.add_argument('--future-tail-call', action='store_true')
+  parser.add_argument('--future-multi-value', action='store_true')
   parser.add_argument('--inline-exports', action='store_true')
   parser.add_argument('file', help='test file.')
   options = parser.parse_args(args)
@@ -127,6 +132,11 @@ def main(args):
   wast2wasm.AppendOptionalArgs({
       '--debug-names': options.debug_names,
       '--future-exceptions': options.future_exceptions,
+      '--future-bulk-memory': options.future_bulk_memory,
+      '--future-simd': options.future_simd,
+      '--future-threads': options.future_threads,
+      '--future-tail-call': options.future_tail_call,
+      '--future-multi-value': options.future_multi_value,
       '--no-check': options.no_check,
   })
 
@@ -136,6 +146,11 @@ def main(args):
   wasm2wast.AppendOptionalArgs({
       '--fold-exprs': options.fold_exprs,
       '--future-exceptions': options.future_exceptions,
+      '--future-bulk-memory': options.future_bulk_memory,
+      '--future-simd': options.future_simd,
+      '--future-threads': options.future_threads,
+      '--future-tail-call': options.future_tail_call,
+      '--future-multi-value': options.future_multi_value,
       '--inline-exports': options.inline_exports,
       '--no-debug-names': not options.debug_names,
       '--generate-names': options.generate_names,
@@ -127,6 +127,16 @@ TOOLS = {
         ],
         'VERBOSE-FLAGS': ['--print-cmd', '-v']
     },
+    'run-validate': {
+        'EXE': 'test/run-validate.py',
+        'FLAGS': [
+                '--bindir=%(bindir)s',
+                '--no-error-cmdline',
+                '-o',
+                '%(out_dir)s'
+        ],
+        'VERBOSE-FLAGS': ['--print-cmd', '-v']
+    },
     'run-gen-spec-js': {
         'EXE': 'test/run-gen-spec-js.py',
         'FLAGS': [